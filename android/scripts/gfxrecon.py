@@ -92,6 +92,7 @@ def CreateReplayParser():
     parser.add_argument('--quit-after-measurement-range', action='store_true', default=False, help='If this is specified the replayer will abort when it reaches the <end_frame> specified in the --measurement-frame-range argument. (forwarded to replay tool)')
     parser.add_argument('--flush-measurement-range', action='store_true', default=False, help='If this is specified the replayer will flush and wait for all current GPU work to finish at the start and end of the measurement range. (forwarded to replay tool)')
     parser.add_argument('--flush-inside-measurement-range', action='store_true', default=False, help='If this is specified the replayer will flush and wait for all current GPU work to finish at end of each frame inside the measurement range. (forwarded to replay tool)')
+    parser.add_argument('--measurement-loop-count', metavar='COUNT', help='Replay the measurement range COUNT times in a row and report frame time statistics (min/median/p99) for each loop. The range is preloaded once and replayed again from memory, which implies --preload-measurement-range. State is not reset between loops, so replay stops after the first loop if the range creates or destroys objects. Default is 1. (forwarded to replay tool)')
     parser.add_argument('--sgfs', '--skip-get-fence-status', metavar='STATUS', default=0, help='Specify behaviour to skip calls to vkWaitForFences and vkGetFenceStatus. Default is 0 - No skip (forwarded to replay tool)')
     parser.add_argument('--sgfr', '--skip-get-fence-ranges', metavar='FRAME-RANGES', default='', help='Frame ranges where --sgfs applies. Default is all frames (forwarded to replay tool)')
     parser.add_argument('--wait-before-present', action='store_true', default=False, help='Force wait on completion of queue operations for all queues before calling Present. This is needed for accurate acquisition of instrumentation data on some platforms.')
@@ -115,6 +116,7 @@ def CreateReplayParser():
     parser.add_argument('--pbi-all', action='store_true', default=False, help='Print all block information.')
     parser.add_argument('--pbis', metavar='RANGES', default=False, help='Print block information between block index1 and block index2')
     parser.add_argument('--pcj', '--pipeline-creation-jobs', action='store_true', default=False, help='Specify the number of pipeline-creation-jobs or background-threads.')
+    parser.add_argument('--read-ahead', metavar='NUM_BUFFERS', help='Read and decompress the capture file on a background thread, which stays up to NUM_BUFFERS buffers of blocks ahead of replay (forwarded to replay tool)')
     return parser
 
 def MakeExtrasString(args):
@@ -209,6 +211,10 @@ def MakeExtrasString(args):
     if args.flush_inside_measurement_range:
         arg_list.append('--flush-inside-measurement-range')
 
+    if args.measurement_loop_count:
+        arg_list.append('--measurement-loop-count')
+        arg_list.append('{}'.format(args.measurement_loop_count))
+
     if args.swapchain:
         arg_list.append('--swapchain')
         arg_list.append('{}'.format(args.swapchain))
@@ -282,6 +288,10 @@ def MakeExtrasString(args):
         arg_list.append('--pbis')
         arg_list.append('{}'.format(args.pbis))
 
+    if args.read_ahead:
+        arg_list.append('--read-ahead')
+        arg_list.append('{}'.format(args.read_ahead))
+
     if args.pcj:
         arg_list.append('--pcj')
         arg_list.append('{}'.format(args.pcj))
@@ -157,7 +157,13 @@ void Application::Run()
                 {
                     auto* preload_processor = dynamic_cast<decode::PreloadFileProcessor*>(file_processor_);
                     GFXRECON_ASSERT(preload_processor)
-                    preload_processor->PreloadNextFrames(preload_frames_count);
+                    if (!preload_processor->PreloadNextFrames(preload_frames_count,
+                                                              fps_info_->GetMeasurementLoopCount() > 1))
+                    {
+                        // Stop before replaying the preloaded frames; the error state makes replay exit with failure.
+                        running_ = false;
+                        break;
+                    }
                 }
 
                 fps_info_->BeginFrame(frame_number);
@@ -174,6 +180,19 @@ void Application::Run()
                 {
                     file_processor_->WaitDecodersIdle();
                 }
+
+                if (fps_info_->ShouldRepeatMeasurementRange())
+                {
+                    // Let the GPU finish the previous loop so that loops don't overlap in the measurements.
+                    file_processor_->WaitDecodersIdle();
+
+                    auto* preload_processor = dynamic_cast<decode::PreloadFileProcessor*>(file_processor_);
+                    GFXRECON_ASSERT(preload_processor)
+                    if (!preload_processor->ReplayPreloadedFrames())
+                    {
+                        running_ = false;
+                    }
+                }
             }
         }
     }
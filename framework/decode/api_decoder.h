@@ -89,6 +89,22 @@ class ApiDecoder
     virtual void DispatchFillMemoryCommand(
         format::ThreadId thread_id, uint64_t memory_id, uint64_t offset, uint64_t size, const uint8_t* data) = 0;
 
+    // Allows the file processor to read or decompress fill memory command data directly into its final destination.
+    // When a non-null pointer is returned, it is passed back as the data argument to DispatchFillMemoryCommand.
+    virtual uint8_t* GetFillMemoryCommandDestination(
+        format::ThreadId thread_id, uint64_t memory_id, uint64_t offset, uint64_t size, bool needs_read_access)
+    {
+        return nullptr;
+    }
+
+    virtual void DispatchFillMemoryDeltaCommand(format::ThreadId thread_id,
+                                                uint64_t         memory_id,
+                                                uint64_t         offset,
+                                                uint64_t         size,
+                                                uint64_t         data_size,
+                                                const uint8_t*   data)
+    {}
+
     virtual void
     DispatchFillMemoryResourceValueCommand(const format::FillMemoryResourceValueCommandHeader& command_header,
                                            const uint8_t*                                      data) = 0;
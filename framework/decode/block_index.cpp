@@ -0,0 +1,173 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/block_index.h"
+
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <algorithm>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+const char     kIndexFileExtension[] = ".index";
+const uint32_t kIndexFourCC          = GFXRECON_MAKE_FOURCC('G', 'F', 'X', 'I');
+const uint32_t kIndexVersion         = 2;
+
+struct IndexFileHeader
+{
+    uint32_t fourcc;
+    uint32_t version;
+    uint64_t capture_file_size;
+    uint64_t entry_count;
+};
+
+std::string BlockIndex::GetIndexFilename(const std::string& capture_filename)
+{
+    return capture_filename + kIndexFileExtension;
+}
+
+bool BlockIndex::Load(const std::string& index_filename, uint64_t capture_file_size)
+{
+    FILE*   fd     = nullptr;
+    int32_t result = util::platform::FileOpen(&fd, index_filename.c_str(), "rb");
+
+    if ((result != 0) || (fd == nullptr))
+    {
+        return false;
+    }
+
+    IndexFileHeader header{};
+    bool            success = util::platform::FileRead(&header, sizeof(header), fd);
+
+    if (success)
+    {
+        if ((header.fourcc != kIndexFourCC) || (header.version != kIndexVersion))
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid block index file %s", index_filename.c_str());
+            success = false;
+        }
+        else if (header.capture_file_size != capture_file_size)
+        {
+            GFXRECON_LOG_WARNING("Ignoring block index file %s, which was generated for a different capture file",
+                                 index_filename.c_str());
+            success = false;
+        }
+        else
+        {
+            // Check the entry count against the size of the file before allocating space for the entries, as a
+            // truncated or corrupt file could otherwise request an arbitrarily large allocation.
+            int64_t file_size = -1;
+            if (util::platform::FileSeek(fd, 0, util::platform::FileSeekEnd))
+            {
+                file_size = util::platform::FileTell(fd);
+            }
+
+            if ((file_size < static_cast<int64_t>(sizeof(header))) ||
+                !util::platform::FileSeek(fd, sizeof(header), util::platform::FileSeekSet))
+            {
+                GFXRECON_LOG_WARNING("Failed to read block index file %s", index_filename.c_str());
+                success = false;
+            }
+            else if (header.entry_count != (static_cast<uint64_t>(file_size) - sizeof(header)) / sizeof(Entry))
+            {
+                GFXRECON_LOG_WARNING("Ignoring block index file %s, which is truncated or corrupt",
+                                     index_filename.c_str());
+                success = false;
+            }
+        }
+    }
+
+    if (success)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.entry_count);
+
+        entries_.resize(static_cast<size_t>(header.entry_count));
+        capture_file_size_ = header.capture_file_size;
+
+        success = util::platform::FileRead(entries_.data(), entries_.size() * sizeof(Entry), fd);
+
+        if (!success)
+        {
+            GFXRECON_LOG_WARNING("Failed to read block index file %s", index_filename.c_str());
+            entries_.clear();
+        }
+    }
+
+    util::platform::FileClose(fd);
+
+    return success;
+}
+
+bool BlockIndex::Save(const std::string& index_filename) const
+{
+    FILE*   fd     = nullptr;
+    int32_t result = util::platform::FileOpen(&fd, index_filename.c_str(), "wb");
+
+    if ((result != 0) || (fd == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open block index file %s for writing", index_filename.c_str());
+        return false;
+    }
+
+    IndexFileHeader header{ kIndexFourCC, kIndexVersion, capture_file_size_, entries_.size() };
+
+    bool success = util::platform::FileWrite(&header, sizeof(header), fd) &&
+                   util::platform::FileWrite(entries_.data(), entries_.size() * sizeof(Entry), fd);
+
+    util::platform::FileClose(fd);
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Failed to write block index file %s", index_filename.c_str());
+    }
+
+    return success;
+}
+
+const BlockIndex::Entry* BlockIndex::FindBlock(uint64_t block_index) const
+{
+    // Entries are recorded in block order.
+    auto entry = std::upper_bound(
+        entries_.begin(), entries_.end(), block_index, [](uint64_t value, const Entry& element) {
+            return value < element.block_index;
+        });
+
+    if (entry == entries_.begin())
+    {
+        return nullptr;
+    }
+
+    return &(*(entry - 1));
+}
+
+const BlockIndex::Entry* BlockIndex::FindDictionary() const
+{
+    auto entry = std::find_if(
+        entries_.begin(), entries_.end(), [](const Entry& element) { return element.type == kDictionary; });
+
+    return (entry != entries_.end()) ? &(*entry) : nullptr;
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,107 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_BLOCK_INDEX_H
+#define GFXRECON_DECODE_BLOCK_INDEX_H
+
+#include "util/defines.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Positions within a capture file that decoding can be resumed from, which are stored in a sidecar file next to the
+// capture file. Entries are recorded by a FileProcessor while it reads the capture file, in block order, and are used
+// to seek to a block without reading all of the blocks that precede it.
+class BlockIndex
+{
+  public:
+    enum EntryType : uint32_t
+    {
+        kSeekPoint        = 0, // Recorded at regular block intervals.
+        kFrameStart       = 1, // First block of a frame.
+        kStateBeginMarker = 2, // State snapshot begin marker block of a trimmed capture.
+        kStateEndMarker   = 3, // State snapshot end marker block of a trimmed capture.
+        kDictionary       = 4  // Compression dictionary meta-data block, which must be read before compressed blocks.
+    };
+
+    enum EntryFlags : uint32_t
+    {
+        kUsesFrameMarkers = 0x1 // Frames were delimited by frame marker blocks, rather than by API calls, at the block.
+    };
+
+    struct Entry
+    {
+        // Index of the block that the entry describes.
+        uint64_t block_index;
+
+        // File offset of the first block at or before block_index that is not stored in a compressed chunk, and the
+        // index of that block. Decoding resumes from this offset, skipping blocks until block_index is reached.
+        uint64_t offset;
+        uint64_t offset_block_index;
+
+        // Frame number of the block, as reported by FileProcessor::GetCurrentFrameNumber.
+        uint32_t  frame_number;
+        EntryType type;
+
+        // Frame delimiter state of the FileProcessor at the block, which is restored when seeking to the block.
+        uint64_t first_frame;
+        uint32_t flags;
+        uint32_t reserved;
+    };
+
+  public:
+    // Returns the name of the index file for the specified capture file.
+    static std::string GetIndexFilename(const std::string& capture_filename);
+
+    // The size of the capture file is stored with the index, so that an index for a different version of the capture
+    // file is not used.
+    void SetCaptureFileSize(uint64_t capture_file_size) { capture_file_size_ = capture_file_size; }
+
+    void AddEntry(const Entry& entry) { entries_.push_back(entry); }
+
+    const std::vector<Entry>& GetEntries() const { return entries_; }
+
+    // Returns false if the index file does not exist, is invalid, or was generated for a capture file with a different
+    // size.
+    bool Load(const std::string& index_filename, uint64_t capture_file_size);
+
+    bool Save(const std::string& index_filename) const;
+
+    // Returns the entry with the largest block index less than or equal to the specified block index, or nullptr.
+    const Entry* FindBlock(uint64_t block_index) const;
+
+    // Returns the entry for the compression dictionary block, or nullptr if the capture file does not have one.
+    const Entry* FindDictionary() const;
+
+  private:
+    std::vector<Entry> entries_;
+    uint64_t           capture_file_size_{ 0 };
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_BLOCK_INDEX_H
@@ -37,8 +37,9 @@ GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
 using util::JsonOptions;
+using util::JsonValue;
 
-void FieldToJson(nlohmann::ordered_json&                               jdata,
+void FieldToJson(JsonValue&                                            jdata,
                  VkGeometryTypeKHR                                     discriminant,
                  const Decoded_VkAccelerationStructureGeometryDataKHR* data,
                  const JsonOptions&                                    options)
@@ -62,9 +63,7 @@ void FieldToJson(nlohmann::ordered_json&                               jdata,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json&                           jdata,
-                 const Decoded_VkAccelerationStructureGeometryKHR* data,
-                 const JsonOptions&                                options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAccelerationStructureGeometryKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -77,7 +76,7 @@ void FieldToJson(nlohmann::ordered_json&                           jdata,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkClearValue* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkClearValue* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -89,19 +88,18 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkClearValue* data
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkClearColorValue* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkClearColorValue* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
         const auto& decoded_value = *data->decoded_value;
-        const auto& meta_struct   = *data;
         FieldToJson(jdata["float32"], decoded_value.float32, 4, options);
         FieldToJson(jdata["int32"], decoded_value.int32, 4, options);
         FieldToJson(jdata["uint32"], decoded_value.uint32, 4, options);
     }
 }
 
-void FieldToJson(nlohmann::ordered_json&                      jdata,
+void FieldToJson(JsonValue&                                   jdata,
                  int                                          discriminant,
                  const Decoded_VkDeviceOrHostAddressConstKHR* data,
                  const JsonOptions&                           options)
@@ -121,14 +119,12 @@ void FieldToJson(nlohmann::ordered_json&                      jdata,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json&                      jdata,
-                 const Decoded_VkDeviceOrHostAddressConstKHR* data,
-                 const JsonOptions&                           options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDeviceOrHostAddressConstKHR* data, const JsonOptions& options)
 {
     FieldToJson(jdata, 0, data, options);
 }
 
-void FieldToJson(nlohmann::ordered_json&                 jdata,
+void FieldToJson(JsonValue&                              jdata,
                  int                                     discriminant,
                  const Decoded_VkDeviceOrHostAddressKHR* data,
                  const JsonOptions&                      options)
@@ -148,14 +144,12 @@ void FieldToJson(nlohmann::ordered_json&                 jdata,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json&                 jdata,
-                 const Decoded_VkDeviceOrHostAddressKHR* data,
-                 const JsonOptions&                      options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDeviceOrHostAddressKHR* data, const JsonOptions& options)
 {
     FieldToJson(jdata, 0, data, options);
 }
 
-void FieldToJson(nlohmann::ordered_json&                              jdata,
+void FieldToJson(JsonValue&                                           jdata,
                  VkPipelineExecutableStatisticFormatKHR               discriminant,
                  const Decoded_VkPipelineExecutableStatisticValueKHR* data,
                  const JsonOptions&                                   options)
@@ -183,9 +177,7 @@ void FieldToJson(nlohmann::ordered_json&                              jdata,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json&                         jdata,
-                 const Decoded_VkPipelineExecutableStatisticKHR* data,
-                 const JsonOptions&                              options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineExecutableStatisticKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -200,7 +192,7 @@ void FieldToJson(nlohmann::ordered_json&                         jdata,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorImageInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDescriptorImageInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -212,7 +204,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorImageI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkWriteDescriptorSet* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkWriteDescriptorSet* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -261,7 +253,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkWriteDescriptorS
     }
 }
 
-void FieldToJson(nlohmann::ordered_json&                    jdata,
+void FieldToJson(JsonValue&                                 jdata,
                  const VkPerformanceValueTypeINTEL          discriminant,
                  const Decoded_VkPerformanceValueDataINTEL* data,
                  const JsonOptions&                         options)
@@ -293,7 +285,7 @@ void FieldToJson(nlohmann::ordered_json&                    jdata,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPerformanceValueINTEL* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPerformanceValueINTEL* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -304,9 +296,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPerformanceValue
     }
 }
 
-void FieldToJson(nlohmann::ordered_json&                 jdata,
-                 const Decoded_VkShaderModuleCreateInfo* data,
-                 const JsonOptions&                      options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkShaderModuleCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -322,7 +312,7 @@ void FieldToJson(nlohmann::ordered_json&                 jdata,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_SECURITY_ATTRIBUTES* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_SECURITY_ATTRIBUTES* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -334,9 +324,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_SECURITY_ATTRIBUTE
     }
 }
 
-void FieldToJson(nlohmann::ordered_json&                  jdata,
-                 const Decoded_VkPipelineCacheCreateInfo* data,
-                 const JsonOptions&                       options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineCacheCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -352,31 +340,29 @@ void FieldToJson(nlohmann::ordered_json&                  jdata,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json&                      jdata,
-                 const DescriptorUpdateTemplateDecoder* const pData,
-                 const JsonOptions&                           options)
+void FieldToJson(JsonValue& jdata, const DescriptorUpdateTemplateDecoder* const pData, const JsonOptions& options)
 {
     if (pData)
     {
-        const size_t                        image_info_count = pData->GetImageInfoCount();
-        std::vector<nlohmann::ordered_json> image_infos(image_info_count);
+        const size_t image_info_count = pData->GetImageInfoCount();
+        auto&        image_infos      = jdata["imageInfos"];
+        image_infos                   = nlohmann::ordered_json::array();
 
         for (size_t image_info_index = 0; image_info_index < image_info_count; ++image_info_index)
         {
             FieldToJson(
                 image_infos[image_info_index], pData->GetImageInfoMetaStructPointer() + image_info_index, options);
         }
-        jdata["imageInfos"] = image_infos;
 
-        const size_t                        buffer_info_count = pData->GetBufferInfoCount();
-        std::vector<nlohmann::ordered_json> buffer_infos(buffer_info_count);
+        const size_t buffer_info_count = pData->GetBufferInfoCount();
+        auto&        buffer_infos      = jdata["bufferInfos"];
+        buffer_infos                   = nlohmann::ordered_json::array();
 
         for (size_t buffer_info_index = 0; buffer_info_index < buffer_info_count; ++buffer_info_index)
         {
             FieldToJson(
                 buffer_infos[buffer_info_index], pData->GetBufferInfoMetaStructPointer() + buffer_info_index, options);
         }
-        jdata["bufferInfos"] = buffer_infos;
 
         const size_t texel_buffer_view_count = pData->GetTexelBufferViewCount();
         if (texel_buffer_view_count > 0)
@@ -397,9 +383,12 @@ void FieldToJson(nlohmann::ordered_json&                      jdata,
         const size_t inline_uniform_block_num_bytes = pData->GetInlineUniformBlockCount();
         if (inline_uniform_block_num_bytes > 0)
         {
-            jdata["inlineUniformBlock"] =
-                std::vector<uint8_t>(pData->GetInlineUniformBlockPointer(),
-                                     pData->GetInlineUniformBlockPointer() + inline_uniform_block_num_bytes);
+            const uint8_t* inline_uniform_block      = pData->GetInlineUniformBlockPointer();
+            auto&          inline_uniform_block_json = jdata["inlineUniformBlock"];
+            for (size_t i = 0; i < inline_uniform_block_num_bytes; ++i)
+            {
+                inline_uniform_block_json[i] = inline_uniform_block[i];
+            }
         }
     }
     else
@@ -408,7 +397,7 @@ void FieldToJson(nlohmann::ordered_json&                      jdata,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json&                                     jdata,
+void FieldToJson(JsonValue&                                                  jdata,
                  const Decoded_VkPushDescriptorSetWithTemplateInfoKHR* const pData,
                  const util::JsonOptions&                                    options)
 {
@@ -418,7 +407,7 @@ void FieldToJson(nlohmann::ordered_json&                                     jda
     FieldToJson(jdata["pData"], &pData->pData, options);
 }
 
-void FieldToJson(nlohmann::ordered_json&                                  jdata,
+void FieldToJson(JsonValue&                                               jdata,
                  const Decoded_VkIndirectExecutionSetCreateInfoEXT* const pData,
                  const util::JsonOptions&                                 options)
 {
@@ -436,7 +425,7 @@ void FieldToJson(nlohmann::ordered_json&                                  jdata,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json&                               jdata,
+void FieldToJson(JsonValue&                                            jdata,
                  const Decoded_VkIndirectCommandsLayoutTokenEXT* const pData,
                  const util::JsonOptions&                              options)
 {
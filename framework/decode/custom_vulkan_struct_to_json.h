@@ -40,86 +40,86 @@ GFXRECON_BEGIN_NAMESPACE(decode)
 
 class DescriptorUpdateTemplateDecoder;
 
-void FieldToJson(nlohmann::ordered_json&     jdata,
+void FieldToJson(util::JsonValue&            jdata,
                  const Decoded_VkClearValue* data,
                  const util::JsonOptions&    options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&          jdata,
+void FieldToJson(util::JsonValue&                 jdata,
                  const Decoded_VkClearColorValue* data,
                  const util::JsonOptions&         options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&                      jdata,
+void FieldToJson(util::JsonValue&                             jdata,
                  int                                          discriminant,
                  const Decoded_VkDeviceOrHostAddressConstKHR* data,
                  const util::JsonOptions&                     options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&                      jdata,
+void FieldToJson(util::JsonValue&                             jdata,
                  const Decoded_VkDeviceOrHostAddressConstKHR* data,
                  const util::JsonOptions&                     options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&                 jdata,
+void FieldToJson(util::JsonValue&                        jdata,
                  int                                     discriminant,
                  const Decoded_VkDeviceOrHostAddressKHR* data,
                  const util::JsonOptions&                options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&                 jdata,
+void FieldToJson(util::JsonValue&                        jdata,
                  const Decoded_VkDeviceOrHostAddressKHR* data,
                  const util::JsonOptions&                options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&                              jdata,
+void FieldToJson(util::JsonValue&                                     jdata,
                  VkPipelineExecutableStatisticFormatKHR               discriminant,
                  const Decoded_VkPipelineExecutableStatisticValueKHR* data,
                  const util::JsonOptions&                             options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&                         jdata,
+void FieldToJson(util::JsonValue&                                jdata,
                  const Decoded_VkPipelineExecutableStatisticKHR* data,
                  const util::JsonOptions&                        options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&            jdata,
+void FieldToJson(util::JsonValue&                   jdata,
                  const Decoded_SECURITY_ATTRIBUTES* data,
                  const util::JsonOptions&           options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&                               jdata,
+void FieldToJson(util::JsonValue&                                      jdata,
                  const Decoded_VkAccelerationStructureGeometryDataKHR* data,
                  const util::JsonOptions&                              options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&                           jdata,
+void FieldToJson(util::JsonValue&                                  jdata,
                  const Decoded_VkAccelerationStructureGeometryKHR* data,
                  const util::JsonOptions&                          options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&              jdata,
+void FieldToJson(util::JsonValue&                     jdata,
                  const Decoded_VkDescriptorImageInfo* data,
                  const util::JsonOptions&             options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&             jdata,
+void FieldToJson(util::JsonValue&                    jdata,
                  const Decoded_VkWriteDescriptorSet* data,
                  const util::JsonOptions&            options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&                jdata,
+void FieldToJson(util::JsonValue&                       jdata,
                  const Decoded_VkPerformanceValueINTEL* data,
                  const util::JsonOptions&               options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&                 jdata,
+void FieldToJson(util::JsonValue&                        jdata,
                  const Decoded_VkShaderModuleCreateInfo* data,
                  const util::JsonOptions&                options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&                  jdata,
+void FieldToJson(util::JsonValue&                         jdata,
                  const Decoded_VkPipelineCacheCreateInfo* data,
                  const util::JsonOptions&                 options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&                      jdata,
+void FieldToJson(util::JsonValue&                             jdata,
                  const DescriptorUpdateTemplateDecoder* const pData,
                  const util::JsonOptions&                     options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&                                     jdata,
+void FieldToJson(util::JsonValue&                                            jdata,
                  const Decoded_VkPushDescriptorSetWithTemplateInfoKHR* const pData,
                  const util::JsonOptions&                                    options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&                                  jdata,
+void FieldToJson(util::JsonValue&                                         jdata,
                  const Decoded_VkIndirectExecutionSetCreateInfoEXT* const pData,
                  const util::JsonOptions&                                 options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&                               jdata,
+void FieldToJson(util::JsonValue&                                      jdata,
                  const Decoded_VkIndirectCommandsLayoutTokenEXT* const pData,
                  const util::JsonOptions&                              options = util::JsonOptions());
 
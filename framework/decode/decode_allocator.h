@@ -62,8 +62,11 @@ class DecodeAllocator
     DecodeAllocator() : allocator_(kAllocatorBlockSize), can_allocate_(false), end_can_clear_(true) {}
 
   private:
-    static const size_t     kAllocatorBlockSize{ 64 * 1024 };
-    static DecodeAllocator* instance_;
+    static const size_t kAllocatorBlockSize{ 64 * 1024 };
+
+    // Each thread has its own instance, so that capture files can be decoded by multiple threads, each with its own
+    // FileProcessor.
+    static thread_local DecodeAllocator* instance_;
 
     util::MonotonicAllocator allocator_;
     bool                     can_allocate_;
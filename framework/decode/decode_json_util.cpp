@@ -28,8 +28,9 @@ GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
 using util::JsonOptions;
+using util::JsonValue;
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StringDecoder& data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StringDecoder& data, const JsonOptions& options)
 {
     const char* const decoded_data = data.GetPointer();
     if (decoded_data)
@@ -38,7 +39,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StringDecoder& data, const
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StringDecoder* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StringDecoder* data, const JsonOptions& options)
 {
     if (data)
     {
@@ -46,7 +47,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StringDecoder* data, const
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StringArrayDecoder* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StringArrayDecoder* data, const JsonOptions& options)
 {
     if (data && data->GetPointer())
     {
@@ -58,7 +59,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StringArrayDecoder* data,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const WStringDecoder& data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const WStringDecoder& data, const JsonOptions& options)
 {
     const wchar_t* const decoded_data = data.GetPointer();
     if (decoded_data)
@@ -67,7 +68,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const WStringDecoder& data, cons
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const WStringDecoder* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const WStringDecoder* data, const JsonOptions& options)
 {
     if (data)
     {
@@ -75,7 +76,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const WStringDecoder* data, cons
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const WStringArrayDecoder& data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const WStringArrayDecoder& data, const JsonOptions& options)
 {
     const auto decoded_data = data.GetPointer();
     if (decoded_data)
@@ -88,9 +89,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const WStringArrayDecoder& data,
 }
 
 template <>
-void FieldToJson(nlohmann::ordered_json&                   jdata,
-                 const PointerDecoder<uint32_t, uint32_t>& data,
-                 const JsonOptions&                        options)
+void FieldToJson(JsonValue& jdata, const PointerDecoder<uint32_t, uint32_t>& data, const JsonOptions& options)
 {
     if (data.GetPointer())
     {
@@ -111,9 +110,7 @@ void FieldToJson(nlohmann::ordered_json&                   jdata,
 }
 
 template <>
-void FieldToJson(nlohmann::ordered_json&                 jdata,
-                 const PointerDecoder<int32_t, int32_t>& data,
-                 const JsonOptions&                      options)
+void FieldToJson(JsonValue& jdata, const PointerDecoder<int32_t, int32_t>& data, const JsonOptions& options)
 {
     if (data.GetPointer())
     {
@@ -134,9 +131,7 @@ void FieldToJson(nlohmann::ordered_json&                 jdata,
 }
 
 template <>
-void FieldToJson(nlohmann::ordered_json&                   jdata,
-                 const PointerDecoder<uint64_t, uint64_t>& data,
-                 const JsonOptions&                        options)
+void FieldToJson(JsonValue& jdata, const PointerDecoder<uint64_t, uint64_t>& data, const JsonOptions& options)
 {
     if (data.GetPointer())
     {
@@ -157,9 +152,7 @@ void FieldToJson(nlohmann::ordered_json&                   jdata,
 }
 
 template <>
-void FieldToJson(nlohmann::ordered_json&                 jdata,
-                 const PointerDecoder<int64_t, int64_t>& data,
-                 const JsonOptions&                      options)
+void FieldToJson(JsonValue& jdata, const PointerDecoder<int64_t, int64_t>& data, const JsonOptions& options)
 {
     if (data.GetPointer())
     {
@@ -179,9 +172,7 @@ void FieldToJson(nlohmann::ordered_json&                 jdata,
     }
 }
 
-void Bool32ToJson(nlohmann::ordered_json&                   jdata,
-                  const PointerDecoder<uint32_t, uint32_t>* data,
-                  const util::JsonOptions&                  options)
+void Bool32ToJson(JsonValue& jdata, const PointerDecoder<uint32_t, uint32_t>* data, const util::JsonOptions& options)
 {
     if (data && data->GetPointer())
     {
@@ -202,7 +193,7 @@ void Bool32ToJson(nlohmann::ordered_json&                   jdata,
     }
 }
 
-void Bool32ToJson(nlohmann::ordered_json& jdata, const PointerDecoder<int, int>* data, const util::JsonOptions& options)
+void Bool32ToJson(JsonValue& jdata, const PointerDecoder<int, int>* data, const util::JsonOptions& options)
 {
     if (data && data->GetPointer())
     {
@@ -39,36 +39,36 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
-void FieldToJson(nlohmann::ordered_json&  jdata,
+void FieldToJson(util::JsonValue&         jdata,
                  const StringDecoder&     data,
                  const util::JsonOptions& options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&  jdata,
+void FieldToJson(util::JsonValue&         jdata,
                  const StringDecoder*     data,
                  const util::JsonOptions& options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&   jdata,
+void FieldToJson(util::JsonValue&          jdata,
                  const StringArrayDecoder& data,
                  const util::JsonOptions&  options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&   jdata,
+void FieldToJson(util::JsonValue&          jdata,
                  const StringArrayDecoder* data,
                  const util::JsonOptions&  options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&  jdata,
+void FieldToJson(util::JsonValue&         jdata,
                  const WStringDecoder&    data,
                  const util::JsonOptions& options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&  jdata,
+void FieldToJson(util::JsonValue&         jdata,
                  const WStringDecoder*    data,
                  const util::JsonOptions& options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&    jdata,
+void FieldToJson(util::JsonValue&           jdata,
                  const WStringArrayDecoder& data,
                  const util::JsonOptions&   options = util::JsonOptions());
 
 template <typename DecodedType, typename OutputDecodedType = DecodedType>
-void FieldToJson(nlohmann::ordered_json&                               jdata,
+void FieldToJson(util::JsonValue&                                      jdata,
                  const PointerDecoder<DecodedType, OutputDecodedType>* data,
                  const util::JsonOptions&                              options = util::JsonOptions())
 {
@@ -93,7 +93,7 @@ void FieldToJson(nlohmann::ordered_json&                               jdata,
 
 // Reference to pointer version wraps pointer to pointer version above.
 template <typename DecodedType, typename OutputDecodedType = DecodedType>
-void FieldToJson(nlohmann::ordered_json&                               jdata,
+void FieldToJson(util::JsonValue&                                      jdata,
                  const PointerDecoder<DecodedType, OutputDecodedType>& data,
                  const util::JsonOptions&                              options = util::JsonOptions())
 {
@@ -101,27 +101,27 @@ void FieldToJson(nlohmann::ordered_json&                               jdata,
 }
 
 template <>
-void FieldToJson(nlohmann::ordered_json&                   jdata,
+void FieldToJson(util::JsonValue&                          jdata,
                  const PointerDecoder<uint32_t, uint32_t>& data,
                  const util::JsonOptions&                  options);
 
 template <>
-void FieldToJson(nlohmann::ordered_json&                 jdata,
+void FieldToJson(util::JsonValue&                        jdata,
                  const PointerDecoder<int32_t, int32_t>& data,
                  const util::JsonOptions&                options);
 
 template <>
-void FieldToJson(nlohmann::ordered_json&                   jdata,
+void FieldToJson(util::JsonValue&                          jdata,
                  const PointerDecoder<uint64_t, uint64_t>& data,
                  const util::JsonOptions&                  options);
 
 template <>
-void FieldToJson(nlohmann::ordered_json&                 jdata,
+void FieldToJson(util::JsonValue&                        jdata,
                  const PointerDecoder<int64_t, int64_t>& data,
                  const util::JsonOptions&                options);
 
 template <typename DecodedType>
-void FieldToJson(nlohmann::ordered_json&                  jdata,
+void FieldToJson(util::JsonValue&                         jdata,
                  const StructPointerDecoder<DecodedType>* data,
                  const util::JsonOptions&                 options = util::JsonOptions())
 {
@@ -145,7 +145,7 @@ void FieldToJson(nlohmann::ordered_json&                  jdata,
 
 // Similar to above but DecodedType is pointed-to
 template <typename DecodedType>
-void FieldToJson(nlohmann::ordered_json&                   jdata,
+void FieldToJson(util::JsonValue&                          jdata,
                  const StructPointerDecoder<DecodedType*>* data,
                  const util::JsonOptions&                  options = util::JsonOptions())
 {
@@ -165,7 +165,8 @@ void FieldToJson(nlohmann::ordered_json&                   jdata,
             for (size_t i = 0; i < length; ++i)
             {
                 size_t inner_length = data->GetInnerLength(i);
-                auto&  jdata_arr    = jdata.emplace_back(nlohmann::ordered_json::array_t(inner_length));
+                auto&  jdata_arr    = jdata[i];
+                jdata_arr           = nlohmann::ordered_json::array();
                 for (size_t j = 0; j < inner_length; ++j)
                 {
                     FieldToJson(jdata_arr[j], &meta_struct[i][j], options);
@@ -180,7 +181,7 @@ void FieldToJson(nlohmann::ordered_json&                   jdata,
 }
 
 template <typename THandle>
-void HandleToJson(nlohmann::ordered_json&              jdata,
+void HandleToJson(util::JsonValue&                     jdata,
                   const HandlePointerDecoder<THandle>* data,
                   const util::JsonOptions&             options = util::JsonOptions())
 {
@@ -207,7 +208,7 @@ void HandleToJson(nlohmann::ordered_json&              jdata,
 /// used for pointers and arrays where the type of the HandlePointerDecoder
 /// allows the correct version to be resolved.
 template <typename THandle>
-void FieldToJson(nlohmann::ordered_json&              jdata,
+void FieldToJson(util::JsonValue&                     jdata,
                  const HandlePointerDecoder<THandle>* data,
                  const util::JsonOptions&             options = util::JsonOptions())
 {
@@ -216,7 +217,7 @@ void FieldToJson(nlohmann::ordered_json&              jdata,
 
 // Same as array FieldToJson above but converts elements pointed-to to hexadecimal
 template <typename DecodedType, typename OutputDecodedType = DecodedType>
-void FieldToJsonAsHex(nlohmann::ordered_json&                               jdata,
+void FieldToJsonAsHex(util::JsonValue&                                      jdata,
                       const PointerDecoder<DecodedType, OutputDecodedType>* data,
                       const util::JsonOptions&                              options = util::JsonOptions())
 {
@@ -240,7 +241,7 @@ void FieldToJsonAsHex(nlohmann::ordered_json&                               jdat
 }
 
 template <typename DecodedType, typename OutputDecodedType = DecodedType>
-void FieldToJsonAsHex(nlohmann::ordered_json&                               jdata,
+void FieldToJsonAsHex(util::JsonValue&                                      jdata,
                       const PointerDecoder<DecodedType, OutputDecodedType>& data,
                       const util::JsonOptions&                              options = util::JsonOptions())
 {
@@ -250,7 +251,7 @@ void FieldToJsonAsHex(nlohmann::ordered_json&                               jdat
 /// Same as array FieldToJson above but converts elements pointed-to to binary
 /// as a JSON string rather than as a JSON number type. Useful for bitmasks.
 template <typename DecodedType, typename OutputDecodedType = DecodedType>
-void FieldToJsonAsFixedWidthBinary(nlohmann::ordered_json&                               jdata,
+void FieldToJsonAsFixedWidthBinary(util::JsonValue&                                      jdata,
                                    const PointerDecoder<DecodedType, OutputDecodedType>& data,
                                    const util::JsonOptions&                              options = util::JsonOptions())
 {
@@ -274,7 +275,7 @@ void FieldToJsonAsFixedWidthBinary(nlohmann::ordered_json&
 }
 
 template <typename DecodedType, typename OutputDecodedType = DecodedType>
-void FieldToJsonAsFixedWidthBinary(nlohmann::ordered_json&                               jdata,
+void FieldToJsonAsFixedWidthBinary(util::JsonValue&                                      jdata,
                                    const PointerDecoder<DecodedType, OutputDecodedType>* data,
                                    const util::JsonOptions&                              options = util::JsonOptions())
 {
@@ -287,7 +288,7 @@ void FieldToJsonAsFixedWidthBinary(nlohmann::ordered_json&
 /// @brief Thunk to FieldToJsonAsFixedWidthBinary because consumers deliver pointers to non-const PointerDecoders
 /// and they fail to resolve to the const version above.
 template <typename DecodedType, typename OutputDecodedType = DecodedType>
-void FieldToJsonAsFixedWidthBinary(nlohmann::ordered_json&                         jdata,
+void FieldToJsonAsFixedWidthBinary(util::JsonValue&                                jdata,
                                    PointerDecoder<DecodedType, OutputDecodedType>* data,
                                    const util::JsonOptions&                        options = util::JsonOptions())
 {
@@ -299,26 +300,26 @@ void FieldToJsonAsFixedWidthBinary(nlohmann::ordered_json&
 
 // Used by (e.g.) VkMapMemory's ppData
 inline void
-FieldToJsonAsHex(nlohmann::ordered_json& jdata, PointerDecoder<uint64_t, void*>* data, const util::JsonOptions& options)
+FieldToJsonAsHex(util::JsonValue& jdata, PointerDecoder<uint64_t, void*>* data, const util::JsonOptions& options)
 {
     FieldToJsonAsHex<uint64_t, void*>(jdata, data, options);
 }
 
 inline void
-FieldToJsonAsHex(nlohmann::ordered_json& jdata, PointerDecoder<int64_t, void*>* data, const util::JsonOptions& options)
+FieldToJsonAsHex(util::JsonValue& jdata, PointerDecoder<int64_t, void*>* data, const util::JsonOptions& options)
 {
     FieldToJsonAsHex<int64_t, void*>(jdata, data, options);
 }
 
 /// Convert arrays of and pointers to bools. Since VkBool32 is just a typedef of
 /// uint32_t we can't use the standard function name and dispatch on the type.
-void Bool32ToJson(nlohmann::ordered_json&                   jdata,
+void Bool32ToJson(util::JsonValue&                          jdata,
                   const PointerDecoder<uint32_t, uint32_t>* data,
                   const util::JsonOptions&                  options = util::JsonOptions());
 
 /// Convert arrays of and pointers to bools. Since the Windows BOOL is just a
 /// typedef of int we can't use the standard function name and dispatch on the type.
-void Bool32ToJson(nlohmann::ordered_json&         jdata,
+void Bool32ToJson(util::JsonValue&                jdata,
                   const PointerDecoder<int, int>* data,
                   const util::JsonOptions&        options = util::JsonOptions());
 
@@ -1504,8 +1504,8 @@ void DefaultDx12DumpResourcesDelegate::BeginDumpResources(const std::string&
 
     WriteBlockStart();
 
-    util::FieldToJson(draw_call_["block_index"], track_dump_resources.target.draw_call_block_index, json_options_);
-    util::FieldToJson(draw_call_["execute_block_index"], track_dump_resources.target.execute_block_index, json_options_);
+    draw_call_["block_index"]         = track_dump_resources.target.draw_call_block_index;
+    draw_call_["execute_block_index"] = track_dump_resources.target.execute_block_index;
 }
 
 void DefaultDx12DumpResourcesDelegate::DumpResource(CopyResourceDataPtr resource_data)
@@ -1560,7 +1560,7 @@ void DefaultDx12DumpResourcesDelegate::WriteResource(nlohmann::ordered_json&   j
 
     std::string file_name = prefix_file_name + "_res_id_" + std::to_string(resource_data->source_resource_id);
 
-    util::FieldToJson(jdata["res_id"], resource_data->source_resource_id, json_options_);
+    jdata["res_id"] = resource_data->source_resource_id;
 
     std::string suffix    = Dx12DumpResourcePosToString(resource_data->dump_position);
     std::string json_path = suffix + "_file";
@@ -1570,15 +1570,15 @@ void DefaultDx12DumpResourcesDelegate::WriteResource(nlohmann::ordered_json&   j
         auto size   = resource_data->subresource_sizes[sub_index];
 
         auto& jdata_sub = jdata["sub"][sub_index];
-        util::FieldToJson(jdata_sub["index"], sub_index, json_options_);
-        util::FieldToJson(jdata_sub["offset"], offset, json_options_);
-        util::FieldToJson(jdata_sub["size"], size, json_options_);
+        jdata_sub["index"]  = sub_index;
+        jdata_sub["offset"] = offset;
+        jdata_sub["size"]   = size;
 
         // Write data.
         GFXRECON_ASSERT(!resource_data->datas[sub_index].empty());
 
         std::string file_name_sub = file_name + "_sub_" + std::to_string(sub_index) + "_" + suffix + ".bin";
-        util::FieldToJson(jdata_sub[json_path], file_name_sub.c_str(), json_options_);
+        jdata_sub[json_path] = file_name_sub;
 
         std::string file_path = gfxrecon::util::filepath::Join(json_options_.root_dir, file_name_sub);
         WriteBinaryFile(file_path, resource_data->datas[sub_index], offset, size);
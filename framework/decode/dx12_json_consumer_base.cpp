@@ -191,11 +191,11 @@ void Dx12JsonConsumerBase::Process_ID3D12Device_CheckFeatureSupport(format::Hand
     call_info.index     = GetCurrentBlockIndex();
     call_info.thread_id = format::kNameUnknownThreadId;
 
-    nlohmann::ordered_json& method =
+    JsonValue& method =
         writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CheckFeatureSupport");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], original_result, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Feature"], feature, options);
         FieldToJson(args["pFeatureSupportData"], nullptr, options);
@@ -220,11 +220,11 @@ void Dx12JsonConsumerBase::Process_IDXGIFactory5_CheckFeatureSupport(format::Han
     call_info.index     = GetCurrentBlockIndex();
     call_info.thread_id = format::kNameUnknownThreadId;
 
-    nlohmann::ordered_json& method =
+    JsonValue& method =
         writer_->WriteApiCallStart(call_info, "IDXGIFactory5", object_id, "CheckFeatureSupport");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], original_result, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Feature"], feature, options);
         FieldToJson(args["pFeatureSupportData"], nullptr, options);
@@ -250,11 +250,11 @@ void Dx12JsonConsumerBase::Process_ID3D12Resource_WriteToSubresource(format::Han
     call_info.index     = GetCurrentBlockIndex();
     call_info.thread_id = format::kNameUnknownThreadId;
 
-    nlohmann::ordered_json& method =
+    JsonValue& method =
         writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "WriteToSubresource");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["DstSubresource"], DstSubresource, options);
         FieldToJson(args["pDstBox"], pDstBox, options);
@@ -32,6 +32,7 @@
 #include "util/logging.h"
 #include "util/platform.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
 #include <memory>
@@ -44,6 +45,12 @@ GFXRECON_BEGIN_NAMESPACE(decode)
 // TODO GH #1195: frame numbering should be 1-based.
 const uint32_t kFirstFrame = 0;
 
+// Number of blocks between the seek points recorded to a block index.
+const uint64_t kBlockIndexSeekInterval = 4096;
+
+// Resource data shared through asset data references is cached until it exceeds this size.
+const size_t kMaxAssetDataCacheSize = 256 * 1024 * 1024;
+
 FileProcessor::FileProcessor() :
     current_frame_number_(kFirstFrame), error_state_(kErrorInvalidFileDescriptor), bytes_read_(0),
     annotation_handler_(nullptr), compressor_(nullptr), block_index_(0), api_call_index_(0), block_limit_(0),
@@ -65,9 +72,19 @@ FileProcessor::~FileProcessor()
 
     for (auto& file : active_files_)
     {
+        if (file.second.mapped_data != nullptr)
+        {
+            util::platform::UnmapFile(file.second.mapped_data, file.second.mapped_size);
+        }
+
         util::platform::FileClose(file.second.fd);
     }
 
+    if (asset_data_fd_ != nullptr)
+    {
+        util::platform::FileClose(asset_data_fd_);
+    }
+
     DecodeAllocator::DestroyInstance();
 }
 
@@ -87,6 +104,11 @@ bool FileProcessor::Initialize(const std::string& filename)
     {
         success = SetActiveFile(filename, true);
         success = success && ProcessFileHeader();
+
+        if (success && (read_ahead_buffer_count_ > 0))
+        {
+            StartReadAhead();
+        }
     }
     else
     {
@@ -127,7 +149,21 @@ bool FileProcessor::OpenFile(const std::string& filename)
         }
         else
         {
-            active_files_.emplace(std::piecewise_construct, std::forward_as_tuple(filename), std::forward_as_tuple(fd));
+            auto entry = active_files_.emplace(
+                std::piecewise_construct, std::forward_as_tuple(filename), std::forward_as_tuple(fd));
+
+            if (use_file_mapping_)
+            {
+                ActiveFiles& active_file = entry.first->second;
+                active_file.mapped_data =
+                    reinterpret_cast<const uint8_t*>(util::platform::MapFileReadOnly(fd, &active_file.mapped_size));
+
+                if (active_file.mapped_data == nullptr)
+                {
+                    GFXRECON_LOG_DEBUG("Failed to map file %s; reading it with file I/O instead", filename.c_str());
+                }
+            }
+
             error_state_ = kErrorNone;
         }
     }
@@ -135,6 +171,172 @@ bool FileProcessor::OpenFile(const std::string& filename)
     return true;
 }
 
+void FileProcessor::StartReadAhead()
+{
+    ActiveFileContext& current_file = GetCurrentFile();
+    int64_t            offset       = GetActiveFilePosition();
+
+    auto read_ahead = std::make_unique<FileReadAhead>(read_ahead_buffer_count_);
+
+    if ((offset >= 0) && read_ahead->Start(current_file.filename, offset, enabled_options_.compression_type))
+    {
+        current_file.read_ahead = std::move(read_ahead);
+    }
+    else
+    {
+        GFXRECON_LOG_WARNING("Failed to start reading file %s ahead of decoding; the file will be read on the "
+                             "decode thread",
+                             current_file.filename.c_str());
+    }
+}
+
+int64_t FileProcessor::GetActiveFilePosition() const
+{
+    auto file_entry = active_files_.find(file_stack_.back().filename);
+    assert(file_entry != active_files_.end());
+
+    const ActiveFiles& active_file = file_entry->second;
+
+    return (active_file.mapped_data != nullptr) ? static_cast<int64_t>(active_file.mapped_offset)
+                                                : util::platform::FileTell(active_file.fd);
+}
+
+bool FileProcessor::SeekToBlock(const BlockIndex& index, uint64_t block_index)
+{
+    const BlockIndex::Entry* entry = index.FindBlock(block_index);
+
+    return (entry != nullptr) && LoadIndexedDictionary(index, block_index) && SeekToIndexEntry(*entry, block_index);
+}
+
+bool FileProcessor::LoadIndexedDictionary(const BlockIndex& index, uint64_t block_index)
+{
+    const BlockIndex::Entry* entry   = index.FindDictionary();
+    bool                     success = true;
+
+    // Compressed blocks after the dictionary block cannot be decoded unless the dictionary block is processed first.
+    if ((entry != nullptr) && (entry->block_index < block_index))
+    {
+        success = SeekToIndexEntry(*entry, entry->block_index);
+
+        if (success)
+        {
+            format::BlockHeader block_header;
+            format::MetaDataId  meta_data_id = format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_None,
+                                                                     format::MetaDataType::kUnknownMetaDataType);
+
+            success = ReadBlockHeader(&block_header) && ReadBytes(&meta_data_id, sizeof(meta_data_id)) &&
+                      ProcessMetaData(block_header, meta_data_id);
+        }
+    }
+
+    return success;
+}
+
+bool FileProcessor::SeekToIndexEntry(const BlockIndex::Entry& entry, uint64_t block_index)
+{
+    // Only the capture file is indexed, so seeking is not possible while blocks from another file are processed.
+    if (file_stack_.size() != 1)
+    {
+        return false;
+    }
+
+    ActiveFileContext& current_file = GetCurrentFile();
+    bool               read_ahead   = (current_file.read_ahead != nullptr);
+
+    // Read-ahead is restarted from the new position.
+    current_file.read_ahead.reset();
+    current_file.chunk_data.clear();
+    current_file.chunk_offset = 0;
+
+    bool success = SeekActiveFile(static_cast<int64_t>(entry.offset), util::platform::FileSeekSet);
+
+    if (success)
+    {
+        block_index_                = entry.offset_block_index;
+        current_frame_number_       = entry.frame_number;
+        index_frame_number_         = entry.frame_number;
+        first_frame_                = entry.first_frame;
+        capture_uses_frame_markers_ = ((entry.flags & BlockIndex::kUsesFrameMarkers) != 0);
+
+        // Skip the blocks between the resume position and the requested block, which may be stored in a chunk.
+        while (success && (block_index_ < block_index))
+        {
+            format::BlockHeader block_header;
+
+            success = ReadBlockHeader(&block_header);
+
+            if (success)
+            {
+                GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+                success = SkipBytes(static_cast<size_t>(block_header.size));
+                ++block_index_;
+            }
+        }
+    }
+
+    if (success && read_ahead)
+    {
+        StartReadAhead();
+    }
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Failed to seek to block %" PRIu64 " with the block index", block_index);
+        error_state_ = kErrorReadingFile;
+    }
+
+    return success;
+}
+
+void FileProcessor::UpdateBlockIndexPosition()
+{
+    ActiveFileContext& current_file = GetCurrentFile();
+
+    // Decoding can only resume from blocks that are not stored in a compressed chunk.
+    if (current_file.chunk_offset == current_file.chunk_data.size())
+    {
+        int64_t position = GetActiveFilePosition();
+
+        if (position >= 0)
+        {
+            index_seek_offset_      = static_cast<uint64_t>(position);
+            index_seek_block_index_ = block_index_;
+        }
+    }
+}
+
+void FileProcessor::RecordBlockIndexEntries()
+{
+    if (current_frame_number_ != index_frame_number_)
+    {
+        AddBlockIndexEntry(BlockIndex::kFrameStart);
+        index_frame_number_    = current_frame_number_;
+        index_next_seek_point_ = block_index_ + kBlockIndexSeekInterval;
+    }
+    else if (block_index_ >= index_next_seek_point_)
+    {
+        AddBlockIndexEntry(BlockIndex::kSeekPoint);
+        index_next_seek_point_ = block_index_ + kBlockIndexSeekInterval;
+    }
+}
+
+void FileProcessor::AddBlockIndexEntry(BlockIndex::EntryType type)
+{
+    assert(block_index_recorder_ != nullptr);
+
+    BlockIndex::Entry entry;
+    entry.block_index        = block_index_;
+    entry.offset             = index_seek_offset_;
+    entry.offset_block_index = index_seek_block_index_;
+    entry.frame_number       = static_cast<uint32_t>(current_frame_number_);
+    entry.type               = type;
+    entry.first_frame        = first_frame_;
+    entry.flags              = capture_uses_frame_markers_ ? BlockIndex::kUsesFrameMarkers : 0;
+    entry.reserved           = 0;
+
+    block_index_recorder_->AddEntry(entry);
+}
+
 bool FileProcessor::ProcessNextFrame()
 {
     bool success = IsFileValid();
@@ -444,7 +646,7 @@ bool FileProcessor::ProcessBlocks()
             }
             else
             {
-                if (!feof(GetFileDescriptor()))
+                if (!IsActiveFileEof())
                 {
                     // No data has been read for the current block, so we don't use 'HandleBlockReadError' here, as it
                     // assumes that the block header has been successfully read and will print an incomplete block at
@@ -483,73 +685,464 @@ bool FileProcessor::ReadBlockHeader(format::BlockHeader* block_header)
 
     bool success = false;
 
+    const bool record_index =
+        (block_index_recorder_ != nullptr) && (file_stack_.size() == 1) && (GetCurrentFile().read_ahead == nullptr);
+
+    if (record_index)
+    {
+        UpdateBlockIndexPosition();
+    }
+
     if (ReadBytes(block_header, sizeof(*block_header)))
     {
         success = true;
+
+        if (record_index)
+        {
+            RecordBlockIndexEntries();
+        }
+
+        // Compressed chunks are expanded in place, so the caller receives the first block stored in the chunk.
+        while (success && (block_header->type == format::BlockType::kCompressedChunkBlock))
+        {
+            success = ReadCompressedChunk(*block_header) && ReadBytes(block_header, sizeof(*block_header));
+        }
     }
 
     return success;
 }
 
-bool FileProcessor::ReadParameterBuffer(size_t buffer_size)
-{
-    if (buffer_size > parameter_buffer_.size())
+bool FileProcessor::ReadCompressedChunk(const format::BlockHeader& block_header)
+{
+    ActiveFileContext& current_file = GetCurrentFile();
+
+    // Blocks never span chunks, so the previous chunk must have been consumed before the next chunk header was read.
+    assert(current_file.chunk_offset == current_file.chunk_data.size());
+
+    uint64_t uncompressed_size = 0;
+    uint32_t block_count       = 0;
+    size_t   header_size       = sizeof(uncompressed_size) + sizeof(block_count);
+
+    if ((compressor_ == nullptr) || (block_header.size < header_size) ||
+        !ReadFileBytes(&uncompressed_size, sizeof(uncompressed_size)) ||
+        !ReadFileBytes(&block_count, sizeof(block_count)))
+    {
+        GFXRECON_LOG_ERROR("Failed to read compressed chunk header (frame %u block %" PRIu64 ")",
+                           current_frame_number_,
+                           block_index_);
+        return false;
+    }
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, uncompressed_size);
+
+    size_t compressed_size = static_cast<size_t>(block_header.size) - header_size;
+
+    if (compressed_size > compressed_parameter_buffer_.size())
+    {
+        compressed_parameter_buffer_.resize(compressed_size);
+    }
+
+    bool success = false;
+
+    if (ReadFileBytes(compressed_parameter_buffer_.data(), compressed_size))
+    {
+        // The chunk becomes the source for subsequent reads once it has been filled.
+        current_file.chunk_data.resize(static_cast<size_t>(uncompressed_size));
+        current_file.chunk_offset = 0;
+
+        success = (compressor_->Decompress(compressed_size,
+                                           compressed_parameter_buffer_,
+                                           static_cast<size_t>(uncompressed_size),
+                                           &current_file.chunk_data) == uncompressed_size);
+    }
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Failed to read compressed chunk of %u blocks (frame %u block %" PRIu64 ")",
+                           block_count,
+                           current_frame_number_,
+                           block_index_);
+        current_file.chunk_data.clear();
+    }
+
+    return success;
+}
+
+bool FileProcessor::ReadParameterBuffer(size_t buffer_size)
+{
+    if (buffer_size > parameter_buffer_.size())
+    {
+        parameter_buffer_.resize(buffer_size);
+    }
+
+    return ReadBytes(parameter_buffer_.data(), buffer_size);
+}
+
+bool FileProcessor::ReadParameterData(size_t buffer_size, const uint8_t** parameter_data)
+{
+    assert(parameter_data != nullptr);
+
+    const uint8_t* data = ReadBytesInPlace(buffer_size);
+
+    if (data == nullptr)
+    {
+        if (!ReadParameterBuffer(buffer_size))
+        {
+            return false;
+        }
+
+        data = parameter_buffer_.data();
+    }
+
+    *parameter_data = data;
+    return true;
+}
+
+bool FileProcessor::ReadCompressedParameterBuffer(size_t  compressed_buffer_size,
+                                                  size_t  expected_uncompressed_size,
+                                                  size_t* uncompressed_buffer_size)
+{
+    // This should only be null if initialization failed.
+    assert(compressor_ != nullptr);
+
+    if (compressed_buffer_size > compressed_parameter_buffer_.size())
+    {
+        compressed_parameter_buffer_.resize(compressed_buffer_size);
+    }
+
+    if (parameter_buffer_.size() < expected_uncompressed_size)
+    {
+        parameter_buffer_.resize(expected_uncompressed_size);
+    }
+
+    if (ReadCompressedParameterData(compressed_buffer_size, expected_uncompressed_size, parameter_buffer_.data()))
+    {
+        *uncompressed_buffer_size = expected_uncompressed_size;
+        return true;
+    }
+    return false;
+}
+
+bool FileProcessor::ReadCompressedParameterData(size_t   compressed_buffer_size,
+                                                size_t   expected_uncompressed_size,
+                                                uint8_t* uncompressed_data)
+{
+    // This should only be null if initialization failed.
+    assert(compressor_ != nullptr);
+
+    if (compressed_buffer_size > compressed_parameter_buffer_.size())
+    {
+        compressed_parameter_buffer_.resize(compressed_buffer_size);
+    }
+
+    if (ReadBytes(compressed_parameter_buffer_.data(), compressed_buffer_size))
+    {
+        size_t uncompressed_size = compressor_->Decompress(compressed_buffer_size,
+                                                           compressed_parameter_buffer_.data(),
+                                                           expected_uncompressed_size,
+                                                           uncompressed_data);
+        if ((0 < uncompressed_size) && (uncompressed_size == expected_uncompressed_size))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint8_t* FileProcessor::GetFillMemoryCommandDestination(format::MetaDataId                     meta_data_id,
+                                                        const format::FillMemoryCommandHeader& header,
+                                                        bool                                   needs_read_access)
+{
+    uint8_t*    destination    = nullptr;
+    ApiDecoder* target_decoder = nullptr;
+    size_t      decoder_count  = 0;
+
+    for (auto decoder : decoders_)
+    {
+        if (decoder->SupportsMetaDataId(meta_data_id))
+        {
+            target_decoder = decoder;
+            ++decoder_count;
+        }
+    }
+
+    if ((decoder_count == 1) && (header.memory_size > 0))
+    {
+        destination = target_decoder->GetFillMemoryCommandDestination(
+            header.thread_id, header.memory_id, header.memory_offset, header.memory_size, needs_read_access);
+    }
+
+    return destination;
+}
+
+bool FileProcessor::ReadAssetData(int64_t data_block_offset, size_t data_size, const uint8_t** data)
+{
+    assert(data != nullptr);
+
+    const std::string& filename = GetCurrentFile().filename;
+
+    if ((asset_data_fd_ == nullptr) || (asset_data_filename_ != filename))
+    {
+        if (asset_data_fd_ != nullptr)
+        {
+            util::platform::FileClose(asset_data_fd_);
+            asset_data_fd_ = nullptr;
+        }
+
+        asset_data_cache_.clear();
+        asset_data_cache_size_ = 0;
+        asset_data_filename_   = filename;
+
+        int32_t result = util::platform::FileOpen(&asset_data_fd_, filename.c_str(), "rb");
+
+        if ((result != 0) || (asset_data_fd_ == nullptr))
+        {
+            GFXRECON_LOG_ERROR("Failed to open file %s to read asset data", filename.c_str());
+            asset_data_fd_ = nullptr;
+            return false;
+        }
+    }
+
+    auto entry = asset_data_cache_.find(data_block_offset);
+
+    if (entry != asset_data_cache_.end())
+    {
+        if (entry->second.size() != data_size)
+        {
+            return false;
+        }
+
+        *data = entry->second.data();
+        return true;
+    }
+
+    format::BlockHeader block_header;
+    format::MetaDataId  meta_data_id = 0;
+    size_t              header_size  = sizeof(meta_data_id);
+    uint64_t            stored_size  = 0;
+
+    bool success = util::platform::FileSeek(asset_data_fd_, data_block_offset, util::platform::FileSeekSet);
+    success      = success && util::platform::FileRead(&block_header, sizeof(block_header), asset_data_fd_);
+    success      = success && util::platform::FileRead(&meta_data_id, sizeof(meta_data_id), asset_data_fd_);
+
+    if (success && (format::GetMetaDataType(meta_data_id) == format::MetaDataType::kInitBufferCommand))
+    {
+        format::InitBufferCommandHeader header;
+        size_t                          parameters_size = sizeof(header) - sizeof(header.meta_header);
+
+        success     = util::platform::FileRead(&header.thread_id, parameters_size, asset_data_fd_);
+        header_size += parameters_size;
+        stored_size = header.data_size;
+    }
+    else if (success && (format::GetMetaDataType(meta_data_id) == format::MetaDataType::kInitImageCommand))
+    {
+        format::InitImageCommandHeader header;
+        size_t                         parameters_size = sizeof(header) - sizeof(header.meta_header);
+
+        success     = util::platform::FileRead(&header.thread_id, parameters_size, asset_data_fd_);
+        header_size += parameters_size;
+        stored_size = header.data_size;
+
+        if (success && (header.level_count > 0))
+        {
+            size_t levels_size = header.level_count * sizeof(uint64_t);
+
+            success     = util::platform::FileSeek(asset_data_fd_, levels_size, util::platform::FileSeekCurrent);
+            header_size += levels_size;
+        }
+    }
+    else
+    {
+        success = false;
+    }
+
+    if (!success || (stored_size != data_size) || (block_header.size < header_size))
+    {
+        GFXRECON_LOG_ERROR("Asset data reference to offset %" PRId64 " does not reference resource data",
+                           data_block_offset);
+        return false;
+    }
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+
+    size_t               stored_data_size = static_cast<size_t>(block_header.size) - header_size;
+    std::vector<uint8_t> stored_data(stored_data_size);
+
+    success = util::platform::FileRead(stored_data.data(), stored_data_size, asset_data_fd_);
+
+    if (success && format::IsBlockCompressed(block_header.type))
+    {
+        std::vector<uint8_t> uncompressed_data(data_size);
+
+        success = (compressor_ != nullptr) &&
+                  (compressor_->Decompress(stored_data_size, stored_data, data_size, &uncompressed_data) == data_size);
+
+        stored_data = std::move(uncompressed_data);
+    }
+    else
+    {
+        success = success && (stored_data_size == data_size);
+    }
+
+    if (!success)
+    {
+        return false;
+    }
+
+    if ((asset_data_cache_size_ + data_size) > kMaxAssetDataCacheSize)
+    {
+        asset_data_cache_.clear();
+        asset_data_cache_size_ = 0;
+    }
+
+    asset_data_cache_size_ += data_size;
+
+    *data = asset_data_cache_.emplace(data_block_offset, std::move(stored_data)).first->second.data();
+    return true;
+}
+
+bool FileProcessor::ReadBytes(void* buffer, size_t buffer_size)
+{
+    return ReadFileBytes(buffer, buffer_size);
+}
+
+bool FileProcessor::ReadFileBytes(void* buffer, size_t buffer_size)
+{
+    ActiveFileContext& current_file    = GetCurrentFile();
+    size_t             chunk_remaining = current_file.chunk_data.size() - current_file.chunk_offset;
+
+    if (chunk_remaining > 0)
+    {
+        // Reads are never split between a chunk and the file, because chunks only contain complete blocks.
+        if (buffer_size > chunk_remaining)
+        {
+            return false;
+        }
+
+        util::platform::MemoryCopy(
+            buffer, buffer_size, current_file.chunk_data.data() + current_file.chunk_offset, buffer_size);
+        current_file.chunk_offset += buffer_size;
+        return true;
+    }
+
+    if (current_file.read_ahead != nullptr)
+    {
+        if (current_file.read_ahead->Read(buffer, buffer_size))
+        {
+            bytes_read_ += buffer_size;
+            return true;
+        }
+        return false;
+    }
+
+    auto file_entry = active_files_.find(current_file.filename);
+    assert(file_entry != active_files_.end());
+
+    ActiveFiles& active_file = file_entry->second;
+
+    if (active_file.mapped_data != nullptr)
+    {
+        if (buffer_size > (active_file.mapped_size - active_file.mapped_offset))
+        {
+            active_file.mapped_offset = active_file.mapped_size;
+            active_file.mapped_eof    = true;
+            return false;
+        }
+
+        util::platform::MemoryCopy(
+            buffer, buffer_size, active_file.mapped_data + active_file.mapped_offset, buffer_size);
+        active_file.mapped_offset += buffer_size;
+        bytes_read_ += buffer_size;
+        return true;
+    }
+
+    if (util::platform::FileRead(buffer, buffer_size, active_file.fd))
     {
-        parameter_buffer_.resize(buffer_size);
+        bytes_read_ += buffer_size;
+        return true;
     }
-
-    return ReadBytes(parameter_buffer_.data(), buffer_size);
+    return false;
 }
 
-bool FileProcessor::ReadCompressedParameterBuffer(size_t  compressed_buffer_size,
-                                                  size_t  expected_uncompressed_size,
-                                                  size_t* uncompressed_buffer_size)
+const uint8_t* FileProcessor::ReadBytesInPlace(size_t buffer_size)
 {
-    // This should only be null if initialization failed.
-    assert(compressor_ != nullptr);
+    ActiveFileContext& current_file    = GetCurrentFile();
+    size_t             chunk_remaining = current_file.chunk_data.size() - current_file.chunk_offset;
 
-    if (compressed_buffer_size > compressed_parameter_buffer_.size())
+    if (chunk_remaining > 0)
     {
-        compressed_parameter_buffer_.resize(compressed_buffer_size);
+        if (buffer_size > chunk_remaining)
+        {
+            return nullptr;
+        }
+
+        const uint8_t* data = current_file.chunk_data.data() + current_file.chunk_offset;
+        current_file.chunk_offset += buffer_size;
+        return data;
     }
 
-    if (ReadBytes(compressed_parameter_buffer_.data(), compressed_buffer_size))
+    if (current_file.read_ahead != nullptr)
     {
-        if (parameter_buffer_.size() < expected_uncompressed_size)
-        {
-            parameter_buffer_.resize(expected_uncompressed_size);
-        }
+        const uint8_t* data = current_file.read_ahead->ReadInPlace(buffer_size);
 
-        size_t uncompressed_size = compressor_->Decompress(
-            compressed_buffer_size, compressed_parameter_buffer_, expected_uncompressed_size, &parameter_buffer_);
-        if ((0 < uncompressed_size) && (uncompressed_size == expected_uncompressed_size))
+        if (data != nullptr)
         {
-            *uncompressed_buffer_size = uncompressed_size;
-            return true;
+            bytes_read_ += buffer_size;
         }
+        return data;
     }
-    return false;
-}
 
-bool FileProcessor::ReadBytes(void* buffer, size_t buffer_size)
-{
-    auto file_entry = active_files_.find(file_stack_.back().filename);
+    auto file_entry = active_files_.find(current_file.filename);
     assert(file_entry != active_files_.end());
 
-    if (util::platform::FileRead(buffer, buffer_size, file_entry->second.fd))
+    ActiveFiles& active_file = file_entry->second;
+
+    if ((active_file.mapped_data == nullptr) ||
+        (buffer_size > (active_file.mapped_size - active_file.mapped_offset)))
     {
-        bytes_read_ += buffer_size;
-        return true;
+        return nullptr;
     }
-    return false;
+
+    const uint8_t* data = active_file.mapped_data + active_file.mapped_offset;
+    active_file.mapped_offset += buffer_size;
+    bytes_read_ += buffer_size;
+    return data;
 }
 
 bool FileProcessor::SkipBytes(size_t skip_size)
 {
-    auto file_entry = active_files_.find(file_stack_.back().filename);
+    ActiveFileContext& current_file    = GetCurrentFile();
+    size_t             chunk_remaining = current_file.chunk_data.size() - current_file.chunk_offset;
+
+    if (chunk_remaining > 0)
+    {
+        if (skip_size > chunk_remaining)
+        {
+            return false;
+        }
+
+        current_file.chunk_offset += skip_size;
+        return true;
+    }
+
+    auto file_entry = active_files_.find(current_file.filename);
     assert(file_entry != active_files_.end());
 
-    bool success = util::platform::FileSeek(file_entry->second.fd, skip_size, util::platform::FileSeekCurrent);
+    bool success = false;
+
+    if (current_file.read_ahead != nullptr)
+    {
+        success = current_file.read_ahead->Skip(skip_size);
+    }
+    else if (file_entry->second.mapped_data != nullptr)
+    {
+        success = SeekMappedFile(&file_entry->second, skip_size, util::platform::FileSeekCurrent);
+    }
+    else
+    {
+        success = util::platform::FileSeek(file_entry->second.fd, skip_size, util::platform::FileSeekCurrent);
+    }
 
     if (success)
     {
@@ -565,7 +1158,16 @@ bool FileProcessor::SeekActiveFile(const std::string& filename, int64_t offset,
     auto file_entry = active_files_.find(file_stack_.back().filename);
     assert(file_entry != active_files_.end());
 
-    bool success = util::platform::FileSeek(file_entry->second.fd, offset, origin);
+    bool success = false;
+
+    if (file_entry->second.mapped_data != nullptr)
+    {
+        success = SeekMappedFile(&file_entry->second, offset, origin);
+    }
+    else
+    {
+        success = util::platform::FileSeek(file_entry->second.fd, offset, origin);
+    }
 
     if (success && origin == util::platform::FileSeekCurrent)
     {
@@ -576,6 +1178,34 @@ bool FileProcessor::SeekActiveFile(const std::string& filename, int64_t offset,
     return success;
 }
 
+bool FileProcessor::SeekMappedFile(ActiveFiles* active_file, int64_t offset, util::platform::FileSeekOrigin origin)
+{
+    assert((active_file != nullptr) && (active_file->mapped_data != nullptr));
+
+    int64_t base = 0;
+
+    if (origin == util::platform::FileSeekCurrent)
+    {
+        base = static_cast<int64_t>(active_file->mapped_offset);
+    }
+    else if (origin == util::platform::FileSeekEnd)
+    {
+        base = static_cast<int64_t>(active_file->mapped_size);
+    }
+
+    // Like fseek, seeking past the end of the file succeeds and clears the end of file state.
+    const int64_t position = base + offset;
+
+    if (position < 0)
+    {
+        return false;
+    }
+
+    active_file->mapped_offset = std::min(static_cast<size_t>(position), active_file->mapped_size);
+    active_file->mapped_eof    = false;
+    return true;
+}
+
 bool FileProcessor::SeekActiveFile(int64_t offset, util::platform::FileSeekOrigin origin)
 {
     return SeekActiveFile(file_stack_.back().filename, offset, origin);
@@ -612,11 +1242,16 @@ bool FileProcessor::SetActiveFile(const std::string&             filename,
 
 void FileProcessor::HandleBlockReadError(Error error_code, const char* error_message)
 {
-    auto file_entry = active_files_.find(file_stack_.back().filename);
+    const ActiveFileContext& current_file = file_stack_.back();
+
+    auto file_entry = active_files_.find(current_file.filename);
     assert(file_entry != active_files_.end());
 
+    bool is_eof = (current_file.read_ahead != nullptr) ? current_file.read_ahead->IsEof()
+                                                       : (file_entry->second.IsEof() && !ferror(file_entry->second.fd));
+
     // Report incomplete block at end of file as a warning, other I/O errors as an error.
-    if (feof(file_entry->second.fd) && !ferror(file_entry->second.fd))
+    if (is_eof)
     {
         GFXRECON_LOG_WARNING("Incomplete block at end of file");
     }
@@ -640,6 +1275,8 @@ bool FileProcessor::ProcessFunctionCall(const format::BlockHeader& block_header,
     {
         parameter_buffer_size -= sizeof(call_info.thread_id);
 
+        const uint8_t* parameter_data = nullptr;
+
         if (format::IsBlockCompressed(block_header.type))
         {
             parameter_buffer_size -= sizeof(uncompressed_size);
@@ -656,6 +1293,7 @@ bool FileProcessor::ProcessFunctionCall(const format::BlockHeader& block_header,
                 if (success)
                 {
                     assert(actual_size == uncompressed_size);
+                    parameter_data        = parameter_buffer_.data();
                     parameter_buffer_size = static_cast<size_t>(uncompressed_size);
                 }
                 else
@@ -672,7 +1310,7 @@ bool FileProcessor::ProcessFunctionCall(const format::BlockHeader& block_header,
         }
         else
         {
-            success = ReadParameterBuffer(parameter_buffer_size);
+            success = ReadParameterData(parameter_buffer_size, &parameter_data);
 
             if (!success)
             {
@@ -688,7 +1326,7 @@ bool FileProcessor::ProcessFunctionCall(const format::BlockHeader& block_header,
                 {
                     DecodeAllocator::Begin();
                     decoder->SetCurrentApiCallId(call_id);
-                    decoder->DecodeFunctionCall(call_id, call_info, parameter_buffer_.data(), parameter_buffer_size);
+                    decoder->DecodeFunctionCall(call_id, call_info, parameter_data, parameter_buffer_size);
                     DecodeAllocator::End();
                 }
             }
@@ -726,6 +1364,8 @@ bool FileProcessor::ProcessMethodCall(const format::BlockHeader& block_header,
     {
         parameter_buffer_size -= (sizeof(object_id) + sizeof(call_info.thread_id));
 
+        const uint8_t* parameter_data = nullptr;
+
         if (format::IsBlockCompressed(block_header.type))
         {
             parameter_buffer_size -= sizeof(uncompressed_size);
@@ -742,6 +1382,7 @@ bool FileProcessor::ProcessMethodCall(const format::BlockHeader& block_header,
                 if (success)
                 {
                     assert(actual_size == uncompressed_size);
+                    parameter_data        = parameter_buffer_.data();
                     parameter_buffer_size = static_cast<size_t>(uncompressed_size);
                 }
                 else
@@ -758,7 +1399,7 @@ bool FileProcessor::ProcessMethodCall(const format::BlockHeader& block_header,
         }
         else
         {
-            success = ReadParameterBuffer(parameter_buffer_size);
+            success = ReadParameterData(parameter_buffer_size, &parameter_data);
 
             if (!success)
             {
@@ -774,8 +1415,7 @@ bool FileProcessor::ProcessMethodCall(const format::BlockHeader& block_header,
                 {
                     DecodeAllocator::Begin();
                     decoder->SetCurrentApiCallId(call_id);
-                    decoder->DecodeMethodCall(
-                        call_id, object_id, call_info, parameter_buffer_.data(), parameter_buffer_size);
+                    decoder->DecodeMethodCall(call_id, object_id, call_info, parameter_data, parameter_buffer_size);
                     DecodeAllocator::End();
                 }
             }
@@ -818,19 +1458,45 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
         {
             GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.memory_size);
 
+            const uint8_t* parameter_data = nullptr;
+            size_t         data_size      = static_cast<size_t>(header.memory_size);
+
             if (format::IsBlockCompressed(block_header.type))
             {
-                size_t uncompressed_size = 0;
-                size_t compressed_size   = static_cast<size_t>(block_header.size) - sizeof(meta_data_id) -
+                size_t compressed_size = static_cast<size_t>(block_header.size) - sizeof(meta_data_id) -
                                          sizeof(header.thread_id) - sizeof(header.memory_id) -
                                          sizeof(header.memory_offset) - sizeof(header.memory_size);
 
-                success = ReadCompressedParameterBuffer(
-                    compressed_size, static_cast<size_t>(header.memory_size), &uncompressed_size);
+                // Decompressors read back previously written output, so the decoder only provides a destination when
+                // that is cheap for the target memory.
+                uint8_t* destination = GetFillMemoryCommandDestination(meta_data_id, header, true);
+
+                if (destination != nullptr)
+                {
+                    success        = ReadCompressedParameterData(compressed_size, data_size, destination);
+                    parameter_data = destination;
+                }
+                else
+                {
+                    size_t uncompressed_size = 0;
+
+                    success        = ReadCompressedParameterBuffer(compressed_size, data_size, &uncompressed_size);
+                    parameter_data = parameter_buffer_.data();
+                }
             }
             else
             {
-                success = ReadParameterBuffer(static_cast<size_t>(header.memory_size));
+                uint8_t* destination = GetFillMemoryCommandDestination(meta_data_id, header, false);
+
+                if (destination != nullptr)
+                {
+                    success        = ReadBytes(destination, data_size);
+                    parameter_data = destination;
+                }
+                else
+                {
+                    success = ReadParameterData(data_size, &parameter_data);
+                }
             }
 
             if (success)
@@ -843,7 +1509,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                                                            header.memory_id,
                                                            header.memory_offset,
                                                            header.memory_size,
-                                                           parameter_buffer_.data());
+                                                           parameter_data);
                     }
                 }
             }
@@ -865,6 +1531,73 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
             HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read fill memory meta-data block header");
         }
     }
+    else if (meta_data_type == format::MetaDataType::kFillMemoryDeltaCommand)
+    {
+        format::FillMemoryDeltaCommandHeader header;
+
+        success = ReadBytes(&header.thread_id, sizeof(header.thread_id));
+        success = success && ReadBytes(&header.memory_id, sizeof(header.memory_id));
+        success = success && ReadBytes(&header.memory_offset, sizeof(header.memory_offset));
+        success = success && ReadBytes(&header.memory_size, sizeof(header.memory_size));
+        success = success && ReadBytes(&header.data_size, sizeof(header.data_size));
+
+        if (success)
+        {
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.data_size);
+
+            const uint8_t* parameter_data = nullptr;
+            size_t         data_size      = static_cast<size_t>(header.data_size);
+
+            // The spans are applied to memory that already holds the previous data, so unlike fill memory commands
+            // they can't be read directly into the destination.
+            if (format::IsBlockCompressed(block_header.type))
+            {
+                size_t uncompressed_size = 0;
+                size_t compressed_size =
+                    static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(header));
+
+                success        = ReadCompressedParameterBuffer(compressed_size, data_size, &uncompressed_size);
+                parameter_data = parameter_buffer_.data();
+            }
+            else
+            {
+                success = ReadParameterData(data_size, &parameter_data);
+            }
+
+            if (success)
+            {
+                for (auto decoder : decoders_)
+                {
+                    if (decoder->SupportsMetaDataId(meta_data_id))
+                    {
+                        decoder->DispatchFillMemoryDeltaCommand(header.thread_id,
+                                                                header.memory_id,
+                                                                header.memory_offset,
+                                                                header.memory_size,
+                                                                header.data_size,
+                                                                parameter_data);
+                    }
+                }
+            }
+            else
+            {
+                if (format::IsBlockCompressed(block_header.type))
+                {
+                    HandleBlockReadError(kErrorReadingCompressedBlockData,
+                                         "Failed to read fill memory delta meta-data block");
+                }
+                else
+                {
+                    HandleBlockReadError(kErrorReadingBlockData, "Failed to read fill memory delta meta-data block");
+                }
+            }
+        }
+        else
+        {
+            HandleBlockReadError(kErrorReadingBlockHeader,
+                                 "Failed to read fill memory delta meta-data block header");
+        }
+    }
     else if (meta_data_type == format::MetaDataType::kFillMemoryResourceValueCommand)
     {
         format::FillMemoryResourceValueCommandHeader header;
@@ -1555,6 +2288,8 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
         {
             GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.data_size);
 
+            const uint8_t* parameter_data = nullptr;
+
             if (format::IsBlockCompressed(block_header.type))
             {
                 size_t uncompressed_size = 0;
@@ -1563,10 +2298,11 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
 
                 success = ReadCompressedParameterBuffer(
                     compressed_size, static_cast<size_t>(header.data_size), &uncompressed_size);
+                parameter_data = parameter_buffer_.data();
             }
             else
             {
-                success = ReadParameterBuffer(static_cast<size_t>(header.data_size));
+                success = ReadParameterData(static_cast<size_t>(header.data_size), &parameter_data);
             }
 
             if (success)
@@ -1579,7 +2315,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                                                            header.device_id,
                                                            header.buffer_id,
                                                            header.data_size,
-                                                           parameter_buffer_.data());
+                                                           parameter_data);
                     }
                 }
             }
@@ -1620,6 +2356,8 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
             success = success && ReadBytes(level_sizes.data(), header.level_count * sizeof(level_sizes[0]));
         }
 
+        const uint8_t* parameter_data = parameter_buffer_.data();
+
         if (success && (header.data_size > 0))
         {
             assert(header.data_size == std::accumulate(level_sizes.begin(), level_sizes.end(), 0ull));
@@ -1634,10 +2372,11 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
 
                 success = ReadCompressedParameterBuffer(
                     compressed_size, static_cast<size_t>(header.data_size), &uncompressed_size);
+                parameter_data = parameter_buffer_.data();
             }
             else
             {
-                success = ReadParameterBuffer(static_cast<size_t>(header.data_size));
+                success = ReadParameterData(static_cast<size_t>(header.data_size), &parameter_data);
             }
         }
 
@@ -1654,7 +2393,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                                                       header.aspect,
                                                       header.layout,
                                                       level_sizes,
-                                                      parameter_buffer_.data());
+                                                      parameter_data);
                 }
             }
         }
@@ -1688,6 +2427,8 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
         {
             GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.data_size);
 
+            const uint8_t* parameter_data = nullptr;
+
             if (format::IsBlockCompressed(block_header.type))
             {
                 size_t uncompressed_size = 0;
@@ -1696,10 +2437,11 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
 
                 success = ReadCompressedParameterBuffer(
                     compressed_size, static_cast<size_t>(header.data_size), &uncompressed_size);
+                parameter_data = parameter_buffer_.data();
             }
             else
             {
-                success = ReadParameterBuffer(static_cast<size_t>(header.data_size));
+                success = ReadParameterData(static_cast<size_t>(header.data_size), &parameter_data);
             }
 
             if (success)
@@ -1708,7 +2450,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                 {
                     if (decoder->SupportsMetaDataId(meta_data_id))
                     {
-                        decoder->DispatchInitSubresourceCommand(header, parameter_buffer_.data());
+                        decoder->DispatchInitSubresourceCommand(header, parameter_data);
                     }
                 }
             }
@@ -2038,6 +2780,10 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
             }
         }
     }
+    else if (meta_data_type == format::MetaDataType::kAssetDataReferenceCommand)
+    {
+        success = ProcessAssetDataReference(block_header, meta_data_id);
+    }
     else if (meta_data_type == format::MetaDataType::kExecuteBlocksFromFile)
     {
         format::ExecuteBlocksFromFile exec_from_file;
@@ -2083,6 +2829,42 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
             HandleBlockReadError(kErrorReadingBlockData, "Failed to read runtime info meta-data block");
         }
     }
+    else if (meta_data_type == format::MetaDataType::kCompressionDictionaryCommand)
+    {
+        if ((block_index_recorder_ != nullptr) && (file_stack_.size() == 1))
+        {
+            AddBlockIndexEntry(BlockIndex::kDictionary);
+        }
+
+        uint64_t dictionary_size = 0;
+        success                  = ReadBytes(&dictionary_size, sizeof(dictionary_size));
+
+        if (success)
+        {
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, dictionary_size);
+            success = ReadParameterBuffer(static_cast<size_t>(dictionary_size));
+
+            if (success)
+            {
+                if ((compressor_ == nullptr) ||
+                    !compressor_->LoadDictionary(parameter_buffer_.data(), static_cast<size_t>(dictionary_size)))
+                {
+                    GFXRECON_LOG_ERROR("Failed to load compression dictionary; compressed blocks cannot be decoded");
+                    error_state_ = kErrorUnsupportedCompressionType;
+                    success      = false;
+                }
+            }
+            else
+            {
+                HandleBlockReadError(kErrorReadingBlockData, "Failed to read compression dictionary meta-data block");
+            }
+        }
+        else
+        {
+            HandleBlockReadError(kErrorReadingBlockHeader,
+                                 "Failed to read compression dictionary meta-data block header");
+        }
+    }
     else
     {
         if ((meta_data_type == format::MetaDataType::kReserved23) ||
@@ -2104,6 +2886,111 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
     return success;
 }
 
+bool FileProcessor::ProcessAssetDataReference(const format::BlockHeader& block_header, format::MetaDataId meta_data_id)
+{
+    format::AssetDataReferenceCommandHeader reference;
+
+    bool success = ReadBytes(&reference.init_command_type, sizeof(reference.init_command_type));
+    success      = success && ReadBytes(&reference.data_block_offset, sizeof(reference.data_block_offset));
+
+    if (!success)
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read asset data reference meta-data block header");
+        return false;
+    }
+
+    // Resources initialized from shared data are dispatched to decoders as the init commands that would have stored
+    // the data.
+    const format::MetaDataType init_command_type = static_cast<format::MetaDataType>(reference.init_command_type);
+    const format::MetaDataId   init_meta_data_id =
+        format::MakeMetaDataId(format::GetMetaDataApi(meta_data_id), init_command_type);
+    const uint8_t* data = nullptr;
+
+    if (init_command_type == format::MetaDataType::kInitBufferCommand)
+    {
+        format::InitBufferCommandHeader header;
+
+        success = ReadBytes(&header.thread_id, sizeof(header.thread_id));
+        success = success && ReadBytes(&header.device_id, sizeof(header.device_id));
+        success = success && ReadBytes(&header.buffer_id, sizeof(header.buffer_id));
+        success = success && ReadBytes(&header.data_size, sizeof(header.data_size));
+
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.data_size);
+
+        success =
+            success && ReadAssetData(reference.data_block_offset, static_cast<size_t>(header.data_size), &data);
+
+        if (success)
+        {
+            for (auto decoder : decoders_)
+            {
+                if (decoder->SupportsMetaDataId(init_meta_data_id))
+                {
+                    decoder->DispatchInitBufferCommand(
+                        header.thread_id, header.device_id, header.buffer_id, header.data_size, data);
+                }
+            }
+        }
+    }
+    else if (init_command_type == format::MetaDataType::kInitImageCommand)
+    {
+        format::InitImageCommandHeader header;
+        std::vector<uint64_t>          level_sizes;
+
+        success = ReadBytes(&header.thread_id, sizeof(header.thread_id));
+        success = success && ReadBytes(&header.device_id, sizeof(header.device_id));
+        success = success && ReadBytes(&header.image_id, sizeof(header.image_id));
+        success = success && ReadBytes(&header.data_size, sizeof(header.data_size));
+        success = success && ReadBytes(&header.aspect, sizeof(header.aspect));
+        success = success && ReadBytes(&header.layout, sizeof(header.layout));
+        success = success && ReadBytes(&header.level_count, sizeof(header.level_count));
+
+        if (success && (header.level_count > 0))
+        {
+            level_sizes.resize(header.level_count);
+            success = success && ReadBytes(level_sizes.data(), header.level_count * sizeof(level_sizes[0]));
+        }
+
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.data_size);
+
+        success =
+            success && ReadAssetData(reference.data_block_offset, static_cast<size_t>(header.data_size), &data);
+
+        if (success)
+        {
+            for (auto decoder : decoders_)
+            {
+                if (decoder->SupportsMetaDataId(init_meta_data_id))
+                {
+                    decoder->DispatchInitImageCommand(header.thread_id,
+                                                      header.device_id,
+                                                      header.image_id,
+                                                      header.data_size,
+                                                      header.aspect,
+                                                      header.layout,
+                                                      level_sizes,
+                                                      data);
+                }
+            }
+        }
+    }
+    else
+    {
+        GFXRECON_LOG_WARNING("Skipping asset data reference with unrecognized init command type %u",
+                             reference.init_command_type);
+
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+        success = SkipBytes(static_cast<size_t>(block_header.size) - format::GetMetaDataBlockBaseSize(reference));
+    }
+
+    if (!success)
+    {
+        HandleBlockReadError(kErrorReadingBlockData, "Failed to read asset data reference meta-data block");
+    }
+
+    return success;
+}
+
 bool FileProcessor::ProcessFrameMarker(const format::BlockHeader& block_header,
                                        format::MarkerType         marker_type,
                                        bool&                      should_break)
@@ -2164,6 +3051,13 @@ bool FileProcessor::ProcessStateMarker(const format::BlockHeader& block_header,
 
     if (success)
     {
+        if ((block_index_recorder_ != nullptr) && (file_stack_.size() == 1) &&
+            ((marker_type == format::kBeginMarker) || (marker_type == format::kEndMarker)))
+        {
+            AddBlockIndexEntry((marker_type == format::kBeginMarker) ? BlockIndex::kStateBeginMarker
+                                                                     : BlockIndex::kStateEndMarker);
+        }
+
         if (marker_type == format::kBeginMarker)
         {
             GFXRECON_LOG_INFO("Loading state for captured frame %" PRId64, frame_number);
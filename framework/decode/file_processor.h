@@ -28,6 +28,8 @@
 #include "format/format.h"
 #include "decode/annotation_handler.h"
 #include "decode/api_decoder.h"
+#include "decode/block_index.h"
+#include "decode/file_read_ahead.h"
 #include "util/compressor.h"
 #include "util/defines.h"
 
@@ -35,6 +37,8 @@
 #include <cstdint>
 #include <cstdio>
 #include <deque>
+#include <limits>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -57,7 +61,8 @@ class FileProcessor
         kErrorReadingBlockData             = -7,
         kErrorReadingCompressedBlockData   = -8,
         kErrorInvalidFourCC                = -9,
-        kErrorUnsupportedCompressionType   = -10
+        kErrorUnsupportedCompressionType   = -10,
+        kErrorPreloadedFramesNotRepeatable = -11
     };
 
     enum BlockProcessReturn : int32_t
@@ -85,6 +90,20 @@ class FileProcessor
         decoders_.erase(std::remove(decoders_.begin(), decoders_.end(), decoder), decoders_.end());
     }
 
+    // Read files through a read-only memory mapping instead of stdio, so that uncompressed block data can be decoded
+    // directly from the mapping. Enabled by default; files that cannot be mapped are read with stdio. Must be set
+    // before Initialize.
+    void SetUseFileMapping(bool use_file_mapping) { use_file_mapping_ = use_file_mapping; }
+
+    // Read and decompress the blocks of the capture file on a background thread, which stays up to buffer_count
+    // buffers of blocks ahead of decoding. Blocks from files referenced by ExecuteBlocksFromFile commands are read on
+    // the decode thread. Disabled when the count is zero, which is the default. Must be set before Initialize.
+    void SetReadAheadBufferCount(size_t buffer_count) { read_ahead_buffer_count_ = buffer_count; }
+
+    // Record the positions of frames, state markers, and regular block intervals of the capture file to the specified
+    // index while the file is processed. Positions are not recorded while the file is read ahead of decoding.
+    void SetBlockIndexRecorder(BlockIndex* index) { block_index_recorder_ = index; }
+
     bool Initialize(const std::string& filename);
 
     // Returns true if there are more frames to process, false if all frames have been processed or an error has
@@ -98,16 +117,29 @@ class FileProcessor
 
     uint32_t GetCurrentFrameNumber() const { return current_frame_number_; }
 
+    uint64_t GetCurrentBlockIndex() const { return block_index_; }
+
     uint64_t GetNumBytesRead() const { return bytes_read_; }
 
     Error GetErrorState() const { return error_state_; }
 
     bool EntireFileWasProcessed() const
     {
+        if (file_stack_.empty())
+        {
+            // The capture file is only removed from the stack after all of its blocks have been read.
+            return true;
+        }
+
+        if (file_stack_.front().read_ahead != nullptr)
+        {
+            return file_stack_.front().read_ahead->IsEof();
+        }
+
         const auto file_entry = active_files_.find(file_stack_.front().filename);
         if (file_entry != active_files_.end())
         {
-            return (feof(file_entry->second.fd) != 0);
+            return file_entry->second.IsEof();
         }
         else
         {
@@ -117,6 +149,11 @@ class FileProcessor
 
     bool UsesFrameMarkers() const { return capture_uses_frame_markers_; }
 
+    // Use an index of the capture file to continue processing from the specified block. The blocks that are skipped are
+    // not decoded, so seeking is only suitable for tools that do not depend on the state created by earlier blocks.
+    // Returns false if the index does not contain the block, or the seek failed.
+    bool SeekToBlock(const BlockIndex& index, uint64_t block_index);
+
     void SetPrintBlockInfoFlag(bool enable_print_block_info, int64_t block_index_from, int64_t block_index_to)
     {
         enable_print_block_info_ = enable_print_block_info;
@@ -131,6 +168,14 @@ class FileProcessor
 
     virtual bool ReadBytes(void* buffer, size_t buffer_size);
 
+    // Read from the active file's current compressed chunk when one is being expanded, or from the active file.
+    bool ReadFileBytes(void* buffer, size_t buffer_size);
+
+    // Return a pointer to the next buffer_size bytes and advance past them when the data can be accessed without a
+    // copy, such as from a memory mapped file or a decompressed chunk. Returns nullptr when the data must be read with
+    // ReadBytes instead, in which case nothing has been consumed.
+    virtual const uint8_t* ReadBytesInPlace(size_t buffer_size);
+
     bool SkipBytes(size_t skip_size);
 
     bool ProcessFunctionCall(const format::BlockHeader& block_header, format::ApiCallId call_id, bool& should_break);
@@ -165,6 +210,22 @@ class FileProcessor
     uint64_t block_index_;
 
   protected:
+    // Returns true if a read from the active file has failed because it reached the end of the file.
+    bool IsActiveFileEof() const
+    {
+        assert(!file_stack_.empty());
+
+        if (file_stack_.back().read_ahead != nullptr)
+        {
+            return file_stack_.back().read_ahead->IsEof();
+        }
+
+        auto file_entry = active_files_.find(file_stack_.back().filename);
+        assert(file_entry != active_files_.end());
+
+        return file_entry->second.IsEof();
+    }
+
     FILE* GetFileDescriptor()
     {
         assert(!file_stack_.empty());
@@ -189,18 +250,50 @@ class FileProcessor
 
     bool ReadParameterBuffer(size_t buffer_size);
 
+    // Read buffer_size bytes of uncompressed block data, which is accessed in place when possible and is otherwise
+    // copied to parameter_buffer_.
+    bool ReadParameterData(size_t buffer_size, const uint8_t** parameter_data);
+
     bool ReadCompressedParameterBuffer(size_t  compressed_buffer_size,
                                        size_t  expected_uncompressed_size,
                                        size_t* uncompressed_buffer_size);
 
+    // Read compressed block data and decompress it into uncompressed_data, which must be able to hold
+    // expected_uncompressed_size bytes.
+    bool ReadCompressedParameterData(size_t   compressed_buffer_size,
+                                     size_t   expected_uncompressed_size,
+                                     uint8_t* uncompressed_data);
+
+    // Returns the location that a fill memory command's data can be read into directly, or nullptr when the data must
+    // be staged in parameter_buffer_, which is always the case when more than one decoder handles the command.
+    uint8_t* GetFillMemoryCommandDestination(format::MetaDataId                     meta_data_id,
+                                             const format::FillMemoryCommandHeader& header,
+                                             bool                                   needs_read_access);
+
+    // Decompress the chunk that follows a compressed chunk block header, so that the blocks it contains are read from
+    // the chunk until it has been consumed.
+    bool ReadCompressedChunk(const format::BlockHeader& block_header);
+
+    // Read the uncompressed resource data of the init buffer or init image block at data_block_offset in the active
+    // file, which is shared by the resources of kAssetDataReferenceCommand blocks. The data remains valid until the
+    // next call.
+    bool ReadAssetData(int64_t data_block_offset, size_t data_size, const uint8_t** data);
+
+    bool ProcessAssetDataReference(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
+
     bool IsFileValid() const
     {
         if (!file_stack_.empty())
         {
+            if (file_stack_.back().read_ahead != nullptr)
+            {
+                return (!file_stack_.back().read_ahead->IsEof() && !file_stack_.back().read_ahead->HasError());
+            }
+
             auto file_entry = active_files_.find(file_stack_.back().filename);
             assert(file_entry != active_files_.end());
 
-            return (file_entry->second.fd && !feof(file_entry->second.fd) && !ferror(file_entry->second.fd));
+            return (file_entry->second.fd && !file_entry->second.IsEof() && !ferror(file_entry->second.fd));
         }
         else
         {
@@ -210,6 +303,25 @@ class FileProcessor
 
     bool OpenFile(const std::string& filename);
 
+    // Start reading the active file on a background thread from its current position.
+    void StartReadAhead();
+
+    // Returns the position of the active file, ignoring any data buffered from a compressed chunk or by read-ahead.
+    int64_t GetActiveFilePosition() const;
+
+    // Called before and after each block header is read from the capture file, to record the position that decoding
+    // can be resumed from and the index entries for the block.
+    void UpdateBlockIndexPosition();
+
+    void RecordBlockIndexEntries();
+
+    void AddBlockIndexEntry(BlockIndex::EntryType type);
+
+    bool SeekToIndexEntry(const BlockIndex::Entry& entry, uint64_t block_index);
+
+    // Process the indexed compression dictionary block, if the capture file has one before the block being sought.
+    bool LoadIndexedDictionary(const BlockIndex& index, uint64_t block_index);
+
     bool SeekActiveFile(const std::string& filename, int64_t offset, util::platform::FileSeekOrigin origin);
 
     bool SeekActiveFile(int64_t offset, util::platform::FileSeekOrigin origin);
@@ -238,6 +350,13 @@ class FileProcessor
     bool                                enable_print_block_info_{ false };
     int64_t                             block_index_from_{ 0 };
     int64_t                             block_index_to_{ 0 };
+    bool                                use_file_mapping_{ true };
+    size_t                              read_ahead_buffer_count_{ 0 };
+    BlockIndex*                         block_index_recorder_{ nullptr };
+    uint64_t                            index_seek_offset_{ 0 };
+    uint64_t                            index_seek_block_index_{ 0 };
+    uint64_t                            index_next_seek_point_{ 0 };
+    uint64_t                            index_frame_number_{ std::numeric_limits<uint64_t>::max() };
 
     struct ActiveFiles
     {
@@ -245,7 +364,15 @@ class FileProcessor
 
         ActiveFiles(FILE* fd) : fd(fd) {}
 
+        bool IsEof() const { return (mapped_data != nullptr) ? mapped_eof : (feof(fd) != 0); }
+
         FILE* fd{ nullptr };
+
+        // When the file is mapped, reads are served from the mapping and fd is only used to keep the file open.
+        const uint8_t* mapped_data{ nullptr };
+        size_t         mapped_size{ 0 };
+        size_t         mapped_offset{ 0 };
+        bool           mapped_eof{ false };
     };
 
     std::unordered_map<std::string, ActiveFiles> active_files_;
@@ -259,12 +386,28 @@ class FileProcessor
         std::string filename;
         uint32_t    remaining_commands{ 0 };
         bool        execute_till_eof{ false };
+
+        // Decompressed blocks from the file's current compressed chunk, and the read position within them.
+        std::vector<uint8_t> chunk_data;
+        size_t               chunk_offset{ 0 };
+
+        // When set, all reads from the file are served by the read-ahead thread.
+        std::unique_ptr<FileReadAhead> read_ahead;
     };
     std::deque<ActiveFileContext> file_stack_;
 
     std::string absolute_path_;
 
+    // Resource data read for kAssetDataReferenceCommand blocks, indexed by the offset of the block storing the data.
+    // The data is read with a separate file descriptor, leaving the position of the active file unchanged.
+    std::string                                       asset_data_filename_;
+    FILE*                                             asset_data_fd_{ nullptr };
+    std::unordered_map<int64_t, std::vector<uint8_t>> asset_data_cache_;
+    size_t                                            asset_data_cache_size_{ 0 };
+
   private:
+    bool SeekMappedFile(ActiveFiles* active_file, int64_t offset, util::platform::FileSeekOrigin origin);
+
     ActiveFileContext& GetCurrentFile()
     {
         assert(file_stack_.size());
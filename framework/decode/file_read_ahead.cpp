@@ -0,0 +1,636 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/file_read_ahead.h"
+
+#include "format/format_util.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// The decode thread holds one buffer while the reader thread fills another.
+const size_t kMinBufferCount = 2;
+
+FileReadAhead::FileReadAhead(size_t buffer_count) : buffers_(std::max(buffer_count, kMinBufferCount))
+{
+    free_buffers_.reserve(buffers_.size());
+
+    for (auto& buffer : buffers_)
+    {
+        free_buffers_.push_back(&buffer);
+    }
+}
+
+FileReadAhead::~FileReadAhead()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+
+    free_condition_.notify_one();
+
+    if (reader_thread_.joinable())
+    {
+        reader_thread_.join();
+    }
+
+    if (fd_ != nullptr)
+    {
+        util::platform::FileClose(fd_);
+    }
+}
+
+bool FileReadAhead::Start(const std::string& filename, int64_t offset, format::CompressionType compression_type)
+{
+    assert(!reader_thread_.joinable());
+
+    if (compression_type != format::CompressionType::kNone)
+    {
+        compressor_.reset(format::CreateCompressor(compression_type));
+
+        if (compressor_ == nullptr)
+        {
+            return false;
+        }
+    }
+
+    int32_t result = util::platform::FileOpen(&fd_, filename.c_str(), "rb");
+
+    if ((result != 0) || (fd_ == nullptr))
+    {
+        fd_ = nullptr;
+        return false;
+    }
+
+    util::platform::SetFileBufferSize(fd_, kFileBufferSize);
+
+    if (!util::platform::FileSeek(fd_, offset, util::platform::FileSeekSet))
+    {
+        return false;
+    }
+
+    reader_thread_ = std::thread(&FileReadAhead::ReaderThreadMain, this);
+
+    return true;
+}
+
+bool FileReadAhead::Read(void* buffer, size_t buffer_size)
+{
+    uint8_t* destination = reinterpret_cast<uint8_t*>(buffer);
+
+    while (buffer_size > 0)
+    {
+        if ((read_buffer_ == nullptr) || (read_offset_ == read_buffer_->size))
+        {
+            if (!AcquireReadBuffer())
+            {
+                return false;
+            }
+        }
+        else
+        {
+            size_t copy_size = std::min(buffer_size, read_buffer_->size - read_offset_);
+
+            util::platform::MemoryCopy(destination, copy_size, read_buffer_->data.data() + read_offset_, copy_size);
+
+            destination += copy_size;
+            buffer_size -= copy_size;
+            read_offset_ += copy_size;
+        }
+    }
+
+    return true;
+}
+
+const uint8_t* FileReadAhead::ReadInPlace(size_t buffer_size)
+{
+    if ((read_buffer_ == nullptr) || (read_offset_ == read_buffer_->size))
+    {
+        if (!AcquireReadBuffer())
+        {
+            return nullptr;
+        }
+    }
+
+    if (buffer_size > (read_buffer_->size - read_offset_))
+    {
+        return nullptr;
+    }
+
+    const uint8_t* data = read_buffer_->data.data() + read_offset_;
+    read_offset_ += buffer_size;
+
+    return data;
+}
+
+bool FileReadAhead::Skip(size_t skip_size)
+{
+    while (skip_size > 0)
+    {
+        if ((read_buffer_ == nullptr) || (read_offset_ == read_buffer_->size))
+        {
+            if (!AcquireReadBuffer())
+            {
+                return false;
+            }
+        }
+        else
+        {
+            size_t buffer_skip_size = std::min(skip_size, read_buffer_->size - read_offset_);
+
+            skip_size -= buffer_skip_size;
+            read_offset_ += buffer_skip_size;
+        }
+    }
+
+    return true;
+}
+
+bool FileReadAhead::AcquireReadBuffer()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    if (read_buffer_ != nullptr)
+    {
+        read_buffer_->size = 0;
+        free_buffers_.push_back(read_buffer_);
+        read_buffer_ = nullptr;
+
+        free_condition_.notify_one();
+    }
+
+    if (filled_buffers_.empty() && !reader_done_)
+    {
+        // Ask the reader thread to hand over the blocks it has read instead of waiting to fill a buffer.
+        reader_waited_on_ = true;
+        filled_condition_.wait(lock, [this]() { return !filled_buffers_.empty() || reader_done_; });
+        reader_waited_on_ = false;
+    }
+
+    if (filled_buffers_.empty())
+    {
+        // The reader thread has stopped and all of the blocks that it read have been consumed.
+        eof_   = !reader_error_;
+        error_ = reader_error_;
+        return false;
+    }
+
+    read_buffer_ = filled_buffers_.front();
+    read_offset_ = 0;
+    filled_buffers_.pop_front();
+
+    return true;
+}
+
+void FileReadAhead::ReaderThreadMain()
+{
+    while (ReadBlock())
+    {
+    }
+
+    if ((write_buffer_ != nullptr) && (write_buffer_->size > 0))
+    {
+        PublishWriteBuffer();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (write_buffer_ != nullptr)
+        {
+            free_buffers_.push_back(write_buffer_);
+            write_buffer_ = nullptr;
+        }
+
+        reader_done_  = true;
+        reader_error_ = read_failed_;
+    }
+
+    filled_condition_.notify_one();
+}
+
+bool FileReadAhead::ReadBlock()
+{
+    format::BlockHeader block_header;
+
+    if (!util::platform::FileReadNoLock(&block_header, sizeof(block_header), fd_))
+    {
+        read_failed_ = (ferror(fd_) != 0);
+        return false;
+    }
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+
+    size_t   body_size  = static_cast<size_t>(block_header.size);
+    uint8_t* block_body = nullptr;
+
+    if (format::IsBlockCompressed(block_header.type))
+    {
+        if (block_data_.size() < body_size)
+        {
+            block_data_.resize(body_size);
+        }
+
+        block_body = block_data_.data();
+    }
+    else
+    {
+        // Uncompressed blocks are read directly into the buffer that is passed to the decode thread.
+        uint8_t* block_data = ReserveBlock(sizeof(block_header) + body_size);
+
+        if (block_data == nullptr)
+        {
+            return false;
+        }
+
+        util::platform::MemoryCopy(block_data, sizeof(block_header), &block_header, sizeof(block_header));
+        block_body = block_data + sizeof(block_header);
+    }
+
+    if (!util::platform::FileReadNoLock(block_body, body_size, fd_))
+    {
+        read_failed_ = (ferror(fd_) != 0);
+
+        // Pass the header of an incomplete block at the end of the file to the decode thread, which reports the
+        // incomplete block when it fails to read the block data.
+        uint8_t* block_data = ReserveBlock(sizeof(block_header));
+
+        if (block_data != nullptr)
+        {
+            util::platform::MemoryCopy(block_data, sizeof(block_header), &block_header, sizeof(block_header));
+            CommitBlock(sizeof(block_header));
+        }
+
+        return false;
+    }
+
+    if (block_header.type == format::BlockType::kCompressedChunkBlock)
+    {
+        return ExpandChunk(block_header);
+    }
+    else if (format::IsBlockCompressed(block_header.type))
+    {
+        return AddBlock(block_header, block_body);
+    }
+
+    if (block_header.type == format::BlockType::kMetaDataBlock)
+    {
+        LoadDictionary(block_header, block_body);
+    }
+
+    CommitBlock(sizeof(block_header) + body_size);
+
+    return true;
+}
+
+bool FileReadAhead::AddBlock(const format::BlockHeader& block_header, const uint8_t* block_body)
+{
+    const size_t body_size = static_cast<size_t>(block_header.size);
+
+    if (block_header.type == format::BlockType::kCompressedFunctionCallBlock)
+    {
+        const size_t fixed_size        = sizeof(format::FunctionCallHeader) - sizeof(format::BlockHeader);
+        const size_t payload_offset    = sizeof(format::CompressedFunctionCallHeader) - sizeof(format::BlockHeader);
+        uint64_t     uncompressed_size = 0;
+
+        if (body_size >= payload_offset)
+        {
+            util::platform::MemoryCopy(
+                &uncompressed_size, sizeof(uncompressed_size), block_body + fixed_size, sizeof(uncompressed_size));
+        }
+
+        return AddDecompressedBlock(block_header,
+                                    format::BlockType::kFunctionCallBlock,
+                                    block_body,
+                                    fixed_size,
+                                    payload_offset,
+                                    uncompressed_size);
+    }
+    else if (block_header.type == format::BlockType::kCompressedMethodCallBlock)
+    {
+        const size_t fixed_size        = sizeof(format::MethodCallHeader) - sizeof(format::BlockHeader);
+        const size_t payload_offset    = sizeof(format::CompressedMethodCallHeader) - sizeof(format::BlockHeader);
+        uint64_t     uncompressed_size = 0;
+
+        if (body_size >= payload_offset)
+        {
+            util::platform::MemoryCopy(
+                &uncompressed_size, sizeof(uncompressed_size), block_body + fixed_size, sizeof(uncompressed_size));
+        }
+
+        return AddDecompressedBlock(block_header,
+                                    format::BlockType::kMethodCallBlock,
+                                    block_body,
+                                    fixed_size,
+                                    payload_offset,
+                                    uncompressed_size);
+    }
+    else if ((block_header.type == format::BlockType::kCompressedMetaDataBlock) &&
+             (body_size >= (sizeof(format::FillMemoryCommandHeader) - sizeof(format::BlockHeader))))
+    {
+        format::MetaDataId meta_data_id = 0;
+        util::platform::MemoryCopy(&meta_data_id, sizeof(meta_data_id), block_body, sizeof(meta_data_id));
+
+        format::MetaDataType meta_data_type = format::GetMetaDataType(meta_data_id);
+        size_t               fixed_size     = 0;
+
+        if (meta_data_type == format::MetaDataType::kFillMemoryCommand)
+        {
+            fixed_size = sizeof(format::FillMemoryCommandHeader) - sizeof(format::BlockHeader);
+        }
+        else if ((meta_data_type == format::MetaDataType::kFillMemoryDeltaCommand) &&
+                 (body_size >= (sizeof(format::FillMemoryDeltaCommandHeader) - sizeof(format::BlockHeader))))
+        {
+            fixed_size = sizeof(format::FillMemoryDeltaCommandHeader) - sizeof(format::BlockHeader);
+        }
+
+        if (fixed_size > 0)
+        {
+            uint64_t uncompressed_size = 0;
+
+            // The uncompressed size is the last field of both fill memory headers.
+            util::platform::MemoryCopy(&uncompressed_size,
+                                       sizeof(uncompressed_size),
+                                       block_body + fixed_size - sizeof(uncompressed_size),
+                                       sizeof(uncompressed_size));
+
+            return AddDecompressedBlock(
+                block_header, format::BlockType::kMetaDataBlock, block_body, fixed_size, fixed_size, uncompressed_size);
+        }
+    }
+
+    // Other blocks are passed to the decode thread unchanged.
+    const size_t block_size = sizeof(block_header) + body_size;
+    uint8_t*     block_data = ReserveBlock(block_size);
+
+    if (block_data == nullptr)
+    {
+        return false;
+    }
+
+    util::platform::MemoryCopy(block_data, sizeof(block_header), &block_header, sizeof(block_header));
+    util::platform::MemoryCopy(block_data + sizeof(block_header), body_size, block_body, body_size);
+
+    if (block_header.type == format::BlockType::kMetaDataBlock)
+    {
+        LoadDictionary(block_header, block_body);
+    }
+
+    CommitBlock(block_size);
+
+    return true;
+}
+
+bool FileReadAhead::AddDecompressedBlock(const format::BlockHeader& block_header,
+                                         format::BlockType          uncompressed_type,
+                                         const uint8_t*             block_body,
+                                         size_t                     fixed_size,
+                                         size_t                     payload_offset,
+                                         uint64_t                   uncompressed_size)
+{
+    const size_t body_size = static_cast<size_t>(block_header.size);
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, uncompressed_size);
+
+    bool success = (compressor_ != nullptr) && (body_size >= payload_offset);
+
+    if (success)
+    {
+        size_t compressed_size = body_size - payload_offset;
+
+        compressed_data_.assign(block_body + payload_offset, block_body + body_size);
+
+        if (uncompressed_data_.size() < uncompressed_size)
+        {
+            uncompressed_data_.resize(static_cast<size_t>(uncompressed_size));
+        }
+
+        success = (compressor_->Decompress(compressed_size,
+                                           compressed_data_,
+                                           static_cast<size_t>(uncompressed_size),
+                                           &uncompressed_data_) == uncompressed_size);
+    }
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Failed to decompress block data read ahead of decoding (block type %u)",
+                           block_header.type);
+        read_failed_ = true;
+        return false;
+    }
+
+    format::BlockHeader uncompressed_header;
+    uncompressed_header.size = fixed_size + uncompressed_size;
+    uncompressed_header.type = uncompressed_type;
+
+    const size_t block_size = sizeof(uncompressed_header) + static_cast<size_t>(uncompressed_header.size);
+    uint8_t*     block_data = ReserveBlock(block_size);
+
+    if (block_data == nullptr)
+    {
+        return false;
+    }
+
+    util::platform::MemoryCopy(
+        block_data, sizeof(uncompressed_header), &uncompressed_header, sizeof(uncompressed_header));
+    block_data += sizeof(uncompressed_header);
+
+    util::platform::MemoryCopy(block_data, fixed_size, block_body, fixed_size);
+    block_data += fixed_size;
+
+    util::platform::MemoryCopy(block_data,
+                               static_cast<size_t>(uncompressed_size),
+                               uncompressed_data_.data(),
+                               static_cast<size_t>(uncompressed_size));
+
+    CommitBlock(block_size);
+
+    return true;
+}
+
+bool FileReadAhead::ExpandChunk(const format::BlockHeader& block_header)
+{
+    const size_t body_size   = static_cast<size_t>(block_header.size);
+    const size_t header_size = sizeof(format::CompressedChunkHeader) - sizeof(format::BlockHeader);
+    uint64_t     uncompressed_size = 0;
+    bool         success           = (compressor_ != nullptr) && (body_size >= header_size);
+
+    if (success)
+    {
+        util::platform::MemoryCopy(
+            &uncompressed_size, sizeof(uncompressed_size), block_data_.data(), sizeof(uncompressed_size));
+
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, uncompressed_size);
+
+        size_t compressed_size = body_size - header_size;
+
+        compressed_data_.assign(block_data_.begin() + header_size, block_data_.begin() + body_size);
+
+        if (chunk_data_.size() < uncompressed_size)
+        {
+            chunk_data_.resize(static_cast<size_t>(uncompressed_size));
+        }
+
+        success = (compressor_->Decompress(
+                       compressed_size, compressed_data_, static_cast<size_t>(uncompressed_size), &chunk_data_) ==
+                   uncompressed_size);
+    }
+
+    // Pass each of the complete blocks stored in the chunk to the decode thread.
+    size_t chunk_size = static_cast<size_t>(uncompressed_size);
+    size_t offset     = 0;
+
+    while (success && (offset < chunk_size))
+    {
+        format::BlockHeader chunk_block_header;
+
+        success = (chunk_size - offset) >= sizeof(chunk_block_header);
+
+        if (success)
+        {
+            util::platform::MemoryCopy(&chunk_block_header,
+                                       sizeof(chunk_block_header),
+                                       chunk_data_.data() + offset,
+                                       sizeof(chunk_block_header));
+            offset += sizeof(chunk_block_header);
+
+            success = chunk_block_header.size <= (chunk_size - offset);
+
+            if (success)
+            {
+                if (!AddBlock(chunk_block_header, chunk_data_.data() + offset))
+                {
+                    // Errors have been reported by AddBlock, or the reader thread is stopping.
+                    return false;
+                }
+
+                offset += static_cast<size_t>(chunk_block_header.size);
+            }
+        }
+    }
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Failed to expand compressed chunk read ahead of decoding");
+        read_failed_ = true;
+    }
+
+    return success;
+}
+
+void FileReadAhead::LoadDictionary(const format::BlockHeader& block_header, const uint8_t* block_body)
+{
+    const size_t body_size   = static_cast<size_t>(block_header.size);
+    const size_t header_size = sizeof(format::CompressionDictionaryCommandHeader) - sizeof(format::BlockHeader);
+
+    if ((compressor_ != nullptr) && (body_size >= header_size))
+    {
+        format::MetaDataId meta_data_id = 0;
+        util::platform::MemoryCopy(&meta_data_id, sizeof(meta_data_id), block_body, sizeof(meta_data_id));
+
+        if (format::GetMetaDataType(meta_data_id) == format::MetaDataType::kCompressionDictionaryCommand)
+        {
+            uint64_t dictionary_size = 0;
+            util::platform::MemoryCopy(
+                &dictionary_size, sizeof(dictionary_size), block_body + sizeof(meta_data_id), sizeof(dictionary_size));
+
+            // Failures are reported by the decode thread, which loads the same dictionary.
+            if (dictionary_size <= (body_size - header_size))
+            {
+                compressor_->LoadDictionary(block_body + header_size, static_cast<size_t>(dictionary_size));
+            }
+        }
+    }
+}
+
+uint8_t* FileReadAhead::ReserveBlock(size_t block_size)
+{
+    if ((write_buffer_ != nullptr) && (write_buffer_->size > 0) && ((write_buffer_->size + block_size) > kBufferSize))
+    {
+        PublishWriteBuffer();
+    }
+
+    if (write_buffer_ == nullptr)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        free_condition_.wait(lock, [this]() { return !free_buffers_.empty() || stop_; });
+
+        if (stop_)
+        {
+            return nullptr;
+        }
+
+        write_buffer_ = free_buffers_.back();
+        free_buffers_.pop_back();
+        lock.unlock();
+
+        if (write_buffer_->data.size() > kMaxRetainedBufferSize)
+        {
+            std::vector<uint8_t>().swap(write_buffer_->data);
+        }
+
+        write_buffer_->size = 0;
+    }
+
+    const size_t required_size = write_buffer_->size + block_size;
+
+    if (write_buffer_->data.size() < required_size)
+    {
+        write_buffer_->data.resize((required_size > kBufferSize) ? required_size : kBufferSize);
+    }
+
+    return write_buffer_->data.data() + write_buffer_->size;
+}
+
+void FileReadAhead::CommitBlock(size_t block_size)
+{
+    assert(write_buffer_ != nullptr);
+
+    write_buffer_->size += block_size;
+
+    if ((write_buffer_->size >= kBufferSize) || reader_waited_on_)
+    {
+        PublishWriteBuffer();
+    }
+}
+
+void FileReadAhead::PublishWriteBuffer()
+{
+    assert(write_buffer_ != nullptr);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        filled_buffers_.push_back(write_buffer_);
+        write_buffer_ = nullptr;
+    }
+
+    filled_condition_.notify_one();
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,148 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_FILE_READ_AHEAD_H
+#define GFXRECON_DECODE_FILE_READ_AHEAD_H
+
+#include "format/format.h"
+#include "util/compressor.h"
+#include "util/defines.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Reads the blocks of a capture file on a background thread, ahead of the thread that decodes them. Compressed chunks
+// are expanded and compressed function call, method call, and fill memory blocks are decompressed by the reader
+// thread, which stores them as the equivalent uncompressed blocks. Blocks are passed to the decode thread through a
+// bounded ring of reusable buffers, so the reader thread waits when the decode thread falls behind.
+class FileReadAhead
+{
+  public:
+    FileReadAhead(size_t buffer_count);
+
+    ~FileReadAhead();
+
+    // Starts reading blocks from the specified offset of the file, which must be the start of a block.
+    bool Start(const std::string& filename, int64_t offset, format::CompressionType compression_type);
+
+    // Waits for the reader thread when it has not yet read the requested data.
+    bool Read(void* buffer, size_t buffer_size);
+
+    // Returns a pointer to the next buffer_size bytes and advances past them, or nullptr if the data is not available
+    // from a single buffer. The data remains valid until data from the next buffer is read.
+    const uint8_t* ReadInPlace(size_t buffer_size);
+
+    bool Skip(size_t skip_size);
+
+    // Returns true if a read failed because all of the blocks in the file have been consumed.
+    bool IsEof() const { return eof_; }
+
+    // Returns true if a read failed because the reader thread could not read or decompress a block.
+    bool HasError() const { return error_; }
+
+  private:
+    struct Buffer
+    {
+        std::vector<uint8_t> data;
+        size_t               size{ 0 };
+    };
+
+    // Decode thread.
+    bool AcquireReadBuffer();
+
+    // Reader thread.
+    void ReaderThreadMain();
+
+    bool ReadBlock();
+
+    bool AddBlock(const format::BlockHeader& block_header, const uint8_t* block_body);
+
+    bool AddDecompressedBlock(const format::BlockHeader& block_header,
+                              format::BlockType          uncompressed_type,
+                              const uint8_t*             block_body,
+                              size_t                     fixed_size,
+                              size_t                     payload_offset,
+                              uint64_t                   uncompressed_size);
+
+    bool ExpandChunk(const format::BlockHeader& block_header);
+
+    void LoadDictionary(const format::BlockHeader& block_header, const uint8_t* block_body);
+
+    uint8_t* ReserveBlock(size_t block_size);
+
+    void CommitBlock(size_t block_size);
+
+    void PublishWriteBuffer();
+
+  private:
+    // Blocks are added to a buffer until it reaches this size, unless the decode thread is waiting for data.
+    static const size_t kBufferSize = 1024 * 1024;
+
+    // Buffers that grew to hold a large block are released when they are reused, to bound memory use.
+    static const size_t kMaxRetainedBufferSize = 16 * kBufferSize;
+
+    static const size_t kFileBufferSize = 1024 * 1024;
+
+    std::vector<Buffer>     buffers_;
+    std::deque<Buffer*>     filled_buffers_;
+    std::vector<Buffer*>    free_buffers_;
+    std::mutex              mutex_;
+    std::condition_variable filled_condition_;
+    std::condition_variable free_condition_;
+    std::thread             reader_thread_;
+    std::atomic<bool>       reader_waited_on_{ false };
+    bool                    reader_done_{ false };
+    bool                    reader_error_{ false };
+    bool                    stop_{ false };
+
+    // Decode thread state.
+    Buffer* read_buffer_{ nullptr };
+    size_t  read_offset_{ 0 };
+    bool    eof_{ false };
+    bool    error_{ false };
+
+    // Reader thread state.
+    FILE*                             fd_{ nullptr };
+    std::unique_ptr<util::Compressor> compressor_;
+    Buffer*                           write_buffer_{ nullptr };
+    std::vector<uint8_t>              block_data_;
+    std::vector<uint8_t>              compressed_data_;
+    std::vector<uint8_t>              uncompressed_data_;
+    std::vector<uint8_t>              chunk_data_;
+    bool                              read_failed_{ false };
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_FILE_READ_AHEAD_H
@@ -63,9 +63,12 @@ bool FileTransformer::Initialize(const std::string& input_filename,
 
     if ((result == 0) && (input_file_ != nullptr))
     {
-        result = util::platform::FileOpen(&output_file_, output_filename.c_str(), "wb");
+        if (!output_filename.empty())
+        {
+            result = util::platform::FileOpen(&output_file_, output_filename.c_str(), "wb");
+        }
 
-        if ((result == 0) && (output_file_ != nullptr))
+        if (output_filename.empty() || ((result == 0) && (output_file_ != nullptr)))
         {
             success = ProcessFileHeader();
         }
@@ -142,7 +145,7 @@ bool FileTransformer::Process()
     if (!success && (error_state_ == kErrorNone))
     {
         // If a failure occured, but no error code was set, check for a file error.
-        if ((input_file_ == nullptr) || (output_file_ == nullptr))
+        if ((input_file_ == nullptr) || ((output_file_ == nullptr) && !output_filename_.empty()))
         {
             error_state_ = kErrorInvalidFileDescriptor;
         }
@@ -150,7 +153,7 @@ bool FileTransformer::Process()
         {
             error_state_ = kErrorReadingFile;
         }
-        else if (ferror(output_file_))
+        else if ((output_file_ != nullptr) && ferror(output_file_))
         {
             error_state_ = kErrorWritingFile;
         }
@@ -322,12 +325,68 @@ bool FileTransformer::ReadBlockHeader(format::BlockHeader* block_header)
 
     if (ReadBytes(block_header, sizeof(*block_header)))
     {
+        // Compressed chunks are expanded in place, so the caller receives the first block stored in the chunk.
+        while (block_header->type == format::BlockType::kCompressedChunkBlock)
+        {
+            if (!ReadCompressedChunk(*block_header) || !ReadBytes(block_header, sizeof(*block_header)))
+            {
+                return false;
+            }
+        }
+
         return true;
     }
 
     return false;
 }
 
+bool FileTransformer::ReadCompressedChunk(const format::BlockHeader& block_header)
+{
+    // Blocks never span chunks, so the previous chunk must have been consumed before the next chunk header was read.
+    assert(chunk_offset_ == chunk_data_.size());
+
+    uint64_t uncompressed_size = 0;
+    uint32_t block_count       = 0;
+    size_t   header_size       = sizeof(uncompressed_size) + sizeof(block_count);
+
+    if ((compressor_ == nullptr) || (block_header.size < header_size) ||
+        !ReadBytes(&uncompressed_size, sizeof(uncompressed_size)) || !ReadBytes(&block_count, sizeof(block_count)))
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read compressed chunk header");
+        return false;
+    }
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, uncompressed_size);
+
+    size_t compressed_size = static_cast<size_t>(block_header.size) - header_size;
+
+    if (compressed_size > compressed_parameter_buffer_.size())
+    {
+        compressed_parameter_buffer_.resize(compressed_size);
+    }
+
+    if (!ReadBytes(compressed_parameter_buffer_.data(), compressed_size))
+    {
+        HandleBlockReadError(kErrorReadingCompressedBlockData, "Failed to read compressed chunk data");
+        return false;
+    }
+
+    chunk_data_.resize(static_cast<size_t>(uncompressed_size));
+    chunk_offset_ = 0;
+
+    if (compressor_->Decompress(
+            compressed_size, compressed_parameter_buffer_, static_cast<size_t>(uncompressed_size), &chunk_data_) !=
+        uncompressed_size)
+    {
+        chunk_data_.clear();
+        HandleBlockReadError(kErrorReadingCompressedBlockData, "Failed to decompress chunk data");
+        return false;
+    }
+
+    return true;
+}
+
 bool FileTransformer::WriteBlockHeader(const format::BlockHeader& block_header)
 {
     if (!WriteBytes(&block_header, sizeof(block_header)))
@@ -383,6 +442,21 @@ bool FileTransformer::ReadCompressedParameterBuffer(size_t  compressed_buffer_si
 
 bool FileTransformer::ReadBytes(void* buffer, size_t buffer_size)
 {
+    size_t chunk_remaining = chunk_data_.size() - chunk_offset_;
+
+    if (chunk_remaining > 0)
+    {
+        // Reads are never split between a chunk and the file, because chunks only contain complete blocks.
+        if (buffer_size > chunk_remaining)
+        {
+            return false;
+        }
+
+        util::platform::MemoryCopy(buffer, buffer_size, chunk_data_.data() + chunk_offset_, buffer_size);
+        chunk_offset_ += buffer_size;
+        return true;
+    }
+
     if (util::platform::FileRead(buffer, buffer_size, input_file_))
     {
         bytes_read_ += buffer_size;
@@ -393,6 +467,12 @@ bool FileTransformer::ReadBytes(void* buffer, size_t buffer_size)
 
 bool FileTransformer::WriteBytes(const void* buffer, size_t buffer_size)
 {
+    if (output_file_ == nullptr)
+    {
+        // Processing without an output file.
+        return output_filename_.empty();
+    }
+
     if (util::platform::FileWrite(buffer, buffer_size, output_file_))
     {
         bytes_written_ += buffer_size;
@@ -403,6 +483,19 @@ bool FileTransformer::WriteBytes(const void* buffer, size_t buffer_size)
 
 bool FileTransformer::SkipBytes(uint64_t skip_size)
 {
+    size_t chunk_remaining = chunk_data_.size() - chunk_offset_;
+
+    if (chunk_remaining > 0)
+    {
+        if (skip_size > chunk_remaining)
+        {
+            return false;
+        }
+
+        chunk_offset_ += static_cast<size_t>(skip_size);
+        return true;
+    }
+
     bool success = util::platform::FileSeek(input_file_, skip_size, util::platform::FileSeekCurrent);
 
     if (success)
@@ -544,8 +637,63 @@ bool FileTransformer::ProcessMethodCall(const format::BlockHeader& block_header,
     return true;
 }
 
+bool FileTransformer::ReadCompressionDictionary(const format::BlockHeader& block_header,
+                                                std::vector<uint8_t>*      dictionary)
+{
+    assert(dictionary != nullptr);
+
+    uint64_t dictionary_size = 0;
+
+    if (!ReadBytes(&dictionary_size, sizeof(dictionary_size)))
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read compression dictionary meta-data block header");
+        return false;
+    }
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, dictionary_size);
+    dictionary->resize(static_cast<size_t>(dictionary_size));
+
+    if (!ReadBytes(dictionary->data(), dictionary->size()))
+    {
+        HandleBlockReadError(kErrorReadingBlockData, "Failed to read compression dictionary meta-data block data");
+        return false;
+    }
+
+    if ((compressor_ == nullptr) || !compressor_->LoadDictionary(dictionary->data(), dictionary->size()))
+    {
+        HandleBlockReadError(kErrorUnsupportedCompressionType,
+                             "Failed to load compression dictionary; compressed blocks cannot be processed");
+        return false;
+    }
+
+    return true;
+}
+
 bool FileTransformer::ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id)
 {
+    if (format::GetMetaDataType(meta_data_id) == format::MetaDataType::kCompressionDictionaryCommand)
+    {
+        // The dictionary is needed to decompress the input file, and is also copied to the output file below so that
+        // blocks that are copied without being decompressed remain readable.
+        std::vector<uint8_t> dictionary;
+        if (!ReadCompressionDictionary(block_header, &dictionary))
+        {
+            return false;
+        }
+
+        const uint64_t dictionary_size = dictionary.size();
+
+        if (!WriteBlockHeader(block_header) || !WriteBytes(&meta_data_id, sizeof(meta_data_id)) ||
+            !WriteBytes(&dictionary_size, sizeof(dictionary_size)) ||
+            !WriteBytes(dictionary.data(), dictionary.size()))
+        {
+            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write compression dictionary meta-data block");
+            return false;
+        }
+
+        return true;
+    }
+
     // Copy block data from old file to new file.
     if (!WriteBlockHeader(block_header))
     {
@@ -67,6 +67,8 @@ class FileTransformer
 
     virtual ~FileTransformer();
 
+    // When output_filename is empty, the input file is processed without writing an output file, which allows
+    // transformers to gather information from a capture file before processing it again.
     bool Initialize(const std::string& input_filename, const std::string& output_filename, const std::string& tool);
 
     // Returns false if processing failed.  Use GetErrorState() to determine error condition for failure case.
@@ -121,6 +123,10 @@ class FileTransformer
 
     bool CreateCompressor(format::CompressionType type, std::unique_ptr<util::Compressor>* compressor);
 
+    // Read the data for a kCompressionDictionaryCommand block and load it into the compressor used to decompress the
+    // input file.
+    bool ReadCompressionDictionary(const format::BlockHeader& block_header, std::vector<uint8_t>* dictionary);
+
     virtual bool WriteFileHeader(const format::FileHeader& header, const std::vector<format::FileOptionPair>& options);
 
     virtual bool ProcessFunctionCall(const format::BlockHeader& block_header, format::ApiCallId call_id);
@@ -141,6 +147,10 @@ class FileTransformer
 
     bool ReadBlockHeader(format::BlockHeader* block_header);
 
+    // Decompress the chunk that follows a compressed chunk block header. The blocks that it contains are then read from
+    // the chunk, and are transformed individually.
+    bool ReadCompressedChunk(const format::BlockHeader& block_header);
+
   private:
     std::string                         input_filename_;
     std::string                         output_filename_;
@@ -157,6 +167,8 @@ class FileTransformer
     std::vector<uint8_t>                compressed_parameter_buffer_;
     std::unique_ptr<util::Compressor>   compressor_;
     uint64_t                            block_index_{ 0 };
+    std::vector<uint8_t>                chunk_data_;
+    size_t                              chunk_offset_{ 0 };
 };
 
 GFXRECON_END_NAMESPACE(decode)
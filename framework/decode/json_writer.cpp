@@ -45,6 +45,7 @@ JsonWriter::~JsonWriter()
 {
     if (os_)
     {
+        FlushOutputBuffer();
         os_->Flush();
     }
 }
@@ -57,12 +58,11 @@ void JsonWriter::StartStream(util::OutputStream* os)
 
     if (json_options_.format == util::JsonFormat::JSON)
     {
-        Write(*os_, "[\n");
+        output_buffer_.append("[\n");
     }
 
     // Emit the header object as the first line of the file:
-    WriteBlockStart();
-    json_data_["header"] = header_;
+    WriteBlockStart()["header"] = header_;
     WriteBlockEnd();
 
     ++num_streams_;
@@ -74,17 +74,43 @@ void JsonWriter::EndStream()
     {
         if (json_options_.format == util::JsonFormat::JSON)
         {
-            Write(*os_, "\n]\n");
+            output_buffer_.append("\n]\n");
         }
         else
         {
-            Write(*os_, "\n");
+            output_buffer_.append("\n");
         }
+        FlushOutputBuffer();
         os_->Flush();
         os_ = nullptr;
     }
 }
 
+void JsonWriter::StartFragment(util::OutputStream* os)
+{
+    first_ = false;
+    os_    = os;
+}
+
+void JsonWriter::EndFragment()
+{
+    if (os_ != nullptr)
+    {
+        FlushOutputBuffer();
+        os_->Flush();
+        os_ = nullptr;
+    }
+}
+
+void JsonWriter::AppendFragment(const void* data, size_t size)
+{
+    GFXRECON_ASSERT(os_ != nullptr);
+
+    // Blocks already written by this writer, such as the header, precede the fragment.
+    FlushOutputBuffer();
+    os_->Write(data, size);
+}
+
 void JsonWriter::Destroy()
 {
     EndStream();
@@ -95,56 +121,73 @@ bool JsonWriter::IsValid() const
     return os_ != nullptr && os_->IsValid();
 }
 
-nlohmann::ordered_json& JsonWriter::WriteBlockStart()
+util::JsonValue& JsonWriter::WriteBlockStart()
 {
-    // Dominates profiling (1/2):
-    json_data_.clear();
-    return json_data_;
+    if (!first_)
+    {
+        output_buffer_.append(json_options_.format == util::JsonFormat::JSONL ? "\n" : ",\n");
+    }
+    first_ = false;
+
+    // Blocks are one line each in JSONL, and pretty printed in JSON, the same as dumping a tree of each would be.
+    return token_writer_.Begin(&output_buffer_,
+                               json_options_.format == util::JsonFormat::JSONL ? -1 : util::kJsonIndentWidth);
 }
 
 void JsonWriter::WriteBlockEnd()
 {
-    if (!first_)
+    token_writer_.End();
+
+    if (os_ == nullptr)
     {
-        Write(*os_, json_options_.format == util::JsonFormat::JSONL ? "\n" : ",\n");
+        // There is no stream to write to, as for a fragment that is only processed for the state of its consumers.
+        // Nothing else is buffered without a stream, as the buffer is flushed whenever a stream ends.
+        output_buffer_.clear();
+        return;
+    }
+
+    if (output_buffer_.size() >= kOutputBufferSize)
+    {
+        FlushOutputBuffer();
     }
-    first_ = false;
-    /// @todo Hand the tree over to a backend thread which dumps it to a string and streams it
-    /// while the main thread gets on with building the tree for the next block.
-    // Dominates profiling (2/2):
-    const std::string block =
-        json_data_.dump(json_options_.format == util::JsonFormat::JSONL ? -1 : util::kJsonIndentWidth);
-    Write(*os_, block);
-    os_->Flush();
 }
 
-nlohmann::ordered_json& JsonWriter::WriteApiCallStart(const ApiCallInfo& call_info, const std::string_view command_name)
+void JsonWriter::FlushOutputBuffer()
+{
+    if (!output_buffer_.empty())
+    {
+        Write(*os_, output_buffer_);
+        output_buffer_.clear();
+    }
+}
+
+util::JsonValue& JsonWriter::WriteApiCallStart(const ApiCallInfo& call_info, const std::string_view command_name)
 {
     auto& json_data = WriteBlockStart();
 
     json_data[format::kNameIndex] = call_info.index;
 
-    nlohmann::ordered_json& function = json_data[format::kNameFunction];
-    function[format::kNameName]      = command_name;
-    function[format::kNameThread]    = call_info.thread_id;
+    util::JsonValue& function     = json_data[format::kNameFunction];
+    function[format::kNameName]   = command_name;
+    function[format::kNameThread] = call_info.thread_id;
 
     return function;
 }
 
-nlohmann::ordered_json& JsonWriter::WriteApiCallStart(const ApiCallInfo&     call_info,
-                                                      const std::string_view object_type,
-                                                      const format::HandleId object_id,
-                                                      const std::string_view command_name)
+util::JsonValue& JsonWriter::WriteApiCallStart(const ApiCallInfo&     call_info,
+                                               const std::string_view object_type,
+                                               const format::HandleId object_id,
+                                               const std::string_view command_name)
 {
     auto& json_data = WriteBlockStart();
 
     json_data[format::kNameIndex] = call_info.index;
 
-    nlohmann::ordered_json& method = json_data[format::kNameMethod];
-    method[format::kNameName]      = command_name;
-    method[format::kNameThread]    = call_info.thread_id;
+    util::JsonValue& method     = json_data[format::kNameMethod];
+    method[format::kNameName]   = command_name;
+    method[format::kNameThread] = call_info.thread_id;
 
-    nlohmann::ordered_json& object  = method[format::kNameObject];
+    util::JsonValue& object         = method[format::kNameObject];
     object[format::kNameObjectType] = object_type;
     FieldToJson(object[format::kNameObjectHandle], object_id, GetOptions());
 
@@ -159,9 +202,9 @@ void JsonWriter::WriteMarker(const char* const name, const std::string_view mark
     {
         auto& json_data = WriteBlockStart();
 
-        nlohmann::ordered_json& state = json_data[name];
-        state["marker_type"]          = marker_type;
-        state["frame_number"]         = frame_number;
+        util::JsonValue& state = json_data[name];
+        state["marker_type"]   = marker_type;
+        state["frame_number"]  = frame_number;
 
         WriteBlockEnd();
 
@@ -171,13 +214,13 @@ void JsonWriter::WriteMarker(const char* const name, const std::string_view mark
     }
 }
 
-nlohmann::ordered_json& JsonWriter::WriteMetaCommandStart(const std::string_view command_name)
+util::JsonValue& JsonWriter::WriteMetaCommandStart(const std::string_view command_name)
 {
     auto& json_data = WriteBlockStart();
 
     json_data[format::kNameIndex] = block_index_;
-    nlohmann::ordered_json& meta = json_data[format::kNameMeta];
-    meta[format::kNameName]      = command_name;
+    util::JsonValue& meta         = json_data[format::kNameMeta];
+    meta[format::kNameName]       = command_name;
     return meta[format::kNameArgs];
 }
 
@@ -203,6 +246,12 @@ std::string JsonWriter::GenerateFilename(const std::string_view filename)
 
 bool JsonWriter::WriteBinaryFile(const std::string& filename, uint64_t data_size, const uint8_t* data)
 {
+    if (os_ == nullptr)
+    {
+        // The block referencing the file is discarded, so only its name is generated.
+        return true;
+    }
+
     FILE* file_output = nullptr;
     if (util::platform::FileOpen(&file_output, filename.c_str(), "wb") == 0)
     {
@@ -213,11 +262,11 @@ bool JsonWriter::WriteBinaryFile(const std::string& filename, uint64_t data_size
     return false;
 }
 
-void RepresentBinaryFile(JsonWriter&             writer,
-                         nlohmann::ordered_json& jdata,
-                         std::string_view        filename_base,
-                         const uint64_t          data_size,
-                         const uint8_t* const    data)
+void RepresentBinaryFile(JsonWriter&          writer,
+                         util::JsonValue&     jdata,
+                         std::string_view     filename_base,
+                         const uint64_t       data_size,
+                         const uint8_t* const data)
 {
     const util::JsonOptions& json_options = writer.GetOptions();
     if (json_options.dump_binaries)
@@ -28,6 +28,7 @@
 #define GFXRECON_DECODE_JSON_WRITER_H
 
 #include "annotation_handler.h"
+#include "util/json_token_writer.h"
 #include "util/json_util.h"
 #include "util/platform.h"
 #include "util/defines.h"
@@ -35,6 +36,8 @@
 
 #include "nlohmann/json.hpp"
 
+#include <string>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 class OutputStream;
@@ -56,49 +59,59 @@ class JsonWriter : public AnnotationHandler
     void StartStream(util::OutputStream* os);
     /// Output data at end of stream such as closing the JSON array.
     void EndStream();
+    /// Output blocks as a fragment of a stream, without the header object or the enclosing JSON array. Every block
+    /// is preceded by a separator, so that fragments can be appended after the header of a stream started by another
+    /// writer with StartStream(). With a null stream, blocks are built but discarded.
+    void StartFragment(util::OutputStream* os);
+    /// Write any buffered blocks of the fragment, without ending the stream.
+    void EndFragment();
+    /// Append data previously written by another writer between StartFragment() and EndFragment().
+    void AppendFragment(const void* data, size_t size);
     void Destroy();
     bool IsValid() const;
 
-    /// Get a clean fresh JSON tree to build a block's representation in.
-    /// Users can build the JSON representation of their blocks in this tree before
-    /// calling WriteBlockEnd() to serialize it out to the stream.
-    nlohmann::ordered_json& WriteBlockStart();
+    /// Start a block, returning the JSON value it is represented as.
+    /// The value is written out as it is populated, so users must populate it in document order before calling
+    /// WriteBlockEnd() to complete it.
+    util::JsonValue& WriteBlockStart();
 
-    /// Finalise the current block and stream it out.
+    /// Complete the current block and stream it out.
     void WriteBlockEnd();
 
-    /// Start the JSON tree for a function call, building the top-level object
+    /// Start the JSON value for a function call, writing the top-level object
     /// with index and function fields, adding name and thread to the function.
     /// @return The "function" object field for the caller to populate further
     /// with return value if any and arguments.
-    nlohmann::ordered_json& WriteApiCallStart(const ApiCallInfo& call_info, const std::string_view command_name);
+    util::JsonValue& WriteApiCallStart(const ApiCallInfo& call_info, const std::string_view command_name);
 
-    /// Start the JSON tree for a method call, building the top-level object
+    /// Start the JSON value for a method call, writing the top-level object
     /// with index and function fields, adding name and thread to the function.
     /// @return The "method" object field for the caller to populate further
     /// with return value if any and arguments.
-    nlohmann::ordered_json& WriteApiCallStart(const ApiCallInfo&     call_info,
-                                              const std::string_view object_type,
-                                              const format::HandleId object_id,
-                                              const std::string_view command_name);
+    util::JsonValue& WriteApiCallStart(const ApiCallInfo&     call_info,
+                                       const std::string_view object_type,
+                                       const format::HandleId object_id,
+                                       const std::string_view command_name);
 
     void WriteMarker(const char* name, const std::string_view marker_type, uint64_t frame_number);
 
     /// @brief Output the boilerplate for representing a metadata block in JSON,
-    /// returning the root of the empty "args" JSON sub-tree for the caller to populate.
-    nlohmann::ordered_json& WriteMetaCommandStart(const std::string_view command_name);
+    /// returning the empty "args" JSON value for the caller to populate.
+    util::JsonValue& WriteMetaCommandStart(const std::string_view command_name);
 
     /// Get the JSON object used to output the per-stream header
     /// Consumers can add their own fields to it.
     nlohmann::ordered_json& GetHeaderJson() { return header_; }
 
-    /// Get the root of the JSON tree for the current block.
-    nlohmann::ordered_json& GetBlockJson() { return json_data_; }
-
     const util::JsonOptions& GetOptions() const { return json_options_; }
 
     uint32_t GetNumStreams() const { return num_streams_; }
 
+    /// Binary files are numbered in the order they are generated. Setting the count continues the numbering of
+    /// another writer.
+    uint32_t GetNumFiles() const { return num_files_; }
+    void     SetNumFiles(uint32_t num_files) { num_files_ = num_files; }
+
     /// @brief Convert annotations, which are simple {type:enum, key:string, value:string} objects.
     virtual void ProcessAnnotation(uint64_t               block_index,
                                    format::AnnotationType type,
@@ -111,12 +124,22 @@ class JsonWriter : public AnnotationHandler
     inline void SetCurrentBlockIndex(uint64_t block_index) { block_index_ = block_index; }
 
   private:
-    util::OutputStream*    os_;
+    /// Write the buffered output to the stream.
+    void FlushOutputBuffer();
+
+  private:
+    /// Blocks are buffered until the output buffer reaches this size before they are written to the stream.
+    static constexpr size_t kOutputBufferSize = 64 * 1024;
+
+    util::OutputStream*    os_{ nullptr };
     nlohmann::ordered_json header_;
     util::JsonOptions      json_options_;
-    nlohmann::ordered_json json_data_;
     uint64_t               block_index_;
-    uint32_t               num_streams_{ 0 };
+    /// Blocks waiting to be written to the stream. Retains its capacity between blocks.
+    std::string output_buffer_;
+    /// Writes the tokens of each block straight into output_buffer_ as the block is populated.
+    util::JsonTokenWriter token_writer_;
+    uint32_t              num_streams_{ 0 };
     /// Number of side-files generated for dumping binary blobs etc.
     uint32_t num_files_{ 0 };
 
@@ -129,13 +152,13 @@ class JsonWriter : public AnnotationHandler
     bool first_{ true };
 };
 
-/// Either write the binary data to a file, and put the filename in the tree or
-/// put the tag format::kValBinary in the tree to indicate it
-void RepresentBinaryFile(JsonWriter&             writer,
-                         nlohmann::ordered_json& jdata,
-                         const std::string_view  filename_base,
-                         const uint64_t          data_size,
-                         const uint8_t* const    data);
+/// Either write the binary data to a file, and put the filename in the JSON value or
+/// put the tag format::kValBinary in the value to indicate it
+void RepresentBinaryFile(JsonWriter&            writer,
+                         util::JsonValue&       jdata,
+                         const std::string_view filename_base,
+                         const uint64_t         data_size,
+                         const uint8_t* const   data);
 
 GFXRECON_END_NAMESPACE(decode)
 GFXRECON_END_NAMESPACE(gfxrecon)
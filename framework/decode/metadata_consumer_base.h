@@ -25,9 +25,13 @@
 #define GFXRECON_DECODE_METADATA_CONSUMER_BASE_H
 
 #include "util/defines.h"
+#include "util/delta_encoder.h"
+#include "util/logging.h"
 #include "format/format.h"
 #include "generated/generated_vulkan_struct_decoders.h"
 
+#include <cinttypes>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
@@ -39,6 +43,35 @@ class MetadataConsumerBase
     virtual void Process_ExeFileInfo(util::filepath::FileInfo& info_record) {}
     virtual void ProcessDisplayMessageCommand(const std::string& message) {}
     virtual void ProcessFillMemoryCommand(uint64_t memory_id, uint64_t offset, uint64_t size, const uint8_t* data) {}
+    /// @brief Returns a pointer that fill memory command data can be written to directly before it is passed to
+    /// ProcessFillMemoryCommand, or nullptr if the consumer needs the data in a separate buffer.
+    virtual uint8_t*
+    GetFillMemoryCommandDestination(uint64_t memory_id, uint64_t offset, uint64_t size, bool needs_read_access)
+    {
+        return nullptr;
+    }
+    /// @brief Processes the spans of changed data encoded by a fill memory delta command. The default implementation
+    /// passes each span to ProcessFillMemoryCommand, which only requires the memory to hold the data of the previous
+    /// fill memory commands for the same range.
+    virtual void ProcessFillMemoryDeltaCommand(
+        uint64_t memory_id, uint64_t offset, uint64_t size, uint64_t data_size, const uint8_t* data)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, data_size);
+
+        bool success = util::DeltaEncoder::VisitSpans(
+            data,
+            static_cast<size_t>(data_size),
+            size,
+            [this, memory_id, offset](uint64_t span_offset, size_t span_size, const uint8_t* span_data) {
+                ProcessFillMemoryCommand(memory_id, offset + span_offset, span_size, span_data);
+            });
+
+        if (!success)
+        {
+            GFXRECON_LOG_ERROR("Skipping the remainder of a malformed fill memory delta command for memory %" PRIu64,
+                               memory_id);
+        }
+    }
     virtual void
     ProcessFillMemoryResourceValueCommand(const format::FillMemoryResourceValueCommandHeader& command_header,
                                           const uint8_t*                                      data)
@@ -50,7 +50,7 @@ class MetadataJsonConsumer : public Base
 
     inline const util::JsonOptions& GetOptions() const { return this->writer_->GetOptions(); }
     inline const util::JsonOptions& GetJsonOptions() const { return this->writer_->GetOptions(); } // temp
-    inline nlohmann::ordered_json&  WriteMetaCommandStart(const std::string& command_name) const
+    inline util::JsonValue&         WriteMetaCommandStart(const std::string& command_name) const
     {
         this->writer_->SetCurrentBlockIndex(this->block_index_);
         return this->writer_->WriteMetaCommandStart(command_name);
@@ -285,6 +285,8 @@ class MetadataJsonConsumer : public Base
         const JsonOptions& json_options = GetJsonOptions();
         auto&              json_data    = WriteMetaCommandStart("SetEnvironmentVariablesCommand");
 
+        // Collected first, as a variable that is set more than once should only be written with its last value.
+        nlohmann::ordered_json   env_vars_json;
         std::vector<std::string> env_vars =
             util::strings::SplitString(std::string_view(env_string), format::kEnvironmentStringDelimeter);
         for (std::string& e : env_vars)
@@ -292,11 +294,15 @@ class MetadataJsonConsumer : public Base
             std::vector<std::string> var_plus_val = util::strings::SplitString(e, '=');
             if (var_plus_val.size() == 2)
             {
-                const char* var = var_plus_val[0].c_str();
-                const char* val = var_plus_val[1].c_str();
-                json_data[var]  = val;
+                const char* var    = var_plus_val[0].c_str();
+                const char* val    = var_plus_val[1].c_str();
+                env_vars_json[var] = val;
             }
         }
+        if (!env_vars_json.is_null())
+        {
+            json_data = env_vars_json;
+        }
         WriteBlockEnd();
     }
 
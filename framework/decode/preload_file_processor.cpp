@@ -27,16 +27,191 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
-PreloadFileProcessor::PreloadFileProcessor() : status_(PreloadStatus::kInactive) {}
+// Returns true for the calls that create or destroy objects. Replaying them again would create objects with IDs that
+// are already in use, or destroy objects that no longer exist.
+static bool IsObjectLifetimeCall(format::ApiCallId call_id)
+{
+    switch (call_id)
+    {
+        case format::ApiCallId::ApiCall_vkCreateInstance:
+        case format::ApiCallId::ApiCall_vkDestroyInstance:
+        case format::ApiCallId::ApiCall_vkCreateDevice:
+        case format::ApiCallId::ApiCall_vkDestroyDevice:
+        case format::ApiCallId::ApiCall_vkAllocateMemory:
+        case format::ApiCallId::ApiCall_vkFreeMemory:
+        case format::ApiCallId::ApiCall_vkCreateFence:
+        case format::ApiCallId::ApiCall_vkDestroyFence:
+        case format::ApiCallId::ApiCall_vkCreateSemaphore:
+        case format::ApiCallId::ApiCall_vkDestroySemaphore:
+        case format::ApiCallId::ApiCall_vkCreateEvent:
+        case format::ApiCallId::ApiCall_vkDestroyEvent:
+        case format::ApiCallId::ApiCall_vkCreateQueryPool:
+        case format::ApiCallId::ApiCall_vkDestroyQueryPool:
+        case format::ApiCallId::ApiCall_vkCreateBuffer:
+        case format::ApiCallId::ApiCall_vkDestroyBuffer:
+        case format::ApiCallId::ApiCall_vkCreateBufferView:
+        case format::ApiCallId::ApiCall_vkDestroyBufferView:
+        case format::ApiCallId::ApiCall_vkCreateImage:
+        case format::ApiCallId::ApiCall_vkDestroyImage:
+        case format::ApiCallId::ApiCall_vkCreateImageView:
+        case format::ApiCallId::ApiCall_vkDestroyImageView:
+        case format::ApiCallId::ApiCall_vkCreateShaderModule:
+        case format::ApiCallId::ApiCall_vkDestroyShaderModule:
+        case format::ApiCallId::ApiCall_vkCreatePipelineCache:
+        case format::ApiCallId::ApiCall_vkDestroyPipelineCache:
+        case format::ApiCallId::ApiCall_vkCreateGraphicsPipelines:
+        case format::ApiCallId::ApiCall_vkCreateComputePipelines:
+        case format::ApiCallId::ApiCall_vkDestroyPipeline:
+        case format::ApiCallId::ApiCall_vkCreatePipelineLayout:
+        case format::ApiCallId::ApiCall_vkDestroyPipelineLayout:
+        case format::ApiCallId::ApiCall_vkCreateSampler:
+        case format::ApiCallId::ApiCall_vkDestroySampler:
+        case format::ApiCallId::ApiCall_vkCreateDescriptorSetLayout:
+        case format::ApiCallId::ApiCall_vkDestroyDescriptorSetLayout:
+        case format::ApiCallId::ApiCall_vkCreateDescriptorPool:
+        case format::ApiCallId::ApiCall_vkDestroyDescriptorPool:
+        case format::ApiCallId::ApiCall_vkAllocateDescriptorSets:
+        case format::ApiCallId::ApiCall_vkFreeDescriptorSets:
+        case format::ApiCallId::ApiCall_vkResetDescriptorPool:
+        case format::ApiCallId::ApiCall_vkCreateFramebuffer:
+        case format::ApiCallId::ApiCall_vkDestroyFramebuffer:
+        case format::ApiCallId::ApiCall_vkCreateRenderPass:
+        case format::ApiCallId::ApiCall_vkDestroyRenderPass:
+        case format::ApiCallId::ApiCall_vkCreateCommandPool:
+        case format::ApiCallId::ApiCall_vkDestroyCommandPool:
+        case format::ApiCallId::ApiCall_vkAllocateCommandBuffers:
+        case format::ApiCallId::ApiCall_vkFreeCommandBuffers:
+        case format::ApiCallId::ApiCall_vkCreateSamplerYcbcrConversion:
+        case format::ApiCallId::ApiCall_vkDestroySamplerYcbcrConversion:
+        case format::ApiCallId::ApiCall_vkCreateDescriptorUpdateTemplate:
+        case format::ApiCallId::ApiCall_vkDestroyDescriptorUpdateTemplate:
+        case format::ApiCallId::ApiCall_vkDestroySurfaceKHR:
+        case format::ApiCallId::ApiCall_vkCreateSwapchainKHR:
+        case format::ApiCallId::ApiCall_vkDestroySwapchainKHR:
+        case format::ApiCallId::ApiCall_vkCreateDisplayModeKHR:
+        case format::ApiCallId::ApiCall_vkCreateDisplayPlaneSurfaceKHR:
+        case format::ApiCallId::ApiCall_vkCreateSharedSwapchainsKHR:
+        case format::ApiCallId::ApiCall_vkCreateXlibSurfaceKHR:
+        case format::ApiCallId::ApiCall_vkCreateXcbSurfaceKHR:
+        case format::ApiCallId::ApiCall_vkCreateWaylandSurfaceKHR:
+        case format::ApiCallId::ApiCall_vkCreateMirSurfaceKHR:
+        case format::ApiCallId::ApiCall_vkCreateAndroidSurfaceKHR:
+        case format::ApiCallId::ApiCall_vkCreateWin32SurfaceKHR:
+        case format::ApiCallId::ApiCall_vkCreateDescriptorUpdateTemplateKHR:
+        case format::ApiCallId::ApiCall_vkDestroyDescriptorUpdateTemplateKHR:
+        case format::ApiCallId::ApiCall_vkCreateRenderPass2KHR:
+        case format::ApiCallId::ApiCall_vkCreateSamplerYcbcrConversionKHR:
+        case format::ApiCallId::ApiCall_vkDestroySamplerYcbcrConversionKHR:
+        case format::ApiCallId::ApiCall_vkCreateDebugReportCallbackEXT:
+        case format::ApiCallId::ApiCall_vkDestroyDebugReportCallbackEXT:
+        case format::ApiCallId::ApiCall_vkCreateViSurfaceNN:
+        case format::ApiCallId::ApiCall_vkCreateIndirectCommandsLayoutNVX:
+        case format::ApiCallId::ApiCall_vkDestroyIndirectCommandsLayoutNVX:
+        case format::ApiCallId::ApiCall_vkCreateObjectTableNVX:
+        case format::ApiCallId::ApiCall_vkDestroyObjectTableNVX:
+        case format::ApiCallId::ApiCall_vkCreateIOSSurfaceMVK:
+        case format::ApiCallId::ApiCall_vkCreateMacOSSurfaceMVK:
+        case format::ApiCallId::ApiCall_vkCreateDebugUtilsMessengerEXT:
+        case format::ApiCallId::ApiCall_vkDestroyDebugUtilsMessengerEXT:
+        case format::ApiCallId::ApiCall_vkCreateValidationCacheEXT:
+        case format::ApiCallId::ApiCall_vkDestroyValidationCacheEXT:
+        case format::ApiCallId::ApiCall_vkCreateAccelerationStructureNV:
+        case format::ApiCallId::ApiCall_vkDestroyAccelerationStructureNV:
+        case format::ApiCallId::ApiCall_vkCreateRayTracingPipelinesNV:
+        case format::ApiCallId::ApiCall_vkCreateImagePipeSurfaceFUCHSIA:
+        case format::ApiCallId::ApiCall_vkCreateMetalSurfaceEXT:
+        case format::ApiCallId::ApiCall_vkCreateStreamDescriptorSurfaceGGP:
+        case format::ApiCallId::ApiCall_vkCreateHeadlessSurfaceEXT:
+        case format::ApiCallId::ApiCall_vkCreateRenderPass2:
+        case format::ApiCallId::ApiCall_vkCreateDeferredOperationKHR:
+        case format::ApiCallId::ApiCall_vkDestroyDeferredOperationKHR:
+        case format::ApiCallId::ApiCall_vkCreateAccelerationStructureKHR:
+        case format::ApiCallId::ApiCall_vkDestroyAccelerationStructureKHR:
+        case format::ApiCallId::ApiCall_vkCreateRayTracingPipelinesKHR:
+        case format::ApiCallId::ApiCall_vkCreateIndirectCommandsLayoutNV:
+        case format::ApiCallId::ApiCall_vkDestroyIndirectCommandsLayoutNV:
+        case format::ApiCallId::ApiCall_vkCreatePrivateDataSlotEXT:
+        case format::ApiCallId::ApiCall_vkDestroyPrivateDataSlotEXT:
+        case format::ApiCallId::ApiCall_vkCreateDirectFBSurfaceEXT:
+        case format::ApiCallId::ApiCall_vkCreateScreenSurfaceQNX:
+        case format::ApiCallId::ApiCall_vkCreatePrivateDataSlot:
+        case format::ApiCallId::ApiCall_vkDestroyPrivateDataSlot:
+        case format::ApiCallId::ApiCall_vkCreateMicromapEXT:
+        case format::ApiCallId::ApiCall_vkDestroyMicromapEXT:
+        case format::ApiCallId::ApiCall_vkCreateOpticalFlowSessionNV:
+        case format::ApiCallId::ApiCall_vkDestroyOpticalFlowSessionNV:
+        case format::ApiCallId::ApiCall_vkCreateVideoSessionKHR:
+        case format::ApiCallId::ApiCall_vkDestroyVideoSessionKHR:
+        case format::ApiCallId::ApiCall_vkCreateVideoSessionParametersKHR:
+        case format::ApiCallId::ApiCall_vkDestroyVideoSessionParametersKHR:
+        case format::ApiCallId::ApiCall_vkCreateShadersEXT:
+        case format::ApiCallId::ApiCall_vkDestroyShaderEXT:
+        case format::ApiCallId::ApiCall_vkCreatePipelineBinariesKHR:
+        case format::ApiCallId::ApiCall_vkDestroyPipelineBinaryKHR:
+        case format::ApiCallId::ApiCall_vkCreateIndirectCommandsLayoutEXT:
+        case format::ApiCallId::ApiCall_vkDestroyIndirectCommandsLayoutEXT:
+        case format::ApiCallId::ApiCall_vkCreateIndirectExecutionSetEXT:
+        case format::ApiCallId::ApiCall_vkDestroyIndirectExecutionSetEXT:
+            return true;
+        default:
+            return false;
+    }
+}
+
+PreloadFileProcessor::PreloadFileProcessor() :
+    status_(PreloadStatus::kInactive), preload_frame_number_(0), preload_block_index_(0),
+    preload_lifetime_call_id_(format::ApiCallId::ApiCall_Unknown)
+{}
 
-void PreloadFileProcessor::PreloadNextFrames(size_t count)
+bool PreloadFileProcessor::PreloadNextFrames(size_t count, bool repeat)
 {
+    // Frame number and block index are not advanced while recording.
+    preload_frame_number_ = current_frame_number_;
+    preload_block_index_  = block_index_;
+
+    preload_lifetime_call_id_ = format::ApiCallId::ApiCall_Unknown;
+
     status_ = PreloadStatus::kRecord;
-    while (--count != 0U)
+    for (; count != 0U; --count)
     {
         ProcessNextFrame();
     }
     status_ = PreloadStatus::kReplay;
+
+    if (repeat && (preload_lifetime_call_id_ != format::ApiCallId::ApiCall_Unknown))
+    {
+        // There is no state reset between loops, so only ranges that leave the set of objects unchanged can loop.
+        // Fail before the first loop is replayed, rather than producing measurements for fewer loops than requested.
+        GFXRECON_LOG_ERROR("Preloaded frames can't be replayed again because they create or destroy objects (API call "
+                           "ID 0x%08x); select a measurement range without object creation or destruction",
+                           static_cast<uint32_t>(preload_lifetime_call_id_));
+        error_state_ = kErrorPreloadedFramesNotRepeatable;
+        return false;
+    }
+
+    return true;
+}
+
+bool PreloadFileProcessor::ReplayPreloadedFrames()
+{
+    if ((status_ != PreloadStatus::kInactive) || !preload_buffer_.ReplayFinished())
+    {
+        GFXRECON_LOG_ERROR("Preloaded frames can only be replayed again after they have been replayed in full");
+        return false;
+    }
+
+    if (preload_lifetime_call_id_ != format::ApiCallId::ApiCall_Unknown)
+    {
+        GFXRECON_LOG_ERROR("Preloaded frames that create or destroy objects can't be replayed again");
+        return false;
+    }
+
+    preload_buffer_.Rewind();
+    current_frame_number_ = preload_frame_number_;
+    block_index_          = preload_block_index_;
+    status_               = PreloadStatus::kReplay;
+
+    return true;
 }
 
 PreloadFileProcessor::PreloadBuffer::PreloadBuffer() : replay_offset_(0) {}
@@ -55,6 +230,18 @@ size_t PreloadFileProcessor::PreloadBuffer::Read(void* destination, size_t desti
     return read_size;
 }
 
+const void* PreloadFileProcessor::PreloadBuffer::ReadInPlace(size_t destination_size)
+{
+    if (destination_size > (container_.size() - replay_offset_))
+    {
+        return nullptr;
+    }
+
+    const void* data = container_.data() + replay_offset_;
+    replay_offset_ += destination_size;
+    return data;
+}
+
 void PreloadFileProcessor::PreloadBuffer::Reset()
 {
     container_.clear();
@@ -103,6 +290,11 @@ bool PreloadFileProcessor::ProcessBlocks()
                             {
                                 HandleBlockReadError(kErrorReadingBlockData, "Failed to read function call block data");
                             }
+                            else if ((preload_lifetime_call_id_ == format::ApiCallId::ApiCall_Unknown) &&
+                                     IsObjectLifetimeCall(api_call_id))
+                            {
+                                preload_lifetime_call_id_ = api_call_id;
+                            }
 
                             if (is_frame_delimiter)
                             {
@@ -300,7 +492,7 @@ bool PreloadFileProcessor::ProcessBlocks()
             }
             else
             {
-                if (feof(GetFileDescriptor()) == 0)
+                if (!IsActiveFileEof())
                 {
                     // No data has been read for the current block, so we don't use 'HandleBlockReadError' here, as
                     // it assumes that the block header has been successfully read and will print an incomplete
@@ -334,12 +526,35 @@ bool PreloadFileProcessor::ReadBytes(void* buffer, size_t buffer_size)
     }
     else
     {
-        bytes_read = util::platform::FileRead(buffer, buffer_size, GetFileDescriptor());
+        // Frames are recorded from the file, or from its decompressed chunks, block by block.
+        return ReadFileBytes(buffer, buffer_size);
     }
 
     bytes_read_ += bytes_read;
     return bytes_read == buffer_size;
 }
 
+const uint8_t* PreloadFileProcessor::ReadBytesInPlace(size_t buffer_size)
+{
+    if (status_ == PreloadStatus::kReplay)
+    {
+        auto data = reinterpret_cast<const uint8_t*>(preload_buffer_.ReadInPlace(buffer_size));
+
+        if (data != nullptr)
+        {
+            bytes_read_ += buffer_size;
+
+            if (preload_buffer_.ReplayFinished())
+            {
+                status_ = PreloadStatus::kInactive;
+            }
+        }
+
+        return data;
+    }
+
+    return FileProcessor::ReadBytesInPlace(buffer_size);
+}
+
 GFXRECON_END_NAMESPACE(decode)
 GFXRECON_END_NAMESPACE(gfxrecon)
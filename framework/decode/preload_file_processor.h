@@ -35,8 +35,14 @@ class PreloadFileProcessor : public FileProcessor
   public:
     PreloadFileProcessor();
 
-    // Preloads *count* frames to continuous, expandable memory buffer
-    void PreloadNextFrames(size_t count);
+    // Preloads *count* frames to continuous, expandable memory buffer. When *repeat* is true, the preloaded frames will
+    // be replayed again with ReplayPreloadedFrames, and preloading fails with kErrorPreloadedFramesNotRepeatable if
+    // the frames create or destroy objects, because the objects are not restored to their state before the frames.
+    bool PreloadNextFrames(size_t count, bool repeat);
+
+    // Rewinds replay to the first preloaded frame, so that the preloaded frames can be replayed again without reading
+    // them from the file. Must be called after the preloaded frames have been replayed in full.
+    bool ReplayPreloadedFrames();
 
   private:
     class PreloadBuffer
@@ -64,6 +70,13 @@ class PreloadFileProcessor : public FileProcessor
         // Returns the pointer to initialized memory
         inline void* Add(size_t size) { return &*container_.insert(container_.end(), size, 0); }
 
+        // Returns a pointer to the next destination_size bytes of preloaded data and advances past them, or nullptr if
+        // fewer bytes remain
+        const void* ReadInPlace(size_t destination_size);
+
+        // Restarts replay from the first preloaded call
+        inline void Rewind() { replay_offset_ = 0; }
+
         // Indicates whether the preloaded calls have been replayed in full
         inline bool ReplayFinished() { return !container_.empty() && replay_offset_ >= container_.size(); }
 
@@ -83,6 +96,13 @@ class PreloadFileProcessor : public FileProcessor
         kReplay
     } status_;
 
+    // Frame number and block index of the first preloaded frame, restored when the preloaded frames are replayed again
+    uint64_t preload_frame_number_;
+    uint64_t preload_block_index_;
+
+    // First call of the preloaded frames that creates or destroys objects, or ApiCall_Unknown
+    format::ApiCallId preload_lifetime_call_id_;
+
     template <typename T>
     bool ReadParameterBytes(format::BlockHeader& block_header, T& data, PreloadBuffer& preload_buffer)
     {
@@ -106,6 +126,8 @@ class PreloadFileProcessor : public FileProcessor
     bool ProcessBlocks() override;
 
     bool ReadBytes(void* buffer, size_t buffer_size) override;
+
+    const uint8_t* ReadBytesInPlace(size_t buffer_size) override;
 };
 
 GFXRECON_END_NAMESPACE(decode)
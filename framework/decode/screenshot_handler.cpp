@@ -27,6 +27,7 @@
 #include "decode/decoder_util.h"
 
 #include <limits>
+#include <memory>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -42,7 +43,7 @@ inline void WriteImageFile(const std::string&     filename,
                            uint32_t               width,
                            uint32_t               height,
                            uint64_t               size,
-                           void*                  data)
+                           const void*            data)
 {
     switch (file_format)
     {
@@ -384,14 +385,25 @@ void ScreenshotHandler::WriteImage(const std::string&                      filen
                                 1, &invalidate_range, &copy_resource.buffer_memory_data);
                         }
 
-                        WriteImageFile(filename_prefix,
-                                       screenshot_format_,
-                                       copy_width,
-                                       copy_height,
-                                       copy_resource.buffer_size,
-                                       data);
+                        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, copy_resource.buffer_size);
+
+                        // Encode and write the image on a worker thread, from a copy of the transfer buffer, which is
+                        // reused by the next screenshot.
+                        const uint8_t* bytes      = static_cast<const uint8_t*>(data);
+                        auto           image_data = std::make_shared<std::vector<uint8_t>>(
+                            bytes, bytes + static_cast<size_t>(copy_resource.buffer_size));
 
                         allocator->UnmapResourceMemoryDirect(copy_resource.buffer_data);
+
+                        image_writer_queue_.Post(
+                            [filename_prefix, file_format = screenshot_format_, copy_width, copy_height, image_data]() {
+                                WriteImageFile(filename_prefix,
+                                               file_format,
+                                               copy_width,
+                                               copy_height,
+                                               image_data->size(),
+                                               image_data->data());
+                            });
                     }
                 }
                 else
@@ -29,6 +29,7 @@
 #include "decode/vulkan_resource_allocator.h"
 #include "generated/generated_vulkan_dispatch_table.h"
 #include "util/defines.h"
+#include "util/image_writer_queue.h"
 
 #include "vulkan/vulkan.h"
 
@@ -119,7 +120,8 @@ class ScreenshotHandler : public ScreenshotHandlerBase
     void DestroyCopyResource(VkDevice device, CopyResource* copy_resource) const;
 
   private:
-    CommandPools copy_resources_;
+    CommandPools           copy_resources_;
+    util::ImageWriterQueue image_writer_queue_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -83,6 +83,37 @@ void VulkanDecoderBase::DispatchFillMemoryCommand(
     }
 }
 
+uint8_t* VulkanDecoderBase::GetFillMemoryCommandDestination(
+    format::ThreadId thread_id, uint64_t memory_id, uint64_t offset, uint64_t size, bool needs_read_access)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(thread_id);
+
+    uint8_t* destination = nullptr;
+
+    // With multiple consumers, each one needs to see the original data, so it cannot be written in place.
+    if (consumers_.size() == 1)
+    {
+        destination = consumers_[0]->GetFillMemoryCommandDestination(memory_id, offset, size, needs_read_access);
+    }
+
+    return destination;
+}
+
+void VulkanDecoderBase::DispatchFillMemoryDeltaCommand(format::ThreadId thread_id,
+                                                       uint64_t         memory_id,
+                                                       uint64_t         offset,
+                                                       uint64_t         size,
+                                                       uint64_t         data_size,
+                                                       const uint8_t*   data)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(thread_id);
+
+    for (auto consumer : consumers_)
+    {
+        consumer->ProcessFillMemoryDeltaCommand(memory_id, offset, size, data_size, data);
+    }
+}
+
 void VulkanDecoderBase::DispatchExeFileInfo(format::ThreadId thread_id, format::ExeFileInfoBlock& info)
 {
     for (auto consumer : consumers_)
@@ -90,6 +90,19 @@ class VulkanDecoderBase : public ApiDecoder
     virtual void DispatchFillMemoryCommand(
         format::ThreadId thread_id, uint64_t memory_id, uint64_t offset, uint64_t size, const uint8_t* data) override;
 
+    virtual uint8_t* GetFillMemoryCommandDestination(format::ThreadId thread_id,
+                                                     uint64_t         memory_id,
+                                                     uint64_t         offset,
+                                                     uint64_t         size,
+                                                     bool             needs_read_access) override;
+
+    virtual void DispatchFillMemoryDeltaCommand(format::ThreadId thread_id,
+                                                uint64_t         memory_id,
+                                                uint64_t         offset,
+                                                uint64_t         size,
+                                                uint64_t         data_size,
+                                                const uint8_t*   data) override;
+
     virtual void
     DispatchFillMemoryResourceValueCommand(const format::FillMemoryResourceValueCommandHeader& command_header,
                                            const uint8_t*                                      data) override;
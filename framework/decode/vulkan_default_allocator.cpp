@@ -503,9 +503,14 @@ VkResult VulkanDefaultAllocator::WriteMappedMemoryRange(MemoryData     allocator
         {
             GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, size);
 
-            size_t copy_size = static_cast<size_t>(size);
+            size_t   copy_size   = static_cast<size_t>(size);
+            uint8_t* destination = memory_alloc_info->mapped_pointer + offset;
 
-            util::platform::MemoryCopy(memory_alloc_info->mapped_pointer + offset, copy_size, data, copy_size);
+            // Data obtained from GetMappedMemoryWritePointer has already been written in place.
+            if (destination != data)
+            {
+                util::platform::MemoryCopy(destination, copy_size, data, copy_size);
+            }
 
             result = VK_SUCCESS;
         }
@@ -518,6 +523,31 @@ VkResult VulkanDefaultAllocator::WriteMappedMemoryRange(MemoryData     allocator
     return result;
 }
 
+uint8_t* VulkanDefaultAllocator::GetMappedMemoryWritePointer(MemoryData allocator_data,
+                                                             uint64_t   offset,
+                                                             uint64_t   size,
+                                                             bool       needs_read_access)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(size);
+
+    uint8_t* result = nullptr;
+
+    if (allocator_data != 0)
+    {
+        auto memory_alloc_info = reinterpret_cast<MemoryAllocInfo*>(allocator_data);
+
+        // Reading back from uncached (typically write-combined) memory is very slow, so only hand out the mapped
+        // pointer to readers when the memory is host cached.
+        if ((memory_alloc_info->mapped_pointer != nullptr) &&
+            (!needs_read_access || ((memory_alloc_info->property_flags & VK_MEMORY_PROPERTY_HOST_CACHED_BIT) != 0)))
+        {
+            result = memory_alloc_info->mapped_pointer + offset;
+        }
+    }
+
+    return result;
+}
+
 void VulkanDefaultAllocator::ReportAllocateMemoryIncompatibility(const VkMemoryAllocateInfo* allocate_info)
 {
     if ((allocate_info != nullptr) && (allocate_info->memoryTypeIndex >= memory_properties_.memoryTypeCount))
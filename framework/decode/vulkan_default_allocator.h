@@ -155,6 +155,11 @@ class VulkanDefaultAllocator : public VulkanResourceAllocator
     virtual VkResult
     WriteMappedMemoryRange(MemoryData allocator_data, uint64_t offset, uint64_t size, const uint8_t* data) override;
 
+    virtual uint8_t* GetMappedMemoryWritePointer(MemoryData allocator_data,
+                                                 uint64_t   offset,
+                                                 uint64_t   size,
+                                                 bool       needs_read_access) override;
+
     virtual void ReportAllocateMemoryIncompatibility(const VkMemoryAllocateInfo* allocate_info) override;
 
     virtual void ReportBindBufferIncompatibility(VkBuffer     buffer,
@@ -78,7 +78,7 @@ void VulkanExportJsonConsumerBase::Process_vkCmdBuildAccelerationStructuresIndir
     PointerDecoder<uint32_t*>*                                                 ppMaxPrimitiveCounts)
 {
     const JsonOptions& json_options = GetJsonOptions();
-    WriteApiCallToFile(call_info, "vkCmdBuildAccelerationStructuresIndirectKHR", [&](nlohmann::ordered_json& function) {
+    WriteApiCallToFile(call_info, "vkCmdBuildAccelerationStructuresIndirectKHR", [&](util::JsonValue& function) {
         auto& args = function[NameArgs()];
         HandleToJson(args["commandBuffer"], commandBuffer, json_options);
         FieldToJson(args["infoCount"], infoCount, json_options);
@@ -86,13 +86,12 @@ void VulkanExportJsonConsumerBase::Process_vkCmdBuildAccelerationStructuresIndir
         FieldToJson(args["pIndirectDeviceAddresses"], pIndirectDeviceAddresses, json_options);
         FieldToJson(args["pIndirectStrides"], pIndirectStrides, json_options);
 
-        auto infos                     = pInfos ? pInfos->GetPointer() : nullptr;
-        auto max_primitive_counts      = ppMaxPrimitiveCounts ? ppMaxPrimitiveCounts->GetPointer() : nullptr;
-        auto max_primitive_counts_json = args["ppMaxPrimitiveCounts"];
+        auto  infos                     = pInfos ? pInfos->GetPointer() : nullptr;
+        auto  max_primitive_counts      = ppMaxPrimitiveCounts ? ppMaxPrimitiveCounts->GetPointer() : nullptr;
+        auto& max_primitive_counts_json = args["ppMaxPrimitiveCounts"];
 
         for (uint32_t i = 0; i < infoCount; ++i)
         {
-            auto element = max_primitive_counts_json[i];
             FieldToJson(max_primitive_counts_json[i], max_primitive_counts[i], infos[i].geometryCount, json_options);
         }
     });
@@ -107,21 +106,28 @@ void VulkanExportJsonConsumerBase::Process_vkCreateShaderModule(
     gfxrecon::decode::HandlePointerDecoder<VkShaderModule>*                                     pShaderModule)
 {
     const JsonOptions& json_options = GetJsonOptions();
-    WriteApiCallToFile(call_info, "vkCreateShaderModule", [&](nlohmann::ordered_json& function) {
+    WriteApiCallToFile(call_info, "vkCreateShaderModule", [&](util::JsonValue& function) {
         FieldToJson(function[NameReturn()], returnValue, json_options);
         auto& args = function[NameArgs()];
         HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pShaderModule"], pShaderModule, json_options);
 
+        // The create info is written here rather than by FieldToJson() so that pCode can name the binary file.
         const uint64_t handle_id     = *pShaderModule->GetPointer();
         auto           decoded_value = pCreateInfo->GetPointer();
+        auto           meta_struct   = pCreateInfo->GetMetaStructPointer();
+        auto&          create_info   = args["pCreateInfo"];
+        FieldToJson(create_info["sType"], decoded_value->sType, json_options);
+        FieldToJson(VkShaderModuleCreateFlags_t(), create_info["flags"], decoded_value->flags, json_options);
+        FieldToJson(create_info["codeSize"], decoded_value->codeSize, json_options);
         RepresentBinaryFile(*(this->writer_),
-                            args["pCreateInfo"]["pCode"],
+                            create_info["pCode"],
                             "shader_module_" + util::to_hex_fixed_width(handle_id) + ".bin",
                             decoded_value->codeSize,
                             (uint8_t*)decoded_value->pCode);
+        FieldToJson(create_info["pNext"], meta_struct->pNext, json_options);
+
+        FieldToJson(args["pAllocator"], pAllocator, json_options);
+        HandleToJson(args["pShaderModule"], pShaderModule, json_options);
     });
 }
 
@@ -133,7 +139,7 @@ void VulkanExportJsonConsumerBase::Process_vkGetPipelineCacheData(const ApiCallI
                                                                   PointerDecoder<uint8_t>* pData)
 {
     const JsonOptions& json_options = GetJsonOptions();
-    WriteApiCallToFile(call_info, "vkGetPipelineCacheData", [&](nlohmann::ordered_json& function) {
+    WriteApiCallToFile(call_info, "vkGetPipelineCacheData", [&](util::JsonValue& function) {
         FieldToJson(function[NameReturn()], returnValue, json_options);
         auto& args = function[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -160,18 +166,27 @@ void VulkanExportJsonConsumerBase::Process_vkCreatePipelineCache(
     HandlePointerDecoder<VkPipelineCache>*                   pPipelineCache)
 {
     const JsonOptions& json_options = GetJsonOptions();
-    WriteApiCallToFile(call_info, "vkCreatePipelineCache", [&](nlohmann::ordered_json& function) {
+    WriteApiCallToFile(call_info, "vkCreatePipelineCache", [&](util::JsonValue& function) {
         FieldToJson(function[NameReturn()], returnValue, json_options);
         auto& args = function[NameArgs()];
         HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pPipelineCache"], pPipelineCache, json_options);
+
+        // The create info is written here rather than by FieldToJson() so that pInitialData can name the binary file.
+        auto  decoded_value = pCreateInfo->GetPointer();
+        auto  meta_struct   = pCreateInfo->GetMetaStructPointer();
+        auto& create_info   = args["pCreateInfo"];
+        FieldToJson(create_info["sType"], decoded_value->sType, json_options);
+        FieldToJson(VkPipelineCacheCreateFlags_t(), create_info["flags"], decoded_value->flags, json_options);
+        FieldToJson(create_info["initialDataSize"], decoded_value->initialDataSize, json_options);
         RepresentBinaryFile(*(this->writer_),
-                            args["pCreateInfo"]["pInitialData"],
+                            create_info["pInitialData"],
                             "pipeline_cache_data.bin",
-                            pCreateInfo->GetPointer()->initialDataSize,
-                            reinterpret_cast<const uint8_t*>(pCreateInfo->GetPointer()->pInitialData));
+                            decoded_value->initialDataSize,
+                            reinterpret_cast<const uint8_t*>(decoded_value->pInitialData));
+        FieldToJson(create_info["pNext"], meta_struct->pNext, json_options);
+
+        FieldToJson(args["pAllocator"], pAllocator, json_options);
+        HandleToJson(args["pPipelineCache"], pPipelineCache, json_options);
     });
 }
 
@@ -184,14 +199,13 @@ void VulkanExportJsonConsumerBase::Process_vkCmdPushConstants(const ApiCallInfo&
                                                               PointerDecoder<uint8_t>* pValues)
 {
     const JsonOptions& json_options = GetJsonOptions();
-    WriteApiCallToFile(call_info, "vkCmdPushConstants", [&](nlohmann::ordered_json& function) {
+    WriteApiCallToFile(call_info, "vkCmdPushConstants", [&](util::JsonValue& function) {
         auto& args = function[NameArgs()];
         HandleToJson(args["commandBuffer"], commandBuffer, json_options);
         HandleToJson(args["layout"], layout, json_options);
         FieldToJson(VkShaderStageFlags_t(), args["stageFlags"], stageFlags, json_options);
         FieldToJson(args["offset"], offset, json_options);
         FieldToJson(args["size"], size, json_options);
-        FieldToJson(args["pValues"], pValues, json_options);
         if (pValues->IsNull())
         {
             args["pValues"] = nullptr;
@@ -35,6 +35,7 @@
 
 #include <cstdio>
 #include <string>
+#include <unordered_map>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -52,6 +53,21 @@ class VulkanExportJsonConsumerBase : public VulkanConsumer
 
     bool IsValid() const { return writer_ && writer_->IsValid(); }
 
+    /// The submit and command indices continue from the values of the blocks that precede the first block processed
+    /// by the consumer. Setting them allows a consumer that starts part way through a capture file to produce the
+    /// same indices as a consumer that processed the whole file.
+    uint32_t GetSubmitIndex() const { return submit_index_; }
+    void     SetSubmitIndex(uint32_t submit_index) { submit_index_ = submit_index; }
+
+    const std::unordered_map<format::HandleId, uint32_t>& GetCommandBufferRecordIndices() const
+    {
+        return rec_cmd_index_;
+    }
+    void SetCommandBufferRecordIndices(const std::unordered_map<format::HandleId, uint32_t>& indices)
+    {
+        rec_cmd_index_ = indices;
+    }
+
     void Process_vkCmdBuildAccelerationStructuresIndirectKHR(
         const ApiCallInfo&                                                         call_info,
         format::HandleId                                                           commandBuffer,
@@ -134,9 +150,9 @@ class VulkanExportJsonConsumerBase : public VulkanConsumer
 
     const util::JsonOptions& GetJsonOptions() const { return writer_->GetOptions(); }
 
-    nlohmann::ordered_json& WriteBlockStart() { return writer_->WriteBlockStart(); }
+    util::JsonValue& WriteBlockStart() { return writer_->WriteBlockStart(); }
 
-    /// Output the current in-memory json tree to the destination file.
+    /// Finish the current block and pass it on to the destination file.
     void WriteBlockEnd() { writer_->WriteBlockEnd(); }
 
     // Wrappers for json field names allowing change without code gen and
@@ -163,7 +179,7 @@ class VulkanExportJsonConsumerBase : public VulkanConsumer
     /// @todo Make this field optional.
     constexpr const char* NameSubmitIndex() const { return "sub_index"; }
 
-    nlohmann::ordered_json& WriteApiCallStart(const ApiCallInfo& call_info, const std::string& command_name)
+    util::JsonValue& WriteApiCallStart(const ApiCallInfo& call_info, const std::string& command_name)
     {
         return writer_->WriteApiCallStart(call_info, command_name);
     }
@@ -175,7 +191,7 @@ class VulkanExportJsonConsumerBase : public VulkanConsumer
     inline void
     WriteApiCallToFile(const ApiCallInfo& call_info, const std::string& command_name, ToJsonFunctionType toJsonFunction)
     {
-        nlohmann::ordered_json& function = WriteApiCallStart(call_info, command_name);
+        util::JsonValue& function = WriteApiCallStart(call_info, command_name);
         toJsonFunction(function);
         WriteBlockEnd();
     }
@@ -0,0 +1,55 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "decode/vulkan_json_index_counter.h"
+#include "decode/value_decoder.h"
+#include "generated/generated_vulkan_json_consumer.h"
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+void VulkanJsonIndexCounter::DecodeFunctionCall(format::ApiCallId  call_id,
+                                                const ApiCallInfo& call_info,
+                                                const uint8_t*     parameter_buffer,
+                                                size_t             buffer_size)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(call_info);
+
+    if (VulkanExportJsonConsumer::IsSubmitIndexCall(call_id))
+    {
+        ++submit_index_;
+    }
+    else if (VulkanExportJsonConsumer::IsCommandIndexCall(call_id))
+    {
+        // The command buffer is the first parameter of the commands.
+        format::HandleId command_buffer = format::kNullHandleId;
+
+        if (ValueDecoder::DecodeHandleIdValue(parameter_buffer, buffer_size, &command_buffer) > 0)
+        {
+            ++rec_cmd_index_[command_buffer];
+        }
+    }
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
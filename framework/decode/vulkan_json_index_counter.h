@@ -0,0 +1,67 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef GFXRECON_DECODE_VULKAN_JSON_INDEX_COUNTER_H
+#define GFXRECON_DECODE_VULKAN_JSON_INDEX_COUNTER_H
+
+#include "format/format.h"
+#include "generated/generated_vulkan_decoder.h"
+#include "util/defines.h"
+
+#include <cstdint>
+#include <unordered_map>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Counts the submit and command indices that VulkanExportJsonConsumer writes for the processed blocks, without
+// decoding the call parameters or converting the calls. The counts can be used to start a consumer part way through a
+// capture file with the indices of the blocks that precede it.
+class VulkanJsonIndexCounter : public VulkanDecoder
+{
+  public:
+    VulkanJsonIndexCounter() {}
+
+    virtual ~VulkanJsonIndexCounter() override {}
+
+    virtual void DecodeFunctionCall(format::ApiCallId  call_id,
+                                    const ApiCallInfo& call_info,
+                                    const uint8_t*     parameter_buffer,
+                                    size_t             buffer_size) override;
+
+    uint32_t GetSubmitIndex() const { return submit_index_; }
+
+    const std::unordered_map<format::HandleId, uint32_t>& GetCommandBufferRecordIndices() const
+    {
+        return rec_cmd_index_;
+    }
+
+  private:
+    uint32_t                                       submit_index_{ 0 };
+    std::unordered_map<format::HandleId, uint32_t> rec_cmd_index_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_VULKAN_JSON_INDEX_COUNTER_H
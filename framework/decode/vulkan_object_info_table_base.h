@@ -27,12 +27,12 @@
 #include "decode/vulkan_object_info.h"
 #include "format/format.h"
 #include "util/defines.h"
+#include "util/dense_id_map.h"
 
 #include "vulkan/vulkan.h"
 
 #include <cassert>
 #include <functional>
-#include <unordered_map>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -53,7 +53,7 @@ class VulkanObjectInfoTableBase
 {
   protected:
     template <typename T>
-    void AddVkObjectInfo(T&& info, std::unordered_map<format::HandleId, T>* map)
+    void AddVkObjectInfo(T&& info, util::DenseIdMap<T>* map)
     {
         assert(map != nullptr);
 
@@ -66,24 +66,7 @@ class VulkanObjectInfoTableBase
 
         if ((info.capture_id != 0) && valid_handle)
         {
-            auto result = map->emplace(info.capture_id, std::forward<T>(info));
-
-            if (!result.second)
-            {
-                // There are two expected cases where a capture ID would already be in the map. The first case is for
-                // handles that are retrieved, such as VkPhysicalDevice, which can be processed more than once. For
-                // this case we a have a duplicate info structure with the same ID and handle value, and do not need
-                // to update the map entry. The existing entry may even contain additional info that would be lost if
-                // replaced with this newly created, default initialized, info structure. The second case is for
-                // temporary objects created during the trimmed file state setup. IDs may be reused when creating these
-                // temporary objects, creating a case where we have a new handle that is not a duplicate of the existing
-                // map entry. In this case, the map entry needs to be updated with the new object's info.
-                auto iter = result.first;
-                if (iter->second.handle != info.handle)
-                {
-                    iter->second = std::forward<T>(info);
-                }
-            }
+            InsertVkObjectInfo(std::forward<T>(info), map);
         }
     }
 
@@ -102,71 +85,57 @@ class VulkanObjectInfoTableBase
     // Note: the "dummy" template parameter is here for the sole purpose of working around a gcc issue which does
     // not allow full specialization in non-namespace scope (https://gcc.gnu.org/bugzilla/show_bug.cgi?id=85282)
     template <typename dummy>
-    void AddVkObjectInfo(VulkanSurfaceKHRInfo&& info, std::unordered_map<format::HandleId, VulkanSurfaceKHRInfo>* map)
+    void AddVkObjectInfo(VulkanSurfaceKHRInfo&& info, util::DenseIdMap<VulkanSurfaceKHRInfo>* map)
     {
         assert(map != nullptr);
 
         if (info.capture_id != 0)
         {
-            auto result = map->emplace(info.capture_id, std::forward<VulkanSurfaceKHRInfo>(info));
-
-            if (!result.second)
-            {
-                // There are two expected cases where a capture ID would already be in the map. The first case is for
-                // handles that are retrieved, such as VkPhysicalDevice, which can be processed more than once. For
-                // this case we a have a duplicate info structure with the same ID and handle value, and do not need
-                // to update the map entry. The existing entry may even contain additional info that would be lost if
-                // replaced with this newly created, default initialized, info structure. The second case is for
-                // temporary objects created during the trimmed file state setup. IDs may be reused when creating these
-                // temporary objects, creating a case where we have a new handle that is not a duplicate of the existing
-                // map entry. In this case, the map entry needs to be updated with the new object's info.
-                auto iter = result.first;
-                if (iter->second.handle != info.handle)
-                {
-                    iter->second = std::forward<VulkanSurfaceKHRInfo>(info);
-                }
-            }
+            InsertVkObjectInfo(std::forward<VulkanSurfaceKHRInfo>(info), map);
         }
     }
 
     template <typename T>
-    const T* GetVkObjectInfo(format::HandleId id, const std::unordered_map<format::HandleId, T>* map) const
+    const T* GetVkObjectInfo(format::HandleId id, const util::DenseIdMap<T>* map) const
     {
         assert(map != nullptr);
 
-        const T* object_info = nullptr;
-
-        if (id != 0)
-        {
-            const auto entry = map->find(id);
-
-            if (entry != map->end())
-            {
-                object_info = &entry->second;
-            }
-        }
-
-        return object_info;
+        return (id != 0) ? map->Find(id) : nullptr;
     }
 
     template <typename T>
-    T* GetVkObjectInfo(format::HandleId id, std::unordered_map<format::HandleId, T>* map)
+    T* GetVkObjectInfo(format::HandleId id, util::DenseIdMap<T>* map)
     {
         assert(map != nullptr);
 
-        T* object_info = nullptr;
+        return (id != 0) ? map->Find(id) : nullptr;
+    }
 
-        if (id != 0)
-        {
-            auto entry = map->find(id);
+  private:
+    template <typename T>
+    void InsertVkObjectInfo(T&& info, util::DenseIdMap<T>* map)
+    {
+        T* existing_info = map->Find(info.capture_id);
 
-            if (entry != map->end())
+        if (existing_info == nullptr)
+        {
+            map->Insert(info.capture_id, std::forward<T>(info));
+        }
+        else
+        {
+            // There are two expected cases where a capture ID would already be in the map. The first case is for
+            // handles that are retrieved, such as VkPhysicalDevice, which can be processed more than once. For
+            // this case we a have a duplicate info structure with the same ID and handle value, and do not need
+            // to update the map entry. The existing entry may even contain additional info that would be lost if
+            // replaced with this newly created, default initialized, info structure. The second case is for
+            // temporary objects created during the trimmed file state setup. IDs may be reused when creating these
+            // temporary objects, creating a case where we have a new handle that is not a duplicate of the existing
+            // map entry. In this case, the map entry needs to be updated with the new object's info.
+            if (existing_info->handle != info.handle)
             {
-                object_info = &entry->second;
+                (*existing_info) = std::forward<T>(info);
             }
         }
-
-        return object_info;
     }
 };
 
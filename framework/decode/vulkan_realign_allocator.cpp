@@ -319,6 +319,20 @@ VkResult VulkanRealignAllocator::WriteMappedMemoryRange(MemoryData     allocator
     return result;
 }
 
+uint8_t* VulkanRealignAllocator::GetMappedMemoryWritePointer(MemoryData allocator_data,
+                                                             uint64_t   offset,
+                                                             uint64_t   size,
+                                                             bool       needs_read_access)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(allocator_data);
+    GFXRECON_UNREFERENCED_PARAMETER(offset);
+    GFXRECON_UNREFERENCED_PARAMETER(size);
+    GFXRECON_UNREFERENCED_PARAMETER(needs_read_access);
+
+    // Writes are redistributed to the realigned resource offsets, so the data cannot be written in place.
+    return nullptr;
+}
+
 // Util function to find the matching offset with the resources offsets.
 VkDeviceSize VulkanRealignAllocator::FindMatchingResourceOffset(const TrackedVkDeviceMemoryInfo* tracked_memory_info,
                                                                 VkDeviceSize                     offset) const
@@ -100,6 +100,11 @@ class VulkanRealignAllocator : public VulkanDefaultAllocator
     virtual VkResult
     WriteMappedMemoryRange(MemoryData allocator_data, uint64_t offset, uint64_t size, const uint8_t* data) override;
 
+    virtual uint8_t* GetMappedMemoryWritePointer(MemoryData allocator_data,
+                                                 uint64_t   offset,
+                                                 uint64_t   size,
+                                                 bool       needs_read_access) override;
+
   private:
     // Util function to find the matching offset with the resources offsets.
     VkDeviceSize FindMatchingResourceOffset(const TrackedVkDeviceMemoryInfo* tracked_memory_info,
@@ -275,6 +275,7 @@ void VulkanRebindAllocator::DestroyBuffer(VkBuffer                     buffer,
         if (memory_alloc_info != nullptr)
         {
             memory_alloc_info->original_buffers.erase(buffer);
+            RemoveBoundResource(memory_alloc_info, resource_alloc_info);
         }
 
         if (resource_alloc_info->mapped_pointer != nullptr)
@@ -338,6 +339,7 @@ void VulkanRebindAllocator::DestroyImage(VkImage                      image,
         if (memory_alloc_info != nullptr)
         {
             memory_alloc_info->original_images.erase(image);
+            RemoveBoundResource(memory_alloc_info, resource_alloc_info);
         }
 
         if (resource_alloc_info->mapped_pointer != nullptr)
@@ -406,6 +408,7 @@ void VulkanRebindAllocator::DestroyVideoSession(VkVideoSessionKHR            ses
             if (memory_alloc_info != nullptr)
             {
                 memory_alloc_info->original_sessions.erase(session);
+                RemoveBoundResource(memory_alloc_info, resource_alloc_info);
             }
 
             if (resource_alloc_info->allocation != VK_NULL_HANDLE)
@@ -587,6 +590,7 @@ VkResult VulkanRebindAllocator::BindBufferMemory(VkBuffer
                 }
 
                 memory_alloc_info->original_buffers.insert(std::make_pair(buffer, resource_alloc_info));
+                AddBoundResource(memory_alloc_info, resource_alloc_info);
 
                 if (memory_alloc_info->original_content != nullptr)
                 {
@@ -684,6 +688,7 @@ VkResult VulkanRebindAllocator::BindBufferMemory2(uint32_t
                         }
 
                         memory_alloc_info->original_buffers.insert(std::make_pair(buffer, resource_alloc_info));
+                        AddBoundResource(memory_alloc_info, resource_alloc_info);
 
                         bind_memory_properties[i] = property_flags;
                     }
@@ -755,6 +760,7 @@ VkResult VulkanRebindAllocator::BindImageMemory(VkImage
                 }
 
                 memory_alloc_info->original_images.insert(std::make_pair(image, resource_alloc_info));
+                AddBoundResource(memory_alloc_info, resource_alloc_info);
 
                 if (memory_alloc_info->original_content != nullptr)
                 {
@@ -853,6 +859,7 @@ VkResult VulkanRebindAllocator::BindImageMemory2(uint32_t                     bi
                         }
 
                         memory_alloc_info->original_images.insert(std::make_pair(image, resource_alloc_info));
+                        AddBoundResource(memory_alloc_info, resource_alloc_info);
 
                         bind_memory_properties[i] = property_flags;
                     }
@@ -1015,6 +1022,7 @@ VkResult VulkanRebindAllocator::BindVideoSessionMemory(VkVideoSessionKHR
                         }
 
                         memory_alloc_info->original_sessions.insert(std::make_pair(video_session, resource_alloc_info));
+                        AddBoundResource(memory_alloc_info, resource_alloc_info);
 
                         bind_memory_properties[mem_index] = property_flags;
                     }
@@ -1110,20 +1118,12 @@ VkResult VulkanRebindAllocator::WriteMappedMemoryRange(MemoryData     allocator_
             VkDeviceSize write_end   = write_start + size;
 
             // Copy to the resources that were bound to this range at capture.
-            for (const auto& entry : memory_alloc_info->original_buffers)
-            {
-                UpdateBoundResource(entry.second, write_start, write_end, data);
-            }
-
-            for (const auto& entry : memory_alloc_info->original_images)
-            {
-                UpdateBoundResource(entry.second, write_start, write_end, data);
-            }
-
-            for (const auto& entry : memory_alloc_info->original_sessions)
-            {
-                UpdateBoundResource(entry.second, write_start, write_end, data);
-            }
+            memory_alloc_info->bound_resources.VisitOverlapping(
+                write_start,
+                write_end,
+                [&](VkDeviceSize, VkDeviceSize, ResourceAllocInfo* resource_alloc_info) {
+                    UpdateBoundResource(resource_alloc_info, write_start, write_end, data);
+                });
 
             result = VK_SUCCESS;
         }
@@ -1397,6 +1397,23 @@ void VulkanRebindAllocator::WriteBoundResourceStaging(
     vmaDestroyBuffer(allocator_, staging_buf, staging_alloc);
 }
 
+void VulkanRebindAllocator::AddBoundResource(MemoryAllocInfo* memory_alloc_info, ResourceAllocInfo* resource_alloc_info)
+{
+    assert((memory_alloc_info != nullptr) && (resource_alloc_info != nullptr));
+
+    // The range matches the one used by TranslateMemoryRange to determine the overlap between writes and resources.
+    VkDeviceSize start = resource_alloc_info->original_offset;
+    memory_alloc_info->bound_resources.Insert(start, start + resource_alloc_info->size, resource_alloc_info);
+}
+
+void VulkanRebindAllocator::RemoveBoundResource(MemoryAllocInfo*   memory_alloc_info,
+                                                ResourceAllocInfo* resource_alloc_info)
+{
+    assert((memory_alloc_info != nullptr) && (resource_alloc_info != nullptr));
+
+    memory_alloc_info->bound_resources.Erase(resource_alloc_info->original_offset, resource_alloc_info);
+}
+
 void VulkanRebindAllocator::WriteBoundResource(ResourceAllocInfo* resource_alloc_info,
                                                VkDeviceSize       src_offset,
                                                VkDeviceSize       dst_offset,
@@ -1561,29 +1578,16 @@ VkResult VulkanRebindAllocator::UpdateMappedMemoryRanges(
                 VkDeviceSize range_start = memory_ranges[i].offset;
                 VkDeviceSize range_end   = range_start + size;
 
-                for (const auto& entry : memory_alloc_info->original_buffers)
-                {
-                    if (UpdateMappedMemoryRange(entry.second, range_start, range_end, update_func) != VK_SUCCESS)
-                    {
-                        result = VK_ERROR_MEMORY_MAP_FAILED;
-                    }
-                }
-
-                for (const auto& entry : memory_alloc_info->original_images)
-                {
-                    if (UpdateMappedMemoryRange(entry.second, range_start, range_end, update_func) != VK_SUCCESS)
-                    {
-                        result = VK_ERROR_MEMORY_MAP_FAILED;
-                    }
-                }
-
-                for (const auto& entry : memory_alloc_info->original_sessions)
-                {
-                    if (UpdateMappedMemoryRange(entry.second, range_start, range_end, update_func) != VK_SUCCESS)
-                    {
-                        result = VK_ERROR_MEMORY_MAP_FAILED;
-                    }
-                }
+                memory_alloc_info->bound_resources.VisitOverlapping(
+                    range_start,
+                    range_end,
+                    [&](VkDeviceSize, VkDeviceSize, ResourceAllocInfo* resource_alloc_info) {
+                        if (UpdateMappedMemoryRange(resource_alloc_info, range_start, range_end, update_func) !=
+                            VK_SUCCESS)
+                        {
+                            result = VK_ERROR_MEMORY_MAP_FAILED;
+                        }
+                    });
             }
         }
     }
@@ -25,6 +25,7 @@
 
 #include "decode/vulkan_resource_allocator.h"
 #include "util/defines.h"
+#include "util/interval_tree.h"
 
 #include "vk_mem_alloc.h"
 
@@ -355,9 +356,17 @@ class VulkanRebindAllocator : public VulkanResourceAllocator
         std::unordered_map<VkBuffer, ResourceAllocInfo*> original_buffers;
         std::unordered_map<VkImage, ResourceAllocInfo*>  original_images;
         std::unordered_map<VkVideoSessionKHR, ResourceAllocInfo*> original_sessions;
+
+        // Bound resources indexed by their original bind range, so that mapped memory writes only visit the resources
+        // that overlap with the written range.
+        util::IntervalTree<VkDeviceSize, ResourceAllocInfo*> bound_resources;
     };
 
   private:
+    static void AddBoundResource(MemoryAllocInfo* memory_alloc_info, ResourceAllocInfo* resource_alloc_info);
+
+    static void RemoveBoundResource(MemoryAllocInfo* memory_alloc_info, ResourceAllocInfo* resource_alloc_info);
+
     void WriteBoundResource(ResourceAllocInfo* resource_alloc_info,
                             VkDeviceSize       src_offset,
                             VkDeviceSize       dst_offset,
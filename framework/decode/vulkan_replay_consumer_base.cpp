@@ -309,6 +309,25 @@ void VulkanReplayConsumerBase::ProcessDisplayMessageCommand(const std::string& m
     GFXRECON_LOG_INFO("Trace Message: %s", message.c_str());
 }
 
+uint8_t* VulkanReplayConsumerBase::GetFillMemoryCommandDestination(uint64_t memory_id,
+                                                                   uint64_t offset,
+                                                                   uint64_t size,
+                                                                   bool     needs_read_access)
+{
+    uint8_t* destination = nullptr;
+
+    // Hardware buffer backed memory is not tracked by the allocator and always takes the staged path.
+    const VulkanDeviceMemoryInfo* memory_info = object_info_table_->GetVkDeviceMemoryInfo(memory_id);
+
+    if ((memory_info != nullptr) && (memory_info->allocator != nullptr))
+    {
+        destination = memory_info->allocator->GetMappedMemoryWritePointer(
+            memory_info->allocator_data, offset, size, needs_read_access);
+    }
+
+    return destination;
+}
+
 void VulkanReplayConsumerBase::ProcessFillMemoryCommand(uint64_t       memory_id,
                                                         uint64_t       offset,
                                                         uint64_t       size,
@@ -808,6 +827,17 @@ void VulkanReplayConsumerBase::ProcessBeginResourceInitCommand(format::HandleId
 
         device_info->resource_initializer = std::make_unique<VulkanResourceInitializer>(
             device_info, max_copy_size, properties, have_shader_stencil_write, allocator, table);
+
+        // Record the uploads for all resources up to the end of the resource initialization block in shared command
+        // buffers, instead of draining the queue after each one.  The initializer falls back to uploading resources
+        // individually if the batch staging ring cannot be created.  Only the resource memory block, which reports a
+        // staging copy size, is batched: the acceleration structure block reports no copy size and interleaves the
+        // buffer uploads with builds that read the buffers and with the destruction of the buffers, so its uploads
+        // must complete immediately.
+        if (max_copy_size > 0)
+        {
+            device_info->resource_initializer->BeginBatch();
+        }
     }
 }
 
@@ -817,6 +847,16 @@ void VulkanReplayConsumerBase::ProcessEndResourceInitCommand(format::HandleId de
 
     if ((device_info != nullptr) && (device_info->resource_initializer != nullptr))
     {
+        VkResult result = device_info->resource_initializer->EndBatch();
+
+        if (result != VK_SUCCESS)
+        {
+            GFXRECON_LOG_WARNING("State snapshot batched resource upload failed for VkDevice object (ID = %" PRIu64
+                                 ") with error %s",
+                                 device_id,
+                                 util::ToString<VkResult>(result).c_str());
+        }
+
         device_info->resource_initializer.reset();
     }
 }
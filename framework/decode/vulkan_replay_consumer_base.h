@@ -98,6 +98,11 @@ class VulkanReplayConsumerBase : public VulkanConsumer
     virtual void
     ProcessFillMemoryCommand(uint64_t memory_id, uint64_t offset, uint64_t size, const uint8_t* data) override;
 
+    virtual uint8_t* GetFillMemoryCommandDestination(uint64_t memory_id,
+                                                     uint64_t offset,
+                                                     uint64_t size,
+                                                     bool     needs_read_access) override;
+
     virtual void ProcessResizeWindowCommand(format::HandleId surface_id, uint32_t width, uint32_t height) override;
 
     virtual void ProcessResizeWindowCommand2(format::HandleId surface_id,
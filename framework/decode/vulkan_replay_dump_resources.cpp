@@ -76,6 +76,7 @@ VulkanReplayDumpResourcesBase::VulkanReplayDumpResourcesBase(const VulkanReplayO
                                                                *object_info_table,
                                                                options,
                                                                dump_json_,
+                                                               image_writer_queue_,
                                                                capture_filename));
         }
 
@@ -93,6 +94,7 @@ VulkanReplayDumpResourcesBase::VulkanReplayDumpResourcesBase(const VulkanReplayO
                                               *object_info_table_,
                                               options,
                                               dump_json_,
+                                              image_writer_queue_,
                                               capture_filename));
         }
     }
@@ -105,6 +107,7 @@ VulkanReplayDumpResourcesBase::~VulkanReplayDumpResourcesBase()
 
 void VulkanReplayDumpResourcesBase::Release()
 {
+    image_writer_queue_.Flush();
     dump_json_.Close();
     draw_call_contexts.clear();
     dispatch_ray_contexts.clear();
@@ -342,6 +342,9 @@ class VulkanReplayDumpResourcesBase
 
     std::unordered_set<uint64_t> QueueSubmit_indices_;
 
+    // Writes the dumped image files. Declared before the dumping contexts, which reference it.
+    util::ImageWriterQueue image_writer_queue_;
+
     // One per BeginCommandBuffer index
     std::unordered_map<uint64_t, DrawCallsDumpingContext>         draw_call_contexts;
     std::unordered_map<uint64_t, DispatchTraceRaysDumpingContext> dispatch_ray_contexts;
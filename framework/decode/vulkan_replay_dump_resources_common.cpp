@@ -30,6 +30,7 @@
 #include "Vulkan-Utility-Libraries/vk_format_utils.h"
 
 #include <algorithm>
+#include <memory>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -444,6 +445,7 @@ VkResult DumpImageToFile(const VulkanImageInfo*             image_info,
                          float                              scale,
                          std::vector<bool>&                 scaling_supported,
                          util::ScreenshotFormat             image_file_format,
+                         util::ImageWriterQueue&            image_writer_queue,
                          bool                               dump_all_subresources,
                          bool                               dump_image_raw,
                          VkImageLayout                      layout,
@@ -533,6 +535,13 @@ VkResult DumpImageToFile(const VulkanImageInfo*             image_info,
         const util::imagewriter::DataFormats image_writer_format = VkFormatToImageWriterDataFormat(dst_format);
         assert(image_writer_format != util::imagewriter::DataFormats::kFormat_UNSPECIFIED);
 
+        // Image files are encoded and written by the image writer queue's worker threads, which share the data read
+        // back for the aspect until all of its files have been written.
+        const std::shared_ptr<const std::vector<uint8_t>> image_data =
+            std::make_shared<const std::vector<uint8_t>>(std::move(data));
+        const bool            has_alpha   = vkuFormatHasAlpha(image_info->format);
+        const VKU_FORMAT_INFO format_info = vkuGetFormatInfo(image_info->format);
+
         if ((image_info->level_count == 1 && image_info->layer_count == 1) || !dump_all_subresources)
         {
             std::string filename = filenames[f++];
@@ -555,44 +564,61 @@ VkResult DumpImageToFile(const VulkanImageInfo*             image_info,
                     scaled_extent = image_info->extent;
                 }
 
-                const uint32_t texel_size = vkuFormatElementSizeWithAspect(dst_format, aspects[i]);
-                const uint32_t stride     = texel_size * scaled_extent.width;
+                const uint32_t texel_size       = vkuFormatElementSizeWithAspect(dst_format, aspects[i]);
+                const uint32_t stride           = texel_size * scaled_extent.width;
+                const uint64_t subresource_size = subresource_sizes[0];
 
                 if (output_image_format == KFormatAstc)
                 {
-                    VKU_FORMAT_INFO format_info = vkuGetFormatInfo(image_info->format);
-
-                    util::imagewriter::WriteAstcImage(filename,
-                                                      scaled_extent.width,
-                                                      scaled_extent.width,
-                                                      1,
-                                                      format_info.block_extent.width,
-                                                      format_info.block_extent.height,
-                                                      format_info.block_extent.depth,
-                                                      data.data(),
-                                                      subresource_sizes[0]);
+                    image_writer_queue.Post([filename, scaled_extent, format_info, image_data, subresource_size]() {
+                        util::imagewriter::WriteAstcImage(filename,
+                                                          scaled_extent.width,
+                                                          scaled_extent.width,
+                                                          1,
+                                                          format_info.block_extent.width,
+                                                          format_info.block_extent.height,
+                                                          format_info.block_extent.depth,
+                                                          image_data->data(),
+                                                          subresource_size);
+                    });
                 }
                 else if (output_image_format == kFormatBMP)
                 {
-                    util::imagewriter::WriteBmpImage(filename,
-                                                     scaled_extent.width,
-                                                     scaled_extent.height,
-                                                     subresource_sizes[0],
-                                                     data.data(),
-                                                     stride,
-                                                     image_writer_format,
-                                                     vkuFormatHasAlpha(image_info->format));
+                    image_writer_queue.Post([filename,
+                                             scaled_extent,
+                                             image_data,
+                                             subresource_size,
+                                             stride,
+                                             image_writer_format,
+                                             has_alpha]() {
+                        util::imagewriter::WriteBmpImage(filename,
+                                                         scaled_extent.width,
+                                                         scaled_extent.height,
+                                                         subresource_size,
+                                                         image_data->data(),
+                                                         stride,
+                                                         image_writer_format,
+                                                         has_alpha);
+                    });
                 }
                 else if (output_image_format == KFormatPNG)
                 {
-                    util::imagewriter::WritePngImage(filename,
-                                                     scaled_extent.width,
-                                                     scaled_extent.height,
-                                                     subresource_sizes[0],
-                                                     data.data(),
-                                                     stride,
-                                                     image_writer_format,
-                                                     vkuFormatHasAlpha(image_info->format));
+                    image_writer_queue.Post([filename,
+                                             scaled_extent,
+                                             image_data,
+                                             subresource_size,
+                                             stride,
+                                             image_writer_format,
+                                             has_alpha]() {
+                        util::imagewriter::WritePngImage(filename,
+                                                         scaled_extent.width,
+                                                         scaled_extent.height,
+                                                         subresource_size,
+                                                         image_data->data(),
+                                                         stride,
+                                                         image_writer_format,
+                                                         has_alpha);
+                    });
                 }
             }
             else
@@ -601,7 +627,9 @@ VkResult DumpImageToFile(const VulkanImageInfo*             image_info,
                     "%s format is not handled. Images with that format will be dump as a plain binary file.",
                     util::ToString<VkFormat>(image_info->format).c_str());
 
-                util::bufferwriter::WriteBuffer(filename, data.data(), data.size());
+                image_writer_queue.Post([filename, image_data]() {
+                    util::bufferwriter::WriteBuffer(filename, image_data->data(), image_data->size());
+                });
             }
         }
         else
@@ -615,9 +643,9 @@ VkResult DumpImageToFile(const VulkanImageInfo*             image_info,
                     if (aspects[i] == VK_IMAGE_ASPECT_STENCIL_BIT)
                         continue;
 
-                    const uint32_t sub_res_idx = mip * image_info->layer_count + layer;
-                    const void*    data_offset = reinterpret_cast<const void*>(
-                        reinterpret_cast<const uint8_t*>(data.data()) + subresource_offsets[sub_res_idx]);
+                    const uint32_t sub_res_idx      = mip * image_info->layer_count + layer;
+                    const uint64_t data_offset      = subresource_offsets[sub_res_idx];
+                    const uint64_t subresource_size = subresource_sizes[sub_res_idx];
 
                     if (output_image_format != KFormatRaw)
                     {
@@ -642,37 +670,54 @@ VkResult DumpImageToFile(const VulkanImageInfo*             image_info,
 
                         if (output_image_format == KFormatAstc)
                         {
-                            VKU_FORMAT_INFO format_info = vkuGetFormatInfo(image_info->format);
-
-                            util::imagewriter::WriteAstcImage(filename,
-                                                              scaled_extent.width,
-                                                              scaled_extent.width,
-                                                              1,
-                                                              format_info.block_extent.width,
-                                                              format_info.block_extent.height,
-                                                              format_info.block_extent.depth,
-                                                              data.data(),
-                                                              subresource_sizes[sub_res_idx]);
+                            image_writer_queue.Post(
+                                [filename, scaled_extent, format_info, image_data, subresource_size]() {
+                                    util::imagewriter::WriteAstcImage(filename,
+                                                                      scaled_extent.width,
+                                                                      scaled_extent.width,
+                                                                      1,
+                                                                      format_info.block_extent.width,
+                                                                      format_info.block_extent.height,
+                                                                      format_info.block_extent.depth,
+                                                                      image_data->data(),
+                                                                      subresource_size);
+                                });
                         }
                         else if (output_image_format == kFormatBMP)
                         {
-                            util::imagewriter::WriteBmpImage(filename,
-                                                             scaled_extent.width,
-                                                             scaled_extent.height,
-                                                             subresource_sizes[sub_res_idx],
-                                                             data_offset,
-                                                             stride,
-                                                             image_writer_format);
+                            image_writer_queue.Post([filename,
+                                                     scaled_extent,
+                                                     image_data,
+                                                     data_offset,
+                                                     subresource_size,
+                                                     stride,
+                                                     image_writer_format]() {
+                                util::imagewriter::WriteBmpImage(filename,
+                                                                 scaled_extent.width,
+                                                                 scaled_extent.height,
+                                                                 subresource_size,
+                                                                 image_data->data() + data_offset,
+                                                                 stride,
+                                                                 image_writer_format);
+                            });
                         }
                         else if (output_image_format == KFormatPNG)
                         {
-                            util::imagewriter::WritePngImage(filename,
-                                                             scaled_extent.width,
-                                                             scaled_extent.height,
-                                                             subresource_sizes[sub_res_idx],
-                                                             data_offset,
-                                                             stride,
-                                                             image_writer_format);
+                            image_writer_queue.Post([filename,
+                                                     scaled_extent,
+                                                     image_data,
+                                                     data_offset,
+                                                     subresource_size,
+                                                     stride,
+                                                     image_writer_format]() {
+                                util::imagewriter::WritePngImage(filename,
+                                                                 scaled_extent.width,
+                                                                 scaled_extent.height,
+                                                                 subresource_size,
+                                                                 image_data->data() + data_offset,
+                                                                 stride,
+                                                                 image_writer_format);
+                            });
                         }
                     }
                     else
@@ -681,7 +726,10 @@ VkResult DumpImageToFile(const VulkanImageInfo*             image_info,
                             "%s format is not handled. Images with that format will be dump as a plain binary file.",
                             util::ToString<VkFormat>(image_info->format).c_str());
 
-                        util::bufferwriter::WriteBuffer(filename, data_offset, subresource_sizes[sub_res_idx]);
+                        image_writer_queue.Post([filename, image_data, data_offset, subresource_size]() {
+                            util::bufferwriter::WriteBuffer(
+                                filename, image_data->data() + data_offset, subresource_size);
+                        });
                     }
                 }
             }
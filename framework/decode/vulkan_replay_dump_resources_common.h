@@ -27,6 +27,7 @@
 #include "vulkan/vulkan_core.h"
 #include "util/defines.h"
 #include "util/image_writer.h"
+#include "util/image_writer_queue.h"
 #include "util/options.h"
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -115,6 +116,7 @@ VkResult DumpImageToFile(const VulkanImageInfo*             image_info,
                          float                              scale,
                          std::vector<bool>&                 scaling_supported,
                          util::ScreenshotFormat             image_file_format,
+                         util::ImageWriterQueue&            image_writer_queue,
                          bool                               dump_all_subresources = false,
                          bool                               dump_image_raw        = false,
                          VkImageLayout                      layout                = VK_IMAGE_LAYOUT_MAX_ENUM,
@@ -53,6 +53,7 @@ DispatchTraceRaysDumpingContext::DispatchTraceRaysDumpingContext(const std::vect
                                                                  CommonObjectInfoTable&         object_info_table,
                                                                  const VulkanReplayOptions&     options,
                                                                  VulkanReplayDumpResourcesJson& dump_json,
+                                                                 util::ImageWriterQueue&        image_writer_queue,
                                                                  std::string                    capture_filename) :
     original_command_buffer_info(nullptr),
     DR_command_buffer(VK_NULL_HANDLE), dispatch_indices(dispatch_indices),
@@ -61,7 +62,7 @@ DispatchTraceRaysDumpingContext::DispatchTraceRaysDumpingContext(const std::vect
     image_file_format(options.dump_resources_image_format), dump_resources_scale(options.dump_resources_scale),
     device_table(nullptr), parent_device(VK_NULL_HANDLE), instance_table(nullptr), object_info_table(object_info_table),
     replay_device_phys_mem_props(nullptr), current_dispatch_index(0), current_trace_rays_index(0), dump_json(dump_json),
-    output_json_per_command(options.dump_resources_json_per_command),
+    image_writer_queue(image_writer_queue), output_json_per_command(options.dump_resources_json_per_command),
     dump_immutable_resources(options.dump_resources_dump_immutable_resources),
     dump_all_image_subresources(options.dump_resources_dump_all_image_subresources), capture_filename(capture_filename),
     reached_end_command_buffer(false), dump_images_raw(options.dump_resources_dump_raw_images)
@@ -1136,6 +1137,7 @@ VkResult DispatchTraceRaysDumpingContext::DumpMutableResources(uint64_t bcb_inde
                                            dump_resources_scale,
                                            scaling_supported,
                                            image_file_format,
+                                           image_writer_queue,
                                            false,
                                            dump_images_raw,
                                            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
@@ -1254,6 +1256,7 @@ VkResult DispatchTraceRaysDumpingContext::DumpMutableResources(uint64_t bcb_inde
                                        dump_resources_scale,
                                        scaling_supported,
                                        image_file_format,
+                                       image_writer_queue,
                                        false,
                                        dump_images_raw,
                                        VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
@@ -1747,6 +1750,7 @@ VkResult DispatchTraceRaysDumpingContext::DumpImmutableDescriptors(uint64_t qs_i
                                        dump_resources_scale,
                                        scaling_supported,
                                        image_file_format,
+                                       image_writer_queue,
                                        dump_all_image_subresources,
                                        dump_images_raw);
         if (res != VK_SUCCESS)
@@ -51,6 +51,7 @@ class DispatchTraceRaysDumpingContext
                                     CommonObjectInfoTable&         object_info_table,
                                     const VulkanReplayOptions&     options,
                                     VulkanReplayDumpResourcesJson& dump_json,
+                                    util::ImageWriterQueue&        image_writer_queue,
                                     std::string                    capture_filename);
 
     ~DispatchTraceRaysDumpingContext();
@@ -200,6 +201,7 @@ class DispatchTraceRaysDumpingContext
     util::ScreenshotFormat         image_file_format;
     float                          dump_resources_scale;
     VulkanReplayDumpResourcesJson& dump_json;
+    util::ImageWriterQueue&        image_writer_queue;
     bool                           output_json_per_command;
     bool                           dump_immutable_resources;
     bool                           dump_all_image_subresources;
@@ -59,6 +59,7 @@ DrawCallsDumpingContext::DrawCallsDumpingContext(const std::vector<uint64_t>&
                                                  CommonObjectInfoTable&                    object_info_table,
                                                  const VulkanReplayOptions&                options,
                                                  VulkanReplayDumpResourcesJson&            dump_json,
+                                                 util::ImageWriterQueue&                   image_writer_queue,
                                                  std::string                               capture_filename) :
     original_command_buffer_info(nullptr),
     current_cb_index(0), dc_indices(dc_indices), RP_indices(rp_indices), active_renderpass(nullptr),
@@ -67,7 +68,7 @@ DrawCallsDumpingContext::DrawCallsDumpingContext(const std::vector<uint64_t>&
     device_table(nullptr), instance_table(nullptr), object_info_table(object_info_table),
     replay_device_phys_mem_props(nullptr), dump_resource_path(options.dump_resources_output_dir),
     image_file_format(options.dump_resources_image_format), dump_resources_scale(options.dump_resources_scale),
-    dump_json(dump_json), dump_depth(options.dump_resources_dump_depth),
+    dump_json(dump_json), image_writer_queue(image_writer_queue), dump_depth(options.dump_resources_dump_depth),
     color_attachment_to_dump(options.dump_resources_color_attachment_index),
     dump_vertex_index_buffers(options.dump_resources_dump_vertex_index_buffer),
     output_json_per_command(options.dump_resources_json_per_command),
@@ -1717,6 +1718,7 @@ VkResult DrawCallsDumpingContext::DumpRenderTargetAttachments(
                                        dump_resources_scale,
                                        scaling_supported,
                                        image_file_format,
+                                       image_writer_queue,
                                        dump_all_image_subresources,
                                        dump_images_raw,
                                        VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
@@ -1794,6 +1796,7 @@ VkResult DrawCallsDumpingContext::DumpRenderTargetAttachments(
                                        dump_resources_scale,
                                        scaling_supported,
                                        image_file_format,
+                                       image_writer_queue,
                                        dump_all_image_subresources,
                                        dump_images_raw,
                                        VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
@@ -2083,6 +2086,7 @@ DrawCallsDumpingContext::DumpImmutableDescriptors(uint64_t qs_index, uint64_t bc
                                        dump_resources_scale,
                                        scaling_supported,
                                        image_file_format,
+                                       image_writer_queue,
                                        dump_all_image_subresources,
                                        dump_images_raw);
         if (res != VK_SUCCESS)
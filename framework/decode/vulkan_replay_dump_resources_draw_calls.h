@@ -49,6 +49,7 @@ class DrawCallsDumpingContext
                             CommonObjectInfoTable&                    object_info_table,
                             const VulkanReplayOptions&                options,
                             VulkanReplayDumpResourcesJson&            dump_json,
+                            util::ImageWriterQueue&                   image_writer_queue,
                             std::string                               capture_filename);
 
     ~DrawCallsDumpingContext();
@@ -268,6 +269,7 @@ class DrawCallsDumpingContext
     util::ScreenshotFormat             image_file_format;
     float                              dump_resources_scale;
     VulkanReplayDumpResourcesJson&     dump_json;
+    util::ImageWriterQueue&            image_writer_queue;
     bool                               dump_depth;
     int32_t                            color_attachment_to_dump;
     bool                               dump_vertex_index_buffers;
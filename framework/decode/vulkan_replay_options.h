@@ -101,7 +101,8 @@ struct VulkanReplayOptions : public ReplayOptions
     bool  dump_resources_dump_all_image_subresources{ false };
     bool  dump_resources_dump_raw_images{ false };
 
-    bool preload_measurement_range{ false };
+    bool     preload_measurement_range{ false };
+    uint32_t measurement_loop_count{ 1 };
 };
 
 GFXRECON_END_NAMESPACE(decode)
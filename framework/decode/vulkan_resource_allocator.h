@@ -209,6 +209,23 @@ class VulkanResourceAllocator
     virtual VkResult
     WriteMappedMemoryRange(MemoryData allocator_data, uint64_t offset, uint64_t size, const uint8_t* data) = 0;
 
+    // Returns a pointer that replay data for the specified mapped range can be written to directly, allowing the data
+    // to be read or decompressed in place without an intermediate copy. The same pointer must still be passed to
+    // WriteMappedMemoryRange afterwards. Returns nullptr when the allocator requires the data to be staged, in which
+    // case the caller should fall back to WriteMappedMemoryRange with its own buffer. When needs_read_access is true,
+    // the caller intends to read back data it has written, which is only efficient for host cached memory.
+    virtual uint8_t* GetMappedMemoryWritePointer(MemoryData allocator_data,
+                                                 uint64_t   offset,
+                                                 uint64_t   size,
+                                                 bool       needs_read_access)
+    {
+        GFXRECON_UNREFERENCED_PARAMETER(allocator_data);
+        GFXRECON_UNREFERENCED_PARAMETER(offset);
+        GFXRECON_UNREFERENCED_PARAMETER(size);
+        GFXRECON_UNREFERENCED_PARAMETER(needs_read_access);
+        return nullptr;
+    }
+
     virtual void ReportAllocateMemoryIncompatibility(const VkMemoryAllocateInfo* allocate_info) = 0;
 
     virtual void ReportBindBufferIncompatibility(VkBuffer     buffer,
@@ -25,10 +25,12 @@
 
 #include "decode/copy_shaders.h"
 #include "decode/decoder_util.h"
+#include "util/logging.h"
 #include "util/platform.h"
 
 #include <algorithm>
 #include <cassert>
+#include <cinttypes>
 #include <limits>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -44,7 +46,10 @@ VulkanResourceInitializer::VulkanResourceInitializer(const VulkanDeviceInfo*
     staging_memory_(VK_NULL_HANDLE), staging_memory_data_(0), staging_buffer_(VK_NULL_HANDLE), staging_buffer_data_(0),
     draw_sampler_(VK_NULL_HANDLE), draw_pool_(VK_NULL_HANDLE), draw_set_layout_(VK_NULL_HANDLE),
     draw_set_(VK_NULL_HANDLE), max_copy_size_(max_copy_size), have_shader_stencil_write_(have_shader_stencil_write),
-    resource_allocator_(resource_allocator), device_table_(device_table), device_info_(device_info)
+    resource_allocator_(resource_allocator), device_table_(device_table), device_info_(device_info),
+    batch_active_(false), ring_memory_(VK_NULL_HANDLE), ring_memory_data_(0), ring_buffer_(VK_NULL_HANDLE),
+    ring_buffer_data_(0), ring_data_(nullptr), ring_size_(0), ring_offset_(0), ring_coherent_(false),
+    batch_upload_count_(0), batch_flush_count_(0)
 {
     assert((device_info != nullptr) && (device_info->handle != VK_NULL_HANDLE) &&
            (memory_properties.memoryTypeCount > 0) && (memory_properties.memoryHeapCount > 0) &&
@@ -62,9 +67,27 @@ VulkanResourceInitializer::VulkanResourceInitializer(const VulkanDeviceInfo*
 
 VulkanResourceInitializer::~VulkanResourceInitializer()
 {
+    // Pending batched uploads must complete before their command buffers and staging memory are destroyed.
+    EndBatch();
+
     for (const auto& entry : command_exec_objects_)
     {
         device_table_->DestroyCommandPool(device_, entry.second.command_pool, nullptr);
+
+        if (entry.second.batch_fence != VK_NULL_HANDLE)
+        {
+            device_table_->DestroyFence(device_, entry.second.batch_fence, nullptr);
+        }
+    }
+
+    if (ring_buffer_ != VK_NULL_HANDLE)
+    {
+        resource_allocator_->DestroyBufferDirect(ring_buffer_, nullptr, ring_buffer_data_);
+    }
+
+    if (ring_memory_ != VK_NULL_HANDLE)
+    {
+        resource_allocator_->FreeMemoryDirect(ring_memory_, nullptr, ring_memory_data_);
     }
 
     if (staging_buffer_ != VK_NULL_HANDLE)
@@ -111,33 +134,69 @@ VkResult VulkanResourceInitializer::InitializeBuffer(VkDeviceSize        data_si
     // TODO: handle usage cases without TRANSFER_DST.
     GFXRECON_UNREFERENCED_PARAMETER(usage);
 
-    VkQueue                               queue               = VK_NULL_HANDLE;
-    VkCommandBuffer                       command_buffer      = VK_NULL_HANDLE;
-    VkDeviceMemory                        staging_memory      = VK_NULL_HANDLE;
-    VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
-    VulkanResourceAllocator::MemoryData   staging_memory_data = 0;
-    VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
+    VkResult result = VK_SUCCESS;
 
-    VkResult result = GetCommandExecObjects(queue_family_index, &queue, &command_buffer);
+    if (IsBatchable(data_size))
+    {
+        VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+        VkDeviceSize    staging_offset = 0;
 
-    if (result == VK_SUCCESS)
+        result = AcquireRingStagingSpace(data_size, data, &staging_offset);
+
+        if (result == VK_SUCCESS)
+        {
+            result = GetBatchCommandBuffer(queue_family_index, &command_buffer);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            std::vector<VkBufferCopy> ring_regions(regions, regions + region_count);
+
+            for (auto& region : ring_regions)
+            {
+                region.srcOffset += staging_offset;
+            }
+
+            device_table_->CmdCopyBuffer(command_buffer, ring_buffer_, buffer, region_count, ring_regions.data());
+            ++batch_upload_count_;
+        }
+    }
+    else
     {
-        result = AcquireInitializedStagingBuffer(
-            data_size, data, &staging_memory, &staging_buffer, &staging_memory_data, &staging_buffer_data);
+        VkQueue                               queue               = VK_NULL_HANDLE;
+        VkCommandBuffer                       command_buffer      = VK_NULL_HANDLE;
+        VkDeviceMemory                        staging_memory      = VK_NULL_HANDLE;
+        VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
+        VulkanResourceAllocator::MemoryData   staging_memory_data = 0;
+        VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
+
+        // Pending batched uploads must be submitted before the command buffer can be reused for immediate execution.
+        result = FlushBatch();
 
         if (result == VK_SUCCESS)
         {
-            result = BeginCommandBuffer(command_buffer);
+            result = GetCommandExecObjects(queue_family_index, &queue, &command_buffer);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            result = AcquireInitializedStagingBuffer(
+                data_size, data, &staging_memory, &staging_buffer, &staging_memory_data, &staging_buffer_data);
 
             if (result == VK_SUCCESS)
             {
-                device_table_->CmdCopyBuffer(command_buffer, staging_buffer, buffer, region_count, regions);
-                device_table_->EndCommandBuffer(command_buffer);
+                result = BeginCommandBuffer(command_buffer);
 
-                result = ExecuteCommandBuffer(queue, command_buffer);
-            }
+                if (result == VK_SUCCESS)
+                {
+                    device_table_->CmdCopyBuffer(command_buffer, staging_buffer, buffer, region_count, regions);
+                    device_table_->EndCommandBuffer(command_buffer);
 
-            ReleaseStagingBuffer(staging_memory, staging_buffer, staging_memory_data, staging_buffer_data);
+                    result = ExecuteCommandBuffer(queue, command_buffer);
+                }
+
+                ReleaseStagingBuffer(staging_memory, staging_buffer, staging_memory_data, staging_buffer_data);
+            }
         }
     }
 
@@ -160,34 +219,74 @@ VkResult VulkanResourceInitializer::InitializeImage(VkDeviceSize             dat
                                                     uint32_t                 level_count,
                                                     const VkBufferImageCopy* level_copies)
 {
-    VkDeviceMemory                        staging_memory      = VK_NULL_HANDLE;
-    VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
-    VulkanResourceAllocator::MemoryData   staging_memory_data = 0;
-    VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
+    bool use_transfer = ((usage & VK_IMAGE_USAGE_TRANSFER_DST_BIT) == VK_IMAGE_USAGE_TRANSFER_DST_BIT) &&
+                        (sample_count == VK_SAMPLE_COUNT_1_BIT);
+    bool use_color_write = ((usage & VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) == VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) &&
+                           (aspect == VK_IMAGE_ASPECT_COLOR_BIT);
+    bool use_depth_write =
+        ((usage & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) == VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) &&
+        (aspect == VK_IMAGE_ASPECT_DEPTH_BIT);
+    bool use_stencil_write =
+        ((usage & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) == VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) &&
+        (aspect == VK_IMAGE_ASPECT_STENCIL_BIT) && have_shader_stencil_write_;
+    bool use_pixel_shader =
+        !use_transfer && (use_color_write || use_depth_write || use_stencil_write) && (type == VK_IMAGE_TYPE_2D);
 
-    VkResult result = AcquireInitializedStagingBuffer(
-        data_size, data, &staging_memory, &staging_buffer, &staging_memory_data, &staging_buffer_data);
+    VkResult result = VK_SUCCESS;
 
-    if (result == VK_SUCCESS)
+    if (!use_pixel_shader && IsBatchable(data_size))
+    {
+        VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+        VkDeviceSize    staging_offset = 0;
+
+        result = AcquireRingStagingSpace(data_size, data, &staging_offset);
+
+        if (result == VK_SUCCESS)
+        {
+            result = GetBatchCommandBuffer(queue_family_index, &command_buffer);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            std::vector<VkBufferImageCopy> ring_copies(level_copies, level_copies + level_count);
+
+            for (auto& copy : ring_copies)
+            {
+                copy.bufferOffset += staging_offset;
+            }
+
+            RecordBufferToImageCopy(command_buffer,
+                                    ring_buffer_,
+                                    image,
+                                    format,
+                                    aspect,
+                                    initial_layout,
+                                    final_layout,
+                                    layer_count,
+                                    level_count,
+                                    ring_copies.data());
+            ++batch_upload_count_;
+        }
+    }
+    else
     {
-        result = LoadData(data_size, data, staging_buffer_data);
+        VkDeviceMemory                        staging_memory      = VK_NULL_HANDLE;
+        VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
+        VulkanResourceAllocator::MemoryData   staging_memory_data = 0;
+        VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
+
+        // Pending batched uploads must be submitted before the command buffer can be reused for immediate execution.
+        result = FlushBatch();
 
         if (result == VK_SUCCESS)
         {
-            bool use_transfer = ((usage & VK_IMAGE_USAGE_TRANSFER_DST_BIT) == VK_IMAGE_USAGE_TRANSFER_DST_BIT) &&
-                                (sample_count == VK_SAMPLE_COUNT_1_BIT);
-            bool use_color_write =
-                ((usage & VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) == VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) &&
-                (aspect == VK_IMAGE_ASPECT_COLOR_BIT);
-            bool use_depth_write = ((usage & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) ==
-                                    VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) &&
-                                   (aspect == VK_IMAGE_ASPECT_DEPTH_BIT);
-            bool use_stencil_write = ((usage & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) ==
-                                      VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) &&
-                                     (aspect == VK_IMAGE_ASPECT_STENCIL_BIT) && have_shader_stencil_write_;
-
-            if (!use_transfer && (use_color_write || use_depth_write || use_stencil_write) &&
-                (type == VK_IMAGE_TYPE_2D))
+            result = AcquireInitializedStagingBuffer(
+                data_size, data, &staging_memory, &staging_buffer, &staging_memory_data, &staging_buffer_data);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            if (use_pixel_shader)
             {
                 result = PixelShaderImageCopy(queue_family_index,
                                               staging_buffer,
@@ -216,9 +315,9 @@ VkResult VulkanResourceInitializer::InitializeImage(VkDeviceSize             dat
                                            level_count,
                                            level_copies);
             }
-        }
 
-        ReleaseStagingBuffer(staging_memory, staging_buffer, staging_memory_data, staging_buffer_data);
+            ReleaseStagingBuffer(staging_memory, staging_buffer, staging_memory_data, staging_buffer_data);
+        }
     }
 
     return result;
@@ -235,53 +334,114 @@ VkResult VulkanResourceInitializer::TransitionImage(uint32_t              queue_
 {
     VkQueue         queue          = VK_NULL_HANDLE;
     VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+    VkResult        result         = VK_SUCCESS;
 
-    VkResult result = GetCommandExecObjects(queue_family_index, &queue, &command_buffer);
+    if (batch_active_)
+    {
+        result = GetBatchCommandBuffer(queue_family_index, &command_buffer);
 
-    if (result == VK_SUCCESS)
+        if (result == VK_SUCCESS)
+        {
+            RecordImageTransition(
+                command_buffer, image, format, aspect, initial_layout, final_layout, layer_count, level_count);
+        }
+    }
+    else
     {
-        result = BeginCommandBuffer(command_buffer);
+        result = GetCommandExecObjects(queue_family_index, &queue, &command_buffer);
 
         if (result == VK_SUCCESS)
         {
-            VkImageLayout      old_layout        = initial_layout;
-            VkImageAspectFlags transition_aspect = GetImageTransitionAspect(format, aspect, &old_layout);
-
-            VkImageMemoryBarrier memory_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
-            memory_barrier.pNext                           = nullptr;
-            memory_barrier.srcAccessMask                   = 0;
-            memory_barrier.dstAccessMask                   = 0;
-            memory_barrier.oldLayout                       = old_layout;
-            memory_barrier.newLayout                       = final_layout;
-            memory_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-            memory_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-            memory_barrier.image                           = image;
-            memory_barrier.subresourceRange.aspectMask     = transition_aspect;
-            memory_barrier.subresourceRange.baseMipLevel   = 0;
-            memory_barrier.subresourceRange.levelCount     = level_count;
-            memory_barrier.subresourceRange.baseArrayLayer = 0;
-            memory_barrier.subresourceRange.layerCount     = layer_count;
-
-            device_table_->CmdPipelineBarrier(command_buffer,
-                                              VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-                                              VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
-                                              0,
-                                              0,
-                                              nullptr,
-                                              0,
-                                              nullptr,
-                                              1,
-                                              &memory_barrier);
+            result = BeginCommandBuffer(command_buffer);
 
-            device_table_->EndCommandBuffer(command_buffer);
+            if (result == VK_SUCCESS)
+            {
+                RecordImageTransition(
+                    command_buffer, image, format, aspect, initial_layout, final_layout, layer_count, level_count);
 
-            result = ExecuteCommandBuffer(queue, command_buffer);
+                device_table_->EndCommandBuffer(command_buffer);
+
+                result = ExecuteCommandBuffer(queue, command_buffer);
+            }
         }
     }
 
     return result;
 }
 
+VkResult VulkanResourceInitializer::BeginBatch()
+{
+    VkResult result = VK_SUCCESS;
+
+    if (!batch_active_)
+    {
+        if (ring_buffer_ == VK_NULL_HANDLE)
+        {
+            VkMemoryPropertyFlags property_flags = 0;
+            VkDeviceSize          ring_size      = std::max(max_copy_size_, kMinStagingRingSize);
+
+            result = CreateStagingBuffer(ring_size,
+                                         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                                         &ring_memory_,
+                                         &ring_buffer_,
+                                         &ring_memory_data_,
+                                         &ring_buffer_data_,
+                                         &property_flags);
+
+            if (result == VK_SUCCESS)
+            {
+                ring_size_     = ring_size;
+                ring_coherent_ = (property_flags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) ==
+                                 VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+            }
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            void* mapped_data = nullptr;
+
+            result = resource_allocator_->MapResourceMemoryDirect(ring_size_, 0, &mapped_data, ring_buffer_data_);
+
+            if (result == VK_SUCCESS)
+            {
+                ring_data_    = reinterpret_cast<uint8_t*>(mapped_data);
+                ring_offset_  = 0;
+                batch_active_ = true;
+            }
+        }
+
+        if (result != VK_SUCCESS)
+        {
+            GFXRECON_LOG_WARNING("Failed to create the staging ring buffer for batched resource initialization; "
+                                 "resources will be initialized individually");
+        }
+    }
+
+    return result;
+}
+
+VkResult VulkanResourceInitializer::EndBatch()
+{
+    VkResult result = VK_SUCCESS;
+
+    if (batch_active_)
+    {
+        result = FlushBatch();
+
+        resource_allocator_->UnmapResourceMemoryDirect(ring_buffer_data_);
+
+        ring_data_    = nullptr;
+        batch_active_ = false;
+
+        GFXRECON_LOG_DEBUG("Batched resource initialization uploaded %" PRIu64 " resources with %" PRIu64
+                           " queue submissions",
+                           batch_upload_count_,
+                           batch_flush_count_);
+    }
+
+    return result;
+}
+
 VkResult VulkanResourceInitializer::GetCommandExecObjects(uint32_t         queue_family_index,
                                                           VkQueue*         queue,
                                                           VkCommandBuffer* command_buffer)
@@ -321,7 +481,8 @@ VkResult VulkanResourceInitializer::GetCommandExecObjects(uint32_t         queue
             {
                 *queue = GetDeviceQueue(device_table_, device_info_, queue_family_index, 0);
                 command_exec_objects_.emplace(queue_family_index,
-                                              CommandExecObjects{ *queue, command_pool, *command_buffer });
+                                              CommandExecObjects{
+                                                  *queue, command_pool, *command_buffer, VK_NULL_HANDLE, false });
             }
             else
             {
@@ -907,89 +1068,121 @@ void VulkanResourceInitializer::DestroyFramebufferResources(VkImageView view, Vk
     device_table_->DestroyImageView(device_, view, nullptr);
 }
 
-VkResult VulkanResourceInitializer::AcquireStagingBuffer(VkDeviceMemory*                        memory,
-                                                         VkBuffer*                              buffer,
-                                                         VkDeviceSize                           size,
-                                                         VulkanResourceAllocator::MemoryData*   allocator_memory_data,
-                                                         VulkanResourceAllocator::ResourceData* allocator_buffer_data)
+VkResult VulkanResourceInitializer::CreateStagingBuffer(VkDeviceSize                           size,
+                                                        VkMemoryPropertyFlags                  preferred_property_flags,
+                                                        VkDeviceMemory*                        memory,
+                                                        VkBuffer*                              buffer,
+                                                        VulkanResourceAllocator::MemoryData*   allocator_memory_data,
+                                                        VulkanResourceAllocator::ResourceData* allocator_buffer_data,
+                                                        VkMemoryPropertyFlags*                 property_flags)
 {
     assert((memory != nullptr) && (buffer != nullptr) && (size > 0) && (allocator_memory_data != nullptr) &&
            (allocator_buffer_data != nullptr));
 
-    VkResult result = VK_SUCCESS;
+    VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
+    VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
 
-    // Create the reusable staging_buffer_ object, with size equal to max_copy_size_, on first acquire, if the requested
-    // size is less than or equal to max_copy_size_.  It the requested size is larger than max_copy_size_, create a
-    // temporary staging buffer that will be destroyed on release.
-    if ((staging_buffer_ == VK_NULL_HANDLE) || (size > max_copy_size_))
-    {
-        VkBuffer                              staging_buffer      = VK_NULL_HANDLE;
-        VulkanResourceAllocator::ResourceData staging_buffer_data = 0;
+    VkBufferCreateInfo create_info    = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+    create_info.pNext                 = nullptr;
+    create_info.flags                 = 0;
+    create_info.size                  = size;
+    create_info.usage                 = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    create_info.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+    create_info.queueFamilyIndexCount = 0;
+    create_info.pQueueFamilyIndices   = nullptr;
 
-        VkBufferCreateInfo create_info    = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
-        create_info.pNext                 = nullptr;
-        create_info.flags                 = 0;
-        create_info.size                  = std::max(size, max_copy_size_);
-        create_info.usage                 = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-        create_info.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
-        create_info.queueFamilyIndexCount = 0;
-        create_info.pQueueFamilyIndices   = nullptr;
+    VkResult result =
+        resource_allocator_->CreateBufferDirect(&create_info, nullptr, &staging_buffer, &staging_buffer_data);
 
-        result = resource_allocator_->CreateBufferDirect(&create_info, nullptr, &staging_buffer, &staging_buffer_data);
+    if (result == VK_SUCCESS)
+    {
+        VkMemoryRequirements memory_requirements;
+        device_table_->GetBufferMemoryRequirements(device_, staging_buffer, &memory_requirements);
 
-        if (result == VK_SUCCESS)
-        {
-            VkMemoryRequirements memory_requirements;
-            device_table_->GetBufferMemoryRequirements(device_, staging_buffer, &memory_requirements);
+        uint32_t memory_type_index = GetMemoryTypeIndex(memory_requirements.memoryTypeBits, preferred_property_flags);
 
-            uint32_t memory_type_index =
+        if (memory_type_index == std::numeric_limits<uint32_t>::max())
+        {
+            memory_type_index =
                 GetMemoryTypeIndex(memory_requirements.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+        }
 
-            assert(memory_type_index != std::numeric_limits<uint32_t>::max());
+        assert(memory_type_index != std::numeric_limits<uint32_t>::max());
 
-            // Allocate the memory for the buffer.
-            VkDeviceMemory                      staging_memory      = VK_NULL_HANDLE;
-            VulkanResourceAllocator::MemoryData staging_memory_data = 0;
+        // Allocate the memory for the buffer.
+        VkDeviceMemory                      staging_memory      = VK_NULL_HANDLE;
+        VulkanResourceAllocator::MemoryData staging_memory_data = 0;
 
-            VkMemoryAllocateInfo alloc_info = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
-            alloc_info.pNext                = nullptr;
-            alloc_info.allocationSize       = memory_requirements.size;
-            alloc_info.memoryTypeIndex      = memory_type_index;
+        VkMemoryAllocateInfo alloc_info = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+        alloc_info.pNext                = nullptr;
+        alloc_info.allocationSize       = memory_requirements.size;
+        alloc_info.memoryTypeIndex      = memory_type_index;
 
-            result =
-                resource_allocator_->AllocateMemoryDirect(&alloc_info, nullptr, &staging_memory, &staging_memory_data);
+        result = resource_allocator_->AllocateMemoryDirect(&alloc_info, nullptr, &staging_memory, &staging_memory_data);
 
-            if (result == VK_SUCCESS)
+        if (result == VK_SUCCESS)
+        {
+            VkMemoryPropertyFlags flags;
+            result = resource_allocator_->BindBufferMemoryDirect(
+                staging_buffer, staging_memory, 0, staging_buffer_data, staging_memory_data, &flags);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            (*memory)                = staging_memory;
+            (*buffer)                = staging_buffer;
+            (*allocator_memory_data) = staging_memory_data;
+            (*allocator_buffer_data) = staging_buffer_data;
+
+            if (property_flags != nullptr)
             {
-                VkMemoryPropertyFlags flags;
-                result = resource_allocator_->BindBufferMemoryDirect(
-                    staging_buffer, staging_memory, 0, staging_buffer_data, staging_memory_data, &flags);
+                (*property_flags) = memory_properties_.memoryTypes[memory_type_index].propertyFlags;
             }
+        }
+        else
+        {
+            resource_allocator_->DestroyBufferDirect(staging_buffer, nullptr, staging_buffer_data);
 
-            if (result == VK_SUCCESS)
+            if (staging_memory != VK_NULL_HANDLE)
             {
-                (*memory)                = staging_memory;
-                (*buffer)                = staging_buffer;
-                (*allocator_memory_data) = staging_memory_data;
-                (*allocator_buffer_data) = staging_buffer_data;
-
-                if (size <= max_copy_size_)
-                {
-                    staging_memory_      = staging_memory;
-                    staging_buffer_      = staging_buffer;
-                    staging_memory_data_ = staging_memory_data;
-                    staging_buffer_data_ = staging_buffer_data;
-                }
+                resource_allocator_->FreeMemoryDirect(staging_memory, nullptr, staging_memory_data);
             }
-            else
-            {
-                resource_allocator_->DestroyBufferDirect(staging_buffer, nullptr, staging_buffer_data);
+        }
+    }
 
-                if ((*memory) != VK_NULL_HANDLE)
-                {
-                    resource_allocator_->FreeMemoryDirect(staging_memory, nullptr, staging_memory_data);
-                }
-            }
+    return result;
+}
+
+VkResult VulkanResourceInitializer::AcquireStagingBuffer(VkDeviceMemory*                        memory,
+                                                         VkBuffer*                              buffer,
+                                                         VkDeviceSize                           size,
+                                                         VulkanResourceAllocator::MemoryData*   allocator_memory_data,
+                                                         VulkanResourceAllocator::ResourceData* allocator_buffer_data)
+{
+    assert((memory != nullptr) && (buffer != nullptr) && (size > 0) && (allocator_memory_data != nullptr) &&
+           (allocator_buffer_data != nullptr));
+
+    VkResult result = VK_SUCCESS;
+
+    // Create the reusable staging_buffer_ object, with size equal to max_copy_size_, on first acquire, if the requested
+    // size is less than or equal to max_copy_size_.  It the requested size is larger than max_copy_size_, create a
+    // temporary staging buffer that will be destroyed on release.
+    if ((staging_buffer_ == VK_NULL_HANDLE) || (size > max_copy_size_))
+    {
+        result = CreateStagingBuffer(std::max(size, max_copy_size_),
+                                     VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+                                     memory,
+                                     buffer,
+                                     allocator_memory_data,
+                                     allocator_buffer_data,
+                                     nullptr);
+
+        if ((result == VK_SUCCESS) && (size <= max_copy_size_))
+        {
+            staging_memory_      = (*memory);
+            staging_buffer_      = (*buffer);
+            staging_memory_data_ = (*allocator_memory_data);
+            staging_buffer_data_ = (*allocator_buffer_data);
         }
     }
     else
@@ -1107,6 +1300,143 @@ VkResult VulkanResourceInitializer::ExecuteCommandBuffer(VkQueue queue, VkComman
     return result;
 }
 
+VkResult VulkanResourceInitializer::AcquireRingStagingSpace(VkDeviceSize   data_size,
+                                                            const uint8_t* data,
+                                                            VkDeviceSize*  staging_offset)
+{
+    assert((ring_data_ != nullptr) && (data_size <= ring_size_) && (staging_offset != nullptr));
+
+    VkResult     result = VK_SUCCESS;
+    VkDeviceSize offset = ((ring_offset_ + kStagingRingAlignment - 1) / kStagingRingAlignment) * kStagingRingAlignment;
+
+    if ((offset > ring_size_) || (data_size > (ring_size_ - offset)))
+    {
+        // The ring has wrapped, so the GPU must finish reading the staged data before it can be overwritten.
+        result = FlushBatch();
+        offset = 0;
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, data_size);
+        size_t copy_size = static_cast<size_t>(data_size);
+        util::platform::MemoryCopy(ring_data_ + offset, copy_size, data, copy_size);
+
+        ring_offset_      = offset + data_size;
+        (*staging_offset) = offset;
+    }
+
+    return result;
+}
+
+VkResult VulkanResourceInitializer::GetBatchCommandBuffer(uint32_t queue_family_index, VkCommandBuffer* command_buffer)
+{
+    assert(command_buffer != nullptr);
+
+    VkQueue  queue  = VK_NULL_HANDLE;
+    VkResult result = GetCommandExecObjects(queue_family_index, &queue, command_buffer);
+
+    if (result == VK_SUCCESS)
+    {
+        CommandExecObjects& exec_objects = command_exec_objects_[queue_family_index];
+
+        if (exec_objects.batch_fence == VK_NULL_HANDLE)
+        {
+            VkFenceCreateInfo fence_info = { VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+            fence_info.pNext             = nullptr;
+            fence_info.flags             = 0;
+
+            result = device_table_->CreateFence(device_, &fence_info, nullptr, &exec_objects.batch_fence);
+        }
+
+        if ((result == VK_SUCCESS) && !exec_objects.batch_recording)
+        {
+            result = BeginCommandBuffer(exec_objects.command_buffer);
+
+            if (result == VK_SUCCESS)
+            {
+                exec_objects.batch_recording = true;
+            }
+        }
+    }
+
+    return result;
+}
+
+VkResult VulkanResourceInitializer::FlushBatch()
+{
+    VkResult             result = VK_SUCCESS;
+    std::vector<VkFence> fences;
+
+    if (batch_active_ && !ring_coherent_ && (ring_offset_ > 0))
+    {
+        VkMappedMemoryRange range = { VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE };
+        range.pNext               = nullptr;
+        range.memory              = ring_memory_;
+        range.offset              = 0;
+        range.size                = VK_WHOLE_SIZE;
+
+        result = resource_allocator_->FlushMappedMemoryRangesDirect(1, &range, &ring_memory_data_);
+    }
+
+    for (auto& entry : command_exec_objects_)
+    {
+        CommandExecObjects& exec_objects = entry.second;
+
+        if (exec_objects.batch_recording)
+        {
+            exec_objects.batch_recording = false;
+
+            device_table_->EndCommandBuffer(exec_objects.command_buffer);
+
+            if (result == VK_SUCCESS)
+            {
+                VkSubmitInfo submit_info         = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+                submit_info.pNext                = nullptr;
+                submit_info.waitSemaphoreCount   = 0;
+                submit_info.pWaitSemaphores      = nullptr;
+                submit_info.pWaitDstStageMask    = nullptr;
+                submit_info.commandBufferCount   = 1;
+                submit_info.pCommandBuffers      = &exec_objects.command_buffer;
+                submit_info.signalSemaphoreCount = 0;
+                submit_info.pSignalSemaphores    = nullptr;
+
+                result = device_table_->QueueSubmit(exec_objects.queue, 1, &submit_info, exec_objects.batch_fence);
+
+                if (result == VK_SUCCESS)
+                {
+                    fences.push_back(exec_objects.batch_fence);
+                }
+            }
+        }
+    }
+
+    if (!fences.empty())
+    {
+        // Wait for the submissions that did succeed, even after an error, so that their staging data is not
+        // overwritten while still in use.
+        uint32_t fence_count = static_cast<uint32_t>(fences.size());
+        uint64_t timeout     = std::numeric_limits<uint64_t>::max();
+        VkResult wait_result = device_table_->WaitForFences(device_, fence_count, fences.data(), VK_TRUE, timeout);
+
+        if (wait_result == VK_SUCCESS)
+        {
+            wait_result = device_table_->ResetFences(device_, fence_count, fences.data());
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            result = wait_result;
+        }
+
+        ++batch_flush_count_;
+    }
+
+    ring_offset_ = 0;
+
+    return result;
+}
+
 VkImageAspectFlags VulkanResourceInitializer::GetImageTransitionAspect(VkFormat              format,
                                                                        VkImageAspectFlagBits aspect,
                                                                        VkImageLayout*        old_layout)
@@ -1151,6 +1481,121 @@ uint32_t VulkanResourceInitializer::GetMemoryTypeIndex(uint32_t type_bits, VkMem
     return memory_type_index;
 }
 
+void VulkanResourceInitializer::RecordImageTransition(VkCommandBuffer       command_buffer,
+                                                      VkImage               image,
+                                                      VkFormat              format,
+                                                      VkImageAspectFlagBits aspect,
+                                                      VkImageLayout         initial_layout,
+                                                      VkImageLayout         final_layout,
+                                                      uint32_t              layer_count,
+                                                      uint32_t              level_count)
+{
+    VkImageLayout      old_layout        = initial_layout;
+    VkImageAspectFlags transition_aspect = GetImageTransitionAspect(format, aspect, &old_layout);
+
+    VkImageMemoryBarrier memory_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+    memory_barrier.pNext                           = nullptr;
+    memory_barrier.srcAccessMask                   = 0;
+    memory_barrier.dstAccessMask                   = 0;
+    memory_barrier.oldLayout                       = old_layout;
+    memory_barrier.newLayout                       = final_layout;
+    memory_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+    memory_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+    memory_barrier.image                           = image;
+    memory_barrier.subresourceRange.aspectMask     = transition_aspect;
+    memory_barrier.subresourceRange.baseMipLevel   = 0;
+    memory_barrier.subresourceRange.levelCount     = level_count;
+    memory_barrier.subresourceRange.baseArrayLayer = 0;
+    memory_barrier.subresourceRange.layerCount     = layer_count;
+
+    device_table_->CmdPipelineBarrier(command_buffer,
+                                      VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                                      VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                                      0,
+                                      0,
+                                      nullptr,
+                                      0,
+                                      nullptr,
+                                      1,
+                                      &memory_barrier);
+}
+
+void VulkanResourceInitializer::RecordBufferToImageCopy(VkCommandBuffer          command_buffer,
+                                                        VkBuffer                 source,
+                                                        VkImage                  destination,
+                                                        VkFormat                 format,
+                                                        VkImageAspectFlagBits    aspect,
+                                                        VkImageLayout            initial_layout,
+                                                        VkImageLayout            final_layout,
+                                                        uint32_t                 layer_count,
+                                                        uint32_t                 level_count,
+                                                        const VkBufferImageCopy* level_copies)
+{
+    VkImageLayout      old_layout        = initial_layout;
+    VkImageAspectFlags transition_aspect = GetImageTransitionAspect(format, aspect, &old_layout);
+
+    // The depth and stencil aspects of a combined depth-stencil image are uploaded separately.  When the uploads are
+    // batched in a single command buffer, the second upload must wait for the first to complete.
+    VkPipelineStageFlags src_stage  = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+    VkAccessFlags        src_access = 0;
+
+    if (batch_active_ && (transition_aspect != static_cast<VkImageAspectFlags>(aspect)))
+    {
+        src_stage  = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+        src_access = VK_ACCESS_TRANSFER_WRITE_BIT;
+    }
+
+    VkImageMemoryBarrier memory_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+    memory_barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    memory_barrier.pNext                           = nullptr;
+    memory_barrier.srcAccessMask                   = src_access;
+    memory_barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
+    memory_barrier.oldLayout                       = old_layout;
+    memory_barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    memory_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+    memory_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+    memory_barrier.image                           = destination;
+    memory_barrier.subresourceRange.aspectMask     = transition_aspect;
+    memory_barrier.subresourceRange.baseMipLevel   = 0;
+    memory_barrier.subresourceRange.levelCount     = level_count;
+    memory_barrier.subresourceRange.baseArrayLayer = 0;
+    memory_barrier.subresourceRange.layerCount     = layer_count;
+
+    device_table_->CmdPipelineBarrier(command_buffer,
+                                      src_stage,
+                                      VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                      0,
+                                      0,
+                                      nullptr,
+                                      0,
+                                      nullptr,
+                                      1,
+                                      &memory_barrier);
+
+    device_table_->CmdCopyBufferToImage(
+        command_buffer, source, destination, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, level_count, level_copies);
+
+    if ((final_layout != VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) && (final_layout != VK_IMAGE_LAYOUT_UNDEFINED) &&
+        (final_layout != VK_IMAGE_LAYOUT_PREINITIALIZED))
+    {
+        memory_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        memory_barrier.dstAccessMask = 0;
+        memory_barrier.oldLayout     = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        memory_barrier.newLayout     = final_layout;
+
+        device_table_->CmdPipelineBarrier(command_buffer,
+                                          VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                          VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                                          0,
+                                          0,
+                                          nullptr,
+                                          0,
+                                          nullptr,
+                                          1,
+                                          &memory_barrier);
+    }
+}
+
 VkResult VulkanResourceInitializer::BufferToImageCopy(uint32_t                 queue_family_index,
                                                       VkBuffer                 source,
                                                       VkImage                  destination,
@@ -1169,62 +1614,20 @@ VkResult VulkanResourceInitializer::BufferToImageCopy(uint32_t                 q
 
     if (result == VK_SUCCESS)
     {
-        VkImageLayout      old_layout        = initial_layout;
-        VkImageAspectFlags transition_aspect = GetImageTransitionAspect(format, aspect, &old_layout);
-
         result = BeginCommandBuffer(command_buffer);
 
         if (result == VK_SUCCESS)
         {
-            VkImageMemoryBarrier memory_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
-            memory_barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-            memory_barrier.pNext                           = nullptr;
-            memory_barrier.srcAccessMask                   = 0;
-            memory_barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
-            memory_barrier.oldLayout                       = old_layout;
-            memory_barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-            memory_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-            memory_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-            memory_barrier.image                           = destination;
-            memory_barrier.subresourceRange.aspectMask     = transition_aspect;
-            memory_barrier.subresourceRange.baseMipLevel   = 0;
-            memory_barrier.subresourceRange.levelCount     = level_count;
-            memory_barrier.subresourceRange.baseArrayLayer = 0;
-            memory_barrier.subresourceRange.layerCount     = layer_count;
-
-            device_table_->CmdPipelineBarrier(command_buffer,
-                                              VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-                                              VK_PIPELINE_STAGE_TRANSFER_BIT,
-                                              0,
-                                              0,
-                                              nullptr,
-                                              0,
-                                              nullptr,
-                                              1,
-                                              &memory_barrier);
-
-            device_table_->CmdCopyBufferToImage(
-                command_buffer, source, destination, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, level_count, level_copies);
-
-            if ((final_layout != VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) && (final_layout != VK_IMAGE_LAYOUT_UNDEFINED) &&
-                (final_layout != VK_IMAGE_LAYOUT_PREINITIALIZED))
-            {
-                memory_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-                memory_barrier.dstAccessMask = 0;
-                memory_barrier.oldLayout     = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-                memory_barrier.newLayout     = final_layout;
-
-                device_table_->CmdPipelineBarrier(command_buffer,
-                                                  VK_PIPELINE_STAGE_TRANSFER_BIT,
-                                                  VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
-                                                  0,
-                                                  0,
-                                                  nullptr,
-                                                  0,
-                                                  nullptr,
-                                                  1,
-                                                  &memory_barrier);
-            }
+            RecordBufferToImageCopy(command_buffer,
+                                    source,
+                                    destination,
+                                    format,
+                                    aspect,
+                                    initial_layout,
+                                    final_layout,
+                                    layer_count,
+                                    level_count,
+                                    level_copies);
 
             device_table_->EndCommandBuffer(command_buffer);
 
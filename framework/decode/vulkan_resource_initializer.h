@@ -84,6 +84,14 @@ class VulkanResourceInitializer
                              uint32_t              layer_count,
                              uint32_t              level_count);
 
+    // Batched initialization records the uploads for many resources into a single command buffer per queue family,
+    // with the staging data sub-allocated from a persistently mapped ring buffer.  The command buffers are only
+    // submitted, and waited on with a fence, when the ring wraps or when the batch ends.  Uploads that do not fit in
+    // the ring, or that require the pixel shader copy path, flush the batch and fall back to immediate execution.
+    VkResult BeginBatch();
+
+    VkResult EndBatch();
+
   private:
     VkResult GetCommandExecObjects(uint32_t queue_family_index, VkQueue* queue, VkCommandBuffer* command_buffer);
 
@@ -122,6 +130,14 @@ class VulkanResourceInitializer
 
     void DestroyFramebufferResources(VkImageView view, VkFramebuffer framebuffer);
 
+    VkResult CreateStagingBuffer(VkDeviceSize                           size,
+                                 VkMemoryPropertyFlags                  preferred_property_flags,
+                                 VkDeviceMemory*                        memory,
+                                 VkBuffer*                              buffer,
+                                 VulkanResourceAllocator::MemoryData*   allocator_memory_data,
+                                 VulkanResourceAllocator::ResourceData* allocator_buffer_data,
+                                 VkMemoryPropertyFlags*                 property_flags);
+
     VkResult AcquireStagingBuffer(VkDeviceMemory*                        memory,
                                   VkBuffer*                              buffer,
                                   VkDeviceSize                           size,
@@ -146,6 +162,34 @@ class VulkanResourceInitializer
 
     VkResult ExecuteCommandBuffer(VkQueue queue, VkCommandBuffer command_buffer);
 
+    bool IsBatchable(VkDeviceSize data_size) const { return batch_active_ && (data_size <= ring_size_); }
+
+    VkResult AcquireRingStagingSpace(VkDeviceSize data_size, const uint8_t* data, VkDeviceSize* staging_offset);
+
+    VkResult GetBatchCommandBuffer(uint32_t queue_family_index, VkCommandBuffer* command_buffer);
+
+    VkResult FlushBatch();
+
+    void RecordImageTransition(VkCommandBuffer       command_buffer,
+                               VkImage               image,
+                               VkFormat              format,
+                               VkImageAspectFlagBits aspect,
+                               VkImageLayout         initial_layout,
+                               VkImageLayout         final_layout,
+                               uint32_t              layer_count,
+                               uint32_t              level_count);
+
+    void RecordBufferToImageCopy(VkCommandBuffer          command_buffer,
+                                 VkBuffer                 source,
+                                 VkImage                  destination,
+                                 VkFormat                 format,
+                                 VkImageAspectFlagBits    aspect,
+                                 VkImageLayout            initial_layout,
+                                 VkImageLayout            final_layout,
+                                 uint32_t                 layer_count,
+                                 uint32_t                 level_count,
+                                 const VkBufferImageCopy* level_copies);
+
     VkImageAspectFlags
     GetImageTransitionAspect(VkFormat format, VkImageAspectFlagBits aspect, VkImageLayout* old_layout);
 
@@ -182,11 +226,21 @@ class VulkanResourceInitializer
         VkQueue         queue;
         VkCommandPool   command_pool;
         VkCommandBuffer command_buffer;
+        VkFence         batch_fence;
+        bool            batch_recording;
     };
 
     // Map queue family index to command pool, command buffer, and queue objects for command processing.
     typedef std::unordered_map<uint32_t, CommandExecObjects> CommandExecObjectMap;
 
+  private:
+    // Minimum size of the batch staging ring, which is also sized to hold the largest copy reported for the trace.
+    static constexpr VkDeviceSize kMinStagingRingSize = 64 * 1024 * 1024;
+
+    // Ring sub-allocation alignment, which is a multiple of 4 and of every texel block size, as required for
+    // VkBufferImageCopy::bufferOffset.
+    static constexpr VkDeviceSize kStagingRingAlignment = 384;
+
   private:
     VkDevice                              device_;
     CommandExecObjectMap                  command_exec_objects_;
@@ -204,6 +258,17 @@ class VulkanResourceInitializer
     VulkanResourceAllocator*              resource_allocator_;
     const encode::VulkanDeviceTable*      device_table_;
     const VulkanDeviceInfo*               device_info_;
+    bool                                  batch_active_;
+    VkDeviceMemory                        ring_memory_;
+    VulkanResourceAllocator::MemoryData   ring_memory_data_;
+    VkBuffer                              ring_buffer_;
+    VulkanResourceAllocator::ResourceData ring_buffer_data_;
+    uint8_t*                              ring_data_;
+    VkDeviceSize                          ring_size_;
+    VkDeviceSize                          ring_offset_;
+    bool                                  ring_coherent_;
+    uint64_t                              batch_upload_count_;
+    uint64_t                              batch_flush_count_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
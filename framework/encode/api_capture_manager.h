@@ -182,6 +182,7 @@ class ApiCaptureManager
     {
         return common_manager_->GetPageGuardMemoryMode();
     }
+    util::MemoryDiffTracker* GetMemoryDiffTracker() const { return common_manager_->GetMemoryDiffTracker(); }
     const std::string&                GetTrimKey() const { return common_manager_->GetTrimKey(); }
     bool                              IsTrimEnabled() const { return common_manager_->IsTrimEnabled(); }
     uint32_t                          GetCurrentFrame() const { return common_manager_->GetCurrentFrame(); }
@@ -199,6 +200,7 @@ class ApiCaptureManager
     {
         common_manager_->WriteFillMemoryCmd(api_family_, memory_id, offset, size, data);
     }
+    void RemoveFillMemoryBaseline(format::HandleId memory_id) { common_manager_->RemoveFillMemoryBaseline(memory_id); }
     void WriteCreateHeapAllocationCmd(uint64_t allocation_id, uint64_t allocation_size)
     {
         common_manager_->WriteCreateHeapAllocationCmd(api_family_, allocation_id, allocation_size);
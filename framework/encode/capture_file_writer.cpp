@@ -0,0 +1,474 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "encode/capture_file_writer.h"
+
+#include "format/format.h"
+#include "format/format_util.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+CaptureFileWriter::CaptureFileWriter(util::FileOutputStream* output_stream,
+                                     uint64_t                first_block_index,
+                                     bool                    force_flush,
+                                     util::Compressor*       compressor,
+                                     size_t                  compression_threads,
+                                     bool                    compress_chunks) :
+    output_stream_(output_stream),
+    force_flush_(force_flush), compressor_(nullptr), pending_blocks_(nullptr), writer_sleeping_(false), running_(true),
+    flush_requests_(0), flushes_completed_(0), next_block_index_(first_block_index), compressions_in_flight_(0),
+    chunk_compressor_(nullptr), chunk_block_count_(0)
+{
+    assert(output_stream_ != nullptr);
+
+    if ((compressor != nullptr) && compress_chunks)
+    {
+        // Chunks are compressed by the writer thread, so blocks are not compressed individually.
+        chunk_compressor_ = compressor;
+    }
+    else if ((compressor != nullptr) && (compression_threads > 0))
+    {
+        compressor_ = compressor;
+        compression_pool_.set_num_threads(compression_threads);
+    }
+
+    writer_thread_ = std::thread(&CaptureFileWriter::WriterThreadMain, this);
+}
+
+CaptureFileWriter::~CaptureFileWriter()
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        // The thread pool discards queued tasks when it is stopped, so every block handed to the pool must have been
+        // compressed and queued for the writer before shutting down.
+        written_condition_.wait(lock, [this]() { return compressions_in_flight_.load() == 0; });
+
+        running_ = false;
+    }
+    wake_condition_.notify_one();
+
+    if (writer_thread_.joinable())
+    {
+        writer_thread_.join();
+    }
+
+    if (!reorder_queue_.empty())
+    {
+        // A producer reserved a block index and never submitted the block, so everything after the gap is stranded.
+        GFXRECON_LOG_ERROR("Capture file writer discarded %" PRIuPTR " blocks following missing block index %" PRIu64,
+                           reorder_queue_.size(),
+                           next_block_index_);
+
+        while (!reorder_queue_.empty())
+        {
+            delete reorder_queue_.top();
+            reorder_queue_.pop();
+        }
+    }
+
+    WriteChunk();
+    output_stream_->Flush();
+}
+
+void CaptureFileWriter::SubmitBlock(uint64_t block_index, const void* data, size_t size)
+{
+    Block* block = new Block;
+    block->index = block_index;
+    block->data.assign(reinterpret_cast<const uint8_t*>(data), reinterpret_cast<const uint8_t*>(data) + size);
+
+    if (compressor_ != nullptr)
+    {
+        ++compressions_in_flight_;
+        compression_pool_.post([this, block]() {
+            CompressBlock(block);
+            QueueBlock(block);
+
+            if (--compressions_in_flight_ == 0)
+            {
+                // Synchronize with the destructor's wait before notifying it.
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                }
+                written_condition_.notify_all();
+            }
+        });
+    }
+    else
+    {
+        QueueBlock(block);
+    }
+}
+
+void CaptureFileWriter::SkipBlockIndex(uint64_t block_index)
+{
+    // An empty block holds the index's place in the reorder queue without writing anything.
+    Block* block = new Block;
+    block->index = block_index;
+    QueueBlock(block);
+}
+
+void CaptureFileWriter::QueueBlock(Block* block)
+{
+    Block* head = pending_blocks_.load(std::memory_order_relaxed);
+    do
+    {
+        block->next = head;
+    } while (!pending_blocks_.compare_exchange_weak(head, block, std::memory_order_seq_cst));
+
+    // The writer sets writer_sleeping_ before its final check of pending_blocks_, so either it observes this block or
+    // this thread observes that it is going to sleep and must be woken. The mutex is only touched in the latter case.
+    if (writer_sleeping_.load(std::memory_order_seq_cst))
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+        }
+        wake_condition_.notify_one();
+    }
+}
+
+void CaptureFileWriter::Flush()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++flush_requests_;
+    }
+    wake_condition_.notify_one();
+}
+
+void CaptureFileWriter::EndChunk(uint64_t end_block_index)
+{
+    if (chunk_compressor_ != nullptr)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        chunk_end_requests_.push_back(end_block_index);
+    }
+}
+
+void CaptureFileWriter::WaitForBlocks(uint64_t end_block_index)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    written_condition_.wait(lock, [this, end_block_index]() { return next_block_index_ >= end_block_index; });
+
+    const uint64_t flush_request = ++flush_requests_;
+    wake_condition_.notify_one();
+    written_condition_.wait(lock, [this, flush_request]() { return flushes_completed_ >= flush_request; });
+}
+
+void CaptureFileWriter::SkipBlocks(uint64_t block_count)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    assert(pending_blocks_.load() == nullptr);
+    next_block_index_ += block_count;
+}
+
+void CaptureFileWriter::CompressBlock(Block* block)
+{
+    // Per-thread scratch space, which is reused across blocks to avoid an allocation per compression.
+    thread_local std::vector<uint8_t> compressed_buffer;
+
+    if (block->data.size() < sizeof(format::BlockHeader))
+    {
+        return;
+    }
+
+    const auto block_header = reinterpret_cast<const format::BlockHeader*>(block->data.data());
+
+    size_t header_size            = 0;
+    size_t compressed_header_size = 0;
+
+    if (block_header->type == format::BlockType::kFunctionCallBlock)
+    {
+        header_size            = sizeof(format::FunctionCallHeader);
+        compressed_header_size = sizeof(format::CompressedFunctionCallHeader);
+    }
+    else if (block_header->type == format::BlockType::kMethodCallBlock)
+    {
+        header_size            = sizeof(format::MethodCallHeader);
+        compressed_header_size = sizeof(format::CompressedMethodCallHeader);
+    }
+    else if ((block_header->type == format::BlockType::kMetaDataBlock) &&
+             (block->data.size() >= sizeof(format::FillMemoryCommandHeader)) &&
+             (format::GetMetaDataType(reinterpret_cast<const format::MetaDataHeader*>(block_header)->meta_data_id) ==
+              format::MetaDataType::kFillMemoryCommand))
+    {
+        // Fill memory commands keep the same header when compressed, because it already records the uncompressed size.
+        header_size            = sizeof(format::FillMemoryCommandHeader);
+        compressed_header_size = sizeof(format::FillMemoryCommandHeader);
+    }
+    else if ((block_header->type == format::BlockType::kMetaDataBlock) &&
+             (block->data.size() >= sizeof(format::FillMemoryDeltaCommandHeader)) &&
+             (format::GetMetaDataType(reinterpret_cast<const format::MetaDataHeader*>(block_header)->meta_data_id) ==
+              format::MetaDataType::kFillMemoryDeltaCommand))
+    {
+        // Fill memory delta commands also record the uncompressed size of their span data in the header.
+        header_size            = sizeof(format::FillMemoryDeltaCommandHeader);
+        compressed_header_size = sizeof(format::FillMemoryDeltaCommandHeader);
+    }
+    else
+    {
+        return;
+    }
+
+    if (block->data.size() < header_size)
+    {
+        return;
+    }
+
+    const size_t   uncompressed_size = block->data.size() - header_size;
+    const uint8_t* uncompressed_data = block->data.data() + header_size;
+    const size_t   compressed_size =
+        compressor_->Compress(uncompressed_size, uncompressed_data, &compressed_buffer, compressed_header_size);
+
+    if ((compressed_size == 0) || (compressed_size >= uncompressed_size))
+    {
+        return;
+    }
+
+    uint8_t* compressed_data = compressed_buffer.data();
+
+    if (block_header->type == format::BlockType::kFunctionCallBlock)
+    {
+        auto uncompressed_header = reinterpret_cast<const format::FunctionCallHeader*>(block->data.data());
+        auto compressed_header   = reinterpret_cast<format::CompressedFunctionCallHeader*>(compressed_data);
+        compressed_header->block_header.type = format::BlockType::kCompressedFunctionCallBlock;
+        compressed_header->api_call_id       = uncompressed_header->api_call_id;
+        compressed_header->thread_id         = uncompressed_header->thread_id;
+        compressed_header->uncompressed_size = uncompressed_size;
+        compressed_header->block_header.size = sizeof(compressed_header->api_call_id) +
+                                               sizeof(compressed_header->thread_id) +
+                                               sizeof(compressed_header->uncompressed_size) + compressed_size;
+    }
+    else if (block_header->type == format::BlockType::kMethodCallBlock)
+    {
+        auto uncompressed_header = reinterpret_cast<const format::MethodCallHeader*>(block->data.data());
+        auto compressed_header   = reinterpret_cast<format::CompressedMethodCallHeader*>(compressed_data);
+        compressed_header->block_header.type = format::BlockType::kCompressedMethodCallBlock;
+        compressed_header->api_call_id       = uncompressed_header->api_call_id;
+        compressed_header->object_id         = uncompressed_header->object_id;
+        compressed_header->thread_id         = uncompressed_header->thread_id;
+        compressed_header->uncompressed_size = uncompressed_size;
+        compressed_header->block_header.size = sizeof(compressed_header->api_call_id) +
+                                               sizeof(compressed_header->object_id) +
+                                               sizeof(compressed_header->uncompressed_size) +
+                                               sizeof(compressed_header->thread_id) + compressed_size;
+    }
+    else
+    {
+        // Fill memory headers are kept as is, apart from the block type and size.
+        util::platform::MemoryCopy(compressed_data, header_size, block->data.data(), header_size);
+        auto compressed_header  = reinterpret_cast<format::BlockHeader*>(compressed_data);
+        compressed_header->type = format::BlockType::kCompressedMetaDataBlock;
+        compressed_header->size = (header_size - sizeof(format::BlockHeader)) + compressed_size;
+    }
+
+    // The compressed data is smaller than the original data, so this will generally reuse the block's allocation.
+    block->data.assign(compressed_data, compressed_data + compressed_header_size + compressed_size);
+}
+
+void CaptureFileWriter::WriterThreadMain()
+{
+    for (;;)
+    {
+        Block* blocks = pending_blocks_.exchange(nullptr, std::memory_order_acquire);
+
+        if (blocks != nullptr)
+        {
+            while (blocks != nullptr)
+            {
+                Block* next = blocks->next;
+                reorder_queue_.push(blocks);
+                blocks = next;
+            }
+
+            WriteReadyBlocks();
+        }
+        else
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+
+            if (flushes_completed_ != flush_requests_)
+            {
+                const uint64_t flush_requests   = flush_requests_;
+                const uint64_t next_block_index = next_block_index_;
+                TakeChunkEndRequests();
+
+                // Everything submitted so far that can be written has been written. The current chunk is written
+                // even if it has not reached its requested end, because WaitForBlocks callers write directly to the
+                // output stream after the flush. Chunk compression can take a while, so producers requesting flushes
+                // are not held up by it.
+                lock.unlock();
+                EndCompletedChunk(next_block_index);
+                WriteChunk();
+                output_stream_->Flush();
+                lock.lock();
+
+                flushes_completed_ = flush_requests;
+                written_condition_.notify_all();
+            }
+
+            writer_sleeping_.store(true, std::memory_order_seq_cst);
+            wake_condition_.wait(lock, [this]() {
+                return !running_ || (flushes_completed_ != flush_requests_) ||
+                       (pending_blocks_.load(std::memory_order_seq_cst) != nullptr);
+            });
+            writer_sleeping_.store(false, std::memory_order_relaxed);
+
+            if (!running_ && (pending_blocks_.load(std::memory_order_acquire) == nullptr))
+            {
+                break;
+            }
+        }
+    }
+}
+
+void CaptureFileWriter::WriteReadyBlocks()
+{
+    uint64_t next_block_index = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        next_block_index = next_block_index_;
+        TakeChunkEndRequests();
+    }
+
+    uint64_t written = 0;
+    while (!reorder_queue_.empty() && (reorder_queue_.top()->index == next_block_index))
+    {
+        Block* block = reorder_queue_.top();
+        reorder_queue_.pop();
+
+        EndCompletedChunk(next_block_index);
+        WriteBlock(block);
+        delete block;
+
+        ++next_block_index;
+        ++written;
+    }
+
+    EndCompletedChunk(next_block_index);
+
+    assert(reorder_queue_.empty() || (reorder_queue_.top()->index > next_block_index));
+
+    if (written > 0)
+    {
+        if (force_flush_)
+        {
+            WriteChunk();
+            output_stream_->Flush();
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        next_block_index_ = next_block_index;
+        written_condition_.notify_all();
+    }
+}
+
+void CaptureFileWriter::TakeChunkEndRequests()
+{
+    // Requests may arrive out of order from different threads.
+    for (uint64_t end_block_index : chunk_end_requests_)
+    {
+        chunk_ends_.insert(std::upper_bound(chunk_ends_.begin(), chunk_ends_.end(), end_block_index), end_block_index);
+    }
+
+    chunk_end_requests_.clear();
+}
+
+void CaptureFileWriter::EndCompletedChunk(uint64_t next_block_index)
+{
+    bool end_chunk = false;
+
+    while (!chunk_ends_.empty() && (chunk_ends_.front() <= next_block_index))
+    {
+        chunk_ends_.pop_front();
+        end_chunk = true;
+    }
+
+    if (end_chunk)
+    {
+        WriteChunk();
+    }
+}
+
+void CaptureFileWriter::WriteBlock(const Block* block)
+{
+    if (block->data.empty())
+    {
+        // Placeholder for a skipped block index.
+        return;
+    }
+
+    if (chunk_compressor_ == nullptr)
+    {
+        output_stream_->Write(block->data.data(), block->data.size());
+        return;
+    }
+
+    chunk_data_.insert(chunk_data_.end(), block->data.begin(), block->data.end());
+    ++chunk_block_count_;
+
+    // Bound the memory needed to expand a chunk during replay when a frame produces a very large amount of data.
+    if (chunk_data_.size() >= kMaxChunkSize)
+    {
+        WriteChunk();
+    }
+}
+
+void CaptureFileWriter::WriteChunk()
+{
+    if (chunk_block_count_ == 0)
+    {
+        return;
+    }
+
+    const size_t compressed_size = chunk_compressor_->Compress(
+        chunk_data_.size(), chunk_data_.data(), &compressed_chunk_data_, sizeof(format::CompressedChunkHeader));
+
+    if ((compressed_size > 0) && (compressed_size < chunk_data_.size()))
+    {
+        auto chunk_header = reinterpret_cast<format::CompressedChunkHeader*>(compressed_chunk_data_.data());
+        chunk_header->block_header.type = format::BlockType::kCompressedChunkBlock;
+        chunk_header->block_header.size =
+            sizeof(chunk_header->uncompressed_size) + sizeof(chunk_header->block_count) + compressed_size;
+        chunk_header->uncompressed_size = chunk_data_.size();
+        chunk_header->block_count       = chunk_block_count_;
+
+        output_stream_->Write(compressed_chunk_data_.data(), sizeof(format::CompressedChunkHeader) + compressed_size);
+    }
+    else
+    {
+        output_stream_->Write(chunk_data_.data(), chunk_data_.size());
+    }
+
+    chunk_data_.clear();
+    chunk_block_count_ = 0;
+}
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
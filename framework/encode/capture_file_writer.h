@@ -0,0 +1,173 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_ENCODE_CAPTURE_FILE_WRITER_H
+#define GFXRECON_ENCODE_CAPTURE_FILE_WRITER_H
+
+#include "util/compressor.h"
+#include "util/defines.h"
+#include "util/file_output_stream.h"
+#include "util/threadpool.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Writes capture file blocks from a dedicated thread, so that application threads never touch the capture file.
+//
+// Producers reserve a block index from the capture manager and hand the finished block to a lock-free multi-producer
+// queue. The writer thread drains the queue, restores block index order, and writes the blocks to the output stream.
+//
+// When created with a compressor and one or more compression threads, producers submit uncompressed function call,
+// method call, and fill memory blocks, which are compressed by a worker pool before being queued for the writer. The
+// workers finish out of order; the writer's block index ordering re-sequences them.
+//
+// When created with a compressor and compress_chunks set, the writer instead accumulates consecutive blocks and
+// compresses them together as a single format::CompressedChunkHeader block, with chunk boundaries placed by EndChunk
+// once per frame. Similar blocks within a frame then share one compression stream.
+class CaptureFileWriter
+{
+  public:
+    // The output stream and compressor must remain valid until the writer has been destroyed. first_block_index is the
+    // index that will be assigned to the first block submitted to the writer. Blocks are only compressed by the writer
+    // when compressor is not null and compression_threads is greater than zero, or compress_chunks is true.
+    CaptureFileWriter(util::FileOutputStream* output_stream,
+                      uint64_t                first_block_index,
+                      bool                    force_flush,
+                      util::Compressor*       compressor          = nullptr,
+                      size_t                  compression_threads = 0,
+                      bool                    compress_chunks     = false);
+
+    // Compresses and writes all pending blocks before returning.
+    ~CaptureFileWriter();
+
+    // Returns true if submitted blocks are compressed by the writer, in which case producers should submit them
+    // uncompressed.
+    bool CompressesBlocks() const { return (compressor_ != nullptr) || (chunk_compressor_ != nullptr); }
+
+    // Copy a block to the write queue. Safe to call concurrently from any number of threads.
+    void SubmitBlock(uint64_t block_index, const void* data, size_t size);
+
+    // Account for a block index that was reserved for a block written to another stream, such as the asset file, so
+    // that the blocks following it are still written. Safe to call concurrently with SubmitBlock.
+    void SkipBlockIndex(uint64_t block_index);
+
+    // Request a flush of the output stream once the blocks submitted so far have been written, ending the current
+    // chunk early if needed. Does not block.
+    void Flush();
+
+    // When compressing chunks, end the current chunk before the block with index end_block_index. Does not block.
+    void EndChunk(uint64_t end_block_index);
+
+    // Block until every index lower than end_block_index has been written to the output stream and the stream has been
+    // flushed. The caller must ensure that all of those indices are eventually submitted.
+    void WaitForBlocks(uint64_t end_block_index);
+
+    // Account for blocks that were written directly to the output stream, bypassing the writer, while the writer was
+    // idle (e.g. trimming state snapshots).
+    void SkipBlocks(uint64_t block_count);
+
+  private:
+    static const size_t kMaxChunkSize = 64 * 1024 * 1024;
+
+    struct Block
+    {
+        Block*               next{ nullptr };
+        uint64_t             index{ 0 };
+        std::vector<uint8_t> data;
+    };
+
+    struct CompareBlockIndex
+    {
+        bool operator()(const Block* lhs, const Block* rhs) const { return lhs->index > rhs->index; }
+    };
+
+    void QueueBlock(Block* block);
+
+    // Replace an uncompressed block with its compressed form when compression reduces its size. Run by the compression
+    // worker threads.
+    void CompressBlock(Block* block);
+
+    void WriterThreadMain();
+
+    void WriteReadyBlocks();
+
+    // Move chunk ends requested by EndChunk to the writer's ordered list. Called with mutex_ held.
+    void TakeChunkEndRequests();
+
+    // Write the current chunk if a requested chunk end has been reached by the block with index next_block_index.
+    void EndCompletedChunk(uint64_t next_block_index);
+
+    // Write a block to the current chunk when compressing chunks, or directly to the output stream otherwise.
+    void WriteBlock(const Block* block);
+
+    // Compress the blocks accumulated for the current chunk and write them to the output stream. The blocks are written
+    // uncompressed if compression does not reduce their size.
+    void WriteChunk();
+
+  private:
+    util::FileOutputStream* output_stream_;
+    bool                    force_flush_;
+    util::Compressor*       compressor_;
+
+    // Lock-free LIFO of submitted blocks; the writer takes the entire list at once and re-sorts it by block index.
+    std::atomic<Block*> pending_blocks_;
+
+    // Only accessed by the writer thread.
+    std::priority_queue<Block*, std::vector<Block*>, CompareBlockIndex> reorder_queue_;
+
+    std::mutex              mutex_;
+    std::condition_variable wake_condition_;
+    std::condition_variable written_condition_;
+    std::atomic<bool>       writer_sleeping_;
+    bool                    running_;
+    uint64_t                flush_requests_;     // Protected by mutex_.
+    uint64_t                flushes_completed_;  // Protected by mutex_.
+    uint64_t                next_block_index_;   // Protected by mutex_.
+    std::vector<uint64_t>   chunk_end_requests_; // Protected by mutex_.
+
+    // Number of blocks submitted to the compression pool that have not yet been queued for the writer.
+    std::atomic<uint64_t> compressions_in_flight_;
+    util::ThreadPool      compression_pool_;
+
+    // Only accessed by the writer thread, or after it has exited.
+    util::Compressor*    chunk_compressor_;
+    std::deque<uint64_t> chunk_ends_;
+    std::vector<uint8_t> chunk_data_;
+    std::vector<uint8_t> compressed_chunk_data_;
+    uint32_t             chunk_block_count_;
+
+    std::thread writer_thread_;
+};
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_ENCODE_CAPTURE_FILE_WRITER_H
@@ -40,8 +40,10 @@
 #include "util/page_guard_manager.h"
 #include "util/platform.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
+#include <thread>
 #include <unordered_map>
 
 #if defined(__unix__)
@@ -54,6 +56,7 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 // One based frame count.
 const uint32_t kFirstFrame           = 1;
 const size_t   kFileStreamBufferSize = 256 * 1024;
+const size_t   kMaxMemoryDiffThreads = 4;
 
 std::mutex                                     CommonCaptureManager::ThreadData::count_lock_;
 format::ThreadId                               CommonCaptureManager::ThreadData::thread_count_ = 0;
@@ -96,21 +99,24 @@ format::ThreadId CommonCaptureManager::ThreadData::GetThreadId()
 }
 
 CommonCaptureManager::CommonCaptureManager() :
-    force_file_flush_(false), timestamp_filename_(true),
-    memory_tracking_mode_(CaptureSettings::MemoryTrackingMode::kPageGuard), page_guard_align_buffer_sizes_(false),
-    page_guard_track_ahb_memory_(false), page_guard_unblock_sigsegv_(false), page_guard_signal_handler_watcher_(false),
-    page_guard_memory_mode_(kMemoryModeShadowInternal), page_guard_external_memory_(false), trim_enabled_(false),
-    trim_boundary_(CaptureSettings::TrimBoundary::kUnknown), trim_current_range_(0), current_frame_(kFirstFrame),
-    queue_submit_count_(0), capture_mode_(kModeWrite), previous_hotkey_state_(false),
-    previous_runtime_trigger_state_(CaptureSettings::RuntimeTriggerState::kNotUsed), debug_layer_(false),
-    debug_device_lost_(false), screenshot_prefix_(""), screenshots_enabled_(false), disable_dxr_(false),
-    accel_struct_padding_(0), iunknown_wrapping_(false), force_command_serialization_(false), queue_zero_only_(false),
-    allow_pipeline_compile_required_(false), quit_after_frame_ranges_(false), use_asset_file_(false), block_index_(0),
-    write_assets_(false), previous_write_assets_(false)
+    force_file_flush_(false), async_file_write_(false), compression_threads_(0), compression_chunks_(false),
+    timestamp_filename_(true), memory_tracking_mode_(CaptureSettings::MemoryTrackingMode::kPageGuard),
+    page_guard_align_buffer_sizes_(false), page_guard_track_ahb_memory_(false), page_guard_unblock_sigsegv_(false),
+    page_guard_signal_handler_watcher_(false), page_guard_memory_mode_(kMemoryModeShadowInternal),
+    page_guard_external_memory_(false), trim_enabled_(false), trim_boundary_(CaptureSettings::TrimBoundary::kUnknown),
+    trim_current_range_(0), current_frame_(kFirstFrame), queue_submit_count_(0), capture_mode_(kModeWrite),
+    previous_hotkey_state_(false), previous_runtime_trigger_state_(CaptureSettings::RuntimeTriggerState::kNotUsed),
+    debug_layer_(false), debug_device_lost_(false), screenshot_prefix_(""), screenshots_enabled_(false),
+    disable_dxr_(false), accel_struct_padding_(0), iunknown_wrapping_(false), force_command_serialization_(false),
+    queue_zero_only_(false), allow_pipeline_compile_required_(false), quit_after_frame_ranges_(false),
+    use_asset_file_(false), block_index_(0), write_assets_(false), previous_write_assets_(false)
 {}
 
 CommonCaptureManager::~CommonCaptureManager()
 {
+    // Finish writing any queued blocks before the file stream is closed.
+    file_writer_ = nullptr;
+
     if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard ||
         memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kUserfaultfd)
     {
@@ -299,6 +305,9 @@ bool CommonCaptureManager::Initialize(format::ApiFamilyId                   api_
     timestamp_filename_              = trace_settings.time_stamp_file;
     memory_tracking_mode_            = trace_settings.memory_tracking_mode;
     force_file_flush_                = trace_settings.force_flush;
+    async_file_write_                = trace_settings.async_file_write;
+    compression_threads_             = trace_settings.compression_threads;
+    compression_chunks_              = trace_settings.compression_chunks;
     debug_layer_                     = trace_settings.debug_layer;
     debug_device_lost_               = trace_settings.debug_device_lost;
     screenshots_enabled_             = !trace_settings.screenshot_ranges.empty();
@@ -333,6 +342,25 @@ bool CommonCaptureManager::Initialize(format::ApiFamilyId                   api_
             rv_annotation_info_.descriptor_mask);
     }
 
+    if ((memory_tracking_mode_ == CaptureSettings::kDiff) && (api_family != format::ApiFamilyId::ApiFamily_Vulkan))
+    {
+        GFXRECON_LOG_WARNING("The diff memory tracking mode is only supported for Vulkan, falling back to the "
+                             "unassisted memory tracking mode");
+        memory_tracking_mode_ = CaptureSettings::kUnassisted;
+    }
+
+    if (trace_settings.fill_memory_delta)
+    {
+        if (api_family == format::ApiFamilyId::ApiFamily_Vulkan)
+        {
+            fill_memory_delta_encoder_ = std::make_unique<util::DeltaEncoder>();
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Fill memory delta encoding is only supported for Vulkan and will be disabled");
+        }
+    }
+
     if (memory_tracking_mode_ == CaptureSettings::kPageGuard || memory_tracking_mode_ == CaptureSettings::kUserfaultfd)
     {
         page_guard_align_buffer_sizes_                  = trace_settings.page_guard_align_buffer_sizes;
@@ -377,6 +405,17 @@ bool CommonCaptureManager::Initialize(format::ApiFamilyId                   api_
         page_guard_memory_mode_        = kMemoryModeDisabled;
     }
 
+    // The compressor is created before the capture file, which may hand it to the capture file writer.
+    if (success)
+    {
+        compressor_ = std::unique_ptr<util::Compressor>(
+            format::CreateCompressor(file_options_.compression_type, trace_settings.compression_level));
+        if ((compressor_ == nullptr) && (file_options_.compression_type != format::CompressionType::kNone))
+        {
+            success = false;
+        }
+    }
+
     if (trace_settings.trim_ranges.empty() && trace_settings.trim_key.empty() &&
         trace_settings.trim_boundary != CaptureSettings::TrimBoundary::kDrawCalls &&
         trace_settings.runtime_capture_trigger == CaptureSettings::RuntimeTriggerState::kNotUsed)
@@ -458,15 +497,6 @@ bool CommonCaptureManager::Initialize(format::ApiFamilyId                   api_
         }
     }
 
-    if (success)
-    {
-        compressor_ = std::unique_ptr<util::Compressor>(format::CreateCompressor(file_options_.compression_type));
-        if ((compressor_ == nullptr) && (file_options_.compression_type != format::CompressionType::kNone))
-        {
-            success = false;
-        }
-    }
-
     if (success)
     {
         if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard ||
@@ -485,6 +515,19 @@ bool CommonCaptureManager::Initialize(format::ApiFamilyId                   api_
                                            trace_settings.page_guard_signal_handler_watcher_max_restores,
                                            mem_prot_mode);
         }
+        else if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kDiff)
+        {
+            // The calling thread also compares memory, so the pool only needs the remaining hardware threads.
+            size_t hardware_threads = std::thread::hardware_concurrency();
+            size_t diff_threads     = 0;
+
+            if (hardware_threads > 1)
+            {
+                diff_threads = std::min(hardware_threads - 1, kMaxMemoryDiffThreads);
+            }
+
+            memory_diff_tracker_ = std::make_unique<util::MemoryDiffTracker>(diff_threads);
+        }
     }
     else
     {
@@ -548,7 +591,7 @@ void CommonCaptureManager::EndApiCallCapture()
         bool   not_compressed    = true;
         size_t uncompressed_size = parameter_buffer->GetDataSize();
 
-        if (compressor_ != nullptr)
+        if ((compressor_ != nullptr) && !IsFileWriterCompressing())
         {
             size_t header_size     = sizeof(format::CompressedFunctionCallHeader);
             size_t compressed_size = compressor_->Compress(
@@ -604,7 +647,7 @@ void CommonCaptureManager::EndMethodCallCapture()
         bool   not_compressed    = true;
         size_t uncompressed_size = parameter_buffer->GetDataSize();
 
-        if (compressor_ != nullptr)
+        if ((compressor_ != nullptr) && !IsFileWriterCompressing())
         {
             size_t header_size     = sizeof(format::CompressedMethodCallHeader);
             size_t compressed_size = compressor_->Compress(
@@ -943,7 +986,12 @@ void CommonCaptureManager::EndFrame(format::ApiFamilyId api_family, std::shared_
     }
 
     // Flush after presents to help avoid capture files with incomplete final blocks.
-    if (file_stream_.get() != nullptr)
+    if (file_writer_ != nullptr)
+    {
+        file_writer_->EndChunk(block_index_.load());
+        file_writer_->Flush();
+    }
+    else if (file_stream_.get() != nullptr)
     {
         file_stream_->Flush();
     }
@@ -1083,13 +1131,32 @@ bool CommonCaptureManager::CreateCaptureFile(format::ApiFamilyId api_family, con
         capture_filename_ = util::filepath::GenerateTimestampedFilename(capture_filename_);
     }
 
+    file_writer_ = nullptr;
     file_stream_ = std::make_unique<util::FileOutputStream>(capture_filename_, kFileStreamBufferSize);
 
+    // Deltas are relative to data written to the previous file, which replay of the new file will not have.
+    if (fill_memory_delta_encoder_ != nullptr)
+    {
+        fill_memory_delta_encoder_->Clear();
+    }
+
     if (file_stream_->IsValid())
     {
         GFXRECON_LOG_INFO("Recording graphics API capture to %s", capture_filename_.c_str());
         WriteFileHeader();
 
+        // The file header is written synchronously because it is not a block and does not consume a block index.
+        // Compression worker threads and chunk compression are run by the file writer, so they also require it.
+        if (async_file_write_ || (((compression_threads_ > 0) || compression_chunks_) && (compressor_ != nullptr)))
+        {
+            file_writer_ = std::make_unique<CaptureFileWriter>(file_stream_.get(),
+                                                               block_index_.load(),
+                                                               force_file_flush_,
+                                                               compressor_.get(),
+                                                               compression_threads_,
+                                                               compression_chunks_);
+        }
+
         gfxrecon::util::filepath::FileInfo info{};
         gfxrecon::util::filepath::GetApplicationInfo(info);
         WriteExeFileInfo(api_family, info);
@@ -1234,6 +1301,12 @@ void CommonCaptureManager::ActivateTrimming(std::shared_lock<ApiCallMutexT>& cur
         auto thread_data = GetThreadData();
         assert(thread_data != nullptr);
 
+        if (file_writer_ != nullptr)
+        {
+            // The state writer writes to the file stream directly, so all queued blocks must be written first.
+            file_writer_->WaitForBlocks(block_index_.load());
+        }
+
         for (auto& manager : api_capture_managers_)
         {
             manager.first->WriteTrackedState(file_stream_.get(),
@@ -1268,6 +1341,7 @@ void CommonCaptureManager::DeactivateTrimming(std::shared_lock<ApiCallMutexT>& c
         capture_mode_ &= ~kModeWrite;
 
         assert(file_stream_);
+        file_writer_ = nullptr;
         file_stream_->Flush();
         file_stream_ = nullptr;
     }
@@ -1420,10 +1494,24 @@ void CommonCaptureManager::WriteFillMemoryCmd(
     {
         GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, size);
 
+        const uint8_t* uncompressed_data = (static_cast<const uint8_t*>(data) + offset);
+        size_t         uncompressed_size = static_cast<size_t>(size);
+
+        // Each delta is relative to the data of the previous write to the same memory, so the lock is held until the
+        // block is written to keep the blocks in the order that the data was encoded.
+        std::unique_lock<std::mutex> delta_lock;
+        if (fill_memory_delta_encoder_ != nullptr)
+        {
+            delta_lock = std::unique_lock<std::mutex>(fill_memory_delta_lock_);
+
+            if (WriteFillMemoryDeltaCmd(api_family, memory_id, offset, uncompressed_size, uncompressed_data))
+            {
+                return;
+            }
+        }
+
         format::FillMemoryCommandHeader fill_cmd;
-        size_t                          header_size       = sizeof(format::FillMemoryCommandHeader);
-        const uint8_t*                  uncompressed_data = (static_cast<const uint8_t*>(data) + offset);
-        size_t                          uncompressed_size = static_cast<size_t>(size);
+        size_t                          header_size = sizeof(format::FillMemoryCommandHeader);
 
         auto thread_data = GetThreadData();
         assert(thread_data != nullptr);
@@ -1438,7 +1526,7 @@ void CommonCaptureManager::WriteFillMemoryCmd(
 
         bool not_compressed = true;
 
-        if (compressor_ != nullptr)
+        if ((compressor_ != nullptr) && !IsFileWriterCompressing())
         {
             size_t compressed_size = compressor_->Compress(
                 uncompressed_size, uncompressed_data, &thread_data->compressed_buffer_, header_size);
@@ -1471,6 +1559,81 @@ void CommonCaptureManager::WriteFillMemoryCmd(
     }
 }
 
+bool CommonCaptureManager::WriteFillMemoryDeltaCmd(format::ApiFamilyId api_family,
+                                                   format::HandleId    memory_id,
+                                                   uint64_t            offset,
+                                                   size_t              size,
+                                                   const uint8_t*      data)
+{
+    format::FillMemoryDeltaCommandHeader delta_cmd;
+    size_t                               header_size  = sizeof(format::FillMemoryDeltaCommandHeader);
+    size_t                               encoded_size = 0;
+
+    // Deltas that are not much smaller than the data are written as regular fill commands, which are cheaper to replay.
+    bool success = fill_memory_delta_encoder_->Encode(
+        memory_id, offset, size, data, (size / 4) * 3, &fill_memory_delta_buffer_, header_size, &encoded_size);
+
+    // Nothing is written when the data has not changed.
+    if (success && (encoded_size > 0))
+    {
+        const uint8_t* encoded_data = fill_memory_delta_buffer_.data() + header_size;
+
+        auto thread_data = GetThreadData();
+        assert(thread_data != nullptr);
+
+        delta_cmd.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+        delta_cmd.meta_header.meta_data_id =
+            format::MakeMetaDataId(api_family, format::MetaDataType::kFillMemoryDeltaCommand);
+        delta_cmd.thread_id     = thread_data->thread_id_;
+        delta_cmd.memory_id     = memory_id;
+        delta_cmd.memory_offset = offset;
+        delta_cmd.memory_size   = size;
+        delta_cmd.data_size     = encoded_size;
+
+        bool not_compressed = true;
+
+        if ((compressor_ != nullptr) && !IsFileWriterCompressing())
+        {
+            size_t compressed_size =
+                compressor_->Compress(encoded_size, encoded_data, &thread_data->compressed_buffer_, header_size);
+
+            if ((compressed_size > 0) && (compressed_size < encoded_size))
+            {
+                not_compressed = false;
+
+                // As with fill commands, the header includes the uncompressed size, so only the type is changed.
+                delta_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+                delta_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(delta_cmd) + compressed_size;
+
+                util::platform::MemoryCopy(
+                    thread_data->compressed_buffer_.data(), header_size, &delta_cmd, header_size);
+
+                WriteToFile(thread_data->compressed_buffer_.data(), header_size + compressed_size);
+            }
+        }
+
+        if (not_compressed)
+        {
+            delta_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(delta_cmd) + encoded_size;
+
+            // The spans were encoded after space reserved for the header, so the block is written from one buffer.
+            util::platform::MemoryCopy(fill_memory_delta_buffer_.data(), header_size, &delta_cmd, header_size);
+
+            WriteToFile(fill_memory_delta_buffer_.data(), header_size + encoded_size);
+        }
+    }
+
+    return success;
+}
+
+void CommonCaptureManager::RemoveFillMemoryBaseline(format::HandleId memory_id)
+{
+    if (fill_memory_delta_encoder_ != nullptr)
+    {
+        fill_memory_delta_encoder_->RemoveBaseline(memory_id);
+    }
+}
+
 void CommonCaptureManager::WriteCreateHeapAllocationCmd(format::ApiFamilyId api_family,
                                                         uint64_t            allocation_id,
                                                         uint64_t            allocation_size)
@@ -1496,6 +1659,20 @@ void CommonCaptureManager::WriteCreateHeapAllocationCmd(format::ApiFamilyId api_
 
 void CommonCaptureManager::WriteToFile(const void* data, size_t size, util::FileOutputStream* file_stream)
 {
+    if ((file_stream == nullptr) && (file_writer_ != nullptr))
+    {
+        // Reserve the block index and hand the block to the writer thread. The application thread never writes to the
+        // capture file in this mode, so the uffd RT signal does not need to be blocked.
+        const uint64_t block_index = block_index_++;
+        file_writer_->SubmitBlock(block_index, data, size);
+
+        auto thread_data = GetThreadData();
+        assert(thread_data != nullptr);
+        thread_data->block_index_ = block_index + 1;
+
+        return;
+    }
+
     if (GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kUserfaultfd)
     {
         util::PageGuardManager* manager = util::PageGuardManager::Get();
@@ -1505,7 +1682,7 @@ void CommonCaptureManager::WriteToFile(const void* data, size_t size, util::File
             // of a write to the capture file and the uffd mechanism interupts it, it will cause
             // a deadlock as uffd will also try to write to the capture file as well. For this
             // reason RT signal needs to be disabled while writing.
-            // This can be removed once writing to the capture file(s) is delegated to a separate thread.
+            // This is not needed when writing to the capture file is delegated to the CaptureFileWriter thread.
             manager->UffdBlockRtSignal();
         }
     }
@@ -1532,8 +1709,14 @@ void CommonCaptureManager::WriteToFile(const void* data, size_t size, util::File
     auto thread_data = GetThreadData();
     assert(thread_data != nullptr);
 
-    ++block_index_;
-    thread_data->block_index_ = block_index_.load();
+    const uint64_t block_index = block_index_++;
+    thread_data->block_index_  = block_index + 1;
+
+    if (file_writer_ != nullptr)
+    {
+        // The block was written to another stream, but the writer still expects every index in the sequence.
+        file_writer_->SkipBlockIndex(block_index);
+    }
 }
 
 void CommonCaptureManager::AtExit()
@@ -1560,6 +1743,38 @@ void CommonCaptureManager::WriteCaptureOptions(std::string& operation_annotation
         buffer += force_file_flush_ ? "true," : "false,";
     }
 
+    if (async_file_write_ != default_settings.async_file_write)
+    {
+        buffer += "\n    \"file-async-write\": ";
+        buffer += async_file_write_ ? "true," : "false,";
+    }
+
+    if ((fill_memory_delta_encoder_ != nullptr) != default_settings.fill_memory_delta)
+    {
+        buffer += "\n    \"fill-memory-delta\": ";
+        buffer += (fill_memory_delta_encoder_ != nullptr) ? "true," : "false,";
+    }
+
+    if ((compressor_ != nullptr) && (compressor_->GetCompressionLevel() != default_settings.compression_level))
+    {
+        buffer += "\n    \"compression-level\": ";
+        buffer += std::to_string(compressor_->GetCompressionLevel());
+        buffer += ",";
+    }
+
+    if (compression_threads_ != default_settings.compression_threads)
+    {
+        buffer += "\n    \"compression-threads\": ";
+        buffer += std::to_string(compression_threads_);
+        buffer += ",";
+    }
+
+    if (compression_chunks_ != default_settings.compression_chunks)
+    {
+        buffer += "\n    \"compression-chunks\": ";
+        buffer += compression_chunks_ ? "true," : "false,";
+    }
+
     if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kUnassisted)
     {
         buffer += "\n    \"memory-tracking-mode\": \"unassisted\",";
@@ -1568,6 +1783,10 @@ void CommonCaptureManager::WriteCaptureOptions(std::string& operation_annotation
     {
         buffer += "\n    \"memory-tracking-mode\": \"assisted\",";
     }
+    else if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kDiff)
+    {
+        buffer += "\n    \"memory-tracking-mode\": \"diff\",";
+    }
     else
     {
         std::string page_guard_options_buffer;
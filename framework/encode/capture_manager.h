@@ -25,6 +25,7 @@
 #ifndef GFXRECON_ENCODE_CAPTURE_MANAGER_H
 #define GFXRECON_ENCODE_CAPTURE_MANAGER_H
 
+#include "encode/capture_file_writer.h"
 #include "encode/capture_settings.h"
 #include "encode/handle_unwrap_memory.h"
 #include "encode/parameter_buffer.h"
@@ -34,8 +35,10 @@
 #include "format/platform_types.h"
 #include "util/compressor.h"
 #include "util/defines.h"
+#include "util/delta_encoder.h"
 #include "util/file_output_stream.h"
 #include "util/keyboard.h"
+#include "util/memory_diff_tracker.h"
 
 #include <atomic>
 #include <cassert>
@@ -256,6 +259,7 @@ class CommonCaptureManager
     bool                                GetPageGuardAlignBufferSizes() const { return page_guard_align_buffer_sizes_; }
     bool                                GetPageGuardTrackAhbMemory() const { return page_guard_track_ahb_memory_; }
     PageGuardMemoryMode                 GetPageGuardMemoryMode() const { return page_guard_memory_mode_; }
+    util::MemoryDiffTracker*            GetMemoryDiffTracker() const { return memory_diff_tracker_.get(); }
     const std::string&                  GetTrimKey() const { return trim_key_; }
     bool                                IsTrimEnabled() const { return trim_enabled_; }
     uint32_t                            GetCurrentFrame() const { return current_frame_; }
@@ -304,6 +308,10 @@ class CommonCaptureManager
 
     void WriteCreateHeapAllocationCmd(format::ApiFamilyId api_family, uint64_t allocation_id, uint64_t allocation_size);
 
+    // Discards the data recorded for delta encoding the fill commands of a memory object, which must be done when the
+    // memory is unmapped or freed because fill command offsets are relative to the mapped pointer.
+    void RemoveFillMemoryBaseline(format::HandleId memory_id);
+
     void WriteToFile(const void* data, size_t size, util::FileOutputStream* file_stream = nullptr);
 
     template <size_t N>
@@ -328,10 +336,19 @@ class CommonCaptureManager
     {
         block_index_ += blocks;
         GetThreadData()->block_index_ = block_index_;
+
+        if (file_writer_ != nullptr)
+        {
+            file_writer_->SkipBlocks(blocks);
+        }
     }
 
     void SetWriteAssets() { write_assets_ = true; }
 
+    // When true, blocks written to the capture file should be submitted uncompressed and will be compressed by the
+    // capture file writer's worker threads.
+    bool IsFileWriterCompressing() const { return (file_writer_ != nullptr) && file_writer_->CompressesBlocks(); }
+
     bool WriteFrameStateFile();
 
   private:
@@ -341,6 +358,14 @@ class CommonCaptureManager
                               uint32_t                n_blocks,
                               int64_t                 offset);
 
+    // Writes a kFillMemoryDeltaCommand block with the bytes that changed since the previous write to the same memory.
+    // Returns false if the delta is not small enough, in which case a kFillMemoryCommand block must be written instead.
+    bool WriteFillMemoryDeltaCmd(format::ApiFamilyId api_family,
+                                 format::HandleId    memory_id,
+                                 uint64_t            offset,
+                                 size_t              size,
+                                 const uint8_t*      data);
+
   protected:
     std::unique_ptr<util::Compressor> compressor_;
     std::mutex                        mapped_memory_lock_;
@@ -373,6 +398,7 @@ class CommonCaptureManager
         capture_settings_; // Settings from the settings file and environment at capture manager creation time.
 
     std::unique_ptr<util::FileOutputStream> file_stream_;
+    std::unique_ptr<CaptureFileWriter>      file_writer_;
     std::unique_ptr<util::FileOutputStream> asset_file_stream_;
     format::EnabledOptions                  file_options_;
     std::string                             base_filename_;
@@ -380,6 +406,9 @@ class CommonCaptureManager
     std::string                             asset_file_name_;
     bool                                    timestamp_filename_;
     bool                                    force_file_flush_;
+    bool                                    async_file_write_;
+    uint32_t                                compression_threads_;
+    bool                                    compression_chunks_;
     CaptureSettings::MemoryTrackingMode     memory_tracking_mode_;
     bool                                    page_guard_align_buffer_sizes_;
     bool                                    page_guard_track_ahb_memory_;
@@ -420,6 +449,13 @@ class CommonCaptureManager
     bool                                    previous_write_assets_;
     bool                                    write_state_files_;
 
+    std::unique_ptr<util::MemoryDiffTracker> memory_diff_tracker_; // Only created for the diff memory tracking mode.
+
+    // Only created when fill memory delta encoding is enabled.
+    std::unique_ptr<util::DeltaEncoder> fill_memory_delta_encoder_;
+    std::mutex                          fill_memory_delta_lock_;
+    std::vector<uint8_t>                fill_memory_delta_buffer_;
+
     struct
     {
         bool     rv_annotation{ false };
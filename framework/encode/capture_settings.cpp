@@ -45,12 +45,22 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 // clang-format off
 #define CAPTURE_COMPRESSION_TYPE_LOWER                       "capture_compression_type"
 #define CAPTURE_COMPRESSION_TYPE_UPPER                       "CAPTURE_COMPRESSION_TYPE"
+#define CAPTURE_COMPRESSION_THREADS_LOWER                    "capture_compression_threads"
+#define CAPTURE_COMPRESSION_THREADS_UPPER                    "CAPTURE_COMPRESSION_THREADS"
+#define CAPTURE_COMPRESSION_LEVEL_LOWER                      "capture_compression_level"
+#define CAPTURE_COMPRESSION_LEVEL_UPPER                      "CAPTURE_COMPRESSION_LEVEL"
+#define CAPTURE_COMPRESSION_CHUNKS_LOWER                     "capture_compression_chunks"
+#define CAPTURE_COMPRESSION_CHUNKS_UPPER                     "CAPTURE_COMPRESSION_CHUNKS"
 #define CAPTURE_FILE_NAME_LOWER                              "capture_file"
 #define CAPTURE_FILE_NAME_UPPER                              "CAPTURE_FILE"
 #define CAPTURE_FILE_USE_TIMESTAMP_LOWER                     "capture_file_timestamp"
 #define CAPTURE_FILE_USE_TIMESTAMP_UPPER                     "CAPTURE_FILE_TIMESTAMP"
 #define CAPTURE_FILE_FLUSH_LOWER                             "capture_file_flush"
 #define CAPTURE_FILE_FLUSH_UPPER                             "CAPTURE_FILE_FLUSH"
+#define CAPTURE_FILE_ASYNC_WRITE_LOWER                       "capture_file_async_write"
+#define CAPTURE_FILE_ASYNC_WRITE_UPPER                       "CAPTURE_FILE_ASYNC_WRITE"
+#define CAPTURE_FILL_MEMORY_DELTA_LOWER                      "capture_fill_memory_delta"
+#define CAPTURE_FILL_MEMORY_DELTA_UPPER                      "CAPTURE_FILL_MEMORY_DELTA"
 #define LOG_ALLOW_INDENTS_LOWER                              "log_allow_indents"
 #define LOG_ALLOW_INDENTS_UPPER                              "LOG_ALLOW_INDENTS"
 #define LOG_BREAK_ON_ERROR_LOWER                             "log_break_on_error"
@@ -151,7 +161,12 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 const char CaptureSettings::kDefaultCaptureFileName[] = "/sdcard/gfxrecon_capture" GFXRECON_FILE_EXTENSION;
 
 const char kCaptureCompressionTypeEnvVar[]                   = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_TYPE_LOWER;
+const char kCaptureCompressionThreadsEnvVar[]                = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_THREADS_LOWER;
+const char kCaptureCompressionLevelEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_LEVEL_LOWER;
+const char kCaptureCompressionChunksEnvVar[]                 = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_CHUNKS_LOWER;
 const char kCaptureFileFlushEnvVar[]                         = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_FLUSH_LOWER;
+const char kCaptureFileAsyncWriteEnvVar[]                    = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_ASYNC_WRITE_LOWER;
+const char kCaptureFillMemoryDeltaEnvVar[]                   = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILL_MEMORY_DELTA_LOWER;
 const char kCaptureFileNameEnvVar[]                          = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_NAME_LOWER;
 const char kCaptureFileUseTimestampEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_USE_TIMESTAMP_LOWER;
 const char kLogAllowIndentsEnvVar[]                          = GFXRECON_ENV_VAR_PREFIX LOG_ALLOW_INDENTS_LOWER;
@@ -208,7 +223,12 @@ const char kForceFifoPresentModeEnvVar[]                     = GFXRECON_ENV_VAR_
 const char CaptureSettings::kDefaultCaptureFileName[] = "gfxrecon_capture" GFXRECON_FILE_EXTENSION;
 
 const char kCaptureCompressionTypeEnvVar[]                   = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_TYPE_UPPER;
+const char kCaptureCompressionThreadsEnvVar[]                = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_THREADS_UPPER;
+const char kCaptureCompressionLevelEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_LEVEL_UPPER;
+const char kCaptureCompressionChunksEnvVar[]                 = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_CHUNKS_UPPER;
 const char kCaptureFileFlushEnvVar[]                         = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_FLUSH_UPPER;
+const char kCaptureFileAsyncWriteEnvVar[]                    = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_ASYNC_WRITE_UPPER;
+const char kCaptureFillMemoryDeltaEnvVar[]                   = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILL_MEMORY_DELTA_UPPER;
 const char kCaptureFileNameEnvVar[]                          = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_NAME_UPPER;
 const char kCaptureFileUseTimestampEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_USE_TIMESTAMP_UPPER;
 const char kCaptureUseAssetFileEnvVar[]                      = GFXRECON_ENV_VAR_PREFIX CAPTURE_USE_ASSET_FILE_UPPER;
@@ -262,8 +282,13 @@ const char kForceFifoPresentModeEnvVar[]                     = GFXRECON_ENV_VAR_
 const char kSettingsFilter[] = "lunarg_gfxreconstruct.";
 
 const std::string kOptionKeyCaptureCompressionType                   = std::string(kSettingsFilter) + std::string(CAPTURE_COMPRESSION_TYPE_LOWER);
+const std::string kOptionKeyCaptureCompressionThreads                = std::string(kSettingsFilter) + std::string(CAPTURE_COMPRESSION_THREADS_LOWER);
+const std::string kOptionKeyCaptureCompressionLevel                  = std::string(kSettingsFilter) + std::string(CAPTURE_COMPRESSION_LEVEL_LOWER);
+const std::string kOptionKeyCaptureCompressionChunks                 = std::string(kSettingsFilter) + std::string(CAPTURE_COMPRESSION_CHUNKS_LOWER);
 const std::string kOptionKeyCaptureFile                              = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_NAME_LOWER);
 const std::string kOptionKeyCaptureFileForceFlush                    = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_FLUSH_LOWER);
+const std::string kOptionKeyCaptureFileAsyncWrite                    = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_ASYNC_WRITE_LOWER);
+const std::string kOptionKeyCaptureFillMemoryDelta                   = std::string(kSettingsFilter) + std::string(CAPTURE_FILL_MEMORY_DELTA_LOWER);
 const std::string kOptionKeyCaptureFileUseTimestamp                  = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_USE_TIMESTAMP_LOWER);
 const std::string kOptionKeyLogAllowIndents                          = std::string(kSettingsFilter) + std::string(LOG_ALLOW_INDENTS_LOWER);
 const std::string kOptionKeyLogBreakOnError                          = std::string(kSettingsFilter) + std::string(LOG_BREAK_ON_ERROR_LOWER);
@@ -413,7 +438,12 @@ void CaptureSettings::LoadOptionsEnvVar(OptionsMap* options)
     LoadSingleOptionEnvVar(options, kCaptureFileNameEnvVar, kOptionKeyCaptureFile);
     LoadSingleOptionEnvVar(options, kCaptureFileUseTimestampEnvVar, kOptionKeyCaptureFileUseTimestamp);
     LoadSingleOptionEnvVar(options, kCaptureCompressionTypeEnvVar, kOptionKeyCaptureCompressionType);
+    LoadSingleOptionEnvVar(options, kCaptureCompressionThreadsEnvVar, kOptionKeyCaptureCompressionThreads);
+    LoadSingleOptionEnvVar(options, kCaptureCompressionLevelEnvVar, kOptionKeyCaptureCompressionLevel);
+    LoadSingleOptionEnvVar(options, kCaptureCompressionChunksEnvVar, kOptionKeyCaptureCompressionChunks);
     LoadSingleOptionEnvVar(options, kCaptureFileFlushEnvVar, kOptionKeyCaptureFileForceFlush);
+    LoadSingleOptionEnvVar(options, kCaptureFileAsyncWriteEnvVar, kOptionKeyCaptureFileAsyncWrite);
+    LoadSingleOptionEnvVar(options, kCaptureFillMemoryDeltaEnvVar, kOptionKeyCaptureFillMemoryDelta);
 
     // Logging environment variables
     LoadSingleOptionEnvVar(options, kLogAllowIndentsEnvVar, kOptionKeyLogAllowIndents);
@@ -510,12 +540,24 @@ void CaptureSettings::ProcessOptions(OptionsMap* options, CaptureSettings* setti
     // Capture file options
     settings->trace_settings_.capture_file_options.compression_type =
         ParseCompressionTypeString(FindOption(options, kOptionKeyCaptureCompressionType), kDefaultCompressionType);
+    settings->trace_settings_.compression_threads = static_cast<uint32_t>(
+        std::max(ParseIntegerString(FindOption(options, kOptionKeyCaptureCompressionThreads),
+                                    static_cast<int>(settings->trace_settings_.compression_threads)),
+                 0));
+    settings->trace_settings_.compression_level = ParseIntegerString(
+        FindOption(options, kOptionKeyCaptureCompressionLevel), settings->trace_settings_.compression_level);
+    settings->trace_settings_.compression_chunks = ParseBoolString(
+        FindOption(options, kOptionKeyCaptureCompressionChunks), settings->trace_settings_.compression_chunks);
     settings->trace_settings_.capture_file =
         FindOption(options, kOptionKeyCaptureFile, settings->trace_settings_.capture_file);
     settings->trace_settings_.time_stamp_file = ParseBoolString(FindOption(options, kOptionKeyCaptureFileUseTimestamp),
                                                                 settings->trace_settings_.time_stamp_file);
     settings->trace_settings_.force_flush =
         ParseBoolString(FindOption(options, kOptionKeyCaptureFileForceFlush), settings->trace_settings_.force_flush);
+    settings->trace_settings_.async_file_write = ParseBoolString(FindOption(options, kOptionKeyCaptureFileAsyncWrite),
+                                                                 settings->trace_settings_.async_file_write);
+    settings->trace_settings_.fill_memory_delta = ParseBoolString(FindOption(options, kOptionKeyCaptureFillMemoryDelta),
+                                                                  settings->trace_settings_.fill_memory_delta);
 
     // Memory tracking options
     settings->trace_settings_.memory_tracking_mode = ParseMemoryTrackingModeString(
@@ -805,6 +847,10 @@ CaptureSettings::ParseMemoryTrackingModeString(const std::string&
     {
         result = MemoryTrackingMode::kUnassisted;
     }
+    else if (util::platform::StringCompareNoCase("diff", value_string.c_str()) == 0)
+    {
+        result = MemoryTrackingMode::kDiff;
+    }
     else
     {
         if (!value_string.empty())
@@ -56,7 +56,11 @@ class CaptureSettings
         // Similar mechanism as page guard. The mapper memory returned by the driver is replaced by a shadow
         // allocation but in this case the memory is monitored using the userfaultfd mechanism provided by the linux
         // kernel.
-        kUserfaultfd = 3
+        kUserfaultfd = 3,
+        // Keep a snapshot of each mapped memory range, taken on map, and compare it with the mapped memory on unmap,
+        // flush, and queue submit to determine which regions have been modified.  Does not rely on signal handling, but
+        // reads all mapped memory for each comparison.  Only supported for Vulkan.
+        kDiff = 4
     };
 
     enum RuntimeTriggerState
@@ -101,8 +105,13 @@ class CaptureSettings
     {
         std::string                  capture_file{ kDefaultCaptureFileName };
         format::EnabledOptions       capture_file_options;
+        uint32_t                     compression_threads{ 0 };
+        int                          compression_level{ util::Compressor::kDefaultCompressionLevel };
+        bool                         compression_chunks{ false };
         bool                         time_stamp_file{ true };
         bool                         force_flush{ false };
+        bool                         async_file_write{ false };
+        bool                         fill_memory_delta{ false };
         MemoryTrackingMode           memory_tracking_mode{ kPageGuard };
         std::string                  screenshot_dir;
         std::vector<util::UintRange> screenshot_ranges;
@@ -0,0 +1,157 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "encode/capture_file_writer.h"
+#include "util/file_output_stream.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+GFXRECON_BEGIN_NAMESPACE(test)
+
+namespace
+{
+
+// Never reduces the size of the data, so chunks are written uncompressed and the test can read the blocks back.
+class NullCompressor : public util::Compressor
+{
+  public:
+    virtual size_t Compress(const size_t          uncompressed_size,
+                            const uint8_t*        uncompressed_data,
+                            std::vector<uint8_t>* compressed_data,
+                            size_t                compressed_data_offset) override
+    {
+        return 0;
+    }
+
+    virtual size_t Decompress(const size_t   compressed_size,
+                              const uint8_t* compressed_data,
+                              const size_t   expected_uncompressed_size,
+                              uint8_t*       uncompressed_data) override
+    {
+        return 0;
+    }
+};
+
+// Each test block is a single value, which identifies the block in the output stream.
+void SubmitValue(CaptureFileWriter* writer, uint64_t block_index, uint64_t value)
+{
+    writer->SubmitBlock(block_index, &value, sizeof(value));
+}
+
+std::vector<uint64_t> ReadValues(FILE* file)
+{
+    std::vector<uint64_t> values;
+    uint64_t              value = 0;
+
+    fflush(file);
+    fseek(file, 0, SEEK_SET);
+
+    while (fread(&value, sizeof(value), 1, file) == 1)
+    {
+        values.push_back(value);
+    }
+
+    return values;
+}
+
+} // namespace
+
+TEST_CASE("CaptureFileWriter writes blocks around asset file writes and trim state snapshots", "[capture_file_writer]")
+{
+    FILE* file = tmpfile();
+    REQUIRE(file != nullptr);
+
+    util::FileOutputStream stream(file, true);
+
+    {
+        CaptureFileWriter writer(&stream, 0, false);
+
+        // Blocks written to the capture file after it is created.
+        SubmitValue(&writer, 0, 100);
+        SubmitValue(&writer, 1, 101);
+
+        // The asset file header reserves block indices but is written to the asset file.
+        writer.SkipBlockIndex(2);
+        writer.SkipBlockIndex(3);
+
+        SubmitValue(&writer, 5, 105);
+        SubmitValue(&writer, 4, 104);
+
+        // Trim activation waits for the submitted blocks, then the state snapshot is written directly to the stream.
+        writer.WaitForBlocks(6);
+
+        uint64_t state[] = { 200, 201 };
+        stream.Write(state, sizeof(state));
+        writer.SkipBlocks(2);
+
+        SubmitValue(&writer, 8, 108);
+        writer.SkipBlockIndex(9);
+        SubmitValue(&writer, 10, 110);
+        writer.WaitForBlocks(11);
+    }
+
+    REQUIRE(ReadValues(file) == std::vector<uint64_t>{ 100, 101, 104, 105, 200, 201, 108, 110 });
+}
+
+TEST_CASE("CaptureFileWriter writes the current chunk before trim state snapshots", "[capture_file_writer]")
+{
+    FILE* file = tmpfile();
+    REQUIRE(file != nullptr);
+
+    util::FileOutputStream stream(file, true);
+    NullCompressor         compressor;
+
+    {
+        CaptureFileWriter writer(&stream, 0, false, &compressor, 0, true);
+
+        SubmitValue(&writer, 0, 100);
+        writer.EndChunk(2);
+        SubmitValue(&writer, 1, 101);
+        SubmitValue(&writer, 2, 102);
+
+        // The chunk of the current frame ends at a later block, but trim activation needs its blocks written first.
+        writer.EndChunk(10);
+        SubmitValue(&writer, 3, 103);
+        writer.WaitForBlocks(4);
+
+        uint64_t state[] = { 200, 201 };
+        stream.Write(state, sizeof(state));
+        writer.SkipBlocks(2);
+
+        SubmitValue(&writer, 6, 106);
+        SubmitValue(&writer, 7, 107);
+    }
+
+    REQUIRE(ReadValues(file) == std::vector<uint64_t>{ 100, 101, 102, 103, 200, 201, 106, 107 });
+}
+
+GFXRECON_END_NAMESPACE(test)
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -2102,6 +2102,10 @@ void VulkanCaptureManager::PostProcess_vkMapMemory(VkResult         result,
                 wrapper->mapped_size   = size;
             }
 
+            // Fill offsets are relative to the new mapping, so earlier fills such as the initial hardware buffer
+            // contents can't be used as delta baselines.
+            RemoveFillMemoryBaseline(wrapper->handle_id);
+
             if (GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kPageGuard ||
                 GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kUserfaultfd
 #if defined(VK_USE_PLATFORM_ANDROID_KHR)
@@ -2156,6 +2160,25 @@ void VulkanCaptureManager::PostProcess_vkMapMemory(VkResult         result,
                 std::lock_guard<std::mutex> lock(GetMappedMemoryLock());
                 mapped_memory_.insert(wrapper);
             }
+            else if (GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kDiff)
+            {
+                if (size == VK_WHOLE_SIZE)
+                {
+                    assert(offset <= wrapper->allocation_size);
+                    size = wrapper->allocation_size - offset;
+                }
+
+                if (size > 0)
+                {
+                    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, size);
+
+                    util::MemoryDiffTracker* tracker = GetMemoryDiffTracker();
+                    assert(tracker != nullptr);
+
+                    // Snapshot the mapped range, so that only modifications made after the map are written.
+                    tracker->AddTrackedMemory(wrapper->handle_id, (*ppData), static_cast<size_t>(size));
+                }
+            }
         }
         else
         {
@@ -2225,6 +2248,37 @@ void VulkanCaptureManager::PreProcess_vkFlushMappedMemoryRanges(VkDevice
                 }
             }
         }
+        else if (GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kDiff)
+        {
+            const vulkan_wrappers::DeviceMemoryWrapper* current_memory_wrapper = nullptr;
+            util::MemoryDiffTracker*                    tracker                = GetMemoryDiffTracker();
+            assert(tracker != nullptr);
+
+            for (uint32_t i = 0; i < memoryRangeCount; ++i)
+            {
+                auto next_memory_wrapper =
+                    vulkan_wrappers::GetWrapper<vulkan_wrappers::DeviceMemoryWrapper>(pMemoryRanges[i].memory);
+
+                // The whole mapping is compared, so filter multiple ranges from the same object.
+                if (next_memory_wrapper != current_memory_wrapper)
+                {
+                    current_memory_wrapper = next_memory_wrapper;
+
+                    if ((current_memory_wrapper != nullptr) && (current_memory_wrapper->mapped_data != nullptr))
+                    {
+                        tracker->ProcessMemoryEntry(
+                            current_memory_wrapper->handle_id,
+                            [this](uint64_t memory_id, void* start_address, size_t offset, size_t size) {
+                                WriteFillMemoryCmd(memory_id, offset, size, start_address);
+                            });
+                    }
+                    else
+                    {
+                        GFXRECON_LOG_WARNING("vkFlushMappedMemoryRanges called for memory that is not mapped");
+                    }
+                }
+            }
+        }
         else if (GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kAssisted)
         {
             const vulkan_wrappers::DeviceMemoryWrapper* current_memory_wrapper = nullptr;
@@ -2311,6 +2365,20 @@ void VulkanCaptureManager::PreProcess_vkUnmapMemory(VkDevice device, VkDeviceMem
                 mapped_memory_.erase(wrapper);
             }
         }
+        else if (GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kDiff)
+        {
+            util::MemoryDiffTracker* tracker = GetMemoryDiffTracker();
+            assert(tracker != nullptr);
+
+            tracker->ProcessMemoryEntry(wrapper->handle_id,
+                                        [this](uint64_t memory_id, void* start_address, size_t offset, size_t size) {
+                                            WriteFillMemoryCmd(memory_id, offset, size, start_address);
+                                        });
+
+            tracker->RemoveTrackedMemory(wrapper->handle_id);
+        }
+
+        RemoveFillMemoryBaseline(wrapper->handle_id);
     }
     else
     {
@@ -2346,7 +2414,16 @@ void VulkanCaptureManager::PreProcess_vkFreeMemory(VkDevice
                 std::lock_guard<std::mutex> lock(GetMappedMemoryLock());
                 mapped_memory_.erase(wrapper);
             }
+            else if (GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kDiff)
+            {
+                util::MemoryDiffTracker* tracker = GetMemoryDiffTracker();
+                assert(tracker != nullptr);
+
+                tracker->RemoveTrackedMemory(wrapper->handle_id);
+            }
         }
+
+        RemoveFillMemoryBaseline(wrapper->handle_id);
     }
 }
 
@@ -2584,6 +2661,15 @@ void VulkanCaptureManager::QueueSubmitWriteFillMemoryCmd()
             WriteFillMemoryCmd(wrapper->handle_id, 0, size, wrapper->mapped_data);
         }
     }
+    else if (GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kDiff)
+    {
+        util::MemoryDiffTracker* tracker = GetMemoryDiffTracker();
+        assert(tracker != nullptr);
+
+        tracker->ProcessMemoryEntries([this](uint64_t memory_id, void* start_address, size_t offset, size_t size) {
+            WriteFillMemoryCmd(memory_id, offset, size, start_address);
+        });
+    }
 }
 
 void VulkanCaptureManager::PostProcess_vkCreateDescriptorUpdateTemplate(
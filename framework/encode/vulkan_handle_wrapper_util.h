@@ -32,6 +32,7 @@
 #include "generated/generated_vulkan_dispatch_table.h"
 #include "generated/generated_vulkan_state_table.h"
 #include "util/defines.h"
+#include "util/slab_allocator.h"
 
 #include <algorithm>
 #include <iterator>
@@ -169,6 +170,28 @@ inline const VulkanDeviceTable* GetDeviceTable(VkCommandBuffer handle)
     return wrapper->layer_table_ref;
 }
 
+// Wrappers are allocated from per-type slab allocators, because applications can create and destroy thousands of
+// handles of the same type per frame. The allocators are intentionally never destroyed, because wrappers for handles
+// that the application did not destroy may still be referenced during process exit.
+template <typename Wrapper>
+util::SlabAllocator<Wrapper>& GetWrapperAllocator()
+{
+    static util::SlabAllocator<Wrapper>* allocator = new util::SlabAllocator<Wrapper>;
+    return *allocator;
+}
+
+template <typename Wrapper>
+Wrapper* NewWrapper()
+{
+    return GetWrapperAllocator<Wrapper>().New();
+}
+
+template <typename Wrapper>
+void DeleteWrapper(Wrapper* wrapper)
+{
+    GetWrapperAllocator<Wrapper>().Delete(wrapper);
+}
+
 // Wrapper for create wrapper template instantiations that do not make use of all handle parameters.
 struct NoParentWrapper : public HandleWrapper<void*>
 {
@@ -184,7 +207,7 @@ void CreateWrappedDispatchHandle(typename ParentWrapper::HandleType parent,
     assert(handle != nullptr);
     if ((*handle) != VK_NULL_HANDLE)
     {
-        Wrapper* wrapper      = new Wrapper;
+        Wrapper* wrapper      = NewWrapper<Wrapper>();
         wrapper->dispatch_key = *reinterpret_cast<void**>(*handle);
         wrapper->handle       = (*handle);
         wrapper->handle_id    = get_id();
@@ -214,7 +237,7 @@ void CreateWrappedNonDispatchHandle(typename Wrapper::HandleType* handle, PFN_Ge
     assert(handle != nullptr);
     if ((*handle) != VK_NULL_HANDLE)
     {
-        Wrapper* wrapper   = new Wrapper;
+        Wrapper* wrapper   = NewWrapper<Wrapper>();
         wrapper->handle    = (*handle);
         wrapper->handle_id = get_id();
         if (!state_handle_table_.InsertWrapper(wrapper))
@@ -519,7 +542,7 @@ void DestroyWrappedHandle(typename Wrapper::HandleType handle)
     {
         auto wrapper = GetWrapper<Wrapper>(handle);
         RemoveWrapper<Wrapper>(wrapper);
-        delete wrapper;
+        DeleteWrapper(wrapper);
     }
 }
 
@@ -538,19 +561,19 @@ inline void DestroyWrappedHandle<InstanceWrapper>(VkInstance handle)
                 for (auto display_mode_wrapper : display_wrapper->child_display_modes)
                 {
                     RemoveWrapper<DisplayModeKHRWrapper>(display_mode_wrapper);
-                    delete display_mode_wrapper;
+                    DeleteWrapper(display_mode_wrapper);
                 }
 
                 RemoveWrapper<DisplayKHRWrapper>(display_wrapper);
-                delete display_wrapper;
+                DeleteWrapper(display_wrapper);
             }
 
             RemoveWrapper<PhysicalDeviceWrapper>(physical_device_wrapper);
-            delete physical_device_wrapper;
+            DeleteWrapper(physical_device_wrapper);
         }
 
         RemoveWrapper<InstanceWrapper>(wrapper);
-        delete wrapper;
+        DeleteWrapper(wrapper);
     }
 }
 
@@ -565,11 +588,11 @@ inline void DestroyWrappedHandle<DeviceWrapper>(VkDevice handle)
         for (auto queue_wrapper : wrapper->child_queues)
         {
             RemoveWrapper<QueueWrapper>(queue_wrapper);
-            delete queue_wrapper;
+            DeleteWrapper(queue_wrapper);
         }
 
         RemoveWrapper<DeviceWrapper>(wrapper);
-        delete wrapper;
+        DeleteWrapper(wrapper);
     }
 }
 
@@ -583,7 +606,7 @@ inline void DestroyWrappedHandle<CommandBufferWrapper>(VkCommandBuffer handle)
         wrapper->parent_pool->child_buffers.erase(wrapper->handle_id);
 
         RemoveWrapper<CommandBufferWrapper>(wrapper);
-        delete wrapper;
+        DeleteWrapper(wrapper);
     }
 }
 
@@ -598,11 +621,11 @@ inline void DestroyWrappedHandle<CommandPoolWrapper>(VkCommandPool handle)
         for (const auto& buffer_wrapper : wrapper->child_buffers)
         {
             RemoveWrapper<CommandBufferWrapper>(buffer_wrapper.second);
-            delete buffer_wrapper.second;
+            DeleteWrapper(buffer_wrapper.second);
         }
 
         RemoveWrapper<CommandPoolWrapper>(wrapper);
-        delete wrapper;
+        DeleteWrapper(wrapper);
     }
 }
 
@@ -616,7 +639,7 @@ inline void DestroyWrappedHandle<DescriptorSetWrapper>(VkDescriptorSet handle)
         wrapper->parent_pool->child_sets.erase(wrapper->handle_id);
 
         RemoveWrapper<DescriptorSetWrapper>(wrapper);
-        delete wrapper;
+        DeleteWrapper(wrapper);
     }
 }
 
@@ -631,11 +654,11 @@ inline void DestroyWrappedHandle<DescriptorPoolWrapper>(VkDescriptorPool handle)
         for (const auto& set_wrapper : wrapper->child_sets)
         {
             RemoveWrapper<DescriptorSetWrapper>(set_wrapper.second);
-            delete set_wrapper.second;
+            DeleteWrapper(set_wrapper.second);
         }
 
         RemoveWrapper<DescriptorPoolWrapper>(wrapper);
-        delete wrapper;
+        DeleteWrapper(wrapper);
     }
 }
 
@@ -653,12 +676,12 @@ inline void DestroyWrappedHandle<SwapchainKHRWrapper>(VkSwapchainKHR handle)
             if (image_wrapper->parent_swapchains.empty())
             {
                 RemoveWrapper<ImageWrapper>(image_wrapper);
-                delete image_wrapper;
+                DeleteWrapper(image_wrapper);
             }
         }
 
         RemoveWrapper<SwapchainKHRWrapper>(wrapper);
-        delete wrapper;
+        DeleteWrapper(wrapper);
     }
 }
 
@@ -683,7 +706,7 @@ inline void ResetDescriptorPoolWrapper(VkDescriptorPool handle)
     for (const auto& set_wrapper : wrapper->child_sets)
     {
         RemoveWrapper<DescriptorSetWrapper>(set_wrapper.second);
-        delete set_wrapper.second;
+        DeleteWrapper(set_wrapper.second);
     }
     wrapper->child_sets.clear();
 }
@@ -26,13 +26,16 @@
 #include "encode/vulkan_handle_wrappers.h"
 #include "format/format.h"
 #include "util/defines.h"
+#include "util/sharded_hash_map.h"
 
 #include "vulkan/vulkan.h"
 
+#include <algorithm>
 #include <cassert>
 #include <functional>
-#include <map>
-#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(encode)
@@ -45,72 +48,94 @@ class VulkanStateTableBase
     ~VulkanStateTableBase() {}
 
   protected:
+    // Maps driver handles to their wrappers. Handle lookups happen on every API call that takes a handle, from every
+    // application thread, so the map is sharded to keep threads that work with different handles from contending on
+    // a single lock.
+    template <typename Wrapper>
+    using HandleWrapperMap = util::ShardedHashMap<typename Wrapper::HandleType, Wrapper*>;
+
+    // Maps capture handle IDs to wrappers. Objects are added and removed on every create and destroy call, so a hash
+    // map is used. Writing state visits the entries in ID order so that objects are written in the order that they
+    // were created, while callers that run during capture visit them in map order to avoid the cost of sorting.
     template <typename T>
-    bool InsertEntry(format::HandleId id, T* wrapper, std::map<format::HandleId, T*>& map)
+    using IdWrapperMap = std::unordered_map<format::HandleId, T*>;
+
+    template <typename T>
+    bool InsertEntry(format::HandleId id, T* wrapper, IdWrapperMap<T>& map)
     {
         const auto& inserted = map.insert(std::make_pair(id, wrapper));
         return inserted.second;
     }
 
     template <typename Wrapper>
-    bool RemoveEntry(const Wrapper* wrapper, std::map<format::HandleId, Wrapper*>& map)
+    bool RemoveEntry(const Wrapper* wrapper, IdWrapperMap<Wrapper>& map)
     {
         assert(wrapper != nullptr);
         return (map.erase(wrapper->handle_id) != 0);
     }
 
     template <typename T>
-    T* GetWrapper(format::HandleId id, std::map<format::HandleId, T*>& map)
+    T* GetWrapper(format::HandleId id, IdWrapperMap<T>& map)
     {
         auto entry = map.find(id);
         return (entry != map.end()) ? entry->second : nullptr;
     }
 
     template <typename T>
-    const T* GetWrapper(format::HandleId id, const std::map<format::HandleId, T*>& map) const
+    const T* GetWrapper(format::HandleId id, const IdWrapperMap<T>& map) const
     {
         auto entry = map.find(id);
         return (entry != map.end()) ? entry->second : nullptr;
     }
 
-    template <typename Wrapper>
-    bool InsertEntry(typename Wrapper::HandleType                                handle,
-                     Wrapper*                                                    wrapper,
-                     std::unordered_map<typename Wrapper::HandleType, Wrapper*>& map)
+    template <typename T>
+    void VisitEntries(const IdWrapperMap<T>& map, const std::function<void(T*)>& visitor) const
     {
-        const std::unique_lock<std::shared_mutex> lock(mutex_);
-        const auto&                               inserted = map.insert(std::make_pair(handle, wrapper));
-        return inserted.second;
+        std::vector<std::pair<format::HandleId, T*>> entries(map.begin(), map.end());
+        std::sort(entries.begin(), entries.end());
+
+        for (const auto& entry : entries)
+        {
+            visitor(entry.second);
+        }
+    }
+
+    template <typename T>
+    void VisitEntriesUnsorted(const IdWrapperMap<T>& map, const std::function<void(T*)>& visitor) const
+    {
+        for (const auto& entry : map)
+        {
+            visitor(entry.second);
+        }
     }
 
     template <typename Wrapper>
-    bool RemoveEntry(const typename Wrapper::HandleType                          handle,
-                     std::unordered_map<typename Wrapper::HandleType, Wrapper*>& map)
+    bool InsertEntry(typename Wrapper::HandleType handle, Wrapper* wrapper, HandleWrapperMap<Wrapper>& map)
     {
-        const std::unique_lock<std::shared_mutex> lock(mutex_);
-        return (map.erase(handle) != 0);
+        return map.Insert(handle, wrapper);
     }
 
     template <typename Wrapper>
-    Wrapper* GetWrapper(typename Wrapper::HandleType                                      handle,
-                        const std::unordered_map<typename Wrapper::HandleType, Wrapper*>& map)
+    bool RemoveEntry(const typename Wrapper::HandleType handle, HandleWrapperMap<Wrapper>& map)
     {
-        const std::shared_lock<std::shared_mutex> lock(mutex_);
-        auto                                      entry = map.find(handle);
-        return (entry != map.end()) ? entry->second : nullptr;
+        return map.Erase(handle);
     }
 
     template <typename Wrapper>
-    const Wrapper* GetWrapper(typename Wrapper::HandleType                                      handle,
-                              const std::unordered_map<typename Wrapper::HandleType, Wrapper*>& map) const
+    Wrapper* GetWrapper(typename Wrapper::HandleType handle, const HandleWrapperMap<Wrapper>& map)
     {
-        const std::shared_lock<std::shared_mutex> lock(mutex_);
-        auto                                      entry = map.find(handle);
-        return (entry != map.end()) ? entry->second : nullptr;
+        Wrapper* wrapper = nullptr;
+        map.Find(handle, wrapper);
+        return wrapper;
     }
 
-  private:
-    mutable std::shared_mutex mutex_;
+    template <typename Wrapper>
+    const Wrapper* GetWrapper(typename Wrapper::HandleType handle, const HandleWrapperMap<Wrapper>& map) const
+    {
+        Wrapper* wrapper = nullptr;
+        map.Find(handle, wrapper);
+        return wrapper;
+    }
 };
 
 GFXRECON_END_NAMESPACE(encode)
@@ -82,10 +82,7 @@ void VulkanStateTracker::TrackCommandExecution(vulkan_wrappers::CommandBufferWra
     if (call_id != format::ApiCallId::ApiCall_vkResetCommandBuffer)
     {
         // Append the command data.
-        size_t size = parameter_buffer->GetDataSize();
-        wrapper->command_data.Write(&size, sizeof(size));
-        wrapper->command_data.Write(&call_id, sizeof(call_id));
-        wrapper->command_data.Write(parameter_buffer->GetData(), size);
+        wrapper->command_data.Append(call_id, parameter_buffer->GetData(), parameter_buffer->GetDataSize());
     }
 }
 
@@ -1959,7 +1956,7 @@ void gfxrecon::encode::VulkanStateTracker::DestroyState(vulkan_wrappers::BufferW
         device_address_trackers_[wrapper->bind_device->handle].RemoveBuffer(wrapper);
     }
 
-    state_table_.VisitWrappers([&wrapper, this](vulkan_wrappers::AccelerationStructureKHRWrapper* acc_wrapper) {
+    state_table_.VisitWrappersUnsorted([&wrapper, this](vulkan_wrappers::AccelerationStructureKHRWrapper* acc_wrapper) {
         GFXRECON_ASSERT(acc_wrapper);
         for (auto& command : { &acc_wrapper->latest_build_command_, &acc_wrapper->latest_update_command_ })
         {
@@ -69,7 +69,8 @@ class VulkanStateTracker
                                        get_unique_id_fn,
                                        asset_file_stream,
                                        asset_file_name,
-                                       asset_file_stream != nullptr ? &asset_file_offsets_ : nullptr);
+                                       asset_file_stream != nullptr ? &asset_file_offsets_ : nullptr,
+                                       asset_file_stream != nullptr ? &asset_data_offsets_ : nullptr);
 
         std::unique_lock<std::mutex> lock(state_table_mutex_);
         return state_writer.WriteState(state_table_, frame_number);
@@ -83,8 +84,14 @@ class VulkanStateTracker
     {
         assert(asset_file_stream != nullptr);
 
-        VulkanStateWriter state_writer(
-            nullptr, compressor, thread_id, get_unique_id_fn, asset_file_stream, asset_file_name, &asset_file_offsets_);
+        VulkanStateWriter state_writer(nullptr,
+                                       compressor,
+                                       thread_id,
+                                       get_unique_id_fn,
+                                       asset_file_stream,
+                                       asset_file_name,
+                                       &asset_file_offsets_,
+                                       &asset_data_offsets_);
 
         std::unique_lock<std::mutex> lock(state_table_mutex_);
         return state_writer.WriteAssets(state_table_);
@@ -104,17 +111,16 @@ class VulkanStateTracker
         {
             auto wrapper = vulkan_wrappers::GetWrapper<Wrapper>(*new_handle);
 
+            // Copy the create parameters before taking the lock to keep the time spent holding it short.
+            vulkan_state_info::CreateParameters create_parameters = std::make_shared<util::MemoryOutputStream>(
+                create_parameter_buffer->GetData(), create_parameter_buffer->GetDataSize());
+
             // Adds the handle wrapper to the object state table, filtering for duplicate handle retrieval.
             std::unique_lock<std::mutex> lock(state_table_mutex_);
             if (state_table_.InsertWrapper(wrapper->handle_id, wrapper))
             {
                 vulkan_state_tracker::InitializeState<ParentHandle, Wrapper, CreateInfo>(
-                    parent_handle,
-                    wrapper,
-                    create_info,
-                    create_call_id,
-                    std::make_shared<util::MemoryOutputStream>(create_parameter_buffer->GetData(),
-                                                               create_parameter_buffer->GetDataSize()));
+                    parent_handle, wrapper, create_info, create_call_id, std::move(create_parameters));
             }
         }
     }
@@ -828,6 +834,7 @@ class VulkanStateTracker
     std::map<VkDevice, graphics::VulkanResourcesUtil> resource_utils_;
 
     VulkanStateWriter::AssetFileOffsetsInfo asset_file_offsets_;
+    VulkanStateWriter::AssetDataOffsetsInfo asset_data_offsets_;
 };
 
 GFXRECON_END_NAMESPACE(encode)
@@ -28,6 +28,7 @@
 #include "encode/vulkan_state_info.h"
 #include "format/format.h"
 #include "format/format_util.h"
+#include "util/hash.h"
 #include "util/logging.h"
 #include "custom_vulkan_array_size_2d.h"
 
@@ -35,6 +36,8 @@
 #include <array>
 #include <cassert>
 #include <cstdint>
+#include <deque>
+#include <functional>
 #include <limits>
 #include <unordered_map>
 
@@ -47,6 +50,17 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 
 const uint32_t kDefaultQueueFamilyIndex = 0;
 
+// Size of the staging buffers used to read the resource memory snapshot in batches.
+const VkDeviceSize kResourceReadbackBatchSize = 64 * 1024 * 1024;
+
+// Resource data smaller than this is always written to the asset file, as a reference to a copy of the data would
+// not be much smaller than the data.
+const size_t kMinAssetDataReferenceSize = 256;
+
+// Seeds for the two content hashes that identify resource data in the asset file.
+const uint64_t kAssetDataHashSeed      = 0;
+const uint64_t kAssetDataCheckHashSeed = 0x9e3779b97f4a7c15ULL;
+
 static bool IsMemoryCoherent(VkMemoryPropertyFlags property_flags)
 {
     return ((property_flags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) == VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
@@ -88,11 +102,12 @@ VulkanStateWriter::VulkanStateWriter(util::FileOutputStream*                  ou
                                      std::function<format::HandleId()>        get_unique_id_fn,
                                      util::FileOutputStream*                  asset_file_stream,
                                      const std::string&                       asset_file_name,
-                                     VulkanStateWriter::AssetFileOffsetsInfo* asset_file_offsets) :
+                                     VulkanStateWriter::AssetFileOffsetsInfo* asset_file_offsets,
+                                     VulkanStateWriter::AssetDataOffsetsInfo* asset_data_offsets) :
     output_stream_(output_stream),
     compressor_(compressor), thread_id_(thread_id), encoder_(&parameter_stream_),
     get_unique_id_(std::move(get_unique_id_fn)), asset_file_stream_(asset_file_stream),
-    asset_file_name_(asset_file_name), asset_file_offsets_(asset_file_offsets)
+    asset_file_name_(asset_file_name), asset_file_offsets_(asset_file_offsets), asset_data_offsets_(asset_data_offsets)
 {
     assert(output_stream != nullptr || asset_file_stream != nullptr);
 }
@@ -231,6 +246,11 @@ uint64_t VulkanStateWriter::WriteState(const VulkanStateTable& state_table, uint
     GFXRECON_LOG_INFO("--------------------------------------")
     GFXRECON_LOG_INFO("%s()", __func__)
     GFXRECON_LOG_INFO("  saved in %u ms", time);
+    auto command_memory = util::CommandRecordBlockPool::GetDefault()->GetMemoryUsage();
+    GFXRECON_LOG_INFO("  command recording memory: %zu KB in use, %zu KB peak, %zu KB idle",
+                      command_memory.in_use_size / 1024,
+                      command_memory.peak_in_use_size / 1024,
+                      command_memory.idle_size / 1024);
     GFXRECON_LOG_INFO("--------------------------------------")
 
     return blocks_written_;
@@ -2040,14 +2060,153 @@ void VulkanStateWriter::ProcessHardwareBuffer(format::HandleId memory_id,
 #endif
 }
 
+// Pipelines the staging copies of a resource memory snapshot. The copies of many resources are recorded to one
+// VulkanResourcesUtil readback batch, and the data of a completed batch is written to the capture file while the GPU
+// copies the following batches.
+class VulkanStateWriter::ResourceReadbackPipeline
+{
+  public:
+    typedef std::function<VkResult(uint64_t*)>       RecordFunction;
+    typedef std::function<void(const uint8_t* data)> WriteFunction;
+
+    ResourceReadbackPipeline(graphics::VulkanResourcesUtil& resource_util) : resource_util_(resource_util) {}
+
+    // Records a staging copy with record_copy, which returns the result of a VulkanResourcesUtil::Record*Readback()
+    // call, and calls write_data with the copied data when its batch has completed, or with nullptr if the copy
+    // failed. Returns false if the copy could not be added to a batch, in which case the resource must be read
+    // individually.
+    bool Add(const RecordFunction& record_copy, WriteFunction write_data)
+    {
+        uint64_t data_offset = 0;
+        VkResult result      = record_copy(&data_offset);
+
+        if ((result == VK_NOT_READY) && !recording_.empty())
+        {
+            Submit();
+            result = record_copy(&data_offset);
+        }
+
+        if (result != VK_SUCCESS)
+        {
+            return false;
+        }
+
+        recording_.emplace_back(PendingCopy{ data_offset, std::move(write_data) });
+
+        return true;
+    }
+
+    // Submits the batch that is being recorded and writes the data of all pending batches.
+    void Flush()
+    {
+        Submit();
+
+        while (!pending_.empty())
+        {
+            WriteOldestBatch();
+        }
+    }
+
+  private:
+    struct PendingCopy
+    {
+        uint64_t      data_offset;
+        WriteFunction write_data;
+    };
+
+    typedef std::vector<PendingCopy> PendingCopyList;
+
+    void Submit()
+    {
+        if (recording_.empty())
+        {
+            return;
+        }
+
+        if (resource_util_.GetPendingReadbackBatchCount() == (graphics::VulkanResourcesUtil::kReadbackBatchCount - 1))
+        {
+            WriteOldestBatch();
+        }
+
+        if (resource_util_.SubmitReadbackBatch() == VK_SUCCESS)
+        {
+            pending_.emplace_back(std::move(recording_));
+        }
+        else
+        {
+            for (const auto& copy : recording_)
+            {
+                copy.write_data(nullptr);
+            }
+        }
+
+        recording_.clear();
+    }
+
+    void WriteOldestBatch()
+    {
+        assert(!pending_.empty());
+
+        const uint8_t* data   = nullptr;
+        VkResult       result = resource_util_.WaitReadbackBatch(&data);
+
+        for (const auto& copy : pending_.front())
+        {
+            copy.write_data((result == VK_SUCCESS) ? (data + copy.data_offset) : nullptr);
+        }
+
+        pending_.pop_front();
+    }
+
+  private:
+    graphics::VulkanResourcesUtil& resource_util_;
+    PendingCopyList                recording_;
+    std::deque<PendingCopyList>    pending_;
+};
+
+const uint8_t* VulkanStateWriter::MapResourceMemory(const vulkan_wrappers::DeviceWrapper*       device_wrapper,
+                                                    const vulkan_wrappers::DeviceMemoryWrapper* memory_wrapper,
+                                                    VkMemoryPropertyFlags                       memory_properties,
+                                                    VkDeviceSize                                offset,
+                                                    VkDeviceSize                                size)
+{
+    assert((device_wrapper != nullptr) && (memory_wrapper != nullptr) &&
+           ((memory_wrapper->mapped_data == nullptr) || (memory_wrapper->mapped_offset == 0)));
+
+    const VulkanDeviceTable* device_table = &device_wrapper->layer_table;
+    const uint8_t*           bytes        = nullptr;
+    VkResult                 result       = VK_SUCCESS;
+
+    if (memory_wrapper->mapped_data == nullptr)
+    {
+        void* map_ptr = nullptr;
+        result = device_table->MapMemory(device_wrapper->handle, memory_wrapper->handle, offset, size, 0, &map_ptr);
+
+        if (result == VK_SUCCESS)
+        {
+            bytes = reinterpret_cast<const uint8_t*>(map_ptr);
+        }
+    }
+    else
+    {
+        bytes = reinterpret_cast<const uint8_t*>(memory_wrapper->mapped_data) + offset;
+    }
+
+    if ((result == VK_SUCCESS) && !IsMemoryCoherent(memory_properties))
+    {
+        InvalidateMappedMemoryRange(device_wrapper, memory_wrapper->handle, offset, size);
+    }
+
+    return bytes;
+}
+
 void VulkanStateWriter::ProcessBufferMemory(const vulkan_wrappers::DeviceWrapper*  device_wrapper,
                                             const std::vector<BufferSnapshotInfo>& buffer_snapshot_info,
-                                            graphics::VulkanResourcesUtil&         resource_util)
+                                            graphics::VulkanResourcesUtil&         resource_util,
+                                            ResourceReadbackPipeline&              readback_pipeline)
 {
     assert(device_wrapper != nullptr);
 
-    const VulkanDeviceTable* device_table = &device_wrapper->layer_table;
-
     for (const auto& snapshot_entry : buffer_snapshot_info)
     {
         const vulkan_wrappers::BufferWrapper*       buffer_wrapper = snapshot_entry.buffer_wrapper;
@@ -2059,6 +2218,18 @@ void VulkanStateWriter::ProcessBufferMemory(const vulkan_wrappers::DeviceWrapper
 
         if (snapshot_entry.need_staging_copy)
         {
+            if (readback_pipeline.Add(
+                    [&](uint64_t* data_offset) {
+                        return resource_util.RecordBufferReadback(
+                            buffer_wrapper->handle, buffer_wrapper->size, 0, data_offset);
+                    },
+                    [this, device_wrapper, &snapshot_entry](const uint8_t* batch_data) {
+                        WriteBufferMemory(device_wrapper, snapshot_entry, batch_data);
+                    }))
+            {
+                continue;
+            }
+
             VkResult result = resource_util.ReadFromBufferResource(
                 buffer_wrapper->handle, buffer_wrapper->size, 0, buffer_wrapper->queue_family_index, data);
 
@@ -2069,94 +2240,79 @@ void VulkanStateWriter::ProcessBufferMemory(const vulkan_wrappers::DeviceWrapper
         }
         else
         {
-            assert((memory_wrapper->mapped_data == nullptr) || (memory_wrapper->mapped_offset == 0));
-
-            VkResult result = VK_SUCCESS;
+            bytes = MapResourceMemory(device_wrapper,
+                                      memory_wrapper,
+                                      snapshot_entry.memory_properties,
+                                      buffer_wrapper->bind_offset,
+                                      buffer_wrapper->size);
+        }
 
-            if (memory_wrapper->mapped_data == nullptr)
-            {
-                void* map_ptr = nullptr;
-                result        = device_table->MapMemory(device_wrapper->handle,
-                                                 memory_wrapper->handle,
-                                                 buffer_wrapper->bind_offset,
-                                                 buffer_wrapper->size,
-                                                 0,
-                                                 &map_ptr);
+        WriteBufferMemory(device_wrapper, snapshot_entry, bytes);
+    }
+}
 
-                if (result == VK_SUCCESS)
-                {
-                    bytes = reinterpret_cast<const uint8_t*>(map_ptr);
-                }
-            }
-            else
-            {
-                bytes = reinterpret_cast<const uint8_t*>(memory_wrapper->mapped_data) + buffer_wrapper->bind_offset;
-            }
+void VulkanStateWriter::WriteBufferMemory(const vulkan_wrappers::DeviceWrapper* device_wrapper,
+                                          const BufferSnapshotInfo&             snapshot_entry,
+                                          const uint8_t*                        bytes)
+{
+    const vulkan_wrappers::BufferWrapper*       buffer_wrapper = snapshot_entry.buffer_wrapper;
+    const vulkan_wrappers::DeviceMemoryWrapper* memory_wrapper = snapshot_entry.memory_wrapper;
 
-            if ((result == VK_SUCCESS) && !IsMemoryCoherent(snapshot_entry.memory_properties))
-            {
-                InvalidateMappedMemoryRange(
-                    device_wrapper, memory_wrapper->handle, buffer_wrapper->bind_offset, buffer_wrapper->size);
-            }
-        }
+    if (bytes != nullptr)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, buffer_wrapper->size);
 
-        if (bytes != nullptr)
-        {
-            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, buffer_wrapper->size);
+        size_t                          data_size = static_cast<size_t>(buffer_wrapper->size);
+        format::InitBufferCommandHeader upload_cmd;
 
-            size_t                          data_size = static_cast<size_t>(buffer_wrapper->size);
-            format::InitBufferCommandHeader upload_cmd;
+        upload_cmd.meta_header.block_header.type = format::kMetaDataBlock;
+        upload_cmd.meta_header.meta_data_id =
+            format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan, format::MetaDataType::kInitBufferCommand);
+        upload_cmd.thread_id = thread_id_;
+        upload_cmd.device_id = device_wrapper->handle_id;
+        upload_cmd.buffer_id = buffer_wrapper->handle_id;
+        upload_cmd.data_size = data_size;
 
-            upload_cmd.meta_header.block_header.type = format::kMetaDataBlock;
-            upload_cmd.meta_header.meta_data_id =
-                format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan, format::MetaDataType::kInitBufferCommand);
-            upload_cmd.thread_id = thread_id_;
-            upload_cmd.device_id = device_wrapper->handle_id;
-            upload_cmd.buffer_id = buffer_wrapper->handle_id;
-            upload_cmd.data_size = data_size;
+        if (compressor_ != nullptr)
+        {
+            size_t compressed_size = compressor_->Compress(data_size, bytes, &compressed_parameter_buffer_, 0);
 
-            if (compressor_ != nullptr)
+            if ((compressed_size > 0) && (compressed_size < data_size))
             {
-                size_t compressed_size = compressor_->Compress(data_size, bytes, &compressed_parameter_buffer_, 0);
-
-                if ((compressed_size > 0) && (compressed_size < data_size))
-                {
-                    upload_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+                upload_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
 
-                    bytes     = compressed_parameter_buffer_.data();
-                    data_size = compressed_size;
-                }
+                bytes     = compressed_parameter_buffer_.data();
+                data_size = compressed_size;
             }
+        }
 
-            // Calculate size of packet with compressed or uncompressed data size.
-            upload_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(upload_cmd) + data_size;
+        // Calculate size of packet with compressed or uncompressed data size.
+        upload_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(upload_cmd) + data_size;
 
-            output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
-            output_stream_->Write(bytes, data_size);
-            ++blocks_written_;
+        output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
+        output_stream_->Write(bytes, data_size);
+        ++blocks_written_;
 
-            if (!snapshot_entry.need_staging_copy && memory_wrapper->mapped_data == nullptr)
-            {
-                device_table->UnmapMemory(device_wrapper->handle, memory_wrapper->handle);
-            }
-        }
-        else
+        if (!snapshot_entry.need_staging_copy && memory_wrapper->mapped_data == nullptr)
         {
-            GFXRECON_LOG_ERROR("Trimming state snapshot failed to retrieve memory content for buffer %" PRIu64,
-                               buffer_wrapper->handle_id);
+            device_wrapper->layer_table.UnmapMemory(device_wrapper->handle, memory_wrapper->handle);
         }
     }
+    else
+    {
+        GFXRECON_LOG_ERROR("Trimming state snapshot failed to retrieve memory content for buffer %" PRIu64,
+                           buffer_wrapper->handle_id);
+    }
 }
 
 void VulkanStateWriter::ProcessBufferMemoryWithAssetFile(const vulkan_wrappers::DeviceWrapper*  device_wrapper,
                                                          const std::vector<BufferSnapshotInfo>& buffer_snapshot_info,
-                                                         graphics::VulkanResourcesUtil&         resource_util)
+                                                         graphics::VulkanResourcesUtil&         resource_util,
+                                                         ResourceReadbackPipeline&              readback_pipeline)
 {
     assert(device_wrapper != nullptr);
     assert(asset_file_stream_ != nullptr);
 
-    const VulkanDeviceTable* device_table = &device_wrapper->layer_table;
-
     for (const auto& snapshot_entry : buffer_snapshot_info)
     {
         vulkan_wrappers::BufferWrapper*             buffer_wrapper = snapshot_entry.buffer_wrapper;
@@ -2173,6 +2329,18 @@ void VulkanStateWriter::ProcessBufferMemoryWithAssetFile(const vulkan_wrappers::
 
             if (snapshot_entry.need_staging_copy)
             {
+                if (readback_pipeline.Add(
+                        [&](uint64_t* data_offset) {
+                            return resource_util.RecordBufferReadback(
+                                buffer_wrapper->handle, buffer_wrapper->size, 0, data_offset);
+                        },
+                        [this, device_wrapper, &snapshot_entry](const uint8_t* batch_data) {
+                            WriteBufferMemoryToAssetFile(device_wrapper, snapshot_entry, batch_data);
+                        }))
+                {
+                    continue;
+                }
+
                 VkResult result = resource_util.ReadFromBufferResource(
                     buffer_wrapper->handle, buffer_wrapper->size, 0, buffer_wrapper->queue_family_index, data);
 
@@ -2183,113 +2351,143 @@ void VulkanStateWriter::ProcessBufferMemoryWithAssetFile(const vulkan_wrappers::
             }
             else
             {
-                assert((memory_wrapper->mapped_data == nullptr) || (memory_wrapper->mapped_offset == 0));
-
-                VkResult result = VK_SUCCESS;
-
-                if (memory_wrapper->mapped_data == nullptr)
-                {
-                    void* map_ptr = nullptr;
-                    result        = device_table->MapMemory(device_wrapper->handle,
-                                                     memory_wrapper->handle,
-                                                     buffer_wrapper->bind_offset,
-                                                     buffer_wrapper->size,
-                                                     0,
-                                                     &map_ptr);
-
-                    if (result == VK_SUCCESS)
-                    {
-                        bytes = reinterpret_cast<const uint8_t*>(map_ptr);
-                    }
-                }
-                else
-                {
-                    bytes = reinterpret_cast<const uint8_t*>(memory_wrapper->mapped_data) + buffer_wrapper->bind_offset;
-                }
-
-                if ((result == VK_SUCCESS) && !IsMemoryCoherent(snapshot_entry.memory_properties))
-                {
-                    InvalidateMappedMemoryRange(
-                        device_wrapper, memory_wrapper->handle, buffer_wrapper->bind_offset, buffer_wrapper->size);
-                }
+                bytes = MapResourceMemory(device_wrapper,
+                                          memory_wrapper,
+                                          snapshot_entry.memory_properties,
+                                          buffer_wrapper->bind_offset,
+                                          buffer_wrapper->size);
             }
 
             assert(bytes);
 
-            if (bytes != nullptr)
+            WriteBufferMemoryToAssetFile(device_wrapper, snapshot_entry, bytes);
+        }
+        else
+        {
+            if (output_stream_ != nullptr)
             {
-                GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, buffer_wrapper->size);
-
-                size_t                          data_size = static_cast<size_t>(buffer_wrapper->size);
-                format::InitBufferCommandHeader upload_cmd;
+                assert((*asset_file_offsets_).find(buffer_wrapper->handle_id) != (*asset_file_offsets_).end());
+                const int64_t offset = (*asset_file_offsets_)[buffer_wrapper->handle_id];
+                WriteExecuteFromFile(asset_file_name_, 1, offset);
+            }
+        }
+    }
+}
 
-                upload_cmd.meta_header.block_header.type = format::kMetaDataBlock;
-                upload_cmd.meta_header.meta_data_id      = format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan,
-                                                                             format::MetaDataType::kInitBufferCommand);
-                upload_cmd.thread_id                     = thread_id_;
-                upload_cmd.device_id                     = device_wrapper->handle_id;
-                upload_cmd.buffer_id                     = buffer_wrapper->handle_id;
-                upload_cmd.data_size                     = data_size;
+void VulkanStateWriter::WriteBufferMemoryToAssetFile(const vulkan_wrappers::DeviceWrapper* device_wrapper,
+                                                     const BufferSnapshotInfo&             snapshot_entry,
+                                                     const uint8_t*                        bytes)
+{
+    const vulkan_wrappers::BufferWrapper*       buffer_wrapper = snapshot_entry.buffer_wrapper;
+    const vulkan_wrappers::DeviceMemoryWrapper* memory_wrapper = snapshot_entry.memory_wrapper;
 
-                if (compressor_ != nullptr)
-                {
-                    size_t compressed_size = compressor_->Compress(data_size, bytes, &compressed_parameter_buffer_, 0);
+    if (bytes != nullptr)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, buffer_wrapper->size);
 
-                    if ((compressed_size > 0) && (compressed_size < data_size))
-                    {
-                        upload_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+        size_t                          data_size = static_cast<size_t>(buffer_wrapper->size);
+        format::InitBufferCommandHeader upload_cmd;
 
-                        bytes     = compressed_parameter_buffer_.data();
-                        data_size = compressed_size;
-                    }
-                }
+        upload_cmd.meta_header.block_header.type = format::kMetaDataBlock;
+        upload_cmd.meta_header.meta_data_id =
+            format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan, format::MetaDataType::kInitBufferCommand);
+        upload_cmd.thread_id = thread_id_;
+        upload_cmd.device_id = device_wrapper->handle_id;
+        upload_cmd.buffer_id = buffer_wrapper->handle_id;
+        upload_cmd.data_size = data_size;
 
-                // Calculate size of packet with compressed or uncompressed data size.
-                upload_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(upload_cmd) + data_size;
+        const int64_t offset            = asset_file_stream_->GetOffset();
+        int64_t       data_block_offset = 0;
 
-                const int64_t offset = asset_file_stream_->GetOffset();
-                asset_file_stream_->Write(&upload_cmd, sizeof(upload_cmd));
-                asset_file_stream_->Write(bytes, data_size);
-                (*asset_file_offsets_)[buffer_wrapper->handle_id] = offset;
+        if (FindAssetData(bytes, data_size, offset, &data_block_offset))
+        {
+            WriteAssetDataReference(format::MetaDataType::kInitBufferCommand,
+                                    data_block_offset,
+                                    &upload_cmd.thread_id,
+                                    sizeof(upload_cmd) - sizeof(upload_cmd.meta_header),
+                                    nullptr,
+                                    0);
+        }
+        else
+        {
+            if (compressor_ != nullptr)
+            {
+                size_t compressed_size = compressor_->Compress(data_size, bytes, &compressed_parameter_buffer_, 0);
 
-                if (output_stream_ != nullptr)
+                if ((compressed_size > 0) && (compressed_size < data_size))
                 {
-                    WriteExecuteFromFile(asset_file_name_, 1, offset);
-                }
-
-                ++blocks_written_;
+                    upload_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
 
-                if (!snapshot_entry.need_staging_copy && memory_wrapper->mapped_data == nullptr)
-                {
-                    device_table->UnmapMemory(device_wrapper->handle, memory_wrapper->handle);
+                    bytes     = compressed_parameter_buffer_.data();
+                    data_size = compressed_size;
                 }
             }
-            else
-            {
-                GFXRECON_LOG_ERROR("Trimming state snapshot failed to retrieve memory content for buffer %" PRIu64,
-                                   buffer_wrapper->handle_id);
-            }
+
+            // Calculate size of packet with compressed or uncompressed data size.
+            upload_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(upload_cmd) + data_size;
+
+            asset_file_stream_->Write(&upload_cmd, sizeof(upload_cmd));
+            asset_file_stream_->Write(bytes, data_size);
         }
-        else
+
+        (*asset_file_offsets_)[buffer_wrapper->handle_id] = offset;
+
+        if (output_stream_ != nullptr)
         {
-            if (output_stream_ != nullptr)
-            {
-                assert((*asset_file_offsets_).find(buffer_wrapper->handle_id) != (*asset_file_offsets_).end());
-                const int64_t offset = (*asset_file_offsets_)[buffer_wrapper->handle_id];
-                WriteExecuteFromFile(asset_file_name_, 1, offset);
-            }
+            WriteExecuteFromFile(asset_file_name_, 1, offset);
+        }
+
+        ++blocks_written_;
+
+        if (!snapshot_entry.need_staging_copy && memory_wrapper->mapped_data == nullptr)
+        {
+            device_wrapper->layer_table.UnmapMemory(device_wrapper->handle, memory_wrapper->handle);
         }
     }
+    else
+    {
+        GFXRECON_LOG_ERROR("Trimming state snapshot failed to retrieve memory content for buffer %" PRIu64,
+                           buffer_wrapper->handle_id);
+    }
+}
+
+bool VulkanStateWriter::AddImageReadback(const ImageSnapshotInfo&                   snapshot_entry,
+                                         graphics::VulkanResourcesUtil&             resource_util,
+                                         ResourceReadbackPipeline&                  readback_pipeline,
+                                         const std::function<void(const uint8_t*)>& write_data)
+{
+    const vulkan_wrappers::ImageWrapper* image_wrapper = snapshot_entry.image_wrapper;
+
+    // Multisampled images are resolved to a temporary image, and are read individually.
+    if (image_wrapper->samples != VK_SAMPLE_COUNT_1_BIT)
+    {
+        return false;
+    }
+
+    return readback_pipeline.Add(
+        [&](uint64_t* data_offset) {
+            return resource_util.RecordImageReadback(image_wrapper->handle,
+                                                     image_wrapper->format,
+                                                     image_wrapper->image_type,
+                                                     image_wrapper->extent,
+                                                     image_wrapper->mip_levels,
+                                                     image_wrapper->array_layers,
+                                                     image_wrapper->tiling,
+                                                     image_wrapper->current_layout,
+                                                     image_wrapper->queue_family_index,
+                                                     snapshot_entry.aspect,
+                                                     data_offset);
+        },
+        write_data);
 }
 
 void VulkanStateWriter::ProcessImageMemory(const vulkan_wrappers::DeviceWrapper* device_wrapper,
                                            const std::vector<ImageSnapshotInfo>& image_snapshot_info,
-                                           graphics::VulkanResourcesUtil&        resource_util)
+                                           graphics::VulkanResourcesUtil&        resource_util,
+                                           ResourceReadbackPipeline&             readback_pipeline)
 {
     assert(device_wrapper != nullptr);
 
-    const VulkanDeviceTable* device_table = &device_wrapper->layer_table;
-
     for (const auto& snapshot_entry : image_snapshot_info)
     {
         const vulkan_wrappers::ImageWrapper*        image_wrapper  = snapshot_entry.image_wrapper;
@@ -2302,6 +2500,16 @@ void VulkanStateWriter::ProcessImageMemory(const vulkan_wrappers::DeviceWrapper*
 
         if (snapshot_entry.need_staging_copy)
         {
+            if (AddImageReadback(snapshot_entry,
+                                 resource_util,
+                                 readback_pipeline,
+                                 [this, device_wrapper, &snapshot_entry](const uint8_t* batch_data) {
+                                     WriteImageMemory(device_wrapper, snapshot_entry, batch_data);
+                                 }))
+            {
+                continue;
+            }
+
             std::vector<uint64_t> subresource_offsets;
             std::vector<uint64_t> subresource_sizes;
             bool                  scaling_supported;
@@ -2330,116 +2538,100 @@ void VulkanStateWriter::ProcessImageMemory(const vulkan_wrappers::DeviceWrapper*
         }
         else if (!image_wrapper->is_swapchain_image)
         {
-            assert((memory_wrapper != nullptr) &&
-                   ((memory_wrapper->mapped_data == nullptr) || (memory_wrapper->mapped_offset == 0)));
-
-            VkResult result = VK_SUCCESS;
+            bytes = MapResourceMemory(device_wrapper,
+                                      memory_wrapper,
+                                      snapshot_entry.memory_properties,
+                                      image_wrapper->bind_offset,
+                                      snapshot_entry.resource_size);
+        }
 
-            if (memory_wrapper->mapped_data == nullptr)
-            {
-                void* map_ptr = nullptr;
-                result        = device_table->MapMemory(device_wrapper->handle,
-                                                 memory_wrapper->handle,
-                                                 image_wrapper->bind_offset,
-                                                 snapshot_entry.resource_size,
-                                                 0,
-                                                 &map_ptr);
+        WriteImageMemory(device_wrapper, snapshot_entry, bytes);
+    }
+}
 
-                if (result == VK_SUCCESS)
-                {
-                    bytes = reinterpret_cast<const uint8_t*>(map_ptr);
-                }
-            }
-            else
-            {
-                bytes = reinterpret_cast<const uint8_t*>(memory_wrapper->mapped_data) + image_wrapper->bind_offset;
-            }
+void VulkanStateWriter::WriteImageMemory(const vulkan_wrappers::DeviceWrapper* device_wrapper,
+                                         const ImageSnapshotInfo&              snapshot_entry,
+                                         const uint8_t*                        bytes)
+{
+    const vulkan_wrappers::ImageWrapper*        image_wrapper  = snapshot_entry.image_wrapper;
+    const vulkan_wrappers::DeviceMemoryWrapper* memory_wrapper = snapshot_entry.memory_wrapper;
 
-            if ((result == VK_SUCCESS) && !IsMemoryCoherent(snapshot_entry.memory_properties))
-            {
-                InvalidateMappedMemoryRange(
-                    device_wrapper, memory_wrapper->handle, image_wrapper->bind_offset, snapshot_entry.resource_size);
-            }
-        }
+    if (!image_wrapper->is_swapchain_image)
+    {
+        format::InitImageCommandHeader upload_cmd;
+
+        // Packet size without the resource data.
+        upload_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(upload_cmd);
+        upload_cmd.meta_header.block_header.type = format::kMetaDataBlock;
+        upload_cmd.meta_header.meta_data_id =
+            format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan, format::MetaDataType::kInitImageCommand);
+        upload_cmd.thread_id = thread_id_;
+        upload_cmd.device_id = device_wrapper->handle_id;
+        upload_cmd.image_id  = image_wrapper->handle_id;
+        upload_cmd.aspect    = snapshot_entry.aspect;
+        upload_cmd.layout    = image_wrapper->current_layout;
 
-        if (!image_wrapper->is_swapchain_image)
+        if (bytes != nullptr)
         {
-            format::InitImageCommandHeader upload_cmd;
-
-            // Packet size without the resource data.
-            upload_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(upload_cmd);
-            upload_cmd.meta_header.block_header.type = format::kMetaDataBlock;
-            upload_cmd.meta_header.meta_data_id =
-                format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan, format::MetaDataType::kInitImageCommand);
-            upload_cmd.thread_id = thread_id_;
-            upload_cmd.device_id = device_wrapper->handle_id;
-            upload_cmd.image_id  = image_wrapper->handle_id;
-            upload_cmd.aspect    = snapshot_entry.aspect;
-            upload_cmd.layout    = image_wrapper->current_layout;
-
-            if (bytes != nullptr)
-            {
-                GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, snapshot_entry.resource_size);
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, snapshot_entry.resource_size);
 
-                size_t data_size = static_cast<size_t>(snapshot_entry.resource_size);
+            size_t data_size = static_cast<size_t>(snapshot_entry.resource_size);
 
-                // Store uncompressed data size in packet.
-                upload_cmd.data_size   = data_size;
-                upload_cmd.level_count = image_wrapper->mip_levels;
+            // Store uncompressed data size in packet.
+            upload_cmd.data_size   = data_size;
+            upload_cmd.level_count = image_wrapper->mip_levels;
 
-                if (compressor_ != nullptr)
-                {
-                    size_t compressed_size = compressor_->Compress(data_size, bytes, &compressed_parameter_buffer_, 0);
+            if (compressor_ != nullptr)
+            {
+                size_t compressed_size = compressor_->Compress(data_size, bytes, &compressed_parameter_buffer_, 0);
 
-                    if ((compressed_size > 0) && (compressed_size < data_size))
-                    {
-                        upload_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+                if ((compressed_size > 0) && (compressed_size < data_size))
+                {
+                    upload_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
 
-                        bytes     = compressed_parameter_buffer_.data();
-                        data_size = compressed_size;
-                    }
+                    bytes     = compressed_parameter_buffer_.data();
+                    data_size = compressed_size;
                 }
+            }
 
-                // Calculate size of packet with compressed or uncompressed data size.
-                assert(!snapshot_entry.level_sizes.empty() &&
-                       (snapshot_entry.level_sizes.size() == upload_cmd.level_count));
-                size_t levels_size = snapshot_entry.level_sizes.size() * sizeof(snapshot_entry.level_sizes[0]);
+            // Calculate size of packet with compressed or uncompressed data size.
+            assert(!snapshot_entry.level_sizes.empty() &&
+                   (snapshot_entry.level_sizes.size() == upload_cmd.level_count));
+            size_t levels_size = snapshot_entry.level_sizes.size() * sizeof(snapshot_entry.level_sizes[0]);
 
-                upload_cmd.meta_header.block_header.size += levels_size + data_size;
+            upload_cmd.meta_header.block_header.size += levels_size + data_size;
 
-                output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
-                output_stream_->Write(snapshot_entry.level_sizes.data(), levels_size);
-                output_stream_->Write(bytes, data_size);
+            output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
+            output_stream_->Write(snapshot_entry.level_sizes.data(), levels_size);
+            output_stream_->Write(bytes, data_size);
 
-                if (!snapshot_entry.need_staging_copy && memory_wrapper->mapped_data == nullptr)
-                {
-                    device_table->UnmapMemory(device_wrapper->handle, memory_wrapper->handle);
-                }
-            }
-            else
+            if (!snapshot_entry.need_staging_copy && memory_wrapper->mapped_data == nullptr)
             {
-                // Write a packet without resource data; replay must still perform a layout transition at image
-                // initialization.
-                upload_cmd.data_size   = 0;
-                upload_cmd.level_count = 0;
-
-                output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
+                device_wrapper->layer_table.UnmapMemory(device_wrapper->handle, memory_wrapper->handle);
             }
+        }
+        else
+        {
+            // Write a packet without resource data; replay must still perform a layout transition at image
+            // initialization.
+            upload_cmd.data_size   = 0;
+            upload_cmd.level_count = 0;
 
-            ++blocks_written_;
+            output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
         }
+
+        ++blocks_written_;
     }
 }
 
 void VulkanStateWriter::ProcessImageMemoryWithAssetFile(const vulkan_wrappers::DeviceWrapper* device_wrapper,
                                                         const std::vector<ImageSnapshotInfo>& image_snapshot_info,
-                                                        graphics::VulkanResourcesUtil&        resource_util)
+                                                        graphics::VulkanResourcesUtil&        resource_util,
+                                                        ResourceReadbackPipeline&             readback_pipeline)
 {
     assert(device_wrapper != nullptr);
     assert(asset_file_stream_ != nullptr);
 
-    const VulkanDeviceTable* device_table = &device_wrapper->layer_table;
-
     for (const auto& snapshot_entry : image_snapshot_info)
     {
         vulkan_wrappers::ImageWrapper*              image_wrapper  = snapshot_entry.image_wrapper;
@@ -2458,6 +2650,16 @@ void VulkanStateWriter::ProcessImageMemoryWithAssetFile(const vulkan_wrappers::D
 
             if (snapshot_entry.need_staging_copy)
             {
+                if (AddImageReadback(snapshot_entry,
+                                     resource_util,
+                                     readback_pipeline,
+                                     [this, device_wrapper, &snapshot_entry](const uint8_t* batch_data) {
+                                         WriteImageMemoryToAssetFile(device_wrapper, snapshot_entry, batch_data);
+                                     }))
+                {
+                    continue;
+                }
+
                 std::vector<uint64_t> subresource_offsets;
                 std::vector<uint64_t> subresource_sizes;
                 bool                  scaling_supported;
@@ -2486,127 +2688,124 @@ void VulkanStateWriter::ProcessImageMemoryWithAssetFile(const vulkan_wrappers::D
             }
             else if (!image_wrapper->is_swapchain_image)
             {
-                assert((memory_wrapper != nullptr) &&
-                       ((memory_wrapper->mapped_data == nullptr) || (memory_wrapper->mapped_offset == 0)));
-
-                VkResult result = VK_SUCCESS;
-
-                if (memory_wrapper->mapped_data == nullptr)
-                {
-                    void* map_ptr = nullptr;
-                    result        = device_table->MapMemory(device_wrapper->handle,
-                                                     memory_wrapper->handle,
-                                                     image_wrapper->bind_offset,
-                                                     snapshot_entry.resource_size,
-                                                     0,
-                                                     &map_ptr);
-
-                    if (result == VK_SUCCESS)
-                    {
-                        bytes = reinterpret_cast<const uint8_t*>(map_ptr);
-                    }
-                }
-                else
-                {
-                    bytes = reinterpret_cast<const uint8_t*>(memory_wrapper->mapped_data) + image_wrapper->bind_offset;
-                }
-
-                if ((result == VK_SUCCESS) && !IsMemoryCoherent(snapshot_entry.memory_properties))
-                {
-                    InvalidateMappedMemoryRange(device_wrapper,
-                                                memory_wrapper->handle,
-                                                image_wrapper->bind_offset,
-                                                snapshot_entry.resource_size);
-                }
+                bytes = MapResourceMemory(device_wrapper,
+                                          memory_wrapper,
+                                          snapshot_entry.memory_properties,
+                                          image_wrapper->bind_offset,
+                                          snapshot_entry.resource_size);
             }
 
-            if (!image_wrapper->is_swapchain_image)
+            WriteImageMemoryToAssetFile(device_wrapper, snapshot_entry, bytes);
+        }
+        else
+        {
+            if (output_stream_ != nullptr)
             {
-                format::InitImageCommandHeader upload_cmd;
-
-                // Packet size without the resource data.
-                upload_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(upload_cmd);
-                upload_cmd.meta_header.block_header.type = format::kMetaDataBlock;
-                upload_cmd.meta_header.meta_data_id      = format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan,
-                                                                             format::MetaDataType::kInitImageCommand);
-                upload_cmd.thread_id                     = thread_id_;
-                upload_cmd.device_id                     = device_wrapper->handle_id;
-                upload_cmd.image_id                      = image_wrapper->handle_id;
-                upload_cmd.aspect                        = snapshot_entry.aspect;
-                upload_cmd.layout                        = image_wrapper->current_layout;
-
-                if (bytes != nullptr)
-                {
-                    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, snapshot_entry.resource_size);
+                assert((*asset_file_offsets_).find(image_wrapper->handle_id) != (*asset_file_offsets_).end());
+                const int64_t offset = (*asset_file_offsets_)[image_wrapper->handle_id];
+                WriteExecuteFromFile(asset_file_name_, 1, offset);
+            }
+        }
+    }
+}
 
-                    size_t data_size = static_cast<size_t>(snapshot_entry.resource_size);
+void VulkanStateWriter::WriteImageMemoryToAssetFile(const vulkan_wrappers::DeviceWrapper* device_wrapper,
+                                                    const ImageSnapshotInfo&              snapshot_entry,
+                                                    const uint8_t*                        bytes)
+{
+    const vulkan_wrappers::ImageWrapper*        image_wrapper  = snapshot_entry.image_wrapper;
+    const vulkan_wrappers::DeviceMemoryWrapper* memory_wrapper = snapshot_entry.memory_wrapper;
 
-                    // Store uncompressed data size in packet.
-                    upload_cmd.data_size   = data_size;
-                    upload_cmd.level_count = image_wrapper->mip_levels;
+    if (!image_wrapper->is_swapchain_image)
+    {
+        format::InitImageCommandHeader upload_cmd;
+
+        // Packet size without the resource data.
+        upload_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(upload_cmd);
+        upload_cmd.meta_header.block_header.type = format::kMetaDataBlock;
+        upload_cmd.meta_header.meta_data_id =
+            format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan, format::MetaDataType::kInitImageCommand);
+        upload_cmd.thread_id = thread_id_;
+        upload_cmd.device_id = device_wrapper->handle_id;
+        upload_cmd.image_id  = image_wrapper->handle_id;
+        upload_cmd.aspect    = snapshot_entry.aspect;
+        upload_cmd.layout    = image_wrapper->current_layout;
 
-                    if (compressor_ != nullptr)
-                    {
-                        size_t compressed_size =
-                            compressor_->Compress(data_size, bytes, &compressed_parameter_buffer_, 0);
+        if (bytes != nullptr)
+        {
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, snapshot_entry.resource_size);
 
-                        if ((compressed_size > 0) && (compressed_size < data_size))
-                        {
-                            upload_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+            size_t data_size = static_cast<size_t>(snapshot_entry.resource_size);
 
-                            bytes     = compressed_parameter_buffer_.data();
-                            data_size = compressed_size;
-                        }
-                    }
+            // Store uncompressed data size in packet.
+            upload_cmd.data_size   = data_size;
+            upload_cmd.level_count = image_wrapper->mip_levels;
 
-                    // Calculate size of packet with compressed or uncompressed data size.
-                    assert(!snapshot_entry.level_sizes.empty() &&
-                           (snapshot_entry.level_sizes.size() == upload_cmd.level_count));
-                    size_t levels_size = snapshot_entry.level_sizes.size() * sizeof(snapshot_entry.level_sizes[0]);
+            assert(!snapshot_entry.level_sizes.empty() &&
+                   (snapshot_entry.level_sizes.size() == upload_cmd.level_count));
+            size_t levels_size = snapshot_entry.level_sizes.size() * sizeof(snapshot_entry.level_sizes[0]);
 
-                    upload_cmd.meta_header.block_header.size += levels_size + data_size;
+            const int64_t offset                             = asset_file_stream_->GetOffset();
+            int64_t       data_block_offset                  = 0;
+            (*asset_file_offsets_)[image_wrapper->handle_id] = offset;
 
-                    const int64_t offset                             = asset_file_stream_->GetOffset();
-                    (*asset_file_offsets_)[image_wrapper->handle_id] = offset;
-                    asset_file_stream_->Write(&upload_cmd, sizeof(upload_cmd));
-                    asset_file_stream_->Write(snapshot_entry.level_sizes.data(), levels_size);
-                    asset_file_stream_->Write(bytes, data_size);
+            if (FindAssetData(bytes, data_size, offset, &data_block_offset))
+            {
+                WriteAssetDataReference(format::MetaDataType::kInitImageCommand,
+                                        data_block_offset,
+                                        &upload_cmd.thread_id,
+                                        sizeof(upload_cmd) - sizeof(upload_cmd.meta_header),
+                                        snapshot_entry.level_sizes.data(),
+                                        levels_size);
+            }
+            else
+            {
+                if (compressor_ != nullptr)
+                {
+                    size_t compressed_size =
+                        compressor_->Compress(data_size, bytes, &compressed_parameter_buffer_, 0);
 
-                    if (output_stream_ != nullptr)
+                    if ((compressed_size > 0) && (compressed_size < data_size))
                     {
-                        WriteExecuteFromFile(asset_file_name_, 1, offset);
-                    }
+                        upload_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
 
-                    if (!snapshot_entry.need_staging_copy && memory_wrapper->mapped_data == nullptr)
-                    {
-                        device_table->UnmapMemory(device_wrapper->handle, memory_wrapper->handle);
+                        bytes     = compressed_parameter_buffer_.data();
+                        data_size = compressed_size;
                     }
                 }
-                else
-                {
-                    if (output_stream_ != nullptr)
-                    {
-                        // Write a packet without resource data; replay must still perform a layout transition at image
-                        // initialization.
-                        upload_cmd.data_size   = 0;
-                        upload_cmd.level_count = 0;
 
-                        output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
-                    }
-                }
+                // Calculate size of packet with compressed or uncompressed data size.
+                upload_cmd.meta_header.block_header.size += levels_size + data_size;
 
-                ++blocks_written_;
+                asset_file_stream_->Write(&upload_cmd, sizeof(upload_cmd));
+                asset_file_stream_->Write(snapshot_entry.level_sizes.data(), levels_size);
+                asset_file_stream_->Write(bytes, data_size);
+            }
+
+            if (output_stream_ != nullptr)
+            {
+                WriteExecuteFromFile(asset_file_name_, 1, offset);
+            }
+
+            if (!snapshot_entry.need_staging_copy && memory_wrapper->mapped_data == nullptr)
+            {
+                device_wrapper->layer_table.UnmapMemory(device_wrapper->handle, memory_wrapper->handle);
             }
         }
         else
         {
             if (output_stream_ != nullptr)
             {
-                assert((*asset_file_offsets_).find(image_wrapper->handle_id) != (*asset_file_offsets_).end());
-                const int64_t offset = (*asset_file_offsets_)[image_wrapper->handle_id];
-                WriteExecuteFromFile(asset_file_name_, 1, offset);
+                // Write a packet without resource data; replay must still perform a layout transition at image
+                // initialization.
+                upload_cmd.data_size   = 0;
+                upload_cmd.level_count = 0;
+
+                output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
             }
         }
+
+        ++blocks_written_;
     }
 }
 
@@ -2895,6 +3094,31 @@ void VulkanStateWriter::WriteImageSubresourceLayouts(const vulkan_wrappers::Imag
     }
 }
 
+VkDeviceSize VulkanStateWriter::GetStagingCopySize(const ResourceSnapshotInfo& snapshot_info)
+{
+    // Includes space for the alignment of each copy within a readback batch.
+    const VkDeviceSize kMaxCopyAlignment = 64;
+    VkDeviceSize       size              = 0;
+
+    for (const auto& buffer_entry : snapshot_info.buffers)
+    {
+        if (buffer_entry.need_staging_copy)
+        {
+            size += buffer_entry.buffer_wrapper->size + kMaxCopyAlignment;
+        }
+    }
+
+    for (const auto& image_entry : snapshot_info.images)
+    {
+        if (image_entry.need_staging_copy)
+        {
+            size += image_entry.resource_size + kMaxCopyAlignment;
+        }
+    }
+
+    return size;
+}
+
 void VulkanStateWriter::WriteResourceMemoryState(const VulkanStateTable& state_table, bool write_memory_state)
 {
     DeviceResourceTables resources;
@@ -2918,7 +3142,9 @@ void VulkanStateWriter::WriteResourceMemoryState(const VulkanStateTable& state_t
                                                     *device_wrapper->physical_device->layer_table_ref,
                                                     device_wrapper->physical_device->memory_properties);
 
-        if (max_staging_copy_size > 0)
+        // Resources that fit in a readback batch are read with the batched readback functions, so the individual
+        // staging buffer is only needed up front for larger resources.
+        if (max_staging_copy_size > kResourceReadbackBatchSize)
         {
             assert(device_wrapper != nullptr);
 
@@ -2945,16 +3171,37 @@ void VulkanStateWriter::WriteResourceMemoryState(const VulkanStateTable& state_t
 
             for (const auto& queue_family_entry : resource_entry.second)
             {
+                VkDeviceSize batch_size =
+                    std::min(GetStagingCopySize(queue_family_entry.second), kResourceReadbackBatchSize);
+
+                // Without readback batches, resources are read individually.
+                if ((batch_size > 0) &&
+                    (resource_util.CreateReadbackBatches(queue_family_entry.first, batch_size) != VK_SUCCESS))
+                {
+                    GFXRECON_LOG_WARNING("Failed to create readback batches to process trim state, resource memory "
+                                         "will be read one resource at a time");
+                }
+
+                ResourceReadbackPipeline readback_pipeline(resource_util);
+
                 if (asset_file_stream_ != nullptr)
                 {
-                    ProcessBufferMemoryWithAssetFile(device_wrapper, queue_family_entry.second.buffers, resource_util);
-                    ProcessImageMemoryWithAssetFile(device_wrapper, queue_family_entry.second.images, resource_util);
+                    ProcessBufferMemoryWithAssetFile(
+                        device_wrapper, queue_family_entry.second.buffers, resource_util, readback_pipeline);
+                    ProcessImageMemoryWithAssetFile(
+                        device_wrapper, queue_family_entry.second.images, resource_util, readback_pipeline);
                 }
                 else
                 {
-                    ProcessBufferMemory(device_wrapper, queue_family_entry.second.buffers, resource_util);
-                    ProcessImageMemory(device_wrapper, queue_family_entry.second.images, resource_util);
+                    ProcessBufferMemory(
+                        device_wrapper, queue_family_entry.second.buffers, resource_util, readback_pipeline);
+                    ProcessImageMemory(
+                        device_wrapper, queue_family_entry.second.images, resource_util, readback_pipeline);
                 }
+
+                // Write the resources remaining in the pipeline before the readback batches are destroyed.
+                readback_pipeline.Flush();
+                resource_util.DestroyReadbackBatches();
             }
 
             if (output_stream_ != nullptr)
@@ -3432,25 +3679,11 @@ void VulkanStateWriter::WriteCommandBufferCommands(const vulkan_wrappers::Comman
     if (CheckCommandHandles(wrapper, state_table))
     {
         // Replay each of the commands that was recorded for the command buffer.
-        size_t         offset    = 0;
-        size_t         data_size = wrapper->command_data.GetDataSize();
-        const uint8_t* data      = wrapper->command_data.GetData();
-
-        while (offset < data_size)
-        {
-            const size_t*            parameter_size = reinterpret_cast<const size_t*>(&data[offset]);
-            const format::ApiCallId* call_id =
-                reinterpret_cast<const format::ApiCallId*>(&data[offset] + sizeof(size_t));
-            const uint8_t* parameter_data = &data[offset] + (sizeof(size_t) + sizeof(format::ApiCallId));
-
-            parameter_stream_.Write(parameter_data, (*parameter_size));
-            WriteFunctionCall((*call_id), &parameter_stream_);
+        wrapper->command_data.Visit([this](uint32_t call_id, const uint8_t* parameter_data, size_t parameter_size) {
+            parameter_stream_.Write(parameter_data, parameter_size);
+            WriteFunctionCall(static_cast<format::ApiCallId>(call_id), &parameter_stream_);
             parameter_stream_.Clear();
-
-            offset += sizeof(size_t) + sizeof(format::ApiCallId) + (*parameter_size);
-        }
-
-        assert(offset == data_size);
+        });
     }
 }
 
@@ -4420,6 +4653,60 @@ bool VulkanStateWriter::IsFramebufferValid(const vulkan_wrappers::FramebufferWra
     return valid;
 }
 
+bool VulkanStateWriter::FindAssetData(const uint8_t* data,
+                                      size_t         data_size,
+                                      int64_t        block_offset,
+                                      int64_t*       data_block_offset)
+{
+    assert(data_block_offset != nullptr);
+
+    if ((asset_data_offsets_ == nullptr) || (data_size < kMinAssetDataReferenceSize))
+    {
+        return false;
+    }
+
+    AssetDataKey key{ data_size,
+                      util::hash::GenerateContentHash(data, data_size, kAssetDataHashSeed),
+                      util::hash::GenerateContentHash(data, data_size, kAssetDataCheckHashSeed) };
+
+    auto entry = asset_data_offsets_->emplace(key, block_offset);
+
+    if (entry.second)
+    {
+        return false;
+    }
+
+    (*data_block_offset) = entry.first->second;
+
+    return true;
+}
+
+void VulkanStateWriter::WriteAssetDataReference(format::MetaDataType init_command_type,
+                                                int64_t              data_block_offset,
+                                                const void*          init_parameters,
+                                                size_t               init_parameters_size,
+                                                const void*          level_sizes,
+                                                size_t               level_sizes_size)
+{
+    format::AssetDataReferenceCommandHeader reference_cmd;
+
+    reference_cmd.meta_header.block_header.size =
+        format::GetMetaDataBlockBaseSize(reference_cmd) + init_parameters_size + level_sizes_size;
+    reference_cmd.meta_header.block_header.type = format::kMetaDataBlock;
+    reference_cmd.meta_header.meta_data_id =
+        format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan, format::MetaDataType::kAssetDataReferenceCommand);
+    reference_cmd.init_command_type = static_cast<uint32_t>(init_command_type);
+    reference_cmd.data_block_offset = data_block_offset;
+
+    asset_file_stream_->Write(&reference_cmd, sizeof(reference_cmd));
+    asset_file_stream_->Write(init_parameters, init_parameters_size);
+
+    if (level_sizes_size > 0)
+    {
+        asset_file_stream_->Write(level_sizes, level_sizes_size);
+    }
+}
+
 void VulkanStateWriter::WriteExecuteFromFile(const std::string& filename, uint32_t n_blocks, int64_t offset)
 {
     assert(!filename.empty());
@@ -39,6 +39,7 @@
 #include "vulkan/vulkan.h"
 
 #include <cstdint>
+#include <functional>
 #include <set>
 #include <unordered_map>
 #include <vector>
@@ -51,13 +52,36 @@ class VulkanStateWriter
   public:
     using AssetFileOffsetsInfo = std::unordered_map<uint64_t, int64_t>;
 
+    // Identifies resource data written to the asset file by its size and two independent content hashes.
+    struct AssetDataKey
+    {
+        uint64_t size;
+        uint64_t hash;
+        uint64_t check_hash;
+
+        bool operator==(const AssetDataKey& other) const
+        {
+            return (size == other.size) && (hash == other.hash) && (check_hash == other.check_hash);
+        }
+    };
+
+    struct AssetDataKeyHash
+    {
+        size_t operator()(const AssetDataKey& key) const { return static_cast<size_t>(key.hash); }
+    };
+
+    // Offsets of the asset file blocks that store resource data, so that resources with identical data can reference
+    // a single copy of it.
+    using AssetDataOffsetsInfo = std::unordered_map<AssetDataKey, int64_t, AssetDataKeyHash>;
+
     VulkanStateWriter(util::FileOutputStream*                  output_stream,
                       util::Compressor*                        compressor,
                       format::ThreadId                         thread_id,
                       std::function<format::HandleId()>        get_unique_id_fn,
                       util::FileOutputStream*                  asset_file_stream  = nullptr,
                       const std::string&                       asset_file_name    = "",
-                      VulkanStateWriter::AssetFileOffsetsInfo* asset_file_offsets = nullptr);
+                      VulkanStateWriter::AssetFileOffsetsInfo* asset_file_offsets = nullptr,
+                      VulkanStateWriter::AssetDataOffsetsInfo* asset_data_offsets = nullptr);
 
     // Returns number of blocks written to the output_stream.
     uint64_t WriteState(const VulkanStateTable& state_table, uint64_t frame_number);
@@ -91,6 +115,9 @@ class VulkanStateWriter
         std::vector<ImageSnapshotInfo>  images;
     };
 
+    // Writes the staging copies of a resource memory snapshot while the GPU copies the following resources.
+    class ResourceReadbackPipeline;
+
     typedef std::unordered_map<uint32_t, ResourceSnapshotInfo> ResourceSnapshotQueueFamilyTable;
     typedef std::unordered_map<const vulkan_wrappers::DeviceWrapper*, ResourceSnapshotQueueFamilyTable>
         DeviceResourceTables;
@@ -161,21 +188,52 @@ class VulkanStateWriter
     void
     ProcessHardwareBuffer(format::HandleId memory_id, AHardwareBuffer* hardware_buffer, VkDeviceSize allocation_size);
 
+    const uint8_t* MapResourceMemory(const vulkan_wrappers::DeviceWrapper*       device_wrapper,
+                                     const vulkan_wrappers::DeviceMemoryWrapper* memory_wrapper,
+                                     VkMemoryPropertyFlags                       memory_properties,
+                                     VkDeviceSize                                offset,
+                                     VkDeviceSize                                size);
+
     void ProcessBufferMemory(const vulkan_wrappers::DeviceWrapper*  device_wrapper,
                              const std::vector<BufferSnapshotInfo>& buffer_snapshot_info,
-                             graphics::VulkanResourcesUtil&         resource_util);
+                             graphics::VulkanResourcesUtil&         resource_util,
+                             ResourceReadbackPipeline&              readback_pipeline);
+
+    void WriteBufferMemory(const vulkan_wrappers::DeviceWrapper* device_wrapper,
+                           const BufferSnapshotInfo&             snapshot_entry,
+                           const uint8_t*                        bytes);
 
     void ProcessBufferMemoryWithAssetFile(const vulkan_wrappers::DeviceWrapper*  device_wrapper,
                                           const std::vector<BufferSnapshotInfo>& buffer_snapshot_info,
-                                          graphics::VulkanResourcesUtil&         resource_util);
+                                          graphics::VulkanResourcesUtil&         resource_util,
+                                          ResourceReadbackPipeline&              readback_pipeline);
+
+    void WriteBufferMemoryToAssetFile(const vulkan_wrappers::DeviceWrapper* device_wrapper,
+                                      const BufferSnapshotInfo&             snapshot_entry,
+                                      const uint8_t*                        bytes);
+
+    bool AddImageReadback(const ImageSnapshotInfo&                   snapshot_entry,
+                          graphics::VulkanResourcesUtil&             resource_util,
+                          ResourceReadbackPipeline&                  readback_pipeline,
+                          const std::function<void(const uint8_t*)>& write_data);
 
     void ProcessImageMemory(const vulkan_wrappers::DeviceWrapper* device_wrapper,
                             const std::vector<ImageSnapshotInfo>& image_snapshot_info,
-                            graphics::VulkanResourcesUtil&        resource_util);
+                            graphics::VulkanResourcesUtil&        resource_util,
+                            ResourceReadbackPipeline&             readback_pipeline);
+
+    void WriteImageMemory(const vulkan_wrappers::DeviceWrapper* device_wrapper,
+                          const ImageSnapshotInfo&              snapshot_entry,
+                          const uint8_t*                        bytes);
 
     void ProcessImageMemoryWithAssetFile(const vulkan_wrappers::DeviceWrapper* device_wrapper,
                                          const std::vector<ImageSnapshotInfo>& image_snapshot_info,
-                                         graphics::VulkanResourcesUtil&        resource_util);
+                                         graphics::VulkanResourcesUtil&        resource_util,
+                                         ResourceReadbackPipeline&             readback_pipeline);
+
+    void WriteImageMemoryToAssetFile(const vulkan_wrappers::DeviceWrapper* device_wrapper,
+                                     const ImageSnapshotInfo&              snapshot_entry,
+                                     const uint8_t*                        bytes);
 
     void WriteBufferMemoryState(const VulkanStateTable& state_table,
                                 DeviceResourceTables*   resources,
@@ -192,6 +250,8 @@ class VulkanStateWriter
     void WriteImageSubresourceLayouts(const vulkan_wrappers::ImageWrapper* image_wrapper,
                                       VkImageAspectFlags                   aspect_flags);
 
+    static VkDeviceSize GetStagingCopySize(const ResourceSnapshotInfo& snapshot_info);
+
     void WriteResourceMemoryState(const VulkanStateTable& state_table, bool write_memory_state);
 
     void WriteMappedMemoryState(const VulkanStateTable& state_table);
@@ -418,6 +478,20 @@ class VulkanStateWriter
 
     void WriteExecuteFromFile(const std::string& filename, uint32_t n_blocks, int64_t offset);
 
+    // Looks up resource data that was previously written to the asset file. Returns true and retrieves the offset of
+    // the block that stores the data if it was found. Otherwise, records that the data will be stored by the block
+    // written at block_offset and returns false.
+    bool FindAssetData(const uint8_t* data, size_t data_size, int64_t block_offset, int64_t* data_block_offset);
+
+    // Writes a kAssetDataReferenceCommand block to the asset file, with the parameters of an init command that
+    // initializes a resource with the data stored by the block at data_block_offset.
+    void WriteAssetDataReference(format::MetaDataType init_command_type,
+                                 int64_t              data_block_offset,
+                                 const void*          init_parameters,
+                                 size_t               init_parameters_size,
+                                 const void*          level_sizes,
+                                 size_t               level_sizes_size);
+
   private:
     util::FileOutputStream*  output_stream_;
     util::Compressor*        compressor_;
@@ -433,6 +507,7 @@ class VulkanStateWriter
     util::FileOutputStream* asset_file_stream_;
     std::string             asset_file_name_;
     AssetFileOffsetsInfo*   asset_file_offsets_;
+    AssetDataOffsetsInfo*   asset_data_offsets_;
 };
 
 GFXRECON_END_NAMESPACE(encode)
@@ -93,9 +93,11 @@ enum BlockType : uint32_t
     kFunctionCallBlock           = 4,
     kAnnotation                  = 5,
     kMethodCallBlock             = 6,
+    kChunkBlock                  = 7, // Sequence of complete blocks; only written in compressed form.
     kCompressedMetaDataBlock     = MakeCompressedBlockType(kMetaDataBlock),
     kCompressedFunctionCallBlock = MakeCompressedBlockType(kFunctionCallBlock),
     kCompressedMethodCallBlock   = MakeCompressedBlockType(kMethodCallBlock),
+    kCompressedChunkBlock        = MakeCompressedBlockType(kChunkBlock),
 };
 
 enum MarkerType : uint32_t
@@ -156,7 +158,10 @@ enum class MetaDataType : uint16_t
     kReserved31                             = 31,
     kSetEnvironmentVariablesCommand         = 32,
     kViewRelativeLocation                   = 33,
-    kExecuteBlocksFromFile                  = 34
+    kExecuteBlocksFromFile                  = 34,
+    kCompressionDictionaryCommand           = 35,
+    kAssetDataReferenceCommand              = 36,
+    kFillMemoryDeltaCommand                 = 37
 };
 
 // MetaDataId is stored in the capture file and its type must be uint32_t to avoid breaking capture file compatibility.
@@ -183,7 +188,11 @@ enum CompressionType : uint32_t
     kNone = 0,
     kLz4  = 1,
     kZlib = 2,
-    kZstd = 3
+    kZstd = 3,
+
+    // Zstandard with a trained dictionary, which is stored in a kCompressionDictionaryCommand block that precedes all
+    // compressed blocks.
+    kZstdDictionary = 4
 };
 
 enum FileOption : uint32_t
@@ -304,6 +313,17 @@ struct CompressedMethodCallHeader
     uint64_t         uncompressed_size;
 };
 
+// Header for a chunk of consecutive blocks that were compressed as a single stream. The compressed data follows the
+// header, and decompresses to uncompressed_size bytes containing block_count complete blocks, including their headers.
+// Chunks are transparent to block processing: readers expand them in place, so the chunk header itself is not counted
+// as a block.
+struct CompressedChunkHeader
+{
+    BlockHeader block_header;
+    uint64_t    uncompressed_size;
+    uint32_t    block_count;
+};
+
 struct AnnotationHeader
 {
     BlockHeader    block_header;
@@ -330,6 +350,20 @@ struct FillMemoryCommandHeader
     uint64_t memory_size;   // Uncompressed size of the data encoded after the header.
 };
 
+// Updates the memory range written by a previous kFillMemoryCommand or kFillMemoryDeltaCommand block with only the
+// bytes that changed. The header is followed by data_size bytes of spans, each encoded as a uint32_t count of unchanged
+// bytes to skip, a uint32_t count of changed bytes, and the changed bytes. Span offsets are relative to memory_offset
+// and the spans never extend past memory_size.
+struct FillMemoryDeltaCommandHeader
+{
+    MetaDataHeader   meta_header;
+    format::ThreadId thread_id;
+    HandleId         memory_id;
+    uint64_t         memory_offset; // Offset from the start of the mapped pointer, not the start of the memory object.
+    uint64_t         memory_size;   // Size of the memory range updated by the spans.
+    uint64_t         data_size;     // Uncompressed size of the span data encoded after the header.
+};
+
 struct FillMemoryResourceValueCommandHeader
 {
     MetaDataHeader   meta_header;
@@ -695,6 +729,25 @@ struct ExecuteBlocksFromFile
     uint32_t filename_length;
 };
 
+// Dictionary shared by all compressed blocks in the file, which must be loaded before any compressed block is
+// decompressed. The header is followed by dictionary_size bytes of dictionary data.
+struct CompressionDictionaryCommandHeader
+{
+    MetaDataHeader meta_header;
+    uint64_t       dictionary_size;
+};
+
+// Initializes a resource with data that is stored once in an asset file for all resources with identical contents.
+// The header is followed by the kInitBufferCommand or kInitImageCommand parameters for the resource, from thread_id
+// to the end of the header and including image level sizes, without the resource data. The resource data is the data
+// of the kInitBufferCommand or kInitImageCommand block that starts at data_block_offset in the same file.
+struct AssetDataReferenceCommandHeader
+{
+    MetaDataHeader meta_header;
+    uint32_t       init_command_type; // MetaDataType of the parameters that follow the header.
+    int64_t        data_block_offset;
+};
+
 // Restore size_t to normal behavior.
 #undef size_t
 
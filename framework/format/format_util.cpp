@@ -46,7 +46,7 @@ bool ValidateFileHeader(const FileHeader& header)
     return valid;
 }
 
-util::Compressor* CreateCompressor(CompressionType type)
+util::Compressor* CreateCompressor(CompressionType type, int compression_level)
 {
     util::Compressor* compressor = nullptr;
 
@@ -74,6 +74,15 @@ util::Compressor* CreateCompressor(CompressionType type)
 #else
             GFXRECON_LOG_ERROR(
                 "Failed to initialize compression module: Application was built with Zstandard compression disabled.");
+#endif // GFXRECON_ENABLE_ZSTD_COMPRESSION
+            break;
+        case kZstdDictionary:
+#if defined(GFXRECON_ENABLE_ZSTD_COMPRESSION)
+            // The dictionary is provided separately with Compressor::LoadDictionary.
+            compressor = new util::ZstdCompressor();
+#else
+            GFXRECON_LOG_ERROR(
+                "Failed to initialize compression module: Application was built with Zstandard compression disabled.");
 #endif // GFXRECON_ENABLE_ZSTD_COMPRESSION
             break;
         case kNone:
@@ -84,6 +93,11 @@ util::Compressor* CreateCompressor(CompressionType type)
             break;
     }
 
+    if (compressor != nullptr)
+    {
+        compressor->SetCompressionLevel(compression_level);
+    }
+
     return compressor;
 }
 
@@ -97,6 +111,8 @@ std::string GetCompressionTypeName(CompressionType type)
             return "zlib";
         case kZstd:
             return "Zstandard";
+        case kZstdDictionary:
+            return "Zstandard with dictionary";
         case kNone:
             return "None";
         default:
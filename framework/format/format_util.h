@@ -91,7 +91,8 @@ constexpr size_t GetAnnotationBlockBaseSize()
 bool ValidateFileHeader(const FileHeader& header);
 
 // Utilities for object creation.
-util::Compressor* CreateCompressor(CompressionType type);
+util::Compressor* CreateCompressor(CompressionType type,
+                                   int             compression_level = util::Compressor::kDefaultCompressionLevel);
 
 std::string GetCompressionTypeName(CompressionType type);
 
@@ -123,11 +123,11 @@ class Dx12JsonConsumerBodyGenerator(Dx12JsonConsumerHeaderGenerator, Dx12JsonCom
         ret_line = self.make_return("function", return_value)
 
         code = '''
-            nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "{}");
+            JsonValue& function = writer_->WriteApiCallStart(call_info, "{}");
             const JsonOptions& options = writer_->GetOptions();
         '''
         code += ret_line
-        code += '''nlohmann::ordered_json& args = function[format::kNameArgs];
+        code += '''JsonValue& args = function[format::kNameArgs];
             {{
         '''
         # Generate a correct FieldToJson for each argument:
@@ -144,7 +144,7 @@ class Dx12JsonConsumerBodyGenerator(Dx12JsonConsumerHeaderGenerator, Dx12JsonCom
 
     def make_consumer_method_body(self, class_name, method_info, return_type, return_value):
         code = '''
-            nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "{0}", object_id, "{1}");
+            JsonValue& method = writer_->WriteApiCallStart(call_info, "{0}", object_id, "{1}");
             const JsonOptions& options = writer_->GetOptions();
         '''
 
@@ -154,7 +154,7 @@ class Dx12JsonConsumerBodyGenerator(Dx12JsonConsumerHeaderGenerator, Dx12JsonCom
 
         # Deal with function argumentS:
         if len(method_info['parameters']) > 0:
-            code += '''nlohmann::ordered_json& args = method[format::kNameArgs];
+            code += '''JsonValue& args = method[format::kNameArgs];
                 {{
             '''
             # Generate a correct FieldToJson for each argument:
@@ -100,19 +100,20 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
             GFXRECON_BEGIN_NAMESPACE(decode)
 
             using util::JsonOptions;
+            using util::JsonValue;
 
             // TODO Move all these manual functions out of the generator and into a .cpp file.
 
             /// @defgroup ManualD3D12StructFieldToJsons Manual functions to convert raw structs.
             /** @{ */
-            static void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RENDER_PASS_BEGINNING_ACCESS_PRESERVE_LOCAL_PARAMETERS& data, const JsonOptions& options)
+            static void FieldToJson(JsonValue& jdata, const D3D12_RENDER_PASS_BEGINNING_ACCESS_PRESERVE_LOCAL_PARAMETERS& data, const JsonOptions& options)
             {
                 using namespace util;
                 FieldToJson(jdata["AdditionalWidth"],  data.AdditionalWidth,  options);
                 FieldToJson(jdata["AdditionalHeight"], data.AdditionalHeight, options);
             }
 
-            static void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RENDER_PASS_ENDING_ACCESS_PRESERVE_LOCAL_PARAMETERS& data, const JsonOptions& options)
+            static void FieldToJson(JsonValue& jdata, const D3D12_RENDER_PASS_ENDING_ACCESS_PRESERVE_LOCAL_PARAMETERS& data, const JsonOptions& options)
             {
                 using namespace util;
                 FieldToJson(jdata["AdditionalWidth"], data.AdditionalWidth, options);
@@ -120,14 +121,14 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
             }
 
             /// Manual raw struct functon to be used for Decoded_D3D12_CLEAR_VALUE conversion.
-            void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DEPTH_STENCIL_VALUE& obj, const JsonOptions& options)
+            void FieldToJson(JsonValue& jdata, const D3D12_DEPTH_STENCIL_VALUE& obj, const JsonOptions& options)
             {
                 FieldToJson(jdata["Depth"], obj.Depth, options);
                 FieldToJson(jdata["Stencil"], obj.Stencil, options);
             }
             /** @} */
 
-            inline bool RepresentBinaryFile(const util::JsonOptions& json_options, nlohmann::ordered_json& jdata, std::string_view filename_base, const uint64_t instance_counter, const PointerDecoder<uint8_t>& data)
+            inline bool RepresentBinaryFile(const util::JsonOptions& json_options, JsonValue& jdata, std::string_view filename_base, const uint64_t instance_counter, const PointerDecoder<uint8_t>& data)
             {
                 return RepresentBinaryFile(json_options, jdata, filename_base, instance_counter, data.GetLength(), data.GetPointer());
             }
@@ -140,7 +141,7 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
         for k, v in struct_dict.items():
             if not self.is_struct_black_listed(k):
                 body = format_cpp_code('''
-                    void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_{0}* data, const JsonOptions& options)
+                    void FieldToJson(JsonValue& jdata, const Decoded_{0}* data, const JsonOptions& options)
                     {{
                         using namespace util;
                         if (data && data->decoded_value)
@@ -824,7 +825,7 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
             /** @{*/
 
             // Decoded_LARGE_INTEGER won't be generated as it is a <winnt.h> struct rather than D3D12.
-            void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_LARGE_INTEGER* data, const JsonOptions& options)
+            void FieldToJson(JsonValue& jdata, const Decoded_LARGE_INTEGER* data, const JsonOptions& options)
             {
                 using namespace util;
                 if (data && data->decoded_value)
@@ -835,7 +836,7 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
             }
 
             // Generated version tries to read the struct members rather than doing the "fake enum" thing.
-            void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_GUID* data, const JsonOptions& options)
+            void FieldToJson(JsonValue& jdata, const Decoded_GUID* data, const JsonOptions& options)
             {
                 using namespace util;
                 if (data && data->decoded_value)
@@ -850,7 +851,7 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
             /// and a byte count with the structure defined in documentation. See:
             /// <https://learn.microsoft.com/en-us/windows/win32/api/d3d12/ns-d3d12-d3d12_pipeline_state_stream_desc>
             /// See also: framework\decode\custom_dx12_struct_decoders.cpp
-            void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_PIPELINE_STATE_STREAM_DESC* data, const JsonOptions& options)
+            void FieldToJson(JsonValue& jdata, const Decoded_D3D12_PIPELINE_STATE_STREAM_DESC* data, const JsonOptions& options)
             {
                 using namespace util;
                 if (data && data->decoded_value)
@@ -883,7 +884,7 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
             }
 
             // The decoded struct has a custom implementation.
-            void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_STATE_SUBOBJECT* data, const JsonOptions& options)
+            void FieldToJson(JsonValue& jdata, const Decoded_D3D12_STATE_SUBOBJECT* data, const JsonOptions& options)
             {
                 using namespace util;
                 if (data && data->decoded_value)
@@ -938,7 +939,7 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
                 }
             }
 
-            void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_CPU_DESCRIPTOR_HANDLE* data, const JsonOptions& options)
+            void FieldToJson(JsonValue& jdata, const Decoded_D3D12_CPU_DESCRIPTOR_HANDLE* data, const JsonOptions& options)
             {
                 using namespace util;
                 if (data && data->decoded_value)
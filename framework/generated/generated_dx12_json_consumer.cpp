@@ -49,10 +49,10 @@ void Dx12JsonConsumer::Process_CreateDXGIFactory(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "CreateDXGIFactory");
+    JsonValue& function = writer_->WriteApiCallStart(call_info, "CreateDXGIFactory");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    JsonValue& args = function[format::kNameArgs];
     {
         FieldToJson(args["riid"], riid, options);
         FieldToJson(args["ppFactory"], ppFactory, options);
@@ -69,10 +69,10 @@ void Dx12JsonConsumer::Process_CreateDXGIFactory1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "CreateDXGIFactory1");
+    JsonValue& function = writer_->WriteApiCallStart(call_info, "CreateDXGIFactory1");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    JsonValue& args = function[format::kNameArgs];
     {
         FieldToJson(args["riid"], riid, options);
         FieldToJson(args["ppFactory"], ppFactory, options);
@@ -91,10 +91,10 @@ void Dx12JsonConsumer::Process_IDXGIObject_SetPrivateData(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIObject", object_id, "SetPrivateData");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIObject", object_id, "SetPrivateData");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Name"], Name, options);
         FieldToJson(args["DataSize"], DataSize, options);
@@ -112,10 +112,10 @@ void Dx12JsonConsumer::Process_IDXGIObject_SetPrivateDataInterface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIObject", object_id, "SetPrivateDataInterface");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIObject", object_id, "SetPrivateDataInterface");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Name"], Name, options);
         FieldToJson(args["pUnknown"], pUnknown, options);
@@ -133,10 +133,10 @@ void Dx12JsonConsumer::Process_IDXGIObject_GetPrivateData(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIObject", object_id, "GetPrivateData");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIObject", object_id, "GetPrivateData");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Name"], Name, options);
         FieldToJson(args["pDataSize"], pDataSize, options);
@@ -154,10 +154,10 @@ void Dx12JsonConsumer::Process_IDXGIObject_GetParent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIObject", object_id, "GetParent");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIObject", object_id, "GetParent");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["riid"], riid, options);
         FieldToJson(args["ppParent"], ppParent, options);
@@ -174,10 +174,10 @@ void Dx12JsonConsumer::Process_IDXGIDeviceSubObject_GetDevice(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDeviceSubObject", object_id, "GetDevice");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIDeviceSubObject", object_id, "GetDevice");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["riid"], riid, options);
         FieldToJson(args["ppDevice"], ppDevice, options);
@@ -193,10 +193,10 @@ void Dx12JsonConsumer::Process_IDXGIResource_GetSharedHandle(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIResource", object_id, "GetSharedHandle");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIResource", object_id, "GetSharedHandle");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pSharedHandle"], pSharedHandle, options);
     }
@@ -211,10 +211,10 @@ void Dx12JsonConsumer::Process_IDXGIResource_GetUsage(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIResource", object_id, "GetUsage");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIResource", object_id, "GetUsage");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pUsage"], pUsage, options);
     }
@@ -229,10 +229,10 @@ void Dx12JsonConsumer::Process_IDXGIResource_SetEvictionPriority(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIResource", object_id, "SetEvictionPriority");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIResource", object_id, "SetEvictionPriority");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["EvictionPriority"], EvictionPriority, options);
     }
@@ -247,10 +247,10 @@ void Dx12JsonConsumer::Process_IDXGIResource_GetEvictionPriority(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIResource", object_id, "GetEvictionPriority");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIResource", object_id, "GetEvictionPriority");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pEvictionPriority"], pEvictionPriority, options);
     }
@@ -266,10 +266,10 @@ void Dx12JsonConsumer::Process_IDXGIKeyedMutex_AcquireSync(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIKeyedMutex", object_id, "AcquireSync");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIKeyedMutex", object_id, "AcquireSync");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Key"], Key, options);
         FieldToJson(args["dwMilliseconds"], dwMilliseconds, options);
@@ -285,10 +285,10 @@ void Dx12JsonConsumer::Process_IDXGIKeyedMutex_ReleaseSync(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIKeyedMutex", object_id, "ReleaseSync");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIKeyedMutex", object_id, "ReleaseSync");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Key"], Key, options);
     }
@@ -303,10 +303,10 @@ void Dx12JsonConsumer::Process_IDXGISurface_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISurface", object_id, "GetDesc");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISurface", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
     }
@@ -322,10 +322,10 @@ void Dx12JsonConsumer::Process_IDXGISurface_Map(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISurface", object_id, "Map");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISurface", object_id, "Map");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pLockedRect"], pLockedRect, options);
         FieldToJson(args["MapFlags"], MapFlags, options);
@@ -340,7 +340,7 @@ void Dx12JsonConsumer::Process_IDXGISurface_Unmap(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISurface", object_id, "Unmap");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISurface", object_id, "Unmap");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -355,10 +355,10 @@ void Dx12JsonConsumer::Process_IDXGISurface1_GetDC(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISurface1", object_id, "GetDC");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISurface1", object_id, "GetDC");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         Bool32ToJson(args["Discard"], Discard, options);
         FieldToJson(args["phdc"], phdc, options);
@@ -374,10 +374,10 @@ void Dx12JsonConsumer::Process_IDXGISurface1_ReleaseDC(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISurface1", object_id, "ReleaseDC");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISurface1", object_id, "ReleaseDC");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDirtyRect"], pDirtyRect, options);
     }
@@ -393,10 +393,10 @@ void Dx12JsonConsumer::Process_IDXGIAdapter_EnumOutputs(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter", object_id, "EnumOutputs");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter", object_id, "EnumOutputs");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Output"], Output, options);
         FieldToJson(args["ppOutput"], ppOutput, options);
@@ -412,10 +412,10 @@ void Dx12JsonConsumer::Process_IDXGIAdapter_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter", object_id, "GetDesc");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
     }
@@ -431,10 +431,10 @@ void Dx12JsonConsumer::Process_IDXGIAdapter_CheckInterfaceSupport(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter", object_id, "CheckInterfaceSupport");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter", object_id, "CheckInterfaceSupport");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["InterfaceName"], InterfaceName, options);
         FieldToJson(args["pUMDVersion"], pUMDVersion, options);
@@ -450,10 +450,10 @@ void Dx12JsonConsumer::Process_IDXGIOutput_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "GetDesc");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
     }
@@ -471,10 +471,10 @@ void Dx12JsonConsumer::Process_IDXGIOutput_GetDisplayModeList(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "GetDisplayModeList");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "GetDisplayModeList");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["EnumFormat"], EnumFormat, options);
         FieldToJson(args["Flags"], Flags, options);
@@ -494,10 +494,10 @@ void Dx12JsonConsumer::Process_IDXGIOutput_FindClosestMatchingMode(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "FindClosestMatchingMode");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "FindClosestMatchingMode");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pModeToMatch"], pModeToMatch, options);
         FieldToJson(args["pClosestMatch"], pClosestMatch, options);
@@ -513,7 +513,7 @@ void Dx12JsonConsumer::Process_IDXGIOutput_WaitForVBlank(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "WaitForVBlank");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "WaitForVBlank");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -528,10 +528,10 @@ void Dx12JsonConsumer::Process_IDXGIOutput_TakeOwnership(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "TakeOwnership");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "TakeOwnership");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDevice"], pDevice, options);
         Bool32ToJson(args["Exclusive"], Exclusive, options);
@@ -545,7 +545,7 @@ void Dx12JsonConsumer::Process_IDXGIOutput_ReleaseOwnership(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "ReleaseOwnership");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "ReleaseOwnership");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -558,10 +558,10 @@ void Dx12JsonConsumer::Process_IDXGIOutput_GetGammaControlCapabilities(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "GetGammaControlCapabilities");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "GetGammaControlCapabilities");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pGammaCaps"], pGammaCaps, options);
     }
@@ -576,10 +576,10 @@ void Dx12JsonConsumer::Process_IDXGIOutput_SetGammaControl(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "SetGammaControl");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "SetGammaControl");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pArray"], pArray, options);
     }
@@ -594,10 +594,10 @@ void Dx12JsonConsumer::Process_IDXGIOutput_GetGammaControl(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "GetGammaControl");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "GetGammaControl");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pArray"], pArray, options);
     }
@@ -612,10 +612,10 @@ void Dx12JsonConsumer::Process_IDXGIOutput_SetDisplaySurface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "SetDisplaySurface");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "SetDisplaySurface");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pScanoutSurface"], pScanoutSurface, options);
     }
@@ -630,10 +630,10 @@ void Dx12JsonConsumer::Process_IDXGIOutput_GetDisplaySurfaceData(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "GetDisplaySurfaceData");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "GetDisplaySurfaceData");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDestination"], pDestination, options);
     }
@@ -648,10 +648,10 @@ void Dx12JsonConsumer::Process_IDXGIOutput_GetFrameStatistics(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "GetFrameStatistics");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "GetFrameStatistics");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pStats"], pStats, options);
     }
@@ -667,10 +667,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChain_Present(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "Present");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "Present");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["SyncInterval"], SyncInterval, options);
         FieldToJson(args["Flags"], Flags, options);
@@ -688,10 +688,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChain_GetBuffer(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "GetBuffer");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "GetBuffer");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Buffer"], Buffer, options);
         FieldToJson(args["riid"], riid, options);
@@ -709,10 +709,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChain_SetFullscreenState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "SetFullscreenState");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "SetFullscreenState");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         Bool32ToJson(args["Fullscreen"], Fullscreen, options);
         FieldToJson(args["pTarget"], pTarget, options);
@@ -729,10 +729,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChain_GetFullscreenState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "GetFullscreenState");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "GetFullscreenState");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         Bool32ToJson(args["pFullscreen"], pFullscreen, options);
         FieldToJson(args["ppTarget"], ppTarget, options);
@@ -748,10 +748,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChain_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "GetDesc");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
     }
@@ -770,10 +770,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChain_ResizeBuffers(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "ResizeBuffers");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "ResizeBuffers");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["BufferCount"], BufferCount, options);
         FieldToJson(args["Width"], Width, options);
@@ -792,10 +792,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChain_ResizeTarget(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "ResizeTarget");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "ResizeTarget");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pNewTargetParameters"], pNewTargetParameters, options);
     }
@@ -810,10 +810,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChain_GetContainingOutput(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "GetContainingOutput");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "GetContainingOutput");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["ppOutput"], ppOutput, options);
     }
@@ -828,10 +828,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChain_GetFrameStatistics(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "GetFrameStatistics");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "GetFrameStatistics");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pStats"], pStats, options);
     }
@@ -846,10 +846,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChain_GetLastPresentCount(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "GetLastPresentCount");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "GetLastPresentCount");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pLastPresentCount"], pLastPresentCount, options);
     }
@@ -865,10 +865,10 @@ void Dx12JsonConsumer::Process_IDXGIFactory_EnumAdapters(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory", object_id, "EnumAdapters");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory", object_id, "EnumAdapters");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Adapter"], Adapter, options);
         FieldToJson(args["ppAdapter"], ppAdapter, options);
@@ -885,10 +885,10 @@ void Dx12JsonConsumer::Process_IDXGIFactory_MakeWindowAssociation(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory", object_id, "MakeWindowAssociation");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory", object_id, "MakeWindowAssociation");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["WindowHandle"], WindowHandle, options);
         FieldToJson(args["Flags"], Flags, options);
@@ -904,10 +904,10 @@ void Dx12JsonConsumer::Process_IDXGIFactory_GetWindowAssociation(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory", object_id, "GetWindowAssociation");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory", object_id, "GetWindowAssociation");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pWindowHandle"], pWindowHandle, options);
     }
@@ -924,10 +924,10 @@ void Dx12JsonConsumer::Process_IDXGIFactory_CreateSwapChain(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory", object_id, "CreateSwapChain");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory", object_id, "CreateSwapChain");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDevice"], pDevice, options);
         FieldToJson(args["pDesc"], pDesc, options);
@@ -945,10 +945,10 @@ void Dx12JsonConsumer::Process_IDXGIFactory_CreateSoftwareAdapter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory", object_id, "CreateSoftwareAdapter");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory", object_id, "CreateSoftwareAdapter");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Module"], Module, options);
         FieldToJson(args["ppAdapter"], ppAdapter, options);
@@ -964,10 +964,10 @@ void Dx12JsonConsumer::Process_IDXGIDevice_GetAdapter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice", object_id, "GetAdapter");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice", object_id, "GetAdapter");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pAdapter"], pAdapter, options);
     }
@@ -986,10 +986,10 @@ void Dx12JsonConsumer::Process_IDXGIDevice_CreateSurface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice", object_id, "CreateSurface");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice", object_id, "CreateSurface");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
         FieldToJson(args["NumSurfaces"], NumSurfaces, options);
@@ -1010,10 +1010,10 @@ void Dx12JsonConsumer::Process_IDXGIDevice_QueryResourceResidency(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice", object_id, "QueryResourceResidency");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice", object_id, "QueryResourceResidency");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["ppResources"], ppResources, options);
         FieldToJson(args["pResidencyStatus"], pResidencyStatus, options);
@@ -1030,10 +1030,10 @@ void Dx12JsonConsumer::Process_IDXGIDevice_SetGPUThreadPriority(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice", object_id, "SetGPUThreadPriority");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice", object_id, "SetGPUThreadPriority");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Priority"], Priority, options);
     }
@@ -1048,10 +1048,10 @@ void Dx12JsonConsumer::Process_IDXGIDevice_GetGPUThreadPriority(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice", object_id, "GetGPUThreadPriority");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice", object_id, "GetGPUThreadPriority");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pPriority"], pPriority, options);
     }
@@ -1067,10 +1067,10 @@ void Dx12JsonConsumer::Process_IDXGIFactory1_EnumAdapters1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory1", object_id, "EnumAdapters1");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory1", object_id, "EnumAdapters1");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Adapter"], Adapter, options);
         FieldToJson(args["ppAdapter"], ppAdapter, options);
@@ -1085,7 +1085,7 @@ void Dx12JsonConsumer::Process_IDXGIFactory1_IsCurrent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory1", object_id, "IsCurrent");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory1", object_id, "IsCurrent");
     const JsonOptions& options = writer_->GetOptions();
     Bool32ToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -1099,10 +1099,10 @@ void Dx12JsonConsumer::Process_IDXGIAdapter1_GetDesc1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter1", object_id, "GetDesc1");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter1", object_id, "GetDesc1");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
     }
@@ -1117,10 +1117,10 @@ void Dx12JsonConsumer::Process_IDXGIDevice1_SetMaximumFrameLatency(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice1", object_id, "SetMaximumFrameLatency");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice1", object_id, "SetMaximumFrameLatency");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["MaxLatency"], MaxLatency, options);
     }
@@ -1135,10 +1135,10 @@ void Dx12JsonConsumer::Process_IDXGIDevice1_GetMaximumFrameLatency(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice1", object_id, "GetMaximumFrameLatency");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice1", object_id, "GetMaximumFrameLatency");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pMaxLatency"], pMaxLatency, options);
     }
@@ -1156,7 +1156,7 @@ void Dx12JsonConsumer::Process_IDXGIDisplayControl_IsStereoEnabled(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDisplayControl", object_id, "IsStereoEnabled");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIDisplayControl", object_id, "IsStereoEnabled");
     const JsonOptions& options = writer_->GetOptions();
     Bool32ToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -1169,9 +1169,9 @@ void Dx12JsonConsumer::Process_IDXGIDisplayControl_SetStereoEnabled(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDisplayControl", object_id, "SetStereoEnabled");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIDisplayControl", object_id, "SetStereoEnabled");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         Bool32ToJson(args["enabled"], enabled, options);
     }
@@ -1185,9 +1185,9 @@ void Dx12JsonConsumer::Process_IDXGIOutputDuplication_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "GetDesc");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
     }
@@ -1204,10 +1204,10 @@ void Dx12JsonConsumer::Process_IDXGIOutputDuplication_AcquireNextFrame(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "AcquireNextFrame");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "AcquireNextFrame");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["TimeoutInMilliseconds"], TimeoutInMilliseconds, options);
         FieldToJson(args["pFrameInfo"], pFrameInfo, options);
@@ -1226,10 +1226,10 @@ void Dx12JsonConsumer::Process_IDXGIOutputDuplication_GetFrameDirtyRects(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "GetFrameDirtyRects");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "GetFrameDirtyRects");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["DirtyRectsBufferSize"], DirtyRectsBufferSize, options);
         FieldToJson(args["pDirtyRectsBuffer"], pDirtyRectsBuffer, options);
@@ -1248,10 +1248,10 @@ void Dx12JsonConsumer::Process_IDXGIOutputDuplication_GetFrameMoveRects(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "GetFrameMoveRects");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "GetFrameMoveRects");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["MoveRectsBufferSize"], MoveRectsBufferSize, options);
         FieldToJson(args["pMoveRectBuffer"], pMoveRectBuffer, options);
@@ -1271,10 +1271,10 @@ void Dx12JsonConsumer::Process_IDXGIOutputDuplication_GetFramePointerShape(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "GetFramePointerShape");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "GetFramePointerShape");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["PointerShapeBufferSize"], PointerShapeBufferSize, options);
         FieldToJson(args["pPointerShapeBuffer"], pPointerShapeBuffer, options);
@@ -1292,10 +1292,10 @@ void Dx12JsonConsumer::Process_IDXGIOutputDuplication_MapDesktopSurface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "MapDesktopSurface");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "MapDesktopSurface");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pLockedRect"], pLockedRect, options);
     }
@@ -1309,7 +1309,7 @@ void Dx12JsonConsumer::Process_IDXGIOutputDuplication_UnMapDesktopSurface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "UnMapDesktopSurface");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "UnMapDesktopSurface");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -1322,7 +1322,7 @@ void Dx12JsonConsumer::Process_IDXGIOutputDuplication_ReleaseFrame(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "ReleaseFrame");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "ReleaseFrame");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -1338,10 +1338,10 @@ void Dx12JsonConsumer::Process_IDXGISurface2_GetResource(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISurface2", object_id, "GetResource");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISurface2", object_id, "GetResource");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["riid"], riid, options);
         FieldToJson(args["ppParentResource"], ppParentResource, options);
@@ -1359,10 +1359,10 @@ void Dx12JsonConsumer::Process_IDXGIResource1_CreateSubresourceSurface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIResource1", object_id, "CreateSubresourceSurface");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIResource1", object_id, "CreateSubresourceSurface");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["index"], index, options);
         FieldToJson(args["ppSurface"], ppSurface, options);
@@ -1381,10 +1381,10 @@ void Dx12JsonConsumer::Process_IDXGIResource1_CreateSharedHandle(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIResource1", object_id, "CreateSharedHandle");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIResource1", object_id, "CreateSharedHandle");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pAttributes"], pAttributes, options);
         FieldToJson(args["dwAccess"], dwAccess, options);
@@ -1404,10 +1404,10 @@ void Dx12JsonConsumer::Process_IDXGIDevice2_OfferResources(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice2", object_id, "OfferResources");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice2", object_id, "OfferResources");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["NumResources"], NumResources, options);
         FieldToJson(args["ppResources"], ppResources, options);
@@ -1426,10 +1426,10 @@ void Dx12JsonConsumer::Process_IDXGIDevice2_ReclaimResources(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice2", object_id, "ReclaimResources");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice2", object_id, "ReclaimResources");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["NumResources"], NumResources, options);
         FieldToJson(args["ppResources"], ppResources, options);
@@ -1446,10 +1446,10 @@ void Dx12JsonConsumer::Process_IDXGIDevice2_EnqueueSetEvent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice2", object_id, "EnqueueSetEvent");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice2", object_id, "EnqueueSetEvent");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["hEvent"], hEvent, options);
     }
@@ -1464,10 +1464,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_GetDesc1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetDesc1");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetDesc1");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
     }
@@ -1482,10 +1482,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_GetFullscreenDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetFullscreenDesc");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetFullscreenDesc");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
     }
@@ -1500,10 +1500,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_GetHwnd(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetHwnd");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetHwnd");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pHwnd"], pHwnd, options);
     }
@@ -1519,10 +1519,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_GetCoreWindow(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetCoreWindow");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetCoreWindow");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["refiid"], refiid, options);
         FieldToJson(args["ppUnk"], ppUnk, options);
@@ -1540,10 +1540,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_Present1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "Present1");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "Present1");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["SyncInterval"], SyncInterval, options);
         FieldToJson(args["PresentFlags"], PresentFlags, options);
@@ -1559,7 +1559,7 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_IsTemporaryMonoSupported(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "IsTemporaryMonoSupported");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "IsTemporaryMonoSupported");
     const JsonOptions& options = writer_->GetOptions();
     Bool32ToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -1573,10 +1573,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_GetRestrictToOutput(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetRestrictToOutput");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetRestrictToOutput");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["ppRestrictToOutput"], ppRestrictToOutput, options);
     }
@@ -1591,10 +1591,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_SetBackgroundColor(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "SetBackgroundColor");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "SetBackgroundColor");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pColor"], pColor, options);
     }
@@ -1609,10 +1609,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_GetBackgroundColor(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetBackgroundColor");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetBackgroundColor");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pColor"], pColor, options);
     }
@@ -1627,10 +1627,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_SetRotation(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "SetRotation");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "SetRotation");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Rotation"], Rotation, options);
     }
@@ -1645,10 +1645,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_GetRotation(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetRotation");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetRotation");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pRotation"], pRotation, options);
     }
@@ -1662,7 +1662,7 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_IsWindowedStereoEnabled(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "IsWindowedStereoEnabled");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "IsWindowedStereoEnabled");
     const JsonOptions& options = writer_->GetOptions();
     Bool32ToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -1681,10 +1681,10 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_CreateSwapChainForHwnd(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "CreateSwapChainForHwnd");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "CreateSwapChainForHwnd");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDevice"], pDevice, options);
         FieldToJson(args["hWnd"], hWnd, options);
@@ -1708,10 +1708,10 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_CreateSwapChainForCoreWindow(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "CreateSwapChainForCoreWindow");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "CreateSwapChainForCoreWindow");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDevice"], pDevice, options);
         FieldToJson(args["pWindow"], pWindow, options);
@@ -1731,10 +1731,10 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_GetSharedResourceAdapterLuid(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "GetSharedResourceAdapterLuid");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "GetSharedResourceAdapterLuid");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["hResource"], hResource, options);
         FieldToJson(args["pLuid"], pLuid, options);
@@ -1752,10 +1752,10 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_RegisterStereoStatusWindow(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "RegisterStereoStatusWindow");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "RegisterStereoStatusWindow");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["WindowHandle"], WindowHandle, options);
         FieldToJson(args["wMsg"], wMsg, options);
@@ -1773,10 +1773,10 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_RegisterStereoStatusEvent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "RegisterStereoStatusEvent");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "RegisterStereoStatusEvent");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["hEvent"], hEvent, options);
         FieldToJson(args["pdwCookie"], pdwCookie, options);
@@ -1791,9 +1791,9 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_UnregisterStereoStatus(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "UnregisterStereoStatus");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "UnregisterStereoStatus");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["dwCookie"], dwCookie, options);
     }
@@ -1810,10 +1810,10 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_RegisterOcclusionStatusWindow(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "RegisterOcclusionStatusWindow");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "RegisterOcclusionStatusWindow");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["WindowHandle"], WindowHandle, options);
         FieldToJson(args["wMsg"], wMsg, options);
@@ -1831,10 +1831,10 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_RegisterOcclusionStatusEvent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "RegisterOcclusionStatusEvent");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "RegisterOcclusionStatusEvent");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["hEvent"], hEvent, options);
         FieldToJson(args["pdwCookie"], pdwCookie, options);
@@ -1849,9 +1849,9 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_UnregisterOcclusionStatus(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "UnregisterOcclusionStatus");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "UnregisterOcclusionStatus");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["dwCookie"], dwCookie, options);
     }
@@ -1869,10 +1869,10 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_CreateSwapChainForComposition(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "CreateSwapChainForComposition");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "CreateSwapChainForComposition");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDevice"], pDevice, options);
         FieldToJson(args["pDesc"], pDesc, options);
@@ -1890,10 +1890,10 @@ void Dx12JsonConsumer::Process_IDXGIAdapter2_GetDesc2(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter2", object_id, "GetDesc2");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter2", object_id, "GetDesc2");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
     }
@@ -1911,10 +1911,10 @@ void Dx12JsonConsumer::Process_IDXGIOutput1_GetDisplayModeList1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput1", object_id, "GetDisplayModeList1");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput1", object_id, "GetDisplayModeList1");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["EnumFormat"], EnumFormat, options);
         FieldToJson(args["Flags"], Flags, options);
@@ -1934,10 +1934,10 @@ void Dx12JsonConsumer::Process_IDXGIOutput1_FindClosestMatchingMode1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput1", object_id, "FindClosestMatchingMode1");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput1", object_id, "FindClosestMatchingMode1");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pModeToMatch"], pModeToMatch, options);
         FieldToJson(args["pClosestMatch"], pClosestMatch, options);
@@ -1954,10 +1954,10 @@ void Dx12JsonConsumer::Process_IDXGIOutput1_GetDisplaySurfaceData1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput1", object_id, "GetDisplaySurfaceData1");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput1", object_id, "GetDisplaySurfaceData1");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDestination"], pDestination, options);
     }
@@ -1973,10 +1973,10 @@ void Dx12JsonConsumer::Process_IDXGIOutput1_DuplicateOutput(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput1", object_id, "DuplicateOutput");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput1", object_id, "DuplicateOutput");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDevice"], pDevice, options);
         FieldToJson(args["ppOutputDuplication"], ppOutputDuplication, options);
@@ -1997,10 +1997,10 @@ void Dx12JsonConsumer::Process_CreateDXGIFactory2(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "CreateDXGIFactory2");
+    JsonValue& function = writer_->WriteApiCallStart(call_info, "CreateDXGIFactory2");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    JsonValue& args = function[format::kNameArgs];
     {
         FieldToJson(args["Flags"], Flags, options);
         FieldToJson(args["riid"], riid, options);
@@ -2019,10 +2019,10 @@ void Dx12JsonConsumer::Process_DXGIGetDebugInterface1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "DXGIGetDebugInterface1");
+    JsonValue& function = writer_->WriteApiCallStart(call_info, "DXGIGetDebugInterface1");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    JsonValue& args = function[format::kNameArgs];
     {
         FieldToJson(args["Flags"], Flags, options);
         FieldToJson(args["riid"], riid, options);
@@ -2038,7 +2038,7 @@ void Dx12JsonConsumer::Process_IDXGIDevice3_Trim(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice3", object_id, "Trim");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice3", object_id, "Trim");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -2052,10 +2052,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChain2_SetSourceSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "SetSourceSize");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "SetSourceSize");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Width"], Width, options);
         FieldToJson(args["Height"], Height, options);
@@ -2072,10 +2072,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChain2_GetSourceSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "GetSourceSize");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "GetSourceSize");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pWidth"], pWidth, options);
         FieldToJson(args["pHeight"], pHeight, options);
@@ -2091,10 +2091,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChain2_SetMaximumFrameLatency(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "SetMaximumFrameLatency");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "SetMaximumFrameLatency");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["MaxLatency"], MaxLatency, options);
     }
@@ -2109,10 +2109,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChain2_GetMaximumFrameLatency(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "GetMaximumFrameLatency");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "GetMaximumFrameLatency");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pMaxLatency"], pMaxLatency, options);
     }
@@ -2126,7 +2126,7 @@ void Dx12JsonConsumer::Process_IDXGISwapChain2_GetFrameLatencyWaitableObject(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "GetFrameLatencyWaitableObject");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "GetFrameLatencyWaitableObject");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -2140,10 +2140,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChain2_SetMatrixTransform(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "SetMatrixTransform");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "SetMatrixTransform");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pMatrix"], pMatrix, options);
     }
@@ -2158,10 +2158,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChain2_GetMatrixTransform(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "GetMatrixTransform");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "GetMatrixTransform");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pMatrix"], pMatrix, options);
     }
@@ -2175,7 +2175,7 @@ void Dx12JsonConsumer::Process_IDXGIOutput2_SupportsOverlays(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput2", object_id, "SupportsOverlays");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput2", object_id, "SupportsOverlays");
     const JsonOptions& options = writer_->GetOptions();
     Bool32ToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -2188,7 +2188,7 @@ void Dx12JsonConsumer::Process_IDXGIFactory3_GetCreationFlags(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory3", object_id, "GetCreationFlags");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory3", object_id, "GetCreationFlags");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -2204,10 +2204,10 @@ void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_PresentBuffer(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "PresentBuffer");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "PresentBuffer");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["BufferToPresent"], BufferToPresent, options);
         FieldToJson(args["SyncInterval"], SyncInterval, options);
@@ -2224,10 +2224,10 @@ void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_SetSourceRect(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "SetSourceRect");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "SetSourceRect");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pRect"], pRect, options);
     }
@@ -2242,10 +2242,10 @@ void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_SetTargetRect(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "SetTargetRect");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "SetTargetRect");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pRect"], pRect, options);
     }
@@ -2261,10 +2261,10 @@ void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_SetDestSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "SetDestSize");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "SetDestSize");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Width"], Width, options);
         FieldToJson(args["Height"], Height, options);
@@ -2280,10 +2280,10 @@ void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_GetSourceRect(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "GetSourceRect");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "GetSourceRect");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pRect"], pRect, options);
     }
@@ -2298,10 +2298,10 @@ void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_GetTargetRect(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "GetTargetRect");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "GetTargetRect");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pRect"], pRect, options);
     }
@@ -2317,10 +2317,10 @@ void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_GetDestSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "GetDestSize");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "GetDestSize");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pWidth"], pWidth, options);
         FieldToJson(args["pHeight"], pHeight, options);
@@ -2336,10 +2336,10 @@ void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_SetColorSpace(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "SetColorSpace");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "SetColorSpace");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson_DXGI_MULTIPLANE_OVERLAY_YCbCr_FLAGS(args["ColorSpace"], ColorSpace, options);
     }
@@ -2353,7 +2353,7 @@ void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_GetColorSpace(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "GetColorSpace");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "GetColorSpace");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson_DXGI_MULTIPLANE_OVERLAY_YCbCr_FLAGS(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -2371,10 +2371,10 @@ void Dx12JsonConsumer::Process_IDXGIFactoryMedia_CreateSwapChainForCompositionSu
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactoryMedia", object_id, "CreateSwapChainForCompositionSurfaceHandle");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIFactoryMedia", object_id, "CreateSwapChainForCompositionSurfaceHandle");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDevice"], pDevice, options);
         FieldToJson(args["hSurface"], hSurface, options);
@@ -2398,10 +2398,10 @@ void Dx12JsonConsumer::Process_IDXGIFactoryMedia_CreateDecodeSwapChainForComposi
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactoryMedia", object_id, "CreateDecodeSwapChainForCompositionSurfaceHandle");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIFactoryMedia", object_id, "CreateDecodeSwapChainForCompositionSurfaceHandle");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDevice"], pDevice, options);
         FieldToJson(args["hSurface"], hSurface, options);
@@ -2421,10 +2421,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChainMedia_GetFrameStatisticsMedia(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChainMedia", object_id, "GetFrameStatisticsMedia");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChainMedia", object_id, "GetFrameStatisticsMedia");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pStats"], pStats, options);
     }
@@ -2439,10 +2439,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChainMedia_SetPresentDuration(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChainMedia", object_id, "SetPresentDuration");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChainMedia", object_id, "SetPresentDuration");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Duration"], Duration, options);
     }
@@ -2459,10 +2459,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChainMedia_CheckPresentDurationSupport(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChainMedia", object_id, "CheckPresentDurationSupport");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChainMedia", object_id, "CheckPresentDurationSupport");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["DesiredPresentDuration"], DesiredPresentDuration, options);
         FieldToJson(args["pClosestSmallerPresentDuration"], pClosestSmallerPresentDuration, options);
@@ -2481,10 +2481,10 @@ void Dx12JsonConsumer::Process_IDXGIOutput3_CheckOverlaySupport(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput3", object_id, "CheckOverlaySupport");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput3", object_id, "CheckOverlaySupport");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["EnumFormat"], EnumFormat, options);
         FieldToJson(args["pConcernedDevice"], pConcernedDevice, options);
@@ -2504,7 +2504,7 @@ void Dx12JsonConsumer::Process_IDXGISwapChain3_GetCurrentBackBufferIndex(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain3", object_id, "GetCurrentBackBufferIndex");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain3", object_id, "GetCurrentBackBufferIndex");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -2519,10 +2519,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChain3_CheckColorSpaceSupport(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain3", object_id, "CheckColorSpaceSupport");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain3", object_id, "CheckColorSpaceSupport");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["ColorSpace"], ColorSpace, options);
         FieldToJson(args["pColorSpaceSupport"], pColorSpaceSupport, options);
@@ -2538,10 +2538,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChain3_SetColorSpace1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain3", object_id, "SetColorSpace1");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain3", object_id, "SetColorSpace1");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["ColorSpace"], ColorSpace, options);
     }
@@ -2562,10 +2562,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChain3_ResizeBuffers1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain3", object_id, "ResizeBuffers1");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain3", object_id, "ResizeBuffers1");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["BufferCount"], BufferCount, options);
         FieldToJson(args["Width"], Width, options);
@@ -2589,10 +2589,10 @@ void Dx12JsonConsumer::Process_IDXGIOutput4_CheckOverlayColorSpaceSupport(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput4", object_id, "CheckOverlayColorSpaceSupport");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput4", object_id, "CheckOverlayColorSpaceSupport");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Format"], Format, options);
         FieldToJson(args["ColorSpace"], ColorSpace, options);
@@ -2612,10 +2612,10 @@ void Dx12JsonConsumer::Process_IDXGIFactory4_EnumAdapterByLuid(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory4", object_id, "EnumAdapterByLuid");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory4", object_id, "EnumAdapterByLuid");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["AdapterLuid"], AdapterLuid, options);
         FieldToJson(args["riid"], riid, options);
@@ -2633,10 +2633,10 @@ void Dx12JsonConsumer::Process_IDXGIFactory4_EnumWarpAdapter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory4", object_id, "EnumWarpAdapter");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory4", object_id, "EnumWarpAdapter");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["riid"], riid, options);
         FieldToJson(args["ppvAdapter"], ppvAdapter, options);
@@ -2653,10 +2653,10 @@ void Dx12JsonConsumer::Process_IDXGIAdapter3_RegisterHardwareContentProtectionTe
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter3", object_id, "RegisterHardwareContentProtectionTeardownStatusEvent");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter3", object_id, "RegisterHardwareContentProtectionTeardownStatusEvent");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["hEvent"], hEvent, options);
         FieldToJson(args["pdwCookie"], pdwCookie, options);
@@ -2671,9 +2671,9 @@ void Dx12JsonConsumer::Process_IDXGIAdapter3_UnregisterHardwareContentProtection
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter3", object_id, "UnregisterHardwareContentProtectionTeardownStatus");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter3", object_id, "UnregisterHardwareContentProtectionTeardownStatus");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["dwCookie"], dwCookie, options);
     }
@@ -2690,10 +2690,10 @@ void Dx12JsonConsumer::Process_IDXGIAdapter3_QueryVideoMemoryInfo(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter3", object_id, "QueryVideoMemoryInfo");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter3", object_id, "QueryVideoMemoryInfo");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["NodeIndex"], NodeIndex, options);
         FieldToJson(args["MemorySegmentGroup"], MemorySegmentGroup, options);
@@ -2712,10 +2712,10 @@ void Dx12JsonConsumer::Process_IDXGIAdapter3_SetVideoMemoryReservation(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter3", object_id, "SetVideoMemoryReservation");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter3", object_id, "SetVideoMemoryReservation");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["NodeIndex"], NodeIndex, options);
         FieldToJson(args["MemorySegmentGroup"], MemorySegmentGroup, options);
@@ -2733,10 +2733,10 @@ void Dx12JsonConsumer::Process_IDXGIAdapter3_RegisterVideoMemoryBudgetChangeNoti
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter3", object_id, "RegisterVideoMemoryBudgetChangeNotificationEvent");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter3", object_id, "RegisterVideoMemoryBudgetChangeNotificationEvent");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["hEvent"], hEvent, options);
         FieldToJson(args["pdwCookie"], pdwCookie, options);
@@ -2751,9 +2751,9 @@ void Dx12JsonConsumer::Process_IDXGIAdapter3_UnregisterVideoMemoryBudgetChangeNo
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter3", object_id, "UnregisterVideoMemoryBudgetChangeNotification");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter3", object_id, "UnregisterVideoMemoryBudgetChangeNotification");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["dwCookie"], dwCookie, options);
     }
@@ -2776,10 +2776,10 @@ void Dx12JsonConsumer::Process_IDXGIOutput5_DuplicateOutput1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput5", object_id, "DuplicateOutput1");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput5", object_id, "DuplicateOutput1");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDevice"], pDevice, options);
         FieldToJson(args["Flags"], Flags, options);
@@ -2800,10 +2800,10 @@ void Dx12JsonConsumer::Process_IDXGISwapChain4_SetHDRMetaData(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain4", object_id, "SetHDRMetaData");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain4", object_id, "SetHDRMetaData");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Type"], Type, options);
         FieldToJson(args["Size"], Size, options);
@@ -2823,10 +2823,10 @@ void Dx12JsonConsumer::Process_IDXGIDevice4_OfferResources1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice4", object_id, "OfferResources1");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice4", object_id, "OfferResources1");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["NumResources"], NumResources, options);
         FieldToJson(args["ppResources"], ppResources, options);
@@ -2846,10 +2846,10 @@ void Dx12JsonConsumer::Process_IDXGIDevice4_ReclaimResources1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice4", object_id, "ReclaimResources1");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice4", object_id, "ReclaimResources1");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["NumResources"], NumResources, options);
         FieldToJson(args["ppResources"], ppResources, options);
@@ -2868,10 +2868,10 @@ void Dx12JsonConsumer::Process_DXGIDeclareAdapterRemovalSupport(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "DXGIDeclareAdapterRemovalSupport");
+    JsonValue& function = writer_->WriteApiCallStart(call_info, "DXGIDeclareAdapterRemovalSupport");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    JsonValue& args = function[format::kNameArgs];
     {
     }
     writer_->WriteBlockEnd();
@@ -2886,10 +2886,10 @@ void Dx12JsonConsumer::Process_IDXGIAdapter4_GetDesc3(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter4", object_id, "GetDesc3");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter4", object_id, "GetDesc3");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
     }
@@ -2904,10 +2904,10 @@ void Dx12JsonConsumer::Process_IDXGIOutput6_GetDesc1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput6", object_id, "GetDesc1");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput6", object_id, "GetDesc1");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
     }
@@ -2922,10 +2922,10 @@ void Dx12JsonConsumer::Process_IDXGIOutput6_CheckHardwareCompositionSupport(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput6", object_id, "CheckHardwareCompositionSupport");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput6", object_id, "CheckHardwareCompositionSupport");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pFlags"], pFlags, options);
     }
@@ -2943,10 +2943,10 @@ void Dx12JsonConsumer::Process_IDXGIFactory6_EnumAdapterByGpuPreference(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory6", object_id, "EnumAdapterByGpuPreference");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory6", object_id, "EnumAdapterByGpuPreference");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Adapter"], Adapter, options);
         FieldToJson(args["GpuPreference"], GpuPreference, options);
@@ -2965,10 +2965,10 @@ void Dx12JsonConsumer::Process_IDXGIFactory7_RegisterAdaptersChangedEvent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory7", object_id, "RegisterAdaptersChangedEvent");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory7", object_id, "RegisterAdaptersChangedEvent");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["hEvent"], hEvent, options);
         FieldToJson(args["pdwCookie"], pdwCookie, options);
@@ -2984,10 +2984,10 @@ void Dx12JsonConsumer::Process_IDXGIFactory7_UnregisterAdaptersChangedEvent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory7", object_id, "UnregisterAdaptersChangedEvent");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory7", object_id, "UnregisterAdaptersChangedEvent");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["dwCookie"], dwCookie, options);
     }
@@ -3008,10 +3008,10 @@ void Dx12JsonConsumer::Process_D3D12SerializeRootSignature(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "D3D12SerializeRootSignature");
+    JsonValue& function = writer_->WriteApiCallStart(call_info, "D3D12SerializeRootSignature");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    JsonValue& args = function[format::kNameArgs];
     {
         FieldToJson(args["pRootSignature"], pRootSignature, options);
         FieldToJson(args["Version"], Version, options);
@@ -3032,10 +3032,10 @@ void Dx12JsonConsumer::Process_D3D12CreateRootSignatureDeserializer(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "D3D12CreateRootSignatureDeserializer");
+    JsonValue& function = writer_->WriteApiCallStart(call_info, "D3D12CreateRootSignatureDeserializer");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    JsonValue& args = function[format::kNameArgs];
     {
         FieldToJson(args["pSrcData"], pSrcData, options);
         FieldToJson(args["SrcDataSizeInBytes"], SrcDataSizeInBytes, options);
@@ -3055,10 +3055,10 @@ void Dx12JsonConsumer::Process_D3D12SerializeVersionedRootSignature(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "D3D12SerializeVersionedRootSignature");
+    JsonValue& function = writer_->WriteApiCallStart(call_info, "D3D12SerializeVersionedRootSignature");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    JsonValue& args = function[format::kNameArgs];
     {
         FieldToJson(args["pRootSignature"], pRootSignature, options);
         FieldToJson(args["ppBlob"], ppBlob, options);
@@ -3078,10 +3078,10 @@ void Dx12JsonConsumer::Process_D3D12CreateVersionedRootSignatureDeserializer(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "D3D12CreateVersionedRootSignatureDeserializer");
+    JsonValue& function = writer_->WriteApiCallStart(call_info, "D3D12CreateVersionedRootSignatureDeserializer");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    JsonValue& args = function[format::kNameArgs];
     {
         FieldToJson(args["pSrcData"], pSrcData, options);
         FieldToJson(args["SrcDataSizeInBytes"], SrcDataSizeInBytes, options);
@@ -3102,10 +3102,10 @@ void Dx12JsonConsumer::Process_D3D12CreateDevice(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "D3D12CreateDevice");
+    JsonValue& function = writer_->WriteApiCallStart(call_info, "D3D12CreateDevice");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    JsonValue& args = function[format::kNameArgs];
     {
         FieldToJson(args["pAdapter"], pAdapter, options);
         FieldToJson(args["MinimumFeatureLevel"], MinimumFeatureLevel, options);
@@ -3124,10 +3124,10 @@ void Dx12JsonConsumer::Process_D3D12GetDebugInterface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "D3D12GetDebugInterface");
+    JsonValue& function = writer_->WriteApiCallStart(call_info, "D3D12GetDebugInterface");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    JsonValue& args = function[format::kNameArgs];
     {
         FieldToJson(args["riid"], riid, options);
         FieldToJson(args["ppvDebug"], ppvDebug, options);
@@ -3146,10 +3146,10 @@ void Dx12JsonConsumer::Process_D3D12EnableExperimentalFeatures(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "D3D12EnableExperimentalFeatures");
+    JsonValue& function = writer_->WriteApiCallStart(call_info, "D3D12EnableExperimentalFeatures");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    JsonValue& args = function[format::kNameArgs];
     {
         FieldToJson(args["NumFeatures"], NumFeatures, options);
         FieldToJson(args["pIIDs"], pIIDs, options);
@@ -3169,10 +3169,10 @@ void Dx12JsonConsumer::Process_D3D12GetInterface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "D3D12GetInterface");
+    JsonValue& function = writer_->WriteApiCallStart(call_info, "D3D12GetInterface");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    JsonValue& args = function[format::kNameArgs];
     {
         FieldToJson(args["rclsid"], rclsid, options);
         FieldToJson(args["riid"], riid, options);
@@ -3192,10 +3192,10 @@ void Dx12JsonConsumer::Process_ID3D12Object_GetPrivateData(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Object", object_id, "GetPrivateData");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Object", object_id, "GetPrivateData");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["guid"], guid, options);
         FieldToJson(args["pDataSize"], pDataSize, options);
@@ -3214,10 +3214,10 @@ void Dx12JsonConsumer::Process_ID3D12Object_SetPrivateData(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Object", object_id, "SetPrivateData");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Object", object_id, "SetPrivateData");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["guid"], guid, options);
         FieldToJson(args["DataSize"], DataSize, options);
@@ -3235,10 +3235,10 @@ void Dx12JsonConsumer::Process_ID3D12Object_SetPrivateDataInterface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Object", object_id, "SetPrivateDataInterface");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Object", object_id, "SetPrivateDataInterface");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["guid"], guid, options);
         FieldToJson(args["pData"], pData, options);
@@ -3254,10 +3254,10 @@ void Dx12JsonConsumer::Process_ID3D12Object_SetName(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Object", object_id, "SetName");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Object", object_id, "SetName");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Name"], Name, options);
     }
@@ -3273,10 +3273,10 @@ void Dx12JsonConsumer::Process_ID3D12DeviceChild_GetDevice(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceChild", object_id, "GetDevice");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceChild", object_id, "GetDevice");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["riid"], riid, options);
         FieldToJson(args["ppvDevice"], ppvDevice, options);
@@ -3291,7 +3291,7 @@ void Dx12JsonConsumer::Process_ID3D12RootSignatureDeserializer_GetRootSignatureD
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12RootSignatureDeserializer", object_id, "GetRootSignatureDesc");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12RootSignatureDeserializer", object_id, "GetRootSignatureDesc");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -3306,10 +3306,10 @@ void Dx12JsonConsumer::Process_ID3D12VersionedRootSignatureDeserializer_GetRootS
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12VersionedRootSignatureDeserializer", object_id, "GetRootSignatureDescAtVersion");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12VersionedRootSignatureDeserializer", object_id, "GetRootSignatureDescAtVersion");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["convertToVersion"], convertToVersion, options);
         FieldToJson(args["ppDesc"], ppDesc, options);
@@ -3324,7 +3324,7 @@ void Dx12JsonConsumer::Process_ID3D12VersionedRootSignatureDeserializer_GetUncon
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12VersionedRootSignatureDeserializer", object_id, "GetUnconvertedRootSignatureDesc");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12VersionedRootSignatureDeserializer", object_id, "GetUnconvertedRootSignatureDesc");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -3337,7 +3337,7 @@ void Dx12JsonConsumer::Process_ID3D12Heap_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Heap", object_id, "GetDesc");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Heap", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -3353,10 +3353,10 @@ void Dx12JsonConsumer::Process_ID3D12Resource_Map(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "Map");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "Map");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Subresource"], Subresource, options);
         FieldToJson(args["pReadRange"], pReadRange, options);
@@ -3373,9 +3373,9 @@ void Dx12JsonConsumer::Process_ID3D12Resource_Unmap(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "Unmap");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "Unmap");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Subresource"], Subresource, options);
         FieldToJson(args["pWrittenRange"], pWrittenRange, options);
@@ -3390,7 +3390,7 @@ void Dx12JsonConsumer::Process_ID3D12Resource_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "GetDesc");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -3403,7 +3403,7 @@ void Dx12JsonConsumer::Process_ID3D12Resource_GetGPUVirtualAddress(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "GetGPUVirtualAddress");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "GetGPUVirtualAddress");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJsonAsHex(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -3421,10 +3421,10 @@ void Dx12JsonConsumer::Process_ID3D12Resource_ReadFromSubresource(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "ReadFromSubresource");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "ReadFromSubresource");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDstData"], pDstData, options);
         FieldToJson(args["DstRowPitch"], DstRowPitch, options);
@@ -3444,10 +3444,10 @@ void Dx12JsonConsumer::Process_ID3D12Resource_GetHeapProperties(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "GetHeapProperties");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "GetHeapProperties");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pHeapProperties"], pHeapProperties, options);
         FieldToJson_D3D12_HEAP_FLAGS(args["pHeapFlags"], *pHeapFlags->GetPointer(), options);
@@ -3462,7 +3462,7 @@ void Dx12JsonConsumer::Process_ID3D12CommandAllocator_Reset(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandAllocator", object_id, "Reset");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandAllocator", object_id, "Reset");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -3475,7 +3475,7 @@ void Dx12JsonConsumer::Process_ID3D12Fence_GetCompletedValue(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Fence", object_id, "GetCompletedValue");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Fence", object_id, "GetCompletedValue");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -3490,10 +3490,10 @@ void Dx12JsonConsumer::Process_ID3D12Fence_SetEventOnCompletion(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Fence", object_id, "SetEventOnCompletion");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Fence", object_id, "SetEventOnCompletion");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Value"], Value, options);
         FieldToJson(args["hEvent"], hEvent, options);
@@ -3509,10 +3509,10 @@ void Dx12JsonConsumer::Process_ID3D12Fence_Signal(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Fence", object_id, "Signal");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Fence", object_id, "Signal");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Value"], Value, options);
     }
@@ -3526,7 +3526,7 @@ void Dx12JsonConsumer::Process_ID3D12Fence1_GetCreationFlags(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Fence1", object_id, "GetCreationFlags");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Fence1", object_id, "GetCreationFlags");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson_D3D12_FENCE_FLAGS(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -3540,10 +3540,10 @@ void Dx12JsonConsumer::Process_ID3D12PipelineState_GetCachedBlob(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12PipelineState", object_id, "GetCachedBlob");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12PipelineState", object_id, "GetCachedBlob");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["ppBlob"], ppBlob, options);
     }
@@ -3557,7 +3557,7 @@ void Dx12JsonConsumer::Process_ID3D12DescriptorHeap_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DescriptorHeap", object_id, "GetDesc");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DescriptorHeap", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -3570,7 +3570,7 @@ void Dx12JsonConsumer::Process_ID3D12DescriptorHeap_GetCPUDescriptorHandleForHea
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DescriptorHeap", object_id, "GetCPUDescriptorHandleForHeapStart");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DescriptorHeap", object_id, "GetCPUDescriptorHandleForHeapStart");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -3583,7 +3583,7 @@ void Dx12JsonConsumer::Process_ID3D12DescriptorHeap_GetGPUDescriptorHandleForHea
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DescriptorHeap", object_id, "GetGPUDescriptorHandleForHeapStart");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DescriptorHeap", object_id, "GetGPUDescriptorHandleForHeapStart");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -3596,7 +3596,7 @@ void Dx12JsonConsumer::Process_ID3D12CommandList_GetType(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandList", object_id, "GetType");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandList", object_id, "GetType");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -3609,7 +3609,7 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_Close(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "Close");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "Close");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -3624,10 +3624,10 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_Reset(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "Reset");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "Reset");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pAllocator"], pAllocator, options);
         FieldToJson(args["pInitialState"], pInitialState, options);
@@ -3642,9 +3642,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ClearState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ClearState");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ClearState");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pPipelineState"], pPipelineState, options);
     }
@@ -3661,9 +3661,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_DrawInstanced(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "DrawInstanced");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "DrawInstanced");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["VertexCountPerInstance"], VertexCountPerInstance, options);
         FieldToJson(args["InstanceCount"], InstanceCount, options);
@@ -3684,9 +3684,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_DrawIndexedInstanced(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "DrawIndexedInstanced");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "DrawIndexedInstanced");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["IndexCountPerInstance"], IndexCountPerInstance, options);
         FieldToJson(args["InstanceCount"], InstanceCount, options);
@@ -3706,9 +3706,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_Dispatch(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "Dispatch");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "Dispatch");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["ThreadGroupCountX"], ThreadGroupCountX, options);
         FieldToJson(args["ThreadGroupCountY"], ThreadGroupCountY, options);
@@ -3728,9 +3728,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_CopyBufferRegion(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "CopyBufferRegion");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "CopyBufferRegion");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDstBuffer"], pDstBuffer, options);
         FieldToJson(args["DstOffset"], DstOffset, options);
@@ -3753,9 +3753,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_CopyTextureRegion(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "CopyTextureRegion");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "CopyTextureRegion");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDst"], pDst, options);
         FieldToJson(args["DstX"], DstX, options);
@@ -3775,9 +3775,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_CopyResource(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "CopyResource");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "CopyResource");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDstResource"], pDstResource, options);
         FieldToJson(args["pSrcResource"], pSrcResource, options);
@@ -3797,9 +3797,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_CopyTiles(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "CopyTiles");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "CopyTiles");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pTiledResource"], pTiledResource, options);
         FieldToJson(args["pTileRegionStartCoordinate"], pTileRegionStartCoordinate, options);
@@ -3822,9 +3822,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ResolveSubresource(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ResolveSubresource");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ResolveSubresource");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDstResource"], pDstResource, options);
         FieldToJson(args["DstSubresource"], DstSubresource, options);
@@ -3842,9 +3842,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_IASetPrimitiveTopology(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "IASetPrimitiveTopology");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "IASetPrimitiveTopology");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["PrimitiveTopology"], PrimitiveTopology, options);
     }
@@ -3859,9 +3859,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_RSSetViewports(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "RSSetViewports");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "RSSetViewports");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["NumViewports"], NumViewports, options);
         FieldToJson(args["pViewports"], pViewports, options);
@@ -3877,9 +3877,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_RSSetScissorRects(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "RSSetScissorRects");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "RSSetScissorRects");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["NumRects"], NumRects, options);
         FieldToJson(args["pRects"], pRects, options);
@@ -3894,9 +3894,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_OMSetBlendFactor(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "OMSetBlendFactor");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "OMSetBlendFactor");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["BlendFactor"], BlendFactor, options);
     }
@@ -3910,9 +3910,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_OMSetStencilRef(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "OMSetStencilRef");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "OMSetStencilRef");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["StencilRef"], StencilRef, options);
     }
@@ -3926,9 +3926,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetPipelineState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetPipelineState");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetPipelineState");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pPipelineState"], pPipelineState, options);
     }
@@ -3943,9 +3943,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ResourceBarrier(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ResourceBarrier");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ResourceBarrier");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["NumBarriers"], NumBarriers, options);
         FieldToJson(args["pBarriers"], pBarriers, options);
@@ -3960,9 +3960,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ExecuteBundle(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ExecuteBundle");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ExecuteBundle");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pCommandList"], pCommandList, options);
     }
@@ -3977,9 +3977,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetDescriptorHeaps(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetDescriptorHeaps");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetDescriptorHeaps");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["NumDescriptorHeaps"], NumDescriptorHeaps, options);
         FieldToJson(args["ppDescriptorHeaps"], ppDescriptorHeaps, options);
@@ -3994,9 +3994,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetComputeRootSignature
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRootSignature");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRootSignature");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pRootSignature"], pRootSignature, options);
     }
@@ -4010,9 +4010,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetGraphicsRootSignatur
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRootSignature");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRootSignature");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pRootSignature"], pRootSignature, options);
     }
@@ -4027,9 +4027,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetComputeRootDescripto
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRootDescriptorTable");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRootDescriptorTable");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
         FieldToJson(args["BaseDescriptor"], BaseDescriptor, options);
@@ -4045,9 +4045,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetGraphicsRootDescript
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRootDescriptorTable");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRootDescriptorTable");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
         FieldToJson(args["BaseDescriptor"], BaseDescriptor, options);
@@ -4064,9 +4064,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetComputeRoot32BitCons
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRoot32BitConstant");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRoot32BitConstant");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
         FieldToJson(args["SrcData"], SrcData, options);
@@ -4084,9 +4084,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetGraphicsRoot32BitCon
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRoot32BitConstant");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRoot32BitConstant");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
         FieldToJson(args["SrcData"], SrcData, options);
@@ -4105,9 +4105,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetComputeRoot32BitCons
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRoot32BitConstants");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRoot32BitConstants");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
         FieldToJson(args["Num32BitValuesToSet"], Num32BitValuesToSet, options);
@@ -4127,9 +4127,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetGraphicsRoot32BitCon
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRoot32BitConstants");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRoot32BitConstants");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
         FieldToJson(args["Num32BitValuesToSet"], Num32BitValuesToSet, options);
@@ -4147,9 +4147,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetComputeRootConstantB
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRootConstantBufferView");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRootConstantBufferView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
         FieldToJsonAsHex(args["BufferLocation"], BufferLocation, options);
@@ -4165,9 +4165,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetGraphicsRootConstant
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRootConstantBufferView");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRootConstantBufferView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
         FieldToJsonAsHex(args["BufferLocation"], BufferLocation, options);
@@ -4183,9 +4183,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetComputeRootShaderRes
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRootShaderResourceView");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRootShaderResourceView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
         FieldToJsonAsHex(args["BufferLocation"], BufferLocation, options);
@@ -4201,9 +4201,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetGraphicsRootShaderRe
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRootShaderResourceView");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRootShaderResourceView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
         FieldToJsonAsHex(args["BufferLocation"], BufferLocation, options);
@@ -4219,9 +4219,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetComputeRootUnordered
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRootUnorderedAccessView");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRootUnorderedAccessView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
         FieldToJsonAsHex(args["BufferLocation"], BufferLocation, options);
@@ -4237,9 +4237,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetGraphicsRootUnordere
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRootUnorderedAccessView");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRootUnorderedAccessView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
         FieldToJsonAsHex(args["BufferLocation"], BufferLocation, options);
@@ -4254,9 +4254,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_IASetIndexBuffer(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "IASetIndexBuffer");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "IASetIndexBuffer");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pView"], pView, options);
     }
@@ -4272,9 +4272,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_IASetVertexBuffers(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "IASetVertexBuffers");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "IASetVertexBuffers");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["StartSlot"], StartSlot, options);
         FieldToJson(args["NumViews"], NumViews, options);
@@ -4292,9 +4292,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SOSetTargets(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SOSetTargets");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SOSetTargets");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["StartSlot"], StartSlot, options);
         FieldToJson(args["NumViews"], NumViews, options);
@@ -4313,9 +4313,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_OMSetRenderTargets(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "OMSetRenderTargets");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "OMSetRenderTargets");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["NumRenderTargetDescriptors"], NumRenderTargetDescriptors, options);
         FieldToJson(args["pRenderTargetDescriptors"], pRenderTargetDescriptors, options);
@@ -4337,9 +4337,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ClearDepthStencilView(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ClearDepthStencilView");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ClearDepthStencilView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["DepthStencilView"], DepthStencilView, options);
         FieldToJson_D3D12_CLEAR_FLAGS(args["ClearFlags"], ClearFlags, options);
@@ -4361,9 +4361,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ClearRenderTargetView(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ClearRenderTargetView");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ClearRenderTargetView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["RenderTargetView"], RenderTargetView, options);
         FieldToJson(args["ColorRGBA"], ColorRGBA, options);
@@ -4385,9 +4385,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ClearUnorderedAccessVie
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ClearUnorderedAccessViewUint");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ClearUnorderedAccessViewUint");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["ViewGPUHandleInCurrentHeap"], ViewGPUHandleInCurrentHeap, options);
         FieldToJson(args["ViewCPUHandle"], ViewCPUHandle, options);
@@ -4411,9 +4411,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ClearUnorderedAccessVie
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ClearUnorderedAccessViewFloat");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ClearUnorderedAccessViewFloat");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["ViewGPUHandleInCurrentHeap"], ViewGPUHandleInCurrentHeap, options);
         FieldToJson(args["ViewCPUHandle"], ViewCPUHandle, options);
@@ -4433,9 +4433,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_DiscardResource(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "DiscardResource");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "DiscardResource");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pResource"], pResource, options);
         FieldToJson(args["pRegion"], pRegion, options);
@@ -4452,9 +4452,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_BeginQuery(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "BeginQuery");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "BeginQuery");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pQueryHeap"], pQueryHeap, options);
         FieldToJson(args["Type"], Type, options);
@@ -4472,9 +4472,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_EndQuery(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "EndQuery");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "EndQuery");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pQueryHeap"], pQueryHeap, options);
         FieldToJson(args["Type"], Type, options);
@@ -4495,9 +4495,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ResolveQueryData(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ResolveQueryData");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ResolveQueryData");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pQueryHeap"], pQueryHeap, options);
         FieldToJson(args["Type"], Type, options);
@@ -4518,9 +4518,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetPredication(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetPredication");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetPredication");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pBuffer"], pBuffer, options);
         FieldToJson(args["AlignedBufferOffset"], AlignedBufferOffset, options);
@@ -4538,9 +4538,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetMarker(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetMarker");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetMarker");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Metadata"], Metadata, options);
         FieldToJson(args["pData"], pData, options);
@@ -4558,9 +4558,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_BeginEvent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "BeginEvent");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "BeginEvent");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Metadata"], Metadata, options);
         FieldToJson(args["pData"], pData, options);
@@ -4575,7 +4575,7 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_EndEvent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "EndEvent");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "EndEvent");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -4592,9 +4592,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ExecuteIndirect(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ExecuteIndirect");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ExecuteIndirect");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pCommandSignature"], pCommandSignature, options);
         FieldToJson(args["MaxCommandCount"], MaxCommandCount, options);
@@ -4619,9 +4619,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList1_AtomicCopyBufferUINT(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "AtomicCopyBufferUINT");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "AtomicCopyBufferUINT");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDstBuffer"], pDstBuffer, options);
         FieldToJson(args["DstOffset"], DstOffset, options);
@@ -4647,9 +4647,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList1_AtomicCopyBufferUINT64
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "AtomicCopyBufferUINT64");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "AtomicCopyBufferUINT64");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDstBuffer"], pDstBuffer, options);
         FieldToJson(args["DstOffset"], DstOffset, options);
@@ -4670,9 +4670,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList1_OMSetDepthBounds(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "OMSetDepthBounds");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "OMSetDepthBounds");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Min"], Min, options);
         FieldToJson(args["Max"], Max, options);
@@ -4689,9 +4689,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList1_SetSamplePositions(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "SetSamplePositions");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "SetSamplePositions");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["NumSamplesPerPixel"], NumSamplesPerPixel, options);
         FieldToJson(args["NumPixels"], NumPixels, options);
@@ -4715,9 +4715,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList1_ResolveSubresourceRegi
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "ResolveSubresourceRegion");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "ResolveSubresourceRegion");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDstResource"], pDstResource, options);
         FieldToJson(args["DstSubresource"], DstSubresource, options);
@@ -4739,9 +4739,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList1_SetViewInstanceMask(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "SetViewInstanceMask");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "SetViewInstanceMask");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJsonAsFixedWidthBinary(args["Mask"], Mask, options);
     }
@@ -4757,9 +4757,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList2_WriteBufferImmediate(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList2", object_id, "WriteBufferImmediate");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList2", object_id, "WriteBufferImmediate");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Count"], Count, options);
         FieldToJson(args["pParams"], pParams, options);
@@ -4784,9 +4784,9 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_UpdateTileMappings(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "UpdateTileMappings");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "UpdateTileMappings");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pResource"], pResource, options);
         FieldToJson(args["NumResourceRegions"], NumResourceRegions, options);
@@ -4814,9 +4814,9 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_CopyTileMappings(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "CopyTileMappings");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "CopyTileMappings");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDstResource"], pDstResource, options);
         FieldToJson(args["pDstRegionStartCoordinate"], pDstRegionStartCoordinate, options);
@@ -4836,9 +4836,9 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_ExecuteCommandLists(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "ExecuteCommandLists");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "ExecuteCommandLists");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["NumCommandLists"], NumCommandLists, options);
         FieldToJson(args["ppCommandLists"], ppCommandLists, options);
@@ -4855,9 +4855,9 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_SetMarker(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "SetMarker");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "SetMarker");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Metadata"], Metadata, options);
         FieldToJson(args["pData"], pData, options);
@@ -4875,9 +4875,9 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_BeginEvent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "BeginEvent");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "BeginEvent");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Metadata"], Metadata, options);
         FieldToJson(args["pData"], pData, options);
@@ -4892,7 +4892,7 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_EndEvent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "EndEvent");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "EndEvent");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -4906,10 +4906,10 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_Signal(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "Signal");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "Signal");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pFence"], pFence, options);
         FieldToJson(args["Value"], Value, options);
@@ -4926,10 +4926,10 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_Wait(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "Wait");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "Wait");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pFence"], pFence, options);
         FieldToJson(args["Value"], Value, options);
@@ -4945,10 +4945,10 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_GetTimestampFrequency(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "GetTimestampFrequency");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "GetTimestampFrequency");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pFrequency"], pFrequency, options);
     }
@@ -4964,10 +4964,10 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_GetClockCalibration(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "GetClockCalibration");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "GetClockCalibration");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pGpuTimestamp"], pGpuTimestamp, options);
         FieldToJson(args["pCpuTimestamp"], pCpuTimestamp, options);
@@ -4982,7 +4982,7 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "GetDesc");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -4995,7 +4995,7 @@ void Dx12JsonConsumer::Process_ID3D12Device_GetNodeCount(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetNodeCount");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetNodeCount");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -5011,10 +5011,10 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateCommandQueue(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateCommandQueue");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateCommandQueue");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
         FieldToJson(args["riid"], riid, options);
@@ -5033,10 +5033,10 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateCommandAllocator(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateCommandAllocator");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateCommandAllocator");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["type"], type, options);
         FieldToJson(args["riid"], riid, options);
@@ -5055,10 +5055,10 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateGraphicsPipelineState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateGraphicsPipelineState");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateGraphicsPipelineState");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
         FieldToJson(args["riid"], riid, options);
@@ -5077,10 +5077,10 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateComputePipelineState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateComputePipelineState");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateComputePipelineState");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
         FieldToJson(args["riid"], riid, options);
@@ -5102,10 +5102,10 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateCommandList(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateCommandList");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateCommandList");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJsonAsFixedWidthBinary(args["nodeMask"], nodeMask, options);
         FieldToJson(args["type"], type, options);
@@ -5127,10 +5127,10 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateDescriptorHeap(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateDescriptorHeap");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateDescriptorHeap");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDescriptorHeapDesc"], pDescriptorHeapDesc, options);
         FieldToJson(args["riid"], riid, options);
@@ -5147,10 +5147,10 @@ void Dx12JsonConsumer::Process_ID3D12Device_GetDescriptorHandleIncrementSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetDescriptorHandleIncrementSize");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetDescriptorHandleIncrementSize");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["DescriptorHeapType"], DescriptorHeapType, options);
     }
@@ -5169,10 +5169,10 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateRootSignature(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateRootSignature");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateRootSignature");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJsonAsFixedWidthBinary(args["nodeMask"], nodeMask, options);
         FieldToJson(args["pBlobWithRootSignature"], pBlobWithRootSignature, options);
@@ -5191,9 +5191,9 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateConstantBufferView(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateConstantBufferView");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateConstantBufferView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
         FieldToJson(args["DestDescriptor"], DestDescriptor, options);
@@ -5210,9 +5210,9 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateShaderResourceView(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateShaderResourceView");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateShaderResourceView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pResource"], pResource, options);
         FieldToJson(args["pDesc"], pDesc, options);
@@ -5231,9 +5231,9 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateUnorderedAccessView(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateUnorderedAccessView");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateUnorderedAccessView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pResource"], pResource, options);
         FieldToJson(args["pCounterResource"], pCounterResource, options);
@@ -5252,9 +5252,9 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateRenderTargetView(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateRenderTargetView");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateRenderTargetView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pResource"], pResource, options);
         FieldToJson(args["pDesc"], pDesc, options);
@@ -5272,9 +5272,9 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateDepthStencilView(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateDepthStencilView");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateDepthStencilView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pResource"], pResource, options);
         FieldToJson(args["pDesc"], pDesc, options);
@@ -5291,9 +5291,9 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateSampler(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateSampler");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateSampler");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
         FieldToJson(args["DestDescriptor"], DestDescriptor, options);
@@ -5314,9 +5314,9 @@ void Dx12JsonConsumer::Process_ID3D12Device_CopyDescriptors(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CopyDescriptors");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CopyDescriptors");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["NumDestDescriptorRanges"], NumDestDescriptorRanges, options);
         FieldToJson(args["pDestDescriptorRangeStarts"], pDestDescriptorRangeStarts, options);
@@ -5339,9 +5339,9 @@ void Dx12JsonConsumer::Process_ID3D12Device_CopyDescriptorsSimple(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CopyDescriptorsSimple");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CopyDescriptorsSimple");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["NumDescriptors"], NumDescriptors, options);
         FieldToJson(args["DestDescriptorRangeStart"], DestDescriptorRangeStart, options);
@@ -5361,10 +5361,10 @@ void Dx12JsonConsumer::Process_ID3D12Device_GetResourceAllocationInfo(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetResourceAllocationInfo");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetResourceAllocationInfo");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJsonAsFixedWidthBinary(args["visibleMask"], visibleMask, options);
         FieldToJson(args["numResourceDescs"], numResourceDescs, options);
@@ -5382,10 +5382,10 @@ void Dx12JsonConsumer::Process_ID3D12Device_GetCustomHeapProperties(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetCustomHeapProperties");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetCustomHeapProperties");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJsonAsFixedWidthBinary(args["nodeMask"], nodeMask, options);
         FieldToJson(args["heapType"], heapType, options);
@@ -5407,10 +5407,10 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateCommittedResource(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateCommittedResource");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateCommittedResource");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pHeapProperties"], pHeapProperties, options);
         FieldToJson_D3D12_HEAP_FLAGS(args["HeapFlags"], HeapFlags, options);
@@ -5433,10 +5433,10 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateHeap(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateHeap");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateHeap");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
         FieldToJson(args["riid"], riid, options);
@@ -5459,10 +5459,10 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreatePlacedResource(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreatePlacedResource");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreatePlacedResource");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pHeap"], pHeap, options);
         FieldToJson(args["HeapOffset"], HeapOffset, options);
@@ -5487,10 +5487,10 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateReservedResource(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateReservedResource");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateReservedResource");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
         FieldToJson_D3D12_RESOURCE_STATES(args["InitialState"], InitialState, options);
@@ -5513,10 +5513,10 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateSharedHandle(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateSharedHandle");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateSharedHandle");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pObject"], pObject, options);
         FieldToJson(args["pAttributes"], pAttributes, options);
@@ -5537,10 +5537,10 @@ void Dx12JsonConsumer::Process_ID3D12Device_OpenSharedHandle(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "OpenSharedHandle");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "OpenSharedHandle");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["NTHandle"], NTHandle, options);
         FieldToJson(args["riid"], riid, options);
@@ -5559,10 +5559,10 @@ void Dx12JsonConsumer::Process_ID3D12Device_OpenSharedHandleByName(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "OpenSharedHandleByName");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "OpenSharedHandleByName");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Name"], Name, options);
         FieldToJson(args["Access"], Access, options);
@@ -5580,10 +5580,10 @@ void Dx12JsonConsumer::Process_ID3D12Device_MakeResident(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "MakeResident");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "MakeResident");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["NumObjects"], NumObjects, options);
         FieldToJson(args["ppObjects"], ppObjects, options);
@@ -5600,10 +5600,10 @@ void Dx12JsonConsumer::Process_ID3D12Device_Evict(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "Evict");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "Evict");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["NumObjects"], NumObjects, options);
         FieldToJson(args["ppObjects"], ppObjects, options);
@@ -5622,10 +5622,10 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateFence(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateFence");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateFence");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["InitialValue"], InitialValue, options);
         FieldToJson_D3D12_FENCE_FLAGS(args["Flags"], Flags, options);
@@ -5642,7 +5642,7 @@ void Dx12JsonConsumer::Process_ID3D12Device_GetDeviceRemovedReason(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetDeviceRemovedReason");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetDeviceRemovedReason");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -5662,9 +5662,9 @@ void Dx12JsonConsumer::Process_ID3D12Device_GetCopyableFootprints(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetCopyableFootprints");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetCopyableFootprints");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pResourceDesc"], pResourceDesc, options);
         FieldToJson(args["FirstSubresource"], FirstSubresource, options);
@@ -5688,10 +5688,10 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateQueryHeap(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateQueryHeap");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateQueryHeap");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
         FieldToJson(args["riid"], riid, options);
@@ -5708,10 +5708,10 @@ void Dx12JsonConsumer::Process_ID3D12Device_SetStablePowerState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "SetStablePowerState");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "SetStablePowerState");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         Bool32ToJson(args["Enable"], Enable, options);
     }
@@ -5729,10 +5729,10 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateCommandSignature(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateCommandSignature");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateCommandSignature");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
         FieldToJson(args["pRootSignature"], pRootSignature, options);
@@ -5755,9 +5755,9 @@ void Dx12JsonConsumer::Process_ID3D12Device_GetResourceTiling(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetResourceTiling");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetResourceTiling");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pTiledResource"], pTiledResource, options);
         FieldToJson(args["pNumTilesForEntireResource"], pNumTilesForEntireResource, options);
@@ -5777,7 +5777,7 @@ void Dx12JsonConsumer::Process_ID3D12Device_GetAdapterLuid(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetAdapterLuid");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetAdapterLuid");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -5792,10 +5792,10 @@ void Dx12JsonConsumer::Process_ID3D12PipelineLibrary_StorePipeline(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12PipelineLibrary", object_id, "StorePipeline");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12PipelineLibrary", object_id, "StorePipeline");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pName"], pName, options);
         FieldToJson(args["pPipeline"], pPipeline, options);
@@ -5814,10 +5814,10 @@ void Dx12JsonConsumer::Process_ID3D12PipelineLibrary_LoadGraphicsPipeline(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12PipelineLibrary", object_id, "LoadGraphicsPipeline");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12PipelineLibrary", object_id, "LoadGraphicsPipeline");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pName"], pName, options);
         FieldToJson(args["pDesc"], pDesc, options);
@@ -5838,10 +5838,10 @@ void Dx12JsonConsumer::Process_ID3D12PipelineLibrary_LoadComputePipeline(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12PipelineLibrary", object_id, "LoadComputePipeline");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12PipelineLibrary", object_id, "LoadComputePipeline");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pName"], pName, options);
         FieldToJson(args["pDesc"], pDesc, options);
@@ -5858,7 +5858,7 @@ void Dx12JsonConsumer::Process_ID3D12PipelineLibrary_GetSerializedSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12PipelineLibrary", object_id, "GetSerializedSize");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12PipelineLibrary", object_id, "GetSerializedSize");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -5873,10 +5873,10 @@ void Dx12JsonConsumer::Process_ID3D12PipelineLibrary_Serialize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12PipelineLibrary", object_id, "Serialize");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12PipelineLibrary", object_id, "Serialize");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pData"], pData, options);
         FieldToJson(args["DataSizeInBytes"], DataSizeInBytes, options);
@@ -5895,10 +5895,10 @@ void Dx12JsonConsumer::Process_ID3D12PipelineLibrary1_LoadPipeline(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12PipelineLibrary1", object_id, "LoadPipeline");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12PipelineLibrary1", object_id, "LoadPipeline");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pName"], pName, options);
         FieldToJson(args["pDesc"], pDesc, options);
@@ -5919,10 +5919,10 @@ void Dx12JsonConsumer::Process_ID3D12Device1_CreatePipelineLibrary(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device1", object_id, "CreatePipelineLibrary");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device1", object_id, "CreatePipelineLibrary");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pLibraryBlob"], pLibraryBlob, options);
         FieldToJson(args["BlobLength"], BlobLength, options);
@@ -5944,10 +5944,10 @@ void Dx12JsonConsumer::Process_ID3D12Device1_SetEventOnMultipleFenceCompletion(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device1", object_id, "SetEventOnMultipleFenceCompletion");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device1", object_id, "SetEventOnMultipleFenceCompletion");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["ppFences"], ppFences, options);
         FieldToJson(args["pFenceValues"], pFenceValues, options);
@@ -5968,10 +5968,10 @@ void Dx12JsonConsumer::Process_ID3D12Device1_SetResidencyPriority(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device1", object_id, "SetResidencyPriority");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device1", object_id, "SetResidencyPriority");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["NumObjects"], NumObjects, options);
         FieldToJson(args["ppObjects"], ppObjects, options);
@@ -5990,10 +5990,10 @@ void Dx12JsonConsumer::Process_ID3D12Device2_CreatePipelineState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device2", object_id, "CreatePipelineState");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device2", object_id, "CreatePipelineState");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
         FieldToJson(args["riid"], riid, options);
@@ -6012,10 +6012,10 @@ void Dx12JsonConsumer::Process_ID3D12Device3_OpenExistingHeapFromAddress(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device3", object_id, "OpenExistingHeapFromAddress");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device3", object_id, "OpenExistingHeapFromAddress");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pAddress"], pAddress, options);
         FieldToJson(args["riid"], riid, options);
@@ -6034,10 +6034,10 @@ void Dx12JsonConsumer::Process_ID3D12Device3_OpenExistingHeapFromFileMapping(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device3", object_id, "OpenExistingHeapFromFileMapping");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device3", object_id, "OpenExistingHeapFromFileMapping");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["hFileMapping"], hFileMapping, options);
         FieldToJson(args["riid"], riid, options);
@@ -6058,10 +6058,10 @@ void Dx12JsonConsumer::Process_ID3D12Device3_EnqueueMakeResident(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device3", object_id, "EnqueueMakeResident");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device3", object_id, "EnqueueMakeResident");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson_D3D12_RESIDENCY_FLAGS(args["Flags"], Flags, options);
         FieldToJson(args["NumObjects"], NumObjects, options);
@@ -6081,10 +6081,10 @@ void Dx12JsonConsumer::Process_ID3D12ProtectedSession_GetStatusFence(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12ProtectedSession", object_id, "GetStatusFence");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12ProtectedSession", object_id, "GetStatusFence");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["riid"], riid, options);
         FieldToJson(args["ppFence"], ppFence, options);
@@ -6099,7 +6099,7 @@ void Dx12JsonConsumer::Process_ID3D12ProtectedSession_GetSessionStatus(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12ProtectedSession", object_id, "GetSessionStatus");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12ProtectedSession", object_id, "GetSessionStatus");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson_D3D12_PROTECTED_SESSION_STATUS(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -6112,7 +6112,7 @@ void Dx12JsonConsumer::Process_ID3D12ProtectedResourceSession_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12ProtectedResourceSession", object_id, "GetDesc");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12ProtectedResourceSession", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -6130,10 +6130,10 @@ void Dx12JsonConsumer::Process_ID3D12Device4_CreateCommandList1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device4", object_id, "CreateCommandList1");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device4", object_id, "CreateCommandList1");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJsonAsFixedWidthBinary(args["nodeMask"], nodeMask, options);
         FieldToJson(args["type"], type, options);
@@ -6154,10 +6154,10 @@ void Dx12JsonConsumer::Process_ID3D12Device4_CreateProtectedResourceSession(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device4", object_id, "CreateProtectedResourceSession");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device4", object_id, "CreateProtectedResourceSession");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
         FieldToJson(args["riid"], riid, options);
@@ -6181,10 +6181,10 @@ void Dx12JsonConsumer::Process_ID3D12Device4_CreateCommittedResource1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device4", object_id, "CreateCommittedResource1");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device4", object_id, "CreateCommittedResource1");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pHeapProperties"], pHeapProperties, options);
         FieldToJson_D3D12_HEAP_FLAGS(args["HeapFlags"], HeapFlags, options);
@@ -6209,10 +6209,10 @@ void Dx12JsonConsumer::Process_ID3D12Device4_CreateHeap1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device4", object_id, "CreateHeap1");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device4", object_id, "CreateHeap1");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
         FieldToJson(args["pProtectedSession"], pProtectedSession, options);
@@ -6235,10 +6235,10 @@ void Dx12JsonConsumer::Process_ID3D12Device4_CreateReservedResource1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device4", object_id, "CreateReservedResource1");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device4", object_id, "CreateReservedResource1");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
         FieldToJson_D3D12_RESOURCE_STATES(args["InitialState"], InitialState, options);
@@ -6261,10 +6261,10 @@ void Dx12JsonConsumer::Process_ID3D12Device4_GetResourceAllocationInfo1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device4", object_id, "GetResourceAllocationInfo1");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device4", object_id, "GetResourceAllocationInfo1");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJsonAsFixedWidthBinary(args["visibleMask"], visibleMask, options);
         FieldToJson(args["numResourceDescs"], numResourceDescs, options);
@@ -6281,9 +6281,9 @@ void Dx12JsonConsumer::Process_ID3D12LifetimeOwner_LifetimeStateUpdated(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12LifetimeOwner", object_id, "LifetimeStateUpdated");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12LifetimeOwner", object_id, "LifetimeStateUpdated");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["NewState"], NewState, options);
     }
@@ -6297,7 +6297,7 @@ void Dx12JsonConsumer::Process_ID3D12SwapChainAssistant_GetLUID(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SwapChainAssistant", object_id, "GetLUID");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12SwapChainAssistant", object_id, "GetLUID");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -6312,10 +6312,10 @@ void Dx12JsonConsumer::Process_ID3D12SwapChainAssistant_GetSwapChainObject(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SwapChainAssistant", object_id, "GetSwapChainObject");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12SwapChainAssistant", object_id, "GetSwapChainObject");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["riid"], riid, options);
         FieldToJson(args["ppv"], ppv, options);
@@ -6334,10 +6334,10 @@ void Dx12JsonConsumer::Process_ID3D12SwapChainAssistant_GetCurrentResourceAndCom
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SwapChainAssistant", object_id, "GetCurrentResourceAndCommandQueue");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12SwapChainAssistant", object_id, "GetCurrentResourceAndCommandQueue");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["riidResource"], riidResource, options);
         FieldToJson(args["ppvResource"], ppvResource, options);
@@ -6354,7 +6354,7 @@ void Dx12JsonConsumer::Process_ID3D12SwapChainAssistant_InsertImplicitSync(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SwapChainAssistant", object_id, "InsertImplicitSync");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12SwapChainAssistant", object_id, "InsertImplicitSync");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -6368,10 +6368,10 @@ void Dx12JsonConsumer::Process_ID3D12LifetimeTracker_DestroyOwnedObject(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12LifetimeTracker", object_id, "DestroyOwnedObject");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12LifetimeTracker", object_id, "DestroyOwnedObject");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pObject"], pObject, options);
     }
@@ -6386,10 +6386,10 @@ void Dx12JsonConsumer::Process_ID3D12StateObjectProperties_GetShaderIdentifier(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12StateObjectProperties", object_id, "GetShaderIdentifier");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12StateObjectProperties", object_id, "GetShaderIdentifier");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pExportName"], pExportName, options);
     }
@@ -6404,10 +6404,10 @@ void Dx12JsonConsumer::Process_ID3D12StateObjectProperties_GetShaderStackSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12StateObjectProperties", object_id, "GetShaderStackSize");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12StateObjectProperties", object_id, "GetShaderStackSize");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pExportName"], pExportName, options);
     }
@@ -6421,7 +6421,7 @@ void Dx12JsonConsumer::Process_ID3D12StateObjectProperties_GetPipelineStackSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12StateObjectProperties", object_id, "GetPipelineStackSize");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12StateObjectProperties", object_id, "GetPipelineStackSize");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -6434,9 +6434,9 @@ void Dx12JsonConsumer::Process_ID3D12StateObjectProperties_SetPipelineStackSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12StateObjectProperties", object_id, "SetPipelineStackSize");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12StateObjectProperties", object_id, "SetPipelineStackSize");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["PipelineStackSizeInBytes"], PipelineStackSizeInBytes, options);
     }
@@ -6453,10 +6453,10 @@ void Dx12JsonConsumer::Process_ID3D12Device5_CreateLifetimeTracker(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "CreateLifetimeTracker");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "CreateLifetimeTracker");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pOwner"], pOwner, options);
         FieldToJson(args["riid"], riid, options);
@@ -6471,7 +6471,7 @@ void Dx12JsonConsumer::Process_ID3D12Device5_RemoveDevice(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "RemoveDevice");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "RemoveDevice");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -6485,10 +6485,10 @@ void Dx12JsonConsumer::Process_ID3D12Device5_EnumerateMetaCommands(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "EnumerateMetaCommands");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "EnumerateMetaCommands");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pNumMetaCommands"], pNumMetaCommands, options);
         FieldToJson(args["pDescs"], pDescs, options);
@@ -6508,10 +6508,10 @@ void Dx12JsonConsumer::Process_ID3D12Device5_EnumerateMetaCommandParameters(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "EnumerateMetaCommandParameters");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "EnumerateMetaCommandParameters");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["CommandId"], CommandId, options);
         FieldToJson(args["Stage"], Stage, options);
@@ -6535,10 +6535,10 @@ void Dx12JsonConsumer::Process_ID3D12Device5_CreateMetaCommand(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "CreateMetaCommand");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "CreateMetaCommand");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["CommandId"], CommandId, options);
         FieldToJsonAsFixedWidthBinary(args["NodeMask"], NodeMask, options);
@@ -6560,10 +6560,10 @@ void Dx12JsonConsumer::Process_ID3D12Device5_CreateStateObject(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "CreateStateObject");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "CreateStateObject");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
         FieldToJson(args["riid"], riid, options);
@@ -6580,9 +6580,9 @@ void Dx12JsonConsumer::Process_ID3D12Device5_GetRaytracingAccelerationStructureP
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "GetRaytracingAccelerationStructurePrebuildInfo");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "GetRaytracingAccelerationStructurePrebuildInfo");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
         FieldToJson(args["pInfo"], pInfo, options);
@@ -6599,10 +6599,10 @@ void Dx12JsonConsumer::Process_ID3D12Device5_CheckDriverMatchingIdentifier(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "CheckDriverMatchingIdentifier");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "CheckDriverMatchingIdentifier");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson_D3D12_DRIVER_MATCHING_IDENTIFIER_STATUS(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["SerializedDataType"], SerializedDataType, options);
         FieldToJson(args["pIdentifierToCheck"], pIdentifierToCheck, options);
@@ -6617,9 +6617,9 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedDataSettings_SetAutoBr
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedDataSettings", object_id, "SetAutoBreadcrumbsEnablement");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedDataSettings", object_id, "SetAutoBreadcrumbsEnablement");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Enablement"], Enablement, options);
     }
@@ -6633,9 +6633,9 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedDataSettings_SetPageFa
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedDataSettings", object_id, "SetPageFaultEnablement");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedDataSettings", object_id, "SetPageFaultEnablement");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Enablement"], Enablement, options);
     }
@@ -6649,9 +6649,9 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedDataSettings_SetWatson
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedDataSettings", object_id, "SetWatsonDumpEnablement");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedDataSettings", object_id, "SetWatsonDumpEnablement");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Enablement"], Enablement, options);
     }
@@ -6665,9 +6665,9 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedDataSettings1_SetBread
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedDataSettings1", object_id, "SetBreadcrumbContextEnablement");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedDataSettings1", object_id, "SetBreadcrumbContextEnablement");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Enablement"], Enablement, options);
     }
@@ -6681,9 +6681,9 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedDataSettings2_UseMarke
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedDataSettings2", object_id, "UseMarkersOnlyAutoBreadcrumbs");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedDataSettings2", object_id, "UseMarkersOnlyAutoBreadcrumbs");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         Bool32ToJson(args["MarkersOnly"], MarkersOnly, options);
     }
@@ -6698,10 +6698,10 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedData_GetAutoBreadcrumb
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData", object_id, "GetAutoBreadcrumbsOutput");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData", object_id, "GetAutoBreadcrumbsOutput");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pOutput"], pOutput, options);
     }
@@ -6716,10 +6716,10 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedData_GetPageFaultAlloc
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData", object_id, "GetPageFaultAllocationOutput");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData", object_id, "GetPageFaultAllocationOutput");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pOutput"], pOutput, options);
     }
@@ -6734,10 +6734,10 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedData1_GetAutoBreadcrum
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData1", object_id, "GetAutoBreadcrumbsOutput1");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData1", object_id, "GetAutoBreadcrumbsOutput1");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pOutput"], pOutput, options);
     }
@@ -6752,10 +6752,10 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedData1_GetPageFaultAllo
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData1", object_id, "GetPageFaultAllocationOutput1");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData1", object_id, "GetPageFaultAllocationOutput1");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pOutput"], pOutput, options);
     }
@@ -6770,10 +6770,10 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedData2_GetPageFaultAllo
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData2", object_id, "GetPageFaultAllocationOutput2");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData2", object_id, "GetPageFaultAllocationOutput2");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pOutput"], pOutput, options);
     }
@@ -6787,7 +6787,7 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedData2_GetDeviceState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData2", object_id, "GetDeviceState");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData2", object_id, "GetDeviceState");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -6804,10 +6804,10 @@ void Dx12JsonConsumer::Process_ID3D12Device6_SetBackgroundProcessingMode(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device6", object_id, "SetBackgroundProcessingMode");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device6", object_id, "SetBackgroundProcessingMode");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Mode"], Mode, options);
         FieldToJson(args["MeasurementsAction"], MeasurementsAction, options);
@@ -6824,7 +6824,7 @@ void Dx12JsonConsumer::Process_ID3D12ProtectedResourceSession1_GetDesc1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12ProtectedResourceSession1", object_id, "GetDesc1");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12ProtectedResourceSession1", object_id, "GetDesc1");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -6841,10 +6841,10 @@ void Dx12JsonConsumer::Process_ID3D12Device7_AddToStateObject(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device7", object_id, "AddToStateObject");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device7", object_id, "AddToStateObject");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pAddition"], pAddition, options);
         FieldToJson(args["pStateObjectToGrowFrom"], pStateObjectToGrowFrom, options);
@@ -6864,10 +6864,10 @@ void Dx12JsonConsumer::Process_ID3D12Device7_CreateProtectedResourceSession1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device7", object_id, "CreateProtectedResourceSession1");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device7", object_id, "CreateProtectedResourceSession1");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
         FieldToJson(args["riid"], riid, options);
@@ -6887,10 +6887,10 @@ void Dx12JsonConsumer::Process_ID3D12Device8_GetResourceAllocationInfo2(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device8", object_id, "GetResourceAllocationInfo2");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device8", object_id, "GetResourceAllocationInfo2");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJsonAsFixedWidthBinary(args["visibleMask"], visibleMask, options);
         FieldToJson(args["numResourceDescs"], numResourceDescs, options);
@@ -6915,10 +6915,10 @@ void Dx12JsonConsumer::Process_ID3D12Device8_CreateCommittedResource2(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device8", object_id, "CreateCommittedResource2");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device8", object_id, "CreateCommittedResource2");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pHeapProperties"], pHeapProperties, options);
         FieldToJson_D3D12_HEAP_FLAGS(args["HeapFlags"], HeapFlags, options);
@@ -6946,10 +6946,10 @@ void Dx12JsonConsumer::Process_ID3D12Device8_CreatePlacedResource1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device8", object_id, "CreatePlacedResource1");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device8", object_id, "CreatePlacedResource1");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pHeap"], pHeap, options);
         FieldToJson(args["HeapOffset"], HeapOffset, options);
@@ -6971,9 +6971,9 @@ void Dx12JsonConsumer::Process_ID3D12Device8_CreateSamplerFeedbackUnorderedAcces
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device8", object_id, "CreateSamplerFeedbackUnorderedAccessView");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device8", object_id, "CreateSamplerFeedbackUnorderedAccessView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pTargetedResource"], pTargetedResource, options);
         FieldToJson(args["pFeedbackResource"], pFeedbackResource, options);
@@ -6996,9 +6996,9 @@ void Dx12JsonConsumer::Process_ID3D12Device8_GetCopyableFootprints1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device8", object_id, "GetCopyableFootprints1");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device8", object_id, "GetCopyableFootprints1");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pResourceDesc"], pResourceDesc, options);
         FieldToJson(args["FirstSubresource"], FirstSubresource, options);
@@ -7021,10 +7021,10 @@ void Dx12JsonConsumer::Process_ID3D12Resource1_GetProtectedResourceSession(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource1", object_id, "GetProtectedResourceSession");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource1", object_id, "GetProtectedResourceSession");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["riid"], riid, options);
         FieldToJson(args["ppProtectedSession"], ppProtectedSession, options);
@@ -7039,7 +7039,7 @@ void Dx12JsonConsumer::Process_ID3D12Resource2_GetDesc1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource2", object_id, "GetDesc1");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource2", object_id, "GetDesc1");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -7054,10 +7054,10 @@ void Dx12JsonConsumer::Process_ID3D12Heap1_GetProtectedResourceSession(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Heap1", object_id, "GetProtectedResourceSession");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Heap1", object_id, "GetProtectedResourceSession");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["riid"], riid, options);
         FieldToJson(args["ppProtectedSession"], ppProtectedSession, options);
@@ -7072,9 +7072,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList3_SetProtectedResourceSe
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList3", object_id, "SetProtectedResourceSession");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList3", object_id, "SetProtectedResourceSession");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pProtectedResourceSession"], pProtectedResourceSession, options);
     }
@@ -7090,10 +7090,10 @@ void Dx12JsonConsumer::Process_ID3D12MetaCommand_GetRequiredParameterResourceSiz
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12MetaCommand", object_id, "GetRequiredParameterResourceSize");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12MetaCommand", object_id, "GetRequiredParameterResourceSize");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Stage"], Stage, options);
         FieldToJson(args["ParameterIndex"], ParameterIndex, options);
@@ -7111,9 +7111,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_BeginRenderPass(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "BeginRenderPass");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "BeginRenderPass");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["NumRenderTargets"], NumRenderTargets, options);
         FieldToJson(args["pRenderTargets"], pRenderTargets, options);
@@ -7129,7 +7129,7 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_EndRenderPass(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "EndRenderPass");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "EndRenderPass");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -7143,9 +7143,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_InitializeMetaCommand(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "InitializeMetaCommand");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "InitializeMetaCommand");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pMetaCommand"], pMetaCommand, options);
         FieldToJson(args["pInitializationParametersData"], pInitializationParametersData, options);
@@ -7163,9 +7163,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_ExecuteMetaCommand(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "ExecuteMetaCommand");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "ExecuteMetaCommand");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pMetaCommand"], pMetaCommand, options);
         FieldToJson(args["pExecutionParametersData"], pExecutionParametersData, options);
@@ -7183,9 +7183,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_BuildRaytracingAcceler
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "BuildRaytracingAccelerationStructure");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "BuildRaytracingAccelerationStructure");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
         FieldToJson(args["NumPostbuildInfoDescs"], NumPostbuildInfoDescs, options);
@@ -7203,9 +7203,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_EmitRaytracingAccelera
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "EmitRaytracingAccelerationStructurePostbuildInfo");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "EmitRaytracingAccelerationStructurePostbuildInfo");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
         FieldToJson(args["NumSourceAccelerationStructures"], NumSourceAccelerationStructures, options);
@@ -7223,9 +7223,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_CopyRaytracingAccelera
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "CopyRaytracingAccelerationStructure");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "CopyRaytracingAccelerationStructure");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJsonAsHex(args["DestAccelerationStructureData"], DestAccelerationStructureData, options);
         FieldToJsonAsHex(args["SourceAccelerationStructureData"], SourceAccelerationStructureData, options);
@@ -7241,9 +7241,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_SetPipelineState1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "SetPipelineState1");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "SetPipelineState1");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pStateObject"], pStateObject, options);
     }
@@ -7257,9 +7257,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_DispatchRays(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "DispatchRays");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "DispatchRays");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
     }
@@ -7277,10 +7277,10 @@ void Dx12JsonConsumer::Process_ID3D12ShaderCacheSession_FindValue(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12ShaderCacheSession", object_id, "FindValue");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12ShaderCacheSession", object_id, "FindValue");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pKey"], pKey, options);
         FieldToJson(args["KeySize"], KeySize, options);
@@ -7301,10 +7301,10 @@ void Dx12JsonConsumer::Process_ID3D12ShaderCacheSession_StoreValue(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12ShaderCacheSession", object_id, "StoreValue");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12ShaderCacheSession", object_id, "StoreValue");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pKey"], pKey, options);
         FieldToJson(args["KeySize"], KeySize, options);
@@ -7320,7 +7320,7 @@ void Dx12JsonConsumer::Process_ID3D12ShaderCacheSession_SetDeleteOnDestroy(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12ShaderCacheSession", object_id, "SetDeleteOnDestroy");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12ShaderCacheSession", object_id, "SetDeleteOnDestroy");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -7332,7 +7332,7 @@ void Dx12JsonConsumer::Process_ID3D12ShaderCacheSession_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12ShaderCacheSession", object_id, "GetDesc");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12ShaderCacheSession", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -7348,10 +7348,10 @@ void Dx12JsonConsumer::Process_ID3D12Device9_CreateShaderCacheSession(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device9", object_id, "CreateShaderCacheSession");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device9", object_id, "CreateShaderCacheSession");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
         FieldToJson(args["riid"], riid, options);
@@ -7369,10 +7369,10 @@ void Dx12JsonConsumer::Process_ID3D12Device9_ShaderCacheControl(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device9", object_id, "ShaderCacheControl");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device9", object_id, "ShaderCacheControl");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson_D3D12_SHADER_CACHE_KIND_FLAGS(args["Kinds"], Kinds, options);
         FieldToJson_D3D12_SHADER_CACHE_CONTROL_FLAGS(args["Control"], Control, options);
@@ -7391,10 +7391,10 @@ void Dx12JsonConsumer::Process_ID3D12Device9_CreateCommandQueue1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device9", object_id, "CreateCommandQueue1");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device9", object_id, "CreateCommandQueue1");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
         FieldToJson(args["CreatorID"], CreatorID, options);
@@ -7421,10 +7421,10 @@ void Dx12JsonConsumer::Process_ID3D12Device10_CreateCommittedResource3(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device10", object_id, "CreateCommittedResource3");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device10", object_id, "CreateCommittedResource3");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pHeapProperties"], pHeapProperties, options);
         FieldToJson_D3D12_HEAP_FLAGS(args["HeapFlags"], HeapFlags, options);
@@ -7456,10 +7456,10 @@ void Dx12JsonConsumer::Process_ID3D12Device10_CreatePlacedResource2(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device10", object_id, "CreatePlacedResource2");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device10", object_id, "CreatePlacedResource2");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pHeap"], pHeap, options);
         FieldToJson(args["HeapOffset"], HeapOffset, options);
@@ -7489,10 +7489,10 @@ void Dx12JsonConsumer::Process_ID3D12Device10_CreateReservedResource2(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device10", object_id, "CreateReservedResource2");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device10", object_id, "CreateReservedResource2");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
         FieldToJson(args["InitialLayout"], InitialLayout, options);
@@ -7514,9 +7514,9 @@ void Dx12JsonConsumer::Process_ID3D12Device11_CreateSampler2(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device11", object_id, "CreateSampler2");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device11", object_id, "CreateSampler2");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
         FieldToJson(args["DestDescriptor"], DestDescriptor, options);
@@ -7537,10 +7537,10 @@ void Dx12JsonConsumer::Process_ID3D12Device12_GetResourceAllocationInfo3(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device12", object_id, "GetResourceAllocationInfo3");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Device12", object_id, "GetResourceAllocationInfo3");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJsonAsFixedWidthBinary(args["visibleMask"], visibleMask, options);
         FieldToJson(args["numResourceDescs"], numResourceDescs, options);
@@ -7561,10 +7561,10 @@ void Dx12JsonConsumer::Process_ID3D12VirtualizationGuestDevice_ShareWithHost(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12VirtualizationGuestDevice", object_id, "ShareWithHost");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12VirtualizationGuestDevice", object_id, "ShareWithHost");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pObject"], pObject, options);
         FieldToJson(args["pHandle"], pHandle, options);
@@ -7582,10 +7582,10 @@ void Dx12JsonConsumer::Process_ID3D12VirtualizationGuestDevice_CreateFenceFd(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12VirtualizationGuestDevice", object_id, "CreateFenceFd");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12VirtualizationGuestDevice", object_id, "CreateFenceFd");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pFence"], pFence, options);
         FieldToJson(args["FenceValue"], FenceValue, options);
@@ -7601,9 +7601,9 @@ void Dx12JsonConsumer::Process_ID3D12Tools_EnableShaderInstrumentation(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Tools", object_id, "EnableShaderInstrumentation");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Tools", object_id, "EnableShaderInstrumentation");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         Bool32ToJson(args["bEnable"], bEnable, options);
     }
@@ -7617,7 +7617,7 @@ void Dx12JsonConsumer::Process_ID3D12Tools_ShaderInstrumentationEnabled(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Tools", object_id, "ShaderInstrumentationEnabled");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Tools", object_id, "ShaderInstrumentationEnabled");
     const JsonOptions& options = writer_->GetOptions();
     Bool32ToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -7632,10 +7632,10 @@ void Dx12JsonConsumer::Process_ID3D12SDKConfiguration_SetSDKVersion(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SDKConfiguration", object_id, "SetSDKVersion");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12SDKConfiguration", object_id, "SetSDKVersion");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["SDKVersion"], SDKVersion, options);
         FieldToJson(args["SDKPath"], SDKPath, options);
@@ -7654,10 +7654,10 @@ void Dx12JsonConsumer::Process_ID3D12SDKConfiguration1_CreateDeviceFactory(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SDKConfiguration1", object_id, "CreateDeviceFactory");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12SDKConfiguration1", object_id, "CreateDeviceFactory");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["SDKVersion"], SDKVersion, options);
         FieldToJson(args["SDKPath"], SDKPath, options);
@@ -7673,7 +7673,7 @@ void Dx12JsonConsumer::Process_ID3D12SDKConfiguration1_FreeUnusedSDKs(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SDKConfiguration1", object_id, "FreeUnusedSDKs");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12SDKConfiguration1", object_id, "FreeUnusedSDKs");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -7685,7 +7685,7 @@ void Dx12JsonConsumer::Process_ID3D12DeviceFactory_InitializeFromGlobalState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "InitializeFromGlobalState");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "InitializeFromGlobalState");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -7698,7 +7698,7 @@ void Dx12JsonConsumer::Process_ID3D12DeviceFactory_ApplyToGlobalState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "ApplyToGlobalState");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "ApplyToGlobalState");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -7712,10 +7712,10 @@ void Dx12JsonConsumer::Process_ID3D12DeviceFactory_SetFlags(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "SetFlags");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "SetFlags");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson_D3D12_DEVICE_FACTORY_FLAGS(args["flags"], flags, options);
     }
@@ -7729,7 +7729,7 @@ void Dx12JsonConsumer::Process_ID3D12DeviceFactory_GetFlags(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "GetFlags");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "GetFlags");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson_D3D12_DEVICE_FACTORY_FLAGS(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -7745,10 +7745,10 @@ void Dx12JsonConsumer::Process_ID3D12DeviceFactory_GetConfigurationInterface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "GetConfigurationInterface");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "GetConfigurationInterface");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["clsid"], clsid, options);
         FieldToJson(args["iid"], iid, options);
@@ -7768,10 +7768,10 @@ void Dx12JsonConsumer::Process_ID3D12DeviceFactory_EnableExperimentalFeatures(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "EnableExperimentalFeatures");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "EnableExperimentalFeatures");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["NumFeatures"], NumFeatures, options);
         FieldToJson(args["pIIDs"], pIIDs, options);
@@ -7792,10 +7792,10 @@ void Dx12JsonConsumer::Process_ID3D12DeviceFactory_CreateDevice(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "CreateDevice");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "CreateDevice");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["adapter"], adapter, options);
         FieldToJson(args["FeatureLevel"], FeatureLevel, options);
@@ -7812,7 +7812,7 @@ void Dx12JsonConsumer::Process_ID3D12DeviceConfiguration_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceConfiguration", object_id, "GetDesc");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceConfiguration", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -7827,10 +7827,10 @@ void Dx12JsonConsumer::Process_ID3D12DeviceConfiguration_GetEnabledExperimentalF
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceConfiguration", object_id, "GetEnabledExperimentalFeatures");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceConfiguration", object_id, "GetEnabledExperimentalFeatures");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pGuids"], pGuids, options);
         FieldToJson(args["NumGuids"], NumGuids, options);
@@ -7848,10 +7848,10 @@ void Dx12JsonConsumer::Process_ID3D12DeviceConfiguration_SerializeVersionedRootS
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceConfiguration", object_id, "SerializeVersionedRootSignature");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceConfiguration", object_id, "SerializeVersionedRootSignature");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pDesc"], pDesc, options);
         FieldToJson(args["ppResult"], ppResult, options);
@@ -7871,10 +7871,10 @@ void Dx12JsonConsumer::Process_ID3D12DeviceConfiguration_CreateVersionedRootSign
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceConfiguration", object_id, "CreateVersionedRootSignatureDeserializer");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceConfiguration", object_id, "CreateVersionedRootSignatureDeserializer");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pBlob"], pBlob, options);
         FieldToJson(args["Size"], Size, options);
@@ -7892,9 +7892,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList5_RSSetShadingRate(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList5", object_id, "RSSetShadingRate");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList5", object_id, "RSSetShadingRate");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["baseShadingRate"], baseShadingRate, options);
         FieldToJson(args["combiners"], combiners, options);
@@ -7909,9 +7909,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList5_RSSetShadingRateImage(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList5", object_id, "RSSetShadingRateImage");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList5", object_id, "RSSetShadingRateImage");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["shadingRateImage"], shadingRateImage, options);
     }
@@ -7927,9 +7927,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList6_DispatchMesh(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList6", object_id, "DispatchMesh");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList6", object_id, "DispatchMesh");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["ThreadGroupCountX"], ThreadGroupCountX, options);
         FieldToJson(args["ThreadGroupCountY"], ThreadGroupCountY, options);
@@ -7946,9 +7946,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList7_Barrier(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList7", object_id, "Barrier");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList7", object_id, "Barrier");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["NumBarrierGroups"], NumBarrierGroups, options);
         FieldToJson(args["pBarrierGroups"], pBarrierGroups, options);
@@ -7964,9 +7964,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList8_OMSetFrontAndBackStenc
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList8", object_id, "OMSetFrontAndBackStencilRef");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList8", object_id, "OMSetFrontAndBackStencilRef");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["FrontStencilRef"], FrontStencilRef, options);
         FieldToJson(args["BackStencilRef"], BackStencilRef, options);
@@ -7983,9 +7983,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList9_RSSetDepthBias(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList9", object_id, "RSSetDepthBias");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList9", object_id, "RSSetDepthBias");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["DepthBias"], DepthBias, options);
         FieldToJson(args["DepthBiasClamp"], DepthBiasClamp, options);
@@ -8001,9 +8001,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList9_IASetIndexBufferStripC
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList9", object_id, "IASetIndexBufferStripCutValue");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList9", object_id, "IASetIndexBufferStripCutValue");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["IBStripCutValue"], IBStripCutValue, options);
     }
@@ -8021,10 +8021,10 @@ void Dx12JsonConsumer::Process_ID3D12DSRDeviceFactory_CreateDSRDevice(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DSRDeviceFactory", object_id, "CreateDSRDevice");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DSRDeviceFactory", object_id, "CreateDSRDevice");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pD3D12Device"], pD3D12Device, options);
         FieldToJsonAsFixedWidthBinary(args["NodeMask"], NodeMask, options);
@@ -8045,7 +8045,7 @@ void Dx12JsonConsumer::Process_ID3D10Blob_GetBufferPointer(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D10Blob", object_id, "GetBufferPointer");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D10Blob", object_id, "GetBufferPointer");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -8058,7 +8058,7 @@ void Dx12JsonConsumer::Process_ID3D10Blob_GetBufferSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D10Blob", object_id, "GetBufferSize");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D10Blob", object_id, "GetBufferSize");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -8074,10 +8074,10 @@ void Dx12JsonConsumer::Process_ID3DDestructionNotifier_RegisterDestructionCallba
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3DDestructionNotifier", object_id, "RegisterDestructionCallback");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3DDestructionNotifier", object_id, "RegisterDestructionCallback");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["callbackFn"], callbackFn, options);
         FieldToJson(args["pData"], pData, options);
@@ -8094,10 +8094,10 @@ void Dx12JsonConsumer::Process_ID3DDestructionNotifier_UnregisterDestructionCall
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3DDestructionNotifier", object_id, "UnregisterDestructionCallback");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3DDestructionNotifier", object_id, "UnregisterDestructionCallback");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["callbackID"], callbackID, options);
     }
@@ -8114,7 +8114,7 @@ void Dx12JsonConsumer::Process_ID3D12Debug_EnableDebugLayer(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug", object_id, "EnableDebugLayer");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug", object_id, "EnableDebugLayer");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -8125,7 +8125,7 @@ void Dx12JsonConsumer::Process_ID3D12Debug1_EnableDebugLayer(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug1", object_id, "EnableDebugLayer");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug1", object_id, "EnableDebugLayer");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -8137,9 +8137,9 @@ void Dx12JsonConsumer::Process_ID3D12Debug1_SetEnableGPUBasedValidation(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug1", object_id, "SetEnableGPUBasedValidation");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug1", object_id, "SetEnableGPUBasedValidation");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         Bool32ToJson(args["Enable"], Enable, options);
     }
@@ -8153,9 +8153,9 @@ void Dx12JsonConsumer::Process_ID3D12Debug1_SetEnableSynchronizedCommandQueueVal
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug1", object_id, "SetEnableSynchronizedCommandQueueValidation");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug1", object_id, "SetEnableSynchronizedCommandQueueValidation");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         Bool32ToJson(args["Enable"], Enable, options);
     }
@@ -8169,9 +8169,9 @@ void Dx12JsonConsumer::Process_ID3D12Debug2_SetGPUBasedValidationFlags(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug2", object_id, "SetGPUBasedValidationFlags");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug2", object_id, "SetGPUBasedValidationFlags");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson_D3D12_GPU_BASED_VALIDATION_FLAGS(args["Flags"], Flags, options);
     }
@@ -8185,9 +8185,9 @@ void Dx12JsonConsumer::Process_ID3D12Debug3_SetEnableGPUBasedValidation(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug3", object_id, "SetEnableGPUBasedValidation");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug3", object_id, "SetEnableGPUBasedValidation");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         Bool32ToJson(args["Enable"], Enable, options);
     }
@@ -8201,9 +8201,9 @@ void Dx12JsonConsumer::Process_ID3D12Debug3_SetEnableSynchronizedCommandQueueVal
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug3", object_id, "SetEnableSynchronizedCommandQueueValidation");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug3", object_id, "SetEnableSynchronizedCommandQueueValidation");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         Bool32ToJson(args["Enable"], Enable, options);
     }
@@ -8217,9 +8217,9 @@ void Dx12JsonConsumer::Process_ID3D12Debug3_SetGPUBasedValidationFlags(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug3", object_id, "SetGPUBasedValidationFlags");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug3", object_id, "SetGPUBasedValidationFlags");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson_D3D12_GPU_BASED_VALIDATION_FLAGS(args["Flags"], Flags, options);
     }
@@ -8232,7 +8232,7 @@ void Dx12JsonConsumer::Process_ID3D12Debug4_DisableDebugLayer(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug4", object_id, "DisableDebugLayer");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug4", object_id, "DisableDebugLayer");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -8244,9 +8244,9 @@ void Dx12JsonConsumer::Process_ID3D12Debug5_SetEnableAutoName(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug5", object_id, "SetEnableAutoName");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug5", object_id, "SetEnableAutoName");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         Bool32ToJson(args["Enable"], Enable, options);
     }
@@ -8260,9 +8260,9 @@ void Dx12JsonConsumer::Process_ID3D12Debug6_SetForceLegacyBarrierValidation(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug6", object_id, "SetForceLegacyBarrierValidation");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug6", object_id, "SetForceLegacyBarrierValidation");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         Bool32ToJson(args["Enable"], Enable, options);
     }
@@ -8279,10 +8279,10 @@ void Dx12JsonConsumer::Process_ID3D12DebugDevice1_SetDebugParameter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice1", object_id, "SetDebugParameter");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice1", object_id, "SetDebugParameter");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Type"], Type, options);
         FieldToJson(args["pData"], pData, options);
@@ -8301,10 +8301,10 @@ void Dx12JsonConsumer::Process_ID3D12DebugDevice1_GetDebugParameter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice1", object_id, "GetDebugParameter");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice1", object_id, "GetDebugParameter");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Type"], Type, options);
         FieldToJson(args["pData"], pData, options);
@@ -8321,10 +8321,10 @@ void Dx12JsonConsumer::Process_ID3D12DebugDevice1_ReportLiveDeviceObjects(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice1", object_id, "ReportLiveDeviceObjects");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice1", object_id, "ReportLiveDeviceObjects");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson_D3D12_RLDO_FLAGS(args["Flags"], Flags, options);
     }
@@ -8339,10 +8339,10 @@ void Dx12JsonConsumer::Process_ID3D12DebugDevice_SetFeatureMask(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice", object_id, "SetFeatureMask");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice", object_id, "SetFeatureMask");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Mask"], Mask, options);
     }
@@ -8356,7 +8356,7 @@ void Dx12JsonConsumer::Process_ID3D12DebugDevice_GetFeatureMask(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice", object_id, "GetFeatureMask");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice", object_id, "GetFeatureMask");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -8370,10 +8370,10 @@ void Dx12JsonConsumer::Process_ID3D12DebugDevice_ReportLiveDeviceObjects(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice", object_id, "ReportLiveDeviceObjects");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice", object_id, "ReportLiveDeviceObjects");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson_D3D12_RLDO_FLAGS(args["Flags"], Flags, options);
     }
@@ -8390,10 +8390,10 @@ void Dx12JsonConsumer::Process_ID3D12DebugDevice2_SetDebugParameter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice2", object_id, "SetDebugParameter");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice2", object_id, "SetDebugParameter");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Type"], Type, options);
         FieldToJson(args["pData"], pData, options);
@@ -8412,10 +8412,10 @@ void Dx12JsonConsumer::Process_ID3D12DebugDevice2_GetDebugParameter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice2", object_id, "GetDebugParameter");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice2", object_id, "GetDebugParameter");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Type"], Type, options);
         FieldToJson(args["pData"], pData, options);
@@ -8434,10 +8434,10 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandQueue_AssertResourceState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandQueue", object_id, "AssertResourceState");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandQueue", object_id, "AssertResourceState");
     const JsonOptions& options = writer_->GetOptions();
     Bool32ToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pResource"], pResource, options);
         FieldToJson(args["Subresource"], Subresource, options);
@@ -8455,9 +8455,9 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandQueue1_AssertResourceAccess(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandQueue1", object_id, "AssertResourceAccess");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandQueue1", object_id, "AssertResourceAccess");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pResource"], pResource, options);
         FieldToJson(args["Subresource"], Subresource, options);
@@ -8475,9 +8475,9 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandQueue1_AssertTextureLayout(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandQueue1", object_id, "AssertTextureLayout");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandQueue1", object_id, "AssertTextureLayout");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pResource"], pResource, options);
         FieldToJson(args["Subresource"], Subresource, options);
@@ -8496,10 +8496,10 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandList1_AssertResourceState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList1", object_id, "AssertResourceState");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList1", object_id, "AssertResourceState");
     const JsonOptions& options = writer_->GetOptions();
     Bool32ToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pResource"], pResource, options);
         FieldToJson(args["Subresource"], Subresource, options);
@@ -8518,10 +8518,10 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandList1_SetDebugParameter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList1", object_id, "SetDebugParameter");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList1", object_id, "SetDebugParameter");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Type"], Type, options);
         FieldToJson(args["pData"], pData, options);
@@ -8540,10 +8540,10 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandList1_GetDebugParameter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList1", object_id, "GetDebugParameter");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList1", object_id, "GetDebugParameter");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Type"], Type, options);
         FieldToJson(args["pData"], pData, options);
@@ -8562,10 +8562,10 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandList_AssertResourceState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList", object_id, "AssertResourceState");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList", object_id, "AssertResourceState");
     const JsonOptions& options = writer_->GetOptions();
     Bool32ToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pResource"], pResource, options);
         FieldToJson(args["Subresource"], Subresource, options);
@@ -8582,10 +8582,10 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandList_SetFeatureMask(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList", object_id, "SetFeatureMask");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList", object_id, "SetFeatureMask");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Mask"], Mask, options);
     }
@@ -8599,7 +8599,7 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandList_GetFeatureMask(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList", object_id, "GetFeatureMask");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList", object_id, "GetFeatureMask");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -8615,10 +8615,10 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandList2_SetDebugParameter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList2", object_id, "SetDebugParameter");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList2", object_id, "SetDebugParameter");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Type"], Type, options);
         FieldToJson(args["pData"], pData, options);
@@ -8637,10 +8637,10 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandList2_GetDebugParameter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList2", object_id, "GetDebugParameter");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList2", object_id, "GetDebugParameter");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Type"], Type, options);
         FieldToJson(args["pData"], pData, options);
@@ -8658,9 +8658,9 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandList3_AssertResourceAccess(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList3", object_id, "AssertResourceAccess");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList3", object_id, "AssertResourceAccess");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pResource"], pResource, options);
         FieldToJson(args["Subresource"], Subresource, options);
@@ -8678,9 +8678,9 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandList3_AssertTextureLayout(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList3", object_id, "AssertTextureLayout");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList3", object_id, "AssertTextureLayout");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pResource"], pResource, options);
         FieldToJson(args["Subresource"], Subresource, options);
@@ -8698,9 +8698,9 @@ void Dx12JsonConsumer::Process_ID3D12SharingContract_Present(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SharingContract", object_id, "Present");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12SharingContract", object_id, "Present");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pResource"], pResource, options);
         FieldToJson(args["Subresource"], Subresource, options);
@@ -8717,9 +8717,9 @@ void Dx12JsonConsumer::Process_ID3D12SharingContract_SharedFenceSignal(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SharingContract", object_id, "SharedFenceSignal");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12SharingContract", object_id, "SharedFenceSignal");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pFence"], pFence, options);
         FieldToJson(args["FenceValue"], FenceValue, options);
@@ -8734,9 +8734,9 @@ void Dx12JsonConsumer::Process_ID3D12SharingContract_BeginCapturableWork(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SharingContract", object_id, "BeginCapturableWork");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12SharingContract", object_id, "BeginCapturableWork");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["guid"], guid, options);
     }
@@ -8750,9 +8750,9 @@ void Dx12JsonConsumer::Process_ID3D12SharingContract_EndCapturableWork(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SharingContract", object_id, "EndCapturableWork");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12SharingContract", object_id, "EndCapturableWork");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["guid"], guid, options);
     }
@@ -8767,9 +8767,9 @@ void Dx12JsonConsumer::Process_ID3D12ManualWriteTrackingResource_TrackWrite(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12ManualWriteTrackingResource", object_id, "TrackWrite");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12ManualWriteTrackingResource", object_id, "TrackWrite");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Subresource"], Subresource, options);
         FieldToJson(args["pWrittenRange"], pWrittenRange, options);
@@ -8785,10 +8785,10 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_SetMessageCountLimit(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "SetMessageCountLimit");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "SetMessageCountLimit");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["MessageCountLimit"], MessageCountLimit, options);
     }
@@ -8801,7 +8801,7 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_ClearStoredMessages(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "ClearStoredMessages");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "ClearStoredMessages");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -8816,10 +8816,10 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetMessage(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetMessage");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetMessage");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["MessageIndex"], MessageIndex, options);
         FieldToJson(args["pMessage"], pMessage, options);
@@ -8835,7 +8835,7 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetNumMessagesAllowedByStorageFil
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetNumMessagesAllowedByStorageFilter");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetNumMessagesAllowedByStorageFilter");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -8848,7 +8848,7 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetNumMessagesDeniedByStorageFilt
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetNumMessagesDeniedByStorageFilter");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetNumMessagesDeniedByStorageFilter");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -8861,7 +8861,7 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetNumStoredMessages(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetNumStoredMessages");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetNumStoredMessages");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -8874,7 +8874,7 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetNumStoredMessagesAllowedByRetr
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetNumStoredMessagesAllowedByRetrievalFilter");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetNumStoredMessagesAllowedByRetrievalFilter");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -8887,7 +8887,7 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetNumMessagesDiscardedByMessageC
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetNumMessagesDiscardedByMessageCountLimit");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetNumMessagesDiscardedByMessageCountLimit");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -8900,7 +8900,7 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetMessageCountLimit(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetMessageCountLimit");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetMessageCountLimit");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -8914,10 +8914,10 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_AddStorageFilterEntries(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "AddStorageFilterEntries");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "AddStorageFilterEntries");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pFilter"], pFilter, options);
     }
@@ -8933,10 +8933,10 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetStorageFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetStorageFilter");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetStorageFilter");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pFilter"], pFilter, options);
         FieldToJson(args["pFilterByteLength"], pFilterByteLength, options);
@@ -8950,7 +8950,7 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_ClearStorageFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "ClearStorageFilter");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "ClearStorageFilter");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -8962,7 +8962,7 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_PushEmptyStorageFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushEmptyStorageFilter");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushEmptyStorageFilter");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -8975,7 +8975,7 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_PushCopyOfStorageFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushCopyOfStorageFilter");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushCopyOfStorageFilter");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -8989,10 +8989,10 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_PushStorageFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushStorageFilter");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushStorageFilter");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pFilter"], pFilter, options);
     }
@@ -9005,7 +9005,7 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_PopStorageFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PopStorageFilter");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PopStorageFilter");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -9017,7 +9017,7 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetStorageFilterStackSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetStorageFilterStackSize");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetStorageFilterStackSize");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -9031,10 +9031,10 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_AddRetrievalFilterEntries(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "AddRetrievalFilterEntries");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "AddRetrievalFilterEntries");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pFilter"], pFilter, options);
     }
@@ -9050,10 +9050,10 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetRetrievalFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetRetrievalFilter");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetRetrievalFilter");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pFilter"], pFilter, options);
         FieldToJson(args["pFilterByteLength"], pFilterByteLength, options);
@@ -9067,7 +9067,7 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_ClearRetrievalFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "ClearRetrievalFilter");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "ClearRetrievalFilter");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -9079,7 +9079,7 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_PushEmptyRetrievalFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushEmptyRetrievalFilter");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushEmptyRetrievalFilter");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -9092,7 +9092,7 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_PushCopyOfRetrievalFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushCopyOfRetrievalFilter");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushCopyOfRetrievalFilter");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -9106,10 +9106,10 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_PushRetrievalFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushRetrievalFilter");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushRetrievalFilter");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["pFilter"], pFilter, options);
     }
@@ -9122,7 +9122,7 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_PopRetrievalFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PopRetrievalFilter");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PopRetrievalFilter");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -9134,7 +9134,7 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetRetrievalFilterStackSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetRetrievalFilterStackSize");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetRetrievalFilterStackSize");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -9151,10 +9151,10 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_AddMessage(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "AddMessage");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "AddMessage");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Category"], Category, options);
         FieldToJson(args["Severity"], Severity, options);
@@ -9173,10 +9173,10 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_AddApplicationMessage(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "AddApplicationMessage");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "AddApplicationMessage");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Severity"], Severity, options);
         FieldToJson(args["pDescription"], pDescription, options);
@@ -9193,10 +9193,10 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_SetBreakOnCategory(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "SetBreakOnCategory");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "SetBreakOnCategory");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Category"], Category, options);
         Bool32ToJson(args["bEnable"], bEnable, options);
@@ -9213,10 +9213,10 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_SetBreakOnSeverity(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "SetBreakOnSeverity");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "SetBreakOnSeverity");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Severity"], Severity, options);
         Bool32ToJson(args["bEnable"], bEnable, options);
@@ -9233,10 +9233,10 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_SetBreakOnID(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "SetBreakOnID");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "SetBreakOnID");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["ID"], ID, options);
         Bool32ToJson(args["bEnable"], bEnable, options);
@@ -9252,10 +9252,10 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetBreakOnCategory(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetBreakOnCategory");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetBreakOnCategory");
     const JsonOptions& options = writer_->GetOptions();
     Bool32ToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Category"], Category, options);
     }
@@ -9270,10 +9270,10 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetBreakOnSeverity(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetBreakOnSeverity");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetBreakOnSeverity");
     const JsonOptions& options = writer_->GetOptions();
     Bool32ToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["Severity"], Severity, options);
     }
@@ -9288,10 +9288,10 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetBreakOnID(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetBreakOnID");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetBreakOnID");
     const JsonOptions& options = writer_->GetOptions();
     Bool32ToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["ID"], ID, options);
     }
@@ -9305,9 +9305,9 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_SetMuteDebugOutput(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "SetMuteDebugOutput");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "SetMuteDebugOutput");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         Bool32ToJson(args["bMute"], bMute, options);
     }
@@ -9321,7 +9321,7 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetMuteDebugOutput(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetMuteDebugOutput");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetMuteDebugOutput");
     const JsonOptions& options = writer_->GetOptions();
     Bool32ToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -9338,10 +9338,10 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue1_RegisterMessageCallback(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue1", object_id, "RegisterMessageCallback");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue1", object_id, "RegisterMessageCallback");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["CallbackFunc"], CallbackFunc, options);
         FieldToJson_D3D12_MESSAGE_CALLBACK_FLAGS(args["CallbackFilterFlags"], CallbackFilterFlags, options);
@@ -9359,10 +9359,10 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue1_UnregisterMessageCallback(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue1", object_id, "UnregisterMessageCallback");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue1", object_id, "UnregisterMessageCallback");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["CallbackCookie"], CallbackCookie, options);
     }
@@ -9382,10 +9382,10 @@ void Dx12JsonConsumer::Process_IUnknown_QueryInterface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IUnknown", object_id, "QueryInterface");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IUnknown", object_id, "QueryInterface");
     const JsonOptions& options = writer_->GetOptions();
     HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    JsonValue& args = method[format::kNameArgs];
     {
         FieldToJson(args["riid"], riid, options);
         FieldToJson(args["ppvObject"], ppvObject, options);
@@ -9400,7 +9400,7 @@ void Dx12JsonConsumer::Process_IUnknown_AddRef(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IUnknown", object_id, "AddRef");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IUnknown", object_id, "AddRef");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -9413,7 +9413,7 @@ void Dx12JsonConsumer::Process_IUnknown_Release(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IUnknown", object_id, "Release");
+    JsonValue& method = writer_->WriteApiCallStart(call_info, "IUnknown", object_id, "Release");
     const JsonOptions& options = writer_->GetOptions();
     FieldToJson(method[format::kNameReturn], return_value, options);
     writer_->WriteBlockEnd();
@@ -39,19 +39,20 @@ GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
 using util::JsonOptions;
+using util::JsonValue;
 
 // TODO Move all these manual functions out of the generator and into a .cpp file.
 
 /// @defgroup ManualD3D12StructFieldToJsons Manual functions to convert raw structs.
 /** @{ */
-static void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RENDER_PASS_BEGINNING_ACCESS_PRESERVE_LOCAL_PARAMETERS& data, const JsonOptions& options)
+static void FieldToJson(JsonValue& jdata, const D3D12_RENDER_PASS_BEGINNING_ACCESS_PRESERVE_LOCAL_PARAMETERS& data, const JsonOptions& options)
 {
     using namespace util;
     FieldToJson(jdata["AdditionalWidth"],  data.AdditionalWidth,  options);
     FieldToJson(jdata["AdditionalHeight"], data.AdditionalHeight, options);
 }
 
-static void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RENDER_PASS_ENDING_ACCESS_PRESERVE_LOCAL_PARAMETERS& data, const JsonOptions& options)
+static void FieldToJson(JsonValue& jdata, const D3D12_RENDER_PASS_ENDING_ACCESS_PRESERVE_LOCAL_PARAMETERS& data, const JsonOptions& options)
 {
     using namespace util;
     FieldToJson(jdata["AdditionalWidth"], data.AdditionalWidth, options);
@@ -59,19 +60,19 @@ static void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RENDER_PASS_E
 }
 
 /// Manual raw struct functon to be used for Decoded_D3D12_CLEAR_VALUE conversion.
-void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DEPTH_STENCIL_VALUE& obj, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const D3D12_DEPTH_STENCIL_VALUE& obj, const JsonOptions& options)
 {
     FieldToJson(jdata["Depth"], obj.Depth, options);
     FieldToJson(jdata["Stencil"], obj.Stencil, options);
 }
 /** @} */
 
-inline bool RepresentBinaryFile(const util::JsonOptions& json_options, nlohmann::ordered_json& jdata, std::string_view filename_base, const uint64_t instance_counter, const PointerDecoder<uint8_t>& data)
+inline bool RepresentBinaryFile(const util::JsonOptions& json_options, JsonValue& jdata, std::string_view filename_base, const uint64_t instance_counter, const PointerDecoder<uint8_t>& data)
 {
     return RepresentBinaryFile(json_options, jdata, filename_base, instance_counter, data.GetLength(), data.GetPointer());
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_FRAME_STATISTICS* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_FRAME_STATISTICS* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -86,7 +87,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_FRAME_STATIST
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_MAPPED_RECT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_MAPPED_RECT* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -98,7 +99,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_MAPPED_RECT*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_LUID* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_LUID* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -110,7 +111,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_LUID* data, const
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_ADAPTER_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_ADAPTER_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -129,7 +130,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_ADAPTER_DESC*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_OUTPUT_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_OUTPUT_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -144,7 +145,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_OUTPUT_DESC*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_SHARED_RESOURCE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_SHARED_RESOURCE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -155,7 +156,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_SHARED_RESOUR
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_SURFACE_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_SURFACE_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -169,7 +170,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_SURFACE_DESC*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_SWAP_CHAIN_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_SWAP_CHAIN_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -187,7 +188,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_SWAP_CHAIN_DE
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_ADAPTER_DESC1* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_ADAPTER_DESC1* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -207,7 +208,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_ADAPTER_DESC1
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_DISPLAY_COLOR_SPACE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_DISPLAY_COLOR_SPACE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -219,7 +220,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_DISPLAY_COLOR
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_OUTDUPL_MOVE_RECT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_OUTDUPL_MOVE_RECT* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -231,7 +232,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_OUTDUPL_MOVE_
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_OUTDUPL_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_OUTDUPL_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -244,7 +245,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_OUTDUPL_DESC*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_OUTDUPL_POINTER_POSITION* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_OUTDUPL_POINTER_POSITION* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -256,7 +257,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_OUTDUPL_POINT
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_OUTDUPL_POINTER_SHAPE_INFO* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_OUTDUPL_POINTER_SHAPE_INFO* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -271,7 +272,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_OUTDUPL_POINT
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_OUTDUPL_FRAME_INFO* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_OUTDUPL_FRAME_INFO* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -289,7 +290,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_OUTDUPL_FRAME
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_MODE_DESC1* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_MODE_DESC1* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -306,7 +307,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_MODE_DESC1* d
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_SWAP_CHAIN_DESC1* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_SWAP_CHAIN_DESC1* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -327,7 +328,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_SWAP_CHAIN_DE
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_SWAP_CHAIN_FULLSCREEN_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_SWAP_CHAIN_FULLSCREEN_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -341,7 +342,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_SWAP_CHAIN_FU
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_PRESENT_PARAMETERS* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_PRESENT_PARAMETERS* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -355,7 +356,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_PRESENT_PARAM
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_ADAPTER_DESC2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_ADAPTER_DESC2* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -377,7 +378,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_ADAPTER_DESC2
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_MATRIX_3X2_F* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_MATRIX_3X2_F* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -393,7 +394,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_MATRIX_3X2_F*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_DECODE_SWAP_CHAIN_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_DECODE_SWAP_CHAIN_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -404,7 +405,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_DECODE_SWAP_C
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_FRAME_STATISTICS_MEDIA* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_FRAME_STATISTICS_MEDIA* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -421,7 +422,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_FRAME_STATIST
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_QUERY_VIDEO_MEMORY_INFO* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_QUERY_VIDEO_MEMORY_INFO* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -435,7 +436,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_QUERY_VIDEO_M
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_HDR_METADATA_HDR10* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_HDR_METADATA_HDR10* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -453,7 +454,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_HDR_METADATA_
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_HDR_METADATA_HDR10PLUS* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_HDR_METADATA_HDR10PLUS* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -464,7 +465,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_HDR_METADATA_
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_ADAPTER_DESC3* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_ADAPTER_DESC3* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -486,7 +487,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_ADAPTER_DESC3
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_OUTPUT_DESC1* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_OUTPUT_DESC1* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -510,7 +511,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_OUTPUT_DESC1*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_RATIONAL* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_RATIONAL* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -522,7 +523,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_RATIONAL* dat
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_SAMPLE_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_SAMPLE_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -534,7 +535,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_SAMPLE_DESC*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_RGB* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_RGB* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -547,7 +548,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_RGB* data, co
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3DCOLORVALUE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3DCOLORVALUE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -561,7 +562,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3DCOLORVALUE* dat
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_GAMMA_CONTROL* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_GAMMA_CONTROL* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -574,7 +575,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_GAMMA_CONTROL
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_GAMMA_CONTROL_CAPABILITIES* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_GAMMA_CONTROL_CAPABILITIES* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -589,7 +590,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_GAMMA_CONTROL
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_MODE_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_MODE_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -605,7 +606,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_MODE_DESC* da
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_JPEG_DC_HUFFMAN_TABLE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_JPEG_DC_HUFFMAN_TABLE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -617,7 +618,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_JPEG_DC_HUFFM
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_JPEG_AC_HUFFMAN_TABLE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_JPEG_AC_HUFFMAN_TABLE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -629,7 +630,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_JPEG_AC_HUFFM
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_JPEG_QUANTIZATION_TABLE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_DXGI_JPEG_QUANTIZATION_TABLE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -640,7 +641,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_DXGI_JPEG_QUANTIZA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_COMMAND_QUEUE_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_COMMAND_QUEUE_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -654,7 +655,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_COMMAND_QUEU
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_INPUT_ELEMENT_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_INPUT_ELEMENT_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -671,7 +672,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_INPUT_ELEMEN
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SO_DECLARATION_ENTRY* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_SO_DECLARATION_ENTRY* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -687,7 +688,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SO_DECLARATI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_VIEWPORT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_VIEWPORT* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -703,7 +704,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_VIEWPORT* da
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BOX* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_BOX* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -719,7 +720,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BOX* data, c
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEPTH_STENCILOP_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DEPTH_STENCILOP_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -733,7 +734,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEPTH_STENCI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEPTH_STENCIL_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DEPTH_STENCIL_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -751,7 +752,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEPTH_STENCI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEPTH_STENCIL_DESC1* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DEPTH_STENCIL_DESC1* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -770,7 +771,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEPTH_STENCI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEPTH_STENCILOP_DESC1* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DEPTH_STENCILOP_DESC1* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -786,7 +787,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEPTH_STENCI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEPTH_STENCIL_DESC2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DEPTH_STENCIL_DESC2* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -803,7 +804,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEPTH_STENCI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_TARGET_BLEND_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RENDER_TARGET_BLEND_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -823,7 +824,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_TARGE
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BLEND_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_BLEND_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -836,7 +837,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BLEND_DESC*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RASTERIZER_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RASTERIZER_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -857,7 +858,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RASTERIZER_D
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RASTERIZER_DESC1* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RASTERIZER_DESC1* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -878,7 +879,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RASTERIZER_D
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RASTERIZER_DESC2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RASTERIZER_DESC2* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -898,7 +899,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RASTERIZER_D
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SHADER_BYTECODE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_SHADER_BYTECODE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -913,7 +914,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SHADER_BYTEC
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_STREAM_OUTPUT_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_STREAM_OUTPUT_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -928,7 +929,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_STREAM_OUTPU
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_INPUT_LAYOUT_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_INPUT_LAYOUT_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -940,7 +941,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_INPUT_LAYOUT
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_CACHED_PIPELINE_STATE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_CACHED_PIPELINE_STATE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -952,7 +953,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_CACHED_PIPEL
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_GRAPHICS_PIPELINE_STATE_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_GRAPHICS_PIPELINE_STATE_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -983,7 +984,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_GRAPHICS_PIP
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_COMPUTE_PIPELINE_STATE_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_COMPUTE_PIPELINE_STATE_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -998,7 +999,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_COMPUTE_PIPE
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RT_FORMAT_ARRAY* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RT_FORMAT_ARRAY* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1010,7 +1011,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RT_FORMAT_AR
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1035,7 +1036,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS1* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS1* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1051,7 +1052,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS2* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1063,7 +1064,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_ROOT_SIGNATURE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_ROOT_SIGNATURE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1074,7 +1075,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_ARCHITECTURE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_ARCHITECTURE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1088,7 +1089,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_ARCHITECTURE1* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_ARCHITECTURE1* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1103,7 +1104,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_FEATURE_LEVELS* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_FEATURE_LEVELS* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1116,7 +1117,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_SHADER_MODEL* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_SHADER_MODEL* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1127,7 +1128,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_FORMAT_SUPPORT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_FORMAT_SUPPORT* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1140,7 +1141,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_MULTISAMPLE_QUALITY_LEVELS* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_MULTISAMPLE_QUALITY_LEVELS* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1154,7 +1155,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_FORMAT_INFO* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_FORMAT_INFO* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1166,7 +1167,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_GPU_VIRTUAL_ADDRESS_SUPPORT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_GPU_VIRTUAL_ADDRESS_SUPPORT* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1178,7 +1179,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_SHADER_CACHE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_SHADER_CACHE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1189,7 +1190,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_COMMAND_QUEUE_PRIORITY* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_COMMAND_QUEUE_PRIORITY* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1202,7 +1203,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS3* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS3* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1217,7 +1218,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_EXISTING_HEAPS* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_EXISTING_HEAPS* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1228,7 +1229,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_DISPLAYABLE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_DISPLAYABLE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1240,7 +1241,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS4* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS4* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1253,7 +1254,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_SERIALIZATION* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_SERIALIZATION* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1265,7 +1266,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_CROSS_NODE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_CROSS_NODE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1277,7 +1278,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS5* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS5* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1290,7 +1291,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS6* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS6* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1305,7 +1306,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS7* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS7* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1317,7 +1318,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_QUERY_META_COMMAND* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_QUERY_META_COMMAND* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1333,7 +1334,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS8* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS8* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1344,7 +1345,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS9* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS9* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1360,7 +1361,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS10* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS10* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1372,7 +1373,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS11* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS11* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1383,7 +1384,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS12* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS12* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1396,7 +1397,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS13* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS13* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1412,7 +1413,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS14* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS14* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1425,7 +1426,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS15* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS15* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1437,7 +1438,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS16* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS16* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1449,7 +1450,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS17* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS17* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1461,7 +1462,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS18* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS18* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1472,7 +1473,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS19* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_D3D12_OPTIONS19* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1492,7 +1493,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_ALLOCATION_INFO* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RESOURCE_ALLOCATION_INFO* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1504,7 +1505,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_ALL
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_ALLOCATION_INFO1* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RESOURCE_ALLOCATION_INFO1* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1517,7 +1518,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_ALL
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_HEAP_PROPERTIES* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_HEAP_PROPERTIES* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1532,7 +1533,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_HEAP_PROPERT
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_HEAP_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_HEAP_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1546,7 +1547,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_HEAP_DESC* d
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_MIP_REGION* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_MIP_REGION* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1559,7 +1560,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_MIP_REGION*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RESOURCE_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1579,7 +1580,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_DES
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_DESC1* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RESOURCE_DESC1* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1600,7 +1601,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_DES
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEPTH_STENCIL_VALUE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DEPTH_STENCIL_VALUE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1612,7 +1613,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEPTH_STENCI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_CLEAR_VALUE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_CLEAR_VALUE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1631,7 +1632,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_CLEAR_VALUE*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RANGE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RANGE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1643,7 +1644,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RANGE* data,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RANGE_UINT64* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RANGE_UINT64* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1655,7 +1656,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RANGE_UINT64
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SUBRESOURCE_RANGE_UINT64* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_SUBRESOURCE_RANGE_UINT64* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1667,7 +1668,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SUBRESOURCE_
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SUBRESOURCE_INFO* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_SUBRESOURCE_INFO* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1680,7 +1681,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SUBRESOURCE_
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TILED_RESOURCE_COORDINATE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TILED_RESOURCE_COORDINATE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1694,7 +1695,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TILED_RESOUR
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TILE_REGION_SIZE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TILE_REGION_SIZE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1709,7 +1710,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TILE_REGION_
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SUBRESOURCE_TILING* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_SUBRESOURCE_TILING* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1723,7 +1724,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SUBRESOURCE_
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TILE_SHAPE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TILE_SHAPE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1736,7 +1737,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TILE_SHAPE*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_PACKED_MIP_INFO* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_PACKED_MIP_INFO* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1750,7 +1751,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_PACKED_MIP_I
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_TRANSITION_BARRIER* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RESOURCE_TRANSITION_BARRIER* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1764,7 +1765,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_TRA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_ALIASING_BARRIER* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RESOURCE_ALIASING_BARRIER* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1776,7 +1777,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_ALI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_UAV_BARRIER* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RESOURCE_UAV_BARRIER* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1787,7 +1788,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_UAV
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_BARRIER* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RESOURCE_BARRIER* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1822,7 +1823,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RESOURCE_BAR
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SUBRESOURCE_FOOTPRINT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_SUBRESOURCE_FOOTPRINT* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1837,7 +1838,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SUBRESOURCE_
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_PLACED_SUBRESOURCE_FOOTPRINT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_PLACED_SUBRESOURCE_FOOTPRINT* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1849,7 +1850,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_PLACED_SUBRE
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEXTURE_COPY_LOCATION* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TEXTURE_COPY_LOCATION* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1879,7 +1880,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEXTURE_COPY
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SAMPLE_POSITION* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_SAMPLE_POSITION* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1891,7 +1892,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SAMPLE_POSIT
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_VIEW_INSTANCE_LOCATION* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_VIEW_INSTANCE_LOCATION* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1903,7 +1904,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_VIEW_INSTANC
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_VIEW_INSTANCING_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_VIEW_INSTANCING_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1916,7 +1917,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_VIEW_INSTANC
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BUFFER_SRV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_BUFFER_SRV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1930,7 +1931,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BUFFER_SRV*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX1D_SRV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TEX1D_SRV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1943,7 +1944,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX1D_SRV* d
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX1D_ARRAY_SRV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TEX1D_ARRAY_SRV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1958,7 +1959,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX1D_ARRAY_
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_SRV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TEX2D_SRV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1972,7 +1973,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_SRV* d
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_ARRAY_SRV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TEX2D_ARRAY_SRV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -1988,7 +1989,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_ARRAY_
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX3D_SRV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TEX3D_SRV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2001,7 +2002,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX3D_SRV* d
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEXCUBE_SRV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TEXCUBE_SRV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2014,7 +2015,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEXCUBE_SRV*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEXCUBE_ARRAY_SRV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TEXCUBE_ARRAY_SRV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2029,7 +2030,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEXCUBE_ARRA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_SRV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TEX2DMS_SRV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2040,7 +2041,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_SRV*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_ARRAY_SRV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TEX2DMS_ARRAY_SRV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2052,7 +2053,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_ARRA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_SRV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_SRV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2063,7 +2064,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_A
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SHADER_RESOURCE_VIEW_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_SHADER_RESOURCE_VIEW_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2134,7 +2135,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SHADER_RESOU
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_CONSTANT_BUFFER_VIEW_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_CONSTANT_BUFFER_VIEW_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2146,7 +2147,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_CONSTANT_BUF
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SAMPLER_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_SAMPLER_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2166,7 +2167,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SAMPLER_DESC
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SAMPLER_DESC2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_SAMPLER_DESC2* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2194,7 +2195,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SAMPLER_DESC
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BUFFER_UAV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_BUFFER_UAV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2209,7 +2210,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BUFFER_UAV*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX1D_UAV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TEX1D_UAV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2220,7 +2221,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX1D_UAV* d
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX1D_ARRAY_UAV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TEX1D_ARRAY_UAV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2233,7 +2234,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX1D_ARRAY_
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_UAV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TEX2D_UAV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2245,7 +2246,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_UAV* d
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_ARRAY_UAV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TEX2D_ARRAY_UAV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2259,7 +2260,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_ARRAY_
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_UAV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TEX2DMS_UAV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2270,7 +2271,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_UAV*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_ARRAY_UAV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TEX2DMS_ARRAY_UAV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2282,7 +2283,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_ARRA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX3D_UAV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TEX3D_UAV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2295,7 +2296,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX3D_UAV* d
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_UNORDERED_ACCESS_VIEW_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_UNORDERED_ACCESS_VIEW_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2361,7 +2362,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_UNORDERED_AC
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BUFFER_RTV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_BUFFER_RTV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2373,7 +2374,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BUFFER_RTV*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX1D_RTV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TEX1D_RTV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2384,7 +2385,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX1D_RTV* d
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX1D_ARRAY_RTV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TEX1D_ARRAY_RTV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2397,7 +2398,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX1D_ARRAY_
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_RTV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TEX2D_RTV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2409,7 +2410,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_RTV* d
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_RTV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TEX2DMS_RTV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2420,7 +2421,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_RTV*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_ARRAY_RTV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TEX2D_ARRAY_RTV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2434,7 +2435,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_ARRAY_
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_ARRAY_RTV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TEX2DMS_ARRAY_RTV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2446,7 +2447,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_ARRA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX3D_RTV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TEX3D_RTV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2459,7 +2460,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX3D_RTV* d
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_TARGET_VIEW_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RENDER_TARGET_VIEW_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2525,7 +2526,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_TARGE
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX1D_DSV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TEX1D_DSV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2536,7 +2537,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX1D_DSV* d
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX1D_ARRAY_DSV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TEX1D_ARRAY_DSV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2549,7 +2550,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX1D_ARRAY_
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_DSV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TEX2D_DSV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2560,7 +2561,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_DSV* d
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_ARRAY_DSV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TEX2D_ARRAY_DSV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2573,7 +2574,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2D_ARRAY_
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_DSV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TEX2DMS_DSV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2584,7 +2585,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_DSV*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_ARRAY_DSV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TEX2DMS_ARRAY_DSV* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2596,7 +2597,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEX2DMS_ARRA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEPTH_STENCIL_VIEW_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DEPTH_STENCIL_VIEW_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2653,7 +2654,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEPTH_STENCI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DESCRIPTOR_HEAP_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DESCRIPTOR_HEAP_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2667,7 +2668,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DESCRIPTOR_H
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DESCRIPTOR_RANGE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DESCRIPTOR_RANGE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2682,7 +2683,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DESCRIPTOR_R
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_DESCRIPTOR_TABLE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_ROOT_DESCRIPTOR_TABLE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2694,7 +2695,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_DESCRIP
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_CONSTANTS* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_ROOT_CONSTANTS* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2707,7 +2708,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_CONSTAN
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_DESCRIPTOR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_ROOT_DESCRIPTOR* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2719,7 +2720,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_DESCRIP
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_PARAMETER* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_ROOT_PARAMETER* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2751,7 +2752,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_PARAMET
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_STATIC_SAMPLER_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_STATIC_SAMPLER_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2774,7 +2775,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_STATIC_SAMPL
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_STATIC_SAMPLER_DESC1* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_STATIC_SAMPLER_DESC1* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2798,7 +2799,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_STATIC_SAMPL
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_SIGNATURE_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_ROOT_SIGNATURE_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2813,7 +2814,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_SIGNATU
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DESCRIPTOR_RANGE1* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DESCRIPTOR_RANGE1* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2829,7 +2830,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DESCRIPTOR_R
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_DESCRIPTOR_TABLE1* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_ROOT_DESCRIPTOR_TABLE1* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2841,7 +2842,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_DESCRIP
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_DESCRIPTOR1* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_ROOT_DESCRIPTOR1* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2854,7 +2855,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_DESCRIP
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_PARAMETER1* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_ROOT_PARAMETER1* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2892,7 +2893,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_PARAMET
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_SIGNATURE_DESC1* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_ROOT_SIGNATURE_DESC1* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2907,7 +2908,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_SIGNATU
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_SIGNATURE_DESC2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_ROOT_SIGNATURE_DESC2* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2922,7 +2923,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_ROOT_SIGNATU
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_VERSIONED_ROOT_SIGNATURE_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_VERSIONED_ROOT_SIGNATURE_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2957,7 +2958,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_VERSIONED_RO
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_GPU_DESCRIPTOR_HANDLE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_GPU_DESCRIPTOR_HANDLE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2968,7 +2969,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_GPU_DESCRIPT
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DISCARD_REGION* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DISCARD_REGION* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2982,7 +2983,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DISCARD_REGI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_QUERY_HEAP_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_QUERY_HEAP_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -2995,7 +2996,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_QUERY_HEAP_D
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_QUERY_DATA_PIPELINE_STATISTICS* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_QUERY_DATA_PIPELINE_STATISTICS* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3016,7 +3017,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_QUERY_DATA_P
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_QUERY_DATA_PIPELINE_STATISTICS1* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_QUERY_DATA_PIPELINE_STATISTICS1* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3040,7 +3041,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_QUERY_DATA_P
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_QUERY_DATA_SO_STATISTICS* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_QUERY_DATA_SO_STATISTICS* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3052,7 +3053,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_QUERY_DATA_S
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_STREAM_OUTPUT_BUFFER_VIEW* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_STREAM_OUTPUT_BUFFER_VIEW* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3065,7 +3066,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_STREAM_OUTPU
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRAW_ARGUMENTS* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DRAW_ARGUMENTS* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3079,7 +3080,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRAW_ARGUMEN
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRAW_INDEXED_ARGUMENTS* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DRAW_INDEXED_ARGUMENTS* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3094,7 +3095,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRAW_INDEXED
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DISPATCH_ARGUMENTS* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DISPATCH_ARGUMENTS* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3107,7 +3108,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DISPATCH_ARG
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_VERTEX_BUFFER_VIEW* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_VERTEX_BUFFER_VIEW* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3120,7 +3121,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_VERTEX_BUFFE
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_INDEX_BUFFER_VIEW* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_INDEX_BUFFER_VIEW* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3133,7 +3134,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_INDEX_BUFFER
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_INDIRECT_ARGUMENT_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_INDIRECT_ARGUMENT_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3203,7 +3204,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_INDIRECT_ARG
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_COMMAND_SIGNATURE_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_COMMAND_SIGNATURE_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3217,7 +3218,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_COMMAND_SIGN
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_WRITEBUFFERIMMEDIATE_PARAMETER* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_WRITEBUFFERIMMEDIATE_PARAMETER* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3229,7 +3230,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_WRITEBUFFERI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_PROTECTED_RESOURCE_SESSION_SUPPORT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_PROTECTED_RESOURCE_SESSION_SUPPORT* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3241,7 +3242,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_PROTECTED_RESOURCE_SESSION_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_PROTECTED_RESOURCE_SESSION_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3253,7 +3254,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_PROTECTED_RE
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_META_COMMAND_PARAMETER_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_META_COMMAND_PARAMETER_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3268,7 +3269,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_META_COMMAND
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_META_COMMAND_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_META_COMMAND_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3282,7 +3283,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_META_COMMAND
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_STATE_OBJECT_CONFIG* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_STATE_OBJECT_CONFIG* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3293,7 +3294,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_STATE_OBJECT
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_GLOBAL_ROOT_SIGNATURE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_GLOBAL_ROOT_SIGNATURE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3304,7 +3305,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_GLOBAL_ROOT_
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_LOCAL_ROOT_SIGNATURE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_LOCAL_ROOT_SIGNATURE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3315,7 +3316,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_LOCAL_ROOT_S
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_NODE_MASK* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_NODE_MASK* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3326,7 +3327,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_NODE_MASK* d
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_EXPORT_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_EXPORT_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3339,7 +3340,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_EXPORT_DESC*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DXIL_LIBRARY_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DXIL_LIBRARY_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3352,7 +3353,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DXIL_LIBRARY
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_EXISTING_COLLECTION_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_EXISTING_COLLECTION_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3365,7 +3366,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_EXISTING_COL
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SUBOBJECT_TO_EXPORTS_ASSOCIATION* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_SUBOBJECT_TO_EXPORTS_ASSOCIATION* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3378,7 +3379,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SUBOBJECT_TO
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DXIL_SUBOBJECT_TO_EXPORTS_ASSOCIATION* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DXIL_SUBOBJECT_TO_EXPORTS_ASSOCIATION* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3391,7 +3392,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DXIL_SUBOBJE
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_HIT_GROUP_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_HIT_GROUP_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3406,7 +3407,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_HIT_GROUP_DE
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_SHADER_CONFIG* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RAYTRACING_SHADER_CONFIG* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3418,7 +3419,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_S
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_PIPELINE_CONFIG* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RAYTRACING_PIPELINE_CONFIG* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3429,7 +3430,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_P
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_PIPELINE_CONFIG1* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RAYTRACING_PIPELINE_CONFIG1* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3441,7 +3442,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_P
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_STATE_OBJECT_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_STATE_OBJECT_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3454,7 +3455,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_STATE_OBJECT
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_GPU_VIRTUAL_ADDRESS_AND_STRIDE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_GPU_VIRTUAL_ADDRESS_AND_STRIDE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3466,7 +3467,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_GPU_VIRTUAL_
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_GPU_VIRTUAL_ADDRESS_RANGE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_GPU_VIRTUAL_ADDRESS_RANGE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3478,7 +3479,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_GPU_VIRTUAL_
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_GPU_VIRTUAL_ADDRESS_RANGE_AND_STRIDE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_GPU_VIRTUAL_ADDRESS_RANGE_AND_STRIDE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3491,7 +3492,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_GPU_VIRTUAL_
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_GEOMETRY_TRIANGLES_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RAYTRACING_GEOMETRY_TRIANGLES_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3508,7 +3509,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_G
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_AABB* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RAYTRACING_AABB* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3524,7 +3525,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_A
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_GEOMETRY_AABBS_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RAYTRACING_GEOMETRY_AABBS_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3536,7 +3537,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_G
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3548,7 +3549,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_A
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_COMPACTED_SIZE_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_COMPACTED_SIZE_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3559,7 +3560,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_A
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_TOOLS_VISUALIZATION_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_TOOLS_VISUALIZATION_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3570,7 +3571,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_A
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_TOOLS_VISUALIZATION_HEADER* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_TOOLS_VISUALIZATION_HEADER* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3582,7 +3583,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BUILD_RAYTRA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_SERIALIZATION_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_SERIALIZATION_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3594,7 +3595,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_A
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SERIALIZED_DATA_DRIVER_MATCHING_IDENTIFIER* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_SERIALIZED_DATA_DRIVER_MATCHING_IDENTIFIER* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3606,7 +3607,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SERIALIZED_D
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SERIALIZED_RAYTRACING_ACCELERATION_STRUCTURE_HEADER* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_SERIALIZED_RAYTRACING_ACCELERATION_STRUCTURE_HEADER* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3620,7 +3621,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SERIALIZED_R
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_CURRENT_SIZE_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_CURRENT_SIZE_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3631,7 +3632,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_A
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_INSTANCE_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RAYTRACING_INSTANCE_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3647,7 +3648,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_I
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_GEOMETRY_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RAYTRACING_GEOMETRY_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3677,7 +3678,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_G
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3721,7 +3722,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BUILD_RAYTRA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3735,7 +3736,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BUILD_RAYTRA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_PREBUILD_INFO* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_PREBUILD_INFO* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3748,7 +3749,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RAYTRACING_A
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_AUTO_BREADCRUMB_NODE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_AUTO_BREADCRUMB_NODE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3768,7 +3769,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_AUTO_BREADCR
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_BREADCRUMB_CONTEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DRED_BREADCRUMB_CONTEXT* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3780,7 +3781,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_BREADCR
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_AUTO_BREADCRUMB_NODE1* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_AUTO_BREADCRUMB_NODE1* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3802,7 +3803,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_AUTO_BREADCR
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEVICE_REMOVED_EXTENDED_DATA* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DEVICE_REMOVED_EXTENDED_DATA* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3814,7 +3815,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEVICE_REMOV
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_ALLOCATION_NODE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DRED_ALLOCATION_NODE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3828,7 +3829,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_ALLOCAT
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_ALLOCATION_NODE1* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DRED_ALLOCATION_NODE1* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3843,7 +3844,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_ALLOCAT
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_AUTO_BREADCRUMBS_OUTPUT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DRED_AUTO_BREADCRUMBS_OUTPUT* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3854,7 +3855,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_AUTO_BR
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_AUTO_BREADCRUMBS_OUTPUT1* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DRED_AUTO_BREADCRUMBS_OUTPUT1* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3865,7 +3866,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_AUTO_BR
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_PAGE_FAULT_OUTPUT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DRED_PAGE_FAULT_OUTPUT* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3878,7 +3879,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_PAGE_FA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_PAGE_FAULT_OUTPUT1* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DRED_PAGE_FAULT_OUTPUT1* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3891,7 +3892,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_PAGE_FA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_PAGE_FAULT_OUTPUT2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DRED_PAGE_FAULT_OUTPUT2* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3905,7 +3906,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DRED_PAGE_FA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEVICE_REMOVED_EXTENDED_DATA1* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DEVICE_REMOVED_EXTENDED_DATA1* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3918,7 +3919,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEVICE_REMOV
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEVICE_REMOVED_EXTENDED_DATA2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DEVICE_REMOVED_EXTENDED_DATA2* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3931,7 +3932,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEVICE_REMOV
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEVICE_REMOVED_EXTENDED_DATA3* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DEVICE_REMOVED_EXTENDED_DATA3* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3945,7 +3946,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEVICE_REMOV
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_VERSIONED_DEVICE_REMOVED_EXTENDED_DATA* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_VERSIONED_DEVICE_REMOVED_EXTENDED_DATA* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3985,7 +3986,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_VERSIONED_DE
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_PROTECTED_RESOURCE_SESSION_TYPE_COUNT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_PROTECTED_RESOURCE_SESSION_TYPE_COUNT* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -3997,7 +3998,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA_PROTECTED_RESOURCE_SESSION_TYPES* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_FEATURE_DATA_PROTECTED_RESOURCE_SESSION_TYPES* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4010,7 +4011,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_FEATURE_DATA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_PROTECTED_RESOURCE_SESSION_DESC1* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_PROTECTED_RESOURCE_SESSION_DESC1* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4023,7 +4024,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_PROTECTED_RE
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_BEGINNING_ACCESS_CLEAR_PARAMETERS* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RENDER_PASS_BEGINNING_ACCESS_CLEAR_PARAMETERS* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4034,7 +4035,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_BEGINNING_ACCESS_PRESERVE_LOCAL_PARAMETERS* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RENDER_PASS_BEGINNING_ACCESS_PRESERVE_LOCAL_PARAMETERS* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4046,7 +4047,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_BEGINNING_ACCESS* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RENDER_PASS_BEGINNING_ACCESS* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4087,7 +4088,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_ENDING_ACCESS_RESOLVE_SUBRESOURCE_PARAMETERS* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RENDER_PASS_ENDING_ACCESS_RESOLVE_SUBRESOURCE_PARAMETERS* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4102,7 +4103,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_ENDING_ACCESS_RESOLVE_PARAMETERS* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RENDER_PASS_ENDING_ACCESS_RESOLVE_PARAMETERS* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4119,7 +4120,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_ENDING_ACCESS_PRESERVE_LOCAL_PARAMETERS* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RENDER_PASS_ENDING_ACCESS_PRESERVE_LOCAL_PARAMETERS* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4131,7 +4132,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_ENDING_ACCESS* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RENDER_PASS_ENDING_ACCESS* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4169,7 +4170,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_RENDER_TARGET_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RENDER_PASS_RENDER_TARGET_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4182,7 +4183,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_DEPTH_STENCIL_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_RENDER_PASS_DEPTH_STENCIL_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4197,7 +4198,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_RENDER_PASS_
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DISPATCH_RAYS_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DISPATCH_RAYS_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4214,7 +4215,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DISPATCH_RAY
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SHADER_CACHE_SESSION_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_SHADER_CACHE_SESSION_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4231,7 +4232,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SHADER_CACHE
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BARRIER_SUBRESOURCE_RANGE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_BARRIER_SUBRESOURCE_RANGE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4247,7 +4248,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BARRIER_SUBR
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_GLOBAL_BARRIER* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_GLOBAL_BARRIER* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4261,7 +4262,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_GLOBAL_BARRI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEXTURE_BARRIER* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_TEXTURE_BARRIER* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4280,7 +4281,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_TEXTURE_BARR
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BUFFER_BARRIER* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_BUFFER_BARRIER* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4297,7 +4298,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BUFFER_BARRI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BARRIER_GROUP* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_BARRIER_GROUP* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4332,7 +4333,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_BARRIER_GROU
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SUBRESOURCE_DATA* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_SUBRESOURCE_DATA* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4345,7 +4346,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_SUBRESOURCE_
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_MEMCPY_DEST* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_MEMCPY_DEST* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4358,7 +4359,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_MEMCPY_DEST*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEVICE_CONFIGURATION_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DEVICE_CONFIGURATION_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4372,7 +4373,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEVICE_CONFI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DISPATCH_MESH_ARGUMENTS* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DISPATCH_MESH_ARGUMENTS* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4385,7 +4386,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DISPATCH_MES
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D_SHADER_MACRO* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D_SHADER_MACRO* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4397,7 +4398,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D_SHADER_MACRO*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEBUG_DEVICE_GPU_BASED_VALIDATION_SETTINGS* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DEBUG_DEVICE_GPU_BASED_VALIDATION_SETTINGS* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4410,7 +4411,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEBUG_DEVICE
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEBUG_DEVICE_GPU_SLOWDOWN_PERFORMANCE_FACTOR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DEBUG_DEVICE_GPU_SLOWDOWN_PERFORMANCE_FACTOR* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4421,7 +4422,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEBUG_DEVICE
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEBUG_COMMAND_LIST_GPU_BASED_VALIDATION_SETTINGS* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_DEBUG_COMMAND_LIST_GPU_BASED_VALIDATION_SETTINGS* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4432,7 +4433,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_DEBUG_COMMAN
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_MESSAGE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_MESSAGE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4447,7 +4448,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_MESSAGE* dat
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_INFO_QUEUE_FILTER_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_INFO_QUEUE_FILTER_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4463,7 +4464,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_INFO_QUEUE_F
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_INFO_QUEUE_FILTER* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_INFO_QUEUE_FILTER* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4475,7 +4476,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_INFO_QUEUE_F
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_tagRECT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_tagRECT* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4489,7 +4490,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_tagRECT* data, con
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_tagPOINT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_tagPOINT* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4501,7 +4502,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_tagPOINT* data, co
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded__SECURITY_ATTRIBUTES* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded__SECURITY_ATTRIBUTES* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4523,7 +4524,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded__SECURITY_ATTRIBUT
 /** @{*/
 
 // Decoded_LARGE_INTEGER won't be generated as it is a <winnt.h> struct rather than D3D12.
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_LARGE_INTEGER* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_LARGE_INTEGER* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4534,7 +4535,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_LARGE_INTEGER* dat
 }
 
 // Generated version tries to read the struct members rather than doing the "fake enum" thing.
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_GUID* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_GUID* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4549,7 +4550,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_GUID* data, const
 /// and a byte count with the structure defined in documentation. See:
 /// <https://learn.microsoft.com/en-us/windows/win32/api/d3d12/ns-d3d12-d3d12_pipeline_state_stream_desc>
 /// See also: framework\decode\custom_dx12_struct_decoders.cpp
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_PIPELINE_STATE_STREAM_DESC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_PIPELINE_STATE_STREAM_DESC* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4582,7 +4583,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_PIPELINE_STA
 }
 
 // The decoded struct has a custom implementation.
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_STATE_SUBOBJECT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_STATE_SUBOBJECT* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -4637,7 +4638,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_STATE_SUBOBJ
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_CPU_DESCRIPTOR_HANDLE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_D3D12_CPU_DESCRIPTOR_HANDLE* data, const JsonOptions& options)
 {
     using namespace util;
     if (data && data->decoded_value)
@@ -34,6 +34,7 @@ GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
 using util::JsonOptions;
+using util::JsonValue;
 using util::to_hex_fixed_width;
 
 template<typename TFlags, typename ToStringFunctionType>
@@ -61,7 +62,7 @@ std::string ExpandFlags(TFlags flags, ToStringFunctionType toString)
 }
 
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1ChromaSamplePosition& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StdVideoAV1ChromaSamplePosition& value, const JsonOptions& options)
 {
     switch (value) {
         case STD_VIDEO_AV1_CHROMA_SAMPLE_POSITION_UNKNOWN:
@@ -85,7 +86,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1ChromaSamplePos
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1ColorPrimaries& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StdVideoAV1ColorPrimaries& value, const JsonOptions& options)
 {
     switch (value) {
         case STD_VIDEO_AV1_COLOR_PRIMARIES_BT_709:
@@ -133,7 +134,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1ColorPrimaries&
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1FrameRestorationType& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StdVideoAV1FrameRestorationType& value, const JsonOptions& options)
 {
     switch (value) {
         case STD_VIDEO_AV1_FRAME_RESTORATION_TYPE_NONE:
@@ -157,7 +158,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1FrameRestoratio
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1FrameType& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StdVideoAV1FrameType& value, const JsonOptions& options)
 {
     switch (value) {
         case STD_VIDEO_AV1_FRAME_TYPE_KEY:
@@ -181,7 +182,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1FrameType& valu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1InterpolationFilter& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StdVideoAV1InterpolationFilter& value, const JsonOptions& options)
 {
     switch (value) {
         case STD_VIDEO_AV1_INTERPOLATION_FILTER_EIGHTTAP:
@@ -208,7 +209,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1InterpolationFi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1Level& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StdVideoAV1Level& value, const JsonOptions& options)
 {
     switch (value) {
         case STD_VIDEO_AV1_LEVEL_2_0:
@@ -292,7 +293,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1Level& value, c
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1MatrixCoefficients& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StdVideoAV1MatrixCoefficients& value, const JsonOptions& options)
 {
     switch (value) {
         case STD_VIDEO_AV1_MATRIX_COEFFICIENTS_IDENTITY:
@@ -349,7 +350,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1MatrixCoefficie
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1Profile& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StdVideoAV1Profile& value, const JsonOptions& options)
 {
     switch (value) {
         case STD_VIDEO_AV1_PROFILE_MAIN:
@@ -370,7 +371,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1Profile& value,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1ReferenceName& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StdVideoAV1ReferenceName& value, const JsonOptions& options)
 {
     switch (value) {
         case STD_VIDEO_AV1_REFERENCE_NAME_INTRA_FRAME:
@@ -406,7 +407,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1ReferenceName&
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1TransferCharacteristics& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StdVideoAV1TransferCharacteristics& value, const JsonOptions& options)
 {
     switch (value) {
         case STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_RESERVED_0:
@@ -475,7 +476,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1TransferCharact
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1TxMode& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StdVideoAV1TxMode& value, const JsonOptions& options)
 {
     switch (value) {
         case STD_VIDEO_AV1_TX_MODE_ONLY_4X4:
@@ -496,7 +497,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1TxMode& value,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoDecodeH264FieldOrderCount& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StdVideoDecodeH264FieldOrderCount& value, const JsonOptions& options)
 {
     switch (value) {
         case STD_VIDEO_DECODE_H264_FIELD_ORDER_COUNT_TOP:
@@ -514,7 +515,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoDecodeH264FieldOrd
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264AspectRatioIdc& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StdVideoH264AspectRatioIdc& value, const JsonOptions& options)
 {
     switch (value) {
         case STD_VIDEO_H264_ASPECT_RATIO_IDC_UNSPECIFIED:
@@ -580,7 +581,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264AspectRatioIdc
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264CabacInitIdc& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StdVideoH264CabacInitIdc& value, const JsonOptions& options)
 {
     switch (value) {
         case STD_VIDEO_H264_CABAC_INIT_IDC_0:
@@ -601,7 +602,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264CabacInitIdc&
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264ChromaFormatIdc& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StdVideoH264ChromaFormatIdc& value, const JsonOptions& options)
 {
     switch (value) {
         case STD_VIDEO_H264_CHROMA_FORMAT_IDC_MONOCHROME:
@@ -625,7 +626,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264ChromaFormatId
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264DisableDeblockingFilterIdc& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StdVideoH264DisableDeblockingFilterIdc& value, const JsonOptions& options)
 {
     switch (value) {
         case STD_VIDEO_H264_DISABLE_DEBLOCKING_FILTER_IDC_DISABLED:
@@ -646,7 +647,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264DisableDeblock
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264LevelIdc& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StdVideoH264LevelIdc& value, const JsonOptions& options)
 {
     switch (value) {
         case STD_VIDEO_H264_LEVEL_IDC_1_0:
@@ -715,7 +716,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264LevelIdc& valu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264MemMgmtControlOp& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StdVideoH264MemMgmtControlOp& value, const JsonOptions& options)
 {
     switch (value) {
         case STD_VIDEO_H264_MEM_MGMT_CONTROL_OP_END:
@@ -748,7 +749,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264MemMgmtControl
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264ModificationOfPicNumsIdc& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StdVideoH264ModificationOfPicNumsIdc& value, const JsonOptions& options)
 {
     switch (value) {
         case STD_VIDEO_H264_MODIFICATION_OF_PIC_NUMS_IDC_SHORT_TERM_SUBTRACT:
@@ -772,7 +773,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264ModificationOf
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264NonVclNaluType& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StdVideoH264NonVclNaluType& value, const JsonOptions& options)
 {
     switch (value) {
         case STD_VIDEO_H264_NON_VCL_NALU_TYPE_SPS:
@@ -805,7 +806,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264NonVclNaluType
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264PictureType& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StdVideoH264PictureType& value, const JsonOptions& options)
 {
     switch (value) {
         case STD_VIDEO_H264_PICTURE_TYPE_P:
@@ -829,7 +830,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264PictureType& v
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264PocType& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StdVideoH264PocType& value, const JsonOptions& options)
 {
     switch (value) {
         case STD_VIDEO_H264_POC_TYPE_0:
@@ -850,7 +851,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264PocType& value
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264ProfileIdc& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StdVideoH264ProfileIdc& value, const JsonOptions& options)
 {
     switch (value) {
         case STD_VIDEO_H264_PROFILE_IDC_BASELINE:
@@ -874,7 +875,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264ProfileIdc& va
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264SliceType& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StdVideoH264SliceType& value, const JsonOptions& options)
 {
     switch (value) {
         case STD_VIDEO_H264_SLICE_TYPE_P:
@@ -895,7 +896,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264SliceType& val
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264WeightedBipredIdc& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StdVideoH264WeightedBipredIdc& value, const JsonOptions& options)
 {
     switch (value) {
         case STD_VIDEO_H264_WEIGHTED_BIPRED_IDC_DEFAULT:
@@ -916,7 +917,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264WeightedBipred
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH265AspectRatioIdc& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StdVideoH265AspectRatioIdc& value, const JsonOptions& options)
 {
     switch (value) {
         case STD_VIDEO_H265_ASPECT_RATIO_IDC_UNSPECIFIED:
@@ -982,7 +983,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH265AspectRatioIdc
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH265ChromaFormatIdc& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StdVideoH265ChromaFormatIdc& value, const JsonOptions& options)
 {
     switch (value) {
         case STD_VIDEO_H265_CHROMA_FORMAT_IDC_MONOCHROME:
@@ -1006,7 +1007,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH265ChromaFormatId
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH265LevelIdc& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StdVideoH265LevelIdc& value, const JsonOptions& options)
 {
     switch (value) {
         case STD_VIDEO_H265_LEVEL_IDC_1_0:
@@ -1057,7 +1058,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH265LevelIdc& valu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH265PictureType& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StdVideoH265PictureType& value, const JsonOptions& options)
 {
     switch (value) {
         case STD_VIDEO_H265_PICTURE_TYPE_P:
@@ -1081,7 +1082,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH265PictureType& v
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH265ProfileIdc& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StdVideoH265ProfileIdc& value, const JsonOptions& options)
 {
     switch (value) {
         case STD_VIDEO_H265_PROFILE_IDC_MAIN:
@@ -1108,7 +1109,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH265ProfileIdc& va
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH265SliceType& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const StdVideoH265SliceType& value, const JsonOptions& options)
 {
     switch (value) {
         case STD_VIDEO_H265_SLICE_TYPE_B:
@@ -1129,7 +1130,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH265SliceType& val
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkAccelerationStructureBuildTypeKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkAccelerationStructureBuildTypeKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_ACCELERATION_STRUCTURE_BUILD_TYPE_HOST_KHR:
@@ -1147,7 +1148,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkAccelerationStructureBui
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkAccelerationStructureCompatibilityKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkAccelerationStructureCompatibilityKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_ACCELERATION_STRUCTURE_COMPATIBILITY_COMPATIBLE_KHR:
@@ -1162,7 +1163,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkAccelerationStructureCom
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkAccelerationStructureCreateFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkAccelerationStructureCreateFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_ACCELERATION_STRUCTURE_CREATE_DEVICE_ADDRESS_CAPTURE_REPLAY_BIT_KHR:
@@ -1180,7 +1181,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkAccelerationStructureCre
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkAccelerationStructureMemoryRequirementsTypeNV& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkAccelerationStructureMemoryRequirementsTypeNV& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_ACCELERATION_STRUCTURE_MEMORY_REQUIREMENTS_TYPE_OBJECT_NV:
@@ -1198,7 +1199,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkAccelerationStructureMem
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkAccelerationStructureMotionInstanceTypeNV& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkAccelerationStructureMotionInstanceTypeNV& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_ACCELERATION_STRUCTURE_MOTION_INSTANCE_TYPE_STATIC_NV:
@@ -1216,7 +1217,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkAccelerationStructureMot
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkAccelerationStructureTypeKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkAccelerationStructureTypeKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL_KHR:
@@ -1234,7 +1235,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkAccelerationStructureTyp
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkAccessFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkAccessFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_ACCESS_INDIRECT_COMMAND_READ_BIT:
@@ -1330,7 +1331,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkAccessFlagBits& value, c
     }
 }
 
-void FieldToJson(VkAccessFlagBits2_t, nlohmann::ordered_json& jdata, const VkAccessFlagBits2& value, const JsonOptions& options)
+void FieldToJson(VkAccessFlagBits2_t, JsonValue& jdata, const VkAccessFlagBits2& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_ACCESS_2_NONE:
@@ -1468,12 +1469,12 @@ void FieldToJson(VkAccessFlagBits2_t, nlohmann::ordered_json& jdata, const VkAcc
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkAcquireProfilingLockFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkAcquireProfilingLockFlagBitsKHR& value, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(value);
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkAntiLagModeAMD& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkAntiLagModeAMD& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_ANTI_LAG_MODE_DRIVER_CONTROL_AMD:
@@ -1491,7 +1492,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkAntiLagModeAMD& value, c
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkAntiLagStageAMD& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkAntiLagStageAMD& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_ANTI_LAG_STAGE_INPUT_AMD:
@@ -1506,7 +1507,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkAntiLagStageAMD& value,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkAttachmentDescriptionFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkAttachmentDescriptionFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_ATTACHMENT_DESCRIPTION_MAY_ALIAS_BIT:
@@ -1518,7 +1519,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkAttachmentDescriptionFla
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkAttachmentLoadOp& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkAttachmentLoadOp& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_ATTACHMENT_LOAD_OP_LOAD:
@@ -1539,7 +1540,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkAttachmentLoadOp& value,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkAttachmentStoreOp& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkAttachmentStoreOp& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_ATTACHMENT_STORE_OP_STORE:
@@ -1557,7 +1558,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkAttachmentStoreOp& value
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkBlendFactor& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkBlendFactor& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_BLEND_FACTOR_ZERO:
@@ -1623,7 +1624,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkBlendFactor& value, cons
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkBlendOp& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkBlendOp& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_BLEND_OP_ADD:
@@ -1785,7 +1786,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkBlendOp& value, const Js
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkBlendOverlapEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkBlendOverlapEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_BLEND_OVERLAP_UNCORRELATED_EXT:
@@ -1803,7 +1804,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkBlendOverlapEXT& value,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkBlockMatchWindowCompareModeQCOM& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkBlockMatchWindowCompareModeQCOM& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_BLOCK_MATCH_WINDOW_COMPARE_MODE_MIN_QCOM:
@@ -1818,7 +1819,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkBlockMatchWindowCompareM
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkBorderColor& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkBorderColor& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_BORDER_COLOR_FLOAT_TRANSPARENT_BLACK:
@@ -1851,7 +1852,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkBorderColor& value, cons
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkBufferCreateFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkBufferCreateFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_BUFFER_CREATE_SPARSE_BINDING_BIT:
@@ -1881,7 +1882,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkBufferCreateFlagBits& va
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkBufferUsageFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkBufferUsageFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_BUFFER_USAGE_TRANSFER_SRC_BIT:
@@ -1968,7 +1969,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkBufferUsageFlagBits& val
     }
 }
 
-void FieldToJson(VkBufferUsageFlagBits2KHR_t, nlohmann::ordered_json& jdata, const VkBufferUsageFlagBits2KHR& value, const JsonOptions& options)
+void FieldToJson(VkBufferUsageFlagBits2KHR_t, JsonValue& jdata, const VkBufferUsageFlagBits2KHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_BUFFER_USAGE_2_TRANSFER_SRC_BIT_KHR:
@@ -2058,7 +2059,7 @@ void FieldToJson(VkBufferUsageFlagBits2KHR_t, nlohmann::ordered_json& jdata, con
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkBuildAccelerationStructureFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkBuildAccelerationStructureFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_UPDATE_BIT_KHR:
@@ -2100,7 +2101,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkBuildAccelerationStructu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkBuildAccelerationStructureModeKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkBuildAccelerationStructureModeKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR:
@@ -2115,7 +2116,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkBuildAccelerationStructu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkBuildMicromapFlagBitsEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkBuildMicromapFlagBitsEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_BUILD_MICROMAP_PREFER_FAST_TRACE_BIT_EXT:
@@ -2133,7 +2134,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkBuildMicromapFlagBitsEXT
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkBuildMicromapModeEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkBuildMicromapModeEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_BUILD_MICROMAP_MODE_BUILD_EXT:
@@ -2145,7 +2146,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkBuildMicromapModeEXT& va
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkChromaLocation& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkChromaLocation& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_CHROMA_LOCATION_COSITED_EVEN:
@@ -2160,7 +2161,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkChromaLocation& value, c
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkCoarseSampleOrderTypeNV& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkCoarseSampleOrderTypeNV& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_COARSE_SAMPLE_ORDER_TYPE_DEFAULT_NV:
@@ -2181,7 +2182,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkCoarseSampleOrderTypeNV&
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkColorComponentFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkColorComponentFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_COLOR_COMPONENT_R_BIT:
@@ -2202,7 +2203,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkColorComponentFlagBits&
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkColorSpaceKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkColorSpaceKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_COLOR_SPACE_SRGB_NONLINEAR_KHR:
@@ -2259,7 +2260,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkColorSpaceKHR& value, co
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkCommandBufferLevel& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkCommandBufferLevel& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_COMMAND_BUFFER_LEVEL_PRIMARY:
@@ -2274,7 +2275,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkCommandBufferLevel& valu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkCommandBufferResetFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkCommandBufferResetFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_COMMAND_BUFFER_RESET_RELEASE_RESOURCES_BIT:
@@ -2286,7 +2287,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkCommandBufferResetFlagBi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkCommandBufferUsageFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkCommandBufferUsageFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT:
@@ -2304,7 +2305,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkCommandBufferUsageFlagBi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkCommandPoolCreateFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkCommandPoolCreateFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_COMMAND_POOL_CREATE_TRANSIENT_BIT:
@@ -2322,7 +2323,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkCommandPoolCreateFlagBit
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkCommandPoolResetFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkCommandPoolResetFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_COMMAND_POOL_RESET_RELEASE_RESOURCES_BIT:
@@ -2334,7 +2335,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkCommandPoolResetFlagBits
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkCompareOp& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkCompareOp& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_COMPARE_OP_NEVER:
@@ -2367,7 +2368,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkCompareOp& value, const
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkComponentSwizzle& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkComponentSwizzle& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_COMPONENT_SWIZZLE_IDENTITY:
@@ -2397,7 +2398,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkComponentSwizzle& value,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkComponentTypeKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkComponentTypeKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_COMPONENT_TYPE_FLOAT16_KHR:
@@ -2439,7 +2440,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkComponentTypeKHR& value,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkCompositeAlphaFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkCompositeAlphaFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR:
@@ -2460,7 +2461,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkCompositeAlphaFlagBitsKH
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkConditionalRenderingFlagBitsEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkConditionalRenderingFlagBitsEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_CONDITIONAL_RENDERING_INVERTED_BIT_EXT:
@@ -2472,7 +2473,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkConditionalRenderingFlag
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkConservativeRasterizationModeEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkConservativeRasterizationModeEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_CONSERVATIVE_RASTERIZATION_MODE_DISABLED_EXT:
@@ -2490,7 +2491,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkConservativeRasterizatio
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkCopyAccelerationStructureModeKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkCopyAccelerationStructureModeKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_COPY_ACCELERATION_STRUCTURE_MODE_CLONE_KHR:
@@ -2511,7 +2512,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkCopyAccelerationStructur
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkCopyMicromapModeEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkCopyMicromapModeEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_COPY_MICROMAP_MODE_CLONE_EXT:
@@ -2532,7 +2533,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkCopyMicromapModeEXT& val
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkCoverageModulationModeNV& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkCoverageModulationModeNV& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_COVERAGE_MODULATION_MODE_NONE_NV:
@@ -2553,7 +2554,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkCoverageModulationModeNV
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkCoverageReductionModeNV& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkCoverageReductionModeNV& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_COVERAGE_REDUCTION_MODE_MERGE_NV:
@@ -2568,7 +2569,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkCoverageReductionModeNV&
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkCubicFilterWeightsQCOM& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkCubicFilterWeightsQCOM& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_CUBIC_FILTER_WEIGHTS_CATMULL_ROM_QCOM:
@@ -2589,7 +2590,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkCubicFilterWeightsQCOM&
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkCullModeFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkCullModeFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_CULL_MODE_NONE:
@@ -2610,7 +2611,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkCullModeFlagBits& value,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDebugReportFlagBitsEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkDebugReportFlagBitsEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_DEBUG_REPORT_INFORMATION_BIT_EXT:
@@ -2634,7 +2635,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkDebugReportFlagBitsEXT&
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDebugReportObjectTypeEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkDebugReportObjectTypeEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT:
@@ -2766,7 +2767,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkDebugReportObjectTypeEXT
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDebugUtilsMessageSeverityFlagBitsEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkDebugUtilsMessageSeverityFlagBitsEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT:
@@ -2787,7 +2788,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkDebugUtilsMessageSeverit
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDebugUtilsMessageTypeFlagBitsEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkDebugUtilsMessageTypeFlagBitsEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT:
@@ -2808,7 +2809,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkDebugUtilsMessageTypeFla
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDependencyFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkDependencyFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_DEPENDENCY_BY_REGION_BIT:
@@ -2829,7 +2830,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkDependencyFlagBits& valu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDepthBiasRepresentationEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkDepthBiasRepresentationEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_DEPTH_BIAS_REPRESENTATION_LEAST_REPRESENTABLE_VALUE_FORMAT_EXT:
@@ -2847,7 +2848,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkDepthBiasRepresentationE
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDepthClampModeEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkDepthClampModeEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_DEPTH_CLAMP_MODE_VIEWPORT_RANGE_EXT:
@@ -2862,7 +2863,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkDepthClampModeEXT& value
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDescriptorBindingFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkDescriptorBindingFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT:
@@ -2883,7 +2884,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkDescriptorBindingFlagBit
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDescriptorPoolCreateFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkDescriptorPoolCreateFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT:
@@ -2907,7 +2908,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkDescriptorPoolCreateFlag
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDescriptorSetLayoutCreateFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkDescriptorSetLayoutCreateFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT:
@@ -2937,7 +2938,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkDescriptorSetLayoutCreat
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDescriptorType& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkDescriptorType& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_DESCRIPTOR_TYPE_SAMPLER:
@@ -2997,7 +2998,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkDescriptorType& value, c
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDescriptorUpdateTemplateType& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkDescriptorUpdateTemplateType& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET:
@@ -3012,7 +3013,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkDescriptorUpdateTemplate
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDeviceAddressBindingFlagBitsEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkDeviceAddressBindingFlagBitsEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_DEVICE_ADDRESS_BINDING_INTERNAL_OBJECT_BIT_EXT:
@@ -3024,7 +3025,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkDeviceAddressBindingFlag
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDeviceAddressBindingTypeEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkDeviceAddressBindingTypeEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_DEVICE_ADDRESS_BINDING_TYPE_BIND_EXT:
@@ -3039,7 +3040,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkDeviceAddressBindingType
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDeviceDiagnosticsConfigFlagBitsNV& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkDeviceDiagnosticsConfigFlagBitsNV& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_DEVICE_DIAGNOSTICS_CONFIG_ENABLE_SHADER_DEBUG_INFO_BIT_NV:
@@ -3060,7 +3061,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkDeviceDiagnosticsConfigF
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDeviceEventTypeEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkDeviceEventTypeEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_DEVICE_EVENT_TYPE_DISPLAY_HOTPLUG_EXT:
@@ -3072,7 +3073,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkDeviceEventTypeEXT& valu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDeviceFaultAddressTypeEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkDeviceFaultAddressTypeEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_DEVICE_FAULT_ADDRESS_TYPE_NONE_EXT:
@@ -3102,7 +3103,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkDeviceFaultAddressTypeEX
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDeviceFaultVendorBinaryHeaderVersionEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkDeviceFaultVendorBinaryHeaderVersionEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_DEVICE_FAULT_VENDOR_BINARY_HEADER_VERSION_ONE_EXT:
@@ -3114,7 +3115,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkDeviceFaultVendorBinaryH
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDeviceGroupPresentModeFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkDeviceGroupPresentModeFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_DEVICE_GROUP_PRESENT_MODE_LOCAL_BIT_KHR:
@@ -3135,7 +3136,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkDeviceGroupPresentModeFl
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDeviceMemoryReportEventTypeEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkDeviceMemoryReportEventTypeEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_DEVICE_MEMORY_REPORT_EVENT_TYPE_ALLOCATE_EXT:
@@ -3159,7 +3160,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkDeviceMemoryReportEventT
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDeviceQueueCreateFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkDeviceQueueCreateFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_DEVICE_QUEUE_CREATE_PROTECTED_BIT:
@@ -3171,7 +3172,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkDeviceQueueCreateFlagBit
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDirectDriverLoadingModeLUNARG& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkDirectDriverLoadingModeLUNARG& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_DIRECT_DRIVER_LOADING_MODE_EXCLUSIVE_LUNARG:
@@ -3186,7 +3187,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkDirectDriverLoadingModeL
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDiscardRectangleModeEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkDiscardRectangleModeEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_DISCARD_RECTANGLE_MODE_INCLUSIVE_EXT:
@@ -3201,7 +3202,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkDiscardRectangleModeEXT&
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDisplacementMicromapFormatNV& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkDisplacementMicromapFormatNV& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_DISPLACEMENT_MICROMAP_FORMAT_64_TRIANGLES_64_BYTES_NV:
@@ -3219,7 +3220,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkDisplacementMicromapForm
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDisplayEventTypeEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkDisplayEventTypeEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_DISPLAY_EVENT_TYPE_FIRST_PIXEL_OUT_EXT:
@@ -3231,7 +3232,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkDisplayEventTypeEXT& val
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDisplayPlaneAlphaFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkDisplayPlaneAlphaFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_DISPLAY_PLANE_ALPHA_OPAQUE_BIT_KHR:
@@ -3252,7 +3253,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkDisplayPlaneAlphaFlagBit
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDisplayPowerStateEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkDisplayPowerStateEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_DISPLAY_POWER_STATE_OFF_EXT:
@@ -3270,7 +3271,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkDisplayPowerStateEXT& va
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDriverId& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkDriverId& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_DRIVER_ID_AMD_PROPRIETARY:
@@ -3360,7 +3361,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkDriverId& value, const J
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDynamicState& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkDynamicState& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_DYNAMIC_STATE_VIEWPORT:
@@ -3588,7 +3589,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkDynamicState& value, con
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkEventCreateFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkEventCreateFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_EVENT_CREATE_DEVICE_ONLY_BIT:
@@ -3600,7 +3601,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkEventCreateFlagBits& val
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkExternalFenceFeatureFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkExternalFenceFeatureFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_EXTERNAL_FENCE_FEATURE_EXPORTABLE_BIT:
@@ -3615,7 +3616,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkExternalFenceFeatureFlag
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkExternalFenceHandleTypeFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkExternalFenceHandleTypeFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_EXTERNAL_FENCE_HANDLE_TYPE_OPAQUE_FD_BIT:
@@ -3636,7 +3637,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkExternalFenceHandleTypeF
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkExternalMemoryFeatureFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkExternalMemoryFeatureFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_EXTERNAL_MEMORY_FEATURE_DEDICATED_ONLY_BIT:
@@ -3654,7 +3655,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkExternalMemoryFeatureFla
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkExternalMemoryFeatureFlagBitsNV& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkExternalMemoryFeatureFlagBitsNV& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_EXTERNAL_MEMORY_FEATURE_DEDICATED_ONLY_BIT_NV:
@@ -3672,7 +3673,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkExternalMemoryFeatureFla
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkExternalMemoryHandleTypeFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkExternalMemoryHandleTypeFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_FD_BIT:
@@ -3723,7 +3724,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkExternalMemoryHandleType
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkExternalMemoryHandleTypeFlagBitsNV& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkExternalMemoryHandleTypeFlagBitsNV& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_WIN32_BIT_NV:
@@ -3744,7 +3745,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkExternalMemoryHandleType
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkExternalSemaphoreFeatureFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkExternalSemaphoreFeatureFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_EXTERNAL_SEMAPHORE_FEATURE_EXPORTABLE_BIT:
@@ -3759,7 +3760,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkExternalSemaphoreFeature
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkExternalSemaphoreHandleTypeFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkExternalSemaphoreHandleTypeFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_OPAQUE_FD_BIT:
@@ -3786,7 +3787,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkExternalSemaphoreHandleT
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkFenceCreateFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkFenceCreateFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_FENCE_CREATE_SIGNALED_BIT:
@@ -3798,7 +3799,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkFenceCreateFlagBits& val
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkFenceImportFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkFenceImportFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_FENCE_IMPORT_TEMPORARY_BIT:
@@ -3810,7 +3811,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkFenceImportFlagBits& val
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkFilter& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkFilter& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_FILTER_NEAREST:
@@ -3828,7 +3829,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkFilter& value, const Jso
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkFormat& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkFormat& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_FORMAT_UNDEFINED:
@@ -4587,7 +4588,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkFormat& value, const Jso
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkFormatFeatureFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkFormatFeatureFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT:
@@ -4689,7 +4690,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkFormatFeatureFlagBits& v
     }
 }
 
-void FieldToJson(VkFormatFeatureFlagBits2_t, nlohmann::ordered_json& jdata, const VkFormatFeatureFlagBits2& value, const JsonOptions& options)
+void FieldToJson(VkFormatFeatureFlagBits2_t, JsonValue& jdata, const VkFormatFeatureFlagBits2& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_BIT:
@@ -4827,7 +4828,7 @@ void FieldToJson(VkFormatFeatureFlagBits2_t, nlohmann::ordered_json& jdata, cons
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkFragmentShadingRateCombinerOpKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkFragmentShadingRateCombinerOpKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_FRAGMENT_SHADING_RATE_COMBINER_OP_KEEP_KHR:
@@ -4851,7 +4852,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkFragmentShadingRateCombi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkFragmentShadingRateNV& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkFragmentShadingRateNV& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_FRAGMENT_SHADING_RATE_1_INVOCATION_PER_PIXEL_NV:
@@ -4896,7 +4897,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkFragmentShadingRateNV& v
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkFragmentShadingRateTypeNV& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkFragmentShadingRateTypeNV& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_FRAGMENT_SHADING_RATE_TYPE_FRAGMENT_SIZE_NV:
@@ -4911,7 +4912,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkFragmentShadingRateTypeN
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkFrameBoundaryFlagBitsEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkFrameBoundaryFlagBitsEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_FRAME_BOUNDARY_FRAME_END_BIT_EXT:
@@ -4923,7 +4924,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkFrameBoundaryFlagBitsEXT
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkFramebufferCreateFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkFramebufferCreateFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_FRAMEBUFFER_CREATE_IMAGELESS_BIT:
@@ -4935,7 +4936,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkFramebufferCreateFlagBit
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkFrontFace& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkFrontFace& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_FRONT_FACE_COUNTER_CLOCKWISE:
@@ -4950,7 +4951,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkFrontFace& value, const
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkFullScreenExclusiveEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkFullScreenExclusiveEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_FULL_SCREEN_EXCLUSIVE_DEFAULT_EXT:
@@ -4971,7 +4972,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkFullScreenExclusiveEXT&
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkGeometryFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkGeometryFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_GEOMETRY_OPAQUE_BIT_KHR:
@@ -4986,7 +4987,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkGeometryFlagBitsKHR& val
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkGeometryInstanceFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkGeometryInstanceFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_GEOMETRY_INSTANCE_TRIANGLE_FACING_CULL_DISABLE_BIT_KHR:
@@ -5013,7 +5014,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkGeometryInstanceFlagBits
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkGeometryTypeKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkGeometryTypeKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_GEOMETRY_TYPE_TRIANGLES_KHR:
@@ -5031,7 +5032,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkGeometryTypeKHR& value,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkGraphicsPipelineLibraryFlagBitsEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkGraphicsPipelineLibraryFlagBitsEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT:
@@ -5052,7 +5053,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkGraphicsPipelineLibraryF
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkHostImageCopyFlagBitsEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkHostImageCopyFlagBitsEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_HOST_IMAGE_COPY_MEMCPY_EXT:
@@ -5064,7 +5065,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkHostImageCopyFlagBitsEXT
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkImageAspectFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkImageAspectFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_IMAGE_ASPECT_COLOR_BIT:
@@ -5109,7 +5110,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkImageAspectFlagBits& val
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkImageCompressionFixedRateFlagBitsEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkImageCompressionFixedRateFlagBitsEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_IMAGE_COMPRESSION_FIXED_RATE_NONE_EXT:
@@ -5193,7 +5194,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkImageCompressionFixedRat
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkImageCompressionFlagBitsEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkImageCompressionFlagBitsEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_IMAGE_COMPRESSION_DEFAULT_EXT:
@@ -5214,7 +5215,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkImageCompressionFlagBits
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkImageCreateFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkImageCreateFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_IMAGE_CREATE_SPARSE_BINDING_BIT:
@@ -5283,7 +5284,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkImageCreateFlagBits& val
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkImageLayout& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkImageLayout& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_IMAGE_LAYOUT_UNDEFINED:
@@ -5379,7 +5380,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkImageLayout& value, cons
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkImageTiling& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkImageTiling& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_IMAGE_TILING_OPTIMAL:
@@ -5397,7 +5398,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkImageTiling& value, cons
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkImageType& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkImageType& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_IMAGE_TYPE_1D:
@@ -5415,7 +5416,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkImageType& value, const
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkImageUsageFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkImageUsageFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_IMAGE_USAGE_TRANSFER_SRC_BIT:
@@ -5487,7 +5488,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkImageUsageFlagBits& valu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkImageViewCreateFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkImageViewCreateFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_IMAGE_VIEW_CREATE_FRAGMENT_DENSITY_MAP_DYNAMIC_BIT_EXT:
@@ -5505,7 +5506,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkImageViewCreateFlagBits&
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkImageViewType& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkImageViewType& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_IMAGE_VIEW_TYPE_1D:
@@ -5535,7 +5536,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkImageViewType& value, co
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkIndexType& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkIndexType& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_INDEX_TYPE_UINT16:
@@ -5556,7 +5557,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkIndexType& value, const
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkIndirectCommandsInputModeFlagBitsEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkIndirectCommandsInputModeFlagBitsEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_INDIRECT_COMMANDS_INPUT_MODE_VULKAN_INDEX_BUFFER_EXT:
@@ -5571,7 +5572,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkIndirectCommandsInputMod
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkIndirectCommandsLayoutUsageFlagBitsEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkIndirectCommandsLayoutUsageFlagBitsEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_INDIRECT_COMMANDS_LAYOUT_USAGE_EXPLICIT_PREPROCESS_BIT_EXT:
@@ -5586,7 +5587,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkIndirectCommandsLayoutUs
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkIndirectCommandsLayoutUsageFlagBitsNV& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkIndirectCommandsLayoutUsageFlagBitsNV& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_INDIRECT_COMMANDS_LAYOUT_USAGE_EXPLICIT_PREPROCESS_BIT_NV:
@@ -5604,7 +5605,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkIndirectCommandsLayoutUs
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkIndirectCommandsTokenTypeEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkIndirectCommandsTokenTypeEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_INDIRECT_COMMANDS_TOKEN_TYPE_EXECUTION_SET_EXT:
@@ -5658,7 +5659,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkIndirectCommandsTokenTyp
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkIndirectCommandsTokenTypeNV& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkIndirectCommandsTokenTypeNV& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_INDIRECT_COMMANDS_TOKEN_TYPE_SHADER_GROUP_NV:
@@ -5700,7 +5701,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkIndirectCommandsTokenTyp
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkIndirectExecutionSetInfoTypeEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkIndirectExecutionSetInfoTypeEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_INDIRECT_EXECUTION_SET_INFO_TYPE_PIPELINES_EXT:
@@ -5715,7 +5716,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkIndirectExecutionSetInfo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkIndirectStateFlagBitsNV& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkIndirectStateFlagBitsNV& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_INDIRECT_STATE_FLAG_FRONTFACE_BIT_NV:
@@ -5727,7 +5728,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkIndirectStateFlagBitsNV&
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkInstanceCreateFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkInstanceCreateFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_INSTANCE_CREATE_ENUMERATE_PORTABILITY_BIT_KHR:
@@ -5739,7 +5740,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkInstanceCreateFlagBits&
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkInternalAllocationType& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkInternalAllocationType& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_INTERNAL_ALLOCATION_TYPE_EXECUTABLE:
@@ -5751,7 +5752,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkInternalAllocationType&
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkLatencyMarkerNV& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkLatencyMarkerNV& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_LATENCY_MARKER_SIMULATION_START_NV:
@@ -5796,7 +5797,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkLatencyMarkerNV& value,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkLayerSettingTypeEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkLayerSettingTypeEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_LAYER_SETTING_TYPE_BOOL32_EXT:
@@ -5829,7 +5830,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkLayerSettingTypeEXT& val
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkLayeredDriverUnderlyingApiMSFT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkLayeredDriverUnderlyingApiMSFT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_LAYERED_DRIVER_UNDERLYING_API_NONE_MSFT:
@@ -5844,7 +5845,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkLayeredDriverUnderlyingA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkLineRasterizationModeKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkLineRasterizationModeKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_LINE_RASTERIZATION_MODE_DEFAULT_KHR:
@@ -5865,7 +5866,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkLineRasterizationModeKHR
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkLogicOp& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkLogicOp& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_LOGIC_OP_CLEAR:
@@ -5922,7 +5923,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkLogicOp& value, const Js
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkMemoryAllocateFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkMemoryAllocateFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_MEMORY_ALLOCATE_DEVICE_MASK_BIT:
@@ -5940,7 +5941,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkMemoryAllocateFlagBits&
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkMemoryHeapFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkMemoryHeapFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_MEMORY_HEAP_DEVICE_LOCAL_BIT:
@@ -5955,7 +5956,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkMemoryHeapFlagBits& valu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkMemoryMapFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkMemoryMapFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_MEMORY_MAP_PLACED_BIT_EXT:
@@ -5967,7 +5968,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkMemoryMapFlagBits& value
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkMemoryOverallocationBehaviorAMD& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkMemoryOverallocationBehaviorAMD& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_MEMORY_OVERALLOCATION_BEHAVIOR_DEFAULT_AMD:
@@ -5985,7 +5986,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkMemoryOverallocationBeha
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkMemoryPropertyFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkMemoryPropertyFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT:
@@ -6021,7 +6022,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkMemoryPropertyFlagBits&
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkMemoryUnmapFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkMemoryUnmapFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_MEMORY_UNMAP_RESERVE_BIT_EXT:
@@ -6033,7 +6034,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkMemoryUnmapFlagBitsKHR&
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkMicromapCreateFlagBitsEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkMicromapCreateFlagBitsEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_MICROMAP_CREATE_DEVICE_ADDRESS_CAPTURE_REPLAY_BIT_EXT:
@@ -6045,7 +6046,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkMicromapCreateFlagBitsEX
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkMicromapTypeEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkMicromapTypeEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_MICROMAP_TYPE_OPACITY_MICROMAP_EXT:
@@ -6060,7 +6061,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkMicromapTypeEXT& value,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkObjectType& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkObjectType& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_OBJECT_TYPE_UNKNOWN:
@@ -6231,7 +6232,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkObjectType& value, const
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkOpacityMicromapFormatEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkOpacityMicromapFormatEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_OPACITY_MICROMAP_FORMAT_2_STATE_EXT:
@@ -6246,7 +6247,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkOpacityMicromapFormatEXT
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkOpacityMicromapSpecialIndexEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkOpacityMicromapSpecialIndexEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_OPACITY_MICROMAP_SPECIAL_INDEX_FULLY_TRANSPARENT_EXT:
@@ -6267,7 +6268,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkOpacityMicromapSpecialIn
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkOpticalFlowExecuteFlagBitsNV& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkOpticalFlowExecuteFlagBitsNV& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_OPTICAL_FLOW_EXECUTE_DISABLE_TEMPORAL_HINTS_BIT_NV:
@@ -6279,7 +6280,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkOpticalFlowExecuteFlagBi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkOpticalFlowGridSizeFlagBitsNV& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkOpticalFlowGridSizeFlagBitsNV& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_OPTICAL_FLOW_GRID_SIZE_UNKNOWN_NV:
@@ -6303,7 +6304,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkOpticalFlowGridSizeFlagB
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkOpticalFlowPerformanceLevelNV& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkOpticalFlowPerformanceLevelNV& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_OPTICAL_FLOW_PERFORMANCE_LEVEL_UNKNOWN_NV:
@@ -6324,7 +6325,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkOpticalFlowPerformanceLe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkOpticalFlowSessionBindingPointNV& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkOpticalFlowSessionBindingPointNV& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_OPTICAL_FLOW_SESSION_BINDING_POINT_UNKNOWN_NV:
@@ -6360,7 +6361,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkOpticalFlowSessionBindin
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkOpticalFlowSessionCreateFlagBitsNV& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkOpticalFlowSessionCreateFlagBitsNV& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_OPTICAL_FLOW_SESSION_CREATE_ENABLE_HINT_BIT_NV:
@@ -6384,7 +6385,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkOpticalFlowSessionCreate
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkOpticalFlowUsageFlagBitsNV& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkOpticalFlowUsageFlagBitsNV& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_OPTICAL_FLOW_USAGE_UNKNOWN_NV:
@@ -6411,7 +6412,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkOpticalFlowUsageFlagBits
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkOutOfBandQueueTypeNV& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkOutOfBandQueueTypeNV& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_OUT_OF_BAND_QUEUE_TYPE_RENDER_NV:
@@ -6426,7 +6427,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkOutOfBandQueueTypeNV& va
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPeerMemoryFeatureFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkPeerMemoryFeatureFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PEER_MEMORY_FEATURE_COPY_SRC_BIT:
@@ -6447,7 +6448,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkPeerMemoryFeatureFlagBit
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPerformanceConfigurationTypeINTEL& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkPerformanceConfigurationTypeINTEL& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PERFORMANCE_CONFIGURATION_TYPE_COMMAND_QUEUE_METRICS_DISCOVERY_ACTIVATED_INTEL:
@@ -6459,7 +6460,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkPerformanceConfiguration
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPerformanceCounterDescriptionFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkPerformanceCounterDescriptionFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PERFORMANCE_COUNTER_DESCRIPTION_PERFORMANCE_IMPACTING_BIT_KHR:
@@ -6474,7 +6475,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkPerformanceCounterDescri
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPerformanceCounterScopeKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkPerformanceCounterScopeKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PERFORMANCE_COUNTER_SCOPE_COMMAND_BUFFER_KHR:
@@ -6492,7 +6493,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkPerformanceCounterScopeK
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPerformanceCounterStorageKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkPerformanceCounterStorageKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PERFORMANCE_COUNTER_STORAGE_INT32_KHR:
@@ -6519,7 +6520,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkPerformanceCounterStorag
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPerformanceCounterUnitKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkPerformanceCounterUnitKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PERFORMANCE_COUNTER_UNIT_GENERIC_KHR:
@@ -6561,7 +6562,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkPerformanceCounterUnitKH
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPerformanceOverrideTypeINTEL& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkPerformanceOverrideTypeINTEL& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PERFORMANCE_OVERRIDE_TYPE_NULL_HARDWARE_INTEL:
@@ -6576,7 +6577,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkPerformanceOverrideTypeI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPerformanceParameterTypeINTEL& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkPerformanceParameterTypeINTEL& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PERFORMANCE_PARAMETER_TYPE_HW_COUNTERS_SUPPORTED_INTEL:
@@ -6591,7 +6592,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkPerformanceParameterType
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPerformanceValueTypeINTEL& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkPerformanceValueTypeINTEL& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PERFORMANCE_VALUE_TYPE_UINT32_INTEL:
@@ -6615,7 +6616,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkPerformanceValueTypeINTE
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPhysicalDeviceLayeredApiKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkPhysicalDeviceLayeredApiKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PHYSICAL_DEVICE_LAYERED_API_VULKAN_KHR:
@@ -6639,7 +6640,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkPhysicalDeviceLayeredApi
     }
 }
 
-void FieldToJson(VkPhysicalDeviceSchedulingControlsFlagBitsARM_t, nlohmann::ordered_json& jdata, const VkPhysicalDeviceSchedulingControlsFlagBitsARM& value, const JsonOptions& options)
+void FieldToJson(VkPhysicalDeviceSchedulingControlsFlagBitsARM_t, JsonValue& jdata, const VkPhysicalDeviceSchedulingControlsFlagBitsARM& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PHYSICAL_DEVICE_SCHEDULING_CONTROLS_SHADER_CORE_COUNT_ARM:
@@ -6651,7 +6652,7 @@ void FieldToJson(VkPhysicalDeviceSchedulingControlsFlagBitsARM_t, nlohmann::orde
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPhysicalDeviceType& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkPhysicalDeviceType& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PHYSICAL_DEVICE_TYPE_OTHER:
@@ -6675,7 +6676,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkPhysicalDeviceType& valu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineBindPoint& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkPipelineBindPoint& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PIPELINE_BIND_POINT_GRAPHICS:
@@ -6699,7 +6700,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineBindPoint& value
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineCacheCreateFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkPipelineCacheCreateFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PIPELINE_CACHE_CREATE_EXTERNALLY_SYNCHRONIZED_BIT:
@@ -6711,7 +6712,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineCacheCreateFlagB
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineCacheHeaderVersion& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkPipelineCacheHeaderVersion& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PIPELINE_CACHE_HEADER_VERSION_ONE:
@@ -6723,7 +6724,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineCacheHeaderVersi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineColorBlendStateCreateFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkPipelineColorBlendStateCreateFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PIPELINE_COLOR_BLEND_STATE_CREATE_RASTERIZATION_ORDER_ATTACHMENT_ACCESS_BIT_EXT:
@@ -6735,12 +6736,12 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineColorBlendStateC
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineCompilerControlFlagBitsAMD& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkPipelineCompilerControlFlagBitsAMD& value, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(value);
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineCreateFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkPipelineCreateFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT:
@@ -6842,7 +6843,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineCreateFlagBits&
     }
 }
 
-void FieldToJson(VkPipelineCreateFlagBits2KHR_t, nlohmann::ordered_json& jdata, const VkPipelineCreateFlagBits2KHR& value, const JsonOptions& options)
+void FieldToJson(VkPipelineCreateFlagBits2KHR_t, JsonValue& jdata, const VkPipelineCreateFlagBits2KHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PIPELINE_CREATE_2_DISABLE_OPTIMIZATION_BIT_KHR:
@@ -6953,7 +6954,7 @@ void FieldToJson(VkPipelineCreateFlagBits2KHR_t, nlohmann::ordered_json& jdata,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineCreationFeedbackFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkPipelineCreationFeedbackFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT:
@@ -6971,7 +6972,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineCreationFeedback
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineDepthStencilStateCreateFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkPipelineDepthStencilStateCreateFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PIPELINE_DEPTH_STENCIL_STATE_CREATE_RASTERIZATION_ORDER_ATTACHMENT_DEPTH_ACCESS_BIT_EXT:
@@ -6986,7 +6987,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineDepthStencilStat
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineExecutableStatisticFormatKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkPipelineExecutableStatisticFormatKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PIPELINE_EXECUTABLE_STATISTIC_FORMAT_BOOL32_KHR:
@@ -7007,7 +7008,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineExecutableStatis
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineLayoutCreateFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkPipelineLayoutCreateFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PIPELINE_LAYOUT_CREATE_INDEPENDENT_SETS_BIT_EXT:
@@ -7019,7 +7020,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineLayoutCreateFlag
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineRobustnessBufferBehaviorEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkPipelineRobustnessBufferBehaviorEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PIPELINE_ROBUSTNESS_BUFFER_BEHAVIOR_DEVICE_DEFAULT_EXT:
@@ -7040,7 +7041,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineRobustnessBuffer
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineRobustnessImageBehaviorEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkPipelineRobustnessImageBehaviorEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PIPELINE_ROBUSTNESS_IMAGE_BEHAVIOR_DEVICE_DEFAULT_EXT:
@@ -7061,7 +7062,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineRobustnessImageB
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineShaderStageCreateFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkPipelineShaderStageCreateFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PIPELINE_SHADER_STAGE_CREATE_ALLOW_VARYING_SUBGROUP_SIZE_BIT:
@@ -7076,7 +7077,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineShaderStageCreat
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineStageFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkPipelineStageFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT:
@@ -7166,7 +7167,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineStageFlagBits& v
     }
 }
 
-void FieldToJson(VkPipelineStageFlagBits2_t, nlohmann::ordered_json& jdata, const VkPipelineStageFlagBits2& value, const JsonOptions& options)
+void FieldToJson(VkPipelineStageFlagBits2_t, JsonValue& jdata, const VkPipelineStageFlagBits2& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PIPELINE_STAGE_2_NONE:
@@ -7301,7 +7302,7 @@ void FieldToJson(VkPipelineStageFlagBits2_t, nlohmann::ordered_json& jdata, cons
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPointClippingBehavior& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkPointClippingBehavior& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_POINT_CLIPPING_BEHAVIOR_ALL_CLIP_PLANES:
@@ -7316,7 +7317,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkPointClippingBehavior& v
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPolygonMode& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkPolygonMode& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_POLYGON_MODE_FILL:
@@ -7337,7 +7338,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkPolygonMode& value, cons
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPresentGravityFlagBitsEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkPresentGravityFlagBitsEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PRESENT_GRAVITY_MIN_BIT_EXT:
@@ -7355,7 +7356,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkPresentGravityFlagBitsEX
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPresentModeKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkPresentModeKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PRESENT_MODE_IMMEDIATE_KHR:
@@ -7382,7 +7383,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkPresentModeKHR& value, c
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPresentScalingFlagBitsEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkPresentScalingFlagBitsEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PRESENT_SCALING_ONE_TO_ONE_BIT_EXT:
@@ -7400,7 +7401,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkPresentScalingFlagBitsEX
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPrimitiveTopology& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkPrimitiveTopology& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PRIMITIVE_TOPOLOGY_POINT_LIST:
@@ -7442,7 +7443,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkPrimitiveTopology& value
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkProvokingVertexModeEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkProvokingVertexModeEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_PROVOKING_VERTEX_MODE_FIRST_VERTEX_EXT:
@@ -7457,7 +7458,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkProvokingVertexModeEXT&
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkQueryControlFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkQueryControlFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_QUERY_CONTROL_PRECISE_BIT:
@@ -7469,7 +7470,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkQueryControlFlagBits& va
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkQueryPipelineStatisticFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkQueryPipelineStatisticFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_VERTICES_BIT:
@@ -7520,7 +7521,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkQueryPipelineStatisticFl
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkQueryPoolSamplingModeINTEL& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkQueryPoolSamplingModeINTEL& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_QUERY_POOL_SAMPLING_MODE_MANUAL_INTEL:
@@ -7532,7 +7533,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkQueryPoolSamplingModeINT
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkQueryResultFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkQueryResultFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_QUERY_RESULT_64_BIT:
@@ -7556,7 +7557,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkQueryResultFlagBits& val
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkQueryResultStatusKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkQueryResultStatusKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_QUERY_RESULT_STATUS_ERROR_KHR:
@@ -7577,7 +7578,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkQueryResultStatusKHR& va
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkQueryType& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkQueryType& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_QUERY_TYPE_OCCLUSION:
@@ -7637,7 +7638,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkQueryType& value, const
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkQueueFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkQueueFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_QUEUE_GRAPHICS_BIT:
@@ -7670,7 +7671,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkQueueFlagBits& value, co
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkQueueGlobalPriorityKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkQueueGlobalPriorityKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_QUEUE_GLOBAL_PRIORITY_LOW_KHR:
@@ -7691,7 +7692,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkQueueGlobalPriorityKHR&
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkRasterizationOrderAMD& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkRasterizationOrderAMD& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_RASTERIZATION_ORDER_STRICT_AMD:
@@ -7706,7 +7707,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkRasterizationOrderAMD& v
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkRayTracingInvocationReorderModeNV& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkRayTracingInvocationReorderModeNV& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_RAY_TRACING_INVOCATION_REORDER_MODE_NONE_NV:
@@ -7721,7 +7722,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkRayTracingInvocationReor
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkRayTracingShaderGroupTypeKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkRayTracingShaderGroupTypeKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_RAY_TRACING_SHADER_GROUP_TYPE_GENERAL_KHR:
@@ -7739,7 +7740,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkRayTracingShaderGroupTyp
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkRenderPassCreateFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkRenderPassCreateFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_RENDER_PASS_CREATE_TRANSFORM_BIT_QCOM:
@@ -7751,7 +7752,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkRenderPassCreateFlagBits
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkRenderingFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkRenderingFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT:
@@ -7775,7 +7776,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkRenderingFlagBits& value
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkResolveModeFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkResolveModeFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_RESOLVE_MODE_NONE:
@@ -7802,7 +7803,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkResolveModeFlagBits& val
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkResult& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkResult& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_SUCCESS:
@@ -7958,7 +7959,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkResult& value, const Jso
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSampleCountFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkSampleCountFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_SAMPLE_COUNT_1_BIT:
@@ -7988,7 +7989,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkSampleCountFlagBits& val
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSamplerAddressMode& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkSamplerAddressMode& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_SAMPLER_ADDRESS_MODE_REPEAT:
@@ -8012,7 +8013,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkSamplerAddressMode& valu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSamplerCreateFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkSamplerCreateFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_SAMPLER_CREATE_SUBSAMPLED_BIT_EXT:
@@ -8036,7 +8037,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkSamplerCreateFlagBits& v
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSamplerMipmapMode& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkSamplerMipmapMode& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_SAMPLER_MIPMAP_MODE_NEAREST:
@@ -8051,7 +8052,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkSamplerMipmapMode& value
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSamplerReductionMode& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkSamplerReductionMode& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_SAMPLER_REDUCTION_MODE_WEIGHTED_AVERAGE:
@@ -8072,7 +8073,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkSamplerReductionMode& va
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSamplerYcbcrModelConversion& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkSamplerYcbcrModelConversion& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_SAMPLER_YCBCR_MODEL_CONVERSION_RGB_IDENTITY:
@@ -8096,7 +8097,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkSamplerYcbcrModelConvers
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSamplerYcbcrRange& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkSamplerYcbcrRange& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_SAMPLER_YCBCR_RANGE_ITU_FULL:
@@ -8111,7 +8112,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkSamplerYcbcrRange& value
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkScopeKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkScopeKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_SCOPE_DEVICE_KHR:
@@ -8132,7 +8133,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkScopeKHR& value, const J
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSemaphoreImportFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkSemaphoreImportFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_SEMAPHORE_IMPORT_TEMPORARY_BIT:
@@ -8144,7 +8145,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkSemaphoreImportFlagBits&
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSemaphoreType& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkSemaphoreType& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_SEMAPHORE_TYPE_BINARY:
@@ -8159,7 +8160,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkSemaphoreType& value, co
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSemaphoreWaitFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkSemaphoreWaitFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_SEMAPHORE_WAIT_ANY_BIT:
@@ -8171,7 +8172,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkSemaphoreWaitFlagBits& v
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkShaderCodeTypeEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkShaderCodeTypeEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_SHADER_CODE_TYPE_BINARY_EXT:
@@ -8186,12 +8187,12 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkShaderCodeTypeEXT& value
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkShaderCorePropertiesFlagBitsAMD& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkShaderCorePropertiesFlagBitsAMD& value, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(value);
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkShaderCreateFlagBitsEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkShaderCreateFlagBitsEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_SHADER_CREATE_LINK_STAGE_BIT_EXT:
@@ -8224,7 +8225,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkShaderCreateFlagBitsEXT&
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkShaderFloatControlsIndependence& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkShaderFloatControlsIndependence& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_32_BIT_ONLY:
@@ -8242,7 +8243,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkShaderFloatControlsIndep
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkShaderGroupShaderKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkShaderGroupShaderKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_SHADER_GROUP_SHADER_GENERAL_KHR:
@@ -8263,7 +8264,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkShaderGroupShaderKHR& va
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkShaderInfoTypeAMD& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkShaderInfoTypeAMD& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_SHADER_INFO_TYPE_STATISTICS_AMD:
@@ -8281,7 +8282,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkShaderInfoTypeAMD& value
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkShaderStageFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkShaderStageFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_SHADER_STAGE_VERTEX_BIT:
@@ -8344,7 +8345,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkShaderStageFlagBits& val
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkShadingRatePaletteEntryNV& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkShadingRatePaletteEntryNV& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_SHADING_RATE_PALETTE_ENTRY_NO_INVOCATIONS_NV:
@@ -8389,7 +8390,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkShadingRatePaletteEntryN
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSharingMode& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkSharingMode& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_SHARING_MODE_EXCLUSIVE:
@@ -8404,7 +8405,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkSharingMode& value, cons
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSparseImageFormatFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkSparseImageFormatFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_SPARSE_IMAGE_FORMAT_SINGLE_MIPTAIL_BIT:
@@ -8422,7 +8423,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkSparseImageFormatFlagBit
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSparseMemoryBindFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkSparseMemoryBindFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_SPARSE_MEMORY_BIND_METADATA_BIT:
@@ -8434,7 +8435,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkSparseMemoryBindFlagBits
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkStencilFaceFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkStencilFaceFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_STENCIL_FACE_FRONT_BIT:
@@ -8452,7 +8453,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkStencilFaceFlagBits& val
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkStencilOp& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkStencilOp& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_STENCIL_OP_KEEP:
@@ -8485,7 +8486,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkStencilOp& value, const
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkStructureType& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkStructureType& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_STRUCTURE_TYPE_APPLICATION_INFO:
@@ -11305,7 +11306,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkStructureType& value, co
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSubgroupFeatureFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkSubgroupFeatureFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_SUBGROUP_FEATURE_BASIC_BIT:
@@ -11347,7 +11348,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkSubgroupFeatureFlagBits&
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSubmitFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkSubmitFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_SUBMIT_PROTECTED_BIT:
@@ -11359,7 +11360,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkSubmitFlagBits& value, c
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSubpassContents& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkSubpassContents& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_SUBPASS_CONTENTS_INLINE:
@@ -11377,7 +11378,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkSubpassContents& value,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSubpassDescriptionFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkSubpassDescriptionFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_SUBPASS_DESCRIPTION_PER_VIEW_ATTRIBUTES_BIT_NVX:
@@ -11410,7 +11411,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkSubpassDescriptionFlagBi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSubpassMergeStatusEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkSubpassMergeStatusEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_SUBPASS_MERGE_STATUS_MERGED_EXT:
@@ -11461,7 +11462,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkSubpassMergeStatusEXT& v
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSurfaceCounterFlagBitsEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkSurfaceCounterFlagBitsEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_SURFACE_COUNTER_VBLANK_BIT_EXT:
@@ -11473,7 +11474,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkSurfaceCounterFlagBitsEX
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSurfaceTransformFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkSurfaceTransformFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR:
@@ -11509,7 +11510,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkSurfaceTransformFlagBits
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSwapchainCreateFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkSwapchainCreateFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_SWAPCHAIN_CREATE_SPLIT_INSTANCE_BIND_REGIONS_BIT_KHR:
@@ -11530,7 +11531,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkSwapchainCreateFlagBitsK
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSystemAllocationScope& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkSystemAllocationScope& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_SYSTEM_ALLOCATION_SCOPE_COMMAND:
@@ -11554,7 +11555,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkSystemAllocationScope& v
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkTessellationDomainOrigin& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkTessellationDomainOrigin& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_TESSELLATION_DOMAIN_ORIGIN_UPPER_LEFT:
@@ -11569,7 +11570,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkTessellationDomainOrigin
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkTimeDomainKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkTimeDomainKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_TIME_DOMAIN_DEVICE_KHR:
@@ -11590,7 +11591,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkTimeDomainKHR& value, co
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkToolPurposeFlagBits& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkToolPurposeFlagBits& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_TOOL_PURPOSE_VALIDATION_BIT:
@@ -11620,7 +11621,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkToolPurposeFlagBits& val
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkValidationCacheHeaderVersionEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkValidationCacheHeaderVersionEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT:
@@ -11632,7 +11633,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkValidationCacheHeaderVer
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkValidationCheckEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkValidationCheckEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_VALIDATION_CHECK_ALL_EXT:
@@ -11647,7 +11648,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkValidationCheckEXT& valu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkValidationFeatureDisableEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkValidationFeatureDisableEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_VALIDATION_FEATURE_DISABLE_ALL_EXT:
@@ -11680,7 +11681,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkValidationFeatureDisable
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkValidationFeatureEnableEXT& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkValidationFeatureEnableEXT& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_VALIDATION_FEATURE_ENABLE_GPU_ASSISTED_EXT:
@@ -11704,7 +11705,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkValidationFeatureEnableE
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVendorId& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkVendorId& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_VENDOR_ID_KHRONOS:
@@ -11737,7 +11738,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkVendorId& value, const J
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVertexInputRate& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkVertexInputRate& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_VERTEX_INPUT_RATE_VERTEX:
@@ -11752,7 +11753,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkVertexInputRate& value,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoCapabilityFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkVideoCapabilityFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_VIDEO_CAPABILITY_PROTECTED_CONTENT_BIT_KHR:
@@ -11767,7 +11768,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoCapabilityFlagBitsK
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoChromaSubsamplingFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkVideoChromaSubsamplingFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_VIDEO_CHROMA_SUBSAMPLING_INVALID_KHR:
@@ -11791,7 +11792,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoChromaSubsamplingFl
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoCodecOperationFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkVideoCodecOperationFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_VIDEO_CODEC_OPERATION_NONE_KHR:
@@ -11818,7 +11819,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoCodecOperationFlagB
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoCodingControlFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkVideoCodingControlFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_VIDEO_CODING_CONTROL_RESET_BIT_KHR:
@@ -11836,7 +11837,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoCodingControlFlagBi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoComponentBitDepthFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkVideoComponentBitDepthFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_VIDEO_COMPONENT_BIT_DEPTH_INVALID_KHR:
@@ -11857,7 +11858,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoComponentBitDepthFl
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoDecodeCapabilityFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkVideoDecodeCapabilityFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_VIDEO_DECODE_CAPABILITY_DPB_AND_OUTPUT_COINCIDE_BIT_KHR:
@@ -11872,7 +11873,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoDecodeCapabilityFla
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoDecodeH264PictureLayoutFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkVideoDecodeH264PictureLayoutFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_VIDEO_DECODE_H264_PICTURE_LAYOUT_PROGRESSIVE_KHR:
@@ -11890,7 +11891,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoDecodeH264PictureLa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoDecodeUsageFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkVideoDecodeUsageFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_VIDEO_DECODE_USAGE_DEFAULT_KHR:
@@ -11911,7 +11912,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoDecodeUsageFlagBits
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeCapabilityFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkVideoEncodeCapabilityFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_VIDEO_ENCODE_CAPABILITY_PRECEDING_EXTERNALLY_ENCODED_BYTES_BIT_KHR:
@@ -11926,7 +11927,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeCapabilityFla
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeContentFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkVideoEncodeContentFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_VIDEO_ENCODE_CONTENT_DEFAULT_KHR:
@@ -11947,7 +11948,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeContentFlagBi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeFeedbackFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkVideoEncodeFeedbackFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_VIDEO_ENCODE_FEEDBACK_BITSTREAM_BUFFER_OFFSET_BIT_KHR:
@@ -11965,7 +11966,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeFeedbackFlagB
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeH264CapabilityFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkVideoEncodeH264CapabilityFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_VIDEO_ENCODE_H264_CAPABILITY_HRD_COMPLIANCE_BIT_KHR:
@@ -12001,7 +12002,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeH264Capabilit
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeH264RateControlFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkVideoEncodeH264RateControlFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_VIDEO_ENCODE_H264_RATE_CONTROL_ATTEMPT_HRD_COMPLIANCE_BIT_KHR:
@@ -12025,7 +12026,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeH264RateContr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeH264StdFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkVideoEncodeH264StdFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_VIDEO_ENCODE_H264_STD_SEPARATE_COLOR_PLANE_FLAG_SET_BIT_KHR:
@@ -12094,7 +12095,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeH264StdFlagBi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeH265CapabilityFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkVideoEncodeH265CapabilityFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_VIDEO_ENCODE_H265_CAPABILITY_HRD_COMPLIANCE_BIT_KHR:
@@ -12133,7 +12134,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeH265Capabilit
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeH265CtbSizeFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkVideoEncodeH265CtbSizeFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_VIDEO_ENCODE_H265_CTB_SIZE_16_BIT_KHR:
@@ -12151,7 +12152,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeH265CtbSizeFl
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeH265RateControlFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkVideoEncodeH265RateControlFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_VIDEO_ENCODE_H265_RATE_CONTROL_ATTEMPT_HRD_COMPLIANCE_BIT_KHR:
@@ -12175,7 +12176,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeH265RateContr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeH265StdFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkVideoEncodeH265StdFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_VIDEO_ENCODE_H265_STD_SEPARATE_COLOR_PLANE_FLAG_SET_BIT_KHR:
@@ -12247,7 +12248,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeH265StdFlagBi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeH265TransformBlockSizeFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkVideoEncodeH265TransformBlockSizeFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_VIDEO_ENCODE_H265_TRANSFORM_BLOCK_SIZE_4_BIT_KHR:
@@ -12268,7 +12269,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeH265Transform
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeRateControlModeFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkVideoEncodeRateControlModeFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_VIDEO_ENCODE_RATE_CONTROL_MODE_DEFAULT_KHR:
@@ -12289,7 +12290,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeRateControlMo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeTuningModeKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkVideoEncodeTuningModeKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_VIDEO_ENCODE_TUNING_MODE_DEFAULT_KHR:
@@ -12313,7 +12314,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeTuningModeKHR
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeUsageFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkVideoEncodeUsageFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_VIDEO_ENCODE_USAGE_DEFAULT_KHR:
@@ -12337,7 +12338,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeUsageFlagBits
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoSessionCreateFlagBitsKHR& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkVideoSessionCreateFlagBitsKHR& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_VIDEO_SESSION_CREATE_PROTECTED_CONTENT_BIT_KHR:
@@ -12355,7 +12356,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoSessionCreateFlagBi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const VkViewportCoordinateSwizzleNV& value, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const VkViewportCoordinateSwizzleNV& value, const JsonOptions& options)
 {
     switch (value) {
         case VK_VIEWPORT_COORDINATE_SWIZZLE_POSITIVE_X_NV:
@@ -12388,7 +12389,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const VkViewportCoordinateSwizzl
     }
 }
 
-void FieldToJson(VkAccelerationStructureCreateFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkAccelerationStructureCreateFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -12410,17 +12411,17 @@ void FieldToJson(VkAccelerationStructureCreateFlagsKHR_t, nlohmann::ordered_json
     });
 }
 
-void FieldToJson(VkAccelerationStructureMotionInfoFlagsNV_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkAccelerationStructureMotionInfoFlagsNV_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkAccelerationStructureMotionInstanceFlagsNV_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkAccelerationStructureMotionInstanceFlagsNV_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkAccessFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkAccessFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -12494,7 +12495,7 @@ void FieldToJson(VkAccessFlags_t, nlohmann::ordered_json& jdata, const VkFlags f
     });
 }
 
-void FieldToJson(VkAccessFlags2_t, nlohmann::ordered_json& jdata, const VkFlags64 flags, const JsonOptions& options)
+void FieldToJson(VkAccessFlags2_t, JsonValue& jdata, const VkFlags64 flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -12596,17 +12597,17 @@ void FieldToJson(VkAccessFlags2_t, nlohmann::ordered_json& jdata, const VkFlags6
     });
 }
 
-void FieldToJson(VkAcquireProfilingLockFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkAcquireProfilingLockFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkAndroidSurfaceCreateFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkAndroidSurfaceCreateFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkAttachmentDescriptionFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkAttachmentDescriptionFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -12624,7 +12625,7 @@ void FieldToJson(VkAttachmentDescriptionFlags_t, nlohmann::ordered_json& jdata,
     });
 }
 
-void FieldToJson(VkBufferCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkBufferCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -12654,7 +12655,7 @@ void FieldToJson(VkBufferCreateFlags_t, nlohmann::ordered_json& jdata, const VkF
     });
 }
 
-void FieldToJson(VkBufferUsageFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkBufferUsageFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -12722,7 +12723,7 @@ void FieldToJson(VkBufferUsageFlags_t, nlohmann::ordered_json& jdata, const VkFl
     });
 }
 
-void FieldToJson(VkBufferUsageFlags2KHR_t, nlohmann::ordered_json& jdata, const VkFlags64 flags, const JsonOptions& options)
+void FieldToJson(VkBufferUsageFlags2KHR_t, JsonValue& jdata, const VkFlags64 flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -12792,12 +12793,12 @@ void FieldToJson(VkBufferUsageFlags2KHR_t, nlohmann::ordered_json& jdata, const
     });
 }
 
-void FieldToJson(VkBufferViewCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkBufferViewCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkBuildAccelerationStructureFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkBuildAccelerationStructureFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -12835,7 +12836,7 @@ void FieldToJson(VkBuildAccelerationStructureFlagsKHR_t, nlohmann::ordered_json&
     });
 }
 
-void FieldToJson(VkBuildMicromapFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkBuildMicromapFlagsEXT_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -12857,7 +12858,7 @@ void FieldToJson(VkBuildMicromapFlagsEXT_t, nlohmann::ordered_json& jdata, const
     });
 }
 
-void FieldToJson(VkColorComponentFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkColorComponentFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -12881,7 +12882,7 @@ void FieldToJson(VkColorComponentFlags_t, nlohmann::ordered_json& jdata, const V
     });
 }
 
-void FieldToJson(VkCommandBufferResetFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkCommandBufferResetFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -12899,7 +12900,7 @@ void FieldToJson(VkCommandBufferResetFlags_t, nlohmann::ordered_json& jdata, con
     });
 }
 
-void FieldToJson(VkCommandBufferUsageFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkCommandBufferUsageFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -12921,7 +12922,7 @@ void FieldToJson(VkCommandBufferUsageFlags_t, nlohmann::ordered_json& jdata, con
     });
 }
 
-void FieldToJson(VkCommandPoolCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkCommandPoolCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -12943,7 +12944,7 @@ void FieldToJson(VkCommandPoolCreateFlags_t, nlohmann::ordered_json& jdata, cons
     });
 }
 
-void FieldToJson(VkCommandPoolResetFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkCommandPoolResetFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -12961,12 +12962,12 @@ void FieldToJson(VkCommandPoolResetFlags_t, nlohmann::ordered_json& jdata, const
     });
 }
 
-void FieldToJson(VkCommandPoolTrimFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkCommandPoolTrimFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkCompositeAlphaFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkCompositeAlphaFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -12990,7 +12991,7 @@ void FieldToJson(VkCompositeAlphaFlagsKHR_t, nlohmann::ordered_json& jdata, cons
     });
 }
 
-void FieldToJson(VkConditionalRenderingFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkConditionalRenderingFlagsEXT_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13008,7 +13009,7 @@ void FieldToJson(VkConditionalRenderingFlagsEXT_t, nlohmann::ordered_json& jdata
     });
 }
 
-void FieldToJson(VkCullModeFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkCullModeFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13032,7 +13033,7 @@ void FieldToJson(VkCullModeFlags_t, nlohmann::ordered_json& jdata, const VkFlags
     });
 }
 
-void FieldToJson(VkDebugReportFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkDebugReportFlagsEXT_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13058,7 +13059,7 @@ void FieldToJson(VkDebugReportFlagsEXT_t, nlohmann::ordered_json& jdata, const V
     });
 }
 
-void FieldToJson(VkDebugUtilsMessageSeverityFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkDebugUtilsMessageSeverityFlagsEXT_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13082,7 +13083,7 @@ void FieldToJson(VkDebugUtilsMessageSeverityFlagsEXT_t, nlohmann::ordered_json&
     });
 }
 
-void FieldToJson(VkDebugUtilsMessageTypeFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkDebugUtilsMessageTypeFlagsEXT_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13106,17 +13107,17 @@ void FieldToJson(VkDebugUtilsMessageTypeFlagsEXT_t, nlohmann::ordered_json& jdat
     });
 }
 
-void FieldToJson(VkDebugUtilsMessengerCallbackDataFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkDebugUtilsMessengerCallbackDataFlagsEXT_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkDebugUtilsMessengerCreateFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkDebugUtilsMessengerCreateFlagsEXT_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkDependencyFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkDependencyFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13140,7 +13141,7 @@ void FieldToJson(VkDependencyFlags_t, nlohmann::ordered_json& jdata, const VkFla
     });
 }
 
-void FieldToJson(VkDescriptorBindingFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkDescriptorBindingFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13164,7 +13165,7 @@ void FieldToJson(VkDescriptorBindingFlags_t, nlohmann::ordered_json& jdata, cons
     });
 }
 
-void FieldToJson(VkDescriptorPoolCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkDescriptorPoolCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13190,12 +13191,12 @@ void FieldToJson(VkDescriptorPoolCreateFlags_t, nlohmann::ordered_json& jdata, c
     });
 }
 
-void FieldToJson(VkDescriptorPoolResetFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkDescriptorPoolResetFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkDescriptorSetLayoutCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkDescriptorSetLayoutCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13225,12 +13226,12 @@ void FieldToJson(VkDescriptorSetLayoutCreateFlags_t, nlohmann::ordered_json& jda
     });
 }
 
-void FieldToJson(VkDescriptorUpdateTemplateCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkDescriptorUpdateTemplateCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkDeviceAddressBindingFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkDeviceAddressBindingFlagsEXT_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13248,12 +13249,12 @@ void FieldToJson(VkDeviceAddressBindingFlagsEXT_t, nlohmann::ordered_json& jdata
     });
 }
 
-void FieldToJson(VkDeviceCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkDeviceCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkDeviceDiagnosticsConfigFlagsNV_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkDeviceDiagnosticsConfigFlagsNV_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13277,7 +13278,7 @@ void FieldToJson(VkDeviceDiagnosticsConfigFlagsNV_t, nlohmann::ordered_json& jda
     });
 }
 
-void FieldToJson(VkDeviceGroupPresentModeFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkDeviceGroupPresentModeFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13301,12 +13302,12 @@ void FieldToJson(VkDeviceGroupPresentModeFlagsKHR_t, nlohmann::ordered_json& jda
     });
 }
 
-void FieldToJson(VkDeviceMemoryReportFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkDeviceMemoryReportFlagsEXT_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkDeviceQueueCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkDeviceQueueCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13324,22 +13325,22 @@ void FieldToJson(VkDeviceQueueCreateFlags_t, nlohmann::ordered_json& jdata, cons
     });
 }
 
-void FieldToJson(VkDirectDriverLoadingFlagsLUNARG_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkDirectDriverLoadingFlagsLUNARG_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkDirectFBSurfaceCreateFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkDirectFBSurfaceCreateFlagsEXT_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkDisplayModeCreateFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkDisplayModeCreateFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkDisplayPlaneAlphaFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkDisplayPlaneAlphaFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13363,12 +13364,12 @@ void FieldToJson(VkDisplayPlaneAlphaFlagsKHR_t, nlohmann::ordered_json& jdata, c
     });
 }
 
-void FieldToJson(VkDisplaySurfaceCreateFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkDisplaySurfaceCreateFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkEventCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkEventCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13386,7 +13387,7 @@ void FieldToJson(VkEventCreateFlags_t, nlohmann::ordered_json& jdata, const VkFl
     });
 }
 
-void FieldToJson(VkExternalFenceFeatureFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkExternalFenceFeatureFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13406,7 +13407,7 @@ void FieldToJson(VkExternalFenceFeatureFlags_t, nlohmann::ordered_json& jdata, c
     });
 }
 
-void FieldToJson(VkExternalFenceHandleTypeFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkExternalFenceHandleTypeFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13430,7 +13431,7 @@ void FieldToJson(VkExternalFenceHandleTypeFlags_t, nlohmann::ordered_json& jdata
     });
 }
 
-void FieldToJson(VkExternalMemoryFeatureFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkExternalMemoryFeatureFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13452,7 +13453,7 @@ void FieldToJson(VkExternalMemoryFeatureFlags_t, nlohmann::ordered_json& jdata,
     });
 }
 
-void FieldToJson(VkExternalMemoryFeatureFlagsNV_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkExternalMemoryFeatureFlagsNV_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13474,7 +13475,7 @@ void FieldToJson(VkExternalMemoryFeatureFlagsNV_t, nlohmann::ordered_json& jdata
     });
 }
 
-void FieldToJson(VkExternalMemoryHandleTypeFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkExternalMemoryHandleTypeFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13518,7 +13519,7 @@ void FieldToJson(VkExternalMemoryHandleTypeFlags_t, nlohmann::ordered_json& jdat
     });
 }
 
-void FieldToJson(VkExternalMemoryHandleTypeFlagsNV_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkExternalMemoryHandleTypeFlagsNV_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13542,7 +13543,7 @@ void FieldToJson(VkExternalMemoryHandleTypeFlagsNV_t, nlohmann::ordered_json& jd
     });
 }
 
-void FieldToJson(VkExternalSemaphoreFeatureFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkExternalSemaphoreFeatureFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13562,7 +13563,7 @@ void FieldToJson(VkExternalSemaphoreFeatureFlags_t, nlohmann::ordered_json& jdat
     });
 }
 
-void FieldToJson(VkExternalSemaphoreHandleTypeFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkExternalSemaphoreHandleTypeFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13590,7 +13591,7 @@ void FieldToJson(VkExternalSemaphoreHandleTypeFlags_t, nlohmann::ordered_json& j
     });
 }
 
-void FieldToJson(VkFenceCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkFenceCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13608,7 +13609,7 @@ void FieldToJson(VkFenceCreateFlags_t, nlohmann::ordered_json& jdata, const VkFl
     });
 }
 
-void FieldToJson(VkFenceImportFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkFenceImportFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13626,7 +13627,7 @@ void FieldToJson(VkFenceImportFlags_t, nlohmann::ordered_json& jdata, const VkFl
     });
 }
 
-void FieldToJson(VkFormatFeatureFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkFormatFeatureFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13704,7 +13705,7 @@ void FieldToJson(VkFormatFeatureFlags_t, nlohmann::ordered_json& jdata, const Vk
     });
 }
 
-void FieldToJson(VkFormatFeatureFlags2_t, nlohmann::ordered_json& jdata, const VkFlags64 flags, const JsonOptions& options)
+void FieldToJson(VkFormatFeatureFlags2_t, JsonValue& jdata, const VkFlags64 flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13806,7 +13807,7 @@ void FieldToJson(VkFormatFeatureFlags2_t, nlohmann::ordered_json& jdata, const V
     });
 }
 
-void FieldToJson(VkFrameBoundaryFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkFrameBoundaryFlagsEXT_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13824,7 +13825,7 @@ void FieldToJson(VkFrameBoundaryFlagsEXT_t, nlohmann::ordered_json& jdata, const
     });
 }
 
-void FieldToJson(VkFramebufferCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkFramebufferCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13842,7 +13843,7 @@ void FieldToJson(VkFramebufferCreateFlags_t, nlohmann::ordered_json& jdata, cons
     });
 }
 
-void FieldToJson(VkGeometryFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkGeometryFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13862,7 +13863,7 @@ void FieldToJson(VkGeometryFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFl
     });
 }
 
-void FieldToJson(VkGeometryInstanceFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkGeometryInstanceFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13890,7 +13891,7 @@ void FieldToJson(VkGeometryInstanceFlagsKHR_t, nlohmann::ordered_json& jdata, co
     });
 }
 
-void FieldToJson(VkGraphicsPipelineLibraryFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkGraphicsPipelineLibraryFlagsEXT_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13914,12 +13915,12 @@ void FieldToJson(VkGraphicsPipelineLibraryFlagsEXT_t, nlohmann::ordered_json& jd
     });
 }
 
-void FieldToJson(VkHeadlessSurfaceCreateFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkHeadlessSurfaceCreateFlagsEXT_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkHostImageCopyFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkHostImageCopyFlagsEXT_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13937,12 +13938,12 @@ void FieldToJson(VkHostImageCopyFlagsEXT_t, nlohmann::ordered_json& jdata, const
     });
 }
 
-void FieldToJson(VkIOSSurfaceCreateFlagsMVK_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkIOSSurfaceCreateFlagsMVK_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkImageAspectFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkImageAspectFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -13982,7 +13983,7 @@ void FieldToJson(VkImageAspectFlags_t, nlohmann::ordered_json& jdata, const VkFl
     });
 }
 
-void FieldToJson(VkImageCompressionFixedRateFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkImageCompressionFixedRateFlagsEXT_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -14048,7 +14049,7 @@ void FieldToJson(VkImageCompressionFixedRateFlagsEXT_t, nlohmann::ordered_json&
     });
 }
 
-void FieldToJson(VkImageCompressionFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkImageCompressionFlagsEXT_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -14072,7 +14073,7 @@ void FieldToJson(VkImageCompressionFlagsEXT_t, nlohmann::ordered_json& jdata, co
     });
 }
 
-void FieldToJson(VkImageCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkImageCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -14128,12 +14129,12 @@ void FieldToJson(VkImageCreateFlags_t, nlohmann::ordered_json& jdata, const VkFl
     });
 }
 
-void FieldToJson(VkImagePipeSurfaceCreateFlagsFUCHSIA_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkImagePipeSurfaceCreateFlagsFUCHSIA_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkImageUsageFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkImageUsageFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -14191,7 +14192,7 @@ void FieldToJson(VkImageUsageFlags_t, nlohmann::ordered_json& jdata, const VkFla
     });
 }
 
-void FieldToJson(VkImageViewCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkImageViewCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -14213,7 +14214,7 @@ void FieldToJson(VkImageViewCreateFlags_t, nlohmann::ordered_json& jdata, const
     });
 }
 
-void FieldToJson(VkIndirectCommandsInputModeFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkIndirectCommandsInputModeFlagsEXT_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -14233,7 +14234,7 @@ void FieldToJson(VkIndirectCommandsInputModeFlagsEXT_t, nlohmann::ordered_json&
     });
 }
 
-void FieldToJson(VkIndirectCommandsLayoutUsageFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkIndirectCommandsLayoutUsageFlagsEXT_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -14253,7 +14254,7 @@ void FieldToJson(VkIndirectCommandsLayoutUsageFlagsEXT_t, nlohmann::ordered_json
     });
 }
 
-void FieldToJson(VkIndirectCommandsLayoutUsageFlagsNV_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkIndirectCommandsLayoutUsageFlagsNV_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -14275,7 +14276,7 @@ void FieldToJson(VkIndirectCommandsLayoutUsageFlagsNV_t, nlohmann::ordered_json&
     });
 }
 
-void FieldToJson(VkIndirectStateFlagsNV_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkIndirectStateFlagsNV_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -14293,7 +14294,7 @@ void FieldToJson(VkIndirectStateFlagsNV_t, nlohmann::ordered_json& jdata, const
     });
 }
 
-void FieldToJson(VkInstanceCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkInstanceCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -14311,12 +14312,12 @@ void FieldToJson(VkInstanceCreateFlags_t, nlohmann::ordered_json& jdata, const V
     });
 }
 
-void FieldToJson(VkMacOSSurfaceCreateFlagsMVK_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkMacOSSurfaceCreateFlagsMVK_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkMemoryAllocateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkMemoryAllocateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -14338,7 +14339,7 @@ void FieldToJson(VkMemoryAllocateFlags_t, nlohmann::ordered_json& jdata, const V
     });
 }
 
-void FieldToJson(VkMemoryHeapFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkMemoryHeapFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -14358,7 +14359,7 @@ void FieldToJson(VkMemoryHeapFlags_t, nlohmann::ordered_json& jdata, const VkFla
     });
 }
 
-void FieldToJson(VkMemoryMapFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkMemoryMapFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -14376,7 +14377,7 @@ void FieldToJson(VkMemoryMapFlags_t, nlohmann::ordered_json& jdata, const VkFlag
     });
 }
 
-void FieldToJson(VkMemoryPropertyFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkMemoryPropertyFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -14410,7 +14411,7 @@ void FieldToJson(VkMemoryPropertyFlags_t, nlohmann::ordered_json& jdata, const V
     });
 }
 
-void FieldToJson(VkMemoryUnmapFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkMemoryUnmapFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -14428,12 +14429,12 @@ void FieldToJson(VkMemoryUnmapFlagsKHR_t, nlohmann::ordered_json& jdata, const V
     });
 }
 
-void FieldToJson(VkMetalSurfaceCreateFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkMetalSurfaceCreateFlagsEXT_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkMicromapCreateFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkMicromapCreateFlagsEXT_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -14451,7 +14452,7 @@ void FieldToJson(VkMicromapCreateFlagsEXT_t, nlohmann::ordered_json& jdata, cons
     });
 }
 
-void FieldToJson(VkOpticalFlowExecuteFlagsNV_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkOpticalFlowExecuteFlagsNV_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -14469,7 +14470,7 @@ void FieldToJson(VkOpticalFlowExecuteFlagsNV_t, nlohmann::ordered_json& jdata, c
     });
 }
 
-void FieldToJson(VkOpticalFlowGridSizeFlagsNV_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkOpticalFlowGridSizeFlagsNV_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -14495,7 +14496,7 @@ void FieldToJson(VkOpticalFlowGridSizeFlagsNV_t, nlohmann::ordered_json& jdata,
     });
 }
 
-void FieldToJson(VkOpticalFlowSessionCreateFlagsNV_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkOpticalFlowSessionCreateFlagsNV_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -14521,7 +14522,7 @@ void FieldToJson(VkOpticalFlowSessionCreateFlagsNV_t, nlohmann::ordered_json& jd
     });
 }
 
-void FieldToJson(VkOpticalFlowUsageFlagsNV_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkOpticalFlowUsageFlagsNV_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -14549,7 +14550,7 @@ void FieldToJson(VkOpticalFlowUsageFlagsNV_t, nlohmann::ordered_json& jdata, con
     });
 }
 
-void FieldToJson(VkPeerMemoryFeatureFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkPeerMemoryFeatureFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -14573,7 +14574,7 @@ void FieldToJson(VkPeerMemoryFeatureFlags_t, nlohmann::ordered_json& jdata, cons
     });
 }
 
-void FieldToJson(VkPerformanceCounterDescriptionFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkPerformanceCounterDescriptionFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -14593,7 +14594,7 @@ void FieldToJson(VkPerformanceCounterDescriptionFlagsKHR_t, nlohmann::ordered_js
     });
 }
 
-void FieldToJson(VkPhysicalDeviceSchedulingControlsFlagsARM_t, nlohmann::ordered_json& jdata, const VkFlags64 flags, const JsonOptions& options)
+void FieldToJson(VkPhysicalDeviceSchedulingControlsFlagsARM_t, JsonValue& jdata, const VkFlags64 flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -14611,7 +14612,7 @@ void FieldToJson(VkPhysicalDeviceSchedulingControlsFlagsARM_t, nlohmann::ordered
     });
 }
 
-void FieldToJson(VkPipelineCacheCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkPipelineCacheCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -14629,7 +14630,7 @@ void FieldToJson(VkPipelineCacheCreateFlags_t, nlohmann::ordered_json& jdata, co
     });
 }
 
-void FieldToJson(VkPipelineColorBlendStateCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkPipelineColorBlendStateCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -14647,27 +14648,27 @@ void FieldToJson(VkPipelineColorBlendStateCreateFlags_t, nlohmann::ordered_json&
     });
 }
 
-void FieldToJson(VkPipelineCompilerControlFlagsAMD_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkPipelineCompilerControlFlagsAMD_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkPipelineCoverageModulationStateCreateFlagsNV_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkPipelineCoverageModulationStateCreateFlagsNV_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkPipelineCoverageReductionStateCreateFlagsNV_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkPipelineCoverageReductionStateCreateFlagsNV_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkPipelineCoverageToColorStateCreateFlagsNV_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkPipelineCoverageToColorStateCreateFlagsNV_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkPipelineCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkPipelineCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -14745,7 +14746,7 @@ void FieldToJson(VkPipelineCreateFlags_t, nlohmann::ordered_json& jdata, const V
     });
 }
 
-void FieldToJson(VkPipelineCreateFlags2KHR_t, nlohmann::ordered_json& jdata, const VkFlags64 flags, const JsonOptions& options)
+void FieldToJson(VkPipelineCreateFlags2KHR_t, JsonValue& jdata, const VkFlags64 flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -14829,7 +14830,7 @@ void FieldToJson(VkPipelineCreateFlags2KHR_t, nlohmann::ordered_json& jdata, con
     });
 }
 
-void FieldToJson(VkPipelineCreationFeedbackFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkPipelineCreationFeedbackFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -14851,7 +14852,7 @@ void FieldToJson(VkPipelineCreationFeedbackFlags_t, nlohmann::ordered_json& jdat
     });
 }
 
-void FieldToJson(VkPipelineDepthStencilStateCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkPipelineDepthStencilStateCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -14871,22 +14872,22 @@ void FieldToJson(VkPipelineDepthStencilStateCreateFlags_t, nlohmann::ordered_jso
     });
 }
 
-void FieldToJson(VkPipelineDiscardRectangleStateCreateFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkPipelineDiscardRectangleStateCreateFlagsEXT_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkPipelineDynamicStateCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkPipelineDynamicStateCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkPipelineInputAssemblyStateCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkPipelineInputAssemblyStateCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkPipelineLayoutCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkPipelineLayoutCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -14904,32 +14905,32 @@ void FieldToJson(VkPipelineLayoutCreateFlags_t, nlohmann::ordered_json& jdata, c
     });
 }
 
-void FieldToJson(VkPipelineMultisampleStateCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkPipelineMultisampleStateCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkPipelineRasterizationConservativeStateCreateFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkPipelineRasterizationConservativeStateCreateFlagsEXT_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkPipelineRasterizationDepthClipStateCreateFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkPipelineRasterizationDepthClipStateCreateFlagsEXT_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkPipelineRasterizationStateCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkPipelineRasterizationStateCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkPipelineRasterizationStateStreamCreateFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkPipelineRasterizationStateStreamCreateFlagsEXT_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkPipelineShaderStageCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkPipelineShaderStageCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -14949,7 +14950,7 @@ void FieldToJson(VkPipelineShaderStageCreateFlags_t, nlohmann::ordered_json& jda
     });
 }
 
-void FieldToJson(VkPipelineStageFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkPipelineStageFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15019,7 +15020,7 @@ void FieldToJson(VkPipelineStageFlags_t, nlohmann::ordered_json& jdata, const Vk
     });
 }
 
-void FieldToJson(VkPipelineStageFlags2_t, nlohmann::ordered_json& jdata, const VkFlags64 flags, const JsonOptions& options)
+void FieldToJson(VkPipelineStageFlags2_t, JsonValue& jdata, const VkFlags64 flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15119,27 +15120,27 @@ void FieldToJson(VkPipelineStageFlags2_t, nlohmann::ordered_json& jdata, const V
     });
 }
 
-void FieldToJson(VkPipelineTessellationStateCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkPipelineTessellationStateCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkPipelineVertexInputStateCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkPipelineVertexInputStateCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkPipelineViewportStateCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkPipelineViewportStateCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkPipelineViewportSwizzleStateCreateFlagsNV_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkPipelineViewportSwizzleStateCreateFlagsNV_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkPresentGravityFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkPresentGravityFlagsEXT_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15161,7 +15162,7 @@ void FieldToJson(VkPresentGravityFlagsEXT_t, nlohmann::ordered_json& jdata, cons
     });
 }
 
-void FieldToJson(VkPresentScalingFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkPresentScalingFlagsEXT_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15183,12 +15184,12 @@ void FieldToJson(VkPresentScalingFlagsEXT_t, nlohmann::ordered_json& jdata, cons
     });
 }
 
-void FieldToJson(VkPrivateDataSlotCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkPrivateDataSlotCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkQueryControlFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkQueryControlFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15206,7 +15207,7 @@ void FieldToJson(VkQueryControlFlags_t, nlohmann::ordered_json& jdata, const VkF
     });
 }
 
-void FieldToJson(VkQueryPipelineStatisticFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkQueryPipelineStatisticFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15250,12 +15251,12 @@ void FieldToJson(VkQueryPipelineStatisticFlags_t, nlohmann::ordered_json& jdata,
     });
 }
 
-void FieldToJson(VkQueryPoolCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkQueryPoolCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkQueryResultFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkQueryResultFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15281,7 +15282,7 @@ void FieldToJson(VkQueryResultFlags_t, nlohmann::ordered_json& jdata, const VkFl
     });
 }
 
-void FieldToJson(VkQueueFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkQueueFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15313,7 +15314,7 @@ void FieldToJson(VkQueueFlags_t, nlohmann::ordered_json& jdata, const VkFlags fl
     });
 }
 
-void FieldToJson(VkRenderPassCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkRenderPassCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15331,7 +15332,7 @@ void FieldToJson(VkRenderPassCreateFlags_t, nlohmann::ordered_json& jdata, const
     });
 }
 
-void FieldToJson(VkRenderingFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkRenderingFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15357,7 +15358,7 @@ void FieldToJson(VkRenderingFlags_t, nlohmann::ordered_json& jdata, const VkFlag
     });
 }
 
-void FieldToJson(VkResolveModeFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkResolveModeFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15385,7 +15386,7 @@ void FieldToJson(VkResolveModeFlags_t, nlohmann::ordered_json& jdata, const VkFl
     });
 }
 
-void FieldToJson(VkSampleCountFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkSampleCountFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15415,7 +15416,7 @@ void FieldToJson(VkSampleCountFlags_t, nlohmann::ordered_json& jdata, const VkFl
     });
 }
 
-void FieldToJson(VkSamplerCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkSamplerCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15441,17 +15442,17 @@ void FieldToJson(VkSamplerCreateFlags_t, nlohmann::ordered_json& jdata, const Vk
     });
 }
 
-void FieldToJson(VkScreenSurfaceCreateFlagsQNX_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkScreenSurfaceCreateFlagsQNX_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkSemaphoreCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkSemaphoreCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkSemaphoreImportFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkSemaphoreImportFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15469,7 +15470,7 @@ void FieldToJson(VkSemaphoreImportFlags_t, nlohmann::ordered_json& jdata, const
     });
 }
 
-void FieldToJson(VkSemaphoreWaitFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkSemaphoreWaitFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15487,12 +15488,12 @@ void FieldToJson(VkSemaphoreWaitFlags_t, nlohmann::ordered_json& jdata, const Vk
     });
 }
 
-void FieldToJson(VkShaderCorePropertiesFlagsAMD_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkShaderCorePropertiesFlagsAMD_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkShaderCreateFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkShaderCreateFlagsEXT_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15524,12 +15525,12 @@ void FieldToJson(VkShaderCreateFlagsEXT_t, nlohmann::ordered_json& jdata, const
     });
 }
 
-void FieldToJson(VkShaderModuleCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkShaderModuleCreateFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkShaderStageFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkShaderStageFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15581,7 +15582,7 @@ void FieldToJson(VkShaderStageFlags_t, nlohmann::ordered_json& jdata, const VkFl
     });
 }
 
-void FieldToJson(VkSparseImageFormatFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkSparseImageFormatFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15603,7 +15604,7 @@ void FieldToJson(VkSparseImageFormatFlags_t, nlohmann::ordered_json& jdata, cons
     });
 }
 
-void FieldToJson(VkSparseMemoryBindFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkSparseMemoryBindFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15621,7 +15622,7 @@ void FieldToJson(VkSparseMemoryBindFlags_t, nlohmann::ordered_json& jdata, const
     });
 }
 
-void FieldToJson(VkStencilFaceFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkStencilFaceFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15643,12 +15644,12 @@ void FieldToJson(VkStencilFaceFlags_t, nlohmann::ordered_json& jdata, const VkFl
     });
 }
 
-void FieldToJson(VkStreamDescriptorSurfaceCreateFlagsGGP_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkStreamDescriptorSurfaceCreateFlagsGGP_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkSubgroupFeatureFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkSubgroupFeatureFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15686,7 +15687,7 @@ void FieldToJson(VkSubgroupFeatureFlags_t, nlohmann::ordered_json& jdata, const
     });
 }
 
-void FieldToJson(VkSubmitFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkSubmitFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15704,7 +15705,7 @@ void FieldToJson(VkSubmitFlags_t, nlohmann::ordered_json& jdata, const VkFlags f
     });
 }
 
-void FieldToJson(VkSubpassDescriptionFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkSubpassDescriptionFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15736,7 +15737,7 @@ void FieldToJson(VkSubpassDescriptionFlags_t, nlohmann::ordered_json& jdata, con
     });
 }
 
-void FieldToJson(VkSurfaceCounterFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkSurfaceCounterFlagsEXT_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15754,7 +15755,7 @@ void FieldToJson(VkSurfaceCounterFlagsEXT_t, nlohmann::ordered_json& jdata, cons
     });
 }
 
-void FieldToJson(VkSurfaceTransformFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkSurfaceTransformFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15788,7 +15789,7 @@ void FieldToJson(VkSurfaceTransformFlagsKHR_t, nlohmann::ordered_json& jdata, co
     });
 }
 
-void FieldToJson(VkSwapchainCreateFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkSwapchainCreateFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15812,7 +15813,7 @@ void FieldToJson(VkSwapchainCreateFlagsKHR_t, nlohmann::ordered_json& jdata, con
     });
 }
 
-void FieldToJson(VkToolPurposeFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkToolPurposeFlags_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15842,22 +15843,22 @@ void FieldToJson(VkToolPurposeFlags_t, nlohmann::ordered_json& jdata, const VkFl
     });
 }
 
-void FieldToJson(VkValidationCacheCreateFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkValidationCacheCreateFlagsEXT_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkViSurfaceCreateFlagsNN_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkViSurfaceCreateFlagsNN_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkVideoBeginCodingFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkVideoBeginCodingFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkVideoCapabilityFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkVideoCapabilityFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15877,7 +15878,7 @@ void FieldToJson(VkVideoCapabilityFlagsKHR_t, nlohmann::ordered_json& jdata, con
     });
 }
 
-void FieldToJson(VkVideoChromaSubsamplingFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkVideoChromaSubsamplingFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15903,7 +15904,7 @@ void FieldToJson(VkVideoChromaSubsamplingFlagsKHR_t, nlohmann::ordered_json& jda
     });
 }
 
-void FieldToJson(VkVideoCodecOperationFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkVideoCodecOperationFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15931,7 +15932,7 @@ void FieldToJson(VkVideoCodecOperationFlagsKHR_t, nlohmann::ordered_json& jdata,
     });
 }
 
-void FieldToJson(VkVideoCodingControlFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkVideoCodingControlFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15953,7 +15954,7 @@ void FieldToJson(VkVideoCodingControlFlagsKHR_t, nlohmann::ordered_json& jdata,
     });
 }
 
-void FieldToJson(VkVideoComponentBitDepthFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkVideoComponentBitDepthFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15977,7 +15978,7 @@ void FieldToJson(VkVideoComponentBitDepthFlagsKHR_t, nlohmann::ordered_json& jda
     });
 }
 
-void FieldToJson(VkVideoDecodeCapabilityFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkVideoDecodeCapabilityFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -15997,12 +15998,12 @@ void FieldToJson(VkVideoDecodeCapabilityFlagsKHR_t, nlohmann::ordered_json& jdat
     });
 }
 
-void FieldToJson(VkVideoDecodeFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkVideoDecodeFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkVideoDecodeH264PictureLayoutFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkVideoDecodeH264PictureLayoutFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -16024,7 +16025,7 @@ void FieldToJson(VkVideoDecodeH264PictureLayoutFlagsKHR_t, nlohmann::ordered_jso
     });
 }
 
-void FieldToJson(VkVideoDecodeUsageFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkVideoDecodeUsageFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -16048,7 +16049,7 @@ void FieldToJson(VkVideoDecodeUsageFlagsKHR_t, nlohmann::ordered_json& jdata, co
     });
 }
 
-void FieldToJson(VkVideoEncodeCapabilityFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkVideoEncodeCapabilityFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -16068,7 +16069,7 @@ void FieldToJson(VkVideoEncodeCapabilityFlagsKHR_t, nlohmann::ordered_json& jdat
     });
 }
 
-void FieldToJson(VkVideoEncodeContentFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkVideoEncodeContentFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -16092,7 +16093,7 @@ void FieldToJson(VkVideoEncodeContentFlagsKHR_t, nlohmann::ordered_json& jdata,
     });
 }
 
-void FieldToJson(VkVideoEncodeFeedbackFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkVideoEncodeFeedbackFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -16114,12 +16115,12 @@ void FieldToJson(VkVideoEncodeFeedbackFlagsKHR_t, nlohmann::ordered_json& jdata,
     });
 }
 
-void FieldToJson(VkVideoEncodeFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkVideoEncodeFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkVideoEncodeH264CapabilityFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkVideoEncodeH264CapabilityFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -16153,7 +16154,7 @@ void FieldToJson(VkVideoEncodeH264CapabilityFlagsKHR_t, nlohmann::ordered_json&
     });
 }
 
-void FieldToJson(VkVideoEncodeH264RateControlFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkVideoEncodeH264RateControlFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -16179,7 +16180,7 @@ void FieldToJson(VkVideoEncodeH264RateControlFlagsKHR_t, nlohmann::ordered_json&
     });
 }
 
-void FieldToJson(VkVideoEncodeH264StdFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkVideoEncodeH264StdFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -16235,7 +16236,7 @@ void FieldToJson(VkVideoEncodeH264StdFlagsKHR_t, nlohmann::ordered_json& jdata,
     });
 }
 
-void FieldToJson(VkVideoEncodeH265CapabilityFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkVideoEncodeH265CapabilityFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -16271,7 +16272,7 @@ void FieldToJson(VkVideoEncodeH265CapabilityFlagsKHR_t, nlohmann::ordered_json&
     });
 }
 
-void FieldToJson(VkVideoEncodeH265CtbSizeFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkVideoEncodeH265CtbSizeFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -16293,7 +16294,7 @@ void FieldToJson(VkVideoEncodeH265CtbSizeFlagsKHR_t, nlohmann::ordered_json& jda
     });
 }
 
-void FieldToJson(VkVideoEncodeH265RateControlFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkVideoEncodeH265RateControlFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -16319,7 +16320,7 @@ void FieldToJson(VkVideoEncodeH265RateControlFlagsKHR_t, nlohmann::ordered_json&
     });
 }
 
-void FieldToJson(VkVideoEncodeH265StdFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkVideoEncodeH265StdFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -16377,7 +16378,7 @@ void FieldToJson(VkVideoEncodeH265StdFlagsKHR_t, nlohmann::ordered_json& jdata,
     });
 }
 
-void FieldToJson(VkVideoEncodeH265TransformBlockSizeFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkVideoEncodeH265TransformBlockSizeFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -16401,12 +16402,12 @@ void FieldToJson(VkVideoEncodeH265TransformBlockSizeFlagsKHR_t, nlohmann::ordere
     });
 }
 
-void FieldToJson(VkVideoEncodeRateControlFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkVideoEncodeRateControlFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkVideoEncodeRateControlModeFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkVideoEncodeRateControlModeFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -16430,7 +16431,7 @@ void FieldToJson(VkVideoEncodeRateControlModeFlagsKHR_t, nlohmann::ordered_json&
     });
 }
 
-void FieldToJson(VkVideoEncodeUsageFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkVideoEncodeUsageFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -16456,12 +16457,12 @@ void FieldToJson(VkVideoEncodeUsageFlagsKHR_t, nlohmann::ordered_json& jdata, co
     });
 }
 
-void FieldToJson(VkVideoEndCodingFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkVideoEndCodingFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkVideoSessionCreateFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkVideoSessionCreateFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     if (!options.expand_flags)
     {
@@ -16483,27 +16484,27 @@ void FieldToJson(VkVideoSessionCreateFlagsKHR_t, nlohmann::ordered_json& jdata,
     });
 }
 
-void FieldToJson(VkVideoSessionParametersCreateFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkVideoSessionParametersCreateFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkWaylandSurfaceCreateFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkWaylandSurfaceCreateFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkWin32SurfaceCreateFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkWin32SurfaceCreateFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkXcbSurfaceCreateFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkXcbSurfaceCreateFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
 
-void FieldToJson(VkXlibSurfaceCreateFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const JsonOptions& options)
+void FieldToJson(VkXlibSurfaceCreateFlagsKHR_t, JsonValue& jdata, const VkFlags flags, const JsonOptions& options)
 {
     jdata = to_hex_fixed_width(flags);
 }
@@ -43,6 +43,7 @@ GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
 using util::JsonOptions;
+using util::JsonValue;
 
 void VulkanExportJsonConsumer::Process_vkCreateInstance(
     const ApiCallInfo&                          call_info,
@@ -51,7 +52,7 @@ void VulkanExportJsonConsumer::Process_vkCreateInstance(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkInstance>*           pInstance)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateInstance");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateInstance");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -66,7 +67,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyInstance(
     format::HandleId                            instance,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyInstance");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyInstance");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["instance"], instance, json_options);
@@ -81,7 +82,7 @@ void VulkanExportJsonConsumer::Process_vkEnumeratePhysicalDevices(
     PointerDecoder<uint32_t>*                   pPhysicalDeviceCount,
     HandlePointerDecoder<VkPhysicalDevice>*     pPhysicalDevices)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkEnumeratePhysicalDevices");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkEnumeratePhysicalDevices");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -96,7 +97,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceFeatures(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceFeatures>* pFeatures)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFeatures");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFeatures");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["physicalDevice"], physicalDevice, json_options);
@@ -110,7 +111,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceFormatProperties(
     VkFormat                                    format,
     StructPointerDecoder<Decoded_VkFormatProperties>* pFormatProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFormatProperties");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFormatProperties");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["physicalDevice"], physicalDevice, json_options);
@@ -130,7 +131,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceImageFormatProperties(
     VkImageCreateFlags                          flags,
     StructPointerDecoder<Decoded_VkImageFormatProperties>* pImageFormatProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceImageFormatProperties");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceImageFormatProperties");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -149,7 +150,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceProperties(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceProperties>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceProperties");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceProperties");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["physicalDevice"], physicalDevice, json_options);
@@ -163,7 +164,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceQueueFamilyProperties(
     PointerDecoder<uint32_t>*                   pQueueFamilyPropertyCount,
     StructPointerDecoder<Decoded_VkQueueFamilyProperties>* pQueueFamilyProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceQueueFamilyProperties");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceQueueFamilyProperties");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["physicalDevice"], physicalDevice, json_options);
@@ -177,7 +178,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceMemoryProperties(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceMemoryProperties>* pMemoryProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceMemoryProperties");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceMemoryProperties");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["physicalDevice"], physicalDevice, json_options);
@@ -193,7 +194,7 @@ void VulkanExportJsonConsumer::Process_vkCreateDevice(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDevice>*             pDevice)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDevice");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateDevice");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -209,7 +210,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyDevice(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyDevice");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyDevice");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -224,7 +225,7 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceQueue(
     uint32_t                                    queueIndex,
     HandlePointerDecoder<VkQueue>*              pQueue)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceQueue");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDeviceQueue");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -242,7 +243,7 @@ void VulkanExportJsonConsumer::Process_vkQueueSubmit(
     StructPointerDecoder<Decoded_VkSubmitInfo>* pSubmits,
     format::HandleId                            fence)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueueSubmit");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkQueueSubmit");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameSubmitIndex()], ++submit_index_, json_options);
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
@@ -259,7 +260,7 @@ void VulkanExportJsonConsumer::Process_vkQueueWaitIdle(
     VkResult                                    returnValue,
     format::HandleId                            queue)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueueWaitIdle");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkQueueWaitIdle");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -272,7 +273,7 @@ void VulkanExportJsonConsumer::Process_vkDeviceWaitIdle(
     VkResult                                    returnValue,
     format::HandleId                            device)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDeviceWaitIdle");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDeviceWaitIdle");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -288,7 +289,7 @@ void VulkanExportJsonConsumer::Process_vkAllocateMemory(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDeviceMemory>*       pMemory)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAllocateMemory");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkAllocateMemory");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -305,7 +306,7 @@ void VulkanExportJsonConsumer::Process_vkFreeMemory(
     format::HandleId                            memory,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkFreeMemory");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkFreeMemory");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -324,7 +325,7 @@ void VulkanExportJsonConsumer::Process_vkMapMemory(
     VkMemoryMapFlags                            flags,
     PointerDecoder<uint64_t, void*>*            ppData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkMapMemory");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkMapMemory");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -342,7 +343,7 @@ void VulkanExportJsonConsumer::Process_vkUnmapMemory(
     format::HandleId                            device,
     format::HandleId                            memory)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkUnmapMemory");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkUnmapMemory");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -357,7 +358,7 @@ void VulkanExportJsonConsumer::Process_vkFlushMappedMemoryRanges(
     uint32_t                                    memoryRangeCount,
     StructPointerDecoder<Decoded_VkMappedMemoryRange>* pMemoryRanges)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkFlushMappedMemoryRanges");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkFlushMappedMemoryRanges");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -374,7 +375,7 @@ void VulkanExportJsonConsumer::Process_vkInvalidateMappedMemoryRanges(
     uint32_t                                    memoryRangeCount,
     StructPointerDecoder<Decoded_VkMappedMemoryRange>* pMemoryRanges)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkInvalidateMappedMemoryRanges");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkInvalidateMappedMemoryRanges");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -390,7 +391,7 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceMemoryCommitment(
     format::HandleId                            memory,
     PointerDecoder<VkDeviceSize>*               pCommittedMemoryInBytes)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceMemoryCommitment");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDeviceMemoryCommitment");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -407,7 +408,7 @@ void VulkanExportJsonConsumer::Process_vkBindBufferMemory(
     format::HandleId                            memory,
     VkDeviceSize                                memoryOffset)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBindBufferMemory");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkBindBufferMemory");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -426,7 +427,7 @@ void VulkanExportJsonConsumer::Process_vkBindImageMemory(
     format::HandleId                            memory,
     VkDeviceSize                                memoryOffset)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBindImageMemory");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkBindImageMemory");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -443,7 +444,7 @@ void VulkanExportJsonConsumer::Process_vkGetBufferMemoryRequirements(
     format::HandleId                            buffer,
     StructPointerDecoder<Decoded_VkMemoryRequirements>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetBufferMemoryRequirements");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetBufferMemoryRequirements");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -458,7 +459,7 @@ void VulkanExportJsonConsumer::Process_vkGetImageMemoryRequirements(
     format::HandleId                            image,
     StructPointerDecoder<Decoded_VkMemoryRequirements>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageMemoryRequirements");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetImageMemoryRequirements");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -474,7 +475,7 @@ void VulkanExportJsonConsumer::Process_vkGetImageSparseMemoryRequirements(
     PointerDecoder<uint32_t>*                   pSparseMemoryRequirementCount,
     StructPointerDecoder<Decoded_VkSparseImageMemoryRequirements>* pSparseMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageSparseMemoryRequirements");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetImageSparseMemoryRequirements");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -495,7 +496,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSparseImageFormatPrope
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkSparseImageFormatProperties>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSparseImageFormatProperties");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSparseImageFormatProperties");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["physicalDevice"], physicalDevice, json_options);
@@ -517,7 +518,7 @@ void VulkanExportJsonConsumer::Process_vkQueueBindSparse(
     StructPointerDecoder<Decoded_VkBindSparseInfo>* pBindInfo,
     format::HandleId                            fence)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueueBindSparse");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkQueueBindSparse");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -536,7 +537,7 @@ void VulkanExportJsonConsumer::Process_vkCreateFence(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkFence>*              pFence)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateFence");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateFence");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -553,7 +554,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyFence(
     format::HandleId                            fence,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyFence");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyFence");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -569,7 +570,7 @@ void VulkanExportJsonConsumer::Process_vkResetFences(
     uint32_t                                    fenceCount,
     HandlePointerDecoder<VkFence>*              pFences)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkResetFences");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkResetFences");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -585,7 +586,7 @@ void VulkanExportJsonConsumer::Process_vkGetFenceStatus(
     format::HandleId                            device,
     format::HandleId                            fence)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetFenceStatus");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetFenceStatus");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -603,7 +604,7 @@ void VulkanExportJsonConsumer::Process_vkWaitForFences(
     VkBool32                                    waitAll,
     uint64_t                                    timeout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkWaitForFences");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkWaitForFences");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -623,7 +624,7 @@ void VulkanExportJsonConsumer::Process_vkCreateSemaphore(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSemaphore>*          pSemaphore)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateSemaphore");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateSemaphore");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -640,7 +641,7 @@ void VulkanExportJsonConsumer::Process_vkDestroySemaphore(
     format::HandleId                            semaphore,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroySemaphore");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroySemaphore");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -657,7 +658,7 @@ void VulkanExportJsonConsumer::Process_vkCreateEvent(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkEvent>*              pEvent)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateEvent");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateEvent");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -674,7 +675,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyEvent(
     format::HandleId                            event,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyEvent");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyEvent");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -689,7 +690,7 @@ void VulkanExportJsonConsumer::Process_vkGetEventStatus(
     format::HandleId                            device,
     format::HandleId                            event)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetEventStatus");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetEventStatus");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -704,7 +705,7 @@ void VulkanExportJsonConsumer::Process_vkSetEvent(
     format::HandleId                            device,
     format::HandleId                            event)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSetEvent");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkSetEvent");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -719,7 +720,7 @@ void VulkanExportJsonConsumer::Process_vkResetEvent(
     format::HandleId                            device,
     format::HandleId                            event)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkResetEvent");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkResetEvent");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -736,7 +737,7 @@ void VulkanExportJsonConsumer::Process_vkCreateQueryPool(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkQueryPool>*          pQueryPool)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateQueryPool");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateQueryPool");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -753,7 +754,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyQueryPool(
     format::HandleId                            queryPool,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyQueryPool");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyQueryPool");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -774,7 +775,7 @@ void VulkanExportJsonConsumer::Process_vkGetQueryPoolResults(
     VkDeviceSize                                stride,
     VkQueryResultFlags                          flags)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetQueryPoolResults");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetQueryPoolResults");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -797,7 +798,7 @@ void VulkanExportJsonConsumer::Process_vkCreateBuffer(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkBuffer>*             pBuffer)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateBuffer");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateBuffer");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -814,7 +815,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyBuffer(
     format::HandleId                            buffer,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyBuffer");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyBuffer");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -831,7 +832,7 @@ void VulkanExportJsonConsumer::Process_vkCreateBufferView(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkBufferView>*         pView)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateBufferView");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateBufferView");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -848,7 +849,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyBufferView(
     format::HandleId                            bufferView,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyBufferView");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyBufferView");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -865,7 +866,7 @@ void VulkanExportJsonConsumer::Process_vkCreateImage(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkImage>*              pImage)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateImage");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateImage");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -882,7 +883,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyImage(
     format::HandleId                            image,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyImage");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyImage");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -898,7 +899,7 @@ void VulkanExportJsonConsumer::Process_vkGetImageSubresourceLayout(
     StructPointerDecoder<Decoded_VkImageSubresource>* pSubresource,
     StructPointerDecoder<Decoded_VkSubresourceLayout>* pLayout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageSubresourceLayout");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetImageSubresourceLayout");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -916,7 +917,7 @@ void VulkanExportJsonConsumer::Process_vkCreateImageView(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkImageView>*          pView)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateImageView");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateImageView");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -933,7 +934,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyImageView(
     format::HandleId                            imageView,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyImageView");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyImageView");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -948,7 +949,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyShaderModule(
     format::HandleId                            shaderModule,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyShaderModule");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyShaderModule");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -963,7 +964,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyPipelineCache(
     format::HandleId                            pipelineCache,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyPipelineCache");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyPipelineCache");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -980,7 +981,7 @@ void VulkanExportJsonConsumer::Process_vkMergePipelineCaches(
     uint32_t                                    srcCacheCount,
     HandlePointerDecoder<VkPipelineCache>*      pSrcCaches)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkMergePipelineCaches");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkMergePipelineCaches");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -1001,7 +1002,7 @@ void VulkanExportJsonConsumer::Process_vkCreateGraphicsPipelines(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPipeline>*           pPipelines)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateGraphicsPipelines");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateGraphicsPipelines");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -1024,7 +1025,7 @@ void VulkanExportJsonConsumer::Process_vkCreateComputePipelines(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPipeline>*           pPipelines)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateComputePipelines");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateComputePipelines");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -1043,7 +1044,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyPipeline(
     format::HandleId                            pipeline,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyPipeline");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyPipeline");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -1060,7 +1061,7 @@ void VulkanExportJsonConsumer::Process_vkCreatePipelineLayout(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPipelineLayout>*     pPipelineLayout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreatePipelineLayout");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreatePipelineLayout");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -1077,7 +1078,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyPipelineLayout(
     format::HandleId                            pipelineLayout,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyPipelineLayout");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyPipelineLayout");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -1094,7 +1095,7 @@ void VulkanExportJsonConsumer::Process_vkCreateSampler(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSampler>*            pSampler)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateSampler");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateSampler");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -1111,7 +1112,7 @@ void VulkanExportJsonConsumer::Process_vkDestroySampler(
     format::HandleId                            sampler,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroySampler");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroySampler");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -1128,7 +1129,7 @@ void VulkanExportJsonConsumer::Process_vkCreateDescriptorSetLayout(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDescriptorSetLayout>* pSetLayout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDescriptorSetLayout");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateDescriptorSetLayout");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -1145,7 +1146,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyDescriptorSetLayout(
     format::HandleId                            descriptorSetLayout,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyDescriptorSetLayout");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyDescriptorSetLayout");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -1162,7 +1163,7 @@ void VulkanExportJsonConsumer::Process_vkCreateDescriptorPool(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDescriptorPool>*     pDescriptorPool)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDescriptorPool");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateDescriptorPool");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -1179,7 +1180,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyDescriptorPool(
     format::HandleId                            descriptorPool,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyDescriptorPool");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyDescriptorPool");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -1195,7 +1196,7 @@ void VulkanExportJsonConsumer::Process_vkResetDescriptorPool(
     format::HandleId                            descriptorPool,
     VkDescriptorPoolResetFlags                  flags)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkResetDescriptorPool");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkResetDescriptorPool");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -1212,7 +1213,7 @@ void VulkanExportJsonConsumer::Process_vkAllocateDescriptorSets(
     StructPointerDecoder<Decoded_VkDescriptorSetAllocateInfo>* pAllocateInfo,
     HandlePointerDecoder<VkDescriptorSet>*      pDescriptorSets)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAllocateDescriptorSets");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkAllocateDescriptorSets");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -1230,7 +1231,7 @@ void VulkanExportJsonConsumer::Process_vkFreeDescriptorSets(
     uint32_t                                    descriptorSetCount,
     HandlePointerDecoder<VkDescriptorSet>*      pDescriptorSets)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkFreeDescriptorSets");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkFreeDescriptorSets");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -1249,7 +1250,7 @@ void VulkanExportJsonConsumer::Process_vkUpdateDescriptorSets(
     uint32_t                                    descriptorCopyCount,
     StructPointerDecoder<Decoded_VkCopyDescriptorSet>* pDescriptorCopies)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkUpdateDescriptorSets");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkUpdateDescriptorSets");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -1268,7 +1269,7 @@ void VulkanExportJsonConsumer::Process_vkCreateFramebuffer(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkFramebuffer>*        pFramebuffer)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateFramebuffer");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateFramebuffer");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -1285,7 +1286,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyFramebuffer(
     format::HandleId                            framebuffer,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyFramebuffer");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyFramebuffer");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -1302,7 +1303,7 @@ void VulkanExportJsonConsumer::Process_vkCreateRenderPass(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkRenderPass>*         pRenderPass)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateRenderPass");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateRenderPass");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -1319,7 +1320,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyRenderPass(
     format::HandleId                            renderPass,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyRenderPass");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyRenderPass");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -1334,7 +1335,7 @@ void VulkanExportJsonConsumer::Process_vkGetRenderAreaGranularity(
     format::HandleId                            renderPass,
     StructPointerDecoder<Decoded_VkExtent2D>*   pGranularity)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetRenderAreaGranularity");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetRenderAreaGranularity");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -1351,7 +1352,7 @@ void VulkanExportJsonConsumer::Process_vkCreateCommandPool(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkCommandPool>*        pCommandPool)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateCommandPool");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateCommandPool");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -1368,7 +1369,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyCommandPool(
     format::HandleId                            commandPool,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyCommandPool");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyCommandPool");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -1384,7 +1385,7 @@ void VulkanExportJsonConsumer::Process_vkResetCommandPool(
     format::HandleId                            commandPool,
     VkCommandPoolResetFlags                     flags)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkResetCommandPool");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkResetCommandPool");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -1401,7 +1402,7 @@ void VulkanExportJsonConsumer::Process_vkAllocateCommandBuffers(
     StructPointerDecoder<Decoded_VkCommandBufferAllocateInfo>* pAllocateInfo,
     HandlePointerDecoder<VkCommandBuffer>*      pCommandBuffers)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAllocateCommandBuffers");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkAllocateCommandBuffers");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -1418,7 +1419,7 @@ void VulkanExportJsonConsumer::Process_vkFreeCommandBuffers(
     uint32_t                                    commandBufferCount,
     HandlePointerDecoder<VkCommandBuffer>*      pCommandBuffers)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkFreeCommandBuffers");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkFreeCommandBuffers");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -1434,7 +1435,7 @@ void VulkanExportJsonConsumer::Process_vkBeginCommandBuffer(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCommandBufferBeginInfo>* pBeginInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBeginCommandBuffer");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkBeginCommandBuffer");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -1448,7 +1449,7 @@ void VulkanExportJsonConsumer::Process_vkEndCommandBuffer(
     VkResult                                    returnValue,
     format::HandleId                            commandBuffer)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkEndCommandBuffer");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkEndCommandBuffer");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -1462,7 +1463,7 @@ void VulkanExportJsonConsumer::Process_vkResetCommandBuffer(
     format::HandleId                            commandBuffer,
     VkCommandBufferResetFlags                   flags)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkResetCommandBuffer");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkResetCommandBuffer");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -1477,7 +1478,7 @@ void VulkanExportJsonConsumer::Process_vkCmdBindPipeline(
     VkPipelineBindPoint                         pipelineBindPoint,
     format::HandleId                            pipeline)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindPipeline");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdBindPipeline");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -1494,7 +1495,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetViewport(
     uint32_t                                    viewportCount,
     StructPointerDecoder<Decoded_VkViewport>*   pViewports)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetViewport");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetViewport");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -1512,7 +1513,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetScissor(
     uint32_t                                    scissorCount,
     StructPointerDecoder<Decoded_VkRect2D>*     pScissors)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetScissor");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetScissor");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -1528,7 +1529,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetLineWidth(
     format::HandleId                            commandBuffer,
     float                                       lineWidth)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetLineWidth");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetLineWidth");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -1544,7 +1545,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthBias(
     float                                       depthBiasClamp,
     float                                       depthBiasSlopeFactor)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthBias");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthBias");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -1560,7 +1561,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetBlendConstants(
     format::HandleId                            commandBuffer,
     PointerDecoder<float>*                      blendConstants)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetBlendConstants");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetBlendConstants");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -1575,7 +1576,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthBounds(
     float                                       minDepthBounds,
     float                                       maxDepthBounds)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthBounds");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthBounds");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -1591,7 +1592,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetStencilCompareMask(
     VkStencilFaceFlags                          faceMask,
     uint32_t                                    compareMask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetStencilCompareMask");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetStencilCompareMask");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -1607,7 +1608,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetStencilWriteMask(
     VkStencilFaceFlags                          faceMask,
     uint32_t                                    writeMask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetStencilWriteMask");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetStencilWriteMask");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -1623,7 +1624,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetStencilReference(
     VkStencilFaceFlags                          faceMask,
     uint32_t                                    reference)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetStencilReference");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetStencilReference");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -1644,7 +1645,7 @@ void VulkanExportJsonConsumer::Process_vkCmdBindDescriptorSets(
     uint32_t                                    dynamicOffsetCount,
     PointerDecoder<uint32_t>*                   pDynamicOffsets)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindDescriptorSets");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdBindDescriptorSets");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -1666,7 +1667,7 @@ void VulkanExportJsonConsumer::Process_vkCmdBindIndexBuffer(
     VkDeviceSize                                offset,
     VkIndexType                                 indexType)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindIndexBuffer");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdBindIndexBuffer");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -1685,7 +1686,7 @@ void VulkanExportJsonConsumer::Process_vkCmdBindVertexBuffers(
     HandlePointerDecoder<VkBuffer>*             pBuffers,
     PointerDecoder<VkDeviceSize>*               pOffsets)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindVertexBuffers");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdBindVertexBuffers");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -1705,7 +1706,7 @@ void VulkanExportJsonConsumer::Process_vkCmdDraw(
     uint32_t                                    firstVertex,
     uint32_t                                    firstInstance)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDraw");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdDraw");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -1726,7 +1727,7 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawIndexed(
     int32_t                                     vertexOffset,
     uint32_t                                    firstInstance)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndexed");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndexed");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -1747,7 +1748,7 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawIndirect(
     uint32_t                                    drawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndirect");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndirect");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -1767,7 +1768,7 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawIndexedIndirect(
     uint32_t                                    drawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndexedIndirect");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndexedIndirect");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -1786,7 +1787,7 @@ void VulkanExportJsonConsumer::Process_vkCmdDispatch(
     uint32_t                                    groupCountY,
     uint32_t                                    groupCountZ)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDispatch");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdDispatch");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -1803,7 +1804,7 @@ void VulkanExportJsonConsumer::Process_vkCmdDispatchIndirect(
     format::HandleId                            buffer,
     VkDeviceSize                                offset)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDispatchIndirect");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdDispatchIndirect");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -1821,7 +1822,7 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyBuffer(
     uint32_t                                    regionCount,
     StructPointerDecoder<Decoded_VkBufferCopy>* pRegions)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyBuffer");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdCopyBuffer");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -1843,7 +1844,7 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyImage(
     uint32_t                                    regionCount,
     StructPointerDecoder<Decoded_VkImageCopy>*  pRegions)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyImage");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdCopyImage");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -1868,7 +1869,7 @@ void VulkanExportJsonConsumer::Process_vkCmdBlitImage(
     StructPointerDecoder<Decoded_VkImageBlit>*  pRegions,
     VkFilter                                    filter)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBlitImage");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdBlitImage");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -1892,7 +1893,7 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyBufferToImage(
     uint32_t                                    regionCount,
     StructPointerDecoder<Decoded_VkBufferImageCopy>* pRegions)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyBufferToImage");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdCopyBufferToImage");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -1914,7 +1915,7 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyImageToBuffer(
     uint32_t                                    regionCount,
     StructPointerDecoder<Decoded_VkBufferImageCopy>* pRegions)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyImageToBuffer");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdCopyImageToBuffer");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -1935,7 +1936,7 @@ void VulkanExportJsonConsumer::Process_vkCmdUpdateBuffer(
     VkDeviceSize                                dataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdUpdateBuffer");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdUpdateBuffer");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -1955,7 +1956,7 @@ void VulkanExportJsonConsumer::Process_vkCmdFillBuffer(
     VkDeviceSize                                size,
     uint32_t                                    data)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdFillBuffer");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdFillBuffer");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -1976,7 +1977,7 @@ void VulkanExportJsonConsumer::Process_vkCmdClearColorImage(
     uint32_t                                    rangeCount,
     StructPointerDecoder<Decoded_VkImageSubresourceRange>* pRanges)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdClearColorImage");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdClearColorImage");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -1998,7 +1999,7 @@ void VulkanExportJsonConsumer::Process_vkCmdClearDepthStencilImage(
     uint32_t                                    rangeCount,
     StructPointerDecoder<Decoded_VkImageSubresourceRange>* pRanges)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdClearDepthStencilImage");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdClearDepthStencilImage");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -2019,7 +2020,7 @@ void VulkanExportJsonConsumer::Process_vkCmdClearAttachments(
     uint32_t                                    rectCount,
     StructPointerDecoder<Decoded_VkClearRect>*  pRects)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdClearAttachments");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdClearAttachments");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -2041,7 +2042,7 @@ void VulkanExportJsonConsumer::Process_vkCmdResolveImage(
     uint32_t                                    regionCount,
     StructPointerDecoder<Decoded_VkImageResolve>* pRegions)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdResolveImage");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdResolveImage");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -2061,7 +2062,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetEvent(
     format::HandleId                            event,
     VkPipelineStageFlags                        stageMask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetEvent");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetEvent");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -2077,7 +2078,7 @@ void VulkanExportJsonConsumer::Process_vkCmdResetEvent(
     format::HandleId                            event,
     VkPipelineStageFlags                        stageMask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdResetEvent");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdResetEvent");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -2101,7 +2102,7 @@ void VulkanExportJsonConsumer::Process_vkCmdWaitEvents(
     uint32_t                                    imageMemoryBarrierCount,
     StructPointerDecoder<Decoded_VkImageMemoryBarrier>* pImageMemoryBarriers)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWaitEvents");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdWaitEvents");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -2132,7 +2133,7 @@ void VulkanExportJsonConsumer::Process_vkCmdPipelineBarrier(
     uint32_t                                    imageMemoryBarrierCount,
     StructPointerDecoder<Decoded_VkImageMemoryBarrier>* pImageMemoryBarriers)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdPipelineBarrier");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdPipelineBarrier");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -2156,7 +2157,7 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginQuery(
     uint32_t                                    query,
     VkQueryControlFlags                         flags)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginQuery");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdBeginQuery");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -2173,7 +2174,7 @@ void VulkanExportJsonConsumer::Process_vkCmdEndQuery(
     format::HandleId                            queryPool,
     uint32_t                                    query)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndQuery");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdEndQuery");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -2190,7 +2191,7 @@ void VulkanExportJsonConsumer::Process_vkCmdResetQueryPool(
     uint32_t                                    firstQuery,
     uint32_t                                    queryCount)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdResetQueryPool");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdResetQueryPool");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -2208,7 +2209,7 @@ void VulkanExportJsonConsumer::Process_vkCmdWriteTimestamp(
     format::HandleId                            queryPool,
     uint32_t                                    query)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWriteTimestamp");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdWriteTimestamp");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -2230,7 +2231,7 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyQueryPoolResults(
     VkDeviceSize                                stride,
     VkQueryResultFlags                          flags)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyQueryPoolResults");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdCopyQueryPoolResults");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -2251,7 +2252,7 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginRenderPass(
     StructPointerDecoder<Decoded_VkRenderPassBeginInfo>* pRenderPassBegin,
     VkSubpassContents                           contents)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginRenderPass");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdBeginRenderPass");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -2266,7 +2267,7 @@ void VulkanExportJsonConsumer::Process_vkCmdNextSubpass(
     format::HandleId                            commandBuffer,
     VkSubpassContents                           contents)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdNextSubpass");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdNextSubpass");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -2279,7 +2280,7 @@ void VulkanExportJsonConsumer::Process_vkCmdEndRenderPass(
     const ApiCallInfo&                          call_info,
     format::HandleId                            commandBuffer)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndRenderPass");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdEndRenderPass");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -2293,7 +2294,7 @@ void VulkanExportJsonConsumer::Process_vkCmdExecuteCommands(
     uint32_t                                    commandBufferCount,
     HandlePointerDecoder<VkCommandBuffer>*      pCommandBuffers)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdExecuteCommands");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdExecuteCommands");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -2310,7 +2311,7 @@ void VulkanExportJsonConsumer::Process_vkBindBufferMemory2(
     uint32_t                                    bindInfoCount,
     StructPointerDecoder<Decoded_VkBindBufferMemoryInfo>* pBindInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBindBufferMemory2");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkBindBufferMemory2");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -2327,7 +2328,7 @@ void VulkanExportJsonConsumer::Process_vkBindImageMemory2(
     uint32_t                                    bindInfoCount,
     StructPointerDecoder<Decoded_VkBindImageMemoryInfo>* pBindInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBindImageMemory2");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkBindImageMemory2");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -2345,7 +2346,7 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceGroupPeerMemoryFeatures(
     uint32_t                                    remoteDeviceIndex,
     PointerDecoder<VkPeerMemoryFeatureFlags>*   pPeerMemoryFeatures)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceGroupPeerMemoryFeatures");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDeviceGroupPeerMemoryFeatures");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -2361,7 +2362,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDeviceMask(
     format::HandleId                            commandBuffer,
     uint32_t                                    deviceMask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDeviceMask");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetDeviceMask");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -2380,7 +2381,7 @@ void VulkanExportJsonConsumer::Process_vkCmdDispatchBase(
     uint32_t                                    groupCountY,
     uint32_t                                    groupCountZ)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDispatchBase");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdDispatchBase");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -2401,7 +2402,7 @@ void VulkanExportJsonConsumer::Process_vkEnumeratePhysicalDeviceGroups(
     PointerDecoder<uint32_t>*                   pPhysicalDeviceGroupCount,
     StructPointerDecoder<Decoded_VkPhysicalDeviceGroupProperties>* pPhysicalDeviceGroupProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkEnumeratePhysicalDeviceGroups");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkEnumeratePhysicalDeviceGroups");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -2417,7 +2418,7 @@ void VulkanExportJsonConsumer::Process_vkGetImageMemoryRequirements2(
     StructPointerDecoder<Decoded_VkImageMemoryRequirementsInfo2>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageMemoryRequirements2");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetImageMemoryRequirements2");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -2432,7 +2433,7 @@ void VulkanExportJsonConsumer::Process_vkGetBufferMemoryRequirements2(
     StructPointerDecoder<Decoded_VkBufferMemoryRequirementsInfo2>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetBufferMemoryRequirements2");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetBufferMemoryRequirements2");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -2448,7 +2449,7 @@ void VulkanExportJsonConsumer::Process_vkGetImageSparseMemoryRequirements2(
     PointerDecoder<uint32_t>*                   pSparseMemoryRequirementCount,
     StructPointerDecoder<Decoded_VkSparseImageMemoryRequirements2>* pSparseMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageSparseMemoryRequirements2");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetImageSparseMemoryRequirements2");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -2463,7 +2464,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceFeatures2(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceFeatures2>* pFeatures)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFeatures2");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFeatures2");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["physicalDevice"], physicalDevice, json_options);
@@ -2476,7 +2477,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceProperties2(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceProperties2>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceProperties2");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceProperties2");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["physicalDevice"], physicalDevice, json_options);
@@ -2490,7 +2491,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceFormatProperties2(
     VkFormat                                    format,
     StructPointerDecoder<Decoded_VkFormatProperties2>* pFormatProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFormatProperties2");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFormatProperties2");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["physicalDevice"], physicalDevice, json_options);
@@ -2506,7 +2507,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceImageFormatProperties2
     StructPointerDecoder<Decoded_VkPhysicalDeviceImageFormatInfo2>* pImageFormatInfo,
     StructPointerDecoder<Decoded_VkImageFormatProperties2>* pImageFormatProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceImageFormatProperties2");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceImageFormatProperties2");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -2522,7 +2523,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceQueueFamilyProperties2
     PointerDecoder<uint32_t>*                   pQueueFamilyPropertyCount,
     StructPointerDecoder<Decoded_VkQueueFamilyProperties2>* pQueueFamilyProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceQueueFamilyProperties2");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceQueueFamilyProperties2");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["physicalDevice"], physicalDevice, json_options);
@@ -2536,7 +2537,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceMemoryProperties2(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceMemoryProperties2>* pMemoryProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceMemoryProperties2");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceMemoryProperties2");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["physicalDevice"], physicalDevice, json_options);
@@ -2551,7 +2552,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSparseImageFormatPrope
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkSparseImageFormatProperties2>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSparseImageFormatProperties2");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSparseImageFormatProperties2");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["physicalDevice"], physicalDevice, json_options);
@@ -2567,7 +2568,7 @@ void VulkanExportJsonConsumer::Process_vkTrimCommandPool(
     format::HandleId                            commandPool,
     VkCommandPoolTrimFlags                      flags)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkTrimCommandPool");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkTrimCommandPool");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -2582,7 +2583,7 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceQueue2(
     StructPointerDecoder<Decoded_VkDeviceQueueInfo2>* pQueueInfo,
     HandlePointerDecoder<VkQueue>*              pQueue)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceQueue2");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDeviceQueue2");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -2599,7 +2600,7 @@ void VulkanExportJsonConsumer::Process_vkCreateSamplerYcbcrConversion(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSamplerYcbcrConversion>* pYcbcrConversion)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateSamplerYcbcrConversion");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateSamplerYcbcrConversion");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -2616,7 +2617,7 @@ void VulkanExportJsonConsumer::Process_vkDestroySamplerYcbcrConversion(
     format::HandleId                            ycbcrConversion,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroySamplerYcbcrConversion");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroySamplerYcbcrConversion");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -2633,7 +2634,7 @@ void VulkanExportJsonConsumer::Process_vkCreateDescriptorUpdateTemplate(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDescriptorUpdateTemplate>* pDescriptorUpdateTemplate)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDescriptorUpdateTemplate");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateDescriptorUpdateTemplate");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -2650,7 +2651,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyDescriptorUpdateTemplate(
     format::HandleId                            descriptorUpdateTemplate,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyDescriptorUpdateTemplate");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyDescriptorUpdateTemplate");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -2665,7 +2666,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceExternalBufferProperti
     StructPointerDecoder<Decoded_VkPhysicalDeviceExternalBufferInfo>* pExternalBufferInfo,
     StructPointerDecoder<Decoded_VkExternalBufferProperties>* pExternalBufferProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalBufferProperties");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalBufferProperties");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["physicalDevice"], physicalDevice, json_options);
@@ -2680,7 +2681,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceExternalFencePropertie
     StructPointerDecoder<Decoded_VkPhysicalDeviceExternalFenceInfo>* pExternalFenceInfo,
     StructPointerDecoder<Decoded_VkExternalFenceProperties>* pExternalFenceProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalFenceProperties");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalFenceProperties");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["physicalDevice"], physicalDevice, json_options);
@@ -2695,7 +2696,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceExternalSemaphorePrope
     StructPointerDecoder<Decoded_VkPhysicalDeviceExternalSemaphoreInfo>* pExternalSemaphoreInfo,
     StructPointerDecoder<Decoded_VkExternalSemaphoreProperties>* pExternalSemaphoreProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalSemaphoreProperties");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalSemaphoreProperties");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["physicalDevice"], physicalDevice, json_options);
@@ -2710,7 +2711,7 @@ void VulkanExportJsonConsumer::Process_vkGetDescriptorSetLayoutSupport(
     StructPointerDecoder<Decoded_VkDescriptorSetLayoutCreateInfo>* pCreateInfo,
     StructPointerDecoder<Decoded_VkDescriptorSetLayoutSupport>* pSupport)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDescriptorSetLayoutSupport");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDescriptorSetLayoutSupport");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -2729,7 +2730,7 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawIndirectCount(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndirectCount");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndirectCount");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -2753,7 +2754,7 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawIndexedIndirectCount(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndexedIndirectCount");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndexedIndirectCount");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -2775,7 +2776,7 @@ void VulkanExportJsonConsumer::Process_vkCreateRenderPass2(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkRenderPass>*         pRenderPass)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateRenderPass2");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateRenderPass2");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -2792,7 +2793,7 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginRenderPass2(
     StructPointerDecoder<Decoded_VkRenderPassBeginInfo>* pRenderPassBegin,
     StructPointerDecoder<Decoded_VkSubpassBeginInfo>* pSubpassBeginInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginRenderPass2");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdBeginRenderPass2");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -2808,7 +2809,7 @@ void VulkanExportJsonConsumer::Process_vkCmdNextSubpass2(
     StructPointerDecoder<Decoded_VkSubpassBeginInfo>* pSubpassBeginInfo,
     StructPointerDecoder<Decoded_VkSubpassEndInfo>* pSubpassEndInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdNextSubpass2");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdNextSubpass2");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -2823,7 +2824,7 @@ void VulkanExportJsonConsumer::Process_vkCmdEndRenderPass2(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkSubpassEndInfo>* pSubpassEndInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndRenderPass2");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdEndRenderPass2");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -2839,7 +2840,7 @@ void VulkanExportJsonConsumer::Process_vkResetQueryPool(
     uint32_t                                    firstQuery,
     uint32_t                                    queryCount)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkResetQueryPool");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkResetQueryPool");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -2856,7 +2857,7 @@ void VulkanExportJsonConsumer::Process_vkGetSemaphoreCounterValue(
     format::HandleId                            semaphore,
     PointerDecoder<uint64_t>*                   pValue)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetSemaphoreCounterValue");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetSemaphoreCounterValue");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -2873,7 +2874,7 @@ void VulkanExportJsonConsumer::Process_vkWaitSemaphores(
     StructPointerDecoder<Decoded_VkSemaphoreWaitInfo>* pWaitInfo,
     uint64_t                                    timeout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkWaitSemaphores");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkWaitSemaphores");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -2889,7 +2890,7 @@ void VulkanExportJsonConsumer::Process_vkSignalSemaphore(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkSemaphoreSignalInfo>* pSignalInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSignalSemaphore");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkSignalSemaphore");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -2904,7 +2905,7 @@ void VulkanExportJsonConsumer::Process_vkGetBufferDeviceAddress(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetBufferDeviceAddress");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetBufferDeviceAddress");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJsonAsHex(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -2919,7 +2920,7 @@ void VulkanExportJsonConsumer::Process_vkGetBufferOpaqueCaptureAddress(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetBufferOpaqueCaptureAddress");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetBufferOpaqueCaptureAddress");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -2934,7 +2935,7 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceMemoryOpaqueCaptureAddress(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDeviceMemoryOpaqueCaptureAddressInfo>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceMemoryOpaqueCaptureAddress");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDeviceMemoryOpaqueCaptureAddress");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -2950,7 +2951,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceToolProperties(
     PointerDecoder<uint32_t>*                   pToolCount,
     StructPointerDecoder<Decoded_VkPhysicalDeviceToolProperties>* pToolProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceToolProperties");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceToolProperties");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -2968,7 +2969,7 @@ void VulkanExportJsonConsumer::Process_vkCreatePrivateDataSlot(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPrivateDataSlot>*    pPrivateDataSlot)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreatePrivateDataSlot");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreatePrivateDataSlot");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -2985,7 +2986,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyPrivateDataSlot(
     format::HandleId                            privateDataSlot,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyPrivateDataSlot");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyPrivateDataSlot");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -3003,7 +3004,7 @@ void VulkanExportJsonConsumer::Process_vkSetPrivateData(
     format::HandleId                            privateDataSlot,
     uint64_t                                    data)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSetPrivateData");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkSetPrivateData");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -3023,7 +3024,7 @@ void VulkanExportJsonConsumer::Process_vkGetPrivateData(
     format::HandleId                            privateDataSlot,
     PointerDecoder<uint64_t>*                   pData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPrivateData");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPrivateData");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -3040,7 +3041,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetEvent2(
     format::HandleId                            event,
     StructPointerDecoder<Decoded_VkDependencyInfo>* pDependencyInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetEvent2");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetEvent2");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -3056,7 +3057,7 @@ void VulkanExportJsonConsumer::Process_vkCmdResetEvent2(
     format::HandleId                            event,
     VkPipelineStageFlags2                       stageMask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdResetEvent2");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdResetEvent2");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -3073,7 +3074,7 @@ void VulkanExportJsonConsumer::Process_vkCmdWaitEvents2(
     HandlePointerDecoder<VkEvent>*              pEvents,
     StructPointerDecoder<Decoded_VkDependencyInfo>* pDependencyInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWaitEvents2");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdWaitEvents2");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -3089,7 +3090,7 @@ void VulkanExportJsonConsumer::Process_vkCmdPipelineBarrier2(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkDependencyInfo>* pDependencyInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdPipelineBarrier2");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdPipelineBarrier2");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -3105,7 +3106,7 @@ void VulkanExportJsonConsumer::Process_vkCmdWriteTimestamp2(
     format::HandleId                            queryPool,
     uint32_t                                    query)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWriteTimestamp2");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdWriteTimestamp2");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -3124,7 +3125,7 @@ void VulkanExportJsonConsumer::Process_vkQueueSubmit2(
     StructPointerDecoder<Decoded_VkSubmitInfo2>* pSubmits,
     format::HandleId                            fence)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueueSubmit2");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkQueueSubmit2");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameSubmitIndex()], ++submit_index_, json_options);
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
@@ -3141,7 +3142,7 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyBuffer2(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyBufferInfo2>* pCopyBufferInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyBuffer2");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdCopyBuffer2");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -3155,7 +3156,7 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyImage2(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyImageInfo2>* pCopyImageInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyImage2");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdCopyImage2");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -3169,7 +3170,7 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyBufferToImage2(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyBufferToImageInfo2>* pCopyBufferToImageInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyBufferToImage2");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdCopyBufferToImage2");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -3183,7 +3184,7 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyImageToBuffer2(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyImageToBufferInfo2>* pCopyImageToBufferInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyImageToBuffer2");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdCopyImageToBuffer2");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -3197,7 +3198,7 @@ void VulkanExportJsonConsumer::Process_vkCmdBlitImage2(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkBlitImageInfo2>* pBlitImageInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBlitImage2");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdBlitImage2");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -3211,7 +3212,7 @@ void VulkanExportJsonConsumer::Process_vkCmdResolveImage2(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkResolveImageInfo2>* pResolveImageInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdResolveImage2");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdResolveImage2");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -3225,7 +3226,7 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginRendering(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkRenderingInfo>* pRenderingInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginRendering");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdBeginRendering");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -3238,7 +3239,7 @@ void VulkanExportJsonConsumer::Process_vkCmdEndRendering(
     const ApiCallInfo&                          call_info,
     format::HandleId                            commandBuffer)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndRendering");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdEndRendering");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -3251,7 +3252,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetCullMode(
     format::HandleId                            commandBuffer,
     VkCullModeFlags                             cullMode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetCullMode");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetCullMode");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -3265,7 +3266,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetFrontFace(
     format::HandleId                            commandBuffer,
     VkFrontFace                                 frontFace)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetFrontFace");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetFrontFace");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -3279,7 +3280,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetPrimitiveTopology(
     format::HandleId                            commandBuffer,
     VkPrimitiveTopology                         primitiveTopology)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetPrimitiveTopology");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetPrimitiveTopology");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -3294,7 +3295,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetViewportWithCount(
     uint32_t                                    viewportCount,
     StructPointerDecoder<Decoded_VkViewport>*   pViewports)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetViewportWithCount");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetViewportWithCount");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -3310,7 +3311,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetScissorWithCount(
     uint32_t                                    scissorCount,
     StructPointerDecoder<Decoded_VkRect2D>*     pScissors)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetScissorWithCount");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetScissorWithCount");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -3330,7 +3331,7 @@ void VulkanExportJsonConsumer::Process_vkCmdBindVertexBuffers2(
     PointerDecoder<VkDeviceSize>*               pSizes,
     PointerDecoder<VkDeviceSize>*               pStrides)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindVertexBuffers2");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdBindVertexBuffers2");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -3349,7 +3350,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthTestEnable(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthTestEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthTestEnable");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthTestEnable");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -3363,7 +3364,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthWriteEnable(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthWriteEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthWriteEnable");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthWriteEnable");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -3377,7 +3378,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthCompareOp(
     format::HandleId                            commandBuffer,
     VkCompareOp                                 depthCompareOp)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthCompareOp");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthCompareOp");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -3391,7 +3392,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthBoundsTestEnable(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthBoundsTestEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthBoundsTestEnable");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthBoundsTestEnable");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -3405,7 +3406,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetStencilTestEnable(
     format::HandleId                            commandBuffer,
     VkBool32                                    stencilTestEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetStencilTestEnable");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetStencilTestEnable");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -3423,7 +3424,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetStencilOp(
     VkStencilOp                                 depthFailOp,
     VkCompareOp                                 compareOp)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetStencilOp");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetStencilOp");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -3441,7 +3442,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetRasterizerDiscardEnable(
     format::HandleId                            commandBuffer,
     VkBool32                                    rasterizerDiscardEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetRasterizerDiscardEnable");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetRasterizerDiscardEnable");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -3455,7 +3456,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthBiasEnable(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthBiasEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthBiasEnable");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthBiasEnable");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -3469,7 +3470,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetPrimitiveRestartEnable(
     format::HandleId                            commandBuffer,
     VkBool32                                    primitiveRestartEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetPrimitiveRestartEnable");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetPrimitiveRestartEnable");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -3484,7 +3485,7 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceBufferMemoryRequirements(
     StructPointerDecoder<Decoded_VkDeviceBufferMemoryRequirements>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceBufferMemoryRequirements");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDeviceBufferMemoryRequirements");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -3499,7 +3500,7 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceImageMemoryRequirements(
     StructPointerDecoder<Decoded_VkDeviceImageMemoryRequirements>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceImageMemoryRequirements");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDeviceImageMemoryRequirements");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -3515,7 +3516,7 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceImageSparseMemoryRequirements(
     PointerDecoder<uint32_t>*                   pSparseMemoryRequirementCount,
     StructPointerDecoder<Decoded_VkSparseImageMemoryRequirements2>* pSparseMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceImageSparseMemoryRequirements");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDeviceImageSparseMemoryRequirements");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -3531,7 +3532,7 @@ void VulkanExportJsonConsumer::Process_vkDestroySurfaceKHR(
     format::HandleId                            surface,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroySurfaceKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroySurfaceKHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["instance"], instance, json_options);
@@ -3548,7 +3549,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfaceSupportKHR(
     format::HandleId                            surface,
     PointerDecoder<VkBool32>*                   pSupported)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceSupportKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceSupportKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -3566,7 +3567,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfaceCapabilitiesKHR
     format::HandleId                            surface,
     StructPointerDecoder<Decoded_VkSurfaceCapabilitiesKHR>* pSurfaceCapabilities)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceCapabilitiesKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceCapabilitiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -3584,7 +3585,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfaceFormatsKHR(
     PointerDecoder<uint32_t>*                   pSurfaceFormatCount,
     StructPointerDecoder<Decoded_VkSurfaceFormatKHR>* pSurfaceFormats)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceFormatsKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceFormatsKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -3603,7 +3604,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfacePresentModesKHR
     PointerDecoder<uint32_t>*                   pPresentModeCount,
     PointerDecoder<VkPresentModeKHR>*           pPresentModes)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfacePresentModesKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfacePresentModesKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -3622,7 +3623,7 @@ void VulkanExportJsonConsumer::Process_vkCreateSwapchainKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSwapchainKHR>*       pSwapchain)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateSwapchainKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateSwapchainKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -3639,7 +3640,7 @@ void VulkanExportJsonConsumer::Process_vkDestroySwapchainKHR(
     format::HandleId                            swapchain,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroySwapchainKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroySwapchainKHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -3656,7 +3657,7 @@ void VulkanExportJsonConsumer::Process_vkGetSwapchainImagesKHR(
     PointerDecoder<uint32_t>*                   pSwapchainImageCount,
     HandlePointerDecoder<VkImage>*              pSwapchainImages)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetSwapchainImagesKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetSwapchainImagesKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -3677,7 +3678,7 @@ void VulkanExportJsonConsumer::Process_vkAcquireNextImageKHR(
     format::HandleId                            fence,
     PointerDecoder<uint32_t>*                   pImageIndex)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAcquireNextImageKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkAcquireNextImageKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -3696,7 +3697,7 @@ void VulkanExportJsonConsumer::Process_vkQueuePresentKHR(
     format::HandleId                            queue,
     StructPointerDecoder<Decoded_VkPresentInfoKHR>* pPresentInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueuePresentKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkQueuePresentKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameSubmitIndex()], ++submit_index_, json_options);
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
@@ -3712,7 +3713,7 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceGroupPresentCapabilitiesKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDeviceGroupPresentCapabilitiesKHR>* pDeviceGroupPresentCapabilities)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceGroupPresentCapabilitiesKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDeviceGroupPresentCapabilitiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -3728,7 +3729,7 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceGroupSurfacePresentModesKHR(
     format::HandleId                            surface,
     PointerDecoder<VkDeviceGroupPresentModeFlagsKHR>* pModes)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceGroupSurfacePresentModesKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDeviceGroupSurfacePresentModesKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -3746,7 +3747,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDevicePresentRectanglesKHR(
     PointerDecoder<uint32_t>*                   pRectCount,
     StructPointerDecoder<Decoded_VkRect2D>*     pRects)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDevicePresentRectanglesKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDevicePresentRectanglesKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -3764,7 +3765,7 @@ void VulkanExportJsonConsumer::Process_vkAcquireNextImage2KHR(
     StructPointerDecoder<Decoded_VkAcquireNextImageInfoKHR>* pAcquireInfo,
     PointerDecoder<uint32_t>*                   pImageIndex)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAcquireNextImage2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkAcquireNextImage2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -3781,7 +3782,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceDisplayPropertiesKHR(
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkDisplayPropertiesKHR>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceDisplayPropertiesKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceDisplayPropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -3798,7 +3799,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceDisplayPlaneProperties
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkDisplayPlanePropertiesKHR>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceDisplayPlanePropertiesKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceDisplayPlanePropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -3816,7 +3817,7 @@ void VulkanExportJsonConsumer::Process_vkGetDisplayPlaneSupportedDisplaysKHR(
     PointerDecoder<uint32_t>*                   pDisplayCount,
     HandlePointerDecoder<VkDisplayKHR>*         pDisplays)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDisplayPlaneSupportedDisplaysKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDisplayPlaneSupportedDisplaysKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -3835,7 +3836,7 @@ void VulkanExportJsonConsumer::Process_vkGetDisplayModePropertiesKHR(
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkDisplayModePropertiesKHR>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDisplayModePropertiesKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDisplayModePropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -3855,7 +3856,7 @@ void VulkanExportJsonConsumer::Process_vkCreateDisplayModeKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDisplayModeKHR>*     pMode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDisplayModeKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateDisplayModeKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -3875,7 +3876,7 @@ void VulkanExportJsonConsumer::Process_vkGetDisplayPlaneCapabilitiesKHR(
     uint32_t                                    planeIndex,
     StructPointerDecoder<Decoded_VkDisplayPlaneCapabilitiesKHR>* pCapabilities)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDisplayPlaneCapabilitiesKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDisplayPlaneCapabilitiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -3894,7 +3895,7 @@ void VulkanExportJsonConsumer::Process_vkCreateDisplayPlaneSurfaceKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDisplayPlaneSurfaceKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateDisplayPlaneSurfaceKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -3914,7 +3915,7 @@ void VulkanExportJsonConsumer::Process_vkCreateSharedSwapchainsKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSwapchainKHR>*       pSwapchains)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateSharedSwapchainsKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateSharedSwapchainsKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -3934,7 +3935,7 @@ void VulkanExportJsonConsumer::Process_vkCreateXlibSurfaceKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateXlibSurfaceKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateXlibSurfaceKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -3953,7 +3954,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceXlibPresentationSuppor
     uint64_t                                    dpy,
     size_t                                      visualID)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceXlibPresentationSupportKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceXlibPresentationSupportKHR");
     const JsonOptions& json_options = GetJsonOptions();
             Bool32ToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -3972,7 +3973,7 @@ void VulkanExportJsonConsumer::Process_vkCreateXcbSurfaceKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateXcbSurfaceKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateXcbSurfaceKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -3991,7 +3992,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceXcbPresentationSupport
     uint64_t                                    connection,
     uint32_t                                    visual_id)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceXcbPresentationSupportKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceXcbPresentationSupportKHR");
     const JsonOptions& json_options = GetJsonOptions();
             Bool32ToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4010,7 +4011,7 @@ void VulkanExportJsonConsumer::Process_vkCreateWaylandSurfaceKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateWaylandSurfaceKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateWaylandSurfaceKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4028,7 +4029,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceWaylandPresentationSup
     uint32_t                                    queueFamilyIndex,
     uint64_t                                    display)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceWaylandPresentationSupportKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceWaylandPresentationSupportKHR");
     const JsonOptions& json_options = GetJsonOptions();
             Bool32ToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4046,7 +4047,7 @@ void VulkanExportJsonConsumer::Process_vkCreateAndroidSurfaceKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateAndroidSurfaceKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateAndroidSurfaceKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4065,7 +4066,7 @@ void VulkanExportJsonConsumer::Process_vkCreateWin32SurfaceKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateWin32SurfaceKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateWin32SurfaceKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4082,7 +4083,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceWin32PresentationSuppo
     format::HandleId                            physicalDevice,
     uint32_t                                    queueFamilyIndex)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceWin32PresentationSupportKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceWin32PresentationSupportKHR");
     const JsonOptions& json_options = GetJsonOptions();
             Bool32ToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4098,7 +4099,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceVideoCapabilitiesKHR(
     StructPointerDecoder<Decoded_VkVideoProfileInfoKHR>* pVideoProfile,
     StructPointerDecoder<Decoded_VkVideoCapabilitiesKHR>* pCapabilities)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceVideoCapabilitiesKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceVideoCapabilitiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4116,7 +4117,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceVideoFormatPropertiesK
     PointerDecoder<uint32_t>*                   pVideoFormatPropertyCount,
     StructPointerDecoder<Decoded_VkVideoFormatPropertiesKHR>* pVideoFormatProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceVideoFormatPropertiesKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceVideoFormatPropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4135,7 +4136,7 @@ void VulkanExportJsonConsumer::Process_vkCreateVideoSessionKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkVideoSessionKHR>*    pVideoSession)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateVideoSessionKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateVideoSessionKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4152,7 +4153,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyVideoSessionKHR(
     format::HandleId                            videoSession,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyVideoSessionKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyVideoSessionKHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -4169,7 +4170,7 @@ void VulkanExportJsonConsumer::Process_vkGetVideoSessionMemoryRequirementsKHR(
     PointerDecoder<uint32_t>*                   pMemoryRequirementsCount,
     StructPointerDecoder<Decoded_VkVideoSessionMemoryRequirementsKHR>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetVideoSessionMemoryRequirementsKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetVideoSessionMemoryRequirementsKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4188,7 +4189,7 @@ void VulkanExportJsonConsumer::Process_vkBindVideoSessionMemoryKHR(
     uint32_t                                    bindSessionMemoryInfoCount,
     StructPointerDecoder<Decoded_VkBindVideoSessionMemoryInfoKHR>* pBindSessionMemoryInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBindVideoSessionMemoryKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkBindVideoSessionMemoryKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4207,7 +4208,7 @@ void VulkanExportJsonConsumer::Process_vkCreateVideoSessionParametersKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkVideoSessionParametersKHR>* pVideoSessionParameters)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateVideoSessionParametersKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateVideoSessionParametersKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4225,7 +4226,7 @@ void VulkanExportJsonConsumer::Process_vkUpdateVideoSessionParametersKHR(
     format::HandleId                            videoSessionParameters,
     StructPointerDecoder<Decoded_VkVideoSessionParametersUpdateInfoKHR>* pUpdateInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkUpdateVideoSessionParametersKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkUpdateVideoSessionParametersKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4241,7 +4242,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyVideoSessionParametersKHR(
     format::HandleId                            videoSessionParameters,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyVideoSessionParametersKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyVideoSessionParametersKHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -4255,7 +4256,7 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginVideoCodingKHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkVideoBeginCodingInfoKHR>* pBeginInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginVideoCodingKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdBeginVideoCodingKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -4269,7 +4270,7 @@ void VulkanExportJsonConsumer::Process_vkCmdEndVideoCodingKHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkVideoEndCodingInfoKHR>* pEndCodingInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndVideoCodingKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdEndVideoCodingKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -4283,7 +4284,7 @@ void VulkanExportJsonConsumer::Process_vkCmdControlVideoCodingKHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkVideoCodingControlInfoKHR>* pCodingControlInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdControlVideoCodingKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdControlVideoCodingKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -4297,7 +4298,7 @@ void VulkanExportJsonConsumer::Process_vkCmdDecodeVideoKHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkVideoDecodeInfoKHR>* pDecodeInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDecodeVideoKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdDecodeVideoKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -4311,7 +4312,7 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginRenderingKHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkRenderingInfo>* pRenderingInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginRenderingKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdBeginRenderingKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -4324,7 +4325,7 @@ void VulkanExportJsonConsumer::Process_vkCmdEndRenderingKHR(
     const ApiCallInfo&                          call_info,
     format::HandleId                            commandBuffer)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndRenderingKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdEndRenderingKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -4337,7 +4338,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceFeatures2KHR(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceFeatures2>* pFeatures)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFeatures2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFeatures2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["physicalDevice"], physicalDevice, json_options);
@@ -4350,7 +4351,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceProperties2KHR(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceProperties2>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceProperties2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceProperties2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["physicalDevice"], physicalDevice, json_options);
@@ -4364,7 +4365,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceFormatProperties2KHR(
     VkFormat                                    format,
     StructPointerDecoder<Decoded_VkFormatProperties2>* pFormatProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFormatProperties2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFormatProperties2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["physicalDevice"], physicalDevice, json_options);
@@ -4380,7 +4381,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceImageFormatProperties2
     StructPointerDecoder<Decoded_VkPhysicalDeviceImageFormatInfo2>* pImageFormatInfo,
     StructPointerDecoder<Decoded_VkImageFormatProperties2>* pImageFormatProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceImageFormatProperties2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceImageFormatProperties2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4396,7 +4397,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceQueueFamilyProperties2
     PointerDecoder<uint32_t>*                   pQueueFamilyPropertyCount,
     StructPointerDecoder<Decoded_VkQueueFamilyProperties2>* pQueueFamilyProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceQueueFamilyProperties2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceQueueFamilyProperties2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["physicalDevice"], physicalDevice, json_options);
@@ -4410,7 +4411,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceMemoryProperties2KHR(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceMemoryProperties2>* pMemoryProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceMemoryProperties2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceMemoryProperties2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["physicalDevice"], physicalDevice, json_options);
@@ -4425,7 +4426,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSparseImageFormatPrope
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkSparseImageFormatProperties2>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSparseImageFormatProperties2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSparseImageFormatProperties2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["physicalDevice"], physicalDevice, json_options);
@@ -4443,7 +4444,7 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceGroupPeerMemoryFeaturesKHR(
     uint32_t                                    remoteDeviceIndex,
     PointerDecoder<VkPeerMemoryFeatureFlags>*   pPeerMemoryFeatures)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceGroupPeerMemoryFeaturesKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDeviceGroupPeerMemoryFeaturesKHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -4459,7 +4460,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDeviceMaskKHR(
     format::HandleId                            commandBuffer,
     uint32_t                                    deviceMask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDeviceMaskKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetDeviceMaskKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -4478,7 +4479,7 @@ void VulkanExportJsonConsumer::Process_vkCmdDispatchBaseKHR(
     uint32_t                                    groupCountY,
     uint32_t                                    groupCountZ)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDispatchBaseKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdDispatchBaseKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -4498,7 +4499,7 @@ void VulkanExportJsonConsumer::Process_vkTrimCommandPoolKHR(
     format::HandleId                            commandPool,
     VkCommandPoolTrimFlags                      flags)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkTrimCommandPoolKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkTrimCommandPoolKHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -4514,7 +4515,7 @@ void VulkanExportJsonConsumer::Process_vkEnumeratePhysicalDeviceGroupsKHR(
     PointerDecoder<uint32_t>*                   pPhysicalDeviceGroupCount,
     StructPointerDecoder<Decoded_VkPhysicalDeviceGroupProperties>* pPhysicalDeviceGroupProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkEnumeratePhysicalDeviceGroupsKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkEnumeratePhysicalDeviceGroupsKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4530,7 +4531,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceExternalBufferProperti
     StructPointerDecoder<Decoded_VkPhysicalDeviceExternalBufferInfo>* pExternalBufferInfo,
     StructPointerDecoder<Decoded_VkExternalBufferProperties>* pExternalBufferProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalBufferPropertiesKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalBufferPropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["physicalDevice"], physicalDevice, json_options);
@@ -4546,7 +4547,7 @@ void VulkanExportJsonConsumer::Process_vkGetMemoryWin32HandleKHR(
     StructPointerDecoder<Decoded_VkMemoryGetWin32HandleInfoKHR>* pGetWin32HandleInfo,
     PointerDecoder<uint64_t, void*>*            pHandle)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMemoryWin32HandleKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetMemoryWin32HandleKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4564,7 +4565,7 @@ void VulkanExportJsonConsumer::Process_vkGetMemoryWin32HandlePropertiesKHR(
     uint64_t                                    handle,
     StructPointerDecoder<Decoded_VkMemoryWin32HandlePropertiesKHR>* pMemoryWin32HandleProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMemoryWin32HandlePropertiesKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetMemoryWin32HandlePropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4582,7 +4583,7 @@ void VulkanExportJsonConsumer::Process_vkGetMemoryFdKHR(
     StructPointerDecoder<Decoded_VkMemoryGetFdInfoKHR>* pGetFdInfo,
     PointerDecoder<int>*                        pFd)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMemoryFdKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetMemoryFdKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4600,7 +4601,7 @@ void VulkanExportJsonConsumer::Process_vkGetMemoryFdPropertiesKHR(
     int                                         fd,
     StructPointerDecoder<Decoded_VkMemoryFdPropertiesKHR>* pMemoryFdProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMemoryFdPropertiesKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetMemoryFdPropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4617,7 +4618,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceExternalSemaphorePrope
     StructPointerDecoder<Decoded_VkPhysicalDeviceExternalSemaphoreInfo>* pExternalSemaphoreInfo,
     StructPointerDecoder<Decoded_VkExternalSemaphoreProperties>* pExternalSemaphoreProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalSemaphorePropertiesKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalSemaphorePropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["physicalDevice"], physicalDevice, json_options);
@@ -4632,7 +4633,7 @@ void VulkanExportJsonConsumer::Process_vkImportSemaphoreWin32HandleKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkImportSemaphoreWin32HandleInfoKHR>* pImportSemaphoreWin32HandleInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkImportSemaphoreWin32HandleKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkImportSemaphoreWin32HandleKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4648,7 +4649,7 @@ void VulkanExportJsonConsumer::Process_vkGetSemaphoreWin32HandleKHR(
     StructPointerDecoder<Decoded_VkSemaphoreGetWin32HandleInfoKHR>* pGetWin32HandleInfo,
     PointerDecoder<uint64_t, void*>*            pHandle)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetSemaphoreWin32HandleKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetSemaphoreWin32HandleKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4664,7 +4665,7 @@ void VulkanExportJsonConsumer::Process_vkImportSemaphoreFdKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkImportSemaphoreFdInfoKHR>* pImportSemaphoreFdInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkImportSemaphoreFdKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkImportSemaphoreFdKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4680,7 +4681,7 @@ void VulkanExportJsonConsumer::Process_vkGetSemaphoreFdKHR(
     StructPointerDecoder<Decoded_VkSemaphoreGetFdInfoKHR>* pGetFdInfo,
     PointerDecoder<int>*                        pFd)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetSemaphoreFdKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetSemaphoreFdKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4699,7 +4700,7 @@ void VulkanExportJsonConsumer::Process_vkCmdPushDescriptorSetKHR(
     uint32_t                                    descriptorWriteCount,
     StructPointerDecoder<Decoded_VkWriteDescriptorSet>* pDescriptorWrites)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdPushDescriptorSetKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdPushDescriptorSetKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -4720,7 +4721,7 @@ void VulkanExportJsonConsumer::Process_vkCreateDescriptorUpdateTemplateKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDescriptorUpdateTemplate>* pDescriptorUpdateTemplate)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDescriptorUpdateTemplateKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateDescriptorUpdateTemplateKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4737,7 +4738,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyDescriptorUpdateTemplateKHR(
     format::HandleId                            descriptorUpdateTemplate,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyDescriptorUpdateTemplateKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyDescriptorUpdateTemplateKHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -4754,7 +4755,7 @@ void VulkanExportJsonConsumer::Process_vkCreateRenderPass2KHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkRenderPass>*         pRenderPass)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateRenderPass2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateRenderPass2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4771,7 +4772,7 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginRenderPass2KHR(
     StructPointerDecoder<Decoded_VkRenderPassBeginInfo>* pRenderPassBegin,
     StructPointerDecoder<Decoded_VkSubpassBeginInfo>* pSubpassBeginInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginRenderPass2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdBeginRenderPass2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -4787,7 +4788,7 @@ void VulkanExportJsonConsumer::Process_vkCmdNextSubpass2KHR(
     StructPointerDecoder<Decoded_VkSubpassBeginInfo>* pSubpassBeginInfo,
     StructPointerDecoder<Decoded_VkSubpassEndInfo>* pSubpassEndInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdNextSubpass2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdNextSubpass2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -4802,7 +4803,7 @@ void VulkanExportJsonConsumer::Process_vkCmdEndRenderPass2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkSubpassEndInfo>* pSubpassEndInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndRenderPass2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdEndRenderPass2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -4817,7 +4818,7 @@ void VulkanExportJsonConsumer::Process_vkGetSwapchainStatusKHR(
     format::HandleId                            device,
     format::HandleId                            swapchain)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetSwapchainStatusKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetSwapchainStatusKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4832,7 +4833,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceExternalFencePropertie
     StructPointerDecoder<Decoded_VkPhysicalDeviceExternalFenceInfo>* pExternalFenceInfo,
     StructPointerDecoder<Decoded_VkExternalFenceProperties>* pExternalFenceProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalFencePropertiesKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalFencePropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["physicalDevice"], physicalDevice, json_options);
@@ -4847,7 +4848,7 @@ void VulkanExportJsonConsumer::Process_vkImportFenceWin32HandleKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkImportFenceWin32HandleInfoKHR>* pImportFenceWin32HandleInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkImportFenceWin32HandleKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkImportFenceWin32HandleKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4863,7 +4864,7 @@ void VulkanExportJsonConsumer::Process_vkGetFenceWin32HandleKHR(
     StructPointerDecoder<Decoded_VkFenceGetWin32HandleInfoKHR>* pGetWin32HandleInfo,
     PointerDecoder<uint64_t, void*>*            pHandle)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetFenceWin32HandleKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetFenceWin32HandleKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4879,7 +4880,7 @@ void VulkanExportJsonConsumer::Process_vkImportFenceFdKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkImportFenceFdInfoKHR>* pImportFenceFdInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkImportFenceFdKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkImportFenceFdKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4895,7 +4896,7 @@ void VulkanExportJsonConsumer::Process_vkGetFenceFdKHR(
     StructPointerDecoder<Decoded_VkFenceGetFdInfoKHR>* pGetFdInfo,
     PointerDecoder<int>*                        pFd)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetFenceFdKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetFenceFdKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4914,7 +4915,7 @@ void VulkanExportJsonConsumer::Process_vkEnumeratePhysicalDeviceQueueFamilyPerfo
     StructPointerDecoder<Decoded_VkPerformanceCounterKHR>* pCounters,
     StructPointerDecoder<Decoded_VkPerformanceCounterDescriptionKHR>* pCounterDescriptions)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4932,7 +4933,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceQueueFamilyPerformance
     StructPointerDecoder<Decoded_VkQueryPoolPerformanceCreateInfoKHR>* pPerformanceQueryCreateInfo,
     PointerDecoder<uint32_t>*                   pNumPasses)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["physicalDevice"], physicalDevice, json_options);
@@ -4947,7 +4948,7 @@ void VulkanExportJsonConsumer::Process_vkAcquireProfilingLockKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkAcquireProfilingLockInfoKHR>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAcquireProfilingLockKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkAcquireProfilingLockKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4960,7 +4961,7 @@ void VulkanExportJsonConsumer::Process_vkReleaseProfilingLockKHR(
     const ApiCallInfo&                          call_info,
     format::HandleId                            device)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkReleaseProfilingLockKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkReleaseProfilingLockKHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -4974,7 +4975,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfaceCapabilities2KH
     StructPointerDecoder<Decoded_VkPhysicalDeviceSurfaceInfo2KHR>* pSurfaceInfo,
     StructPointerDecoder<Decoded_VkSurfaceCapabilities2KHR>* pSurfaceCapabilities)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceCapabilities2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceCapabilities2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -4992,7 +4993,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfaceFormats2KHR(
     PointerDecoder<uint32_t>*                   pSurfaceFormatCount,
     StructPointerDecoder<Decoded_VkSurfaceFormat2KHR>* pSurfaceFormats)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceFormats2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceFormats2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -5010,7 +5011,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceDisplayProperties2KHR(
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkDisplayProperties2KHR>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceDisplayProperties2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceDisplayProperties2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -5027,7 +5028,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceDisplayPlaneProperties
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkDisplayPlaneProperties2KHR>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceDisplayPlaneProperties2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceDisplayPlaneProperties2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -5045,7 +5046,7 @@ void VulkanExportJsonConsumer::Process_vkGetDisplayModeProperties2KHR(
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkDisplayModeProperties2KHR>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDisplayModeProperties2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDisplayModeProperties2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -5063,7 +5064,7 @@ void VulkanExportJsonConsumer::Process_vkGetDisplayPlaneCapabilities2KHR(
     StructPointerDecoder<Decoded_VkDisplayPlaneInfo2KHR>* pDisplayPlaneInfo,
     StructPointerDecoder<Decoded_VkDisplayPlaneCapabilities2KHR>* pCapabilities)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDisplayPlaneCapabilities2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDisplayPlaneCapabilities2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -5079,7 +5080,7 @@ void VulkanExportJsonConsumer::Process_vkGetImageMemoryRequirements2KHR(
     StructPointerDecoder<Decoded_VkImageMemoryRequirementsInfo2>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageMemoryRequirements2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetImageMemoryRequirements2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -5094,7 +5095,7 @@ void VulkanExportJsonConsumer::Process_vkGetBufferMemoryRequirements2KHR(
     StructPointerDecoder<Decoded_VkBufferMemoryRequirementsInfo2>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetBufferMemoryRequirements2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetBufferMemoryRequirements2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -5110,7 +5111,7 @@ void VulkanExportJsonConsumer::Process_vkGetImageSparseMemoryRequirements2KHR(
     PointerDecoder<uint32_t>*                   pSparseMemoryRequirementCount,
     StructPointerDecoder<Decoded_VkSparseImageMemoryRequirements2>* pSparseMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageSparseMemoryRequirements2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetImageSparseMemoryRequirements2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -5128,7 +5129,7 @@ void VulkanExportJsonConsumer::Process_vkCreateSamplerYcbcrConversionKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSamplerYcbcrConversion>* pYcbcrConversion)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateSamplerYcbcrConversionKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateSamplerYcbcrConversionKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -5145,7 +5146,7 @@ void VulkanExportJsonConsumer::Process_vkDestroySamplerYcbcrConversionKHR(
     format::HandleId                            ycbcrConversion,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroySamplerYcbcrConversionKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroySamplerYcbcrConversionKHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -5161,7 +5162,7 @@ void VulkanExportJsonConsumer::Process_vkBindBufferMemory2KHR(
     uint32_t                                    bindInfoCount,
     StructPointerDecoder<Decoded_VkBindBufferMemoryInfo>* pBindInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBindBufferMemory2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkBindBufferMemory2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -5178,7 +5179,7 @@ void VulkanExportJsonConsumer::Process_vkBindImageMemory2KHR(
     uint32_t                                    bindInfoCount,
     StructPointerDecoder<Decoded_VkBindImageMemoryInfo>* pBindInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBindImageMemory2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkBindImageMemory2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -5194,7 +5195,7 @@ void VulkanExportJsonConsumer::Process_vkGetDescriptorSetLayoutSupportKHR(
     StructPointerDecoder<Decoded_VkDescriptorSetLayoutCreateInfo>* pCreateInfo,
     StructPointerDecoder<Decoded_VkDescriptorSetLayoutSupport>* pSupport)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDescriptorSetLayoutSupportKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDescriptorSetLayoutSupportKHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -5213,7 +5214,7 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawIndirectCountKHR(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndirectCountKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndirectCountKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -5237,7 +5238,7 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawIndexedIndirectCountKHR(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndexedIndirectCountKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndexedIndirectCountKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -5258,7 +5259,7 @@ void VulkanExportJsonConsumer::Process_vkGetSemaphoreCounterValueKHR(
     format::HandleId                            semaphore,
     PointerDecoder<uint64_t>*                   pValue)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetSemaphoreCounterValueKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetSemaphoreCounterValueKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -5275,7 +5276,7 @@ void VulkanExportJsonConsumer::Process_vkWaitSemaphoresKHR(
     StructPointerDecoder<Decoded_VkSemaphoreWaitInfo>* pWaitInfo,
     uint64_t                                    timeout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkWaitSemaphoresKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkWaitSemaphoresKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -5291,7 +5292,7 @@ void VulkanExportJsonConsumer::Process_vkSignalSemaphoreKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkSemaphoreSignalInfo>* pSignalInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSignalSemaphoreKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkSignalSemaphoreKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -5307,7 +5308,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceFragmentShadingRatesKH
     PointerDecoder<uint32_t>*                   pFragmentShadingRateCount,
     StructPointerDecoder<Decoded_VkPhysicalDeviceFragmentShadingRateKHR>* pFragmentShadingRates)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFragmentShadingRatesKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFragmentShadingRatesKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -5323,7 +5324,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetFragmentShadingRateKHR(
     StructPointerDecoder<Decoded_VkExtent2D>*   pFragmentSize,
     PointerDecoder<VkFragmentShadingRateCombinerOpKHR>* combinerOps)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetFragmentShadingRateKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetFragmentShadingRateKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -5338,7 +5339,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetRenderingAttachmentLocationsKHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkRenderingAttachmentLocationInfoKHR>* pLocationInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetRenderingAttachmentLocationsKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetRenderingAttachmentLocationsKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -5352,7 +5353,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetRenderingInputAttachmentIndicesKH
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkRenderingInputAttachmentIndexInfoKHR>* pInputAttachmentIndexInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetRenderingInputAttachmentIndicesKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetRenderingInputAttachmentIndicesKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -5369,7 +5370,7 @@ void VulkanExportJsonConsumer::Process_vkWaitForPresentKHR(
     uint64_t                                    presentId,
     uint64_t                                    timeout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkWaitForPresentKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkWaitForPresentKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -5386,7 +5387,7 @@ void VulkanExportJsonConsumer::Process_vkGetBufferDeviceAddressKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetBufferDeviceAddressKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetBufferDeviceAddressKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJsonAsHex(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -5401,7 +5402,7 @@ void VulkanExportJsonConsumer::Process_vkGetBufferOpaqueCaptureAddressKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetBufferOpaqueCaptureAddressKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetBufferOpaqueCaptureAddressKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -5416,7 +5417,7 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceMemoryOpaqueCaptureAddressKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDeviceMemoryOpaqueCaptureAddressInfo>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceMemoryOpaqueCaptureAddressKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDeviceMemoryOpaqueCaptureAddressKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -5432,7 +5433,7 @@ void VulkanExportJsonConsumer::Process_vkCreateDeferredOperationKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDeferredOperationKHR>* pDeferredOperation)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDeferredOperationKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateDeferredOperationKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -5448,7 +5449,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyDeferredOperationKHR(
     format::HandleId                            operation,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyDeferredOperationKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyDeferredOperationKHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -5463,7 +5464,7 @@ void VulkanExportJsonConsumer::Process_vkGetDeferredOperationMaxConcurrencyKHR(
     format::HandleId                            device,
     format::HandleId                            operation)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeferredOperationMaxConcurrencyKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDeferredOperationMaxConcurrencyKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -5478,7 +5479,7 @@ void VulkanExportJsonConsumer::Process_vkGetDeferredOperationResultKHR(
     format::HandleId                            device,
     format::HandleId                            operation)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeferredOperationResultKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDeferredOperationResultKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -5493,7 +5494,7 @@ void VulkanExportJsonConsumer::Process_vkDeferredOperationJoinKHR(
     format::HandleId                            device,
     format::HandleId                            operation)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDeferredOperationJoinKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDeferredOperationJoinKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -5510,7 +5511,7 @@ void VulkanExportJsonConsumer::Process_vkGetPipelineExecutablePropertiesKHR(
     PointerDecoder<uint32_t>*                   pExecutableCount,
     StructPointerDecoder<Decoded_VkPipelineExecutablePropertiesKHR>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPipelineExecutablePropertiesKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPipelineExecutablePropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -5529,7 +5530,7 @@ void VulkanExportJsonConsumer::Process_vkGetPipelineExecutableStatisticsKHR(
     PointerDecoder<uint32_t>*                   pStatisticCount,
     StructPointerDecoder<Decoded_VkPipelineExecutableStatisticKHR>* pStatistics)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPipelineExecutableStatisticsKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPipelineExecutableStatisticsKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -5548,7 +5549,7 @@ void VulkanExportJsonConsumer::Process_vkGetPipelineExecutableInternalRepresenta
     PointerDecoder<uint32_t>*                   pInternalRepresentationCount,
     StructPointerDecoder<Decoded_VkPipelineExecutableInternalRepresentationKHR>* pInternalRepresentations)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPipelineExecutableInternalRepresentationsKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPipelineExecutableInternalRepresentationsKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -5566,7 +5567,7 @@ void VulkanExportJsonConsumer::Process_vkMapMemory2KHR(
     StructPointerDecoder<Decoded_VkMemoryMapInfoKHR>* pMemoryMapInfo,
     PointerDecoder<uint64_t, void*>*            ppData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkMapMemory2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkMapMemory2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -5582,7 +5583,7 @@ void VulkanExportJsonConsumer::Process_vkUnmapMemory2KHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkMemoryUnmapInfoKHR>* pMemoryUnmapInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkUnmapMemory2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkUnmapMemory2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -5598,7 +5599,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceVideoEncodeQualityLeve
     StructPointerDecoder<Decoded_VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR>* pQualityLevelInfo,
     StructPointerDecoder<Decoded_VkVideoEncodeQualityLevelPropertiesKHR>* pQualityLevelProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -5617,7 +5618,7 @@ void VulkanExportJsonConsumer::Process_vkGetEncodedVideoSessionParametersKHR(
     PointerDecoder<size_t>*                     pDataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetEncodedVideoSessionParametersKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetEncodedVideoSessionParametersKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -5634,7 +5635,7 @@ void VulkanExportJsonConsumer::Process_vkCmdEncodeVideoKHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkVideoEncodeInfoKHR>* pEncodeInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEncodeVideoKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdEncodeVideoKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -5649,7 +5650,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetEvent2KHR(
     format::HandleId                            event,
     StructPointerDecoder<Decoded_VkDependencyInfo>* pDependencyInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetEvent2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetEvent2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -5665,7 +5666,7 @@ void VulkanExportJsonConsumer::Process_vkCmdResetEvent2KHR(
     format::HandleId                            event,
     VkPipelineStageFlags2                       stageMask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdResetEvent2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdResetEvent2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -5682,7 +5683,7 @@ void VulkanExportJsonConsumer::Process_vkCmdWaitEvents2KHR(
     HandlePointerDecoder<VkEvent>*              pEvents,
     StructPointerDecoder<Decoded_VkDependencyInfo>* pDependencyInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWaitEvents2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdWaitEvents2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -5698,7 +5699,7 @@ void VulkanExportJsonConsumer::Process_vkCmdPipelineBarrier2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkDependencyInfo>* pDependencyInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdPipelineBarrier2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdPipelineBarrier2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -5714,7 +5715,7 @@ void VulkanExportJsonConsumer::Process_vkCmdWriteTimestamp2KHR(
     format::HandleId                            queryPool,
     uint32_t                                    query)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWriteTimestamp2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdWriteTimestamp2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -5733,7 +5734,7 @@ void VulkanExportJsonConsumer::Process_vkQueueSubmit2KHR(
     StructPointerDecoder<Decoded_VkSubmitInfo2>* pSubmits,
     format::HandleId                            fence)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueueSubmit2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkQueueSubmit2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameSubmitIndex()], ++submit_index_, json_options);
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
@@ -5753,7 +5754,7 @@ void VulkanExportJsonConsumer::Process_vkCmdWriteBufferMarker2AMD(
     VkDeviceSize                                dstOffset,
     uint32_t                                    marker)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWriteBufferMarker2AMD");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdWriteBufferMarker2AMD");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -5771,7 +5772,7 @@ void VulkanExportJsonConsumer::Process_vkGetQueueCheckpointData2NV(
     PointerDecoder<uint32_t>*                   pCheckpointDataCount,
     StructPointerDecoder<Decoded_VkCheckpointData2NV>* pCheckpointData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetQueueCheckpointData2NV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetQueueCheckpointData2NV");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["queue"], queue, json_options);
@@ -5785,7 +5786,7 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyBuffer2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyBufferInfo2>* pCopyBufferInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyBuffer2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdCopyBuffer2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -5799,7 +5800,7 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyImage2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyImageInfo2>* pCopyImageInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyImage2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdCopyImage2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -5813,7 +5814,7 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyBufferToImage2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyBufferToImageInfo2>* pCopyBufferToImageInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyBufferToImage2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdCopyBufferToImage2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -5827,7 +5828,7 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyImageToBuffer2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyImageToBufferInfo2>* pCopyImageToBufferInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyImageToBuffer2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdCopyImageToBuffer2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -5841,7 +5842,7 @@ void VulkanExportJsonConsumer::Process_vkCmdBlitImage2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkBlitImageInfo2>* pBlitImageInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBlitImage2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdBlitImage2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -5855,7 +5856,7 @@ void VulkanExportJsonConsumer::Process_vkCmdResolveImage2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkResolveImageInfo2>* pResolveImageInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdResolveImage2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdResolveImage2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -5869,7 +5870,7 @@ void VulkanExportJsonConsumer::Process_vkCmdTraceRaysIndirect2KHR(
     format::HandleId                            commandBuffer,
     VkDeviceAddress                             indirectDeviceAddress)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdTraceRaysIndirect2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdTraceRaysIndirect2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -5884,7 +5885,7 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceBufferMemoryRequirementsKHR(
     StructPointerDecoder<Decoded_VkDeviceBufferMemoryRequirements>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceBufferMemoryRequirementsKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDeviceBufferMemoryRequirementsKHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -5899,7 +5900,7 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceImageMemoryRequirementsKHR(
     StructPointerDecoder<Decoded_VkDeviceImageMemoryRequirements>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceImageMemoryRequirementsKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDeviceImageMemoryRequirementsKHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -5915,7 +5916,7 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceImageSparseMemoryRequirementsK
     PointerDecoder<uint32_t>*                   pSparseMemoryRequirementCount,
     StructPointerDecoder<Decoded_VkSparseImageMemoryRequirements2>* pSparseMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceImageSparseMemoryRequirementsKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDeviceImageSparseMemoryRequirementsKHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -5933,7 +5934,7 @@ void VulkanExportJsonConsumer::Process_vkCmdBindIndexBuffer2KHR(
     VkDeviceSize                                size,
     VkIndexType                                 indexType)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindIndexBuffer2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdBindIndexBuffer2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -5951,7 +5952,7 @@ void VulkanExportJsonConsumer::Process_vkGetRenderingAreaGranularityKHR(
     StructPointerDecoder<Decoded_VkRenderingAreaInfoKHR>* pRenderingAreaInfo,
     StructPointerDecoder<Decoded_VkExtent2D>*   pGranularity)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetRenderingAreaGranularityKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetRenderingAreaGranularityKHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -5966,7 +5967,7 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceImageSubresourceLayoutKHR(
     StructPointerDecoder<Decoded_VkDeviceImageSubresourceInfoKHR>* pInfo,
     StructPointerDecoder<Decoded_VkSubresourceLayout2KHR>* pLayout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceImageSubresourceLayoutKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDeviceImageSubresourceLayoutKHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -5982,7 +5983,7 @@ void VulkanExportJsonConsumer::Process_vkGetImageSubresourceLayout2KHR(
     StructPointerDecoder<Decoded_VkImageSubresource2KHR>* pSubresource,
     StructPointerDecoder<Decoded_VkSubresourceLayout2KHR>* pLayout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageSubresourceLayout2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetImageSubresourceLayout2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -6000,7 +6001,7 @@ void VulkanExportJsonConsumer::Process_vkCreatePipelineBinariesKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     StructPointerDecoder<Decoded_VkPipelineBinaryHandlesInfoKHR>* pBinaries)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreatePipelineBinariesKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreatePipelineBinariesKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -6017,7 +6018,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyPipelineBinaryKHR(
     format::HandleId                            pipelineBinary,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyPipelineBinaryKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyPipelineBinaryKHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -6033,7 +6034,7 @@ void VulkanExportJsonConsumer::Process_vkGetPipelineKeyKHR(
     StructPointerDecoder<Decoded_VkPipelineCreateInfoKHR>* pPipelineCreateInfo,
     StructPointerDecoder<Decoded_VkPipelineBinaryKeyKHR>* pPipelineKey)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPipelineKeyKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPipelineKeyKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -6052,7 +6053,7 @@ void VulkanExportJsonConsumer::Process_vkGetPipelineBinaryDataKHR(
     PointerDecoder<size_t>*                     pPipelineBinaryDataSize,
     PointerDecoder<uint8_t>*                    pPipelineBinaryData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPipelineBinaryDataKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPipelineBinaryDataKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -6071,7 +6072,7 @@ void VulkanExportJsonConsumer::Process_vkReleaseCapturedPipelineDataKHR(
     StructPointerDecoder<Decoded_VkReleaseCapturedPipelineDataInfoKHR>* pInfo,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkReleaseCapturedPipelineDataKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkReleaseCapturedPipelineDataKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -6088,7 +6089,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceCooperativeMatrixPrope
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkCooperativeMatrixPropertiesKHR>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -6104,7 +6105,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetLineStippleKHR(
     uint32_t                                    lineStippleFactor,
     uint16_t                                    lineStipplePattern)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetLineStippleKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetLineStippleKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -6121,7 +6122,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceCalibrateableTimeDomai
     PointerDecoder<uint32_t>*                   pTimeDomainCount,
     PointerDecoder<VkTimeDomainKHR>*            pTimeDomains)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceCalibrateableTimeDomainsKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceCalibrateableTimeDomainsKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -6140,7 +6141,7 @@ void VulkanExportJsonConsumer::Process_vkGetCalibratedTimestampsKHR(
     PointerDecoder<uint64_t>*                   pTimestamps,
     PointerDecoder<uint64_t>*                   pMaxDeviation)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetCalibratedTimestampsKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetCalibratedTimestampsKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -6157,7 +6158,7 @@ void VulkanExportJsonConsumer::Process_vkCmdBindDescriptorSets2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkBindDescriptorSetsInfoKHR>* pBindDescriptorSetsInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindDescriptorSets2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdBindDescriptorSets2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -6171,7 +6172,7 @@ void VulkanExportJsonConsumer::Process_vkCmdPushConstants2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkPushConstantsInfoKHR>* pPushConstantsInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdPushConstants2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdPushConstants2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -6185,7 +6186,7 @@ void VulkanExportJsonConsumer::Process_vkCmdPushDescriptorSet2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkPushDescriptorSetInfoKHR>* pPushDescriptorSetInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdPushDescriptorSet2KHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdPushDescriptorSet2KHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -6199,7 +6200,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDescriptorBufferOffsets2EXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkSetDescriptorBufferOffsetsInfoEXT>* pSetDescriptorBufferOffsetsInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDescriptorBufferOffsets2EXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetDescriptorBufferOffsets2EXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -6213,7 +6214,7 @@ void VulkanExportJsonConsumer::Process_vkCmdBindDescriptorBufferEmbeddedSamplers
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkBindDescriptorBufferEmbeddedSamplersInfoEXT>* pBindDescriptorBufferEmbeddedSamplersInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindDescriptorBufferEmbeddedSamplers2EXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdBindDescriptorBufferEmbeddedSamplers2EXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -6228,7 +6229,7 @@ void VulkanExportJsonConsumer::Process_vkFrameBoundaryANDROID(
     format::HandleId                            semaphore,
     format::HandleId                            image)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkFrameBoundaryANDROID");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkFrameBoundaryANDROID");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -6245,7 +6246,7 @@ void VulkanExportJsonConsumer::Process_vkCreateDebugReportCallbackEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDebugReportCallbackEXT>* pCallback)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDebugReportCallbackEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateDebugReportCallbackEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -6262,7 +6263,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyDebugReportCallbackEXT(
     format::HandleId                            callback,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyDebugReportCallbackEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyDebugReportCallbackEXT");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["instance"], instance, json_options);
@@ -6282,7 +6283,7 @@ void VulkanExportJsonConsumer::Process_vkDebugReportMessageEXT(
     StringDecoder*                              pLayerPrefix,
     StringDecoder*                              pMessage)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDebugReportMessageEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDebugReportMessageEXT");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["instance"], instance, json_options);
@@ -6302,7 +6303,7 @@ void VulkanExportJsonConsumer::Process_vkDebugMarkerSetObjectTagEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDebugMarkerObjectTagInfoEXT>* pTagInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDebugMarkerSetObjectTagEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDebugMarkerSetObjectTagEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -6317,7 +6318,7 @@ void VulkanExportJsonConsumer::Process_vkDebugMarkerSetObjectNameEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDebugMarkerObjectNameInfoEXT>* pNameInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDebugMarkerSetObjectNameEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDebugMarkerSetObjectNameEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -6331,7 +6332,7 @@ void VulkanExportJsonConsumer::Process_vkCmdDebugMarkerBeginEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkDebugMarkerMarkerInfoEXT>* pMarkerInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDebugMarkerBeginEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdDebugMarkerBeginEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -6344,7 +6345,7 @@ void VulkanExportJsonConsumer::Process_vkCmdDebugMarkerEndEXT(
     const ApiCallInfo&                          call_info,
     format::HandleId                            commandBuffer)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDebugMarkerEndEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdDebugMarkerEndEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -6357,7 +6358,7 @@ void VulkanExportJsonConsumer::Process_vkCmdDebugMarkerInsertEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkDebugMarkerMarkerInfoEXT>* pMarkerInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDebugMarkerInsertEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdDebugMarkerInsertEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -6375,7 +6376,7 @@ void VulkanExportJsonConsumer::Process_vkCmdBindTransformFeedbackBuffersEXT(
     PointerDecoder<VkDeviceSize>*               pOffsets,
     PointerDecoder<VkDeviceSize>*               pSizes)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindTransformFeedbackBuffersEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdBindTransformFeedbackBuffersEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -6396,7 +6397,7 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginTransformFeedbackEXT(
     HandlePointerDecoder<VkBuffer>*             pCounterBuffers,
     PointerDecoder<VkDeviceSize>*               pCounterBufferOffsets)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginTransformFeedbackEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdBeginTransformFeedbackEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -6416,7 +6417,7 @@ void VulkanExportJsonConsumer::Process_vkCmdEndTransformFeedbackEXT(
     HandlePointerDecoder<VkBuffer>*             pCounterBuffers,
     PointerDecoder<VkDeviceSize>*               pCounterBufferOffsets)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndTransformFeedbackEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdEndTransformFeedbackEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -6436,7 +6437,7 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginQueryIndexedEXT(
     VkQueryControlFlags                         flags,
     uint32_t                                    index)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginQueryIndexedEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdBeginQueryIndexedEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -6455,7 +6456,7 @@ void VulkanExportJsonConsumer::Process_vkCmdEndQueryIndexedEXT(
     uint32_t                                    query,
     uint32_t                                    index)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndQueryIndexedEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdEndQueryIndexedEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -6476,7 +6477,7 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawIndirectByteCountEXT(
     uint32_t                                    counterOffset,
     uint32_t                                    vertexStride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndirectByteCountEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndirectByteCountEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -6496,7 +6497,7 @@ void VulkanExportJsonConsumer::Process_vkGetImageViewHandleNVX(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkImageViewHandleInfoNVX>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageViewHandleNVX");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetImageViewHandleNVX");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -6512,7 +6513,7 @@ void VulkanExportJsonConsumer::Process_vkGetImageViewAddressNVX(
     format::HandleId                            imageView,
     StructPointerDecoder<Decoded_VkImageViewAddressPropertiesNVX>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageViewAddressNVX");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetImageViewAddressNVX");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -6532,7 +6533,7 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawIndirectCountAMD(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndirectCountAMD");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndirectCountAMD");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -6556,7 +6557,7 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawIndexedIndirectCountAMD(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndexedIndirectCountAMD");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndexedIndirectCountAMD");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -6580,7 +6581,7 @@ void VulkanExportJsonConsumer::Process_vkGetShaderInfoAMD(
     PointerDecoder<size_t>*                     pInfoSize,
     PointerDecoder<uint8_t>*                    pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetShaderInfoAMD");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetShaderInfoAMD");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -6601,7 +6602,7 @@ void VulkanExportJsonConsumer::Process_vkCreateStreamDescriptorSurfaceGGP(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateStreamDescriptorSurfaceGGP");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateStreamDescriptorSurfaceGGP");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -6624,7 +6625,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceExternalImageFormatPro
     VkExternalMemoryHandleTypeFlagsNV           externalHandleType,
     StructPointerDecoder<Decoded_VkExternalImageFormatPropertiesNV>* pExternalImageFormatProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalImageFormatPropertiesNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalImageFormatPropertiesNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -6647,7 +6648,7 @@ void VulkanExportJsonConsumer::Process_vkGetMemoryWin32HandleNV(
     VkExternalMemoryHandleTypeFlagsNV           handleType,
     PointerDecoder<uint64_t, void*>*            pHandle)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMemoryWin32HandleNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetMemoryWin32HandleNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -6666,7 +6667,7 @@ void VulkanExportJsonConsumer::Process_vkCreateViSurfaceNN(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateViSurfaceNN");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateViSurfaceNN");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -6682,7 +6683,7 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginConditionalRenderingEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkConditionalRenderingBeginInfoEXT>* pConditionalRenderingBegin)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginConditionalRenderingEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdBeginConditionalRenderingEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -6695,7 +6696,7 @@ void VulkanExportJsonConsumer::Process_vkCmdEndConditionalRenderingEXT(
     const ApiCallInfo&                          call_info,
     format::HandleId                            commandBuffer)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndConditionalRenderingEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdEndConditionalRenderingEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -6710,7 +6711,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetViewportWScalingNV(
     uint32_t                                    viewportCount,
     StructPointerDecoder<Decoded_VkViewportWScalingNV>* pViewportWScalings)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetViewportWScalingNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetViewportWScalingNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -6727,7 +6728,7 @@ void VulkanExportJsonConsumer::Process_vkReleaseDisplayEXT(
     format::HandleId                            physicalDevice,
     format::HandleId                            display)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkReleaseDisplayEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkReleaseDisplayEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -6743,7 +6744,7 @@ void VulkanExportJsonConsumer::Process_vkAcquireXlibDisplayEXT(
     uint64_t                                    dpy,
     format::HandleId                            display)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAcquireXlibDisplayEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkAcquireXlibDisplayEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -6761,7 +6762,7 @@ void VulkanExportJsonConsumer::Process_vkGetRandROutputDisplayEXT(
     size_t                                      rrOutput,
     HandlePointerDecoder<VkDisplayKHR>*         pDisplay)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetRandROutputDisplayEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetRandROutputDisplayEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -6779,7 +6780,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfaceCapabilities2EX
     format::HandleId                            surface,
     StructPointerDecoder<Decoded_VkSurfaceCapabilities2EXT>* pSurfaceCapabilities)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceCapabilities2EXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceCapabilities2EXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -6796,7 +6797,7 @@ void VulkanExportJsonConsumer::Process_vkDisplayPowerControlEXT(
     format::HandleId                            display,
     StructPointerDecoder<Decoded_VkDisplayPowerInfoEXT>* pDisplayPowerInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDisplayPowerControlEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDisplayPowerControlEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -6814,7 +6815,7 @@ void VulkanExportJsonConsumer::Process_vkRegisterDeviceEventEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkFence>*              pFence)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkRegisterDeviceEventEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkRegisterDeviceEventEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -6834,7 +6835,7 @@ void VulkanExportJsonConsumer::Process_vkRegisterDisplayEventEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkFence>*              pFence)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkRegisterDisplayEventEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkRegisterDisplayEventEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -6854,7 +6855,7 @@ void VulkanExportJsonConsumer::Process_vkGetSwapchainCounterEXT(
     VkSurfaceCounterFlagBitsEXT                 counter,
     PointerDecoder<uint64_t>*                   pCounterValue)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetSwapchainCounterEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetSwapchainCounterEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -6872,7 +6873,7 @@ void VulkanExportJsonConsumer::Process_vkGetRefreshCycleDurationGOOGLE(
     format::HandleId                            swapchain,
     StructPointerDecoder<Decoded_VkRefreshCycleDurationGOOGLE>* pDisplayTimingProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetRefreshCycleDurationGOOGLE");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetRefreshCycleDurationGOOGLE");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -6890,7 +6891,7 @@ void VulkanExportJsonConsumer::Process_vkGetPastPresentationTimingGOOGLE(
     PointerDecoder<uint32_t>*                   pPresentationTimingCount,
     StructPointerDecoder<Decoded_VkPastPresentationTimingGOOGLE>* pPresentationTimings)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPastPresentationTimingGOOGLE");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPastPresentationTimingGOOGLE");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -6908,7 +6909,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDiscardRectangleEXT(
     uint32_t                                    discardRectangleCount,
     StructPointerDecoder<Decoded_VkRect2D>*     pDiscardRectangles)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDiscardRectangleEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetDiscardRectangleEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -6924,7 +6925,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDiscardRectangleEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    discardRectangleEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDiscardRectangleEnableEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetDiscardRectangleEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -6938,7 +6939,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDiscardRectangleModeEXT(
     format::HandleId                            commandBuffer,
     VkDiscardRectangleModeEXT                   discardRectangleMode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDiscardRectangleModeEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetDiscardRectangleModeEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -6954,7 +6955,7 @@ void VulkanExportJsonConsumer::Process_vkSetHdrMetadataEXT(
     HandlePointerDecoder<VkSwapchainKHR>*       pSwapchains,
     StructPointerDecoder<Decoded_VkHdrMetadataEXT>* pMetadata)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSetHdrMetadataEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkSetHdrMetadataEXT");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -6972,7 +6973,7 @@ void VulkanExportJsonConsumer::Process_vkCreateIOSSurfaceMVK(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateIOSSurfaceMVK");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateIOSSurfaceMVK");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -6991,7 +6992,7 @@ void VulkanExportJsonConsumer::Process_vkCreateMacOSSurfaceMVK(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateMacOSSurfaceMVK");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateMacOSSurfaceMVK");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -7008,7 +7009,7 @@ void VulkanExportJsonConsumer::Process_vkSetDebugUtilsObjectNameEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDebugUtilsObjectNameInfoEXT>* pNameInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSetDebugUtilsObjectNameEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkSetDebugUtilsObjectNameEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -7023,7 +7024,7 @@ void VulkanExportJsonConsumer::Process_vkSetDebugUtilsObjectTagEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDebugUtilsObjectTagInfoEXT>* pTagInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSetDebugUtilsObjectTagEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkSetDebugUtilsObjectTagEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -7037,7 +7038,7 @@ void VulkanExportJsonConsumer::Process_vkQueueBeginDebugUtilsLabelEXT(
     format::HandleId                            queue,
     StructPointerDecoder<Decoded_VkDebugUtilsLabelEXT>* pLabelInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueueBeginDebugUtilsLabelEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkQueueBeginDebugUtilsLabelEXT");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["queue"], queue, json_options);
@@ -7049,7 +7050,7 @@ void VulkanExportJsonConsumer::Process_vkQueueEndDebugUtilsLabelEXT(
     const ApiCallInfo&                          call_info,
     format::HandleId                            queue)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueueEndDebugUtilsLabelEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkQueueEndDebugUtilsLabelEXT");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["queue"], queue, json_options);
@@ -7061,7 +7062,7 @@ void VulkanExportJsonConsumer::Process_vkQueueInsertDebugUtilsLabelEXT(
     format::HandleId                            queue,
     StructPointerDecoder<Decoded_VkDebugUtilsLabelEXT>* pLabelInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueueInsertDebugUtilsLabelEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkQueueInsertDebugUtilsLabelEXT");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["queue"], queue, json_options);
@@ -7074,7 +7075,7 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginDebugUtilsLabelEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkDebugUtilsLabelEXT>* pLabelInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginDebugUtilsLabelEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdBeginDebugUtilsLabelEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -7087,7 +7088,7 @@ void VulkanExportJsonConsumer::Process_vkCmdEndDebugUtilsLabelEXT(
     const ApiCallInfo&                          call_info,
     format::HandleId                            commandBuffer)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndDebugUtilsLabelEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdEndDebugUtilsLabelEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -7100,7 +7101,7 @@ void VulkanExportJsonConsumer::Process_vkCmdInsertDebugUtilsLabelEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkDebugUtilsLabelEXT>* pLabelInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdInsertDebugUtilsLabelEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdInsertDebugUtilsLabelEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -7117,7 +7118,7 @@ void VulkanExportJsonConsumer::Process_vkCreateDebugUtilsMessengerEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDebugUtilsMessengerEXT>* pMessenger)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDebugUtilsMessengerEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateDebugUtilsMessengerEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -7134,7 +7135,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyDebugUtilsMessengerEXT(
     format::HandleId                            messenger,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyDebugUtilsMessengerEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyDebugUtilsMessengerEXT");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["instance"], instance, json_options);
@@ -7150,7 +7151,7 @@ void VulkanExportJsonConsumer::Process_vkSubmitDebugUtilsMessageEXT(
     VkDebugUtilsMessageTypeFlagsEXT             messageTypes,
     StructPointerDecoder<Decoded_VkDebugUtilsMessengerCallbackDataEXT>* pCallbackData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSubmitDebugUtilsMessageEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkSubmitDebugUtilsMessageEXT");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["instance"], instance, json_options);
@@ -7167,7 +7168,7 @@ void VulkanExportJsonConsumer::Process_vkGetAndroidHardwareBufferPropertiesANDRO
     uint64_t                                    buffer,
     StructPointerDecoder<Decoded_VkAndroidHardwareBufferPropertiesANDROID>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetAndroidHardwareBufferPropertiesANDROID");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetAndroidHardwareBufferPropertiesANDROID");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -7184,7 +7185,7 @@ void VulkanExportJsonConsumer::Process_vkGetMemoryAndroidHardwareBufferANDROID(
     StructPointerDecoder<Decoded_VkMemoryGetAndroidHardwareBufferInfoANDROID>* pInfo,
     PointerDecoder<uint64_t, void*>*            pBuffer)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMemoryAndroidHardwareBufferANDROID");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetMemoryAndroidHardwareBufferANDROID");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -7199,7 +7200,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetSampleLocationsEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkSampleLocationsInfoEXT>* pSampleLocationsInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetSampleLocationsEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetSampleLocationsEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -7214,7 +7215,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceMultisamplePropertiesE
     VkSampleCountFlagBits                       samples,
     StructPointerDecoder<Decoded_VkMultisamplePropertiesEXT>* pMultisampleProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceMultisamplePropertiesEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceMultisamplePropertiesEXT");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["physicalDevice"], physicalDevice, json_options);
@@ -7230,7 +7231,7 @@ void VulkanExportJsonConsumer::Process_vkGetImageDrmFormatModifierPropertiesEXT(
     format::HandleId                            image,
     StructPointerDecoder<Decoded_VkImageDrmFormatModifierPropertiesEXT>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageDrmFormatModifierPropertiesEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetImageDrmFormatModifierPropertiesEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -7248,7 +7249,7 @@ void VulkanExportJsonConsumer::Process_vkCreateValidationCacheEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkValidationCacheEXT>* pValidationCache)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateValidationCacheEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateValidationCacheEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -7265,7 +7266,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyValidationCacheEXT(
     format::HandleId                            validationCache,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyValidationCacheEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyValidationCacheEXT");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -7282,7 +7283,7 @@ void VulkanExportJsonConsumer::Process_vkMergeValidationCachesEXT(
     uint32_t                                    srcCacheCount,
     HandlePointerDecoder<VkValidationCacheEXT>* pSrcCaches)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkMergeValidationCachesEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkMergeValidationCachesEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -7301,7 +7302,7 @@ void VulkanExportJsonConsumer::Process_vkGetValidationCacheDataEXT(
     PointerDecoder<size_t>*                     pDataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetValidationCacheDataEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetValidationCacheDataEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -7318,7 +7319,7 @@ void VulkanExportJsonConsumer::Process_vkCmdBindShadingRateImageNV(
     format::HandleId                            imageView,
     VkImageLayout                               imageLayout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindShadingRateImageNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdBindShadingRateImageNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -7335,7 +7336,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetViewportShadingRatePaletteNV(
     uint32_t                                    viewportCount,
     StructPointerDecoder<Decoded_VkShadingRatePaletteNV>* pShadingRatePalettes)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetViewportShadingRatePaletteNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetViewportShadingRatePaletteNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -7353,7 +7354,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetCoarseSampleOrderNV(
     uint32_t                                    customSampleOrderCount,
     StructPointerDecoder<Decoded_VkCoarseSampleOrderCustomNV>* pCustomSampleOrders)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetCoarseSampleOrderNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetCoarseSampleOrderNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -7372,7 +7373,7 @@ void VulkanExportJsonConsumer::Process_vkCreateAccelerationStructureNV(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkAccelerationStructureNV>* pAccelerationStructure)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateAccelerationStructureNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateAccelerationStructureNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -7389,7 +7390,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyAccelerationStructureNV(
     format::HandleId                            accelerationStructure,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyAccelerationStructureNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyAccelerationStructureNV");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -7404,7 +7405,7 @@ void VulkanExportJsonConsumer::Process_vkGetAccelerationStructureMemoryRequireme
     StructPointerDecoder<Decoded_VkAccelerationStructureMemoryRequirementsInfoNV>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2KHR>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetAccelerationStructureMemoryRequirementsNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetAccelerationStructureMemoryRequirementsNV");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -7420,7 +7421,7 @@ void VulkanExportJsonConsumer::Process_vkBindAccelerationStructureMemoryNV(
     uint32_t                                    bindInfoCount,
     StructPointerDecoder<Decoded_VkBindAccelerationStructureMemoryInfoNV>* pBindInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBindAccelerationStructureMemoryNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkBindAccelerationStructureMemoryNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -7442,7 +7443,7 @@ void VulkanExportJsonConsumer::Process_vkCmdBuildAccelerationStructureNV(
     format::HandleId                            scratch,
     VkDeviceSize                                scratchOffset)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBuildAccelerationStructureNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdBuildAccelerationStructureNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -7465,7 +7466,7 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyAccelerationStructureNV(
     format::HandleId                            src,
     VkCopyAccelerationStructureModeKHR          mode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyAccelerationStructureNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdCopyAccelerationStructureNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -7494,7 +7495,7 @@ void VulkanExportJsonConsumer::Process_vkCmdTraceRaysNV(
     uint32_t                                    height,
     uint32_t                                    depth)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdTraceRaysNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdTraceRaysNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -7526,7 +7527,7 @@ void VulkanExportJsonConsumer::Process_vkCreateRayTracingPipelinesNV(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPipeline>*           pPipelines)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateRayTracingPipelinesNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateRayTracingPipelinesNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -7549,7 +7550,7 @@ void VulkanExportJsonConsumer::Process_vkGetRayTracingShaderGroupHandlesKHR(
     size_t                                      dataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetRayTracingShaderGroupHandlesKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetRayTracingShaderGroupHandlesKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -7572,7 +7573,7 @@ void VulkanExportJsonConsumer::Process_vkGetRayTracingShaderGroupHandlesNV(
     size_t                                      dataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetRayTracingShaderGroupHandlesNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetRayTracingShaderGroupHandlesNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -7593,7 +7594,7 @@ void VulkanExportJsonConsumer::Process_vkGetAccelerationStructureHandleNV(
     size_t                                      dataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetAccelerationStructureHandleNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetAccelerationStructureHandleNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -7613,7 +7614,7 @@ void VulkanExportJsonConsumer::Process_vkCmdWriteAccelerationStructuresPropertie
     format::HandleId                            queryPool,
     uint32_t                                    firstQuery)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWriteAccelerationStructuresPropertiesNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdWriteAccelerationStructuresPropertiesNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -7633,7 +7634,7 @@ void VulkanExportJsonConsumer::Process_vkCompileDeferredNV(
     format::HandleId                            pipeline,
     uint32_t                                    shader)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCompileDeferredNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCompileDeferredNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -7651,7 +7652,7 @@ void VulkanExportJsonConsumer::Process_vkGetMemoryHostPointerPropertiesEXT(
     uint64_t                                    pHostPointer,
     StructPointerDecoder<Decoded_VkMemoryHostPointerPropertiesEXT>* pMemoryHostPointerProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMemoryHostPointerPropertiesEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetMemoryHostPointerPropertiesEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -7670,7 +7671,7 @@ void VulkanExportJsonConsumer::Process_vkCmdWriteBufferMarkerAMD(
     VkDeviceSize                                dstOffset,
     uint32_t                                    marker)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWriteBufferMarkerAMD");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdWriteBufferMarkerAMD");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -7689,7 +7690,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceCalibrateableTimeDomai
     PointerDecoder<uint32_t>*                   pTimeDomainCount,
     PointerDecoder<VkTimeDomainKHR>*            pTimeDomains)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -7708,7 +7709,7 @@ void VulkanExportJsonConsumer::Process_vkGetCalibratedTimestampsEXT(
     PointerDecoder<uint64_t>*                   pTimestamps,
     PointerDecoder<uint64_t>*                   pMaxDeviation)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetCalibratedTimestampsEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetCalibratedTimestampsEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -7726,7 +7727,7 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawMeshTasksNV(
     uint32_t                                    taskCount,
     uint32_t                                    firstTask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawMeshTasksNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdDrawMeshTasksNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -7744,7 +7745,7 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawMeshTasksIndirectNV(
     uint32_t                                    drawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawMeshTasksIndirectNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdDrawMeshTasksIndirectNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -7766,7 +7767,7 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawMeshTasksIndirectCountNV(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawMeshTasksIndirectCountNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdDrawMeshTasksIndirectCountNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -7787,7 +7788,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetExclusiveScissorEnableNV(
     uint32_t                                    exclusiveScissorCount,
     PointerDecoder<VkBool32>*                   pExclusiveScissorEnables)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetExclusiveScissorEnableNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetExclusiveScissorEnableNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -7805,7 +7806,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetExclusiveScissorNV(
     uint32_t                                    exclusiveScissorCount,
     StructPointerDecoder<Decoded_VkRect2D>*     pExclusiveScissors)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetExclusiveScissorNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetExclusiveScissorNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -7821,7 +7822,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetCheckpointNV(
     format::HandleId                            commandBuffer,
     uint64_t                                    pCheckpointMarker)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetCheckpointNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetCheckpointNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -7836,7 +7837,7 @@ void VulkanExportJsonConsumer::Process_vkGetQueueCheckpointDataNV(
     PointerDecoder<uint32_t>*                   pCheckpointDataCount,
     StructPointerDecoder<Decoded_VkCheckpointDataNV>* pCheckpointData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetQueueCheckpointDataNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetQueueCheckpointDataNV");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["queue"], queue, json_options);
@@ -7851,7 +7852,7 @@ void VulkanExportJsonConsumer::Process_vkInitializePerformanceApiINTEL(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkInitializePerformanceApiInfoINTEL>* pInitializeInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkInitializePerformanceApiINTEL");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkInitializePerformanceApiINTEL");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -7864,7 +7865,7 @@ void VulkanExportJsonConsumer::Process_vkUninitializePerformanceApiINTEL(
     const ApiCallInfo&                          call_info,
     format::HandleId                            device)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkUninitializePerformanceApiINTEL");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkUninitializePerformanceApiINTEL");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -7877,7 +7878,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetPerformanceMarkerINTEL(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkPerformanceMarkerInfoINTEL>* pMarkerInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetPerformanceMarkerINTEL");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetPerformanceMarkerINTEL");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
@@ -7893,7 +7894,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetPerformanceStreamMarkerINTEL(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkPerformanceStreamMarkerInfoINTEL>* pMarkerInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetPerformanceStreamMarkerINTEL");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetPerformanceStreamMarkerINTEL");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
@@ -7909,7 +7910,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetPerformanceOverrideINTEL(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkPerformanceOverrideInfoINTEL>* pOverrideInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetPerformanceOverrideINTEL");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetPerformanceOverrideINTEL");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
@@ -7926,7 +7927,7 @@ void VulkanExportJsonConsumer::Process_vkAcquirePerformanceConfigurationINTEL(
     StructPointerDecoder<Decoded_VkPerformanceConfigurationAcquireInfoINTEL>* pAcquireInfo,
     HandlePointerDecoder<VkPerformanceConfigurationINTEL>* pConfiguration)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAcquirePerformanceConfigurationINTEL");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkAcquirePerformanceConfigurationINTEL");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -7942,7 +7943,7 @@ void VulkanExportJsonConsumer::Process_vkReleasePerformanceConfigurationINTEL(
     format::HandleId                            device,
     format::HandleId                            configuration)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkReleasePerformanceConfigurationINTEL");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkReleasePerformanceConfigurationINTEL");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -7957,7 +7958,7 @@ void VulkanExportJsonConsumer::Process_vkQueueSetPerformanceConfigurationINTEL(
     format::HandleId                            queue,
     format::HandleId                            configuration)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueueSetPerformanceConfigurationINTEL");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkQueueSetPerformanceConfigurationINTEL");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -7973,7 +7974,7 @@ void VulkanExportJsonConsumer::Process_vkGetPerformanceParameterINTEL(
     VkPerformanceParameterTypeINTEL             parameter,
     StructPointerDecoder<Decoded_VkPerformanceValueINTEL>* pValue)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPerformanceParameterINTEL");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPerformanceParameterINTEL");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -7989,7 +7990,7 @@ void VulkanExportJsonConsumer::Process_vkSetLocalDimmingAMD(
     format::HandleId                            swapChain,
     VkBool32                                    localDimmingEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSetLocalDimmingAMD");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkSetLocalDimmingAMD");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -8006,7 +8007,7 @@ void VulkanExportJsonConsumer::Process_vkCreateImagePipeSurfaceFUCHSIA(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateImagePipeSurfaceFUCHSIA");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateImagePipeSurfaceFUCHSIA");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -8025,7 +8026,7 @@ void VulkanExportJsonConsumer::Process_vkCreateMetalSurfaceEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateMetalSurfaceEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateMetalSurfaceEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -8042,7 +8043,7 @@ void VulkanExportJsonConsumer::Process_vkGetBufferDeviceAddressEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetBufferDeviceAddressEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetBufferDeviceAddressEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJsonAsHex(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -8058,7 +8059,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceToolPropertiesEXT(
     PointerDecoder<uint32_t>*                   pToolCount,
     StructPointerDecoder<Decoded_VkPhysicalDeviceToolProperties>* pToolProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceToolPropertiesEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceToolPropertiesEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -8075,7 +8076,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceCooperativeMatrixPrope
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkCooperativeMatrixPropertiesNV>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceCooperativeMatrixPropertiesNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceCooperativeMatrixPropertiesNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -8092,7 +8093,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSupportedFramebufferMi
     PointerDecoder<uint32_t>*                   pCombinationCount,
     StructPointerDecoder<Decoded_VkFramebufferMixedSamplesCombinationNV>* pCombinations)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -8110,7 +8111,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfacePresentModes2EX
     PointerDecoder<uint32_t>*                   pPresentModeCount,
     PointerDecoder<VkPresentModeKHR>*           pPresentModes)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfacePresentModes2EXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfacePresentModes2EXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -8127,7 +8128,7 @@ void VulkanExportJsonConsumer::Process_vkAcquireFullScreenExclusiveModeEXT(
     format::HandleId                            device,
     format::HandleId                            swapchain)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAcquireFullScreenExclusiveModeEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkAcquireFullScreenExclusiveModeEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -8142,7 +8143,7 @@ void VulkanExportJsonConsumer::Process_vkReleaseFullScreenExclusiveModeEXT(
     format::HandleId                            device,
     format::HandleId                            swapchain)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkReleaseFullScreenExclusiveModeEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkReleaseFullScreenExclusiveModeEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -8158,7 +8159,7 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceGroupSurfacePresentModes2EXT(
     StructPointerDecoder<Decoded_VkPhysicalDeviceSurfaceInfo2KHR>* pSurfaceInfo,
     PointerDecoder<VkDeviceGroupPresentModeFlagsKHR>* pModes)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceGroupSurfacePresentModes2EXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDeviceGroupSurfacePresentModes2EXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -8176,7 +8177,7 @@ void VulkanExportJsonConsumer::Process_vkCreateHeadlessSurfaceEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateHeadlessSurfaceEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateHeadlessSurfaceEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -8193,7 +8194,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetLineStippleEXT(
     uint32_t                                    lineStippleFactor,
     uint16_t                                    lineStipplePattern)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetLineStippleEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetLineStippleEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -8210,7 +8211,7 @@ void VulkanExportJsonConsumer::Process_vkResetQueryPoolEXT(
     uint32_t                                    firstQuery,
     uint32_t                                    queryCount)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkResetQueryPoolEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkResetQueryPoolEXT");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -8225,7 +8226,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetCullModeEXT(
     format::HandleId                            commandBuffer,
     VkCullModeFlags                             cullMode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetCullModeEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetCullModeEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -8239,7 +8240,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetFrontFaceEXT(
     format::HandleId                            commandBuffer,
     VkFrontFace                                 frontFace)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetFrontFaceEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetFrontFaceEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -8253,7 +8254,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetPrimitiveTopologyEXT(
     format::HandleId                            commandBuffer,
     VkPrimitiveTopology                         primitiveTopology)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetPrimitiveTopologyEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetPrimitiveTopologyEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -8268,7 +8269,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetViewportWithCountEXT(
     uint32_t                                    viewportCount,
     StructPointerDecoder<Decoded_VkViewport>*   pViewports)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetViewportWithCountEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetViewportWithCountEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -8284,7 +8285,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetScissorWithCountEXT(
     uint32_t                                    scissorCount,
     StructPointerDecoder<Decoded_VkRect2D>*     pScissors)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetScissorWithCountEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetScissorWithCountEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -8304,7 +8305,7 @@ void VulkanExportJsonConsumer::Process_vkCmdBindVertexBuffers2EXT(
     PointerDecoder<VkDeviceSize>*               pSizes,
     PointerDecoder<VkDeviceSize>*               pStrides)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindVertexBuffers2EXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdBindVertexBuffers2EXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -8323,7 +8324,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthTestEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthTestEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthTestEnableEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthTestEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -8337,7 +8338,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthWriteEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthWriteEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthWriteEnableEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthWriteEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -8351,7 +8352,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthCompareOpEXT(
     format::HandleId                            commandBuffer,
     VkCompareOp                                 depthCompareOp)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthCompareOpEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthCompareOpEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -8365,7 +8366,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthBoundsTestEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthBoundsTestEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthBoundsTestEnableEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthBoundsTestEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -8379,7 +8380,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetStencilTestEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    stencilTestEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetStencilTestEnableEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetStencilTestEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -8397,7 +8398,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetStencilOpEXT(
     VkStencilOp                                 depthFailOp,
     VkCompareOp                                 compareOp)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetStencilOpEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetStencilOpEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -8416,7 +8417,7 @@ void VulkanExportJsonConsumer::Process_vkCopyMemoryToImageEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkCopyMemoryToImageInfoEXT>* pCopyMemoryToImageInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCopyMemoryToImageEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCopyMemoryToImageEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -8431,7 +8432,7 @@ void VulkanExportJsonConsumer::Process_vkCopyImageToMemoryEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkCopyImageToMemoryInfoEXT>* pCopyImageToMemoryInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCopyImageToMemoryEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCopyImageToMemoryEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -8446,7 +8447,7 @@ void VulkanExportJsonConsumer::Process_vkCopyImageToImageEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkCopyImageToImageInfoEXT>* pCopyImageToImageInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCopyImageToImageEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCopyImageToImageEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -8462,7 +8463,7 @@ void VulkanExportJsonConsumer::Process_vkTransitionImageLayoutEXT(
     uint32_t                                    transitionCount,
     StructPointerDecoder<Decoded_VkHostImageLayoutTransitionInfoEXT>* pTransitions)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkTransitionImageLayoutEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkTransitionImageLayoutEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -8479,7 +8480,7 @@ void VulkanExportJsonConsumer::Process_vkGetImageSubresourceLayout2EXT(
     StructPointerDecoder<Decoded_VkImageSubresource2KHR>* pSubresource,
     StructPointerDecoder<Decoded_VkSubresourceLayout2KHR>* pLayout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageSubresourceLayout2EXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetImageSubresourceLayout2EXT");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -8495,7 +8496,7 @@ void VulkanExportJsonConsumer::Process_vkReleaseSwapchainImagesEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkReleaseSwapchainImagesInfoEXT>* pReleaseInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkReleaseSwapchainImagesEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkReleaseSwapchainImagesEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -8510,7 +8511,7 @@ void VulkanExportJsonConsumer::Process_vkGetGeneratedCommandsMemoryRequirementsN
     StructPointerDecoder<Decoded_VkGeneratedCommandsMemoryRequirementsInfoNV>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetGeneratedCommandsMemoryRequirementsNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetGeneratedCommandsMemoryRequirementsNV");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -8524,7 +8525,7 @@ void VulkanExportJsonConsumer::Process_vkCmdPreprocessGeneratedCommandsNV(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkGeneratedCommandsInfoNV>* pGeneratedCommandsInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdPreprocessGeneratedCommandsNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdPreprocessGeneratedCommandsNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -8539,7 +8540,7 @@ void VulkanExportJsonConsumer::Process_vkCmdExecuteGeneratedCommandsNV(
     VkBool32                                    isPreprocessed,
     StructPointerDecoder<Decoded_VkGeneratedCommandsInfoNV>* pGeneratedCommandsInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdExecuteGeneratedCommandsNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdExecuteGeneratedCommandsNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -8556,7 +8557,7 @@ void VulkanExportJsonConsumer::Process_vkCmdBindPipelineShaderGroupNV(
     format::HandleId                            pipeline,
     uint32_t                                    groupIndex)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindPipelineShaderGroupNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdBindPipelineShaderGroupNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -8575,7 +8576,7 @@ void VulkanExportJsonConsumer::Process_vkCreateIndirectCommandsLayoutNV(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkIndirectCommandsLayoutNV>* pIndirectCommandsLayout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateIndirectCommandsLayoutNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateIndirectCommandsLayoutNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -8592,7 +8593,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyIndirectCommandsLayoutNV(
     format::HandleId                            indirectCommandsLayout,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyIndirectCommandsLayoutNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyIndirectCommandsLayoutNV");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -8606,7 +8607,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthBias2EXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkDepthBiasInfoEXT>* pDepthBiasInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthBias2EXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthBias2EXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -8622,7 +8623,7 @@ void VulkanExportJsonConsumer::Process_vkAcquireDrmDisplayEXT(
     int32_t                                     drmFd,
     format::HandleId                            display)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAcquireDrmDisplayEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkAcquireDrmDisplayEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -8640,7 +8641,7 @@ void VulkanExportJsonConsumer::Process_vkGetDrmDisplayEXT(
     uint32_t                                    connectorId,
     HandlePointerDecoder<VkDisplayKHR>*         display)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDrmDisplayEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDrmDisplayEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -8659,7 +8660,7 @@ void VulkanExportJsonConsumer::Process_vkCreatePrivateDataSlotEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPrivateDataSlot>*    pPrivateDataSlot)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreatePrivateDataSlotEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreatePrivateDataSlotEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -8676,7 +8677,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyPrivateDataSlotEXT(
     format::HandleId                            privateDataSlot,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyPrivateDataSlotEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyPrivateDataSlotEXT");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -8694,7 +8695,7 @@ void VulkanExportJsonConsumer::Process_vkSetPrivateDataEXT(
     format::HandleId                            privateDataSlot,
     uint64_t                                    data)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSetPrivateDataEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkSetPrivateDataEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -8714,7 +8715,7 @@ void VulkanExportJsonConsumer::Process_vkGetPrivateDataEXT(
     format::HandleId                            privateDataSlot,
     PointerDecoder<uint64_t>*                   pData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPrivateDataEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPrivateDataEXT");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -8731,7 +8732,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetFragmentShadingRateEnumNV(
     VkFragmentShadingRateNV                     shadingRate,
     PointerDecoder<VkFragmentShadingRateCombinerOpKHR>* combinerOps)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetFragmentShadingRateEnumNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetFragmentShadingRateEnumNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -8748,7 +8749,7 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceFaultInfoEXT(
     StructPointerDecoder<Decoded_VkDeviceFaultCountsEXT>* pFaultCounts,
     StructPointerDecoder<Decoded_VkDeviceFaultInfoEXT>* pFaultInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceFaultInfoEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDeviceFaultInfoEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -8764,7 +8765,7 @@ void VulkanExportJsonConsumer::Process_vkAcquireWinrtDisplayNV(
     format::HandleId                            physicalDevice,
     format::HandleId                            display)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAcquireWinrtDisplayNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkAcquireWinrtDisplayNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -8780,7 +8781,7 @@ void VulkanExportJsonConsumer::Process_vkGetWinrtDisplayNV(
     uint32_t                                    deviceRelativeId,
     HandlePointerDecoder<VkDisplayKHR>*         pDisplay)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetWinrtDisplayNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetWinrtDisplayNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -8798,7 +8799,7 @@ void VulkanExportJsonConsumer::Process_vkCreateDirectFBSurfaceEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDirectFBSurfaceEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateDirectFBSurfaceEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -8816,7 +8817,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceDirectFBPresentationSu
     uint32_t                                    queueFamilyIndex,
     uint64_t                                    dfb)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceDirectFBPresentationSupportEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceDirectFBPresentationSupportEXT");
     const JsonOptions& json_options = GetJsonOptions();
             Bool32ToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -8834,7 +8835,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetVertexInputEXT(
     uint32_t                                    vertexAttributeDescriptionCount,
     StructPointerDecoder<Decoded_VkVertexInputAttributeDescription2EXT>* pVertexAttributeDescriptions)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetVertexInputEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetVertexInputEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -8853,7 +8854,7 @@ void VulkanExportJsonConsumer::Process_vkGetMemoryZirconHandleFUCHSIA(
     StructPointerDecoder<Decoded_VkMemoryGetZirconHandleInfoFUCHSIA>* pGetZirconHandleInfo,
     PointerDecoder<uint32_t>*                   pZirconHandle)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMemoryZirconHandleFUCHSIA");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetMemoryZirconHandleFUCHSIA");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -8871,7 +8872,7 @@ void VulkanExportJsonConsumer::Process_vkGetMemoryZirconHandlePropertiesFUCHSIA(
     uint32_t                                    zirconHandle,
     StructPointerDecoder<Decoded_VkMemoryZirconHandlePropertiesFUCHSIA>* pMemoryZirconHandleProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMemoryZirconHandlePropertiesFUCHSIA");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetMemoryZirconHandlePropertiesFUCHSIA");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -8888,7 +8889,7 @@ void VulkanExportJsonConsumer::Process_vkImportSemaphoreZirconHandleFUCHSIA(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkImportSemaphoreZirconHandleInfoFUCHSIA>* pImportSemaphoreZirconHandleInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkImportSemaphoreZirconHandleFUCHSIA");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkImportSemaphoreZirconHandleFUCHSIA");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -8904,7 +8905,7 @@ void VulkanExportJsonConsumer::Process_vkGetSemaphoreZirconHandleFUCHSIA(
     StructPointerDecoder<Decoded_VkSemaphoreGetZirconHandleInfoFUCHSIA>* pGetZirconHandleInfo,
     PointerDecoder<uint32_t>*                   pZirconHandle)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetSemaphoreZirconHandleFUCHSIA");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetSemaphoreZirconHandleFUCHSIA");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -8920,7 +8921,7 @@ void VulkanExportJsonConsumer::Process_vkCmdBindInvocationMaskHUAWEI(
     format::HandleId                            imageView,
     VkImageLayout                               imageLayout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindInvocationMaskHUAWEI");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdBindInvocationMaskHUAWEI");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -8937,7 +8938,7 @@ void VulkanExportJsonConsumer::Process_vkGetMemoryRemoteAddressNV(
     StructPointerDecoder<Decoded_VkMemoryGetRemoteAddressInfoNV>* pMemoryGetRemoteAddressInfo,
     PointerDecoder<uint64_t, void*>*            pAddress)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMemoryRemoteAddressNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetMemoryRemoteAddressNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -8952,7 +8953,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetPatchControlPointsEXT(
     format::HandleId                            commandBuffer,
     uint32_t                                    patchControlPoints)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetPatchControlPointsEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetPatchControlPointsEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -8966,7 +8967,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetRasterizerDiscardEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    rasterizerDiscardEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetRasterizerDiscardEnableEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetRasterizerDiscardEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -8980,7 +8981,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthBiasEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthBiasEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthBiasEnableEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthBiasEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -8994,7 +8995,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetLogicOpEXT(
     format::HandleId                            commandBuffer,
     VkLogicOp                                   logicOp)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetLogicOpEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetLogicOpEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9008,7 +9009,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetPrimitiveRestartEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    primitiveRestartEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetPrimitiveRestartEnableEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetPrimitiveRestartEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9025,7 +9026,7 @@ void VulkanExportJsonConsumer::Process_vkCreateScreenSurfaceQNX(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateScreenSurfaceQNX");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateScreenSurfaceQNX");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -9043,7 +9044,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceScreenPresentationSupp
     uint32_t                                    queueFamilyIndex,
     uint64_t                                    window)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceScreenPresentationSupportQNX");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceScreenPresentationSupportQNX");
     const JsonOptions& json_options = GetJsonOptions();
             Bool32ToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -9059,7 +9060,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetColorWriteEnableEXT(
     uint32_t                                    attachmentCount,
     PointerDecoder<VkBool32>*                   pColorWriteEnables)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetColorWriteEnableEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetColorWriteEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9078,7 +9079,7 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawMultiEXT(
     uint32_t                                    firstInstance,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawMultiEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdDrawMultiEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9101,7 +9102,7 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawMultiIndexedEXT(
     uint32_t                                    stride,
     PointerDecoder<int32_t>*                    pVertexOffset)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawMultiIndexedEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdDrawMultiIndexedEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9123,7 +9124,7 @@ void VulkanExportJsonConsumer::Process_vkCreateMicromapEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkMicromapEXT>*        pMicromap)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateMicromapEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateMicromapEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -9140,7 +9141,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyMicromapEXT(
     format::HandleId                            micromap,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyMicromapEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyMicromapEXT");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -9155,7 +9156,7 @@ void VulkanExportJsonConsumer::Process_vkCmdBuildMicromapsEXT(
     uint32_t                                    infoCount,
     StructPointerDecoder<Decoded_VkMicromapBuildInfoEXT>* pInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBuildMicromapsEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdBuildMicromapsEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9173,7 +9174,7 @@ void VulkanExportJsonConsumer::Process_vkBuildMicromapsEXT(
     uint32_t                                    infoCount,
     StructPointerDecoder<Decoded_VkMicromapBuildInfoEXT>* pInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBuildMicromapsEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkBuildMicromapsEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -9191,7 +9192,7 @@ void VulkanExportJsonConsumer::Process_vkCopyMicromapEXT(
     format::HandleId                            deferredOperation,
     StructPointerDecoder<Decoded_VkCopyMicromapInfoEXT>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCopyMicromapEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCopyMicromapEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -9208,7 +9209,7 @@ void VulkanExportJsonConsumer::Process_vkCopyMicromapToMemoryEXT(
     format::HandleId                            deferredOperation,
     StructPointerDecoder<Decoded_VkCopyMicromapToMemoryInfoEXT>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCopyMicromapToMemoryEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCopyMicromapToMemoryEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -9225,7 +9226,7 @@ void VulkanExportJsonConsumer::Process_vkCopyMemoryToMicromapEXT(
     format::HandleId                            deferredOperation,
     StructPointerDecoder<Decoded_VkCopyMemoryToMicromapInfoEXT>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCopyMemoryToMicromapEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCopyMemoryToMicromapEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -9246,7 +9247,7 @@ void VulkanExportJsonConsumer::Process_vkWriteMicromapsPropertiesEXT(
     PointerDecoder<uint8_t>*                    pData,
     size_t                                      stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkWriteMicromapsPropertiesEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkWriteMicromapsPropertiesEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -9265,7 +9266,7 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyMicromapEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyMicromapInfoEXT>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyMicromapEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdCopyMicromapEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9279,7 +9280,7 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyMicromapToMemoryEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyMicromapToMemoryInfoEXT>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyMicromapToMemoryEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdCopyMicromapToMemoryEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9293,7 +9294,7 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyMemoryToMicromapEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyMemoryToMicromapInfoEXT>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyMemoryToMicromapEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdCopyMemoryToMicromapEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9311,7 +9312,7 @@ void VulkanExportJsonConsumer::Process_vkCmdWriteMicromapsPropertiesEXT(
     format::HandleId                            queryPool,
     uint32_t                                    firstQuery)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWriteMicromapsPropertiesEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdWriteMicromapsPropertiesEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9330,7 +9331,7 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceMicromapCompatibilityEXT(
     StructPointerDecoder<Decoded_VkMicromapVersionInfoEXT>* pVersionInfo,
     PointerDecoder<VkAccelerationStructureCompatibilityKHR>* pCompatibility)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceMicromapCompatibilityEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDeviceMicromapCompatibilityEXT");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -9346,7 +9347,7 @@ void VulkanExportJsonConsumer::Process_vkGetMicromapBuildSizesEXT(
     StructPointerDecoder<Decoded_VkMicromapBuildInfoEXT>* pBuildInfo,
     StructPointerDecoder<Decoded_VkMicromapBuildSizesInfoEXT>* pSizeInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMicromapBuildSizesEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetMicromapBuildSizesEXT");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -9363,7 +9364,7 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawClusterHUAWEI(
     uint32_t                                    groupCountY,
     uint32_t                                    groupCountZ)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawClusterHUAWEI");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdDrawClusterHUAWEI");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9380,7 +9381,7 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawClusterIndirectHUAWEI(
     format::HandleId                            buffer,
     VkDeviceSize                                offset)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawClusterIndirectHUAWEI");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdDrawClusterIndirectHUAWEI");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9396,7 +9397,7 @@ void VulkanExportJsonConsumer::Process_vkSetDeviceMemoryPriorityEXT(
     format::HandleId                            memory,
     float                                       priority)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSetDeviceMemoryPriorityEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkSetDeviceMemoryPriorityEXT");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -9411,7 +9412,7 @@ void VulkanExportJsonConsumer::Process_vkGetDescriptorSetLayoutHostMappingInfoVA
     StructPointerDecoder<Decoded_VkDescriptorSetBindingReferenceVALVE>* pBindingReference,
     StructPointerDecoder<Decoded_VkDescriptorSetLayoutHostMappingInfoVALVE>* pHostMapping)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDescriptorSetLayoutHostMappingInfoVALVE");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDescriptorSetLayoutHostMappingInfoVALVE");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -9426,7 +9427,7 @@ void VulkanExportJsonConsumer::Process_vkGetDescriptorSetHostMappingVALVE(
     format::HandleId                            descriptorSet,
     PointerDecoder<uint64_t, void*>*            ppData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDescriptorSetHostMappingVALVE");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDescriptorSetHostMappingVALVE");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -9441,7 +9442,7 @@ void VulkanExportJsonConsumer::Process_vkGetPipelineIndirectMemoryRequirementsNV
     StructPointerDecoder<Decoded_VkComputePipelineCreateInfo>* pCreateInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPipelineIndirectMemoryRequirementsNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPipelineIndirectMemoryRequirementsNV");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -9456,7 +9457,7 @@ void VulkanExportJsonConsumer::Process_vkCmdUpdatePipelineIndirectBufferNV(
     VkPipelineBindPoint                         pipelineBindPoint,
     format::HandleId                            pipeline)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdUpdatePipelineIndirectBufferNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdUpdatePipelineIndirectBufferNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9472,7 +9473,7 @@ void VulkanExportJsonConsumer::Process_vkGetPipelineIndirectDeviceAddressNV(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkPipelineIndirectDeviceAddressInfoNV>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPipelineIndirectDeviceAddressNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPipelineIndirectDeviceAddressNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJsonAsHex(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -9486,7 +9487,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthClampEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthClampEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthClampEnableEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthClampEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9500,7 +9501,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetPolygonModeEXT(
     format::HandleId                            commandBuffer,
     VkPolygonMode                               polygonMode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetPolygonModeEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetPolygonModeEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9514,7 +9515,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetRasterizationSamplesEXT(
     format::HandleId                            commandBuffer,
     VkSampleCountFlagBits                       rasterizationSamples)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetRasterizationSamplesEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetRasterizationSamplesEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9529,7 +9530,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetSampleMaskEXT(
     VkSampleCountFlagBits                       samples,
     PointerDecoder<VkSampleMask>*               pSampleMask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetSampleMaskEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetSampleMaskEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9544,7 +9545,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetAlphaToCoverageEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    alphaToCoverageEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetAlphaToCoverageEnableEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetAlphaToCoverageEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9558,7 +9559,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetAlphaToOneEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    alphaToOneEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetAlphaToOneEnableEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetAlphaToOneEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9572,7 +9573,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetLogicOpEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    logicOpEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetLogicOpEnableEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetLogicOpEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9588,7 +9589,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetColorBlendEnableEXT(
     uint32_t                                    attachmentCount,
     PointerDecoder<VkBool32>*                   pColorBlendEnables)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetColorBlendEnableEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetColorBlendEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9606,7 +9607,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetColorBlendEquationEXT(
     uint32_t                                    attachmentCount,
     StructPointerDecoder<Decoded_VkColorBlendEquationEXT>* pColorBlendEquations)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetColorBlendEquationEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetColorBlendEquationEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9624,7 +9625,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetColorWriteMaskEXT(
     uint32_t                                    attachmentCount,
     PointerDecoder<VkColorComponentFlags>*      pColorWriteMasks)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetColorWriteMaskEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetColorWriteMaskEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9640,7 +9641,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetTessellationDomainOriginEXT(
     format::HandleId                            commandBuffer,
     VkTessellationDomainOrigin                  domainOrigin)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetTessellationDomainOriginEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetTessellationDomainOriginEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9654,7 +9655,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetRasterizationStreamEXT(
     format::HandleId                            commandBuffer,
     uint32_t                                    rasterizationStream)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetRasterizationStreamEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetRasterizationStreamEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9668,7 +9669,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetConservativeRasterizationModeEXT(
     format::HandleId                            commandBuffer,
     VkConservativeRasterizationModeEXT          conservativeRasterizationMode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetConservativeRasterizationModeEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetConservativeRasterizationModeEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9682,7 +9683,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetExtraPrimitiveOverestimationSizeE
     format::HandleId                            commandBuffer,
     float                                       extraPrimitiveOverestimationSize)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetExtraPrimitiveOverestimationSizeEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetExtraPrimitiveOverestimationSizeEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9696,7 +9697,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthClipEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthClipEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthClipEnableEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthClipEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9710,7 +9711,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetSampleLocationsEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    sampleLocationsEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetSampleLocationsEnableEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetSampleLocationsEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9726,7 +9727,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetColorBlendAdvancedEXT(
     uint32_t                                    attachmentCount,
     StructPointerDecoder<Decoded_VkColorBlendAdvancedEXT>* pColorBlendAdvanced)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetColorBlendAdvancedEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetColorBlendAdvancedEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9742,7 +9743,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetProvokingVertexModeEXT(
     format::HandleId                            commandBuffer,
     VkProvokingVertexModeEXT                    provokingVertexMode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetProvokingVertexModeEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetProvokingVertexModeEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9756,7 +9757,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetLineRasterizationModeEXT(
     format::HandleId                            commandBuffer,
     VkLineRasterizationModeEXT                  lineRasterizationMode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetLineRasterizationModeEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetLineRasterizationModeEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9770,7 +9771,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetLineStippleEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    stippledLineEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetLineStippleEnableEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetLineStippleEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9784,7 +9785,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthClipNegativeOneToOneEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    negativeOneToOne)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthClipNegativeOneToOneEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthClipNegativeOneToOneEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9798,7 +9799,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetViewportWScalingEnableNV(
     format::HandleId                            commandBuffer,
     VkBool32                                    viewportWScalingEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetViewportWScalingEnableNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetViewportWScalingEnableNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9814,7 +9815,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetViewportSwizzleNV(
     uint32_t                                    viewportCount,
     StructPointerDecoder<Decoded_VkViewportSwizzleNV>* pViewportSwizzles)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetViewportSwizzleNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetViewportSwizzleNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9830,7 +9831,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetCoverageToColorEnableNV(
     format::HandleId                            commandBuffer,
     VkBool32                                    coverageToColorEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetCoverageToColorEnableNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetCoverageToColorEnableNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9844,7 +9845,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetCoverageToColorLocationNV(
     format::HandleId                            commandBuffer,
     uint32_t                                    coverageToColorLocation)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetCoverageToColorLocationNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetCoverageToColorLocationNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9858,7 +9859,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetCoverageModulationModeNV(
     format::HandleId                            commandBuffer,
     VkCoverageModulationModeNV                  coverageModulationMode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetCoverageModulationModeNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetCoverageModulationModeNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9872,7 +9873,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetCoverageModulationTableEnableNV(
     format::HandleId                            commandBuffer,
     VkBool32                                    coverageModulationTableEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetCoverageModulationTableEnableNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetCoverageModulationTableEnableNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9887,7 +9888,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetCoverageModulationTableNV(
     uint32_t                                    coverageModulationTableCount,
     PointerDecoder<float>*                      pCoverageModulationTable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetCoverageModulationTableNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetCoverageModulationTableNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9902,7 +9903,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetShadingRateImageEnableNV(
     format::HandleId                            commandBuffer,
     VkBool32                                    shadingRateImageEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetShadingRateImageEnableNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetShadingRateImageEnableNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9916,7 +9917,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetRepresentativeFragmentTestEnableN
     format::HandleId                            commandBuffer,
     VkBool32                                    representativeFragmentTestEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetRepresentativeFragmentTestEnableNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetRepresentativeFragmentTestEnableNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9930,7 +9931,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetCoverageReductionModeNV(
     format::HandleId                            commandBuffer,
     VkCoverageReductionModeNV                   coverageReductionMode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetCoverageReductionModeNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetCoverageReductionModeNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -9945,7 +9946,7 @@ void VulkanExportJsonConsumer::Process_vkGetShaderModuleIdentifierEXT(
     format::HandleId                            shaderModule,
     StructPointerDecoder<Decoded_VkShaderModuleIdentifierEXT>* pIdentifier)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetShaderModuleIdentifierEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetShaderModuleIdentifierEXT");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -9960,7 +9961,7 @@ void VulkanExportJsonConsumer::Process_vkGetShaderModuleCreateInfoIdentifierEXT(
     StructPointerDecoder<Decoded_VkShaderModuleCreateInfo>* pCreateInfo,
     StructPointerDecoder<Decoded_VkShaderModuleIdentifierEXT>* pIdentifier)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetShaderModuleCreateInfoIdentifierEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetShaderModuleCreateInfoIdentifierEXT");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -9977,7 +9978,7 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceOpticalFlowImageFormat
     PointerDecoder<uint32_t>*                   pFormatCount,
     StructPointerDecoder<Decoded_VkOpticalFlowImageFormatPropertiesNV>* pImageFormatProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceOpticalFlowImageFormatsNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceOpticalFlowImageFormatsNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -9996,7 +9997,7 @@ void VulkanExportJsonConsumer::Process_vkCreateOpticalFlowSessionNV(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkOpticalFlowSessionNV>* pSession)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateOpticalFlowSessionNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateOpticalFlowSessionNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -10013,7 +10014,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyOpticalFlowSessionNV(
     format::HandleId                            session,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyOpticalFlowSessionNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyOpticalFlowSessionNV");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -10031,7 +10032,7 @@ void VulkanExportJsonConsumer::Process_vkBindOpticalFlowSessionImageNV(
     format::HandleId                            view,
     VkImageLayout                               layout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBindOpticalFlowSessionImageNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkBindOpticalFlowSessionImageNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -10049,7 +10050,7 @@ void VulkanExportJsonConsumer::Process_vkCmdOpticalFlowExecuteNV(
     format::HandleId                            session,
     StructPointerDecoder<Decoded_VkOpticalFlowExecuteInfoNV>* pExecuteInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdOpticalFlowExecuteNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdOpticalFlowExecuteNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -10064,7 +10065,7 @@ void VulkanExportJsonConsumer::Process_vkAntiLagUpdateAMD(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkAntiLagDataAMD>* pData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAntiLagUpdateAMD");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkAntiLagUpdateAMD");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -10081,7 +10082,7 @@ void VulkanExportJsonConsumer::Process_vkCreateShadersEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkShaderEXT>*          pShaders)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateShadersEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateShadersEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -10099,7 +10100,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyShaderEXT(
     format::HandleId                            shader,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyShaderEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyShaderEXT");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -10116,7 +10117,7 @@ void VulkanExportJsonConsumer::Process_vkGetShaderBinaryDataEXT(
     PointerDecoder<size_t>*                     pDataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetShaderBinaryDataEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetShaderBinaryDataEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -10134,7 +10135,7 @@ void VulkanExportJsonConsumer::Process_vkCmdBindShadersEXT(
     PointerDecoder<VkShaderStageFlagBits>*      pStages,
     HandlePointerDecoder<VkShaderEXT>*          pShaders)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindShadersEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdBindShadersEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -10151,7 +10152,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthClampRangeEXT(
     VkDepthClampModeEXT                         depthClampMode,
     StructPointerDecoder<Decoded_VkDepthClampRangeEXT>* pDepthClampRange)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthClampRangeEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthClampRangeEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -10169,7 +10170,7 @@ void VulkanExportJsonConsumer::Process_vkGetFramebufferTilePropertiesQCOM(
     PointerDecoder<uint32_t>*                   pPropertiesCount,
     StructPointerDecoder<Decoded_VkTilePropertiesQCOM>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetFramebufferTilePropertiesQCOM");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetFramebufferTilePropertiesQCOM");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -10187,7 +10188,7 @@ void VulkanExportJsonConsumer::Process_vkGetDynamicRenderingTilePropertiesQCOM(
     StructPointerDecoder<Decoded_VkRenderingInfo>* pRenderingInfo,
     StructPointerDecoder<Decoded_VkTilePropertiesQCOM>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDynamicRenderingTilePropertiesQCOM");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDynamicRenderingTilePropertiesQCOM");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -10204,7 +10205,7 @@ void VulkanExportJsonConsumer::Process_vkSetLatencySleepModeNV(
     format::HandleId                            swapchain,
     StructPointerDecoder<Decoded_VkLatencySleepModeInfoNV>* pSleepModeInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSetLatencySleepModeNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkSetLatencySleepModeNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -10221,7 +10222,7 @@ void VulkanExportJsonConsumer::Process_vkLatencySleepNV(
     format::HandleId                            swapchain,
     StructPointerDecoder<Decoded_VkLatencySleepInfoNV>* pSleepInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkLatencySleepNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkLatencySleepNV");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -10237,7 +10238,7 @@ void VulkanExportJsonConsumer::Process_vkSetLatencyMarkerNV(
     format::HandleId                            swapchain,
     StructPointerDecoder<Decoded_VkSetLatencyMarkerInfoNV>* pLatencyMarkerInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSetLatencyMarkerNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkSetLatencyMarkerNV");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -10252,7 +10253,7 @@ void VulkanExportJsonConsumer::Process_vkGetLatencyTimingsNV(
     format::HandleId                            swapchain,
     StructPointerDecoder<Decoded_VkGetLatencyMarkerInfoNV>* pLatencyMarkerInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetLatencyTimingsNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetLatencyTimingsNV");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -10266,7 +10267,7 @@ void VulkanExportJsonConsumer::Process_vkQueueNotifyOutOfBandNV(
     format::HandleId                            queue,
     StructPointerDecoder<Decoded_VkOutOfBandQueueTypeInfoNV>* pQueueTypeInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueueNotifyOutOfBandNV");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkQueueNotifyOutOfBandNV");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["queue"], queue, json_options);
@@ -10279,7 +10280,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetAttachmentFeedbackLoopEnableEXT(
     format::HandleId                            commandBuffer,
     VkImageAspectFlags                          aspectMask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetAttachmentFeedbackLoopEnableEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetAttachmentFeedbackLoopEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -10294,7 +10295,7 @@ void VulkanExportJsonConsumer::Process_vkGetGeneratedCommandsMemoryRequirementsE
     StructPointerDecoder<Decoded_VkGeneratedCommandsMemoryRequirementsInfoEXT>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetGeneratedCommandsMemoryRequirementsEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetGeneratedCommandsMemoryRequirementsEXT");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -10309,7 +10310,7 @@ void VulkanExportJsonConsumer::Process_vkCmdPreprocessGeneratedCommandsEXT(
     StructPointerDecoder<Decoded_VkGeneratedCommandsInfoEXT>* pGeneratedCommandsInfo,
     format::HandleId                            stateCommandBuffer)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdPreprocessGeneratedCommandsEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdPreprocessGeneratedCommandsEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -10325,7 +10326,7 @@ void VulkanExportJsonConsumer::Process_vkCmdExecuteGeneratedCommandsEXT(
     VkBool32                                    isPreprocessed,
     StructPointerDecoder<Decoded_VkGeneratedCommandsInfoEXT>* pGeneratedCommandsInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdExecuteGeneratedCommandsEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdExecuteGeneratedCommandsEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -10343,7 +10344,7 @@ void VulkanExportJsonConsumer::Process_vkCreateIndirectCommandsLayoutEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkIndirectCommandsLayoutEXT>* pIndirectCommandsLayout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateIndirectCommandsLayoutEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateIndirectCommandsLayoutEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -10360,7 +10361,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyIndirectCommandsLayoutEXT(
     format::HandleId                            indirectCommandsLayout,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyIndirectCommandsLayoutEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyIndirectCommandsLayoutEXT");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -10377,7 +10378,7 @@ void VulkanExportJsonConsumer::Process_vkCreateIndirectExecutionSetEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkIndirectExecutionSetEXT>* pIndirectExecutionSet)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateIndirectExecutionSetEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateIndirectExecutionSetEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -10394,7 +10395,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyIndirectExecutionSetEXT(
     format::HandleId                            indirectExecutionSet,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyIndirectExecutionSetEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyIndirectExecutionSetEXT");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -10410,7 +10411,7 @@ void VulkanExportJsonConsumer::Process_vkUpdateIndirectExecutionSetPipelineEXT(
     uint32_t                                    executionSetWriteCount,
     StructPointerDecoder<Decoded_VkWriteIndirectExecutionSetPipelineEXT>* pExecutionSetWrites)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkUpdateIndirectExecutionSetPipelineEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkUpdateIndirectExecutionSetPipelineEXT");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -10427,7 +10428,7 @@ void VulkanExportJsonConsumer::Process_vkUpdateIndirectExecutionSetShaderEXT(
     uint32_t                                    executionSetWriteCount,
     StructPointerDecoder<Decoded_VkWriteIndirectExecutionSetShaderEXT>* pExecutionSetWrites)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkUpdateIndirectExecutionSetShaderEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkUpdateIndirectExecutionSetShaderEXT");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -10445,7 +10446,7 @@ void VulkanExportJsonConsumer::Process_vkCreateAccelerationStructureKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkAccelerationStructureKHR>* pAccelerationStructure)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateAccelerationStructureKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateAccelerationStructureKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -10462,7 +10463,7 @@ void VulkanExportJsonConsumer::Process_vkDestroyAccelerationStructureKHR(
     format::HandleId                            accelerationStructure,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyAccelerationStructureKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkDestroyAccelerationStructureKHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -10478,7 +10479,7 @@ void VulkanExportJsonConsumer::Process_vkCmdBuildAccelerationStructuresKHR(
     StructPointerDecoder<Decoded_VkAccelerationStructureBuildGeometryInfoKHR>* pInfos,
     StructPointerDecoder<Decoded_VkAccelerationStructureBuildRangeInfoKHR*>* ppBuildRangeInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBuildAccelerationStructuresKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdBuildAccelerationStructuresKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -10496,7 +10497,7 @@ void VulkanExportJsonConsumer::Process_vkCopyAccelerationStructureToMemoryKHR(
     format::HandleId                            deferredOperation,
     StructPointerDecoder<Decoded_VkCopyAccelerationStructureToMemoryInfoKHR>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCopyAccelerationStructureToMemoryKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCopyAccelerationStructureToMemoryKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -10513,7 +10514,7 @@ void VulkanExportJsonConsumer::Process_vkCopyMemoryToAccelerationStructureKHR(
     format::HandleId                            deferredOperation,
     StructPointerDecoder<Decoded_VkCopyMemoryToAccelerationStructureInfoKHR>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCopyMemoryToAccelerationStructureKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCopyMemoryToAccelerationStructureKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -10534,7 +10535,7 @@ void VulkanExportJsonConsumer::Process_vkWriteAccelerationStructuresPropertiesKH
     PointerDecoder<uint8_t>*                    pData,
     size_t                                      stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkWriteAccelerationStructuresPropertiesKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkWriteAccelerationStructuresPropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -10553,7 +10554,7 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyAccelerationStructureKHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyAccelerationStructureInfoKHR>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyAccelerationStructureKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdCopyAccelerationStructureKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -10567,7 +10568,7 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyAccelerationStructureToMemoryKHR
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyAccelerationStructureToMemoryInfoKHR>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyAccelerationStructureToMemoryKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdCopyAccelerationStructureToMemoryKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -10581,7 +10582,7 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyMemoryToAccelerationStructureKHR
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyMemoryToAccelerationStructureInfoKHR>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyMemoryToAccelerationStructureKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdCopyMemoryToAccelerationStructureKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -10596,7 +10597,7 @@ void VulkanExportJsonConsumer::Process_vkGetAccelerationStructureDeviceAddressKH
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkAccelerationStructureDeviceAddressInfoKHR>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetAccelerationStructureDeviceAddressKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetAccelerationStructureDeviceAddressKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJsonAsHex(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -10614,7 +10615,7 @@ void VulkanExportJsonConsumer::Process_vkCmdWriteAccelerationStructuresPropertie
     format::HandleId                            queryPool,
     uint32_t                                    firstQuery)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWriteAccelerationStructuresPropertiesKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdWriteAccelerationStructuresPropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -10633,7 +10634,7 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceAccelerationStructureCompatibi
     StructPointerDecoder<Decoded_VkAccelerationStructureVersionInfoKHR>* pVersionInfo,
     PointerDecoder<VkAccelerationStructureCompatibilityKHR>* pCompatibility)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceAccelerationStructureCompatibilityKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetDeviceAccelerationStructureCompatibilityKHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -10650,7 +10651,7 @@ void VulkanExportJsonConsumer::Process_vkGetAccelerationStructureBuildSizesKHR(
     PointerDecoder<uint32_t>*                   pMaxPrimitiveCounts,
     StructPointerDecoder<Decoded_VkAccelerationStructureBuildSizesInfoKHR>* pSizeInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetAccelerationStructureBuildSizesKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetAccelerationStructureBuildSizesKHR");
     const JsonOptions& json_options = GetJsonOptions();
     auto& args = jdata[NameArgs()];
         HandleToJson(args["device"], device, json_options);
@@ -10672,7 +10673,7 @@ void VulkanExportJsonConsumer::Process_vkCmdTraceRaysKHR(
     uint32_t                                    height,
     uint32_t                                    depth)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdTraceRaysKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdTraceRaysKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -10698,7 +10699,7 @@ void VulkanExportJsonConsumer::Process_vkCreateRayTracingPipelinesKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPipeline>*           pPipelines)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateRayTracingPipelinesKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCreateRayTracingPipelinesKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -10722,7 +10723,7 @@ void VulkanExportJsonConsumer::Process_vkGetRayTracingCaptureReplayShaderGroupHa
     size_t                                      dataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -10744,7 +10745,7 @@ void VulkanExportJsonConsumer::Process_vkCmdTraceRaysIndirectKHR(
     StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* pCallableShaderBindingTable,
     VkDeviceAddress                             indirectDeviceAddress)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdTraceRaysIndirectKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdTraceRaysIndirectKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -10765,7 +10766,7 @@ void VulkanExportJsonConsumer::Process_vkGetRayTracingShaderGroupStackSizeKHR(
     uint32_t                                    group,
     VkShaderGroupShaderKHR                      groupShader)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetRayTracingShaderGroupStackSizeKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkGetRayTracingShaderGroupStackSizeKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameReturn()], returnValue, json_options);
     auto& args = jdata[NameArgs()];
@@ -10781,7 +10782,7 @@ void VulkanExportJsonConsumer::Process_vkCmdSetRayTracingPipelineStackSizeKHR(
     format::HandleId                            commandBuffer,
     uint32_t                                    pipelineStackSize)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetRayTracingPipelineStackSizeKHR");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdSetRayTracingPipelineStackSizeKHR");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -10797,7 +10798,7 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawMeshTasksEXT(
     uint32_t                                    groupCountY,
     uint32_t                                    groupCountZ)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawMeshTasksEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdDrawMeshTasksEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -10816,7 +10817,7 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawMeshTasksIndirectEXT(
     uint32_t                                    drawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawMeshTasksIndirectEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdDrawMeshTasksIndirectEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -10838,7 +10839,7 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawMeshTasksIndirectCountEXT(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawMeshTasksIndirectCountEXT");
+    JsonValue& jdata = WriteApiCallStart(call_info, "vkCmdDrawMeshTasksIndirectCountEXT");
     const JsonOptions& json_options = GetJsonOptions();
     FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
     auto& args = jdata[NameArgs()];
@@ -10851,5 +10852,267 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawMeshTasksIndirectCountEXT(
         FieldToJson(args["stride"], stride, json_options);
     WriteBlockEnd();
 }
+
+bool VulkanExportJsonConsumer::IsSubmitIndexCall(format::ApiCallId call_id)
+{
+    switch (call_id)
+    {
+        case format::ApiCallId::ApiCall_vkQueueSubmit:
+        case format::ApiCallId::ApiCall_vkQueueSubmit2:
+        case format::ApiCallId::ApiCall_vkQueuePresentKHR:
+        case format::ApiCallId::ApiCall_vkQueueSubmit2KHR:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool VulkanExportJsonConsumer::IsCommandIndexCall(format::ApiCallId call_id)
+{
+    switch (call_id)
+    {
+        case format::ApiCallId::ApiCall_vkCmdBindPipeline:
+        case format::ApiCallId::ApiCall_vkCmdSetViewport:
+        case format::ApiCallId::ApiCall_vkCmdSetScissor:
+        case format::ApiCallId::ApiCall_vkCmdSetLineWidth:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthBias:
+        case format::ApiCallId::ApiCall_vkCmdSetBlendConstants:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthBounds:
+        case format::ApiCallId::ApiCall_vkCmdSetStencilCompareMask:
+        case format::ApiCallId::ApiCall_vkCmdSetStencilWriteMask:
+        case format::ApiCallId::ApiCall_vkCmdSetStencilReference:
+        case format::ApiCallId::ApiCall_vkCmdBindDescriptorSets:
+        case format::ApiCallId::ApiCall_vkCmdBindIndexBuffer:
+        case format::ApiCallId::ApiCall_vkCmdBindVertexBuffers:
+        case format::ApiCallId::ApiCall_vkCmdDraw:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexed:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndirect:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirect:
+        case format::ApiCallId::ApiCall_vkCmdDispatch:
+        case format::ApiCallId::ApiCall_vkCmdDispatchIndirect:
+        case format::ApiCallId::ApiCall_vkCmdCopyBuffer:
+        case format::ApiCallId::ApiCall_vkCmdCopyImage:
+        case format::ApiCallId::ApiCall_vkCmdBlitImage:
+        case format::ApiCallId::ApiCall_vkCmdCopyBufferToImage:
+        case format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer:
+        case format::ApiCallId::ApiCall_vkCmdUpdateBuffer:
+        case format::ApiCallId::ApiCall_vkCmdFillBuffer:
+        case format::ApiCallId::ApiCall_vkCmdClearColorImage:
+        case format::ApiCallId::ApiCall_vkCmdClearDepthStencilImage:
+        case format::ApiCallId::ApiCall_vkCmdClearAttachments:
+        case format::ApiCallId::ApiCall_vkCmdResolveImage:
+        case format::ApiCallId::ApiCall_vkCmdSetEvent:
+        case format::ApiCallId::ApiCall_vkCmdResetEvent:
+        case format::ApiCallId::ApiCall_vkCmdWaitEvents:
+        case format::ApiCallId::ApiCall_vkCmdPipelineBarrier:
+        case format::ApiCallId::ApiCall_vkCmdBeginQuery:
+        case format::ApiCallId::ApiCall_vkCmdEndQuery:
+        case format::ApiCallId::ApiCall_vkCmdResetQueryPool:
+        case format::ApiCallId::ApiCall_vkCmdWriteTimestamp:
+        case format::ApiCallId::ApiCall_vkCmdCopyQueryPoolResults:
+        case format::ApiCallId::ApiCall_vkCmdBeginRenderPass:
+        case format::ApiCallId::ApiCall_vkCmdNextSubpass:
+        case format::ApiCallId::ApiCall_vkCmdEndRenderPass:
+        case format::ApiCallId::ApiCall_vkCmdExecuteCommands:
+        case format::ApiCallId::ApiCall_vkCmdSetDeviceMask:
+        case format::ApiCallId::ApiCall_vkCmdDispatchBase:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndirectCount:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCount:
+        case format::ApiCallId::ApiCall_vkCmdBeginRenderPass2:
+        case format::ApiCallId::ApiCall_vkCmdNextSubpass2:
+        case format::ApiCallId::ApiCall_vkCmdEndRenderPass2:
+        case format::ApiCallId::ApiCall_vkCmdSetEvent2:
+        case format::ApiCallId::ApiCall_vkCmdResetEvent2:
+        case format::ApiCallId::ApiCall_vkCmdWaitEvents2:
+        case format::ApiCallId::ApiCall_vkCmdPipelineBarrier2:
+        case format::ApiCallId::ApiCall_vkCmdWriteTimestamp2:
+        case format::ApiCallId::ApiCall_vkCmdCopyBuffer2:
+        case format::ApiCallId::ApiCall_vkCmdCopyImage2:
+        case format::ApiCallId::ApiCall_vkCmdCopyBufferToImage2:
+        case format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer2:
+        case format::ApiCallId::ApiCall_vkCmdBlitImage2:
+        case format::ApiCallId::ApiCall_vkCmdResolveImage2:
+        case format::ApiCallId::ApiCall_vkCmdBeginRendering:
+        case format::ApiCallId::ApiCall_vkCmdEndRendering:
+        case format::ApiCallId::ApiCall_vkCmdSetCullMode:
+        case format::ApiCallId::ApiCall_vkCmdSetFrontFace:
+        case format::ApiCallId::ApiCall_vkCmdSetPrimitiveTopology:
+        case format::ApiCallId::ApiCall_vkCmdSetViewportWithCount:
+        case format::ApiCallId::ApiCall_vkCmdSetScissorWithCount:
+        case format::ApiCallId::ApiCall_vkCmdBindVertexBuffers2:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthTestEnable:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthWriteEnable:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthCompareOp:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthBoundsTestEnable:
+        case format::ApiCallId::ApiCall_vkCmdSetStencilTestEnable:
+        case format::ApiCallId::ApiCall_vkCmdSetStencilOp:
+        case format::ApiCallId::ApiCall_vkCmdSetRasterizerDiscardEnable:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthBiasEnable:
+        case format::ApiCallId::ApiCall_vkCmdSetPrimitiveRestartEnable:
+        case format::ApiCallId::ApiCall_vkCmdBeginVideoCodingKHR:
+        case format::ApiCallId::ApiCall_vkCmdEndVideoCodingKHR:
+        case format::ApiCallId::ApiCall_vkCmdControlVideoCodingKHR:
+        case format::ApiCallId::ApiCall_vkCmdDecodeVideoKHR:
+        case format::ApiCallId::ApiCall_vkCmdBeginRenderingKHR:
+        case format::ApiCallId::ApiCall_vkCmdEndRenderingKHR:
+        case format::ApiCallId::ApiCall_vkCmdSetDeviceMaskKHR:
+        case format::ApiCallId::ApiCall_vkCmdDispatchBaseKHR:
+        case format::ApiCallId::ApiCall_vkCmdPushDescriptorSetKHR:
+        case format::ApiCallId::ApiCall_vkCmdBeginRenderPass2KHR:
+        case format::ApiCallId::ApiCall_vkCmdNextSubpass2KHR:
+        case format::ApiCallId::ApiCall_vkCmdEndRenderPass2KHR:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndirectCountKHR:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountKHR:
+        case format::ApiCallId::ApiCall_vkCmdSetFragmentShadingRateKHR:
+        case format::ApiCallId::ApiCall_vkCmdSetRenderingAttachmentLocationsKHR:
+        case format::ApiCallId::ApiCall_vkCmdSetRenderingInputAttachmentIndicesKHR:
+        case format::ApiCallId::ApiCall_vkCmdEncodeVideoKHR:
+        case format::ApiCallId::ApiCall_vkCmdSetEvent2KHR:
+        case format::ApiCallId::ApiCall_vkCmdResetEvent2KHR:
+        case format::ApiCallId::ApiCall_vkCmdWaitEvents2KHR:
+        case format::ApiCallId::ApiCall_vkCmdPipelineBarrier2KHR:
+        case format::ApiCallId::ApiCall_vkCmdWriteTimestamp2KHR:
+        case format::ApiCallId::ApiCall_vkCmdWriteBufferMarker2AMD:
+        case format::ApiCallId::ApiCall_vkCmdCopyBuffer2KHR:
+        case format::ApiCallId::ApiCall_vkCmdCopyImage2KHR:
+        case format::ApiCallId::ApiCall_vkCmdCopyBufferToImage2KHR:
+        case format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer2KHR:
+        case format::ApiCallId::ApiCall_vkCmdBlitImage2KHR:
+        case format::ApiCallId::ApiCall_vkCmdResolveImage2KHR:
+        case format::ApiCallId::ApiCall_vkCmdTraceRaysIndirect2KHR:
+        case format::ApiCallId::ApiCall_vkCmdBindIndexBuffer2KHR:
+        case format::ApiCallId::ApiCall_vkCmdSetLineStippleKHR:
+        case format::ApiCallId::ApiCall_vkCmdBindDescriptorSets2KHR:
+        case format::ApiCallId::ApiCall_vkCmdPushConstants2KHR:
+        case format::ApiCallId::ApiCall_vkCmdPushDescriptorSet2KHR:
+        case format::ApiCallId::ApiCall_vkCmdSetDescriptorBufferOffsets2EXT:
+        case format::ApiCallId::ApiCall_vkCmdBindDescriptorBufferEmbeddedSamplers2EXT:
+        case format::ApiCallId::ApiCall_vkCmdDebugMarkerBeginEXT:
+        case format::ApiCallId::ApiCall_vkCmdDebugMarkerEndEXT:
+        case format::ApiCallId::ApiCall_vkCmdDebugMarkerInsertEXT:
+        case format::ApiCallId::ApiCall_vkCmdBindTransformFeedbackBuffersEXT:
+        case format::ApiCallId::ApiCall_vkCmdBeginTransformFeedbackEXT:
+        case format::ApiCallId::ApiCall_vkCmdEndTransformFeedbackEXT:
+        case format::ApiCallId::ApiCall_vkCmdBeginQueryIndexedEXT:
+        case format::ApiCallId::ApiCall_vkCmdEndQueryIndexedEXT:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndirectByteCountEXT:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndirectCountAMD:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountAMD:
+        case format::ApiCallId::ApiCall_vkCmdBeginConditionalRenderingEXT:
+        case format::ApiCallId::ApiCall_vkCmdEndConditionalRenderingEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetViewportWScalingNV:
+        case format::ApiCallId::ApiCall_vkCmdSetDiscardRectangleEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetDiscardRectangleEnableEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetDiscardRectangleModeEXT:
+        case format::ApiCallId::ApiCall_vkCmdBeginDebugUtilsLabelEXT:
+        case format::ApiCallId::ApiCall_vkCmdEndDebugUtilsLabelEXT:
+        case format::ApiCallId::ApiCall_vkCmdInsertDebugUtilsLabelEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetSampleLocationsEXT:
+        case format::ApiCallId::ApiCall_vkCmdBindShadingRateImageNV:
+        case format::ApiCallId::ApiCall_vkCmdSetViewportShadingRatePaletteNV:
+        case format::ApiCallId::ApiCall_vkCmdSetCoarseSampleOrderNV:
+        case format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructureNV:
+        case format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureNV:
+        case format::ApiCallId::ApiCall_vkCmdTraceRaysNV:
+        case format::ApiCallId::ApiCall_vkCmdWriteAccelerationStructuresPropertiesNV:
+        case format::ApiCallId::ApiCall_vkCmdWriteBufferMarkerAMD:
+        case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksNV:
+        case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectNV:
+        case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectCountNV:
+        case format::ApiCallId::ApiCall_vkCmdSetExclusiveScissorEnableNV:
+        case format::ApiCallId::ApiCall_vkCmdSetExclusiveScissorNV:
+        case format::ApiCallId::ApiCall_vkCmdSetCheckpointNV:
+        case format::ApiCallId::ApiCall_vkCmdSetPerformanceMarkerINTEL:
+        case format::ApiCallId::ApiCall_vkCmdSetPerformanceStreamMarkerINTEL:
+        case format::ApiCallId::ApiCall_vkCmdSetPerformanceOverrideINTEL:
+        case format::ApiCallId::ApiCall_vkCmdSetLineStippleEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetCullModeEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetFrontFaceEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetPrimitiveTopologyEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetViewportWithCountEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetScissorWithCountEXT:
+        case format::ApiCallId::ApiCall_vkCmdBindVertexBuffers2EXT:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthTestEnableEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthWriteEnableEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthCompareOpEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthBoundsTestEnableEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetStencilTestEnableEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetStencilOpEXT:
+        case format::ApiCallId::ApiCall_vkCmdPreprocessGeneratedCommandsNV:
+        case format::ApiCallId::ApiCall_vkCmdExecuteGeneratedCommandsNV:
+        case format::ApiCallId::ApiCall_vkCmdBindPipelineShaderGroupNV:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthBias2EXT:
+        case format::ApiCallId::ApiCall_vkCmdSetFragmentShadingRateEnumNV:
+        case format::ApiCallId::ApiCall_vkCmdSetVertexInputEXT:
+        case format::ApiCallId::ApiCall_vkCmdBindInvocationMaskHUAWEI:
+        case format::ApiCallId::ApiCall_vkCmdSetPatchControlPointsEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetRasterizerDiscardEnableEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthBiasEnableEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetLogicOpEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetPrimitiveRestartEnableEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetColorWriteEnableEXT:
+        case format::ApiCallId::ApiCall_vkCmdDrawMultiEXT:
+        case format::ApiCallId::ApiCall_vkCmdDrawMultiIndexedEXT:
+        case format::ApiCallId::ApiCall_vkCmdBuildMicromapsEXT:
+        case format::ApiCallId::ApiCall_vkCmdCopyMicromapEXT:
+        case format::ApiCallId::ApiCall_vkCmdCopyMicromapToMemoryEXT:
+        case format::ApiCallId::ApiCall_vkCmdCopyMemoryToMicromapEXT:
+        case format::ApiCallId::ApiCall_vkCmdWriteMicromapsPropertiesEXT:
+        case format::ApiCallId::ApiCall_vkCmdDrawClusterHUAWEI:
+        case format::ApiCallId::ApiCall_vkCmdDrawClusterIndirectHUAWEI:
+        case format::ApiCallId::ApiCall_vkCmdUpdatePipelineIndirectBufferNV:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthClampEnableEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetPolygonModeEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetRasterizationSamplesEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetSampleMaskEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetAlphaToCoverageEnableEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetAlphaToOneEnableEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetLogicOpEnableEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetColorBlendEnableEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetColorBlendEquationEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetColorWriteMaskEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetTessellationDomainOriginEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetRasterizationStreamEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetConservativeRasterizationModeEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetExtraPrimitiveOverestimationSizeEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthClipEnableEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetSampleLocationsEnableEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetColorBlendAdvancedEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetProvokingVertexModeEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetLineRasterizationModeEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetLineStippleEnableEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthClipNegativeOneToOneEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetViewportWScalingEnableNV:
+        case format::ApiCallId::ApiCall_vkCmdSetViewportSwizzleNV:
+        case format::ApiCallId::ApiCall_vkCmdSetCoverageToColorEnableNV:
+        case format::ApiCallId::ApiCall_vkCmdSetCoverageToColorLocationNV:
+        case format::ApiCallId::ApiCall_vkCmdSetCoverageModulationModeNV:
+        case format::ApiCallId::ApiCall_vkCmdSetCoverageModulationTableEnableNV:
+        case format::ApiCallId::ApiCall_vkCmdSetCoverageModulationTableNV:
+        case format::ApiCallId::ApiCall_vkCmdSetShadingRateImageEnableNV:
+        case format::ApiCallId::ApiCall_vkCmdSetRepresentativeFragmentTestEnableNV:
+        case format::ApiCallId::ApiCall_vkCmdSetCoverageReductionModeNV:
+        case format::ApiCallId::ApiCall_vkCmdOpticalFlowExecuteNV:
+        case format::ApiCallId::ApiCall_vkCmdBindShadersEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthClampRangeEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetAttachmentFeedbackLoopEnableEXT:
+        case format::ApiCallId::ApiCall_vkCmdPreprocessGeneratedCommandsEXT:
+        case format::ApiCallId::ApiCall_vkCmdExecuteGeneratedCommandsEXT:
+        case format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructuresKHR:
+        case format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureKHR:
+        case format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureToMemoryKHR:
+        case format::ApiCallId::ApiCall_vkCmdCopyMemoryToAccelerationStructureKHR:
+        case format::ApiCallId::ApiCall_vkCmdWriteAccelerationStructuresPropertiesKHR:
+        case format::ApiCallId::ApiCall_vkCmdTraceRaysKHR:
+        case format::ApiCallId::ApiCall_vkCmdTraceRaysIndirectKHR:
+        case format::ApiCallId::ApiCall_vkCmdSetRayTracingPipelineStackSizeKHR:
+        case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksEXT:
+        case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectEXT:
+        case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectCountEXT:
+            return true;
+        default:
+            return false;
+    }
+}
 GFXRECON_END_NAMESPACE(decode)
 GFXRECON_END_NAMESPACE(gfxrecon)
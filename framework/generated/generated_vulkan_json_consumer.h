@@ -4380,6 +4380,10 @@ class VulkanExportJsonConsumer : public VulkanExportJsonConsumerBase
         VkDeviceSize                                countBufferOffset,
         uint32_t                                    maxDrawCount,
         uint32_t                                    stride) override;
+
+    static bool IsSubmitIndexCall(format::ApiCallId call_id);
+
+    static bool IsCommandIndexCall(format::ApiCallId call_id);
 };
 
 GFXRECON_END_NAMESPACE(decode)
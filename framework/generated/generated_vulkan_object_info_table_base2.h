@@ -91,54 +91,54 @@ class VulkanObjectInfoTableBase2 : VulkanObjectInfoTableBase
     void AddVkVideoSessionKHRInfo(VulkanVideoSessionKHRInfo&& info) { AddVkObjectInfo(std::move(info), &videoSessionKHR_map_); }
     void AddVkVideoSessionParametersKHRInfo(VulkanVideoSessionParametersKHRInfo&& info) { AddVkObjectInfo(std::move(info), &videoSessionParametersKHR_map_); }
 
-    void RemoveVkAccelerationStructureKHRInfo(format::HandleId id) { accelerationStructureKHR_map_.erase(id); }
-    void RemoveVkAccelerationStructureNVInfo(format::HandleId id) { accelerationStructureNV_map_.erase(id); }
-    void RemoveVkBufferInfo(format::HandleId id) { buffer_map_.erase(id); }
-    void RemoveVkBufferViewInfo(format::HandleId id) { bufferView_map_.erase(id); }
-    void RemoveVkCommandBufferInfo(format::HandleId id) { commandBuffer_map_.erase(id); }
-    void RemoveVkCommandPoolInfo(format::HandleId id) { commandPool_map_.erase(id); }
-    void RemoveVkDebugReportCallbackEXTInfo(format::HandleId id) { debugReportCallbackEXT_map_.erase(id); }
-    void RemoveVkDebugUtilsMessengerEXTInfo(format::HandleId id) { debugUtilsMessengerEXT_map_.erase(id); }
-    void RemoveVkDeferredOperationKHRInfo(format::HandleId id) { deferredOperationKHR_map_.erase(id); }
-    void RemoveVkDescriptorPoolInfo(format::HandleId id) { descriptorPool_map_.erase(id); }
-    void RemoveVkDescriptorSetInfo(format::HandleId id) { descriptorSet_map_.erase(id); }
-    void RemoveVkDescriptorSetLayoutInfo(format::HandleId id) { descriptorSetLayout_map_.erase(id); }
-    void RemoveVkDescriptorUpdateTemplateInfo(format::HandleId id) { descriptorUpdateTemplate_map_.erase(id); }
-    void RemoveVkDeviceInfo(format::HandleId id) { device_map_.erase(id); }
-    void RemoveVkDeviceMemoryInfo(format::HandleId id) { deviceMemory_map_.erase(id); }
-    void RemoveVkDisplayKHRInfo(format::HandleId id) { displayKHR_map_.erase(id); }
-    void RemoveVkDisplayModeKHRInfo(format::HandleId id) { displayModeKHR_map_.erase(id); }
-    void RemoveVkEventInfo(format::HandleId id) { event_map_.erase(id); }
-    void RemoveVkFenceInfo(format::HandleId id) { fence_map_.erase(id); }
-    void RemoveVkFramebufferInfo(format::HandleId id) { framebuffer_map_.erase(id); }
-    void RemoveVkImageInfo(format::HandleId id) { image_map_.erase(id); }
-    void RemoveVkImageViewInfo(format::HandleId id) { imageView_map_.erase(id); }
-    void RemoveVkIndirectCommandsLayoutEXTInfo(format::HandleId id) { indirectCommandsLayoutEXT_map_.erase(id); }
-    void RemoveVkIndirectCommandsLayoutNVInfo(format::HandleId id) { indirectCommandsLayoutNV_map_.erase(id); }
-    void RemoveVkIndirectExecutionSetEXTInfo(format::HandleId id) { indirectExecutionSetEXT_map_.erase(id); }
-    void RemoveVkInstanceInfo(format::HandleId id) { instance_map_.erase(id); }
-    void RemoveVkMicromapEXTInfo(format::HandleId id) { micromapEXT_map_.erase(id); }
-    void RemoveVkOpticalFlowSessionNVInfo(format::HandleId id) { opticalFlowSessionNV_map_.erase(id); }
-    void RemoveVkPerformanceConfigurationINTELInfo(format::HandleId id) { performanceConfigurationINTEL_map_.erase(id); }
-    void RemoveVkPhysicalDeviceInfo(format::HandleId id) { physicalDevice_map_.erase(id); }
-    void RemoveVkPipelineInfo(format::HandleId id) { pipeline_map_.erase(id); }
-    void RemoveVkPipelineBinaryKHRInfo(format::HandleId id) { pipelineBinaryKHR_map_.erase(id); }
-    void RemoveVkPipelineCacheInfo(format::HandleId id) { pipelineCache_map_.erase(id); }
-    void RemoveVkPipelineLayoutInfo(format::HandleId id) { pipelineLayout_map_.erase(id); }
-    void RemoveVkPrivateDataSlotInfo(format::HandleId id) { privateDataSlot_map_.erase(id); }
-    void RemoveVkQueryPoolInfo(format::HandleId id) { queryPool_map_.erase(id); }
-    void RemoveVkQueueInfo(format::HandleId id) { queue_map_.erase(id); }
-    void RemoveVkRenderPassInfo(format::HandleId id) { renderPass_map_.erase(id); }
-    void RemoveVkSamplerInfo(format::HandleId id) { sampler_map_.erase(id); }
-    void RemoveVkSamplerYcbcrConversionInfo(format::HandleId id) { samplerYcbcrConversion_map_.erase(id); }
-    void RemoveVkSemaphoreInfo(format::HandleId id) { semaphore_map_.erase(id); }
-    void RemoveVkShaderEXTInfo(format::HandleId id) { shaderEXT_map_.erase(id); }
-    void RemoveVkShaderModuleInfo(format::HandleId id) { shaderModule_map_.erase(id); }
-    void RemoveVkSurfaceKHRInfo(format::HandleId id) { surfaceKHR_map_.erase(id); }
-    void RemoveVkSwapchainKHRInfo(format::HandleId id) { swapchainKHR_map_.erase(id); }
-    void RemoveVkValidationCacheEXTInfo(format::HandleId id) { validationCacheEXT_map_.erase(id); }
-    void RemoveVkVideoSessionKHRInfo(format::HandleId id) { videoSessionKHR_map_.erase(id); }
-    void RemoveVkVideoSessionParametersKHRInfo(format::HandleId id) { videoSessionParametersKHR_map_.erase(id); }
+    void RemoveVkAccelerationStructureKHRInfo(format::HandleId id) { accelerationStructureKHR_map_.Remove(id); }
+    void RemoveVkAccelerationStructureNVInfo(format::HandleId id) { accelerationStructureNV_map_.Remove(id); }
+    void RemoveVkBufferInfo(format::HandleId id) { buffer_map_.Remove(id); }
+    void RemoveVkBufferViewInfo(format::HandleId id) { bufferView_map_.Remove(id); }
+    void RemoveVkCommandBufferInfo(format::HandleId id) { commandBuffer_map_.Remove(id); }
+    void RemoveVkCommandPoolInfo(format::HandleId id) { commandPool_map_.Remove(id); }
+    void RemoveVkDebugReportCallbackEXTInfo(format::HandleId id) { debugReportCallbackEXT_map_.Remove(id); }
+    void RemoveVkDebugUtilsMessengerEXTInfo(format::HandleId id) { debugUtilsMessengerEXT_map_.Remove(id); }
+    void RemoveVkDeferredOperationKHRInfo(format::HandleId id) { deferredOperationKHR_map_.Remove(id); }
+    void RemoveVkDescriptorPoolInfo(format::HandleId id) { descriptorPool_map_.Remove(id); }
+    void RemoveVkDescriptorSetInfo(format::HandleId id) { descriptorSet_map_.Remove(id); }
+    void RemoveVkDescriptorSetLayoutInfo(format::HandleId id) { descriptorSetLayout_map_.Remove(id); }
+    void RemoveVkDescriptorUpdateTemplateInfo(format::HandleId id) { descriptorUpdateTemplate_map_.Remove(id); }
+    void RemoveVkDeviceInfo(format::HandleId id) { device_map_.Remove(id); }
+    void RemoveVkDeviceMemoryInfo(format::HandleId id) { deviceMemory_map_.Remove(id); }
+    void RemoveVkDisplayKHRInfo(format::HandleId id) { displayKHR_map_.Remove(id); }
+    void RemoveVkDisplayModeKHRInfo(format::HandleId id) { displayModeKHR_map_.Remove(id); }
+    void RemoveVkEventInfo(format::HandleId id) { event_map_.Remove(id); }
+    void RemoveVkFenceInfo(format::HandleId id) { fence_map_.Remove(id); }
+    void RemoveVkFramebufferInfo(format::HandleId id) { framebuffer_map_.Remove(id); }
+    void RemoveVkImageInfo(format::HandleId id) { image_map_.Remove(id); }
+    void RemoveVkImageViewInfo(format::HandleId id) { imageView_map_.Remove(id); }
+    void RemoveVkIndirectCommandsLayoutEXTInfo(format::HandleId id) { indirectCommandsLayoutEXT_map_.Remove(id); }
+    void RemoveVkIndirectCommandsLayoutNVInfo(format::HandleId id) { indirectCommandsLayoutNV_map_.Remove(id); }
+    void RemoveVkIndirectExecutionSetEXTInfo(format::HandleId id) { indirectExecutionSetEXT_map_.Remove(id); }
+    void RemoveVkInstanceInfo(format::HandleId id) { instance_map_.Remove(id); }
+    void RemoveVkMicromapEXTInfo(format::HandleId id) { micromapEXT_map_.Remove(id); }
+    void RemoveVkOpticalFlowSessionNVInfo(format::HandleId id) { opticalFlowSessionNV_map_.Remove(id); }
+    void RemoveVkPerformanceConfigurationINTELInfo(format::HandleId id) { performanceConfigurationINTEL_map_.Remove(id); }
+    void RemoveVkPhysicalDeviceInfo(format::HandleId id) { physicalDevice_map_.Remove(id); }
+    void RemoveVkPipelineInfo(format::HandleId id) { pipeline_map_.Remove(id); }
+    void RemoveVkPipelineBinaryKHRInfo(format::HandleId id) { pipelineBinaryKHR_map_.Remove(id); }
+    void RemoveVkPipelineCacheInfo(format::HandleId id) { pipelineCache_map_.Remove(id); }
+    void RemoveVkPipelineLayoutInfo(format::HandleId id) { pipelineLayout_map_.Remove(id); }
+    void RemoveVkPrivateDataSlotInfo(format::HandleId id) { privateDataSlot_map_.Remove(id); }
+    void RemoveVkQueryPoolInfo(format::HandleId id) { queryPool_map_.Remove(id); }
+    void RemoveVkQueueInfo(format::HandleId id) { queue_map_.Remove(id); }
+    void RemoveVkRenderPassInfo(format::HandleId id) { renderPass_map_.Remove(id); }
+    void RemoveVkSamplerInfo(format::HandleId id) { sampler_map_.Remove(id); }
+    void RemoveVkSamplerYcbcrConversionInfo(format::HandleId id) { samplerYcbcrConversion_map_.Remove(id); }
+    void RemoveVkSemaphoreInfo(format::HandleId id) { semaphore_map_.Remove(id); }
+    void RemoveVkShaderEXTInfo(format::HandleId id) { shaderEXT_map_.Remove(id); }
+    void RemoveVkShaderModuleInfo(format::HandleId id) { shaderModule_map_.Remove(id); }
+    void RemoveVkSurfaceKHRInfo(format::HandleId id) { surfaceKHR_map_.Remove(id); }
+    void RemoveVkSwapchainKHRInfo(format::HandleId id) { swapchainKHR_map_.Remove(id); }
+    void RemoveVkValidationCacheEXTInfo(format::HandleId id) { validationCacheEXT_map_.Remove(id); }
+    void RemoveVkVideoSessionKHRInfo(format::HandleId id) { videoSessionKHR_map_.Remove(id); }
+    void RemoveVkVideoSessionParametersKHRInfo(format::HandleId id) { videoSessionParametersKHR_map_.Remove(id); }
 
     const VulkanAccelerationStructureKHRInfo* GetVkAccelerationStructureKHRInfo(format::HandleId id) const { return GetVkObjectInfo<VulkanAccelerationStructureKHRInfo>(id, &accelerationStructureKHR_map_); }
     const VulkanAccelerationStructureNVInfo* GetVkAccelerationStructureNVInfo(format::HandleId id) const { return GetVkObjectInfo<VulkanAccelerationStructureNVInfo>(id, &accelerationStructureNV_map_); }
@@ -288,54 +288,54 @@ class VulkanObjectInfoTableBase2 : VulkanObjectInfoTableBase
     void VisitVkVideoSessionParametersKHRInfo(std::function<void(const VulkanVideoSessionParametersKHRInfo*)> visitor) const {  for (const auto& entry : videoSessionParametersKHR_map_) { visitor(&entry.second); }  }
 
   protected:
-     std::unordered_map<format::HandleId, VulkanAccelerationStructureKHRInfo> accelerationStructureKHR_map_;
-     std::unordered_map<format::HandleId, VulkanAccelerationStructureNVInfo> accelerationStructureNV_map_;
-     std::unordered_map<format::HandleId, VulkanBufferInfo> buffer_map_;
-     std::unordered_map<format::HandleId, VulkanBufferViewInfo> bufferView_map_;
-     std::unordered_map<format::HandleId, VulkanCommandBufferInfo> commandBuffer_map_;
-     std::unordered_map<format::HandleId, VulkanCommandPoolInfo> commandPool_map_;
-     std::unordered_map<format::HandleId, VulkanDebugReportCallbackEXTInfo> debugReportCallbackEXT_map_;
-     std::unordered_map<format::HandleId, VulkanDebugUtilsMessengerEXTInfo> debugUtilsMessengerEXT_map_;
-     std::unordered_map<format::HandleId, VulkanDeferredOperationKHRInfo> deferredOperationKHR_map_;
-     std::unordered_map<format::HandleId, VulkanDescriptorPoolInfo> descriptorPool_map_;
-     std::unordered_map<format::HandleId, VulkanDescriptorSetInfo> descriptorSet_map_;
-     std::unordered_map<format::HandleId, VulkanDescriptorSetLayoutInfo> descriptorSetLayout_map_;
-     std::unordered_map<format::HandleId, VulkanDescriptorUpdateTemplateInfo> descriptorUpdateTemplate_map_;
-     std::unordered_map<format::HandleId, VulkanDeviceInfo> device_map_;
-     std::unordered_map<format::HandleId, VulkanDeviceMemoryInfo> deviceMemory_map_;
-     std::unordered_map<format::HandleId, VulkanDisplayKHRInfo> displayKHR_map_;
-     std::unordered_map<format::HandleId, VulkanDisplayModeKHRInfo> displayModeKHR_map_;
-     std::unordered_map<format::HandleId, VulkanEventInfo> event_map_;
-     std::unordered_map<format::HandleId, VulkanFenceInfo> fence_map_;
-     std::unordered_map<format::HandleId, VulkanFramebufferInfo> framebuffer_map_;
-     std::unordered_map<format::HandleId, VulkanImageInfo> image_map_;
-     std::unordered_map<format::HandleId, VulkanImageViewInfo> imageView_map_;
-     std::unordered_map<format::HandleId, VulkanIndirectCommandsLayoutEXTInfo> indirectCommandsLayoutEXT_map_;
-     std::unordered_map<format::HandleId, VulkanIndirectCommandsLayoutNVInfo> indirectCommandsLayoutNV_map_;
-     std::unordered_map<format::HandleId, VulkanIndirectExecutionSetEXTInfo> indirectExecutionSetEXT_map_;
-     std::unordered_map<format::HandleId, VulkanInstanceInfo> instance_map_;
-     std::unordered_map<format::HandleId, VulkanMicromapEXTInfo> micromapEXT_map_;
-     std::unordered_map<format::HandleId, VulkanOpticalFlowSessionNVInfo> opticalFlowSessionNV_map_;
-     std::unordered_map<format::HandleId, VulkanPerformanceConfigurationINTELInfo> performanceConfigurationINTEL_map_;
-     std::unordered_map<format::HandleId, VulkanPhysicalDeviceInfo> physicalDevice_map_;
-     std::unordered_map<format::HandleId, VulkanPipelineInfo> pipeline_map_;
-     std::unordered_map<format::HandleId, VulkanPipelineBinaryKHRInfo> pipelineBinaryKHR_map_;
-     std::unordered_map<format::HandleId, VulkanPipelineCacheInfo> pipelineCache_map_;
-     std::unordered_map<format::HandleId, VulkanPipelineLayoutInfo> pipelineLayout_map_;
-     std::unordered_map<format::HandleId, VulkanPrivateDataSlotInfo> privateDataSlot_map_;
-     std::unordered_map<format::HandleId, VulkanQueryPoolInfo> queryPool_map_;
-     std::unordered_map<format::HandleId, VulkanQueueInfo> queue_map_;
-     std::unordered_map<format::HandleId, VulkanRenderPassInfo> renderPass_map_;
-     std::unordered_map<format::HandleId, VulkanSamplerInfo> sampler_map_;
-     std::unordered_map<format::HandleId, VulkanSamplerYcbcrConversionInfo> samplerYcbcrConversion_map_;
-     std::unordered_map<format::HandleId, VulkanSemaphoreInfo> semaphore_map_;
-     std::unordered_map<format::HandleId, VulkanShaderEXTInfo> shaderEXT_map_;
-     std::unordered_map<format::HandleId, VulkanShaderModuleInfo> shaderModule_map_;
-     std::unordered_map<format::HandleId, VulkanSurfaceKHRInfo> surfaceKHR_map_;
-     std::unordered_map<format::HandleId, VulkanSwapchainKHRInfo> swapchainKHR_map_;
-     std::unordered_map<format::HandleId, VulkanValidationCacheEXTInfo> validationCacheEXT_map_;
-     std::unordered_map<format::HandleId, VulkanVideoSessionKHRInfo> videoSessionKHR_map_;
-     std::unordered_map<format::HandleId, VulkanVideoSessionParametersKHRInfo> videoSessionParametersKHR_map_;
+     util::DenseIdMap<VulkanAccelerationStructureKHRInfo> accelerationStructureKHR_map_;
+     util::DenseIdMap<VulkanAccelerationStructureNVInfo> accelerationStructureNV_map_;
+     util::DenseIdMap<VulkanBufferInfo> buffer_map_;
+     util::DenseIdMap<VulkanBufferViewInfo> bufferView_map_;
+     util::DenseIdMap<VulkanCommandBufferInfo> commandBuffer_map_;
+     util::DenseIdMap<VulkanCommandPoolInfo> commandPool_map_;
+     util::DenseIdMap<VulkanDebugReportCallbackEXTInfo> debugReportCallbackEXT_map_;
+     util::DenseIdMap<VulkanDebugUtilsMessengerEXTInfo> debugUtilsMessengerEXT_map_;
+     util::DenseIdMap<VulkanDeferredOperationKHRInfo> deferredOperationKHR_map_;
+     util::DenseIdMap<VulkanDescriptorPoolInfo> descriptorPool_map_;
+     util::DenseIdMap<VulkanDescriptorSetInfo> descriptorSet_map_;
+     util::DenseIdMap<VulkanDescriptorSetLayoutInfo> descriptorSetLayout_map_;
+     util::DenseIdMap<VulkanDescriptorUpdateTemplateInfo> descriptorUpdateTemplate_map_;
+     util::DenseIdMap<VulkanDeviceInfo> device_map_;
+     util::DenseIdMap<VulkanDeviceMemoryInfo> deviceMemory_map_;
+     util::DenseIdMap<VulkanDisplayKHRInfo> displayKHR_map_;
+     util::DenseIdMap<VulkanDisplayModeKHRInfo> displayModeKHR_map_;
+     util::DenseIdMap<VulkanEventInfo> event_map_;
+     util::DenseIdMap<VulkanFenceInfo> fence_map_;
+     util::DenseIdMap<VulkanFramebufferInfo> framebuffer_map_;
+     util::DenseIdMap<VulkanImageInfo> image_map_;
+     util::DenseIdMap<VulkanImageViewInfo> imageView_map_;
+     util::DenseIdMap<VulkanIndirectCommandsLayoutEXTInfo> indirectCommandsLayoutEXT_map_;
+     util::DenseIdMap<VulkanIndirectCommandsLayoutNVInfo> indirectCommandsLayoutNV_map_;
+     util::DenseIdMap<VulkanIndirectExecutionSetEXTInfo> indirectExecutionSetEXT_map_;
+     util::DenseIdMap<VulkanInstanceInfo> instance_map_;
+     util::DenseIdMap<VulkanMicromapEXTInfo> micromapEXT_map_;
+     util::DenseIdMap<VulkanOpticalFlowSessionNVInfo> opticalFlowSessionNV_map_;
+     util::DenseIdMap<VulkanPerformanceConfigurationINTELInfo> performanceConfigurationINTEL_map_;
+     util::DenseIdMap<VulkanPhysicalDeviceInfo> physicalDevice_map_;
+     util::DenseIdMap<VulkanPipelineInfo> pipeline_map_;
+     util::DenseIdMap<VulkanPipelineBinaryKHRInfo> pipelineBinaryKHR_map_;
+     util::DenseIdMap<VulkanPipelineCacheInfo> pipelineCache_map_;
+     util::DenseIdMap<VulkanPipelineLayoutInfo> pipelineLayout_map_;
+     util::DenseIdMap<VulkanPrivateDataSlotInfo> privateDataSlot_map_;
+     util::DenseIdMap<VulkanQueryPoolInfo> queryPool_map_;
+     util::DenseIdMap<VulkanQueueInfo> queue_map_;
+     util::DenseIdMap<VulkanRenderPassInfo> renderPass_map_;
+     util::DenseIdMap<VulkanSamplerInfo> sampler_map_;
+     util::DenseIdMap<VulkanSamplerYcbcrConversionInfo> samplerYcbcrConversion_map_;
+     util::DenseIdMap<VulkanSemaphoreInfo> semaphore_map_;
+     util::DenseIdMap<VulkanShaderEXTInfo> shaderEXT_map_;
+     util::DenseIdMap<VulkanShaderModuleInfo> shaderModule_map_;
+     util::DenseIdMap<VulkanSurfaceKHRInfo> surfaceKHR_map_;
+     util::DenseIdMap<VulkanSwapchainKHRInfo> swapchainKHR_map_;
+     util::DenseIdMap<VulkanValidationCacheEXTInfo> validationCacheEXT_map_;
+     util::DenseIdMap<VulkanVideoSessionKHRInfo> videoSessionKHR_map_;
+     util::DenseIdMap<VulkanVideoSessionParametersKHRInfo> videoSessionParametersKHR_map_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -238,104 +238,153 @@ class VulkanStateTable : VulkanStateTableBase
     vulkan_wrappers::VideoSessionKHRWrapper* GetVideoSessionKHRWrapper(format::HandleId id) { return GetWrapper<vulkan_wrappers::VideoSessionKHRWrapper>(id, videoSessionKHR_map_); }
     vulkan_wrappers::VideoSessionParametersKHRWrapper* GetVideoSessionParametersKHRWrapper(format::HandleId id) { return GetWrapper<vulkan_wrappers::VideoSessionParametersKHRWrapper>(id, videoSessionParametersKHR_map_); }
 
-    void VisitWrappers(std::function<void(vulkan_wrappers::AccelerationStructureKHRWrapper*)> visitor) const { for (auto entry : accelerationStructureKHR_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::AccelerationStructureNVWrapper*)> visitor) const { for (auto entry : accelerationStructureNV_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::BufferWrapper*)> visitor) const { for (auto entry : buffer_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::BufferViewWrapper*)> visitor) const { for (auto entry : bufferView_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::CommandBufferWrapper*)> visitor) const { for (auto entry : commandBuffer_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::CommandPoolWrapper*)> visitor) const { for (auto entry : commandPool_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::DebugReportCallbackEXTWrapper*)> visitor) const { for (auto entry : debugReportCallbackEXT_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::DebugUtilsMessengerEXTWrapper*)> visitor) const { for (auto entry : debugUtilsMessengerEXT_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::DeferredOperationKHRWrapper*)> visitor) const { for (auto entry : deferredOperationKHR_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::DescriptorPoolWrapper*)> visitor) const { for (auto entry : descriptorPool_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::DescriptorSetWrapper*)> visitor) const { for (auto entry : descriptorSet_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::DescriptorSetLayoutWrapper*)> visitor) const { for (auto entry : descriptorSetLayout_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::DescriptorUpdateTemplateWrapper*)> visitor) const { for (auto entry : descriptorUpdateTemplate_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::DeviceWrapper*)> visitor) const { for (auto entry : device_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::DeviceMemoryWrapper*)> visitor) const { for (auto entry : deviceMemory_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::DisplayKHRWrapper*)> visitor) const { for (auto entry : displayKHR_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::DisplayModeKHRWrapper*)> visitor) const { for (auto entry : displayModeKHR_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::EventWrapper*)> visitor) const { for (auto entry : event_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::FenceWrapper*)> visitor) const { for (auto entry : fence_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::FramebufferWrapper*)> visitor) const { for (auto entry : framebuffer_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::ImageWrapper*)> visitor) const { for (auto entry : image_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::ImageViewWrapper*)> visitor) const { for (auto entry : imageView_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::IndirectCommandsLayoutEXTWrapper*)> visitor) const { for (auto entry : indirectCommandsLayoutEXT_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::IndirectCommandsLayoutNVWrapper*)> visitor) const { for (auto entry : indirectCommandsLayoutNV_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::IndirectExecutionSetEXTWrapper*)> visitor) const { for (auto entry : indirectExecutionSetEXT_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::InstanceWrapper*)> visitor) const { for (auto entry : instance_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::MicromapEXTWrapper*)> visitor) const { for (auto entry : micromapEXT_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::OpticalFlowSessionNVWrapper*)> visitor) const { for (auto entry : opticalFlowSessionNV_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::PerformanceConfigurationINTELWrapper*)> visitor) const { for (auto entry : performanceConfigurationINTEL_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::PhysicalDeviceWrapper*)> visitor) const { for (auto entry : physicalDevice_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::PipelineWrapper*)> visitor) const { for (auto entry : pipeline_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::PipelineBinaryKHRWrapper*)> visitor) const { for (auto entry : pipelineBinaryKHR_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::PipelineCacheWrapper*)> visitor) const { for (auto entry : pipelineCache_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::PipelineLayoutWrapper*)> visitor) const { for (auto entry : pipelineLayout_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::PrivateDataSlotWrapper*)> visitor) const { for (auto entry : privateDataSlot_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::QueryPoolWrapper*)> visitor) const { for (auto entry : queryPool_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::QueueWrapper*)> visitor) const { for (auto entry : queue_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::RenderPassWrapper*)> visitor) const { for (auto entry : renderPass_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::SamplerWrapper*)> visitor) const { for (auto entry : sampler_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::SamplerYcbcrConversionWrapper*)> visitor) const { for (auto entry : samplerYcbcrConversion_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::SemaphoreWrapper*)> visitor) const { for (auto entry : semaphore_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::ShaderEXTWrapper*)> visitor) const { for (auto entry : shaderEXT_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::ShaderModuleWrapper*)> visitor) const { for (auto entry : shaderModule_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::SurfaceKHRWrapper*)> visitor) const { for (auto entry : surfaceKHR_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::SwapchainKHRWrapper*)> visitor) const { for (auto entry : swapchainKHR_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::ValidationCacheEXTWrapper*)> visitor) const { for (auto entry : validationCacheEXT_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::VideoSessionKHRWrapper*)> visitor) const { for (auto entry : videoSessionKHR_map_) { visitor(entry.second); } }
-    void VisitWrappers(std::function<void(vulkan_wrappers::VideoSessionParametersKHRWrapper*)> visitor) const { for (auto entry : videoSessionParametersKHR_map_) { visitor(entry.second); } }
+    void VisitWrappers(std::function<void(vulkan_wrappers::AccelerationStructureKHRWrapper*)> visitor) const { VisitEntries(accelerationStructureKHR_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::AccelerationStructureNVWrapper*)> visitor) const { VisitEntries(accelerationStructureNV_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::BufferWrapper*)> visitor) const { VisitEntries(buffer_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::BufferViewWrapper*)> visitor) const { VisitEntries(bufferView_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::CommandBufferWrapper*)> visitor) const { VisitEntries(commandBuffer_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::CommandPoolWrapper*)> visitor) const { VisitEntries(commandPool_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::DebugReportCallbackEXTWrapper*)> visitor) const { VisitEntries(debugReportCallbackEXT_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::DebugUtilsMessengerEXTWrapper*)> visitor) const { VisitEntries(debugUtilsMessengerEXT_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::DeferredOperationKHRWrapper*)> visitor) const { VisitEntries(deferredOperationKHR_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::DescriptorPoolWrapper*)> visitor) const { VisitEntries(descriptorPool_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::DescriptorSetWrapper*)> visitor) const { VisitEntries(descriptorSet_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::DescriptorSetLayoutWrapper*)> visitor) const { VisitEntries(descriptorSetLayout_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::DescriptorUpdateTemplateWrapper*)> visitor) const { VisitEntries(descriptorUpdateTemplate_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::DeviceWrapper*)> visitor) const { VisitEntries(device_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::DeviceMemoryWrapper*)> visitor) const { VisitEntries(deviceMemory_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::DisplayKHRWrapper*)> visitor) const { VisitEntries(displayKHR_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::DisplayModeKHRWrapper*)> visitor) const { VisitEntries(displayModeKHR_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::EventWrapper*)> visitor) const { VisitEntries(event_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::FenceWrapper*)> visitor) const { VisitEntries(fence_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::FramebufferWrapper*)> visitor) const { VisitEntries(framebuffer_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::ImageWrapper*)> visitor) const { VisitEntries(image_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::ImageViewWrapper*)> visitor) const { VisitEntries(imageView_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::IndirectCommandsLayoutEXTWrapper*)> visitor) const { VisitEntries(indirectCommandsLayoutEXT_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::IndirectCommandsLayoutNVWrapper*)> visitor) const { VisitEntries(indirectCommandsLayoutNV_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::IndirectExecutionSetEXTWrapper*)> visitor) const { VisitEntries(indirectExecutionSetEXT_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::InstanceWrapper*)> visitor) const { VisitEntries(instance_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::MicromapEXTWrapper*)> visitor) const { VisitEntries(micromapEXT_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::OpticalFlowSessionNVWrapper*)> visitor) const { VisitEntries(opticalFlowSessionNV_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::PerformanceConfigurationINTELWrapper*)> visitor) const { VisitEntries(performanceConfigurationINTEL_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::PhysicalDeviceWrapper*)> visitor) const { VisitEntries(physicalDevice_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::PipelineWrapper*)> visitor) const { VisitEntries(pipeline_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::PipelineBinaryKHRWrapper*)> visitor) const { VisitEntries(pipelineBinaryKHR_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::PipelineCacheWrapper*)> visitor) const { VisitEntries(pipelineCache_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::PipelineLayoutWrapper*)> visitor) const { VisitEntries(pipelineLayout_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::PrivateDataSlotWrapper*)> visitor) const { VisitEntries(privateDataSlot_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::QueryPoolWrapper*)> visitor) const { VisitEntries(queryPool_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::QueueWrapper*)> visitor) const { VisitEntries(queue_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::RenderPassWrapper*)> visitor) const { VisitEntries(renderPass_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::SamplerWrapper*)> visitor) const { VisitEntries(sampler_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::SamplerYcbcrConversionWrapper*)> visitor) const { VisitEntries(samplerYcbcrConversion_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::SemaphoreWrapper*)> visitor) const { VisitEntries(semaphore_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::ShaderEXTWrapper*)> visitor) const { VisitEntries(shaderEXT_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::ShaderModuleWrapper*)> visitor) const { VisitEntries(shaderModule_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::SurfaceKHRWrapper*)> visitor) const { VisitEntries(surfaceKHR_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::SwapchainKHRWrapper*)> visitor) const { VisitEntries(swapchainKHR_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::ValidationCacheEXTWrapper*)> visitor) const { VisitEntries(validationCacheEXT_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::VideoSessionKHRWrapper*)> visitor) const { VisitEntries(videoSessionKHR_map_, visitor); }
+    void VisitWrappers(std::function<void(vulkan_wrappers::VideoSessionParametersKHRWrapper*)> visitor) const { VisitEntries(videoSessionParametersKHR_map_, visitor); }
+
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::AccelerationStructureKHRWrapper*)> visitor) const { VisitEntriesUnsorted(accelerationStructureKHR_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::AccelerationStructureNVWrapper*)> visitor) const { VisitEntriesUnsorted(accelerationStructureNV_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::BufferWrapper*)> visitor) const { VisitEntriesUnsorted(buffer_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::BufferViewWrapper*)> visitor) const { VisitEntriesUnsorted(bufferView_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::CommandBufferWrapper*)> visitor) const { VisitEntriesUnsorted(commandBuffer_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::CommandPoolWrapper*)> visitor) const { VisitEntriesUnsorted(commandPool_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::DebugReportCallbackEXTWrapper*)> visitor) const { VisitEntriesUnsorted(debugReportCallbackEXT_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::DebugUtilsMessengerEXTWrapper*)> visitor) const { VisitEntriesUnsorted(debugUtilsMessengerEXT_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::DeferredOperationKHRWrapper*)> visitor) const { VisitEntriesUnsorted(deferredOperationKHR_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::DescriptorPoolWrapper*)> visitor) const { VisitEntriesUnsorted(descriptorPool_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::DescriptorSetWrapper*)> visitor) const { VisitEntriesUnsorted(descriptorSet_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::DescriptorSetLayoutWrapper*)> visitor) const { VisitEntriesUnsorted(descriptorSetLayout_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::DescriptorUpdateTemplateWrapper*)> visitor) const { VisitEntriesUnsorted(descriptorUpdateTemplate_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::DeviceWrapper*)> visitor) const { VisitEntriesUnsorted(device_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::DeviceMemoryWrapper*)> visitor) const { VisitEntriesUnsorted(deviceMemory_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::DisplayKHRWrapper*)> visitor) const { VisitEntriesUnsorted(displayKHR_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::DisplayModeKHRWrapper*)> visitor) const { VisitEntriesUnsorted(displayModeKHR_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::EventWrapper*)> visitor) const { VisitEntriesUnsorted(event_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::FenceWrapper*)> visitor) const { VisitEntriesUnsorted(fence_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::FramebufferWrapper*)> visitor) const { VisitEntriesUnsorted(framebuffer_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::ImageWrapper*)> visitor) const { VisitEntriesUnsorted(image_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::ImageViewWrapper*)> visitor) const { VisitEntriesUnsorted(imageView_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::IndirectCommandsLayoutEXTWrapper*)> visitor) const { VisitEntriesUnsorted(indirectCommandsLayoutEXT_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::IndirectCommandsLayoutNVWrapper*)> visitor) const { VisitEntriesUnsorted(indirectCommandsLayoutNV_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::IndirectExecutionSetEXTWrapper*)> visitor) const { VisitEntriesUnsorted(indirectExecutionSetEXT_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::InstanceWrapper*)> visitor) const { VisitEntriesUnsorted(instance_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::MicromapEXTWrapper*)> visitor) const { VisitEntriesUnsorted(micromapEXT_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::OpticalFlowSessionNVWrapper*)> visitor) const { VisitEntriesUnsorted(opticalFlowSessionNV_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::PerformanceConfigurationINTELWrapper*)> visitor) const { VisitEntriesUnsorted(performanceConfigurationINTEL_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::PhysicalDeviceWrapper*)> visitor) const { VisitEntriesUnsorted(physicalDevice_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::PipelineWrapper*)> visitor) const { VisitEntriesUnsorted(pipeline_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::PipelineBinaryKHRWrapper*)> visitor) const { VisitEntriesUnsorted(pipelineBinaryKHR_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::PipelineCacheWrapper*)> visitor) const { VisitEntriesUnsorted(pipelineCache_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::PipelineLayoutWrapper*)> visitor) const { VisitEntriesUnsorted(pipelineLayout_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::PrivateDataSlotWrapper*)> visitor) const { VisitEntriesUnsorted(privateDataSlot_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::QueryPoolWrapper*)> visitor) const { VisitEntriesUnsorted(queryPool_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::QueueWrapper*)> visitor) const { VisitEntriesUnsorted(queue_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::RenderPassWrapper*)> visitor) const { VisitEntriesUnsorted(renderPass_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::SamplerWrapper*)> visitor) const { VisitEntriesUnsorted(sampler_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::SamplerYcbcrConversionWrapper*)> visitor) const { VisitEntriesUnsorted(samplerYcbcrConversion_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::SemaphoreWrapper*)> visitor) const { VisitEntriesUnsorted(semaphore_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::ShaderEXTWrapper*)> visitor) const { VisitEntriesUnsorted(shaderEXT_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::ShaderModuleWrapper*)> visitor) const { VisitEntriesUnsorted(shaderModule_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::SurfaceKHRWrapper*)> visitor) const { VisitEntriesUnsorted(surfaceKHR_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::SwapchainKHRWrapper*)> visitor) const { VisitEntriesUnsorted(swapchainKHR_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::ValidationCacheEXTWrapper*)> visitor) const { VisitEntriesUnsorted(validationCacheEXT_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::VideoSessionKHRWrapper*)> visitor) const { VisitEntriesUnsorted(videoSessionKHR_map_, visitor); }
+    void VisitWrappersUnsorted(std::function<void(vulkan_wrappers::VideoSessionParametersKHRWrapper*)> visitor) const { VisitEntriesUnsorted(videoSessionParametersKHR_map_, visitor); }
 
   private:
-    std::map<format::HandleId, vulkan_wrappers::AccelerationStructureKHRWrapper*> accelerationStructureKHR_map_;
-    std::map<format::HandleId, vulkan_wrappers::AccelerationStructureNVWrapper*> accelerationStructureNV_map_;
-    std::map<format::HandleId, vulkan_wrappers::BufferWrapper*> buffer_map_;
-    std::map<format::HandleId, vulkan_wrappers::BufferViewWrapper*> bufferView_map_;
-    std::map<format::HandleId, vulkan_wrappers::CommandBufferWrapper*> commandBuffer_map_;
-    std::map<format::HandleId, vulkan_wrappers::CommandPoolWrapper*> commandPool_map_;
-    std::map<format::HandleId, vulkan_wrappers::DebugReportCallbackEXTWrapper*> debugReportCallbackEXT_map_;
-    std::map<format::HandleId, vulkan_wrappers::DebugUtilsMessengerEXTWrapper*> debugUtilsMessengerEXT_map_;
-    std::map<format::HandleId, vulkan_wrappers::DeferredOperationKHRWrapper*> deferredOperationKHR_map_;
-    std::map<format::HandleId, vulkan_wrappers::DescriptorPoolWrapper*> descriptorPool_map_;
-    std::map<format::HandleId, vulkan_wrappers::DescriptorSetWrapper*> descriptorSet_map_;
-    std::map<format::HandleId, vulkan_wrappers::DescriptorSetLayoutWrapper*> descriptorSetLayout_map_;
-    std::map<format::HandleId, vulkan_wrappers::DescriptorUpdateTemplateWrapper*> descriptorUpdateTemplate_map_;
-    std::map<format::HandleId, vulkan_wrappers::DeviceWrapper*> device_map_;
-    std::map<format::HandleId, vulkan_wrappers::DeviceMemoryWrapper*> deviceMemory_map_;
-    std::map<format::HandleId, vulkan_wrappers::DisplayKHRWrapper*> displayKHR_map_;
-    std::map<format::HandleId, vulkan_wrappers::DisplayModeKHRWrapper*> displayModeKHR_map_;
-    std::map<format::HandleId, vulkan_wrappers::EventWrapper*> event_map_;
-    std::map<format::HandleId, vulkan_wrappers::FenceWrapper*> fence_map_;
-    std::map<format::HandleId, vulkan_wrappers::FramebufferWrapper*> framebuffer_map_;
-    std::map<format::HandleId, vulkan_wrappers::ImageWrapper*> image_map_;
-    std::map<format::HandleId, vulkan_wrappers::ImageViewWrapper*> imageView_map_;
-    std::map<format::HandleId, vulkan_wrappers::IndirectCommandsLayoutEXTWrapper*> indirectCommandsLayoutEXT_map_;
-    std::map<format::HandleId, vulkan_wrappers::IndirectCommandsLayoutNVWrapper*> indirectCommandsLayoutNV_map_;
-    std::map<format::HandleId, vulkan_wrappers::IndirectExecutionSetEXTWrapper*> indirectExecutionSetEXT_map_;
-    std::map<format::HandleId, vulkan_wrappers::InstanceWrapper*> instance_map_;
-    std::map<format::HandleId, vulkan_wrappers::MicromapEXTWrapper*> micromapEXT_map_;
-    std::map<format::HandleId, vulkan_wrappers::OpticalFlowSessionNVWrapper*> opticalFlowSessionNV_map_;
-    std::map<format::HandleId, vulkan_wrappers::PerformanceConfigurationINTELWrapper*> performanceConfigurationINTEL_map_;
-    std::map<format::HandleId, vulkan_wrappers::PhysicalDeviceWrapper*> physicalDevice_map_;
-    std::map<format::HandleId, vulkan_wrappers::PipelineWrapper*> pipeline_map_;
-    std::map<format::HandleId, vulkan_wrappers::PipelineBinaryKHRWrapper*> pipelineBinaryKHR_map_;
-    std::map<format::HandleId, vulkan_wrappers::PipelineCacheWrapper*> pipelineCache_map_;
-    std::map<format::HandleId, vulkan_wrappers::PipelineLayoutWrapper*> pipelineLayout_map_;
-    std::map<format::HandleId, vulkan_wrappers::PrivateDataSlotWrapper*> privateDataSlot_map_;
-    std::map<format::HandleId, vulkan_wrappers::QueryPoolWrapper*> queryPool_map_;
-    std::map<format::HandleId, vulkan_wrappers::QueueWrapper*> queue_map_;
-    std::map<format::HandleId, vulkan_wrappers::RenderPassWrapper*> renderPass_map_;
-    std::map<format::HandleId, vulkan_wrappers::SamplerWrapper*> sampler_map_;
-    std::map<format::HandleId, vulkan_wrappers::SamplerYcbcrConversionWrapper*> samplerYcbcrConversion_map_;
-    std::map<format::HandleId, vulkan_wrappers::SemaphoreWrapper*> semaphore_map_;
-    std::map<format::HandleId, vulkan_wrappers::ShaderEXTWrapper*> shaderEXT_map_;
-    std::map<format::HandleId, vulkan_wrappers::ShaderModuleWrapper*> shaderModule_map_;
-    std::map<format::HandleId, vulkan_wrappers::SurfaceKHRWrapper*> surfaceKHR_map_;
-    std::map<format::HandleId, vulkan_wrappers::SwapchainKHRWrapper*> swapchainKHR_map_;
-    std::map<format::HandleId, vulkan_wrappers::ValidationCacheEXTWrapper*> validationCacheEXT_map_;
-    std::map<format::HandleId, vulkan_wrappers::VideoSessionKHRWrapper*> videoSessionKHR_map_;
-    std::map<format::HandleId, vulkan_wrappers::VideoSessionParametersKHRWrapper*> videoSessionParametersKHR_map_;
+    IdWrapperMap<vulkan_wrappers::AccelerationStructureKHRWrapper> accelerationStructureKHR_map_;
+    IdWrapperMap<vulkan_wrappers::AccelerationStructureNVWrapper> accelerationStructureNV_map_;
+    IdWrapperMap<vulkan_wrappers::BufferWrapper> buffer_map_;
+    IdWrapperMap<vulkan_wrappers::BufferViewWrapper> bufferView_map_;
+    IdWrapperMap<vulkan_wrappers::CommandBufferWrapper> commandBuffer_map_;
+    IdWrapperMap<vulkan_wrappers::CommandPoolWrapper> commandPool_map_;
+    IdWrapperMap<vulkan_wrappers::DebugReportCallbackEXTWrapper> debugReportCallbackEXT_map_;
+    IdWrapperMap<vulkan_wrappers::DebugUtilsMessengerEXTWrapper> debugUtilsMessengerEXT_map_;
+    IdWrapperMap<vulkan_wrappers::DeferredOperationKHRWrapper> deferredOperationKHR_map_;
+    IdWrapperMap<vulkan_wrappers::DescriptorPoolWrapper> descriptorPool_map_;
+    IdWrapperMap<vulkan_wrappers::DescriptorSetWrapper> descriptorSet_map_;
+    IdWrapperMap<vulkan_wrappers::DescriptorSetLayoutWrapper> descriptorSetLayout_map_;
+    IdWrapperMap<vulkan_wrappers::DescriptorUpdateTemplateWrapper> descriptorUpdateTemplate_map_;
+    IdWrapperMap<vulkan_wrappers::DeviceWrapper> device_map_;
+    IdWrapperMap<vulkan_wrappers::DeviceMemoryWrapper> deviceMemory_map_;
+    IdWrapperMap<vulkan_wrappers::DisplayKHRWrapper> displayKHR_map_;
+    IdWrapperMap<vulkan_wrappers::DisplayModeKHRWrapper> displayModeKHR_map_;
+    IdWrapperMap<vulkan_wrappers::EventWrapper> event_map_;
+    IdWrapperMap<vulkan_wrappers::FenceWrapper> fence_map_;
+    IdWrapperMap<vulkan_wrappers::FramebufferWrapper> framebuffer_map_;
+    IdWrapperMap<vulkan_wrappers::ImageWrapper> image_map_;
+    IdWrapperMap<vulkan_wrappers::ImageViewWrapper> imageView_map_;
+    IdWrapperMap<vulkan_wrappers::IndirectCommandsLayoutEXTWrapper> indirectCommandsLayoutEXT_map_;
+    IdWrapperMap<vulkan_wrappers::IndirectCommandsLayoutNVWrapper> indirectCommandsLayoutNV_map_;
+    IdWrapperMap<vulkan_wrappers::IndirectExecutionSetEXTWrapper> indirectExecutionSetEXT_map_;
+    IdWrapperMap<vulkan_wrappers::InstanceWrapper> instance_map_;
+    IdWrapperMap<vulkan_wrappers::MicromapEXTWrapper> micromapEXT_map_;
+    IdWrapperMap<vulkan_wrappers::OpticalFlowSessionNVWrapper> opticalFlowSessionNV_map_;
+    IdWrapperMap<vulkan_wrappers::PerformanceConfigurationINTELWrapper> performanceConfigurationINTEL_map_;
+    IdWrapperMap<vulkan_wrappers::PhysicalDeviceWrapper> physicalDevice_map_;
+    IdWrapperMap<vulkan_wrappers::PipelineWrapper> pipeline_map_;
+    IdWrapperMap<vulkan_wrappers::PipelineBinaryKHRWrapper> pipelineBinaryKHR_map_;
+    IdWrapperMap<vulkan_wrappers::PipelineCacheWrapper> pipelineCache_map_;
+    IdWrapperMap<vulkan_wrappers::PipelineLayoutWrapper> pipelineLayout_map_;
+    IdWrapperMap<vulkan_wrappers::PrivateDataSlotWrapper> privateDataSlot_map_;
+    IdWrapperMap<vulkan_wrappers::QueryPoolWrapper> queryPool_map_;
+    IdWrapperMap<vulkan_wrappers::QueueWrapper> queue_map_;
+    IdWrapperMap<vulkan_wrappers::RenderPassWrapper> renderPass_map_;
+    IdWrapperMap<vulkan_wrappers::SamplerWrapper> sampler_map_;
+    IdWrapperMap<vulkan_wrappers::SamplerYcbcrConversionWrapper> samplerYcbcrConversion_map_;
+    IdWrapperMap<vulkan_wrappers::SemaphoreWrapper> semaphore_map_;
+    IdWrapperMap<vulkan_wrappers::ShaderEXTWrapper> shaderEXT_map_;
+    IdWrapperMap<vulkan_wrappers::ShaderModuleWrapper> shaderModule_map_;
+    IdWrapperMap<vulkan_wrappers::SurfaceKHRWrapper> surfaceKHR_map_;
+    IdWrapperMap<vulkan_wrappers::SwapchainKHRWrapper> swapchainKHR_map_;
+    IdWrapperMap<vulkan_wrappers::ValidationCacheEXTWrapper> validationCacheEXT_map_;
+    IdWrapperMap<vulkan_wrappers::VideoSessionKHRWrapper> videoSessionKHR_map_;
+    IdWrapperMap<vulkan_wrappers::VideoSessionParametersKHRWrapper> videoSessionParametersKHR_map_;
 };
 
 class VulkanStateHandleTable : VulkanStateTableBase
@@ -591,54 +640,54 @@ class VulkanStateHandleTable : VulkanStateTableBase
     template<typename Wrapper> Wrapper* GetWrapper(typename Wrapper::HandleType handle) { return nullptr; }
 
   private:
-    std::unordered_map<VkAccelerationStructureKHR, vulkan_wrappers::AccelerationStructureKHRWrapper*> accelerationStructureKHR_map_;
-    std::unordered_map<VkAccelerationStructureNV, vulkan_wrappers::AccelerationStructureNVWrapper*> accelerationStructureNV_map_;
-    std::unordered_map<VkBuffer, vulkan_wrappers::BufferWrapper*> buffer_map_;
-    std::unordered_map<VkBufferView, vulkan_wrappers::BufferViewWrapper*> bufferView_map_;
-    std::unordered_map<VkCommandBuffer, vulkan_wrappers::CommandBufferWrapper*> commandBuffer_map_;
-    std::unordered_map<VkCommandPool, vulkan_wrappers::CommandPoolWrapper*> commandPool_map_;
-    std::unordered_map<VkDebugReportCallbackEXT, vulkan_wrappers::DebugReportCallbackEXTWrapper*> debugReportCallbackEXT_map_;
-    std::unordered_map<VkDebugUtilsMessengerEXT, vulkan_wrappers::DebugUtilsMessengerEXTWrapper*> debugUtilsMessengerEXT_map_;
-    std::unordered_map<VkDeferredOperationKHR, vulkan_wrappers::DeferredOperationKHRWrapper*> deferredOperationKHR_map_;
-    std::unordered_map<VkDescriptorPool, vulkan_wrappers::DescriptorPoolWrapper*> descriptorPool_map_;
-    std::unordered_map<VkDescriptorSet, vulkan_wrappers::DescriptorSetWrapper*> descriptorSet_map_;
-    std::unordered_map<VkDescriptorSetLayout, vulkan_wrappers::DescriptorSetLayoutWrapper*> descriptorSetLayout_map_;
-    std::unordered_map<VkDescriptorUpdateTemplate, vulkan_wrappers::DescriptorUpdateTemplateWrapper*> descriptorUpdateTemplate_map_;
-    std::unordered_map<VkDevice, vulkan_wrappers::DeviceWrapper*> device_map_;
-    std::unordered_map<VkDeviceMemory, vulkan_wrappers::DeviceMemoryWrapper*> deviceMemory_map_;
-    std::unordered_map<VkDisplayKHR, vulkan_wrappers::DisplayKHRWrapper*> displayKHR_map_;
-    std::unordered_map<VkDisplayModeKHR, vulkan_wrappers::DisplayModeKHRWrapper*> displayModeKHR_map_;
-    std::unordered_map<VkEvent, vulkan_wrappers::EventWrapper*> event_map_;
-    std::unordered_map<VkFence, vulkan_wrappers::FenceWrapper*> fence_map_;
-    std::unordered_map<VkFramebuffer, vulkan_wrappers::FramebufferWrapper*> framebuffer_map_;
-    std::unordered_map<VkImage, vulkan_wrappers::ImageWrapper*> image_map_;
-    std::unordered_map<VkImageView, vulkan_wrappers::ImageViewWrapper*> imageView_map_;
-    std::unordered_map<VkIndirectCommandsLayoutEXT, vulkan_wrappers::IndirectCommandsLayoutEXTWrapper*> indirectCommandsLayoutEXT_map_;
-    std::unordered_map<VkIndirectCommandsLayoutNV, vulkan_wrappers::IndirectCommandsLayoutNVWrapper*> indirectCommandsLayoutNV_map_;
-    std::unordered_map<VkIndirectExecutionSetEXT, vulkan_wrappers::IndirectExecutionSetEXTWrapper*> indirectExecutionSetEXT_map_;
-    std::unordered_map<VkInstance, vulkan_wrappers::InstanceWrapper*> instance_map_;
-    std::unordered_map<VkMicromapEXT, vulkan_wrappers::MicromapEXTWrapper*> micromapEXT_map_;
-    std::unordered_map<VkOpticalFlowSessionNV, vulkan_wrappers::OpticalFlowSessionNVWrapper*> opticalFlowSessionNV_map_;
-    std::unordered_map<VkPerformanceConfigurationINTEL, vulkan_wrappers::PerformanceConfigurationINTELWrapper*> performanceConfigurationINTEL_map_;
-    std::unordered_map<VkPhysicalDevice, vulkan_wrappers::PhysicalDeviceWrapper*> physicalDevice_map_;
-    std::unordered_map<VkPipeline, vulkan_wrappers::PipelineWrapper*> pipeline_map_;
-    std::unordered_map<VkPipelineBinaryKHR, vulkan_wrappers::PipelineBinaryKHRWrapper*> pipelineBinaryKHR_map_;
-    std::unordered_map<VkPipelineCache, vulkan_wrappers::PipelineCacheWrapper*> pipelineCache_map_;
-    std::unordered_map<VkPipelineLayout, vulkan_wrappers::PipelineLayoutWrapper*> pipelineLayout_map_;
-    std::unordered_map<VkPrivateDataSlot, vulkan_wrappers::PrivateDataSlotWrapper*> privateDataSlot_map_;
-    std::unordered_map<VkQueryPool, vulkan_wrappers::QueryPoolWrapper*> queryPool_map_;
-    std::unordered_map<VkQueue, vulkan_wrappers::QueueWrapper*> queue_map_;
-    std::unordered_map<VkRenderPass, vulkan_wrappers::RenderPassWrapper*> renderPass_map_;
-    std::unordered_map<VkSampler, vulkan_wrappers::SamplerWrapper*> sampler_map_;
-    std::unordered_map<VkSamplerYcbcrConversion, vulkan_wrappers::SamplerYcbcrConversionWrapper*> samplerYcbcrConversion_map_;
-    std::unordered_map<VkSemaphore, vulkan_wrappers::SemaphoreWrapper*> semaphore_map_;
-    std::unordered_map<VkShaderEXT, vulkan_wrappers::ShaderEXTWrapper*> shaderEXT_map_;
-    std::unordered_map<VkShaderModule, vulkan_wrappers::ShaderModuleWrapper*> shaderModule_map_;
-    std::unordered_map<VkSurfaceKHR, vulkan_wrappers::SurfaceKHRWrapper*> surfaceKHR_map_;
-    std::unordered_map<VkSwapchainKHR, vulkan_wrappers::SwapchainKHRWrapper*> swapchainKHR_map_;
-    std::unordered_map<VkValidationCacheEXT, vulkan_wrappers::ValidationCacheEXTWrapper*> validationCacheEXT_map_;
-    std::unordered_map<VkVideoSessionKHR, vulkan_wrappers::VideoSessionKHRWrapper*> videoSessionKHR_map_;
-    std::unordered_map<VkVideoSessionParametersKHR, vulkan_wrappers::VideoSessionParametersKHRWrapper*> videoSessionParametersKHR_map_;
+    HandleWrapperMap<vulkan_wrappers::AccelerationStructureKHRWrapper> accelerationStructureKHR_map_;
+    HandleWrapperMap<vulkan_wrappers::AccelerationStructureNVWrapper> accelerationStructureNV_map_;
+    HandleWrapperMap<vulkan_wrappers::BufferWrapper> buffer_map_;
+    HandleWrapperMap<vulkan_wrappers::BufferViewWrapper> bufferView_map_;
+    HandleWrapperMap<vulkan_wrappers::CommandBufferWrapper> commandBuffer_map_;
+    HandleWrapperMap<vulkan_wrappers::CommandPoolWrapper> commandPool_map_;
+    HandleWrapperMap<vulkan_wrappers::DebugReportCallbackEXTWrapper> debugReportCallbackEXT_map_;
+    HandleWrapperMap<vulkan_wrappers::DebugUtilsMessengerEXTWrapper> debugUtilsMessengerEXT_map_;
+    HandleWrapperMap<vulkan_wrappers::DeferredOperationKHRWrapper> deferredOperationKHR_map_;
+    HandleWrapperMap<vulkan_wrappers::DescriptorPoolWrapper> descriptorPool_map_;
+    HandleWrapperMap<vulkan_wrappers::DescriptorSetWrapper> descriptorSet_map_;
+    HandleWrapperMap<vulkan_wrappers::DescriptorSetLayoutWrapper> descriptorSetLayout_map_;
+    HandleWrapperMap<vulkan_wrappers::DescriptorUpdateTemplateWrapper> descriptorUpdateTemplate_map_;
+    HandleWrapperMap<vulkan_wrappers::DeviceWrapper> device_map_;
+    HandleWrapperMap<vulkan_wrappers::DeviceMemoryWrapper> deviceMemory_map_;
+    HandleWrapperMap<vulkan_wrappers::DisplayKHRWrapper> displayKHR_map_;
+    HandleWrapperMap<vulkan_wrappers::DisplayModeKHRWrapper> displayModeKHR_map_;
+    HandleWrapperMap<vulkan_wrappers::EventWrapper> event_map_;
+    HandleWrapperMap<vulkan_wrappers::FenceWrapper> fence_map_;
+    HandleWrapperMap<vulkan_wrappers::FramebufferWrapper> framebuffer_map_;
+    HandleWrapperMap<vulkan_wrappers::ImageWrapper> image_map_;
+    HandleWrapperMap<vulkan_wrappers::ImageViewWrapper> imageView_map_;
+    HandleWrapperMap<vulkan_wrappers::IndirectCommandsLayoutEXTWrapper> indirectCommandsLayoutEXT_map_;
+    HandleWrapperMap<vulkan_wrappers::IndirectCommandsLayoutNVWrapper> indirectCommandsLayoutNV_map_;
+    HandleWrapperMap<vulkan_wrappers::IndirectExecutionSetEXTWrapper> indirectExecutionSetEXT_map_;
+    HandleWrapperMap<vulkan_wrappers::InstanceWrapper> instance_map_;
+    HandleWrapperMap<vulkan_wrappers::MicromapEXTWrapper> micromapEXT_map_;
+    HandleWrapperMap<vulkan_wrappers::OpticalFlowSessionNVWrapper> opticalFlowSessionNV_map_;
+    HandleWrapperMap<vulkan_wrappers::PerformanceConfigurationINTELWrapper> performanceConfigurationINTEL_map_;
+    HandleWrapperMap<vulkan_wrappers::PhysicalDeviceWrapper> physicalDevice_map_;
+    HandleWrapperMap<vulkan_wrappers::PipelineWrapper> pipeline_map_;
+    HandleWrapperMap<vulkan_wrappers::PipelineBinaryKHRWrapper> pipelineBinaryKHR_map_;
+    HandleWrapperMap<vulkan_wrappers::PipelineCacheWrapper> pipelineCache_map_;
+    HandleWrapperMap<vulkan_wrappers::PipelineLayoutWrapper> pipelineLayout_map_;
+    HandleWrapperMap<vulkan_wrappers::PrivateDataSlotWrapper> privateDataSlot_map_;
+    HandleWrapperMap<vulkan_wrappers::QueryPoolWrapper> queryPool_map_;
+    HandleWrapperMap<vulkan_wrappers::QueueWrapper> queue_map_;
+    HandleWrapperMap<vulkan_wrappers::RenderPassWrapper> renderPass_map_;
+    HandleWrapperMap<vulkan_wrappers::SamplerWrapper> sampler_map_;
+    HandleWrapperMap<vulkan_wrappers::SamplerYcbcrConversionWrapper> samplerYcbcrConversion_map_;
+    HandleWrapperMap<vulkan_wrappers::SemaphoreWrapper> semaphore_map_;
+    HandleWrapperMap<vulkan_wrappers::ShaderEXTWrapper> shaderEXT_map_;
+    HandleWrapperMap<vulkan_wrappers::ShaderModuleWrapper> shaderModule_map_;
+    HandleWrapperMap<vulkan_wrappers::SurfaceKHRWrapper> surfaceKHR_map_;
+    HandleWrapperMap<vulkan_wrappers::SwapchainKHRWrapper> swapchainKHR_map_;
+    HandleWrapperMap<vulkan_wrappers::ValidationCacheEXTWrapper> validationCacheEXT_map_;
+    HandleWrapperMap<vulkan_wrappers::VideoSessionKHRWrapper> videoSessionKHR_map_;
+    HandleWrapperMap<vulkan_wrappers::VideoSessionParametersKHRWrapper> videoSessionParametersKHR_map_;
 };
 
 template<> inline const vulkan_wrappers::AccelerationStructureKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::AccelerationStructureKHRWrapper>(VkAccelerationStructureKHR handle) const { return VulkanStateTableBase::GetWrapper(handle, accelerationStructureKHR_map_); }
@@ -34,11 +34,12 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 using util::JsonOptions;
+using util::JsonValue;
 using util::to_hex_variable_width;
 using util::uuid_to_string;
 
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH264SpsVuiFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoH264SpsVuiFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -60,7 +61,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH264SpsVui
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH264HrdParameters* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoH264HrdParameters* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -81,7 +82,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH264HrdPar
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH264SequenceParameterSetVui* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoH264SequenceParameterSetVui* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -107,7 +108,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH264Sequen
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH264SpsFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoH264SpsFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -133,7 +134,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH264SpsFla
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH264ScalingLists* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoH264ScalingLists* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -147,7 +148,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH264Scalin
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH264SequenceParameterSet* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoH264SequenceParameterSet* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -182,7 +183,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH264Sequen
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH264PpsFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoH264PpsFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -200,7 +201,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH264PpsFla
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH264PictureParameterSet* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoH264PictureParameterSet* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -221,7 +222,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH264Pictur
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoDecodeH264PictureInfoFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoDecodeH264PictureInfoFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -237,7 +238,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoDecodeH264
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoDecodeH264PictureInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoDecodeH264PictureInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -255,7 +256,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoDecodeH264
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoDecodeH264ReferenceInfoFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoDecodeH264ReferenceInfoFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -269,7 +270,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoDecodeH264
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoDecodeH264ReferenceInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoDecodeH264ReferenceInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -283,7 +284,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoDecodeH264
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH264WeightTableFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoEncodeH264WeightTableFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -297,7 +298,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH264
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH264WeightTable* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoEncodeH264WeightTable* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -318,7 +319,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH264
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH264SliceHeaderFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoEncodeH264SliceHeaderFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -331,7 +332,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH264
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH264PictureInfoFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoEncodeH264PictureInfoFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -347,7 +348,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH264
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH264ReferenceInfoFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoEncodeH264ReferenceInfoFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -359,7 +360,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH264
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH264ReferenceListsInfoFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoEncodeH264ReferenceListsInfoFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -372,7 +373,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH264
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH264RefListModEntry* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoEncodeH264RefListModEntry* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -385,7 +386,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH264
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH264RefPicMarkingEntry* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoEncodeH264RefPicMarkingEntry* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -400,7 +401,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH264
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH264ReferenceListsInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoEncodeH264ReferenceListsInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -422,7 +423,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH264
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH264PictureInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoEncodeH264PictureInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -442,7 +443,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH264
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH264ReferenceInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoEncodeH264ReferenceInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -459,7 +460,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH264
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH264SliceHeader* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoEncodeH264SliceHeader* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -479,7 +480,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH264
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265ProfileTierLevelFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoH265ProfileTierLevelFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -494,7 +495,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265Profil
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265ProfileTierLevel* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoH265ProfileTierLevel* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -507,7 +508,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265Profil
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265DecPicBufMgr* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoH265DecPicBufMgr* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -520,7 +521,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265DecPic
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265SubLayerHrdParameters* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoH265SubLayerHrdParameters* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -535,7 +536,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265SubLay
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265HrdFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoH265HrdFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -552,7 +553,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265HrdFla
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265HrdParameters* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoH265HrdParameters* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -577,7 +578,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265HrdPar
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265VpsFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoH265VpsFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -591,7 +592,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265VpsFla
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265VideoParameterSet* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoH265VideoParameterSet* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -613,7 +614,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265VideoP
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265ScalingLists* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoH265ScalingLists* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -629,7 +630,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265Scalin
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265ShortTermRefPicSetFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoH265ShortTermRefPicSetFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -641,7 +642,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265ShortT
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265ShortTermRefPicSet* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoH265ShortTermRefPicSet* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -665,7 +666,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265ShortT
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265LongTermRefPicsSps* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoH265LongTermRefPicsSps* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -677,7 +678,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265LongTe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265SpsVuiFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoH265SpsVuiFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -705,7 +706,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265SpsVui
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265SequenceParameterSetVui* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoH265SequenceParameterSetVui* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -741,7 +742,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265Sequen
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265PredictorPaletteEntries* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoH265PredictorPaletteEntries* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -752,7 +753,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265Predic
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265SpsFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoH265SpsFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -792,7 +793,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265SpsFla
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265SequenceParameterSet* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoH265SequenceParameterSet* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -841,7 +842,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265Sequen
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265PpsFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoH265PpsFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -882,7 +883,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265PpsFla
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265PictureParameterSet* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoH265PictureParameterSet* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -928,7 +929,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoH265Pictur
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoDecodeH265PictureInfoFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoDecodeH265PictureInfoFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -942,7 +943,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoDecodeH265
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoDecodeH265PictureInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoDecodeH265PictureInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -963,7 +964,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoDecodeH265
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoDecodeH265ReferenceInfoFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoDecodeH265ReferenceInfoFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -975,7 +976,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoDecodeH265
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoDecodeH265ReferenceInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoDecodeH265ReferenceInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -987,7 +988,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoDecodeH265
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH265WeightTableFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoEncodeH265WeightTableFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1001,7 +1002,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH265
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH265WeightTable* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoEncodeH265WeightTable* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1022,7 +1023,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH265
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH265LongTermRefPics* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoEncodeH265LongTermRefPics* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1039,7 +1040,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH265
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH265SliceSegmentHeaderFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoEncodeH265SliceSegmentHeaderFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1062,7 +1063,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH265
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH265SliceSegmentHeader* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoEncodeH265SliceSegmentHeader* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1087,7 +1088,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH265
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH265ReferenceListsInfoFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoEncodeH265ReferenceListsInfoFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1100,7 +1101,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH265
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH265ReferenceListsInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoEncodeH265ReferenceListsInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1117,7 +1118,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH265
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH265PictureInfoFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoEncodeH265PictureInfoFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1137,7 +1138,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH265
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH265PictureInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoEncodeH265PictureInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1159,7 +1160,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH265
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH265ReferenceInfoFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoEncodeH265ReferenceInfoFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1172,7 +1173,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH265
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH265ReferenceInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoEncodeH265ReferenceInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1186,7 +1187,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoEncodeH265
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1ColorConfigFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoAV1ColorConfigFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1201,7 +1202,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1ColorCo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1ColorConfig* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoAV1ColorConfig* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1220,7 +1221,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1ColorCo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1TimingInfoFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoAV1TimingInfoFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1232,7 +1233,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1TimingI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1TimingInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoAV1TimingInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1246,7 +1247,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1TimingI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1SequenceHeaderFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoAV1SequenceHeaderFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1276,7 +1277,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1Sequenc
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1SequenceHeader* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoAV1SequenceHeader* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1300,7 +1301,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1Sequenc
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1LoopFilterFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoAV1LoopFilterFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1313,7 +1314,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1LoopFil
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1LoopFilter* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoAV1LoopFilter* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1330,7 +1331,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1LoopFil
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1QuantizationFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoAV1QuantizationFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1343,7 +1344,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1Quantiz
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1Quantization* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoAV1Quantization* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1363,7 +1364,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1Quantiz
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1Segmentation* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoAV1Segmentation* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1375,7 +1376,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1Segment
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1TileInfoFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoAV1TileInfoFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1387,7 +1388,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1TileInf
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1TileInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoAV1TileInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1407,7 +1408,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1TileInf
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1CDEF* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoAV1CDEF* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1423,7 +1424,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1CDEF* d
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1LoopRestoration* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoAV1LoopRestoration* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1435,7 +1436,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1LoopRes
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1GlobalMotion* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoAV1GlobalMotion* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1447,7 +1448,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1GlobalM
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1FilmGrainFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoAV1FilmGrainFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1462,7 +1463,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1FilmGra
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1FilmGrain* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoAV1FilmGrain* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1497,7 +1498,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoAV1FilmGra
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoDecodeAV1PictureInfoFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoDecodeAV1PictureInfoFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1537,7 +1538,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoDecodeAV1P
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoDecodeAV1PictureInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoDecodeAV1PictureInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1571,7 +1572,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoDecodeAV1P
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoDecodeAV1ReferenceInfoFlags* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoDecodeAV1ReferenceInfoFlags* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1584,7 +1585,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoDecodeAV1R
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoDecodeAV1ReferenceInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_StdVideoDecodeAV1ReferenceInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1599,7 +1600,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_StdVideoDecodeAV1R
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExtent2D* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkExtent2D* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1611,7 +1612,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExtent2D* data,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExtent3D* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkExtent3D* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1624,7 +1625,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExtent3D* data,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkOffset2D* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkOffset2D* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1636,7 +1637,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkOffset2D* data,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkOffset3D* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkOffset3D* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1649,7 +1650,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkOffset3D* data,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRect2D* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRect2D* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1661,7 +1662,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRect2D* data, co
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBufferMemoryBarrier* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBufferMemoryBarrier* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1680,7 +1681,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBufferMemoryBarr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDispatchIndirectCommand* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDispatchIndirectCommand* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1693,7 +1694,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDispatchIndirect
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDrawIndexedIndirectCommand* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDrawIndexedIndirectCommand* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1708,7 +1709,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDrawIndexedIndir
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDrawIndirectCommand* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDrawIndirectCommand* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1722,7 +1723,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDrawIndirectComm
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageSubresourceRange* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageSubresourceRange* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1737,7 +1738,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageSubresource
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageMemoryBarrier* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageMemoryBarrier* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1757,7 +1758,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageMemoryBarri
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryBarrier* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMemoryBarrier* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1771,7 +1772,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryBarrier* d
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineCacheHeaderVersionOne* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineCacheHeaderVersionOne* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1786,7 +1787,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineCacheHea
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAllocationCallbacks* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAllocationCallbacks* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1802,7 +1803,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAllocationCallba
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkApplicationInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkApplicationInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1819,7 +1820,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkApplicationInfo*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkFormatProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkFormatProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1832,7 +1833,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkFormatProperties
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageFormatProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageFormatProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1847,7 +1848,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageFormatPrope
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkInstanceCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkInstanceCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1865,7 +1866,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkInstanceCreateIn
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryHeap* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMemoryHeap* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1877,7 +1878,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryHeap* data
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryType* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMemoryType* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1889,7 +1890,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryType* data
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFeatures* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceFeatures* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -1954,7 +1955,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceLimits* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceLimits* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2070,7 +2071,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceLi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMemoryProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceMemoryProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2084,7 +2085,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSparseProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceSparseProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2099,7 +2100,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSp
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2118,7 +2119,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkQueueFamilyProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkQueueFamilyProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2132,7 +2133,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkQueueFamilyPrope
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceQueueCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDeviceQueueCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2148,7 +2149,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceQueueCreat
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDeviceCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2168,7 +2169,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceCreateInfo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExtensionProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkExtensionProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2180,7 +2181,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExtensionPropert
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkLayerProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkLayerProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2194,7 +2195,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkLayerProperties*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSubmitInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSubmitInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2213,7 +2214,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSubmitInfo* data
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMappedMemoryRange* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMappedMemoryRange* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2228,7 +2229,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMappedMemoryRang
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryAllocateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMemoryAllocateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2242,7 +2243,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryAllocateIn
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryRequirements* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMemoryRequirements* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2255,7 +2256,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryRequiremen
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSparseMemoryBind* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSparseMemoryBind* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2270,7 +2271,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSparseMemoryBind
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSparseBufferMemoryBindInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSparseBufferMemoryBindInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2283,7 +2284,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSparseBufferMemo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSparseImageOpaqueMemoryBindInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSparseImageOpaqueMemoryBindInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2296,7 +2297,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSparseImageOpaqu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageSubresource* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageSubresource* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2309,7 +2310,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageSubresource
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSparseImageMemoryBind* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSparseImageMemoryBind* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2325,7 +2326,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSparseImageMemor
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSparseImageMemoryBindInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSparseImageMemoryBindInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2338,7 +2339,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSparseImageMemor
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindSparseInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBindSparseInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2360,7 +2361,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindSparseInfo*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSparseImageFormatProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSparseImageFormatProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2373,7 +2374,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSparseImageForma
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSparseImageMemoryRequirements* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSparseImageMemoryRequirements* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2388,7 +2389,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSparseImageMemor
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkFenceCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkFenceCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2401,7 +2402,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkFenceCreateInfo*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSemaphoreCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSemaphoreCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2414,7 +2415,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSemaphoreCreateI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkEventCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkEventCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2427,7 +2428,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkEventCreateInfo*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkQueryPoolCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkQueryPoolCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2443,7 +2444,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkQueryPoolCreateI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBufferCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBufferCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2461,7 +2462,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBufferCreateInfo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBufferViewCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBufferViewCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2478,7 +2479,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBufferViewCreate
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2503,7 +2504,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageCreateInfo*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSubresourceLayout* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSubresourceLayout* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2518,7 +2519,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSubresourceLayou
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkComponentMapping* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkComponentMapping* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2532,7 +2533,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkComponentMapping
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageViewCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageViewCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2550,7 +2551,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageViewCreateI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSpecializationMapEntry* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSpecializationMapEntry* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2563,7 +2564,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSpecializationMa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSpecializationInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSpecializationInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2577,7 +2578,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSpecializationIn
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineShaderStageCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineShaderStageCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2594,7 +2595,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineShaderSt
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkComputePipelineCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkComputePipelineCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2611,7 +2612,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkComputePipelineC
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVertexInputBindingDescription* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVertexInputBindingDescription* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2624,7 +2625,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVertexInputBindi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVertexInputAttributeDescription* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVertexInputAttributeDescription* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2638,7 +2639,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVertexInputAttri
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineVertexInputStateCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineVertexInputStateCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2655,7 +2656,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineVertexIn
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineInputAssemblyStateCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineInputAssemblyStateCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2670,7 +2671,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineInputAss
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineTessellationStateCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineTessellationStateCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2684,7 +2685,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineTessella
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkViewport* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkViewport* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2700,7 +2701,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkViewport* data,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineViewportStateCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineViewportStateCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2717,7 +2718,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineViewport
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineRasterizationStateCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineRasterizationStateCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2740,7 +2741,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineRasteriz
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineMultisampleStateCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineMultisampleStateCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2759,7 +2760,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineMultisam
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkStencilOpState* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkStencilOpState* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2776,7 +2777,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkStencilOpState*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineDepthStencilStateCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineDepthStencilStateCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2798,7 +2799,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineDepthSte
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineColorBlendAttachmentState* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineColorBlendAttachmentState* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2816,7 +2817,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineColorBle
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineColorBlendStateCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineColorBlendStateCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2834,7 +2835,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineColorBle
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineDynamicStateCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineDynamicStateCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2849,7 +2850,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineDynamicS
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkGraphicsPipelineCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkGraphicsPipelineCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2878,7 +2879,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkGraphicsPipeline
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPushConstantRange* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPushConstantRange* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2891,7 +2892,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPushConstantRang
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineLayoutCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineLayoutCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2908,7 +2909,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineLayoutCr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSamplerCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSamplerCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2936,7 +2937,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSamplerCreateInf
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCopyDescriptorSet* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkCopyDescriptorSet* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2955,7 +2956,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCopyDescriptorSe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorBufferInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDescriptorBufferInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2968,7 +2969,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorBuffer
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorPoolSize* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDescriptorPoolSize* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2980,7 +2981,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorPoolSi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorPoolCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDescriptorPoolCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -2996,7 +2997,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorPoolCr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorSetAllocateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDescriptorSetAllocateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3011,7 +3012,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorSetAll
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorSetLayoutBinding* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDescriptorSetLayoutBinding* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3026,7 +3027,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorSetLay
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorSetLayoutCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDescriptorSetLayoutCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3041,7 +3042,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorSetLay
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAttachmentDescription* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAttachmentDescription* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3060,7 +3061,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAttachmentDescri
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAttachmentReference* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAttachmentReference* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3072,7 +3073,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAttachmentRefere
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkFramebufferCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkFramebufferCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3091,7 +3092,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkFramebufferCreat
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSubpassDescription* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSubpassDescription* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3111,7 +3112,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSubpassDescripti
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSubpassDependency* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSubpassDependency* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3128,7 +3129,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSubpassDependenc
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRenderPassCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3147,7 +3148,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassCreate
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCommandPoolCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkCommandPoolCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3161,7 +3162,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCommandPoolCreat
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCommandBufferAllocateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkCommandBufferAllocateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3176,7 +3177,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCommandBufferAll
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCommandBufferInheritanceInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkCommandBufferInheritanceInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3194,7 +3195,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCommandBufferInh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCommandBufferBeginInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkCommandBufferBeginInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3208,7 +3209,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCommandBufferBeg
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBufferCopy* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBufferCopy* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3221,7 +3222,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBufferCopy* data
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageSubresourceLayers* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageSubresourceLayers* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3235,7 +3236,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageSubresource
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBufferImageCopy* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBufferImageCopy* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3251,7 +3252,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBufferImageCopy*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkClearDepthStencilValue* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkClearDepthStencilValue* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3263,7 +3264,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkClearDepthStenci
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkClearAttachment* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkClearAttachment* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3276,7 +3277,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkClearAttachment*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkClearRect* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkClearRect* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3289,7 +3290,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkClearRect* data,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageBlit* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageBlit* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3303,7 +3304,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageBlit* data,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageCopy* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageCopy* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3318,7 +3319,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageCopy* data,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageResolve* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageResolve* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3333,7 +3334,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageResolve* da
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassBeginInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRenderPassBeginInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3350,7 +3351,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassBeginI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSubgroupProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceSubgroupProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3366,7 +3367,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindBufferMemoryInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBindBufferMemoryInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3381,7 +3382,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindBufferMemory
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindImageMemoryInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBindImageMemoryInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3396,7 +3397,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindImageMemoryI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevice16BitStorageFeatures* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDevice16BitStorageFeatures* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3412,7 +3413,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevice16
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryDedicatedRequirements* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMemoryDedicatedRequirements* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3426,7 +3427,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryDedicatedR
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryDedicatedAllocateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMemoryDedicatedAllocateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3440,7 +3441,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryDedicatedA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryAllocateFlagsInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMemoryAllocateFlagsInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3454,7 +3455,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryAllocateFl
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceGroupRenderPassBeginInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDeviceGroupRenderPassBeginInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3469,7 +3470,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceGroupRende
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceGroupCommandBufferBeginInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDeviceGroupCommandBufferBeginInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3482,7 +3483,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceGroupComma
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceGroupSubmitInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDeviceGroupSubmitInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3500,7 +3501,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceGroupSubmi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceGroupBindSparseInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDeviceGroupBindSparseInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3514,7 +3515,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceGroupBindS
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindBufferMemoryDeviceGroupInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBindBufferMemoryDeviceGroupInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3528,7 +3529,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindBufferMemory
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindImageMemoryDeviceGroupInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBindImageMemoryDeviceGroupInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3544,7 +3545,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindImageMemoryD
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceGroupProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceGroupProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3559,7 +3560,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceGr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceGroupDeviceCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDeviceGroupDeviceCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3573,7 +3574,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceGroupDevic
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBufferMemoryRequirementsInfo2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBufferMemoryRequirementsInfo2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3586,7 +3587,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBufferMemoryRequ
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageMemoryRequirementsInfo2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageMemoryRequirementsInfo2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3599,7 +3600,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageMemoryRequi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageSparseMemoryRequirementsInfo2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageSparseMemoryRequirementsInfo2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3612,7 +3613,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageSparseMemor
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryRequirements2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMemoryRequirements2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3625,7 +3626,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryRequiremen
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSparseImageMemoryRequirements2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSparseImageMemoryRequirements2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3638,7 +3639,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSparseImageMemor
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFeatures2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceFeatures2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3651,7 +3652,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceProperties2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceProperties2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3664,7 +3665,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkFormatProperties2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkFormatProperties2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3677,7 +3678,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkFormatProperties
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageFormatProperties2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageFormatProperties2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3690,7 +3691,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageFormatPrope
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceImageFormatInfo2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceImageFormatInfo2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3707,7 +3708,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceIm
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkQueueFamilyProperties2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkQueueFamilyProperties2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3720,7 +3721,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkQueueFamilyPrope
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMemoryProperties2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceMemoryProperties2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3733,7 +3734,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSparseImageFormatProperties2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSparseImageFormatProperties2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3746,7 +3747,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSparseImageForma
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSparseImageFormatInfo2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceSparseImageFormatInfo2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3763,7 +3764,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSp
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePointClippingProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDevicePointClippingProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3776,7 +3777,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkInputAttachmentAspectReference* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkInputAttachmentAspectReference* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3789,7 +3790,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkInputAttachmentA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassInputAttachmentAspectCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRenderPassInputAttachmentAspectCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3803,7 +3804,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassInputA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageViewUsageCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageViewUsageCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3816,7 +3817,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageViewUsageCr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineTessellationDomainOriginStateCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineTessellationDomainOriginStateCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3829,7 +3830,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineTessella
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassMultiviewCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRenderPassMultiviewCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3847,7 +3848,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassMultiv
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMultiviewFeatures* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceMultiviewFeatures* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3862,7 +3863,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMultiviewProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceMultiviewProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3876,7 +3877,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceVariablePointersFeatures* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceVariablePointersFeatures* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3890,7 +3891,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceVa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceProtectedMemoryFeatures* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceProtectedMemoryFeatures* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3903,7 +3904,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceProtectedMemoryProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceProtectedMemoryProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3916,7 +3917,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceQueueInfo2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDeviceQueueInfo2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3931,7 +3932,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceQueueInfo2
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkProtectedSubmitInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkProtectedSubmitInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3944,7 +3945,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkProtectedSubmitI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSamplerYcbcrConversionCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSamplerYcbcrConversionCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3964,7 +3965,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSamplerYcbcrConv
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSamplerYcbcrConversionInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSamplerYcbcrConversionInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3977,7 +3978,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSamplerYcbcrConv
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindImagePlaneMemoryInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBindImagePlaneMemoryInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -3990,7 +3991,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindImagePlaneMe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImagePlaneMemoryRequirementsInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImagePlaneMemoryRequirementsInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4003,7 +4004,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImagePlaneMemory
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSamplerYcbcrConversionFeatures* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceSamplerYcbcrConversionFeatures* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4016,7 +4017,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSamplerYcbcrConversionImageFormatProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSamplerYcbcrConversionImageFormatProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4029,7 +4030,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSamplerYcbcrConv
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorUpdateTemplateEntry* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDescriptorUpdateTemplateEntry* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4045,7 +4046,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorUpdate
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorUpdateTemplateCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDescriptorUpdateTemplateCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4065,7 +4066,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorUpdate
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExternalMemoryProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkExternalMemoryProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4078,7 +4079,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExternalMemoryPr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceExternalImageFormatInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceExternalImageFormatInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4091,7 +4092,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceEx
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExternalImageFormatProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkExternalImageFormatProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4104,7 +4105,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExternalImageFor
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceExternalBufferInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceExternalBufferInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4119,7 +4120,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceEx
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExternalBufferProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkExternalBufferProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4132,7 +4133,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExternalBufferPr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceIDProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceIDProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4149,7 +4150,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceID
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExternalMemoryImageCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkExternalMemoryImageCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4162,7 +4163,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExternalMemoryIm
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExternalMemoryBufferCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkExternalMemoryBufferCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4175,7 +4176,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExternalMemoryBu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExportMemoryAllocateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkExportMemoryAllocateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4188,7 +4189,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExportMemoryAllo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceExternalFenceInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceExternalFenceInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4201,7 +4202,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceEx
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExternalFenceProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkExternalFenceProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4216,7 +4217,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExternalFencePro
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExportFenceCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkExportFenceCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4229,7 +4230,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExportFenceCreat
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExportSemaphoreCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkExportSemaphoreCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4242,7 +4243,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExportSemaphoreC
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceExternalSemaphoreInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceExternalSemaphoreInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4255,7 +4256,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceEx
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExternalSemaphoreProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkExternalSemaphoreProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4270,7 +4271,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExternalSemaphor
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMaintenance3Properties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceMaintenance3Properties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4284,7 +4285,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorSetLayoutSupport* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDescriptorSetLayoutSupport* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4297,7 +4298,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorSetLay
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderDrawParametersFeatures* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderDrawParametersFeatures* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4310,7 +4311,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceVulkan11Features* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceVulkan11Features* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4334,7 +4335,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceVu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceVulkan11Properties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceVulkan11Properties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4361,7 +4362,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceVu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceVulkan12Features* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceVulkan12Features* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4420,7 +4421,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceVu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkConformanceVersion* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkConformanceVersion* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4434,7 +4435,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkConformanceVersi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceVulkan12Properties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceVulkan12Properties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4498,7 +4499,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceVu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageFormatListCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageFormatListCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4512,7 +4513,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageFormatListC
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAttachmentDescription2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAttachmentDescription2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4533,7 +4534,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAttachmentDescri
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAttachmentReference2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAttachmentReference2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4548,7 +4549,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAttachmentRefere
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSubpassDescription2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSubpassDescription2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4571,7 +4572,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSubpassDescripti
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSubpassDependency2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSubpassDependency2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4591,7 +4592,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSubpassDependenc
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassCreateInfo2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRenderPassCreateInfo2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4612,7 +4613,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassCreate
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSubpassBeginInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSubpassBeginInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4625,7 +4626,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSubpassBeginInfo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSubpassEndInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSubpassEndInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4637,7 +4638,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSubpassEndInfo*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevice8BitStorageFeatures* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDevice8BitStorageFeatures* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4652,7 +4653,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevice8B
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDriverProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceDriverProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4668,7 +4669,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderAtomicInt64Features* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderAtomicInt64Features* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4682,7 +4683,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderFloat16Int8Features* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderFloat16Int8Features* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4696,7 +4697,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFloatControlsProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceFloatControlsProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4725,7 +4726,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFl
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorSetLayoutBindingFlagsCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDescriptorSetLayoutBindingFlagsCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4739,7 +4740,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorSetLay
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDescriptorIndexingFeatures* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceDescriptorIndexingFeatures* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4771,7 +4772,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDescriptorIndexingProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceDescriptorIndexingProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4806,7 +4807,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorSetVariableDescriptorCountAllocateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDescriptorSetVariableDescriptorCountAllocateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4820,7 +4821,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorSetVar
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorSetVariableDescriptorCountLayoutSupport* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDescriptorSetVariableDescriptorCountLayoutSupport* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4833,7 +4834,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorSetVar
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSubpassDescriptionDepthStencilResolve* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSubpassDescriptionDepthStencilResolve* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4848,7 +4849,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSubpassDescripti
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDepthStencilResolveProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceDepthStencilResolveProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4864,7 +4865,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceScalarBlockLayoutFeatures* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceScalarBlockLayoutFeatures* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4877,7 +4878,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSc
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageStencilUsageCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageStencilUsageCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4890,7 +4891,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageStencilUsag
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSamplerReductionModeCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSamplerReductionModeCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4903,7 +4904,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSamplerReduction
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSamplerFilterMinmaxProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceSamplerFilterMinmaxProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4917,7 +4918,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceVulkanMemoryModelFeatures* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceVulkanMemoryModelFeatures* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4932,7 +4933,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceVu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceImagelessFramebufferFeatures* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceImagelessFramebufferFeatures* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4945,7 +4946,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceIm
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkFramebufferAttachmentImageInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkFramebufferAttachmentImageInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4964,7 +4965,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkFramebufferAttac
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkFramebufferAttachmentsCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkFramebufferAttachmentsCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4978,7 +4979,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkFramebufferAttac
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassAttachmentBeginInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRenderPassAttachmentBeginInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -4992,7 +4993,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassAttach
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceUniformBufferStandardLayoutFeatures* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceUniformBufferStandardLayoutFeatures* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5005,7 +5006,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceUn
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5018,7 +5019,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5031,7 +5032,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAttachmentReferenceStencilLayout* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAttachmentReferenceStencilLayout* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5044,7 +5045,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAttachmentRefere
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAttachmentDescriptionStencilLayout* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAttachmentDescriptionStencilLayout* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5058,7 +5059,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAttachmentDescri
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceHostQueryResetFeatures* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceHostQueryResetFeatures* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5071,7 +5072,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceHo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceTimelineSemaphoreFeatures* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceTimelineSemaphoreFeatures* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5084,7 +5085,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceTi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceTimelineSemaphoreProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceTimelineSemaphoreProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5097,7 +5098,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceTi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSemaphoreTypeCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSemaphoreTypeCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5111,7 +5112,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSemaphoreTypeCre
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkTimelineSemaphoreSubmitInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkTimelineSemaphoreSubmitInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5127,7 +5128,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkTimelineSemaphor
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSemaphoreWaitInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSemaphoreWaitInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5143,7 +5144,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSemaphoreWaitInf
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSemaphoreSignalInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSemaphoreSignalInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5157,7 +5158,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSemaphoreSignalI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceBufferDeviceAddressFeatures* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceBufferDeviceAddressFeatures* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5172,7 +5173,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceBu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBufferDeviceAddressInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBufferDeviceAddressInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5185,7 +5186,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBufferDeviceAddr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBufferOpaqueCaptureAddressCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBufferOpaqueCaptureAddressCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5198,7 +5199,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBufferOpaqueCapt
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryOpaqueCaptureAddressAllocateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMemoryOpaqueCaptureAddressAllocateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5211,7 +5212,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryOpaqueCapt
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceMemoryOpaqueCaptureAddressInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDeviceMemoryOpaqueCaptureAddressInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5224,7 +5225,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceMemoryOpaq
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceVulkan13Features* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceVulkan13Features* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5251,7 +5252,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceVu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceVulkan13Properties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceVulkan13Properties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5308,7 +5309,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceVu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineCreationFeedback* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineCreationFeedback* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5320,7 +5321,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineCreation
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineCreationFeedbackCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineCreationFeedbackCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5335,7 +5336,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineCreation
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderTerminateInvocationFeatures* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderTerminateInvocationFeatures* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5348,7 +5349,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceToolProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceToolProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5365,7 +5366,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceTo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5378,7 +5379,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePrivateDataFeatures* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDevicePrivateDataFeatures* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5391,7 +5392,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDevicePrivateDataCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDevicePrivateDataCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5404,7 +5405,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDevicePrivateDat
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPrivateDataSlotCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPrivateDataSlotCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5417,7 +5418,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPrivateDataSlotC
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePipelineCreationCacheControlFeatures* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDevicePipelineCreationCacheControlFeatures* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5430,7 +5431,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryBarrier2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMemoryBarrier2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5446,7 +5447,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryBarrier2*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBufferMemoryBarrier2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBufferMemoryBarrier2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5467,7 +5468,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBufferMemoryBarr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageMemoryBarrier2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageMemoryBarrier2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5489,7 +5490,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageMemoryBarri
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDependencyInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDependencyInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5508,7 +5509,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDependencyInfo*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSemaphoreSubmitInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSemaphoreSubmitInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5524,7 +5525,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSemaphoreSubmitI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCommandBufferSubmitInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkCommandBufferSubmitInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5538,7 +5539,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCommandBufferSub
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSubmitInfo2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSubmitInfo2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5557,7 +5558,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSubmitInfo2* dat
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSynchronization2Features* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceSynchronization2Features* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5570,7 +5571,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSy
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5583,7 +5584,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceZe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceImageRobustnessFeatures* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceImageRobustnessFeatures* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5596,7 +5597,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceIm
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBufferCopy2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBufferCopy2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5611,7 +5612,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBufferCopy2* dat
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCopyBufferInfo2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkCopyBufferInfo2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5627,7 +5628,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCopyBufferInfo2*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageCopy2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageCopy2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5644,7 +5645,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageCopy2* data
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCopyImageInfo2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkCopyImageInfo2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5662,7 +5663,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCopyImageInfo2*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBufferImageCopy2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBufferImageCopy2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5680,7 +5681,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBufferImageCopy2
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCopyBufferToImageInfo2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkCopyBufferToImageInfo2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5697,7 +5698,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCopyBufferToImag
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCopyImageToBufferInfo2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkCopyImageToBufferInfo2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5714,7 +5715,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCopyImageToBuffe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageBlit2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageBlit2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5730,7 +5731,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageBlit2* data
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBlitImageInfo2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBlitImageInfo2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5749,7 +5750,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBlitImageInfo2*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageResolve2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageResolve2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5766,7 +5767,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageResolve2* d
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkResolveImageInfo2* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkResolveImageInfo2* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5784,7 +5785,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkResolveImageInfo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSubgroupSizeControlFeatures* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceSubgroupSizeControlFeatures* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5798,7 +5799,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSubgroupSizeControlProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceSubgroupSizeControlProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5814,7 +5815,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineShaderStageRequiredSubgroupSizeCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineShaderStageRequiredSubgroupSizeCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5827,7 +5828,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineShaderSt
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceInlineUniformBlockFeatures* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceInlineUniformBlockFeatures* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5841,7 +5842,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceIn
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceInlineUniformBlockProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceInlineUniformBlockProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5858,7 +5859,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceIn
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkWriteDescriptorSetInlineUniformBlock* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkWriteDescriptorSetInlineUniformBlock* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5872,7 +5873,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkWriteDescriptorS
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorPoolInlineUniformBlockCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDescriptorPoolInlineUniformBlockCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5885,7 +5886,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorPoolIn
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceTextureCompressionASTCHDRFeatures* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceTextureCompressionASTCHDRFeatures* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5898,7 +5899,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceTe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderingAttachmentInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRenderingAttachmentInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5918,7 +5919,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderingAttachm
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderingInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRenderingInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5938,7 +5939,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderingInfo* d
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineRenderingCreateInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineRenderingCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5955,7 +5956,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineRenderin
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDynamicRenderingFeatures* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceDynamicRenderingFeatures* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5968,7 +5969,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDy
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCommandBufferInheritanceRenderingInfo* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkCommandBufferInheritanceRenderingInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -5987,7 +5988,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCommandBufferInh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderIntegerDotProductFeatures* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderIntegerDotProductFeatures* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6000,7 +6001,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderIntegerDotProductProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderIntegerDotProductProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6042,7 +6043,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceTexelBufferAlignmentProperties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceTexelBufferAlignmentProperties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6058,7 +6059,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceTe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkFormatProperties3* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkFormatProperties3* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6073,7 +6074,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkFormatProperties
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMaintenance4Features* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceMaintenance4Features* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6086,7 +6087,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMaintenance4Properties* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceMaintenance4Properties* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6099,7 +6100,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceBufferMemoryRequirements* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDeviceBufferMemoryRequirements* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6112,7 +6113,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceBufferMemo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceImageMemoryRequirements* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDeviceImageMemoryRequirements* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6126,7 +6127,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceImageMemor
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSurfaceCapabilitiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSurfaceCapabilitiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6146,7 +6147,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSurfaceCapabilit
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSurfaceFormatKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSurfaceFormatKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6158,7 +6159,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSurfaceFormatKHR
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSwapchainCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSwapchainCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6186,7 +6187,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSwapchainCreateI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPresentInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPresentInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6204,7 +6205,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPresentInfoKHR*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageSwapchainCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageSwapchainCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6217,7 +6218,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageSwapchainCr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindImageMemorySwapchainInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBindImageMemorySwapchainInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6231,7 +6232,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindImageMemoryS
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAcquireNextImageInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAcquireNextImageInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6248,7 +6249,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAcquireNextImage
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceGroupPresentCapabilitiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDeviceGroupPresentCapabilitiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6262,7 +6263,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceGroupPrese
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceGroupPresentInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDeviceGroupPresentInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6277,7 +6278,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceGroupPrese
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceGroupSwapchainCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDeviceGroupSwapchainCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6290,7 +6291,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceGroupSwapc
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplayModeParametersKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDisplayModeParametersKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6302,7 +6303,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplayModeParam
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplayModeCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDisplayModeCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6316,7 +6317,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplayModeCreat
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplayModePropertiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDisplayModePropertiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6328,7 +6329,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplayModePrope
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplayPlaneCapabilitiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDisplayPlaneCapabilitiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6347,7 +6348,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplayPlaneCapa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplayPlanePropertiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDisplayPlanePropertiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6359,7 +6360,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplayPlaneProp
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplayPropertiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDisplayPropertiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6376,7 +6377,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplayPropertie
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplaySurfaceCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDisplaySurfaceCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6396,7 +6397,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplaySurfaceCr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplayPresentInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDisplayPresentInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6411,7 +6412,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplayPresentIn
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkXlibSurfaceCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkXlibSurfaceCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6426,7 +6427,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkXlibSurfaceCreat
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkXcbSurfaceCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkXcbSurfaceCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6441,7 +6442,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkXcbSurfaceCreate
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkWaylandSurfaceCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkWaylandSurfaceCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6456,7 +6457,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkWaylandSurfaceCr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAndroidSurfaceCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAndroidSurfaceCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6470,7 +6471,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAndroidSurfaceCr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkWin32SurfaceCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkWin32SurfaceCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6485,7 +6486,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkWin32SurfaceCrea
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkQueueFamilyQueryResultStatusPropertiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkQueueFamilyQueryResultStatusPropertiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6498,7 +6499,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkQueueFamilyQuery
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkQueueFamilyVideoPropertiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkQueueFamilyVideoPropertiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6511,7 +6512,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkQueueFamilyVideo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoProfileInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoProfileInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6527,7 +6528,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoProfileInfo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoProfileListInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoProfileListInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6541,7 +6542,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoProfileList
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoCapabilitiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoCapabilitiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6562,7 +6563,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoCapabilitie
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceVideoFormatInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceVideoFormatInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6575,7 +6576,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceVi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoFormatPropertiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoFormatPropertiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6593,7 +6594,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoFormatPrope
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoPictureResourceInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoPictureResourceInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6609,7 +6610,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoPictureReso
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoReferenceSlotInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoReferenceSlotInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6623,7 +6624,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoReferenceSl
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoSessionMemoryRequirementsKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoSessionMemoryRequirementsKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6637,7 +6638,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoSessionMemo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindVideoSessionMemoryInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBindVideoSessionMemoryInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6653,7 +6654,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindVideoSession
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoSessionCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoSessionCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6674,7 +6675,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoSessionCrea
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoSessionParametersCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoSessionParametersCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6689,7 +6690,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoSessionPara
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoSessionParametersUpdateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoSessionParametersUpdateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6702,7 +6703,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoSessionPara
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoBeginCodingInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoBeginCodingInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6719,7 +6720,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoBeginCoding
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEndCodingInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEndCodingInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6732,7 +6733,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEndCodingIn
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoCodingControlInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoCodingControlInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6745,7 +6746,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoCodingContr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeCapabilitiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoDecodeCapabilitiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6758,7 +6759,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeCapab
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeUsageInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoDecodeUsageInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6771,7 +6772,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeUsage
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoDecodeInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6791,7 +6792,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeInfoK
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264CapabilitiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH264CapabilitiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6816,7 +6817,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264C
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264QpKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH264QpKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6829,7 +6830,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264Q
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264QualityLevelPropertiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH264QualityLevelPropertiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6850,7 +6851,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264Q
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264SessionCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH264SessionCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6864,7 +6865,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264S
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264SessionParametersAddInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH264SessionParametersAddInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6880,7 +6881,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264S
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264SessionParametersCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH264SessionParametersCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6895,7 +6896,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264S
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264SessionParametersGetInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH264SessionParametersGetInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6911,7 +6912,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264S
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264SessionParametersFeedbackInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH264SessionParametersFeedbackInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6925,7 +6926,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264S
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264NaluSliceInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH264NaluSliceInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6939,7 +6940,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264N
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264PictureInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH264PictureInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6955,7 +6956,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264P
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264DpbSlotInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH264DpbSlotInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6968,7 +6969,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264D
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264ProfileInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH264ProfileInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6981,7 +6982,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264P
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264RateControlInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH264RateControlInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -6998,7 +6999,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264R
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264FrameSizeKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH264FrameSizeKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7011,7 +7012,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264F
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264RateControlLayerInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH264RateControlLayerInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7029,7 +7030,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264R
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264GopRemainingFrameInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH264GopRemainingFrameInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7045,7 +7046,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH264G
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265CapabilitiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH265CapabilitiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7073,7 +7074,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265C
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265SessionCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH265SessionCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7087,7 +7088,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265S
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265QpKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH265QpKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7100,7 +7101,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265Q
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265QualityLevelPropertiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH265QualityLevelPropertiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7120,7 +7121,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265Q
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265SessionParametersAddInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH265SessionParametersAddInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7138,7 +7139,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265S
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265SessionParametersCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH265SessionParametersCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7154,7 +7155,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265S
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265SessionParametersGetInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH265SessionParametersGetInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7172,7 +7173,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265S
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265SessionParametersFeedbackInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH265SessionParametersFeedbackInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7187,7 +7188,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265S
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265NaluSliceSegmentInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH265NaluSliceSegmentInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7201,7 +7202,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265N
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265PictureInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH265PictureInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7216,7 +7217,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265P
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265DpbSlotInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH265DpbSlotInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7229,7 +7230,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265D
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265ProfileInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH265ProfileInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7242,7 +7243,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265P
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265RateControlInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH265RateControlInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7259,7 +7260,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265R
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265FrameSizeKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH265FrameSizeKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7272,7 +7273,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265F
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265RateControlLayerInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH265RateControlLayerInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7290,7 +7291,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265R
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265GopRemainingFrameInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeH265GopRemainingFrameInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7306,7 +7307,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeH265G
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeH264ProfileInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoDecodeH264ProfileInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7320,7 +7321,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeH264P
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeH264CapabilitiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoDecodeH264CapabilitiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7334,7 +7335,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeH264C
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeH264SessionParametersAddInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoDecodeH264SessionParametersAddInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7350,7 +7351,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeH264S
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeH264SessionParametersCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoDecodeH264SessionParametersCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7365,7 +7366,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeH264S
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeH264PictureInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoDecodeH264PictureInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7380,7 +7381,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeH264P
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeH264DpbSlotInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoDecodeH264DpbSlotInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7393,7 +7394,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeH264D
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderingFragmentShadingRateAttachmentInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRenderingFragmentShadingRateAttachmentInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7408,7 +7409,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderingFragmen
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderingFragmentDensityMapAttachmentInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRenderingFragmentDensityMapAttachmentInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7422,7 +7423,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderingFragmen
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAttachmentSampleCountInfoAMD* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAttachmentSampleCountInfoAMD* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7437,7 +7438,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAttachmentSample
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMultiviewPerViewAttributesInfoNVX* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMultiviewPerViewAttributesInfoNVX* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7451,7 +7452,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMultiviewPerView
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImportMemoryWin32HandleInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImportMemoryWin32HandleInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7466,7 +7467,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImportMemoryWin3
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExportMemoryWin32HandleInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkExportMemoryWin32HandleInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7481,7 +7482,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExportMemoryWin3
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryWin32HandlePropertiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMemoryWin32HandlePropertiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7494,7 +7495,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryWin32Handl
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryGetWin32HandleInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMemoryGetWin32HandleInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7508,7 +7509,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryGetWin32Ha
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImportMemoryFdInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImportMemoryFdInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7522,7 +7523,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImportMemoryFdIn
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryFdPropertiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMemoryFdPropertiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7535,7 +7536,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryFdProperti
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryGetFdInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMemoryGetFdInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7549,7 +7550,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryGetFdInfoK
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkWin32KeyedMutexAcquireReleaseInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkWin32KeyedMutexAcquireReleaseInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7568,7 +7569,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkWin32KeyedMutexA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImportSemaphoreWin32HandleInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImportSemaphoreWin32HandleInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7585,7 +7586,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImportSemaphoreW
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExportSemaphoreWin32HandleInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkExportSemaphoreWin32HandleInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7600,7 +7601,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExportSemaphoreW
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkD3D12FenceSubmitInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkD3D12FenceSubmitInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7616,7 +7617,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkD3D12FenceSubmit
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSemaphoreGetWin32HandleInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSemaphoreGetWin32HandleInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7630,7 +7631,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSemaphoreGetWin3
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImportSemaphoreFdInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImportSemaphoreFdInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7646,7 +7647,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImportSemaphoreF
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSemaphoreGetFdInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSemaphoreGetFdInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7660,7 +7661,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSemaphoreGetFdIn
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePushDescriptorPropertiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDevicePushDescriptorPropertiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7673,7 +7674,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRectLayerKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRectLayerKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7686,7 +7687,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRectLayerKHR* da
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPresentRegionKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPresentRegionKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7698,7 +7699,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPresentRegionKHR
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPresentRegionsKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPresentRegionsKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7712,7 +7713,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPresentRegionsKH
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSharedPresentSurfaceCapabilitiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSharedPresentSurfaceCapabilitiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7725,7 +7726,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSharedPresentSur
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImportFenceWin32HandleInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImportFenceWin32HandleInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7742,7 +7743,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImportFenceWin32
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExportFenceWin32HandleInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkExportFenceWin32HandleInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7757,7 +7758,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExportFenceWin32
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkFenceGetWin32HandleInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkFenceGetWin32HandleInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7771,7 +7772,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkFenceGetWin32Han
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImportFenceFdInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImportFenceFdInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7787,7 +7788,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImportFenceFdInf
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkFenceGetFdInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkFenceGetFdInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7801,7 +7802,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkFenceGetFdInfoKH
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePerformanceQueryFeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDevicePerformanceQueryFeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7815,7 +7816,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePerformanceQueryPropertiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDevicePerformanceQueryPropertiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7828,7 +7829,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPerformanceCounterKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPerformanceCounterKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7844,7 +7845,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPerformanceCount
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPerformanceCounterDescriptionKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPerformanceCounterDescriptionKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7860,7 +7861,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPerformanceCount
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkQueryPoolPerformanceCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkQueryPoolPerformanceCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7875,7 +7876,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkQueryPoolPerform
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAcquireProfilingLockInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAcquireProfilingLockInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7889,7 +7890,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAcquireProfiling
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPerformanceQuerySubmitInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPerformanceQuerySubmitInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7902,7 +7903,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPerformanceQuery
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSurfaceInfo2KHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceSurfaceInfo2KHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7915,7 +7916,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSurfaceCapabilities2KHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSurfaceCapabilities2KHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7928,7 +7929,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSurfaceCapabilit
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSurfaceFormat2KHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSurfaceFormat2KHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7941,7 +7942,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSurfaceFormat2KH
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplayProperties2KHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDisplayProperties2KHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7954,7 +7955,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplayPropertie
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplayPlaneProperties2KHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDisplayPlaneProperties2KHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7967,7 +7968,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplayPlaneProp
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplayModeProperties2KHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDisplayModeProperties2KHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7980,7 +7981,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplayModePrope
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplayPlaneInfo2KHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDisplayPlaneInfo2KHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -7994,7 +7995,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplayPlaneInfo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplayPlaneCapabilities2KHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDisplayPlaneCapabilities2KHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8007,7 +8008,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplayPlaneCapa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePortabilitySubsetFeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDevicePortabilitySubsetFeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8034,7 +8035,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePortabilitySubsetPropertiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDevicePortabilitySubsetPropertiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8047,7 +8048,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderClockFeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderClockFeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8061,7 +8062,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeH265ProfileInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoDecodeH265ProfileInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8074,7 +8075,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeH265P
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeH265CapabilitiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoDecodeH265CapabilitiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8087,7 +8088,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeH265C
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeH265SessionParametersAddInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoDecodeH265SessionParametersAddInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8105,7 +8106,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeH265S
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeH265SessionParametersCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoDecodeH265SessionParametersCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8121,7 +8122,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeH265S
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeH265PictureInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoDecodeH265PictureInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8136,7 +8137,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeH265P
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeH265DpbSlotInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoDecodeH265DpbSlotInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8149,7 +8150,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeH265D
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceQueueGlobalPriorityCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDeviceQueueGlobalPriorityCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8162,7 +8163,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceQueueGloba
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8175,7 +8176,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceGl
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkQueueFamilyGlobalPriorityPropertiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkQueueFamilyGlobalPriorityPropertiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8189,7 +8190,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkQueueFamilyGloba
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkFragmentShadingRateAttachmentInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkFragmentShadingRateAttachmentInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8203,7 +8204,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkFragmentShadingR
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineFragmentShadingRateStateCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineFragmentShadingRateStateCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8217,7 +8218,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineFragment
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFragmentShadingRateFeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceFragmentShadingRateFeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8232,7 +8233,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFragmentShadingRatePropertiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceFragmentShadingRatePropertiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8261,7 +8262,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFragmentShadingRateKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceFragmentShadingRateKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8275,7 +8276,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDynamicRenderingLocalReadFeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceDynamicRenderingLocalReadFeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8288,7 +8289,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDy
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderingAttachmentLocationInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRenderingAttachmentLocationInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8302,7 +8303,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderingAttachm
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderingInputAttachmentIndexInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRenderingInputAttachmentIndexInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8318,7 +8319,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderingInputAt
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderQuadControlFeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderQuadControlFeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8331,7 +8332,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSurfaceProtectedCapabilitiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSurfaceProtectedCapabilitiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8344,7 +8345,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSurfaceProtected
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePresentWaitFeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDevicePresentWaitFeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8357,7 +8358,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8370,7 +8371,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8383,7 +8384,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineInfoKHR*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineExecutablePropertiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineExecutablePropertiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8399,7 +8400,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineExecutab
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineExecutableInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineExecutableInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8413,7 +8414,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineExecutab
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineExecutableInternalRepresentationKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineExecutableInternalRepresentationKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8430,7 +8431,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineExecutab
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryMapInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMemoryMapInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8446,7 +8447,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryMapInfoKHR
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryUnmapInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMemoryUnmapInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8460,7 +8461,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryUnmapInfoK
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineLibraryCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineLibraryCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8474,7 +8475,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineLibraryC
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPresentIdKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPresentIdKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8488,7 +8489,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPresentIdKHR* da
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePresentIdFeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDevicePresentIdFeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8501,7 +8502,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8522,7 +8523,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeInfoK
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeCapabilitiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeCapabilitiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8541,7 +8542,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeCapab
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkQueryPoolVideoEncodeFeedbackCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkQueryPoolVideoEncodeFeedbackCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8554,7 +8555,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkQueryPoolVideoEn
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeUsageInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeUsageInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8569,7 +8570,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeUsage
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeRateControlLayerInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeRateControlLayerInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8585,7 +8586,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeRateC
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeRateControlInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeRateControlInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8603,7 +8604,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeRateC
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8617,7 +8618,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceVi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeQualityLevelPropertiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeQualityLevelPropertiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8631,7 +8632,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeQuali
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeQualityLevelInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeQualityLevelInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8644,7 +8645,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeQuali
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeSessionParametersGetInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeSessionParametersGetInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8657,7 +8658,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeSessi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeSessionParametersFeedbackInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoEncodeSessionParametersFeedbackInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8670,7 +8671,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoEncodeSessi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkQueueFamilyCheckpointProperties2NV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkQueueFamilyCheckpointProperties2NV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8683,7 +8684,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkQueueFamilyCheck
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCheckpointData2NV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkCheckpointData2NV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8697,7 +8698,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCheckpointData2N
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8710,7 +8711,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8723,7 +8724,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8736,7 +8737,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8752,7 +8753,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceWo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8766,7 +8767,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkTraceRaysIndirectCommand2KHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkTraceRaysIndirectCommand2KHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8790,7 +8791,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkTraceRaysIndirec
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderSubgroupRotateFeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderSubgroupRotateFeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8804,7 +8805,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderMaximalReconvergenceFeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderMaximalReconvergenceFeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8817,7 +8818,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMaintenance5FeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceMaintenance5FeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8830,7 +8831,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMaintenance5PropertiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceMaintenance5PropertiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8848,7 +8849,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderingAreaInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRenderingAreaInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8865,7 +8866,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderingAreaInf
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageSubresource2KHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageSubresource2KHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8878,7 +8879,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageSubresource
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceImageSubresourceInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDeviceImageSubresourceInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8892,7 +8893,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceImageSubre
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSubresourceLayout2KHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSubresourceLayout2KHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8905,7 +8906,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSubresourceLayou
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineCreateFlags2CreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineCreateFlags2CreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8918,7 +8919,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineCreateFl
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBufferUsageFlags2CreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBufferUsageFlags2CreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8931,7 +8932,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBufferUsageFlags
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8944,7 +8945,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePipelineBinaryFeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDevicePipelineBinaryFeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8957,7 +8958,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePipelineBinaryPropertiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDevicePipelineBinaryPropertiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8974,7 +8975,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDevicePipelineBinaryInternalCacheControlKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDevicePipelineBinaryInternalCacheControlKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -8987,7 +8988,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDevicePipelineBi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineBinaryKeyKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineBinaryKeyKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9001,7 +9002,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineBinaryKe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineBinaryDataKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineBinaryDataKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9013,7 +9014,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineBinaryDa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineBinaryKeysAndDataKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineBinaryKeysAndDataKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9026,7 +9027,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineBinaryKe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9038,7 +9039,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineCreateIn
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineBinaryCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineBinaryCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9053,7 +9054,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineBinaryCr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineBinaryInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineBinaryInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9067,7 +9068,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineBinaryIn
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkReleaseCapturedPipelineDataInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkReleaseCapturedPipelineDataInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9080,7 +9081,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkReleaseCapturedP
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineBinaryDataInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineBinaryDataInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9093,7 +9094,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineBinaryDa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineBinaryHandlesInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineBinaryHandlesInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9107,7 +9108,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineBinaryHa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCooperativeMatrixPropertiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkCooperativeMatrixPropertiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9128,7 +9129,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCooperativeMatri
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCooperativeMatrixFeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceCooperativeMatrixFeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9142,7 +9143,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCooperativeMatrixPropertiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceCooperativeMatrixPropertiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9155,7 +9156,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceComputeShaderDerivativesFeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceComputeShaderDerivativesFeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9169,7 +9170,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceComputeShaderDerivativesPropertiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceComputeShaderDerivativesPropertiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9182,7 +9183,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeAV1ProfileInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoDecodeAV1ProfileInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9196,7 +9197,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeAV1Pr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeAV1CapabilitiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoDecodeAV1CapabilitiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9209,7 +9210,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeAV1Ca
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeAV1SessionParametersCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoDecodeAV1SessionParametersCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9222,7 +9223,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeAV1Se
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeAV1PictureInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoDecodeAV1PictureInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9240,7 +9241,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeAV1Pi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeAV1DpbSlotInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoDecodeAV1DpbSlotInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9253,7 +9254,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoDecodeAV1Dp
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceVideoMaintenance1FeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceVideoMaintenance1FeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9266,7 +9267,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceVi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoInlineQueryInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVideoInlineQueryInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9281,7 +9282,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVideoInlineQuery
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceVertexAttributeDivisorPropertiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceVertexAttributeDivisorPropertiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9295,7 +9296,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceVe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVertexInputBindingDivisorDescriptionKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVertexInputBindingDivisorDescriptionKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9307,7 +9308,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVertexInputBindi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineVertexInputDivisorStateCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineVertexInputDivisorStateCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9321,7 +9322,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineVertexIn
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9335,7 +9336,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceVe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderFloatControls2FeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderFloatControls2FeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9348,7 +9349,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceIndexTypeUint8FeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceIndexTypeUint8FeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9361,7 +9362,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceIn
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceLineRasterizationFeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceLineRasterizationFeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9379,7 +9380,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceLi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceLineRasterizationPropertiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceLineRasterizationPropertiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9392,7 +9393,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceLi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineRasterizationLineStateCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineRasterizationLineStateCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9408,7 +9409,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineRasteriz
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCalibratedTimestampInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkCalibratedTimestampInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9421,7 +9422,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCalibratedTimest
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderExpectAssumeFeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderExpectAssumeFeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9434,7 +9435,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMaintenance6FeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceMaintenance6FeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9447,7 +9448,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMaintenance6PropertiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceMaintenance6PropertiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9462,7 +9463,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindMemoryStatusKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBindMemoryStatusKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9475,7 +9476,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindMemoryStatus
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindDescriptorSetsInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBindDescriptorSetsInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9494,7 +9495,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindDescriptorSe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPushConstantsInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPushConstantsInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9511,7 +9512,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPushConstantsInf
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPushDescriptorSetInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPushDescriptorSetInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9528,7 +9529,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPushDescriptorSe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSetDescriptorBufferOffsetsInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSetDescriptorBufferOffsetsInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9546,7 +9547,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSetDescriptorBuf
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindDescriptorBufferEmbeddedSamplersInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBindDescriptorBufferEmbeddedSamplersInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9561,7 +9562,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindDescriptorBu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderRelaxedExtendedInstructionFeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderRelaxedExtendedInstructionFeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9574,7 +9575,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMaintenance7FeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceMaintenance7FeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9587,7 +9588,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMaintenance7PropertiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceMaintenance7PropertiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9607,7 +9608,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceLayeredApiPropertiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceLayeredApiPropertiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9623,7 +9624,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceLa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceLayeredApiPropertiesListKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceLayeredApiPropertiesListKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9637,7 +9638,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceLa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceLayeredApiVulkanPropertiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceLayeredApiVulkanPropertiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9650,7 +9651,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceLa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDebugReportCallbackCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDebugReportCallbackCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9665,7 +9666,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDebugReportCallb
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineRasterizationStateRasterizationOrderAMD* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineRasterizationStateRasterizationOrderAMD* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9678,7 +9679,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineRasteriz
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDebugMarkerObjectNameInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDebugMarkerObjectNameInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9693,7 +9694,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDebugMarkerObjec
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDebugMarkerObjectTagInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDebugMarkerObjectTagInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9710,7 +9711,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDebugMarkerObjec
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDebugMarkerMarkerInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDebugMarkerMarkerInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9724,7 +9725,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDebugMarkerMarke
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDedicatedAllocationImageCreateInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDedicatedAllocationImageCreateInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9737,7 +9738,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDedicatedAllocat
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDedicatedAllocationBufferCreateInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDedicatedAllocationBufferCreateInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9750,7 +9751,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDedicatedAllocat
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDedicatedAllocationMemoryAllocateInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDedicatedAllocationMemoryAllocateInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9764,7 +9765,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDedicatedAllocat
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceTransformFeedbackFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceTransformFeedbackFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9778,7 +9779,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceTr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceTransformFeedbackPropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceTransformFeedbackPropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9800,7 +9801,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceTr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineRasterizationStateStreamCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineRasterizationStateStreamCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9814,7 +9815,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineRasteriz
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageViewHandleInfoNVX* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageViewHandleInfoNVX* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9829,7 +9830,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageViewHandleI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageViewAddressPropertiesNVX* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageViewAddressPropertiesNVX* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9843,7 +9844,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageViewAddress
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkTextureLODGatherFormatPropertiesAMD* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkTextureLODGatherFormatPropertiesAMD* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9856,7 +9857,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkTextureLODGather
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkShaderResourceUsageAMD* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkShaderResourceUsageAMD* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9871,7 +9872,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkShaderResourceUs
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkShaderStatisticsInfoAMD* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkShaderStatisticsInfoAMD* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9888,7 +9889,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkShaderStatistics
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkStreamDescriptorSurfaceCreateInfoGGP* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkStreamDescriptorSurfaceCreateInfoGGP* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9902,7 +9903,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkStreamDescriptor
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCornerSampledImageFeaturesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceCornerSampledImageFeaturesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9915,7 +9916,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExternalImageFormatPropertiesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkExternalImageFormatPropertiesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9929,7 +9930,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExternalImageFor
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExternalMemoryImageCreateInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkExternalMemoryImageCreateInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9942,7 +9943,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExternalMemoryIm
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExportMemoryAllocateInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkExportMemoryAllocateInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9955,7 +9956,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExportMemoryAllo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImportMemoryWin32HandleInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImportMemoryWin32HandleInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9969,7 +9970,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImportMemoryWin3
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExportMemoryWin32HandleInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkExportMemoryWin32HandleInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -9983,7 +9984,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExportMemoryWin3
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkWin32KeyedMutexAcquireReleaseInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkWin32KeyedMutexAcquireReleaseInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10002,7 +10003,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkWin32KeyedMutexA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkValidationFlagsEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkValidationFlagsEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10016,7 +10017,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkValidationFlagsE
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkViSurfaceCreateInfoNN* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkViSurfaceCreateInfoNN* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10030,7 +10031,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkViSurfaceCreateI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageViewASTCDecodeModeEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageViewASTCDecodeModeEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10043,7 +10044,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageViewASTCDec
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceASTCDecodeFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceASTCDecodeFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10056,7 +10057,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceAS
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePipelineRobustnessFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDevicePipelineRobustnessFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10069,7 +10070,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePipelineRobustnessPropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDevicePipelineRobustnessPropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10085,7 +10086,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineRobustnessCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineRobustnessCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10101,7 +10102,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineRobustne
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkConditionalRenderingBeginInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkConditionalRenderingBeginInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10116,7 +10117,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkConditionalRende
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceConditionalRenderingFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceConditionalRenderingFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10130,7 +10131,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCommandBufferInheritanceConditionalRenderingInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkCommandBufferInheritanceConditionalRenderingInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10143,7 +10144,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCommandBufferInh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkViewportWScalingNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkViewportWScalingNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10155,7 +10156,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkViewportWScaling
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineViewportWScalingStateCreateInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineViewportWScalingStateCreateInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10170,7 +10171,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineViewport
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSurfaceCapabilities2EXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSurfaceCapabilities2EXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10193,7 +10194,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSurfaceCapabilit
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplayPowerInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDisplayPowerInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10206,7 +10207,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplayPowerInfo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceEventInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDeviceEventInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10219,7 +10220,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceEventInfoE
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplayEventInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDisplayEventInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10232,7 +10233,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplayEventInfo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSwapchainCounterCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSwapchainCounterCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10245,7 +10246,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSwapchainCounter
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRefreshCycleDurationGOOGLE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRefreshCycleDurationGOOGLE* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10256,7 +10257,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRefreshCycleDura
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPastPresentationTimingGOOGLE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPastPresentationTimingGOOGLE* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10271,7 +10272,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPastPresentation
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPresentTimeGOOGLE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPresentTimeGOOGLE* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10283,7 +10284,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPresentTimeGOOGL
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPresentTimesInfoGOOGLE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPresentTimesInfoGOOGLE* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10297,7 +10298,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPresentTimesInfo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10310,7 +10311,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkViewportSwizzleNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkViewportSwizzleNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10324,7 +10325,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkViewportSwizzleN
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineViewportSwizzleStateCreateInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineViewportSwizzleStateCreateInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10339,7 +10340,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineViewport
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDiscardRectanglePropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceDiscardRectanglePropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10352,7 +10353,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineDiscardRectangleStateCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineDiscardRectangleStateCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10368,7 +10369,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineDiscardR
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceConservativeRasterizationPropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceConservativeRasterizationPropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10389,7 +10390,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineRasterizationConservativeStateCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineRasterizationConservativeStateCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10404,7 +10405,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineRasteriz
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDepthClipEnableFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceDepthClipEnableFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10417,7 +10418,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineRasterizationDepthClipStateCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineRasterizationDepthClipStateCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10431,7 +10432,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineRasteriz
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkXYColorEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkXYColorEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10443,7 +10444,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkXYColorEXT* data
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkHdrMetadataEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkHdrMetadataEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10463,7 +10464,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkHdrMetadataEXT*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10476,7 +10477,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkIOSSurfaceCreateInfoMVK* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkIOSSurfaceCreateInfoMVK* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10490,7 +10491,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkIOSSurfaceCreate
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMacOSSurfaceCreateInfoMVK* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMacOSSurfaceCreateInfoMVK* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10504,7 +10505,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMacOSSurfaceCrea
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDebugUtilsLabelEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDebugUtilsLabelEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10518,7 +10519,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDebugUtilsLabelE
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDebugUtilsObjectNameInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDebugUtilsObjectNameInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10533,7 +10534,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDebugUtilsObject
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDebugUtilsMessengerCallbackDataEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDebugUtilsMessengerCallbackDataEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10555,7 +10556,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDebugUtilsMessen
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDebugUtilsMessengerCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDebugUtilsMessengerCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10572,7 +10573,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDebugUtilsMessen
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDebugUtilsObjectTagInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDebugUtilsObjectTagInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10589,7 +10590,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDebugUtilsObject
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAndroidHardwareBufferUsageANDROID* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAndroidHardwareBufferUsageANDROID* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10602,7 +10603,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAndroidHardwareB
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAndroidHardwareBufferPropertiesANDROID* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAndroidHardwareBufferPropertiesANDROID* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10616,7 +10617,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAndroidHardwareB
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAndroidHardwareBufferFormatPropertiesANDROID* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAndroidHardwareBufferFormatPropertiesANDROID* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10636,7 +10637,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAndroidHardwareB
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImportAndroidHardwareBufferInfoANDROID* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImportAndroidHardwareBufferInfoANDROID* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10649,7 +10650,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImportAndroidHar
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryGetAndroidHardwareBufferInfoANDROID* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMemoryGetAndroidHardwareBufferInfoANDROID* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10662,7 +10663,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryGetAndroid
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExternalFormatANDROID* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkExternalFormatANDROID* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10675,7 +10676,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExternalFormatAN
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAndroidHardwareBufferFormatProperties2ANDROID* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAndroidHardwareBufferFormatProperties2ANDROID* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10695,7 +10696,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAndroidHardwareB
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSampleLocationEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSampleLocationEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10707,7 +10708,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSampleLocationEX
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSampleLocationsInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSampleLocationsInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10723,7 +10724,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSampleLocationsI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAttachmentSampleLocationsEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAttachmentSampleLocationsEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10735,7 +10736,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAttachmentSample
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSubpassSampleLocationsEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSubpassSampleLocationsEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10747,7 +10748,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSubpassSampleLoc
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassSampleLocationsBeginInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRenderPassSampleLocationsBeginInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10763,7 +10764,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassSample
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineSampleLocationsStateCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineSampleLocationsStateCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10777,7 +10778,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineSampleLo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSampleLocationsPropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceSampleLocationsPropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10794,7 +10795,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMultisamplePropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMultisamplePropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10807,7 +10808,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMultisamplePrope
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10820,7 +10821,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceBl
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10838,7 +10839,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceBl
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineColorBlendAdvancedStateCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineColorBlendAdvancedStateCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10853,7 +10854,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineColorBle
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineCoverageToColorStateCreateInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineCoverageToColorStateCreateInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10868,7 +10869,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineCoverage
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineCoverageModulationStateCreateInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineCoverageModulationStateCreateInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10885,7 +10886,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineCoverage
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10899,7 +10900,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10912,7 +10913,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDrmFormatModifierPropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDrmFormatModifierPropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10925,7 +10926,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDrmFormatModifie
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDrmFormatModifierPropertiesListEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDrmFormatModifierPropertiesListEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10939,7 +10940,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDrmFormatModifie
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceImageDrmFormatModifierInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceImageDrmFormatModifierInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10955,7 +10956,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceIm
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageDrmFormatModifierListCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageDrmFormatModifierListCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10969,7 +10970,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageDrmFormatMo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageDrmFormatModifierExplicitCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageDrmFormatModifierExplicitCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10984,7 +10985,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageDrmFormatMo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageDrmFormatModifierPropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageDrmFormatModifierPropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -10997,7 +10998,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageDrmFormatMo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDrmFormatModifierProperties2EXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDrmFormatModifierProperties2EXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11010,7 +11011,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDrmFormatModifie
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDrmFormatModifierPropertiesList2EXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDrmFormatModifierPropertiesList2EXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11024,7 +11025,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDrmFormatModifie
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkValidationCacheCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkValidationCacheCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11039,7 +11040,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkValidationCacheC
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkShaderModuleValidationCacheCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkShaderModuleValidationCacheCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11052,7 +11053,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkShaderModuleVali
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkShadingRatePaletteNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkShadingRatePaletteNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11064,7 +11065,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkShadingRatePalet
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineViewportShadingRateImageStateCreateInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineViewportShadingRateImageStateCreateInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11079,7 +11080,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineViewport
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShadingRateImageFeaturesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShadingRateImageFeaturesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11093,7 +11094,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShadingRateImagePropertiesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShadingRateImagePropertiesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11108,7 +11109,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCoarseSampleLocationNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkCoarseSampleLocationNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11121,7 +11122,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCoarseSampleLoca
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCoarseSampleOrderCustomNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkCoarseSampleOrderCustomNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11135,7 +11136,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCoarseSampleOrde
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11150,7 +11151,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineViewport
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRayTracingShaderGroupCreateInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRayTracingShaderGroupCreateInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11167,7 +11168,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRayTracingShader
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRayTracingPipelineCreateInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRayTracingPipelineCreateInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11188,7 +11189,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRayTracingPipeli
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkGeometryTrianglesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkGeometryTrianglesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11211,7 +11212,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkGeometryTriangle
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkGeometryAABBNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkGeometryAABBNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11227,7 +11228,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkGeometryAABBNV*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkGeometryDataNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkGeometryDataNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11239,7 +11240,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkGeometryDataNV*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkGeometryNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkGeometryNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11254,7 +11255,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkGeometryNV* data
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStructureInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAccelerationStructureInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11271,7 +11272,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStru
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStructureCreateInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAccelerationStructureCreateInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11285,7 +11286,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStru
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindAccelerationStructureMemoryInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBindAccelerationStructureMemoryInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11302,7 +11303,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindAcceleration
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkWriteDescriptorSetAccelerationStructureNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkWriteDescriptorSetAccelerationStructureNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11316,7 +11317,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkWriteDescriptorS
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStructureMemoryRequirementsInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAccelerationStructureMemoryRequirementsInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11330,7 +11331,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStru
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRayTracingPropertiesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceRayTracingPropertiesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11350,7 +11351,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkTransformMatrixKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkTransformMatrixKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11361,7 +11362,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkTransformMatrixK
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAabbPositionsKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAabbPositionsKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11377,7 +11378,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAabbPositionsKHR
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStructureInstanceKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAccelerationStructureInstanceKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11393,7 +11394,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStru
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11406,7 +11407,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineRepresentativeFragmentTestStateCreateInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineRepresentativeFragmentTestStateCreateInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11419,7 +11420,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineRepresen
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceImageViewImageFormatInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceImageViewImageFormatInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11432,7 +11433,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceIm
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkFilterCubicImageViewImageFormatPropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkFilterCubicImageViewImageFormatPropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11446,7 +11447,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkFilterCubicImage
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImportMemoryHostPointerInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImportMemoryHostPointerInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11460,7 +11461,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImportMemoryHost
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryHostPointerPropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMemoryHostPointerPropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11473,7 +11474,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryHostPointe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceExternalMemoryHostPropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceExternalMemoryHostPropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11486,7 +11487,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceEx
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineCompilerControlCreateInfoAMD* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineCompilerControlCreateInfoAMD* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11499,7 +11500,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineCompiler
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderCorePropertiesAMD* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderCorePropertiesAMD* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11525,7 +11526,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceMemoryOverallocationCreateInfoAMD* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDeviceMemoryOverallocationCreateInfoAMD* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11538,7 +11539,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceMemoryOver
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11551,7 +11552,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceVe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPresentFrameTokenGGP* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPresentFrameTokenGGP* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11564,7 +11565,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPresentFrameToke
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMeshShaderFeaturesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceMeshShaderFeaturesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11578,7 +11579,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMeshShaderPropertiesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceMeshShaderPropertiesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11603,7 +11604,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDrawMeshTasksIndirectCommandNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDrawMeshTasksIndirectCommandNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11615,7 +11616,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDrawMeshTasksInd
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderImageFootprintFeaturesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderImageFootprintFeaturesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11628,7 +11629,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineViewportExclusiveScissorStateCreateInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineViewportExclusiveScissorStateCreateInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11642,7 +11643,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineViewport
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceExclusiveScissorFeaturesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceExclusiveScissorFeaturesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11655,7 +11656,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceEx
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkQueueFamilyCheckpointPropertiesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkQueueFamilyCheckpointPropertiesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11668,7 +11669,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkQueueFamilyCheck
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCheckpointDataNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkCheckpointDataNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11682,7 +11683,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCheckpointDataNV
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11695,7 +11696,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkInitializePerformanceApiInfoINTEL* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkInitializePerformanceApiInfoINTEL* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11708,7 +11709,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkInitializePerfor
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkQueryPoolPerformanceQueryCreateInfoINTEL* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkQueryPoolPerformanceQueryCreateInfoINTEL* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11721,7 +11722,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkQueryPoolPerform
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPerformanceMarkerInfoINTEL* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPerformanceMarkerInfoINTEL* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11734,7 +11735,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPerformanceMarke
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPerformanceStreamMarkerInfoINTEL* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPerformanceStreamMarkerInfoINTEL* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11747,7 +11748,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPerformanceStrea
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPerformanceOverrideInfoINTEL* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPerformanceOverrideInfoINTEL* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11762,7 +11763,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPerformanceOverr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPerformanceConfigurationAcquireInfoINTEL* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPerformanceConfigurationAcquireInfoINTEL* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11775,7 +11776,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPerformanceConfi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePCIBusInfoPropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDevicePCIBusInfoPropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11791,7 +11792,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePC
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplayNativeHdrSurfaceCapabilitiesAMD* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDisplayNativeHdrSurfaceCapabilitiesAMD* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11804,7 +11805,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDisplayNativeHdr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSwapchainDisplayNativeHdrCreateInfoAMD* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSwapchainDisplayNativeHdrCreateInfoAMD* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11817,7 +11818,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSwapchainDisplay
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImagePipeSurfaceCreateInfoFUCHSIA* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImagePipeSurfaceCreateInfoFUCHSIA* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11831,7 +11832,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImagePipeSurface
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMetalSurfaceCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMetalSurfaceCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11845,7 +11846,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMetalSurfaceCrea
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFragmentDensityMapFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceFragmentDensityMapFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11860,7 +11861,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFragmentDensityMapPropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceFragmentDensityMapPropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11875,7 +11876,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassFragmentDensityMapCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRenderPassFragmentDensityMapCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11888,7 +11889,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassFragme
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderCoreProperties2AMD* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderCoreProperties2AMD* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11902,7 +11903,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCoherentMemoryFeaturesAMD* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceCoherentMemoryFeaturesAMD* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11915,7 +11916,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11929,7 +11930,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMemoryBudgetPropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceMemoryBudgetPropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11943,7 +11944,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMemoryPriorityFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceMemoryPriorityFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11956,7 +11957,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryPriorityAllocateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMemoryPriorityAllocateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11969,7 +11970,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryPriorityAl
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11982,7 +11983,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -11997,7 +11998,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceBu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBufferDeviceAddressCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBufferDeviceAddressCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12010,7 +12011,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBufferDeviceAddr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkValidationFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkValidationFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12026,7 +12027,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkValidationFeatur
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCooperativeMatrixPropertiesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkCooperativeMatrixPropertiesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12046,7 +12047,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCooperativeMatri
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCooperativeMatrixFeaturesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceCooperativeMatrixFeaturesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12060,7 +12061,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCooperativeMatrixPropertiesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceCooperativeMatrixPropertiesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12073,7 +12074,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCoverageReductionModeFeaturesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceCoverageReductionModeFeaturesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12086,7 +12087,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineCoverageReductionStateCreateInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineCoverageReductionStateCreateInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12100,7 +12101,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineCoverage
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkFramebufferMixedSamplesCombinationNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkFramebufferMixedSamplesCombinationNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12116,7 +12117,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkFramebufferMixed
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12131,7 +12132,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12144,7 +12145,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceYc
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceProvokingVertexFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceProvokingVertexFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12158,7 +12159,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceProvokingVertexPropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceProvokingVertexPropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12172,7 +12173,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineRasterizationProvokingVertexStateCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineRasterizationProvokingVertexStateCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12185,7 +12186,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineRasteriz
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSurfaceFullScreenExclusiveInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSurfaceFullScreenExclusiveInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12198,7 +12199,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSurfaceFullScree
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSurfaceCapabilitiesFullScreenExclusiveEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSurfaceCapabilitiesFullScreenExclusiveEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12211,7 +12212,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSurfaceCapabilit
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSurfaceFullScreenExclusiveWin32InfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSurfaceFullScreenExclusiveWin32InfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12224,7 +12225,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSurfaceFullScree
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkHeadlessSurfaceCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkHeadlessSurfaceCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12237,7 +12238,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkHeadlessSurfaceC
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderAtomicFloatFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderAtomicFloatFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12261,7 +12262,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceExtendedDynamicStateFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceExtendedDynamicStateFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12274,7 +12275,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceEx
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceHostImageCopyFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceHostImageCopyFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12287,7 +12288,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceHo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceHostImageCopyPropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceHostImageCopyPropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12305,7 +12306,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceHo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryToImageCopyEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMemoryToImageCopyEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12323,7 +12324,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryToImageCop
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageToMemoryCopyEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageToMemoryCopyEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12341,7 +12342,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageToMemoryCop
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCopyMemoryToImageInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkCopyMemoryToImageInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12358,7 +12359,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCopyMemoryToImag
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCopyImageToMemoryInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkCopyImageToMemoryInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12375,7 +12376,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCopyImageToMemor
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCopyImageToImageInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkCopyImageToImageInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12394,7 +12395,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCopyImageToImage
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkHostImageLayoutTransitionInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkHostImageLayoutTransitionInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12410,7 +12411,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkHostImageLayoutT
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSubresourceHostMemcpySizeEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSubresourceHostMemcpySizeEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12423,7 +12424,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSubresourceHostM
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkHostImageCopyDevicePerformanceQueryEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkHostImageCopyDevicePerformanceQueryEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12437,7 +12438,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkHostImageCopyDev
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMapMemoryPlacedFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceMapMemoryPlacedFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12452,7 +12453,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMapMemoryPlacedPropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceMapMemoryPlacedPropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12465,7 +12466,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryMapPlacedInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMemoryMapPlacedInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12478,7 +12479,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryMapPlacedI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12502,7 +12503,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSurfacePresentModeEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSurfacePresentModeEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12515,7 +12516,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSurfacePresentMo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSurfacePresentScalingCapabilitiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSurfacePresentScalingCapabilitiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12532,7 +12533,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSurfacePresentSc
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSurfacePresentModeCompatibilityEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSurfacePresentModeCompatibilityEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12546,7 +12547,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSurfacePresentMo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12559,7 +12560,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSw
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSwapchainPresentFenceInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSwapchainPresentFenceInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12573,7 +12574,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSwapchainPresent
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSwapchainPresentModesCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSwapchainPresentModesCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12587,7 +12588,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSwapchainPresent
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSwapchainPresentModeInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSwapchainPresentModeInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12601,7 +12602,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSwapchainPresent
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSwapchainPresentScalingCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSwapchainPresentScalingCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12616,7 +12617,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSwapchainPresent
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkReleaseSwapchainImagesInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkReleaseSwapchainImagesInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12631,7 +12632,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkReleaseSwapchain
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12652,7 +12653,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12665,7 +12666,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkGraphicsShaderGroupCreateInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkGraphicsShaderGroupCreateInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12681,7 +12682,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkGraphicsShaderGr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkGraphicsPipelineShaderGroupsCreateInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkGraphicsPipelineShaderGroupsCreateInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12697,7 +12698,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkGraphicsPipeline
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindShaderGroupIndirectCommandNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBindShaderGroupIndirectCommandNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12708,7 +12709,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindShaderGroupI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindIndexBufferIndirectCommandNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBindIndexBufferIndirectCommandNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12721,7 +12722,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindIndexBufferI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindVertexBufferIndirectCommandNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBindVertexBufferIndirectCommandNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12734,7 +12735,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindVertexBuffer
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSetStateFlagsIndirectCommandNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSetStateFlagsIndirectCommandNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12745,7 +12746,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSetStateFlagsInd
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkIndirectCommandsStreamNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkIndirectCommandsStreamNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12757,7 +12758,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkIndirectCommands
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkIndirectCommandsLayoutTokenNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkIndirectCommandsLayoutTokenNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12782,7 +12783,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkIndirectCommands
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkIndirectCommandsLayoutCreateInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkIndirectCommandsLayoutCreateInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12800,7 +12801,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkIndirectCommands
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkGeneratedCommandsInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkGeneratedCommandsInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12825,7 +12826,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkGeneratedCommand
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkGeneratedCommandsMemoryRequirementsInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkGeneratedCommandsMemoryRequirementsInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12841,7 +12842,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkGeneratedCommand
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceInheritedViewportScissorFeaturesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceInheritedViewportScissorFeaturesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12854,7 +12855,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceIn
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCommandBufferInheritanceViewportScissorInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkCommandBufferInheritanceViewportScissorInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12869,7 +12870,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCommandBufferInh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12882,7 +12883,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceTe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassTransformBeginInfoQCOM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRenderPassTransformBeginInfoQCOM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12895,7 +12896,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassTransf
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCommandBufferInheritanceRenderPassTransformInfoQCOM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkCommandBufferInheritanceRenderPassTransformInfoQCOM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12909,7 +12910,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCommandBufferInh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDepthBiasControlFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceDepthBiasControlFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12925,7 +12926,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDepthBiasInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDepthBiasInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12940,7 +12941,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDepthBiasInfoEXT
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDepthBiasRepresentationInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDepthBiasRepresentationInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12954,7 +12955,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDepthBiasReprese
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDeviceMemoryReportFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceDeviceMemoryReportFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12967,7 +12968,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceMemoryReportCallbackDataEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDeviceMemoryReportCallbackDataEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -12986,7 +12987,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceMemoryRepo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceDeviceMemoryReportCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDeviceDeviceMemoryReportCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13001,7 +13002,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceDeviceMemo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRobustness2FeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceRobustness2FeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13016,7 +13017,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRobustness2PropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceRobustness2PropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13030,7 +13031,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSamplerCustomBorderColorCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSamplerCustomBorderColorCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13044,7 +13045,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSamplerCustomBor
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCustomBorderColorPropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceCustomBorderColorPropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13057,7 +13058,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCustomBorderColorFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceCustomBorderColorFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13071,7 +13072,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePresentBarrierFeaturesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDevicePresentBarrierFeaturesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13084,7 +13085,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSurfaceCapabilitiesPresentBarrierNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSurfaceCapabilitiesPresentBarrierNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13097,7 +13098,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSurfaceCapabilit
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSwapchainPresentBarrierCreateInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSwapchainPresentBarrierCreateInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13110,7 +13111,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSwapchainPresent
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDiagnosticsConfigFeaturesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceDiagnosticsConfigFeaturesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13123,7 +13124,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceDiagnosticsConfigCreateInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDeviceDiagnosticsConfigCreateInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13136,7 +13137,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceDiagnostic
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkQueryLowLatencySupportNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkQueryLowLatencySupportNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13149,7 +13150,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkQueryLowLatencyS
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13162,7 +13163,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceGr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13176,7 +13177,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceGr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkGraphicsPipelineLibraryCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkGraphicsPipelineLibraryCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13189,7 +13190,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkGraphicsPipeline
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13202,7 +13203,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13217,7 +13218,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13230,7 +13231,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineFragmentShadingRateEnumStateCreateInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineFragmentShadingRateEnumStateCreateInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13245,7 +13246,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineFragment
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStructureGeometryMotionTrianglesDataNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAccelerationStructureGeometryMotionTrianglesDataNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13258,7 +13259,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStru
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStructureMotionInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAccelerationStructureMotionInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13272,7 +13273,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStru
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStructureMatrixMotionInstanceNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAccelerationStructureMatrixMotionInstanceNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13289,7 +13290,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStru
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSRTDataNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSRTDataNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13315,7 +13316,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSRTDataNV* data,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStructureSRTMotionInstanceNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAccelerationStructureSRTMotionInstanceNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13332,7 +13333,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStru
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRayTracingMotionBlurFeaturesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceRayTracingMotionBlurFeaturesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13346,7 +13347,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13359,7 +13360,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceYc
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFragmentDensityMap2FeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceFragmentDensityMap2FeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13372,7 +13373,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFragmentDensityMap2PropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceFragmentDensityMap2PropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13388,7 +13389,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCopyCommandTransformInfoQCOM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkCopyCommandTransformInfoQCOM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13401,7 +13402,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCopyCommandTrans
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceImageCompressionControlFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceImageCompressionControlFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13414,7 +13415,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceIm
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageCompressionControlEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageCompressionControlEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13429,7 +13430,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageCompression
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageCompressionPropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageCompressionPropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13443,7 +13444,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageCompression
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13456,7 +13457,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceAt
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevice4444FormatsFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDevice4444FormatsFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13470,7 +13471,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevice44
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFaultFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceFaultFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13484,7 +13485,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceFaultCountsEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDeviceFaultCountsEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13499,7 +13500,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceFaultCount
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceFaultAddressInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDeviceFaultAddressInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13512,7 +13513,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceFaultAddre
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceFaultVendorInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDeviceFaultVendorInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13525,7 +13526,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceFaultVendo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceFaultInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDeviceFaultInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13541,7 +13542,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceFaultInfoE
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceFaultVendorBinaryHeaderVersionOneEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDeviceFaultVendorBinaryHeaderVersionOneEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13562,7 +13563,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceFaultVendo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13577,7 +13578,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13590,7 +13591,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRG
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDirectFBSurfaceCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDirectFBSurfaceCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13605,7 +13606,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDirectFBSurfaceC
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13618,7 +13619,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMutableDescriptorTypeListEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMutableDescriptorTypeListEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13630,7 +13631,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMutableDescripto
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMutableDescriptorTypeCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMutableDescriptorTypeCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13644,7 +13645,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMutableDescripto
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13657,7 +13658,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceVe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVertexInputBindingDescription2EXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVertexInputBindingDescription2EXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13673,7 +13674,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVertexInputBindi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVertexInputAttributeDescription2EXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkVertexInputAttributeDescription2EXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13689,7 +13690,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkVertexInputAttri
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDrmPropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceDrmPropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13707,7 +13708,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceAddressBindingReportFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceAddressBindingReportFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13720,7 +13721,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceAd
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceAddressBindingCallbackDataEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDeviceAddressBindingCallbackDataEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13736,7 +13737,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceAddressBin
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDepthClipControlFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceDepthClipControlFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13749,7 +13750,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineViewportDepthClipControlCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineViewportDepthClipControlCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13762,7 +13763,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineViewport
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13776,7 +13777,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImportMemoryZirconHandleInfoFUCHSIA* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImportMemoryZirconHandleInfoFUCHSIA* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13790,7 +13791,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImportMemoryZirc
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryZirconHandlePropertiesFUCHSIA* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMemoryZirconHandlePropertiesFUCHSIA* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13803,7 +13804,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryZirconHand
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryGetZirconHandleInfoFUCHSIA* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMemoryGetZirconHandleInfoFUCHSIA* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13817,7 +13818,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryGetZirconH
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImportSemaphoreZirconHandleInfoFUCHSIA* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImportSemaphoreZirconHandleInfoFUCHSIA* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13833,7 +13834,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImportSemaphoreZ
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSemaphoreGetZirconHandleInfoFUCHSIA* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSemaphoreGetZirconHandleInfoFUCHSIA* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13847,7 +13848,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSemaphoreGetZirc
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceInvocationMaskFeaturesHUAWEI* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceInvocationMaskFeaturesHUAWEI* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13860,7 +13861,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceIn
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryGetRemoteAddressInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMemoryGetRemoteAddressInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13874,7 +13875,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMemoryGetRemoteA
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceExternalMemoryRDMAFeaturesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceExternalMemoryRDMAFeaturesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13887,7 +13888,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceEx
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFrameBoundaryFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceFrameBoundaryFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13900,7 +13901,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkFrameBoundaryEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkFrameBoundaryEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13921,7 +13922,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkFrameBoundaryEXT
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13934,7 +13935,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSubpassResolvePerformanceQueryEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSubpassResolvePerformanceQueryEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13947,7 +13948,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSubpassResolvePe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMultisampledRenderToSingleSampledInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMultisampledRenderToSingleSampledInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13961,7 +13962,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMultisampledRend
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceExtendedDynamicState2FeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceExtendedDynamicState2FeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13976,7 +13977,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceEx
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkScreenSurfaceCreateInfoQNX* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkScreenSurfaceCreateInfoQNX* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -13991,7 +13992,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkScreenSurfaceCre
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceColorWriteEnableFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceColorWriteEnableFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14004,7 +14005,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineColorWriteCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineColorWriteCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14018,7 +14019,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineColorWri
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14033,7 +14034,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceImageViewMinLodFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceImageViewMinLodFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14046,7 +14047,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceIm
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageViewMinLodCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageViewMinLodCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14059,7 +14060,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageViewMinLodC
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMultiDrawFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceMultiDrawFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14072,7 +14073,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMultiDrawPropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceMultiDrawPropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14085,7 +14086,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMultiDrawInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMultiDrawInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14097,7 +14098,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMultiDrawInfoEXT
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMultiDrawIndexedInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMultiDrawIndexedInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14110,7 +14111,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMultiDrawIndexed
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceImage2DViewOf3DFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceImage2DViewOf3DFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14124,7 +14125,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceIm
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderTileImageFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderTileImageFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14139,7 +14140,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderTileImagePropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderTileImagePropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14154,7 +14155,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMicromapUsageEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMicromapUsageEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14167,7 +14168,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMicromapUsageEXT
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMicromapBuildInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMicromapBuildInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14190,7 +14191,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMicromapBuildInf
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMicromapCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMicromapCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14208,7 +14209,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMicromapCreateIn
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceOpacityMicromapFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceOpacityMicromapFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14223,7 +14224,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceOp
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceOpacityMicromapPropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceOpacityMicromapPropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14237,7 +14238,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceOp
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMicromapVersionInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMicromapVersionInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14250,7 +14251,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMicromapVersionI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCopyMicromapToMemoryInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkCopyMicromapToMemoryInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14265,7 +14266,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCopyMicromapToMe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCopyMemoryToMicromapInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkCopyMemoryToMicromapInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14280,7 +14281,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCopyMemoryToMicr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCopyMicromapInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkCopyMicromapInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14295,7 +14296,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCopyMicromapInfo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMicromapBuildSizesInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMicromapBuildSizesInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14310,7 +14311,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMicromapBuildSiz
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStructureTrianglesOpacityMicromapEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAccelerationStructureTrianglesOpacityMicromapEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14330,7 +14331,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStru
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMicromapTriangleEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMicromapTriangleEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14343,7 +14344,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMicromapTriangle
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDisplacementMicromapFeaturesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceDisplacementMicromapFeaturesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14356,7 +14357,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDisplacementMicromapPropertiesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceDisplacementMicromapPropertiesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14369,7 +14370,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStructureTrianglesDisplacementMicromapNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAccelerationStructureTrianglesDisplacementMicromapNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14397,7 +14398,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStru
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14411,7 +14412,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCl
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14427,7 +14428,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCl
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceClusterCullingShaderVrsFeaturesHUAWEI* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceClusterCullingShaderVrsFeaturesHUAWEI* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14440,7 +14441,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCl
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceBorderColorSwizzleFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceBorderColorSwizzleFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14454,7 +14455,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceBo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSamplerBorderColorComponentMappingCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSamplerBorderColorComponentMappingCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14468,7 +14469,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSamplerBorderCol
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14481,7 +14482,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderCorePropertiesARM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderCorePropertiesARM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14496,7 +14497,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceQueueShaderCoreControlCreateInfoARM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDeviceQueueShaderCoreControlCreateInfoARM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14509,7 +14510,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDeviceQueueShade
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSchedulingControlsFeaturesARM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceSchedulingControlsFeaturesARM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14522,7 +14523,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSc
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSchedulingControlsPropertiesARM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceSchedulingControlsPropertiesARM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14535,7 +14536,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSc
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14548,7 +14549,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceIm
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageViewSlicedCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageViewSlicedCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14562,7 +14563,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageViewSlicedC
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14575,7 +14576,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorSetBindingReferenceVALVE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDescriptorSetBindingReferenceVALVE* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14589,7 +14590,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorSetBin
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorSetLayoutHostMappingInfoVALVE* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDescriptorSetLayoutHostMappingInfoVALVE* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14603,7 +14604,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorSetLay
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDepthClampZeroOneFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceDepthClampZeroOneFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14616,7 +14617,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14629,7 +14630,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceNo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRenderPassStripedFeaturesARM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceRenderPassStripedFeaturesARM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14642,7 +14643,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRenderPassStripedPropertiesARM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceRenderPassStripedPropertiesARM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14656,7 +14657,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassStripeInfoARM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRenderPassStripeInfoARM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14669,7 +14670,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassStripe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassStripeBeginInfoARM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRenderPassStripeBeginInfoARM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14683,7 +14684,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassStripe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassStripeSubmitInfoARM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRenderPassStripeSubmitInfoARM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14697,7 +14698,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassStripe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14710,7 +14711,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14723,7 +14724,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceFr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSubpassFragmentDensityMapOffsetEndInfoQCOM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSubpassFragmentDensityMapOffsetEndInfoQCOM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14737,7 +14738,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSubpassFragmentD
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14752,7 +14753,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkComputePipelineIndirectBufferInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkComputePipelineIndirectBufferInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14767,7 +14768,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkComputePipelineI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineIndirectDeviceAddressInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineIndirectDeviceAddressInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14781,7 +14782,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineIndirect
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindPipelineIndirectCommandNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBindPipelineIndirectCommandNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14792,7 +14793,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindPipelineIndi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceLinearColorAttachmentFeaturesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceLinearColorAttachmentFeaturesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14805,7 +14806,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceLi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14818,7 +14819,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceIm
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageViewSampleWeightCreateInfoQCOM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageViewSampleWeightCreateInfoQCOM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14833,7 +14834,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageViewSampleW
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceImageProcessingFeaturesQCOM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceImageProcessingFeaturesQCOM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14848,7 +14849,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceIm
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceImageProcessingPropertiesQCOM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceImageProcessingPropertiesQCOM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14864,7 +14865,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceIm
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceNestedCommandBufferFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceNestedCommandBufferFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14879,7 +14880,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceNe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceNestedCommandBufferPropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceNestedCommandBufferPropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14892,7 +14893,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceNe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExternalMemoryAcquireUnmodifiedEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkExternalMemoryAcquireUnmodifiedEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14905,7 +14906,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkExternalMemoryAc
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceExtendedDynamicState3FeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceExtendedDynamicState3FeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14948,7 +14949,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceEx
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceExtendedDynamicState3PropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceExtendedDynamicState3PropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14961,7 +14962,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceEx
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkColorBlendEquationEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkColorBlendEquationEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14977,7 +14978,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkColorBlendEquati
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkColorBlendAdvancedEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkColorBlendAdvancedEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -14992,7 +14993,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkColorBlendAdvanc
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15005,7 +15006,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassCreationControlEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRenderPassCreationControlEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15018,7 +15019,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassCreati
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassCreationFeedbackInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRenderPassCreationFeedbackInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15029,7 +15030,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassCreati
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassCreationFeedbackCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRenderPassCreationFeedbackCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15042,7 +15043,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassCreati
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassSubpassFeedbackInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRenderPassSubpassFeedbackInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15055,7 +15056,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassSubpas
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassSubpassFeedbackCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRenderPassSubpassFeedbackCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15068,7 +15069,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRenderPassSubpas
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDirectDriverLoadingInfoLUNARG* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDirectDriverLoadingInfoLUNARG* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15082,7 +15083,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDirectDriverLoad
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDirectDriverLoadingListLUNARG* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDirectDriverLoadingListLUNARG* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15097,7 +15098,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDirectDriverLoad
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15110,7 +15111,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15123,7 +15124,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineShaderStageModuleIdentifierCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineShaderStageModuleIdentifierCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15137,7 +15138,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineShaderSt
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkShaderModuleIdentifierEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkShaderModuleIdentifierEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15151,7 +15152,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkShaderModuleIden
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceOpticalFlowFeaturesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceOpticalFlowFeaturesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15164,7 +15165,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceOp
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceOpticalFlowPropertiesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceOpticalFlowPropertiesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15187,7 +15188,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceOp
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkOpticalFlowImageFormatInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkOpticalFlowImageFormatInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15200,7 +15201,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkOpticalFlowImage
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkOpticalFlowImageFormatPropertiesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkOpticalFlowImageFormatPropertiesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15213,7 +15214,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkOpticalFlowImage
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkOpticalFlowSessionCreateInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkOpticalFlowSessionCreateInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15234,7 +15235,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkOpticalFlowSessi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkOpticalFlowSessionCreatePrivateDataInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkOpticalFlowSessionCreatePrivateDataInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15249,7 +15250,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkOpticalFlowSessi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkOpticalFlowExecuteInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkOpticalFlowExecuteInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15264,7 +15265,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkOpticalFlowExecu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceLegacyDitheringFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceLegacyDitheringFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15277,7 +15278,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceLe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePipelineProtectedAccessFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDevicePipelineProtectedAccessFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15290,7 +15291,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceExternalFormatResolveFeaturesANDROID* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceExternalFormatResolveFeaturesANDROID* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15303,7 +15304,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceEx
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceExternalFormatResolvePropertiesANDROID* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceExternalFormatResolvePropertiesANDROID* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15318,7 +15319,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceEx
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAndroidHardwareBufferFormatResolvePropertiesANDROID* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAndroidHardwareBufferFormatResolvePropertiesANDROID* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15331,7 +15332,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAndroidHardwareB
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceAntiLagFeaturesAMD* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceAntiLagFeaturesAMD* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15344,7 +15345,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceAn
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAntiLagPresentationInfoAMD* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAntiLagPresentationInfoAMD* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15358,7 +15359,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAntiLagPresentat
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAntiLagDataAMD* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAntiLagDataAMD* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15373,7 +15374,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAntiLagDataAMD*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderObjectFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderObjectFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15386,7 +15387,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderObjectPropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderObjectPropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15400,7 +15401,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkShaderCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkShaderCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15424,7 +15425,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkShaderCreateInfo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDepthClampRangeEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDepthClampRangeEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15436,7 +15437,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDepthClampRangeE
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceTilePropertiesFeaturesQCOM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceTilePropertiesFeaturesQCOM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15449,7 +15450,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceTi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkTilePropertiesQCOM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkTilePropertiesQCOM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15464,7 +15465,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkTilePropertiesQC
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceAmigoProfilingFeaturesSEC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceAmigoProfilingFeaturesSEC* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15477,7 +15478,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceAm
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAmigoProfilingSubmitInfoSEC* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAmigoProfilingSubmitInfoSEC* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15491,7 +15492,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAmigoProfilingSu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15504,7 +15505,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15517,7 +15518,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15530,7 +15531,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15543,7 +15544,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceEx
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceExtendedSparseAddressSpacePropertiesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceExtendedSparseAddressSpacePropertiesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15558,7 +15559,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceEx
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceLegacyVertexAttributesFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceLegacyVertexAttributesFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15571,7 +15572,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceLe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceLegacyVertexAttributesPropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceLegacyVertexAttributesPropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15584,7 +15585,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceLe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkLayerSettingEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkLayerSettingEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15599,7 +15600,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkLayerSettingEXT*
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkLayerSettingsCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkLayerSettingsCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15613,7 +15614,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkLayerSettingsCre
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15626,7 +15627,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15641,7 +15642,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15654,7 +15655,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePi
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15667,7 +15668,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDy
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkLatencySleepModeInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkLatencySleepModeInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15682,7 +15683,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkLatencySleepMode
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkLatencySleepInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkLatencySleepInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15696,7 +15697,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkLatencySleepInfo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSetLatencyMarkerInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSetLatencyMarkerInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15710,7 +15711,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSetLatencyMarker
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkLatencyTimingsFrameReportNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkLatencyTimingsFrameReportNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15736,7 +15737,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkLatencyTimingsFr
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkGetLatencyMarkerInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkGetLatencyMarkerInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15750,7 +15751,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkGetLatencyMarker
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkLatencySubmissionPresentIdNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkLatencySubmissionPresentIdNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15763,7 +15764,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkLatencySubmissio
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSwapchainLatencyCreateInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSwapchainLatencyCreateInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15776,7 +15777,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSwapchainLatency
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkOutOfBandQueueTypeInfoNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkOutOfBandQueueTypeInfoNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15789,7 +15790,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkOutOfBandQueueTy
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkLatencySurfaceCapabilitiesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkLatencySurfaceCapabilitiesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15803,7 +15804,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkLatencySurfaceCa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15816,7 +15817,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15830,7 +15831,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkMultiviewPerView
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePerStageDescriptorSetFeaturesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDevicePerStageDescriptorSetFeaturesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15844,7 +15845,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDevicePe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceImageProcessing2FeaturesQCOM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceImageProcessing2FeaturesQCOM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15857,7 +15858,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceIm
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceImageProcessing2PropertiesQCOM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceImageProcessing2PropertiesQCOM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15870,7 +15871,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceIm
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSamplerBlockMatchWindowCreateInfoQCOM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSamplerBlockMatchWindowCreateInfoQCOM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15884,7 +15885,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSamplerBlockMatc
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCubicWeightsFeaturesQCOM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceCubicWeightsFeaturesQCOM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15897,7 +15898,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSamplerCubicWeightsCreateInfoQCOM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSamplerCubicWeightsCreateInfoQCOM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15910,7 +15911,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSamplerCubicWeig
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBlitImageCubicWeightsInfoQCOM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBlitImageCubicWeightsInfoQCOM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15923,7 +15924,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBlitImageCubicWe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceYcbcrDegammaFeaturesQCOM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceYcbcrDegammaFeaturesQCOM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15936,7 +15937,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceYc
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSamplerYcbcrConversionYcbcrDegammaCreateInfoQCOM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkSamplerYcbcrConversionYcbcrDegammaCreateInfoQCOM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15950,7 +15951,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkSamplerYcbcrConv
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCubicClampFeaturesQCOM* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceCubicClampFeaturesQCOM* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15963,7 +15964,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCu
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15976,7 +15977,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceAt
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceLayeredDriverPropertiesMSFT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceLayeredDriverPropertiesMSFT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -15989,7 +15990,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceLa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16002,7 +16003,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRawAccessChainsFeaturesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceRawAccessChainsFeaturesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16015,7 +16016,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCommandBufferInheritanceFeaturesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceCommandBufferInheritanceFeaturesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16028,7 +16029,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceCo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderAtomicFloat16VectorFeaturesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderAtomicFloat16VectorFeaturesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16041,7 +16042,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceShaderReplicatedCompositesFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceShaderReplicatedCompositesFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16054,7 +16055,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceSh
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRayTracingValidationFeaturesNV* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceRayTracingValidationFeaturesNV* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16067,7 +16068,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDeviceGeneratedCommandsFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceDeviceGeneratedCommandsFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16081,7 +16082,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDeviceGeneratedCommandsPropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceDeviceGeneratedCommandsPropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16105,7 +16106,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkGeneratedCommandsMemoryRequirementsInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkGeneratedCommandsMemoryRequirementsInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16121,7 +16122,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkGeneratedCommand
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkIndirectExecutionSetPipelineInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkIndirectExecutionSetPipelineInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16135,7 +16136,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkIndirectExecutio
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkIndirectExecutionSetShaderLayoutInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkIndirectExecutionSetShaderLayoutInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16149,7 +16150,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkIndirectExecutio
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkIndirectExecutionSetShaderInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkIndirectExecutionSetShaderInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16167,7 +16168,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkIndirectExecutio
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkGeneratedCommandsInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkGeneratedCommandsInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16189,7 +16190,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkGeneratedCommand
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkWriteIndirectExecutionSetPipelineEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkWriteIndirectExecutionSetPipelineEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16203,7 +16204,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkWriteIndirectExe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkIndirectCommandsPushConstantTokenEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkIndirectCommandsPushConstantTokenEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16214,7 +16215,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkIndirectCommands
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkIndirectCommandsVertexBufferTokenEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkIndirectCommandsVertexBufferTokenEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16225,7 +16226,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkIndirectCommands
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkIndirectCommandsIndexBufferTokenEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkIndirectCommandsIndexBufferTokenEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16236,7 +16237,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkIndirectCommands
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkIndirectCommandsExecutionSetTokenEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkIndirectCommandsExecutionSetTokenEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16248,7 +16249,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkIndirectCommands
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkIndirectCommandsLayoutCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkIndirectCommandsLayoutCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16266,7 +16267,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkIndirectCommands
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDrawIndirectCountIndirectCommandEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDrawIndirectCountIndirectCommandEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16279,7 +16280,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDrawIndirectCoun
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindVertexBufferIndirectCommandEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBindVertexBufferIndirectCommandEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16292,7 +16293,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindVertexBuffer
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindIndexBufferIndirectCommandEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkBindIndexBufferIndirectCommandEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16305,7 +16306,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkBindIndexBufferI
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkGeneratedCommandsPipelineInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkGeneratedCommandsPipelineInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16318,7 +16319,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkGeneratedCommand
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkGeneratedCommandsShaderInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkGeneratedCommandsShaderInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16332,7 +16333,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkGeneratedCommand
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkWriteIndirectExecutionSetShaderEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkWriteIndirectExecutionSetShaderEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16346,7 +16347,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkWriteIndirectExe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceImageAlignmentControlFeaturesMESA* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceImageAlignmentControlFeaturesMESA* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16359,7 +16360,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceIm
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceImageAlignmentControlPropertiesMESA* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceImageAlignmentControlPropertiesMESA* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16372,7 +16373,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceIm
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageAlignmentControlCreateInfoMESA* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkImageAlignmentControlCreateInfoMESA* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16385,7 +16386,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkImageAlignmentCo
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDepthClampControlFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceDepthClampControlFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16398,7 +16399,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceDe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineViewportDepthClampControlCreateInfoEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPipelineViewportDepthClampControlCreateInfoEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16412,7 +16413,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPipelineViewport
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStructureBuildRangeInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAccelerationStructureBuildRangeInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16426,7 +16427,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStru
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStructureGeometryTrianglesDataKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAccelerationStructureGeometryTrianglesDataKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16445,7 +16446,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStru
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStructureGeometryAabbsDataKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAccelerationStructureGeometryAabbsDataKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16459,7 +16460,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStru
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStructureGeometryInstancesDataKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAccelerationStructureGeometryInstancesDataKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16473,7 +16474,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStru
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStructureBuildGeometryInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAccelerationStructureBuildGeometryInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16494,7 +16495,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStru
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStructureCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAccelerationStructureCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16512,7 +16513,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStru
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkWriteDescriptorSetAccelerationStructureKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkWriteDescriptorSetAccelerationStructureKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16526,7 +16527,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkWriteDescriptorS
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceAccelerationStructureFeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceAccelerationStructureFeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16543,7 +16544,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceAc
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceAccelerationStructurePropertiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceAccelerationStructurePropertiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16563,7 +16564,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceAc
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStructureDeviceAddressInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAccelerationStructureDeviceAddressInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16576,7 +16577,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStru
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStructureVersionInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAccelerationStructureVersionInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16589,7 +16590,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStru
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCopyAccelerationStructureToMemoryInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkCopyAccelerationStructureToMemoryInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16604,7 +16605,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCopyAcceleration
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCopyMemoryToAccelerationStructureInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkCopyMemoryToAccelerationStructureInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16619,7 +16620,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCopyMemoryToAcce
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCopyAccelerationStructureInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkCopyAccelerationStructureInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16634,7 +16635,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkCopyAcceleration
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStructureBuildSizesInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkAccelerationStructureBuildSizesInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16649,7 +16650,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkAccelerationStru
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRayTracingShaderGroupCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRayTracingShaderGroupCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16667,7 +16668,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRayTracingShader
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRayTracingPipelineInterfaceCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRayTracingPipelineInterfaceCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16681,7 +16682,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRayTracingPipeli
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRayTracingPipelineCreateInfoKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkRayTracingPipelineCreateInfoKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16705,7 +16706,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkRayTracingPipeli
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRayTracingPipelineFeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceRayTracingPipelineFeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16722,7 +16723,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRayTracingPipelinePropertiesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceRayTracingPipelinePropertiesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16742,7 +16743,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkStridedDeviceAddressRegionKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkStridedDeviceAddressRegionKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16755,7 +16756,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkStridedDeviceAdd
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkTraceRaysIndirectCommandKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkTraceRaysIndirectCommandKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16768,7 +16769,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkTraceRaysIndirec
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRayQueryFeaturesKHR* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceRayQueryFeaturesKHR* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16781,7 +16782,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceRa
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMeshShaderFeaturesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceMeshShaderFeaturesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16798,7 +16799,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMeshShaderPropertiesEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkPhysicalDeviceMeshShaderPropertiesEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16838,7 +16839,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPhysicalDeviceMe
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDrawMeshTasksIndirectCommandEXT* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const Decoded_VkDrawMeshTasksIndirectCommandEXT* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
@@ -16851,7 +16852,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDrawMeshTasksInd
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const PNextNode* data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const PNextNode* data, const JsonOptions& options)
 {
     if (data && data->GetPointer())
     {
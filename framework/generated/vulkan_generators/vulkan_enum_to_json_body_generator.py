@@ -94,6 +94,7 @@ class VulkanEnumToJsonBodyGenerator(BaseGenerator):
             GFXRECON_BEGIN_NAMESPACE(decode)
 
             using util::JsonOptions;
+            using util::JsonValue;
             using util::to_hex_fixed_width;
 
             template<typename TFlags, typename ToStringFunctionType>
@@ -174,9 +175,9 @@ class VulkanEnumToJsonBodyGenerator(BaseGenerator):
                 bitwidth = 'VkFlags'
 
                 if enum in self.enumType and self.enumType[enum] == 'VkFlags64':
-                    body = 'void FieldToJson({0}_t, nlohmann::ordered_json& jdata, const {0}& value, const JsonOptions& options)\n'
+                    body = 'void FieldToJson({0}_t, JsonValue& jdata, const {0}& value, const JsonOptions& options)\n'
                 else:
-                    body = 'void FieldToJson(nlohmann::ordered_json& jdata, const {0}& value, const JsonOptions& options)\n'
+                    body = 'void FieldToJson(JsonValue& jdata, const {0}& value, const JsonOptions& options)\n'
                 body += '{{\n'
                 if len(self.enumEnumerants[enum]):
                     body += '    switch (value) {{\n'
@@ -201,7 +202,7 @@ class VulkanEnumToJsonBodyGenerator(BaseGenerator):
             bittype = None
             if enum in self.flagEnumBitsType:
                 bittype = self.flagEnumBitsType[enum]
-            body = 'void FieldToJson({0}_t, nlohmann::ordered_json& jdata, const {1} flags, const JsonOptions& options)\n'
+            body = 'void FieldToJson({0}_t, JsonValue& jdata, const {1} flags, const JsonOptions& options)\n'
             body += '{{\n'
             if bittype is not None and bittype in self.enum_names and len(self.enumEnumerants[bittype]):
                 body += "    if (!options.expand_flags)\n"
@@ -164,11 +164,11 @@ class VulkanEnumToJsonHeaderGenerator(BaseGenerator):
                 self.processedEnums.add(enum)
                 if not enum in self.enumAliases:
                     if enum in self.enumType and self.enumType[enum] == 'VkFlags64':
-                        body = 'void FieldToJson({0}_t, nlohmann::ordered_json& jdata, const {0}& value, const util::JsonOptions& options = util::JsonOptions());'
+                        body = 'void FieldToJson({0}_t, util::JsonValue& jdata, const {0}& value, const util::JsonOptions& options = util::JsonOptions());'
                     else:
-                        body = 'void FieldToJson(nlohmann::ordered_json& jdata, const {0}& value, const util::JsonOptions& options = util::JsonOptions());'
+                        body = 'void FieldToJson(util::JsonValue& jdata, const {0}& value, const util::JsonOptions& options = util::JsonOptions());'
                     write(body.format(enum), file=self.outFile)
 
         for flag in sorted(self.flagsType):
-            body = 'void FieldToJson({0}_t, nlohmann::ordered_json& jdata, const {1} flags, const util::JsonOptions& options = util::JsonOptions());'
+            body = 'void FieldToJson({0}_t, util::JsonValue& jdata, const {1} flags, const util::JsonOptions& options = util::JsonOptions());'
             write(body.format(flag, self.flagsType[flag]), file=self.outFile)
@@ -96,6 +96,10 @@ class VulkanExportJsonConsumerBodyGenerator(BaseGenerator):
             "vkQueueSubmit2KHR",
             }
 
+        # Commands that advance the submit index or a command buffer's command index, in generation order.
+        self.submitIndexCmds = []
+        self.commandIndexCmds = []
+
 
         self.flagsType = dict()
         self.flagsTypeAlias = dict()
@@ -117,11 +121,15 @@ class VulkanExportJsonConsumerBodyGenerator(BaseGenerator):
             GFXRECON_BEGIN_NAMESPACE(decode)
 
             using util::JsonOptions;
+            using util::JsonValue;
         '''))
         write(namespace, file=self.outFile)
 
     def endFile(self):
         """Method override."""
+        write(self.make_call_id_check('IsSubmitIndexCall', self.submitIndexCmds), file=self.outFile)
+        write(self.make_call_id_check('IsCommandIndexCall', self.commandIndexCmds), file=self.outFile)
+
         body = format_cpp_code('''
             GFXRECON_END_NAMESPACE(decode)
             GFXRECON_END_NAMESPACE(gfxrecon)
@@ -159,7 +167,7 @@ class VulkanExportJsonConsumerBodyGenerator(BaseGenerator):
                 ) + '\n'
                 cmddef += format_cpp_code('''
                     {{
-                        nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "{0}");
+                        JsonValue& jdata = WriteApiCallStart(call_info, "{0}");
                         const JsonOptions& json_options = GetJsonOptions();
                     '''.format(cmd)
                 )
@@ -174,6 +182,26 @@ class VulkanExportJsonConsumerBodyGenerator(BaseGenerator):
                 write(cmddef, file=self.outFile)
                 first = False
 
+                if cmd in self.queueSubmit:
+                    self.submitIndexCmds.append(cmd)
+                elif self.is_command_buffer_cmd(cmd):
+                    self.commandIndexCmds.append(cmd)
+
+    def make_call_id_check(self, name, cmds):
+        """Return a VulkanExportJsonConsumer static function that returns true for the API call IDs of the commands."""
+        body = '\nbool VulkanExportJsonConsumer::{}(format::ApiCallId call_id)\n'.format(name)
+        body += '{\n'
+        body += '    switch (call_id)\n'
+        body += '    {\n'
+        for cmd in cmds:
+            body += '        case format::ApiCallId::ApiCall_{}:\n'.format(cmd)
+        body += '            return true;\n'
+        body += '        default:\n'
+        body += '            return false;\n'
+        body += '    }\n'
+        body += '}'
+        return body
+
     def is_command_buffer_cmd(self, command):
         if 'vkCmd' in command:
             return True
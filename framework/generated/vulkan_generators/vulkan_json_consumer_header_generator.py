@@ -83,6 +83,17 @@ class VulkanExportJsonConsumerHeaderGenerator(VulkanConsumerHeaderGenerator):
             'vkGetPipelineCacheData',
         }
 
+    def endFile(self):
+        """Method override."""
+        # Calls that advance the submit index or the command index of their command buffer, which is the first
+        # parameter of the call.
+        write('', file=self.outFile)
+        write('    static bool IsSubmitIndexCall(format::ApiCallId call_id);', file=self.outFile)
+        write('', file=self.outFile)
+        write('    static bool IsCommandIndexCall(format::ApiCallId call_id);', file=self.outFile)
+
+        VulkanConsumerHeaderGenerator.endFile(self)
+
     def generate_feature(self):
         """Performs C++ code generation for the feature."""
         first = True
@@ -108,6 +108,7 @@ class VulkanStructToJsonBodyGenerator(BaseGenerator):
             GFXRECON_BEGIN_NAMESPACE(gfxrecon)
             GFXRECON_BEGIN_NAMESPACE(decode)
             using util::JsonOptions;
+            using util::JsonValue;
             using util::to_hex_variable_width;
             using util::uuid_to_string;
         ''')
@@ -119,7 +120,7 @@ class VulkanStructToJsonBodyGenerator(BaseGenerator):
     # yapf: disable
     def endFile(self):
         body = '''
-            void FieldToJson(nlohmann::ordered_json& jdata, const PNextNode* data, const JsonOptions& options)
+            void FieldToJson(JsonValue& jdata, const PNextNode* data, const JsonOptions& options)
             {
                 if (data && data->GetPointer())
                 {
@@ -161,7 +162,7 @@ class VulkanStructToJsonBodyGenerator(BaseGenerator):
         for struct in self.get_filtered_struct_names():
             if not struct in self.customImplementationRequired:
                 body = '''
-                    void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_{0}* data, const JsonOptions& options)
+                    void FieldToJson(JsonValue& jdata, const Decoded_{0}* data, const JsonOptions& options)
                     {{
                         if (data && data->decoded_value)
                         {{
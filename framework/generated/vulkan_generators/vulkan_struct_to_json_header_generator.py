@@ -97,7 +97,7 @@ class VulkanStructToJsonHeaderGenerator(BaseGenerator):
         body = remove_trailing_newlines(indent_cpp_code('''
             /// Works out the type of the struct at the end of a pNext pointer and dispatches
             /// recursively to the FieldToJson for that.
-            void FieldToJson(nlohmann::ordered_json& jdata, const PNextNode* data, const util::JsonOptions& options = util::JsonOptions());
+            void FieldToJson(util::JsonValue& jdata, const PNextNode* data, const util::JsonOptions& options = util::JsonOptions());
 
             GFXRECON_END_NAMESPACE(decode)
             GFXRECON_END_NAMESPACE(gfxrecon)
@@ -122,7 +122,7 @@ class VulkanStructToJsonHeaderGenerator(BaseGenerator):
     def generate_feature(self):
         for struct in self.get_filtered_struct_names():
             if not struct in self.customImplementationRequired:
-                body = "void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_{0}* data, const util::JsonOptions& options = util::JsonOptions());".format(struct)
+                body = "void FieldToJson(util::JsonValue& jdata, const Decoded_{0}* data, const util::JsonOptions& options = util::JsonOptions());".format(struct)
                 write(body, file=self.outFile)
     # yapf: enable
 
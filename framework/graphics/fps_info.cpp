@@ -29,6 +29,8 @@
 #include "util/json_util.h"
 
 #include "nlohmann/json.hpp"
+
+#include <algorithm>
 #include <cinttypes>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -57,6 +59,36 @@ WriteFpsToConsole(const char* prefix, uint64_t start_frame, uint64_t end_frame,
                            end_frame);
 }
 
+struct FrameTimeStats
+{
+    double min_ms{ 0.0 };
+    double median_ms{ 0.0 };
+    double p99_ms{ 0.0 };
+};
+
+static FrameTimeStats GetFrameTimeStats(std::vector<int64_t>::const_iterator begin,
+                                        std::vector<int64_t>::const_iterator end)
+{
+    FrameTimeStats       stats;
+    std::vector<int64_t> durations(begin, end);
+
+    if (!durations.empty())
+    {
+        std::sort(durations.begin(), durations.end());
+
+        size_t count    = durations.size();
+        stats.min_ms    = util::datetime::ConvertTimestampToMilliseconds(durations.front());
+        stats.median_ms = (util::datetime::ConvertTimestampToMilliseconds(durations[(count - 1) / 2]) +
+                           util::datetime::ConvertTimestampToMilliseconds(durations[count / 2])) /
+                          2.0;
+
+        // Nearest-rank percentile.
+        stats.p99_ms = util::datetime::ConvertTimestampToMilliseconds(durations[((count * 99) + 99) / 100 - 1]);
+    }
+
+    return stats;
+}
+
 FpsInfo::FpsInfo(uint64_t               measurement_start_frame,
                  uint64_t               measurement_end_frame,
                  bool                   has_measurement_range,
@@ -64,13 +96,16 @@ FpsInfo::FpsInfo(uint64_t               measurement_start_frame,
                  bool                   flush_measurement_range,
                  bool                   flush_inside_measurement_range,
                  bool                   preload_measurement_range,
-                 const std::string_view measurement_file_name) :
+                 const std::string_view measurement_file_name,
+                 uint32_t               measurement_loop_count) :
     measurement_start_frame_(measurement_start_frame),
     measurement_end_frame_(measurement_end_frame), measurement_start_time_(0), measurement_end_time_(0),
     quit_after_range_(quit_after_range), flush_measurement_range_(flush_measurement_range),
     flush_inside_measurement_range_(flush_inside_measurement_range), has_measurement_range_(has_measurement_range),
     started_measurement_(false), ended_measurement_(false), frame_start_time_(0), frame_durations_(),
-    preload_measurement_range_(preload_measurement_range), measurement_file_name_(measurement_file_name)
+    preload_measurement_range_(preload_measurement_range), measurement_file_name_(measurement_file_name),
+    measurement_loop_count_(std::max(measurement_loop_count, 1u)), loop_start_time_(0), measurement_loops_(),
+    repeat_measurement_range_(false)
 {
     if (has_measurement_range_)
     {
@@ -104,77 +139,138 @@ void FpsInfo::BeginFrame(uint64_t frame)
             measurement_start_time_ = util::datetime::GetTimestamp();
             started_measurement_    = true;
             frame_durations_.clear();
+            measurement_loops_.clear();
         }
     }
 
     frame_start_time_ = util::datetime::GetTimestamp();
+
+    if (started_measurement_ && !ended_measurement_)
+    {
+        if (frame_durations_.size() == GetLoopFirstFrameIndex())
+        {
+            loop_start_time_ = frame_start_time_;
+        }
+    }
 }
 
 void FpsInfo::EndFrame(uint64_t frame)
 {
     if (started_measurement_ && !ended_measurement_)
     {
-        frame_durations_.push_back(util::datetime::DiffTimestamps(frame_start_time_, util::datetime::GetTimestamp()));
+        int64_t end_time = util::datetime::GetTimestamp();
+        frame_durations_.push_back(util::datetime::DiffTimestamps(frame_start_time_, end_time));
 
         // Measurement frame range end is non-inclusive, as opposed to trim frame range
         if (frame >= measurement_end_frame_ - 1)
         {
-            measurement_end_time_ = util::datetime::GetTimestamp();
-            ended_measurement_    = true;
+            size_t first_frame_index = GetLoopFirstFrameIndex();
+            measurement_loops_.push_back(
+                { loop_start_time_, end_time, first_frame_index, frame_durations_.size() - first_frame_index });
 
-            // Save measurements to file
-            if (!measurement_file_name_.empty())
+            if (measurement_loops_.size() < measurement_loop_count_)
             {
-                double   start_time   = util::datetime::ConvertTimestampToSeconds(measurement_start_time_);
-                double   end_time     = util::datetime::ConvertTimestampToSeconds(measurement_end_time_);
-                double   diff_time    = GetElapsedSeconds(measurement_start_time_, measurement_end_time_);
-                uint64_t total_frames = measurement_end_frame_ - measurement_start_frame_;
-                double   fps          = static_cast<double>(total_frames) / diff_time;
-
-                nlohmann::json file_content = { { "frame_range",
-                                                  { { "start_frame", measurement_start_frame_ },
-                                                    { "end_frame", measurement_end_frame_ },
-                                                    { "frame_count", total_frames },
-                                                    { "start_time_monotonic", start_time },
-                                                    { "end_time_monotonic", end_time },
-                                                    { "duration", diff_time },
-                                                    { "fps", fps },
-                                                    { "frame_durations", frame_durations_ } } } };
-
-                FILE*   file_pointer = nullptr;
-                int32_t result       = util::platform::FileOpen(&file_pointer, measurement_file_name_.c_str(), "w");
-                if (result == 0)
-                {
-                    const std::string json_string = file_content.dump(util::kJsonIndentWidth);
-
-                    // It either writes a fully valid file, or it doesn't write anything !
-                    if (!util::platform::FileWrite(json_string.data(), json_string.size(), file_pointer))
-                    {
-                        GFXRECON_LOG_ERROR("Failed to write to measurements file '%s'.",
-                                           measurement_file_name_.c_str());
-
-                        // Try to delete the partial file from disk using <cstdio>
-                        const int remove_result = std::remove(measurement_file_name_.c_str());
-                        if (remove_result != 0)
-                        {
-                            GFXRECON_LOG_ERROR("Failed to remove measurements file '%s' (Error %i).",
-                                               measurement_file_name_.c_str(),
-                                               remove_result);
-                        }
-                    }
-                    util::platform::FileClose(file_pointer);
-                }
-                else
+                repeat_measurement_range_ = true;
+            }
+            else
+            {
+                measurement_end_time_ = end_time;
+                ended_measurement_    = true;
+
+                // Save measurements to file
+                if (!measurement_file_name_.empty())
                 {
-                    GFXRECON_LOG_ERROR(
-                        "Failed to open measurements file '%s' (Error %i).", measurement_file_name_.c_str(), result);
-                    GFXRECON_LOG_ERROR("%s", std::strerror(result));
+                    WriteMeasurementFile();
                 }
             }
         }
     }
 }
 
+bool FpsInfo::ShouldRepeatMeasurementRange()
+{
+    bool repeat               = repeat_measurement_range_;
+    repeat_measurement_range_ = false;
+    return repeat;
+}
+
+size_t FpsInfo::GetLoopFirstFrameIndex() const
+{
+    if (measurement_loops_.empty())
+    {
+        return 0;
+    }
+
+    return measurement_loops_.back().first_frame_index + measurement_loops_.back().frame_count;
+}
+
+void FpsInfo::WriteMeasurementFile()
+{
+    double   start_time   = util::datetime::ConvertTimestampToSeconds(measurement_start_time_);
+    double   end_time     = util::datetime::ConvertTimestampToSeconds(measurement_end_time_);
+    double   diff_time    = GetElapsedSeconds(measurement_start_time_, measurement_end_time_);
+    uint64_t total_frames = (measurement_end_frame_ - measurement_start_frame_) * measurement_loops_.size();
+    double   fps          = static_cast<double>(total_frames) / diff_time;
+
+    nlohmann::json file_content = { { "frame_range",
+                                      { { "start_frame", measurement_start_frame_ },
+                                        { "end_frame", measurement_end_frame_ },
+                                        { "frame_count", total_frames },
+                                        { "loop_count", measurement_loops_.size() },
+                                        { "start_time_monotonic", start_time },
+                                        { "end_time_monotonic", end_time },
+                                        { "duration", diff_time },
+                                        { "fps", fps },
+                                        { "frame_durations", frame_durations_ } } } };
+
+    nlohmann::json loops = nlohmann::json::array();
+
+    for (const auto& loop : measurement_loops_)
+    {
+        auto   first_frame    = frame_durations_.begin() + loop.first_frame_index;
+        auto   stats          = GetFrameTimeStats(first_frame, first_frame + loop.frame_count);
+        double loop_diff_time = GetElapsedSeconds(loop.start_time, loop.end_time);
+
+        loops.push_back({ { "frame_count", loop.frame_count },
+                          { "duration", loop_diff_time },
+                          { "fps", static_cast<double>(loop.frame_count) / loop_diff_time },
+                          { "frame_time_min_ms", stats.min_ms },
+                          { "frame_time_median_ms", stats.median_ms },
+                          { "frame_time_p99_ms", stats.p99_ms } });
+    }
+
+    file_content["frame_range"]["loops"] = loops;
+
+    FILE*   file_pointer = nullptr;
+    int32_t result       = util::platform::FileOpen(&file_pointer, measurement_file_name_.c_str(), "w");
+    if (result == 0)
+    {
+        const std::string json_string = file_content.dump(util::kJsonIndentWidth);
+
+        // It either writes a fully valid file, or it doesn't write anything !
+        if (!util::platform::FileWrite(json_string.data(), json_string.size(), file_pointer))
+        {
+            GFXRECON_LOG_ERROR("Failed to write to measurements file '%s'.", measurement_file_name_.c_str());
+
+            // Try to delete the partial file from disk using <cstdio>
+            const int remove_result = std::remove(measurement_file_name_.c_str());
+            if (remove_result != 0)
+            {
+                GFXRECON_LOG_ERROR("Failed to remove measurements file '%s' (Error %i).",
+                                   measurement_file_name_.c_str(),
+                                   remove_result);
+            }
+        }
+        util::platform::FileClose(file_pointer);
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR(
+            "Failed to open measurements file '%s' (Error %i).", measurement_file_name_.c_str(), result);
+        GFXRECON_LOG_ERROR("%s", std::strerror(result));
+    }
+}
+
 bool FpsInfo::ShouldWaitIdleAfterFrame(uint64_t frame)
 {
     bool range_ended  = frame == measurement_end_frame_;
@@ -220,23 +316,45 @@ void FpsInfo::LogToConsole()
     {
         // There was a measurement range, emit only statistics about the
         // measurement range
+        uint64_t loop_count    = std::max<uint64_t>(measurement_loops_.size(), 1);
         double   diff_time_sec = GetElapsedSeconds(measurement_start_time_, measurement_end_time_);
-        uint64_t total_frames  = measurement_end_frame_ - measurement_start_frame_;
+        uint64_t total_frames  = (measurement_end_frame_ - measurement_start_frame_) * loop_count;
         double   fps           = static_cast<double>(total_frames) / diff_time_sec;
-        GFXRECON_WRITE_CONSOLE("Measurement range FPS: %f fps, %f seconds, %lu frame%s, 1 loop, framerange [%lu-%lu)",
+        GFXRECON_WRITE_CONSOLE("Measurement range FPS: %f fps, %f seconds, %" PRIu64 " frame%s, %" PRIu64
+                               " loop%s, framerange [%" PRIu64 "-%" PRIu64 ")",
                                fps,
                                diff_time_sec,
                                total_frames,
                                total_frames > 1 ? "s" : "",
+                               loop_count,
+                               loop_count > 1 ? "s" : "",
                                measurement_start_frame_,
                                measurement_end_frame_);
+
+        for (size_t i = 0; i < measurement_loops_.size(); ++i)
+        {
+            const auto& loop        = measurement_loops_[i];
+            auto        first_frame = frame_durations_.begin() + loop.first_frame_index;
+            auto        stats       = GetFrameTimeStats(first_frame, first_frame + loop.frame_count);
+            double      loop_time   = GetElapsedSeconds(loop.start_time, loop.end_time);
+
+            GFXRECON_WRITE_CONSOLE("  Loop %zu: %f fps, %f seconds, frame time min %f ms, median %f ms, p99 %f ms",
+                                   i + 1,
+                                   static_cast<double>(loop.frame_count) / loop_time,
+                                   loop_time,
+                                   stats.min_ms,
+                                   stats.median_ms,
+                                   stats.p99_ms);
+        }
     }
 }
 
 uint64_t FpsInfo::ShouldPreloadFrames(uint64_t current_frame) const
 {
     uint64_t result = 0;
-    if (preload_measurement_range_ && current_frame == measurement_start_frame_)
+
+    // Frames are only preloaded once, later measurement loops replay the already preloaded frames.
+    if (preload_measurement_range_ && !started_measurement_ && current_frame == measurement_start_frame_)
     {
         result = measurement_end_frame_ - measurement_start_frame_;
     }
@@ -43,7 +43,8 @@ class FpsInfo
             bool                   flush_measurement_range        = false,
             bool                   flush_inside_measurement_range = false,
             bool                   preload_measurement_range      = false,
-            const std::string_view measurement_file_name          = "");
+            const std::string_view measurement_file_name          = "",
+            uint32_t               measurement_loop_count         = 1);
 
     void LogToConsole();
 
@@ -57,7 +58,24 @@ class FpsInfo
     void                   ProcessStateEndMarker(uint64_t file_processor_frame);
     [[nodiscard]] uint64_t ShouldPreloadFrames(uint64_t current_frame) const;
 
+    // Returns true once after each measurement loop that is followed by another loop, in which case the caller is
+    // expected to rewind replay to the start of the preloaded measurement range.
+    bool ShouldRepeatMeasurementRange();
+
+    uint32_t GetMeasurementLoopCount() const { return measurement_loop_count_; }
+
   private:
+    struct MeasurementLoop
+    {
+        int64_t start_time;
+        int64_t end_time;
+        size_t  first_frame_index; // Index of the loop's first frame in frame_durations_
+        size_t  frame_count;
+    };
+
+    size_t GetLoopFirstFrameIndex() const;
+    void   WriteMeasurementFile();
+
     uint64_t start_time_;
 
     uint64_t measurement_start_frame_;
@@ -83,6 +101,11 @@ class FpsInfo
     std::string measurement_file_name_;
 
     bool preload_measurement_range_;
+
+    uint32_t                     measurement_loop_count_;
+    int64_t                      loop_start_time_;
+    std::vector<MeasurementLoop> measurement_loops_;
+    bool                         repeat_measurement_range_;
 };
 
 GFXRECON_END_NAMESPACE(graphics)
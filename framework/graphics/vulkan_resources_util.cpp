@@ -887,6 +887,13 @@ VkResult VulkanResourcesUtil::CreateStagingBuffer(VkDeviceSize size)
 
     assert(staging_buffer_.buffer == VK_NULL_HANDLE && staging_buffer_.size == 0);
 
+    return CreateStagingBuffer(size, &staging_buffer_);
+}
+
+VkResult VulkanResourcesUtil::CreateStagingBuffer(VkDeviceSize size, StagingBufferContext* staging_buffer)
+{
+    assert((size != 0) && (staging_buffer != nullptr));
+
     VkBufferCreateInfo create_info    = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
     create_info.pNext                 = nullptr;
     create_info.flags                 = 0;
@@ -896,19 +903,19 @@ VkResult VulkanResourcesUtil::CreateStagingBuffer(VkDeviceSize size)
     create_info.queueFamilyIndexCount = 0;
     create_info.pQueueFamilyIndices   = nullptr;
 
-    VkResult result = device_table_.CreateBuffer(device_, &create_info, nullptr, &staging_buffer_.buffer);
+    VkResult result = device_table_.CreateBuffer(device_, &create_info, nullptr, &staging_buffer->buffer);
     if (result == VK_SUCCESS)
     {
         uint32_t             memory_type_index = std::numeric_limits<uint32_t>::max();
         VkMemoryRequirements memory_requirements;
 
-        device_table_.GetBufferMemoryRequirements(device_, staging_buffer_.buffer, &memory_requirements);
+        device_table_.GetBufferMemoryRequirements(device_, staging_buffer->buffer, &memory_requirements);
 
         bool found = FindMemoryTypeIndex(memory_properties_,
                                          memory_requirements.memoryTypeBits,
                                          VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT,
                                          &memory_type_index,
-                                         &staging_buffer_.memory_property_flags);
+                                         &staging_buffer->memory_property_flags);
         if (!found)
         {
             // If we are here it is likely that we lack support for HOST_CACHED, fallback to COHERENT
@@ -916,7 +923,7 @@ VkResult VulkanResourcesUtil::CreateStagingBuffer(VkDeviceSize size)
                                         memory_requirements.memoryTypeBits,
                                         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
                                         &memory_type_index,
-                                        &staging_buffer_.memory_property_flags);
+                                        &staging_buffer->memory_property_flags);
         }
 
         if (found)
@@ -926,17 +933,17 @@ VkResult VulkanResourcesUtil::CreateStagingBuffer(VkDeviceSize size)
             alloc_info.allocationSize       = memory_requirements.size;
             alloc_info.memoryTypeIndex      = memory_type_index;
 
-            result = device_table_.AllocateMemory(device_, &alloc_info, nullptr, &staging_buffer_.memory);
+            result = device_table_.AllocateMemory(device_, &alloc_info, nullptr, &staging_buffer->memory);
             if (result == VK_SUCCESS)
             {
-                device_table_.BindBufferMemory(device_, staging_buffer_.buffer, staging_buffer_.memory, 0);
+                device_table_.BindBufferMemory(device_, staging_buffer->buffer, staging_buffer->memory, 0);
             }
             else
             {
                 GFXRECON_LOG_ERROR("Failed to allocate staging buffer memory for resource memory snapshot");
 
-                device_table_.DestroyBuffer(device_, staging_buffer_.buffer, nullptr);
-                staging_buffer_.buffer = VK_NULL_HANDLE;
+                device_table_.DestroyBuffer(device_, staging_buffer->buffer, nullptr);
+                staging_buffer->buffer = VK_NULL_HANDLE;
             }
         }
         else
@@ -949,8 +956,8 @@ VkResult VulkanResourcesUtil::CreateStagingBuffer(VkDeviceSize size)
 
         if (result == VK_SUCCESS)
         {
-            staging_buffer_.size       = size;
-            staging_buffer_.mapped_ptr = nullptr;
+            staging_buffer->size       = size;
+            staging_buffer->mapped_ptr = nullptr;
         }
     }
     else
@@ -1016,22 +1023,33 @@ void VulkanResourcesUtil::InvalidateStagingBuffer()
 
 void VulkanResourcesUtil::DestroyStagingBuffer()
 {
-    UnmapStagingBuffer();
+    DestroyStagingBuffer(&staging_buffer_);
+}
 
-    if (staging_buffer_.buffer != VK_NULL_HANDLE)
+void VulkanResourcesUtil::DestroyStagingBuffer(StagingBufferContext* staging_buffer)
+{
+    assert(staging_buffer != nullptr);
+
+    if (staging_buffer->mapped_ptr != nullptr)
+    {
+        device_table_.UnmapMemory(device_, staging_buffer->memory);
+        staging_buffer->mapped_ptr = nullptr;
+    }
+
+    if (staging_buffer->buffer != VK_NULL_HANDLE)
     {
-        device_table_.DestroyBuffer(device_, staging_buffer_.buffer, nullptr);
-        staging_buffer_.buffer = VK_NULL_HANDLE;
+        device_table_.DestroyBuffer(device_, staging_buffer->buffer, nullptr);
+        staging_buffer->buffer = VK_NULL_HANDLE;
     }
 
-    if (staging_buffer_.memory != VK_NULL_HANDLE)
+    if (staging_buffer->memory != VK_NULL_HANDLE)
     {
-        device_table_.FreeMemory(device_, staging_buffer_.memory, nullptr);
-        staging_buffer_.memory = VK_NULL_HANDLE;
+        device_table_.FreeMemory(device_, staging_buffer->memory, nullptr);
+        staging_buffer->memory = VK_NULL_HANDLE;
     }
 
-    staging_buffer_.memory_property_flags = VkMemoryPropertyFlags(0);
-    staging_buffer_.size                  = 0;
+    staging_buffer->memory_property_flags = VkMemoryPropertyFlags(0);
+    staging_buffer->size                  = 0;
 }
 
 void VulkanResourcesUtil::InvalidateMappedMemoryRange(VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size)
@@ -1183,14 +1201,15 @@ void VulkanResourcesUtil::DestroyCommandBuffer()
     }
 }
 
-void VulkanResourcesUtil::TransitionImageToTransferOptimal(VkImage            image,
+void VulkanResourcesUtil::TransitionImageToTransferOptimal(VkCommandBuffer    command_buffer,
+                                                           VkImage            image,
                                                            VkImageLayout      current_layout,
                                                            VkImageLayout      destination_layout,
                                                            VkImageAspectFlags aspect,
                                                            uint32_t           queue_family_index)
 {
     assert(image != VK_NULL_HANDLE);
-    assert(command_buffer_ != VK_NULL_HANDLE);
+    assert(command_buffer != VK_NULL_HANDLE);
 
     VkImageMemoryBarrier memory_barrier;
     memory_barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
@@ -1208,7 +1227,7 @@ void VulkanResourcesUtil::TransitionImageToTransferOptimal(VkImage            im
     memory_barrier.subresourceRange.baseArrayLayer = 0;
     memory_barrier.subresourceRange.layerCount     = VK_REMAINING_ARRAY_LAYERS;
 
-    device_table_.CmdPipelineBarrier(command_buffer_,
+    device_table_.CmdPipelineBarrier(command_buffer,
                                      VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
                                      VK_PIPELINE_STAGE_TRANSFER_BIT,
                                      0,
@@ -1220,14 +1239,15 @@ void VulkanResourcesUtil::TransitionImageToTransferOptimal(VkImage            im
                                      &memory_barrier);
 }
 
-void VulkanResourcesUtil::TransitionImageFromTransferOptimal(VkImage            image,
+void VulkanResourcesUtil::TransitionImageFromTransferOptimal(VkCommandBuffer    command_buffer,
+                                                             VkImage            image,
                                                              VkImageLayout      old_layout,
                                                              VkImageLayout      new_layout,
                                                              VkImageAspectFlags aspect,
                                                              uint32_t           queue_family_index)
 {
     assert(image != VK_NULL_HANDLE);
-    assert(command_buffer_ != VK_NULL_HANDLE);
+    assert(command_buffer != VK_NULL_HANDLE);
 
     VkImageMemoryBarrier memory_barrier;
     memory_barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
@@ -1246,7 +1266,7 @@ void VulkanResourcesUtil::TransitionImageFromTransferOptimal(VkImage
     memory_barrier.oldLayout     = old_layout;
     memory_barrier.newLayout     = new_layout;
 
-    device_table_.CmdPipelineBarrier(command_buffer_,
+    device_table_.CmdPipelineBarrier(command_buffer,
                                      VK_PIPELINE_STAGE_TRANSFER_BIT,
                                      VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
                                      0,
@@ -1258,7 +1278,8 @@ void VulkanResourcesUtil::TransitionImageFromTransferOptimal(VkImage
                                      &memory_barrier);
 }
 
-void VulkanResourcesUtil::CopyImageBuffer(VkImage                      image,
+void VulkanResourcesUtil::CopyImageBuffer(VkCommandBuffer              command_buffer,
+                                          VkImage                      image,
                                           VkBuffer                     buffer,
                                           const VkExtent3D&            extent,
                                           uint32_t                     mip_levels,
@@ -1266,9 +1287,10 @@ void VulkanResourcesUtil::CopyImageBuffer(VkImage                      image,
                                           VkImageAspectFlags           aspect,
                                           const std::vector<uint64_t>& sizes,
                                           bool                         all_layers_per_level,
-                                          CopyBufferImageDirection     copy_direction)
+                                          CopyBufferImageDirection     copy_direction,
+                                          uint64_t                     buffer_offset)
 {
-    assert(command_buffer_ != VK_NULL_HANDLE);
+    assert(command_buffer != VK_NULL_HANDLE);
 
     const uint32_t n_subresources = all_layers_per_level ? mip_levels : mip_levels * array_layers;
 
@@ -1279,7 +1301,7 @@ void VulkanResourcesUtil::CopyImageBuffer(VkImage                      image,
     VkBufferImageCopy copy_region;
     copy_region.bufferRowLength             = 0; // Request tightly packed data.
     copy_region.bufferImageHeight           = 0; // Request tightly packed data.
-    copy_region.bufferOffset                = 0;
+    copy_region.bufferOffset                = buffer_offset;
     copy_region.imageOffset.x               = 0;
     copy_region.imageOffset.y               = 0;
     copy_region.imageOffset.z               = 0;
@@ -1312,7 +1334,7 @@ void VulkanResourcesUtil::CopyImageBuffer(VkImage                      image,
 
     if (copy_direction == kImageToBuffer)
     {
-        device_table_.CmdCopyImageToBuffer(command_buffer_,
+        device_table_.CmdCopyImageToBuffer(command_buffer,
                                            image,
                                            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
                                            buffer,
@@ -1323,7 +1345,7 @@ void VulkanResourcesUtil::CopyImageBuffer(VkImage                      image,
     {
         assert(copy_direction == kBufferToImage);
 
-        device_table_.CmdCopyBufferToImage(command_buffer_,
+        device_table_.CmdCopyBufferToImage(command_buffer,
                                            buffer,
                                            image,
                                            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
@@ -1332,20 +1354,22 @@ void VulkanResourcesUtil::CopyImageBuffer(VkImage                      image,
     }
 }
 
-void VulkanResourcesUtil::CopyBuffer(VkBuffer source_buffer,
-                                     VkBuffer destination_buffer,
-                                     uint64_t size,
-                                     uint64_t src_offset)
+void VulkanResourcesUtil::CopyBuffer(VkCommandBuffer command_buffer,
+                                     VkBuffer        source_buffer,
+                                     VkBuffer        destination_buffer,
+                                     uint64_t        size,
+                                     uint64_t        src_offset,
+                                     uint64_t        dst_offset)
 {
     assert(source_buffer != VK_NULL_HANDLE);
-    assert(command_buffer_ != VK_NULL_HANDLE);
+    assert(command_buffer != VK_NULL_HANDLE);
 
     VkBufferCopy copy_region;
     copy_region.srcOffset = src_offset;
-    copy_region.dstOffset = 0;
+    copy_region.dstOffset = dst_offset;
     copy_region.size      = size;
 
-    device_table_.CmdCopyBuffer(command_buffer_, source_buffer, destination_buffer, 1, &copy_region);
+    device_table_.CmdCopyBuffer(command_buffer, source_buffer, destination_buffer, 1, &copy_region);
 }
 
 VkQueue VulkanResourcesUtil::GetQueue(uint32_t queue_family_index, uint32_t queue_index)
@@ -1750,8 +1774,12 @@ VkResult VulkanResourcesUtil::ReadFromImageResourceStaging(VkImage
     }
     else if (layout != VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL)
     {
-        TransitionImageToTransferOptimal(
-            image, layout, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, transition_aspect, queue_family_index);
+        TransitionImageToTransferOptimal(command_buffer_,
+                                         image,
+                                         layout,
+                                         VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                                         transition_aspect,
+                                         queue_family_index);
     }
 
     // Blit image to change dimensions or convert format
@@ -1785,7 +1813,8 @@ VkResult VulkanResourcesUtil::ReadFromImageResourceStaging(VkImage
     assert(scaled_image != VK_NULL_HANDLE);
 
     // Copy image to staging buffer
-    CopyImageBuffer(scaled_image,
+    CopyImageBuffer(command_buffer_,
+                    scaled_image,
                     staging_buffer_.buffer,
                     use_blit ? scaled_extent : extent,
                     mip_levels,
@@ -1821,8 +1850,12 @@ VkResult VulkanResourcesUtil::ReadFromImageResourceStaging(VkImage
     if ((samples == VK_SAMPLE_COUNT_1_BIT) && (layout != VK_IMAGE_LAYOUT_UNDEFINED) &&
         (layout != VK_IMAGE_LAYOUT_PREINITIALIZED) && (layout != VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL))
     {
-        TransitionImageFromTransferOptimal(
-            image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, layout, transition_aspect, queue_family_index);
+        TransitionImageFromTransferOptimal(command_buffer_,
+                                           image,
+                                           VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                                           layout,
+                                           transition_aspect,
+                                           queue_family_index);
     }
 
     result = SubmitCommandBuffer(queue);
@@ -1943,7 +1976,7 @@ VkResult VulkanResourcesUtil::ReadFromBufferResource(
         return result;
     }
 
-    CopyBuffer(buffer, staging_buffer_.buffer, size, offset);
+    CopyBuffer(command_buffer_, buffer, staging_buffer_.buffer, size, offset);
 
     result = SubmitCommandBuffer(queue);
     if (result != VK_SUCCESS)
@@ -1965,6 +1998,368 @@ VkResult VulkanResourcesUtil::ReadFromBufferResource(
     return result;
 }
 
+VkResult VulkanResourcesUtil::CreateReadbackBatches(uint32_t queue_family_index, VkDeviceSize batch_size)
+{
+    assert(batch_size != 0);
+
+    DestroyReadbackBatches();
+
+    readback_queue_ = GetQueue(queue_family_index, 0);
+    if (readback_queue_ == VK_NULL_HANDLE)
+    {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    // The batches use their own command pool, so that the command buffers used by the other read and write functions
+    // can be recreated for a different queue family while batches are pending.
+    VkCommandPoolCreateInfo pool_info = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+    pool_info.pNext                   = nullptr;
+    pool_info.flags                   = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    pool_info.queueFamilyIndex        = queue_family_index;
+
+    VkResult result = device_table_.CreateCommandPool(device_, &pool_info, nullptr, &readback_command_pool_);
+    if (result != VK_SUCCESS)
+    {
+        GFXRECON_LOG_ERROR("Failed to create a command pool for batched resource memory snapshot");
+        return result;
+    }
+
+    readback_batches_.resize(kReadbackBatchCount);
+
+    for (ReadbackBatch& batch : readback_batches_)
+    {
+        result = CreateStagingBuffer(batch_size, &batch.staging_buffer);
+
+        if (result == VK_SUCCESS)
+        {
+            // Batch staging buffers remain mapped until they are destroyed.
+            result = device_table_.MapMemory(
+                device_, batch.staging_buffer.memory, 0, VK_WHOLE_SIZE, 0, &batch.staging_buffer.mapped_ptr);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            VkCommandBufferAllocateInfo alloc_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+            alloc_info.pNext                       = nullptr;
+            alloc_info.commandPool                 = readback_command_pool_;
+            alloc_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            alloc_info.commandBufferCount          = 1;
+
+            result = device_table_.AllocateCommandBuffers(device_, &alloc_info, &batch.command_buffer);
+
+            if (result == VK_SUCCESS)
+            {
+                // Because this command buffer was not allocated through the loader, it must be assigned a dispatch
+                // table.
+                *reinterpret_cast<void**>(batch.command_buffer) = *reinterpret_cast<void**>(device_);
+            }
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            VkFenceCreateInfo fence_info = { VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+            fence_info.pNext             = nullptr;
+            fence_info.flags             = 0;
+
+            result = device_table_.CreateFence(device_, &fence_info, nullptr, &batch.fence);
+        }
+
+        if (result != VK_SUCCESS)
+        {
+            GFXRECON_LOG_ERROR("Failed to create a staging buffer batch for resource memory snapshot");
+            DestroyReadbackBatches();
+            return result;
+        }
+
+        batch.size = batch_size;
+    }
+
+    return result;
+}
+
+void VulkanResourcesUtil::DestroyReadbackBatches()
+{
+    // Pending batches must complete before their resources can be released.
+    for (uint32_t i = 0; i < readback_pending_count_; ++i)
+    {
+        ReadbackBatch& batch = readback_batches_[(readback_first_pending_ + i) % kReadbackBatchCount];
+        device_table_.WaitForFences(device_, 1, &batch.fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+    }
+
+    for (ReadbackBatch& batch : readback_batches_)
+    {
+        if (batch.fence != VK_NULL_HANDLE)
+        {
+            device_table_.DestroyFence(device_, batch.fence, nullptr);
+        }
+
+        if (batch.command_buffer != VK_NULL_HANDLE)
+        {
+            device_table_.FreeCommandBuffers(device_, readback_command_pool_, 1, &batch.command_buffer);
+        }
+
+        DestroyStagingBuffer(&batch.staging_buffer);
+    }
+
+    if (readback_command_pool_ != VK_NULL_HANDLE)
+    {
+        device_table_.DestroyCommandPool(device_, readback_command_pool_, nullptr);
+        readback_command_pool_ = VK_NULL_HANDLE;
+    }
+
+    readback_batches_.clear();
+    readback_queue_         = VK_NULL_HANDLE;
+    readback_recording_     = false;
+    readback_first_pending_ = 0;
+    readback_pending_count_ = 0;
+}
+
+VkResult VulkanResourcesUtil::BeginReadbackBatch()
+{
+    assert(!readback_batches_.empty() && (readback_pending_count_ < kReadbackBatchCount));
+
+    ReadbackBatch& batch = readback_batches_[GetRecordingReadbackBatchIndex()];
+
+    VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+    begin_info.pNext                    = nullptr;
+    begin_info.flags                    = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    begin_info.pInheritanceInfo         = nullptr;
+
+    VkResult result = device_table_.BeginCommandBuffer(batch.command_buffer, &begin_info);
+
+    if (result == VK_SUCCESS)
+    {
+        batch.used_size     = 0;
+        readback_recording_ = true;
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("Failed to begin a command buffer for batched resource memory snapshot");
+    }
+
+    return result;
+}
+
+VkResult VulkanResourcesUtil::ReserveReadbackBatch(uint64_t size, uint64_t alignment, uint64_t* data_offset)
+{
+    assert((size != 0) && (alignment != 0) && (data_offset != nullptr));
+
+    if (readback_batches_.empty())
+    {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    if (!readback_recording_)
+    {
+        VkResult result = BeginReadbackBatch();
+        if (result != VK_SUCCESS)
+        {
+            return result;
+        }
+    }
+
+    ReadbackBatch& batch  = readback_batches_[GetRecordingReadbackBatchIndex()];
+    uint64_t       offset = ((batch.used_size + alignment - 1) / alignment) * alignment;
+
+    if ((offset > batch.size) || (size > (batch.size - offset)))
+    {
+        return VK_NOT_READY;
+    }
+
+    batch.used_size = offset + size;
+    (*data_offset)  = offset;
+
+    return VK_SUCCESS;
+}
+
+VkResult
+VulkanResourcesUtil::RecordBufferReadback(VkBuffer buffer, uint64_t size, uint64_t offset, uint64_t* data_offset)
+{
+    assert(buffer != VK_NULL_HANDLE);
+
+    VkResult result = ReserveReadbackBatch(size, 4, data_offset);
+
+    if (result == VK_SUCCESS)
+    {
+        ReadbackBatch& batch = readback_batches_[GetRecordingReadbackBatchIndex()];
+
+        CopyBuffer(batch.command_buffer, buffer, batch.staging_buffer.buffer, size, offset, *data_offset);
+    }
+
+    return result;
+}
+
+VkResult VulkanResourcesUtil::RecordImageReadback(VkImage               image,
+                                                  VkFormat              format,
+                                                  VkImageType           type,
+                                                  const VkExtent3D&     extent,
+                                                  uint32_t              mip_levels,
+                                                  uint32_t              array_layers,
+                                                  VkImageTiling         tiling,
+                                                  VkImageLayout         layout,
+                                                  uint32_t              queue_family_index,
+                                                  VkImageAspectFlagBits aspect,
+                                                  uint64_t*             data_offset)
+{
+    assert(image != VK_NULL_HANDLE);
+    assert((aspect == VK_IMAGE_ASPECT_COLOR_BIT) || (aspect == VK_IMAGE_ASPECT_DEPTH_BIT) ||
+           (aspect == VK_IMAGE_ASPECT_STENCIL_BIT));
+
+    std::vector<uint64_t> subresource_sizes;
+    uint64_t              resource_size = GetImageResourceSizesOptimal(
+        image, format, type, extent, mip_levels, array_layers, tiling, aspect, nullptr, &subresource_sizes, true);
+
+    // Image copy offsets must be a multiple of both the texel block size and 4 bytes.
+    uint64_t element_size = std::max(vkuFormatElementSizeWithAspect(format, aspect), 1u);
+    uint64_t alignment    = element_size;
+    while ((alignment % 4) != 0)
+    {
+        alignment += element_size;
+    }
+
+    VkResult result = ReserveReadbackBatch(resource_size, alignment, data_offset);
+
+    if (result == VK_SUCCESS)
+    {
+        ReadbackBatch& batch = readback_batches_[GetRecordingReadbackBatchIndex()];
+
+        VkImageAspectFlags transition_aspect = aspect;
+        if ((transition_aspect == VK_IMAGE_ASPECT_DEPTH_BIT) || (transition_aspect == VK_IMAGE_ASPECT_STENCIL_BIT))
+        {
+            // Depth and stencil aspects need to be transitioned together, so get full aspect mask for image.
+            transition_aspect = GetFormatAspectMask(format);
+        }
+
+        if (layout != VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL)
+        {
+            TransitionImageToTransferOptimal(batch.command_buffer,
+                                             image,
+                                             layout,
+                                             VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                                             transition_aspect,
+                                             queue_family_index);
+        }
+
+        CopyImageBuffer(batch.command_buffer,
+                        image,
+                        batch.staging_buffer.buffer,
+                        extent,
+                        mip_levels,
+                        array_layers,
+                        aspect,
+                        subresource_sizes,
+                        true,
+                        kImageToBuffer,
+                        *data_offset);
+
+        if ((layout != VK_IMAGE_LAYOUT_UNDEFINED) && (layout != VK_IMAGE_LAYOUT_PREINITIALIZED) &&
+            (layout != VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL))
+        {
+            TransitionImageFromTransferOptimal(batch.command_buffer,
+                                               image,
+                                               VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                                               layout,
+                                               transition_aspect,
+                                               queue_family_index);
+        }
+    }
+
+    return result;
+}
+
+VkResult VulkanResourcesUtil::SubmitReadbackBatch()
+{
+    assert(readback_recording_ && (readback_pending_count_ < (kReadbackBatchCount - 1)));
+
+    ReadbackBatch& batch = readback_batches_[GetRecordingReadbackBatchIndex()];
+
+    // Cache flushing barrier. Make results visible to host
+    VkBufferMemoryBarrier buffer_barrier;
+    buffer_barrier.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    buffer_barrier.pNext               = nullptr;
+    buffer_barrier.srcAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT;
+    buffer_barrier.dstAccessMask       = VK_ACCESS_HOST_READ_BIT;
+    buffer_barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    buffer_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    buffer_barrier.buffer              = batch.staging_buffer.buffer;
+    buffer_barrier.offset              = 0;
+    buffer_barrier.size                = VK_WHOLE_SIZE;
+
+    device_table_.CmdPipelineBarrier(batch.command_buffer,
+                                     VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                     VK_PIPELINE_STAGE_HOST_BIT,
+                                     0,
+                                     0,
+                                     nullptr,
+                                     1,
+                                     &buffer_barrier,
+                                     0,
+                                     nullptr);
+
+    readback_recording_ = false;
+
+    VkResult result = device_table_.EndCommandBuffer(batch.command_buffer);
+    if (result != VK_SUCCESS)
+    {
+        GFXRECON_LOG_ERROR("Failed to end a command buffer for batched resource memory snapshot");
+        return result;
+    }
+
+    result = device_table_.ResetFences(device_, 1, &batch.fence);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    VkSubmitInfo submit_info         = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+    submit_info.pNext                = nullptr;
+    submit_info.waitSemaphoreCount   = 0;
+    submit_info.pWaitSemaphores      = nullptr;
+    submit_info.pWaitDstStageMask    = nullptr;
+    submit_info.commandBufferCount   = 1;
+    submit_info.pCommandBuffers      = &batch.command_buffer;
+    submit_info.signalSemaphoreCount = 0;
+    submit_info.pSignalSemaphores    = nullptr;
+
+    result = device_table_.QueueSubmit(readback_queue_, 1, &submit_info, batch.fence);
+    if (result != VK_SUCCESS)
+    {
+        GFXRECON_LOG_ERROR("Failed to submit command buffer for execution while taking a resource memory snapshot");
+        return result;
+    }
+
+    ++readback_pending_count_;
+
+    return result;
+}
+
+VkResult VulkanResourcesUtil::WaitReadbackBatch(const uint8_t** data)
+{
+    assert((data != nullptr) && (readback_pending_count_ > 0));
+
+    ReadbackBatch& batch = readback_batches_[readback_first_pending_];
+
+    readback_first_pending_ = (readback_first_pending_ + 1) % kReadbackBatchCount;
+    --readback_pending_count_;
+
+    VkResult result =
+        device_table_.WaitForFences(device_, 1, &batch.fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+    if (result != VK_SUCCESS)
+    {
+        GFXRECON_LOG_ERROR("WaitForFences returned %d while taking a resource memory snapshot", result);
+        return result;
+    }
+
+    if (!IsMemoryCoherent(batch.staging_buffer.memory_property_flags))
+    {
+        InvalidateMappedMemoryRange(batch.staging_buffer.memory, 0, VK_WHOLE_SIZE);
+    }
+
+    (*data) = reinterpret_cast<const uint8_t*>(batch.staging_buffer.mapped_ptr);
+
+    return result;
+}
+
 VkResult VulkanResourcesUtil::WriteToImageResourceStaging(VkImage                      image,
                                                           VkFormat                     format,
                                                           VkImageType                  type,
@@ -2042,11 +2437,16 @@ VkResult VulkanResourcesUtil::WriteToImageResourceStaging(VkImage
 
     if (layout != VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL)
     {
-        TransitionImageToTransferOptimal(
-            image, layout, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, transition_aspect, queue_family_index);
+        TransitionImageToTransferOptimal(command_buffer_,
+                                         image,
+                                         layout,
+                                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                         transition_aspect,
+                                         queue_family_index);
     }
 
-    CopyImageBuffer(image,
+    CopyImageBuffer(command_buffer_,
+                    image,
                     staging_buffer_.buffer,
                     extent,
                     mip_levels,
@@ -2058,8 +2458,12 @@ VkResult VulkanResourcesUtil::WriteToImageResourceStaging(VkImage
 
     if (layout != VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL)
     {
-        TransitionImageFromTransferOptimal(
-            image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, layout, transition_aspect, queue_family_index);
+        TransitionImageFromTransferOptimal(command_buffer_,
+                                           image,
+                                           VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                           layout,
+                                           transition_aspect,
+                                           queue_family_index);
     }
 
     result = SubmitCommandBuffer(queue);
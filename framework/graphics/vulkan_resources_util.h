@@ -54,7 +54,8 @@ class VulkanResourcesUtil
         device_(device),
         physical_device_(physical_device), device_table_(device_table), instance_table_(instance_table),
         memory_properties_(memory_properties), queue_family_index_(UINT32_MAX), command_pool_(VK_NULL_HANDLE),
-        command_buffer_(VK_NULL_HANDLE)
+        command_buffer_(VK_NULL_HANDLE), readback_queue_(VK_NULL_HANDLE), readback_command_pool_(VK_NULL_HANDLE),
+        readback_recording_(false), readback_first_pending_(0), readback_pending_count_(0)
     {
         assert(device != VK_NULL_HANDLE);
         assert(memory_properties.memoryHeapCount <= VK_MAX_MEMORY_HEAPS);
@@ -63,6 +64,7 @@ class VulkanResourcesUtil
 
     ~VulkanResourcesUtil()
     {
+        DestroyReadbackBatches();
         DestroyStagingBuffer();
         DestroyCommandBuffer();
         DestroyCommandPool();
@@ -153,6 +155,49 @@ class VulkanResourcesUtil
     VkResult ReadFromBufferResource(
         VkBuffer buffer, uint64_t size, uint64_t offset, uint32_t queue_family_index, std::vector<uint8_t>& data);
 
+    // Number of staging buffers used by the batched readback functions.
+    static const uint32_t kReadbackBatchCount = 3;
+
+    // Batched readback, for reading many resources with few submissions and without waiting for the queue to become
+    // idle. Copies are recorded into one of kReadbackBatchCount staging buffers of batch_size bytes, and each batch is
+    // submitted with its own fence, so that the data of one batch can be processed while the GPU copies the next ones.
+    VkResult CreateReadbackBatches(uint32_t queue_family_index, VkDeviceSize batch_size);
+
+    // Waits for all submitted batches to complete and releases the batched readback resources.
+    void DestroyReadbackBatches();
+
+    // Records a copy of the buffer range to the batch that is being recorded and returns the offset of the copied data
+    // within the batch. Returns VK_NOT_READY, without recording the copy, when the batch does not have enough space
+    // left for the data, in which case the batch must be submitted first.
+    VkResult RecordBufferReadback(VkBuffer buffer, uint64_t size, uint64_t offset, uint64_t* data_offset);
+
+    // Records a copy of a single sample image aspect to the batch that is being recorded, returning the offset of the
+    // copied data within the batch. The data is tightly packed, with all array layers of a mip level stored together,
+    // as with GetImageResourceSizesOptimal() when all_layers_per_level is true. Returns VK_NOT_READY, without recording
+    // the copy, when the batch does not have enough space left for the data.
+    VkResult RecordImageReadback(VkImage               image,
+                                 VkFormat              format,
+                                 VkImageType           type,
+                                 const VkExtent3D&     extent,
+                                 uint32_t              mip_levels,
+                                 uint32_t              array_layers,
+                                 VkImageTiling         tiling,
+                                 VkImageLayout         layout,
+                                 uint32_t              queue_family_index,
+                                 VkImageAspectFlagBits aspect,
+                                 uint64_t*             data_offset);
+
+    // Returns the number of batches that have been submitted and not yet retrieved with WaitReadbackBatch().
+    uint32_t GetPendingReadbackBatchCount() const { return readback_pending_count_; }
+
+    // Submits the batch that is being recorded. At most kReadbackBatchCount - 1 batches can be pending, so the oldest
+    // batch must be retrieved with WaitReadbackBatch() before submitting when that limit has been reached.
+    VkResult SubmitReadbackBatch();
+
+    // Waits for the oldest pending batch to complete and retrieves a pointer to its data, which remains valid until
+    // the next call to SubmitReadbackBatch().
+    VkResult WaitReadbackBatch(const uint8_t** data);
+
     bool IsBlitSupported(VkFormat       src_format,
                          VkImageTiling  src_image_tiling,
                          VkFormat       dst_format,
@@ -188,19 +233,22 @@ class VulkanResourcesUtil
 
     void DestroyStagingBuffer();
 
-    void TransitionImageToTransferOptimal(VkImage            image,
+    void TransitionImageToTransferOptimal(VkCommandBuffer    command_buffer,
+                                          VkImage            image,
                                           VkImageLayout      current_layout,
                                           VkImageLayout      destination_layout,
                                           VkImageAspectFlags aspect,
                                           uint32_t           queue_family_index);
 
-    void TransitionImageFromTransferOptimal(VkImage            image,
+    void TransitionImageFromTransferOptimal(VkCommandBuffer    command_buffer,
+                                            VkImage            image,
                                             VkImageLayout      old_layout,
                                             VkImageLayout      new_layout,
                                             VkImageAspectFlags aspect,
                                             uint32_t           queue_family_index);
 
-    void CopyImageBuffer(VkImage                      image,
+    void CopyImageBuffer(VkCommandBuffer              command_buffer,
+                         VkImage                      image,
                          VkBuffer                     buffer,
                          const VkExtent3D&            extent,
                          uint32_t                     mip_levels,
@@ -208,9 +256,15 @@ class VulkanResourcesUtil
                          VkImageAspectFlags           aspect,
                          const std::vector<uint64_t>& sizes,
                          bool                         all_layers_per_level,
-                         CopyBufferImageDirection     copy_direction);
+                         CopyBufferImageDirection     copy_direction,
+                         uint64_t                     buffer_offset = 0);
 
-    void CopyBuffer(VkBuffer source_buffer, VkBuffer destination_buffer, uint64_t size, uint64_t offset);
+    void CopyBuffer(VkCommandBuffer command_buffer,
+                    VkBuffer        source_buffer,
+                    VkBuffer        destination_buffer,
+                    uint64_t        size,
+                    uint64_t        src_offset,
+                    uint64_t        dst_offset = 0);
 
     VkResult ResolveImage(VkImage           image,
                           VkFormat          format,
@@ -255,6 +309,31 @@ class VulkanResourcesUtil
         void*                 mapped_ptr            = nullptr;
     };
 
+    struct ReadbackBatch
+    {
+        StagingBufferContext staging_buffer;
+        VkCommandBuffer      command_buffer = VK_NULL_HANDLE;
+        VkFence              fence          = VK_NULL_HANDLE;
+        VkDeviceSize         size           = 0;
+        VkDeviceSize         used_size      = 0;
+    };
+
+    VkResult CreateStagingBuffer(VkDeviceSize size, StagingBufferContext* staging_buffer);
+
+    void DestroyStagingBuffer(StagingBufferContext* staging_buffer);
+
+    // The batch that is being recorded follows the pending batches.
+    uint32_t GetRecordingReadbackBatchIndex() const
+    {
+        return (readback_first_pending_ + readback_pending_count_) % kReadbackBatchCount;
+    }
+
+    VkResult BeginReadbackBatch();
+
+    // Returns the offset of the next copy in the batch that is being recorded, or VK_NOT_READY if there is not enough
+    // space left for the copy.
+    VkResult ReserveReadbackBatch(uint64_t size, uint64_t alignment, uint64_t* data_offset);
+
     VkDevice                                device_;
     const encode::VulkanDeviceTable&        device_table_;
     VkPhysicalDevice                        physical_device_;
@@ -264,6 +343,12 @@ class VulkanResourcesUtil
     VkCommandPool                           command_pool_;
     VkCommandBuffer                         command_buffer_;
     StagingBufferContext                    staging_buffer_;
+    VkQueue                                 readback_queue_;
+    VkCommandPool                           readback_command_pool_;
+    std::vector<ReadbackBatch>              readback_batches_;
+    bool                                    readback_recording_;
+    uint32_t                                readback_first_pending_;
+    uint32_t                                readback_pending_count_;
 };
 
 void GetFormatAspects(VkFormat                            format,
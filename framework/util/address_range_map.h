@@ -0,0 +1,136 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_ADDRESS_RANGE_MAP_H
+#define GFXRECON_UTIL_ADDRESS_RANGE_MAP_H
+
+#include "util/defines.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Maps non-overlapping address ranges to values, for finding the range that contains an address. Ranges are stored in
+// a vector sorted by start address, so lookups are a binary search over contiguous memory, while insertion and removal
+// move the ranges that follow. This suits maps that are searched much more often than they are modified.
+template <typename T>
+class AddressRangeMap
+{
+  public:
+    // Adds the range [start_address, end_address). Returns false, without adding the range, if it is empty or
+    // overlaps a range that is already in the map.
+    bool Insert(const void* start_address, const void* end_address, const T& value)
+    {
+        uintptr_t start = reinterpret_cast<uintptr_t>(start_address);
+        uintptr_t end   = reinterpret_cast<uintptr_t>(end_address);
+
+        if (start >= end)
+        {
+            return false;
+        }
+
+        auto next = UpperBound(start);
+
+        if (((next != ranges_.end()) && (next->start < end)) ||
+            ((next != ranges_.begin()) && (std::prev(next)->end > start)))
+        {
+            return false;
+        }
+
+        ranges_.insert(next, Range{ start, end, value });
+
+        return true;
+    }
+
+    // Removes the range that starts at the specified address. Returns false if there is no such range.
+    bool Remove(const void* start_address)
+    {
+        uintptr_t start = reinterpret_cast<uintptr_t>(start_address);
+        auto      range = UpperBound(start);
+
+        if ((range == ranges_.begin()) || (std::prev(range)->start != start))
+        {
+            return false;
+        }
+
+        ranges_.erase(std::prev(range));
+
+        return true;
+    }
+
+    // Retrieves the value of the range that contains the specified address. Returns false if no range contains it.
+    bool Find(const void* address, T* value) const
+    {
+        uintptr_t key   = reinterpret_cast<uintptr_t>(address);
+        auto      range = UpperBound(key);
+
+        if ((range == ranges_.begin()) || (std::prev(range)->end <= key))
+        {
+            return false;
+        }
+
+        (*value) = std::prev(range)->value;
+
+        return true;
+    }
+
+    void Clear() { ranges_.clear(); }
+
+    size_t GetSize() const { return ranges_.size(); }
+
+  private:
+    struct Range
+    {
+        uintptr_t start;
+        uintptr_t end;
+        T         value;
+    };
+
+    typedef std::vector<Range> RangeList;
+
+    // Returns the first range with a start address greater than the specified address.
+    typename RangeList::const_iterator UpperBound(uintptr_t address) const
+    {
+        return std::upper_bound(ranges_.begin(), ranges_.end(), address, [](uintptr_t value, const Range& element) {
+            return value < element.start;
+        });
+    }
+
+    typename RangeList::iterator UpperBound(uintptr_t address)
+    {
+        return std::upper_bound(ranges_.begin(), ranges_.end(), address, [](uintptr_t value, const Range& element) {
+            return value < element.start;
+        });
+    }
+
+  private:
+    RangeList ranges_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_ADDRESS_RANGE_MAP_H
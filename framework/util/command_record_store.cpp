@@ -0,0 +1,188 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/command_record_store.h"
+
+#include <algorithm>
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+CommandRecordBlockPool* CommandRecordBlockPool::GetDefault()
+{
+    static CommandRecordBlockPool* pool = new CommandRecordBlockPool;
+    return pool;
+}
+
+size_t CommandRecordBlockPool::GetBlockSize(size_t size)
+{
+    if (size <= kSmallBlockSize)
+    {
+        return kSmallBlockSize;
+    }
+    return std::max(size, kBlockSize);
+}
+
+std::unique_ptr<uint8_t[]> CommandRecordBlockPool::AcquireBlock(size_t size)
+{
+    const std::lock_guard<std::mutex> lock(mutex_);
+
+    size = GetBlockSize(size);
+
+    std::unique_ptr<uint8_t[]> block;
+    auto*                      idle_blocks = GetIdleBlocks(size);
+
+    if ((idle_blocks != nullptr) && !idle_blocks->empty())
+    {
+        block = std::move(idle_blocks->back());
+        idle_blocks->pop_back();
+        usage_.idle_size -= size;
+        ++usage_.reuse_count;
+    }
+    else
+    {
+        block = std::unique_ptr<uint8_t[]>(new uint8_t[size]);
+        ++usage_.allocation_count;
+    }
+
+    usage_.in_use_size += size;
+    usage_.peak_in_use_size = std::max(usage_.peak_in_use_size, usage_.in_use_size);
+
+    return block;
+}
+
+void CommandRecordBlockPool::ReleaseBlock(std::unique_ptr<uint8_t[]> block, size_t size)
+{
+    const std::lock_guard<std::mutex> lock(mutex_);
+
+    assert(usage_.in_use_size >= size);
+    usage_.in_use_size -= size;
+
+    auto* idle_blocks = GetIdleBlocks(size);
+    if ((idle_blocks != nullptr) && ((usage_.idle_size + size) <= max_idle_size_))
+    {
+        idle_blocks->emplace_back(std::move(block));
+        usage_.idle_size += size;
+    }
+}
+
+CommandRecordBlockPool::MemoryUsage CommandRecordBlockPool::GetMemoryUsage() const
+{
+    const std::lock_guard<std::mutex> lock(mutex_);
+    return usage_;
+}
+
+std::vector<std::unique_ptr<uint8_t[]>>* CommandRecordBlockPool::GetIdleBlocks(size_t block_size)
+{
+    if (block_size == kSmallBlockSize)
+    {
+        return &idle_small_blocks_;
+    }
+    else if (block_size == kBlockSize)
+    {
+        return &idle_blocks_;
+    }
+
+    // Dedicated blocks are not reused.
+    return nullptr;
+}
+
+void CommandRecordStore::Append(uint32_t call_id, const void* data, size_t size)
+{
+    const size_t record_size = GetRecordSize(size);
+
+    if (blocks_.empty() || ((blocks_.back().capacity - blocks_.back().used) < record_size))
+    {
+        // The first block is small, later blocks are large.
+        size_t request_size = blocks_.empty() ? record_size : std::max(record_size, CommandRecordBlockPool::kBlockSize);
+
+        Block block;
+        block.capacity = CommandRecordBlockPool::GetBlockSize(request_size);
+        block.data     = pool_->AcquireBlock(request_size);
+        block.used     = 0;
+        blocks_.emplace_back(std::move(block));
+    }
+
+    Block&       block  = blocks_.back();
+    RecordHeader header = { static_cast<uint64_t>(size), call_id, 0 };
+
+    memcpy(block.data.get() + block.used, &header, sizeof(header));
+    if (size > 0)
+    {
+        memcpy(block.data.get() + block.used + sizeof(header), data, size);
+    }
+
+    block.used += record_size;
+    data_size_ += size;
+    ++record_count_;
+}
+
+void CommandRecordStore::Clear()
+{
+    if (!blocks_.empty())
+    {
+        for (size_t i = 1; i < blocks_.size(); ++i)
+        {
+            pool_->ReleaseBlock(std::move(blocks_[i].data), blocks_[i].capacity);
+        }
+
+        blocks_.resize(1);
+        blocks_[0].used = 0;
+
+        // A first block that was sized for a large record is not kept.
+        if (blocks_[0].capacity != CommandRecordBlockPool::kSmallBlockSize)
+        {
+            pool_->ReleaseBlock(std::move(blocks_[0].data), blocks_[0].capacity);
+            blocks_.clear();
+        }
+    }
+
+    data_size_    = 0;
+    record_count_ = 0;
+}
+
+void CommandRecordStore::Release()
+{
+    for (Block& block : blocks_)
+    {
+        pool_->ReleaseBlock(std::move(block.data), block.capacity);
+    }
+
+    blocks_.clear();
+    data_size_    = 0;
+    record_count_ = 0;
+}
+
+size_t CommandRecordStore::GetReservedSize() const
+{
+    size_t size = 0;
+    for (const Block& block : blocks_)
+    {
+        size += block.capacity;
+    }
+    return size;
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,166 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef GFXRECON_UTIL_COMMAND_RECORD_STORE_H
+#define GFXRECON_UTIL_COMMAND_RECORD_STORE_H
+
+#include "util/defines.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Shared source of the memory blocks used by CommandRecordStore. Stores start with a small block, so that the many
+// command buffers that only record a few commands stay small, and continue with large blocks. Blocks that are released
+// by a store are kept for reuse by other stores, up to a limit on the amount of idle memory, after which they are
+// freed.
+class CommandRecordBlockPool
+{
+  public:
+    static constexpr size_t kSmallBlockSize     = 4 * 1024;
+    static constexpr size_t kBlockSize          = 64 * 1024;
+    static constexpr size_t kDefaultMaxIdleSize = 64 * 1024 * 1024;
+
+    struct MemoryUsage
+    {
+        size_t in_use_size{ 0 };      // Size of the blocks held by stores.
+        size_t peak_in_use_size{ 0 }; // Largest value of in_use_size.
+        size_t idle_size{ 0 };        // Size of the blocks kept by the pool for reuse.
+        size_t allocation_count{ 0 }; // Number of blocks allocated from the system heap.
+        size_t reuse_count{ 0 };      // Number of blocks handed out from the pool without allocating.
+    };
+
+    CommandRecordBlockPool(size_t max_idle_size = kDefaultMaxIdleSize) : max_idle_size_(max_idle_size) {}
+
+    // Pool used by default constructed stores. It is never destroyed, so that stores may release their blocks during
+    // process exit.
+    static CommandRecordBlockPool* GetDefault();
+
+    // Returns the size of the block that AcquireBlock returns for a request of size bytes.
+    static size_t GetBlockSize(size_t size);
+
+    // Returns a block of GetBlockSize(size) bytes. Requests larger than kBlockSize get a dedicated block that is freed
+    // when released.
+    std::unique_ptr<uint8_t[]> AcquireBlock(size_t size);
+
+    // Returns a block to the pool. The size must be the size of the block.
+    void ReleaseBlock(std::unique_ptr<uint8_t[]> block, size_t size);
+
+    MemoryUsage GetMemoryUsage() const;
+
+  private:
+    std::vector<std::unique_ptr<uint8_t[]>>* GetIdleBlocks(size_t block_size);
+
+  private:
+    mutable std::mutex                      mutex_;
+    std::vector<std::unique_ptr<uint8_t[]>> idle_small_blocks_;
+    std::vector<std::unique_ptr<uint8_t[]>> idle_blocks_;
+    size_t                                  max_idle_size_;
+    MemoryUsage                             usage_;
+};
+
+// Append-only storage for recorded API calls, as (call id, parameter data) records. Records are stored in blocks
+// borrowed from a CommandRecordBlockPool, so recording never copies previously recorded data, and the memory of a
+// store that is cleared is recycled for other stores instead of staying reserved at the store's peak size.
+class CommandRecordStore
+{
+  public:
+    CommandRecordStore(CommandRecordBlockPool* pool = CommandRecordBlockPool::GetDefault()) : pool_(pool) {}
+
+    ~CommandRecordStore() { Release(); }
+
+    CommandRecordStore(const CommandRecordStore&) = delete;
+
+    CommandRecordStore& operator=(const CommandRecordStore&) = delete;
+
+    void Append(uint32_t call_id, const void* data, size_t size);
+
+    // Removes all records. The first, small, block is kept to avoid a trip to the pool for stores that are cleared and
+    // recorded again every frame. The remaining blocks are returned to the pool.
+    void Clear();
+
+    // Removes all records and returns all blocks to the pool.
+    void Release();
+
+    // Calls visitor(call_id, data, size) for each record in the order that the records were appended.
+    template <typename Visitor>
+    void Visit(Visitor visitor) const
+    {
+        for (const Block& block : blocks_)
+        {
+            size_t offset = 0;
+            while (offset < block.used)
+            {
+                RecordHeader header;
+                memcpy(&header, block.data.get() + offset, sizeof(header));
+                visitor(header.call_id, block.data.get() + offset + sizeof(header), static_cast<size_t>(header.size));
+                offset += GetRecordSize(static_cast<size_t>(header.size));
+            }
+        }
+    }
+
+    bool IsEmpty() const { return record_count_ == 0; }
+
+    // Total size of the recorded parameter data.
+    size_t GetDataSize() const { return data_size_; }
+
+    size_t GetRecordCount() const { return record_count_; }
+
+    // Size of the memory held by the store, including record headers and unused space at the end of blocks.
+    size_t GetReservedSize() const;
+
+  private:
+    struct RecordHeader
+    {
+        uint64_t size;
+        uint32_t call_id;
+        uint32_t reserved;
+    };
+
+    struct Block
+    {
+        std::unique_ptr<uint8_t[]> data;
+        size_t                     capacity;
+        size_t                     used;
+    };
+
+    // Records are padded to keep record headers 8 byte aligned.
+    static size_t GetRecordSize(size_t data_size) { return (sizeof(RecordHeader) + data_size + 7) & ~size_t{ 7 }; }
+
+  private:
+    CommandRecordBlockPool* pool_;
+    std::vector<Block>      blocks_;
+    size_t                  data_size_{ 0 };
+    size_t                  record_count_{ 0 };
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_COMMAND_RECORD_STORE_H
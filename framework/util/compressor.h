@@ -33,23 +33,72 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
+// A compressor instance is shared by all capture and replay threads, so implementations must not keep per-call state
+// in member variables. Library contexts that are expensive to create are kept per thread instead, created on first use
+// and reused for every subsequent block rather than being created and destroyed for each call.
 class Compressor
 {
   public:
-    Compressor() {}
+    // Selects the compressor's default level: the fastest level for LZ4 and Zstandard, and the highest compression
+    // ratio for zlib.
+    static const int kDefaultCompressionLevel = 0;
+
+    Compressor() : compression_level_(kDefaultCompressionLevel) {}
 
     virtual ~Compressor() {}
 
+    // The interpretation of the level is specific to each compressor, with out of range values clamped to the range
+    // supported by the compression library:
+    //   LZ4:  Negative values select an acceleration factor equal to the absolute value, trading compression ratio
+    //         for speed. Positive values are equivalent to the default level.
+    //   zlib: Values 1 to 9, as defined by zlib.
+    //   Zstd: Values from ZSTD_minCLevel() to ZSTD_maxCLevel(), as defined by Zstandard.
+    void SetCompressionLevel(int level) { compression_level_ = level; }
+
+    int GetCompressionLevel() const { return compression_level_; }
+
+    // Load a dictionary to use for all subsequent compression and decompression. The compression level must be set
+    // before loading the dictionary. Returns false if the compressor does not support dictionaries or the dictionary
+    // could not be loaded.
+    virtual bool LoadDictionary(const uint8_t* dictionary_data, size_t dictionary_size)
+    {
+        GFXRECON_UNREFERENCED_PARAMETER(dictionary_data);
+        GFXRECON_UNREFERENCED_PARAMETER(dictionary_size);
+        return false;
+    }
+
     // If needed, compressed_data will be resized to fit the compressed data + compressed_data_offset.
     virtual size_t Compress(const size_t          uncompressed_size,
                             const uint8_t*        uncompressed_data,
                             std::vector<uint8_t>* compressed_data,
                             size_t                compressed_data_offset) = 0;
 
-    virtual size_t Decompress(const size_t                compressed_size,
-                              const std::vector<uint8_t>& compressed_data,
-                              const size_t                expected_uncompressed_size,
-                              std::vector<uint8_t>*       uncompressed_data) = 0;
+    // uncompressed_data must already be sized to hold at least expected_uncompressed_size bytes.
+    size_t Decompress(const size_t                compressed_size,
+                      const std::vector<uint8_t>& compressed_data,
+                      const size_t                expected_uncompressed_size,
+                      std::vector<uint8_t>*       uncompressed_data)
+    {
+        size_t result = 0;
+
+        if (uncompressed_data != nullptr)
+        {
+            result = Decompress(
+                compressed_size, compressed_data.data(), expected_uncompressed_size, uncompressed_data->data());
+        }
+
+        return result;
+    }
+
+    // Decompresses into caller provided storage, which may be mapped device memory. Implementations write the output
+    // sequentially and may read back previously written output while decoding matches.
+    virtual size_t Decompress(const size_t   compressed_size,
+                              const uint8_t* compressed_data,
+                              const size_t   expected_uncompressed_size,
+                              uint8_t*       uncompressed_data) = 0;
+
+  protected:
+    int compression_level_;
 };
 
 GFXRECON_END_NAMESPACE(util)
@@ -0,0 +1,360 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/delta_encoder.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Returns the number of leading bytes that are equal in lhs and rhs, comparing eight bytes at a time.
+static size_t CountEqualBytes(const uint8_t* lhs, const uint8_t* rhs, size_t size)
+{
+    size_t count = 0;
+
+    while ((count + sizeof(uint64_t)) <= size)
+    {
+        uint64_t lhs_word = 0;
+        uint64_t rhs_word = 0;
+        memcpy(&lhs_word, lhs + count, sizeof(lhs_word));
+        memcpy(&rhs_word, rhs + count, sizeof(rhs_word));
+
+        if (lhs_word != rhs_word)
+        {
+            break;
+        }
+
+        count += sizeof(uint64_t);
+    }
+
+    while ((count < size) && (lhs[count] == rhs[count]))
+    {
+        ++count;
+    }
+
+    return count;
+}
+
+static size_t CountDifferentBytes(const uint8_t* lhs, const uint8_t* rhs, size_t size)
+{
+    size_t count = 0;
+
+    while ((count < size) && (lhs[count] != rhs[count]))
+    {
+        ++count;
+    }
+
+    return count;
+}
+
+// Builds the span sequence from alternating runs of unchanged and changed bytes, merging changed runs that are
+// separated by fewer than kMinSkipSize unchanged bytes.
+class DeltaSpanWriter
+{
+  public:
+    DeltaSpanWriter(const uint8_t*        data,
+                    std::vector<uint8_t>* encoded,
+                    size_t                encoded_offset,
+                    size_t                max_encoded_size) :
+        data_(data), encoded_(encoded), encoded_offset_(encoded_offset), max_encoded_size_(max_encoded_size)
+    {}
+
+    void Unchanged(uint64_t size)
+    {
+        gap_size_ += size;
+        position_ += size;
+    }
+
+    void Changed(uint64_t size)
+    {
+        if (copy_size_ == 0)
+        {
+            skip_size_ += gap_size_;
+            copy_offset_ = position_;
+            copy_size_   = size;
+        }
+        else if (gap_size_ < DeltaEncoder::kMinSkipSize)
+        {
+            copy_size_ += gap_size_ + size;
+        }
+        else
+        {
+            WriteSpan();
+            skip_size_   = gap_size_;
+            copy_offset_ = position_;
+            copy_size_   = size;
+        }
+
+        gap_size_ = 0;
+        position_ += size;
+    }
+
+    bool IsOverflowed() const { return overflowed_; }
+
+    // Writes the pending span and returns false if the encoded data exceeded the maximum size.
+    bool Finish(size_t* encoded_size)
+    {
+        if (copy_size_ > 0)
+        {
+            WriteSpan();
+        }
+
+        *encoded_size = overflowed_ ? 0 : encoded_size_;
+        return !overflowed_;
+    }
+
+  private:
+    void WriteSpan()
+    {
+        const uint64_t kMaxSpanSize = std::numeric_limits<uint32_t>::max();
+
+        // Sizes that do not fit in 32 bits are split across multiple spans.
+        while (!overflowed_ && (skip_size_ > kMaxSpanSize))
+        {
+            WriteSpanData(static_cast<uint32_t>(kMaxSpanSize), 0, nullptr);
+            skip_size_ -= kMaxSpanSize;
+        }
+
+        const uint8_t* copy_data = data_ + copy_offset_;
+        uint32_t       skip_size = static_cast<uint32_t>(skip_size_);
+
+        while (!overflowed_ && (copy_size_ > 0))
+        {
+            uint32_t copy_size = static_cast<uint32_t>(std::min(copy_size_, kMaxSpanSize));
+            WriteSpanData(skip_size, copy_size, copy_data);
+
+            skip_size = 0;
+            copy_data += copy_size;
+            copy_size_ -= copy_size;
+        }
+
+        skip_size_ = 0;
+        copy_size_ = 0;
+    }
+
+    void WriteSpanData(uint32_t skip_size, uint32_t copy_size, const uint8_t* copy_data)
+    {
+        DeltaEncoder::SpanHeader span{ skip_size, copy_size };
+        size_t                   span_size = sizeof(span) + copy_size;
+
+        if ((max_encoded_size_ - encoded_size_) < span_size)
+        {
+            overflowed_ = true;
+        }
+        else
+        {
+            size_t write_offset = encoded_offset_ + encoded_size_;
+
+            if (encoded_->size() < (write_offset + span_size))
+            {
+                encoded_->resize(write_offset + span_size);
+            }
+
+            memcpy(encoded_->data() + write_offset, &span, sizeof(span));
+
+            if (copy_size > 0)
+            {
+                memcpy(encoded_->data() + write_offset + sizeof(span), copy_data, copy_size);
+            }
+
+            encoded_size_ += span_size;
+        }
+    }
+
+  private:
+    const uint8_t*        data_;
+    std::vector<uint8_t>* encoded_;
+    size_t                encoded_offset_;
+    size_t                max_encoded_size_;
+    size_t                encoded_size_{ 0 };
+    uint64_t              position_{ 0 };
+    uint64_t              skip_size_{ 0 };
+    uint64_t              gap_size_{ 0 };
+    uint64_t              copy_offset_{ 0 };
+    uint64_t              copy_size_{ 0 };
+    bool                  overflowed_{ false };
+};
+
+bool DeltaEncoder::Encode(uint64_t              memory_id,
+                          uint64_t              offset,
+                          size_t                size,
+                          const uint8_t*        data,
+                          size_t                max_encoded_size,
+                          std::vector<uint8_t>* encoded,
+                          size_t                encoded_offset,
+                          size_t*               encoded_size)
+{
+    assert((data != nullptr) && (encoded != nullptr) && (encoded_size != nullptr));
+
+    std::lock_guard<std::mutex> lock(baseline_lock_);
+
+    Baseline&       baseline = baselines_[memory_id];
+    DeltaSpanWriter writer(data, encoded, encoded_offset, max_encoded_size);
+    uint64_t        end      = offset + size;
+    uint64_t        position = offset;
+
+    // Find the first previously written range that overlaps the new data.
+    auto valid_range = baseline.valid_ranges.upper_bound(offset);
+    if ((valid_range != baseline.valid_ranges.begin()) && (std::prev(valid_range)->second > offset))
+    {
+        --valid_range;
+    }
+
+    while ((position < end) && !writer.IsOverflowed())
+    {
+        if ((valid_range != baseline.valid_ranges.end()) && (valid_range->first <= position))
+        {
+            uint64_t valid_end = std::min(valid_range->second, end);
+
+            while (position < valid_end)
+            {
+                // Valid ranges were written, so all of their blocks are allocated.
+                uint64_t block_index = position / kBaselineBlockSize;
+                auto     block       = baseline.blocks.find(block_index);
+                assert(block != baseline.blocks.end());
+
+                uint64_t block_offset = block_index * kBaselineBlockSize;
+                uint64_t chunk_end    = std::min(valid_end, block_offset + kBaselineBlockSize);
+
+                while (position < chunk_end)
+                {
+                    const uint8_t* current   = data + (position - offset);
+                    const uint8_t* previous  = block->second.get() + (position - block_offset);
+                    size_t         remaining = static_cast<size_t>(chunk_end - position);
+                    size_t         equal     = CountEqualBytes(current, previous, remaining);
+                    size_t         different =
+                        CountDifferentBytes(current + equal, previous + equal, remaining - equal);
+
+                    writer.Unchanged(equal);
+                    writer.Changed(different);
+                    position += equal + different;
+                }
+            }
+
+            ++valid_range;
+        }
+        else
+        {
+            uint64_t invalid_end = end;
+
+            if (valid_range != baseline.valid_ranges.end())
+            {
+                invalid_end = std::min(valid_range->first, end);
+            }
+
+            writer.Changed(invalid_end - position);
+            position = invalid_end;
+        }
+    }
+
+    bool success = writer.Finish(encoded_size);
+
+    StoreBaselineData(&baseline, offset, size, data);
+    AddValidRange(&baseline, offset, end);
+
+    return success;
+}
+
+void DeltaEncoder::RemoveBaseline(uint64_t memory_id)
+{
+    std::lock_guard<std::mutex> lock(baseline_lock_);
+    baselines_.erase(memory_id);
+}
+
+void DeltaEncoder::Clear()
+{
+    std::lock_guard<std::mutex> lock(baseline_lock_);
+    baselines_.clear();
+}
+
+size_t DeltaEncoder::GetBaselineSize()
+{
+    std::lock_guard<std::mutex> lock(baseline_lock_);
+
+    size_t block_count = 0;
+    for (const auto& entry : baselines_)
+    {
+        block_count += entry.second.blocks.size();
+    }
+
+    return block_count * kBaselineBlockSize;
+}
+
+void DeltaEncoder::StoreBaselineData(Baseline* baseline, uint64_t offset, size_t size, const uint8_t* data)
+{
+    assert(baseline != nullptr);
+
+    uint64_t position = offset;
+    uint64_t end      = offset + size;
+
+    while (position < end)
+    {
+        uint64_t block_index  = position / kBaselineBlockSize;
+        uint64_t block_offset = block_index * kBaselineBlockSize;
+        size_t   copy_size    = static_cast<size_t>(std::min(end, block_offset + kBaselineBlockSize) - position);
+        auto&    block        = baseline->blocks[block_index];
+
+        // Block contents are only read for valid ranges, so new blocks do not need to be initialized.
+        if (block == nullptr)
+        {
+            block = std::unique_ptr<uint8_t[]>(new uint8_t[kBaselineBlockSize]);
+        }
+
+        memcpy(block.get() + (position - block_offset), data + (position - offset), copy_size);
+        position += copy_size;
+    }
+}
+
+void DeltaEncoder::AddValidRange(Baseline* baseline, uint64_t begin, uint64_t end)
+{
+    assert(baseline != nullptr);
+
+    if (begin < end)
+    {
+        auto& valid_ranges = baseline->valid_ranges;
+        auto  next         = valid_ranges.upper_bound(begin);
+
+        // Merge with the ranges that overlap or are adjacent to the new range.
+        if ((next != valid_ranges.begin()) && (std::prev(next)->second >= begin))
+        {
+            auto previous = std::prev(next);
+            begin         = previous->first;
+            end           = std::max(end, previous->second);
+            valid_ranges.erase(previous);
+        }
+
+        while ((next != valid_ranges.end()) && (next->first <= end))
+        {
+            end  = std::max(end, next->second);
+            next = valid_ranges.erase(next);
+        }
+
+        valid_ranges.emplace_hint(next, begin, end);
+    }
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
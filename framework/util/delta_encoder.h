@@ -0,0 +1,153 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef GFXRECON_UTIL_DELTA_ENCODER_H
+#define GFXRECON_UTIL_DELTA_ENCODER_H
+
+#include "util/defines.h"
+
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Encodes writes to memory as the spans that differ from the data previously written to the same location, for memory
+// that is repeatedly rewritten with mostly identical content.  The encoded data is a sequence of spans, each consisting
+// of a SpanHeader followed by copy_size bytes of data.  The data of a span starts skip_size unchanged bytes after the
+// end of the previous span, or after the start of the encoded range for the first span.  Bytes after the last span are
+// unchanged.
+class DeltaEncoder
+{
+  public:
+    struct SpanHeader
+    {
+        uint32_t skip_size;
+        uint32_t copy_size;
+    };
+
+    // Unchanged runs shorter than this are included in the surrounding span, because they cost less to copy than the
+    // header of a new span.
+    static constexpr size_t kMinSkipSize = 2 * sizeof(SpanHeader);
+
+    // Baseline data is stored in blocks of this size, which are only allocated for the parts of a memory object that
+    // have been written.
+    static constexpr size_t kBaselineBlockSize = 16 * 1024;
+
+  public:
+    // Encodes a write of size bytes of data at offset within the memory object identified by memory_id, writing the
+    // encoded spans to encoded starting at encoded_offset.  Bytes that were not written by a previous call since the
+    // baseline was last removed are always encoded as changed.  Returns false if the encoded data would be larger than
+    // max_encoded_size, in which case the caller should write the data without delta encoding.  The baseline is updated
+    // with the new data in either case.  An encoded_size of 0 indicates that the data has not changed.
+    bool Encode(uint64_t              memory_id,
+                uint64_t              offset,
+                size_t                size,
+                const uint8_t*        data,
+                size_t                max_encoded_size,
+                std::vector<uint8_t>* encoded,
+                size_t                encoded_offset,
+                size_t*               encoded_size);
+
+    // Removes the data recorded for a memory object, which must be done when previously written offsets no longer
+    // refer to the same memory, such as when the memory is unmapped or freed.
+    void RemoveBaseline(uint64_t memory_id);
+
+    void Clear();
+
+    // Returns the size of the memory allocated for baseline data.
+    size_t GetBaselineSize();
+
+    // Invokes visitor(offset, size, data) for each span of encoded data, where offset is relative to the start of the
+    // encoded range.  Returns false if the encoded data is malformed or extends beyond range_size.
+    template <typename Visitor>
+    static bool VisitSpans(const uint8_t* encoded, size_t encoded_size, uint64_t range_size, Visitor visitor)
+    {
+        bool     success  = true;
+        size_t   position = 0;
+        uint64_t offset   = 0;
+
+        while (success && (position < encoded_size))
+        {
+            SpanHeader span;
+
+            if ((encoded_size - position) < sizeof(span))
+            {
+                success = false;
+            }
+            else
+            {
+                memcpy(&span, encoded + position, sizeof(span));
+                position += sizeof(span);
+                offset += span.skip_size;
+
+                if (((encoded_size - position) < span.copy_size) || (offset > range_size) ||
+                    ((range_size - offset) < span.copy_size))
+                {
+                    success = false;
+                }
+                else
+                {
+                    if (span.copy_size > 0)
+                    {
+                        visitor(offset, static_cast<size_t>(span.copy_size), encoded + position);
+                    }
+
+                    position += span.copy_size;
+                    offset += span.copy_size;
+                }
+            }
+        }
+
+        return success;
+    }
+
+  private:
+    struct Baseline
+    {
+        // Maps the index of each allocated block, which is its offset divided by kBaselineBlockSize, to its data.
+        std::unordered_map<uint64_t, std::unique_ptr<uint8_t[]>> blocks;
+
+        // Maps the start of each written range to its end.
+        std::map<uint64_t, uint64_t> valid_ranges;
+    };
+
+  private:
+    void AddValidRange(Baseline* baseline, uint64_t begin, uint64_t end);
+
+    void StoreBaselineData(Baseline* baseline, uint64_t offset, size_t size, const uint8_t* data);
+
+  private:
+    std::mutex                             baseline_lock_;
+    std::unordered_map<uint64_t, Baseline> baselines_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_DELTA_ENCODER_H
@@ -0,0 +1,304 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef GFXRECON_UTIL_DENSE_ID_MAP_H
+#define GFXRECON_UTIL_DENSE_ID_MAP_H
+
+#include "util/defines.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Maps IDs to values for IDs that are allocated from an increasing counter, such as capture handle IDs. IDs index a
+// paged array of pointers to the values, so lookups are two array reads with no hashing. Pages are freed when their
+// last ID is removed, so that memory use follows the live IDs rather than every ID ever issued. Values are stored in
+// fixed size chunks, so that pointers to them stay valid until they are removed. IDs that are too large for the paged
+// array fall back to a hash map. Iteration visits (id, value) pairs in slot order, and it is safe to remove entries
+// while iterating.
+template <typename T>
+class DenseIdMap
+{
+  public:
+    typedef std::pair<const uint64_t, T> Entry;
+
+  private:
+    typedef std::optional<Entry> Slot;
+
+    template <typename MapType, typename EntryType>
+    class IteratorBase
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = Entry;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = EntryType*;
+        using reference         = EntryType&;
+
+        IteratorBase(MapType* map, size_t index) : map_(map), index_(index) { SkipEmptySlots(); }
+
+        reference operator*() const { return *map_->GetSlot(index_); }
+        pointer   operator->() const { return &(*map_->GetSlot(index_)); }
+
+        IteratorBase& operator++()
+        {
+            ++index_;
+            SkipEmptySlots();
+            return *this;
+        }
+
+        bool operator==(const IteratorBase& other) const { return index_ == other.index_; }
+        bool operator!=(const IteratorBase& other) const { return index_ != other.index_; }
+
+      private:
+        void SkipEmptySlots()
+        {
+            while ((index_ < map_->slot_count_) && !map_->GetSlot(index_).has_value())
+            {
+                ++index_;
+            }
+        }
+
+      private:
+        MapType* map_;
+        size_t   index_;
+    };
+
+  public:
+    typedef IteratorBase<DenseIdMap, Entry>             iterator;
+    typedef IteratorBase<const DenseIdMap, const Entry> const_iterator;
+
+    // Adds a value for an ID that is not already in the map. Returns a pointer to the stored value, or nullptr without
+    // moving from the value if the ID is 0 or already in the map.
+    T* Insert(uint64_t id, T&& value)
+    {
+        if ((id == 0) || (FindSlot(id) != nullptr))
+        {
+            return nullptr;
+        }
+
+        Slot* slot = AllocateSlot();
+
+        slot->emplace(id, std::move(value));
+        SetSlot(id, slot);
+        ++size_;
+
+        return &(*slot)->second;
+    }
+
+    // Removes the value for an ID. Returns false if the ID is not in the map.
+    bool Remove(uint64_t id)
+    {
+        Slot* slot = FindSlot(id);
+
+        if (slot == nullptr)
+        {
+            return false;
+        }
+
+        slot->reset();
+        SetSlot(id, nullptr);
+        free_slots_.push_back(slot);
+        --size_;
+
+        return true;
+    }
+
+    // Returns a pointer to the value for an ID, or nullptr if the ID is not in the map.
+    T* Find(uint64_t id)
+    {
+        Slot* slot = FindSlot(id);
+        return (slot != nullptr) ? &(*slot)->second : nullptr;
+    }
+
+    const T* Find(uint64_t id) const
+    {
+        const Slot* slot = FindSlot(id);
+        return (slot != nullptr) ? &(*slot)->second : nullptr;
+    }
+
+    void Clear()
+    {
+        pages_.clear();
+        page_live_counts_.clear();
+        page_count_ = 0;
+        sparse_slots_.clear();
+        slot_chunks_.clear();
+        free_slots_.clear();
+        slot_count_ = 0;
+        size_       = 0;
+    }
+
+    size_t GetSize() const { return size_; }
+
+    // Returns the number of allocated pages of value pointers.
+    size_t GetPageCount() const { return page_count_; }
+
+    iterator       begin() { return iterator(this, 0); }
+    iterator       end() { return iterator(this, slot_count_); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, slot_count_); }
+
+  private:
+    // A page holds the value pointers of 1024 consecutive IDs.
+    static constexpr uint32_t kPageBits = 10;
+    static constexpr uint64_t kPageSize = uint64_t{ 1 } << kPageBits;
+    static constexpr uint64_t kPageMask = kPageSize - 1;
+
+    // IDs from this value up are stored in the hash map, limiting the page table to 256K entries.
+    static constexpr uint64_t kMaxDenseId = uint64_t{ 1 } << 28;
+
+    // Values are stored in chunks of 64 slots, so that the chunks of large info structures stay small.
+    static constexpr uint32_t kChunkBits = 6;
+    static constexpr uint32_t kChunkSize = uint32_t{ 1 } << kChunkBits;
+    static constexpr uint32_t kChunkMask = kChunkSize - 1;
+
+    Slot* FindSlot(uint64_t id) const
+    {
+        if (id < kMaxDenseId)
+        {
+            uint64_t page_index = id >> kPageBits;
+
+            if ((page_index < pages_.size()) && (pages_[page_index] != nullptr))
+            {
+                return pages_[page_index][id & kPageMask];
+            }
+        }
+        else
+        {
+            auto entry = sparse_slots_.find(id);
+
+            if (entry != sparse_slots_.end())
+            {
+                return entry->second;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void SetSlot(uint64_t id, Slot* slot)
+    {
+        if (id < kMaxDenseId)
+        {
+            size_t page_index = static_cast<size_t>(id >> kPageBits);
+
+            if (page_index >= pages_.size())
+            {
+                if (slot == nullptr)
+                {
+                    return;
+                }
+
+                pages_.resize(page_index + 1);
+                page_live_counts_.resize(page_index + 1, 0);
+            }
+
+            auto& page = pages_[page_index];
+
+            if (page == nullptr)
+            {
+                if (slot == nullptr)
+                {
+                    return;
+                }
+
+                page = std::make_unique<Slot*[]>(kPageSize);
+                ++page_count_;
+            }
+
+            Slot*& page_slot = page[id & kPageMask];
+
+            if ((page_slot == nullptr) && (slot != nullptr))
+            {
+                ++page_live_counts_[page_index];
+            }
+            else if ((page_slot != nullptr) && (slot == nullptr))
+            {
+                if (--page_live_counts_[page_index] == 0)
+                {
+                    // IDs are not reused, so an empty page is unlikely to be filled again.
+                    page.reset();
+                    --page_count_;
+                    return;
+                }
+            }
+
+            page_slot = slot;
+        }
+        else if (slot != nullptr)
+        {
+            sparse_slots_[id] = slot;
+        }
+        else
+        {
+            sparse_slots_.erase(id);
+        }
+    }
+
+    Slot* AllocateSlot()
+    {
+        if (!free_slots_.empty())
+        {
+            Slot* slot = free_slots_.back();
+            free_slots_.pop_back();
+            return slot;
+        }
+
+        if ((slot_count_ & kChunkMask) == 0)
+        {
+            slot_chunks_.emplace_back(std::make_unique<Slot[]>(kChunkSize));
+        }
+
+        return &GetSlot(slot_count_++);
+    }
+
+    Slot&       GetSlot(size_t slot_index) { return slot_chunks_[slot_index >> kChunkBits][slot_index & kChunkMask]; }
+    const Slot& GetSlot(size_t slot_index) const
+    {
+        return slot_chunks_[slot_index >> kChunkBits][slot_index & kChunkMask];
+    }
+
+  private:
+    std::vector<std::unique_ptr<Slot*[]>> pages_;
+    std::vector<uint32_t>                 page_live_counts_;
+    size_t                                page_count_{ 0 };
+    std::unordered_map<uint64_t, Slot*>   sparse_slots_;
+    std::vector<std::unique_ptr<Slot[]>>  slot_chunks_;
+    std::vector<Slot*>                    free_slots_;
+    size_t                                slot_count_{ 0 };
+    size_t                                size_{ 0 };
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_DENSE_ID_MAP_H
@@ -26,6 +26,8 @@
 #include "util/defines.h"
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -61,6 +63,59 @@ Type GenerateCheckSum(const uint8_t* code, size_t code_size)
     return current_sum;
 }
 
+/**
+ * @brief       GenerateContentHash creates a 64-bit hash-value for a block of memory.
+ *
+ * Implements MurmurHash64A, which processes the data eight bytes at a time and is suitable for identifying large
+ * blocks of data by content. Different seeds produce independent hash-values for the same data.
+ *
+ * @param   data    a pointer to the data to hash
+ * @param   size    the size of the data, in bytes
+ * @param   seed    a seed for the hash-value
+ * @return          a newly created hash-value for the data.
+ */
+inline uint64_t GenerateContentHash(const void* data, size_t size, uint64_t seed = 0)
+{
+    const uint64_t kMultiplier = 0xc6a4a7935bd1e995ULL;
+    const int      kShift      = 47;
+
+    const uint8_t* bytes      = reinterpret_cast<const uint8_t*>(data);
+    const size_t   word_count = size / sizeof(uint64_t);
+    uint64_t       hash       = seed ^ (size * kMultiplier);
+
+    for (size_t i = 0; i < word_count; ++i)
+    {
+        uint64_t word = 0;
+        std::memcpy(&word, bytes + (i * sizeof(uint64_t)), sizeof(uint64_t));
+
+        word *= kMultiplier;
+        word ^= word >> kShift;
+        word *= kMultiplier;
+
+        hash ^= word;
+        hash *= kMultiplier;
+    }
+
+    const uint8_t* tail      = bytes + (word_count * sizeof(uint64_t));
+    const size_t   tail_size = size & (sizeof(uint64_t) - 1);
+
+    if (tail_size > 0)
+    {
+        for (size_t i = 0; i < tail_size; ++i)
+        {
+            hash ^= static_cast<uint64_t>(tail[i]) << (i * 8);
+        }
+
+        hash *= kMultiplier;
+    }
+
+    hash ^= hash >> kShift;
+    hash *= kMultiplier;
+    hash ^= hash >> kShift;
+
+    return hash;
+}
+
 /**
  * @brief       hash_combine can be used to create a hash-value and combine with an existing hash-value.
  *
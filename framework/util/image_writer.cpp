@@ -44,14 +44,20 @@
 // use it in the STB PNG generation code.  Using the default STB PNG compression
 // resulted in a 20% reduction versus the original image in tests, while using the
 // zlib compress2 function resulted in a 40+% reduction versus the original image.
+// The compression level is fixed, rather than set through the global stbi_write_png_compression_level, as PNG files
+// may be written by multiple threads.
 uint8_t* GFXRECON_zlib_compress2(uint8_t* data, int32_t data_len, int32_t* out_len, int32_t quality)
 {
+    const int32_t kPngCompressionLevel = 4;
+
+    GFXRECON_UNREFERENCED_PARAMETER(quality);
+
     unsigned long alloc_len = compressBound(data_len);
     uint8_t*      target    = reinterpret_cast<uint8_t*>(malloc(alloc_len));
     if (nullptr != target)
     {
         unsigned long ret_len = alloc_len;
-        if (Z_OK == compress2(target, &ret_len, data, data_len, quality))
+        if (Z_OK == compress2(target, &ret_len, data, data_len, kPngCompressionLevel))
         {
             *out_len = ret_len;
             return target;
@@ -82,9 +88,6 @@ const uint32_t kImageBpp    = 4;  // Expecting 4 bytes per pixel for 32-bit BGRA
 const uint16_t kBmpBitCountNoAlpha = 24; // Expecting 24-bit BGR bitmap data.
 const uint32_t kImageBppNoAlpha    = 3;  // Expecting 3 bytes per pixel for 32-bit BGRA bitmap data; alpha removed.
 
-static std::unique_ptr<uint8_t[]> temporary_buffer;
-static size_t                     temporary_buffer_size = 0;
-
 #define CheckFwriteRetVal(_val_, _file_)                                                              \
     {                                                                                                 \
         if (!_val_)                                                                                   \
@@ -106,8 +109,9 @@ static const uint8_t* ConvertIntoTemporaryBuffer(uint32_t    width,
 {
     assert(data_pitch);
 
-    static std::unique_ptr<uint8_t[]> temporary_buffer;
-    static size_t                     temporary_buffer_size = 0;
+    // Images may be written concurrently by the threads of an ImageWriterQueue, so each thread has its own buffer.
+    thread_local std::unique_ptr<uint8_t[]> temporary_buffer;
+    thread_local size_t                     temporary_buffer_size = 0;
 
     uint32_t output_pitch = width * (write_alpha ? kImageBpp : kImageBppNoAlpha);
     if (!is_png)
@@ -455,8 +459,7 @@ bool WritePngImage(const std::string& filename,
 
     const uint8_t* bytes = ConvertIntoTemporaryBuffer(width, height, data, data_pitch, format, true, write_alpha);
 
-    stbi_write_png_compression_level = 4;
-    const uint32_t png_row_pitch     = width * (write_alpha ? kImageBpp : kImageBppNoAlpha);
+    const uint32_t png_row_pitch = width * (write_alpha ? kImageBpp : kImageBppNoAlpha);
 
     if (1 == stbi_write_png(
                  filename.c_str(), width, height, write_alpha ? kImageBpp : kImageBppNoAlpha, bytes, png_row_pitch))
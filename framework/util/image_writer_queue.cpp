@@ -0,0 +1,130 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/image_writer_queue.h"
+#include "util/logging.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// PNG encoding scales well with threads, but each pending image holds a full copy of its data.
+const size_t kMaxDefaultThreadCount = 8;
+
+ImageWriterQueue::ImageWriterQueue(size_t thread_count, size_t max_pending_writes) :
+    thread_count_(thread_count),
+    max_pending_writes_((max_pending_writes > 0) ? max_pending_writes : (2 * thread_count))
+{}
+
+ImageWriterQueue::~ImageWriterQueue()
+{
+    try
+    {
+        Flush();
+    }
+    catch (const std::exception& error)
+    {
+        GFXRECON_LOG_ERROR("Failed to write image file: %s", error.what());
+    }
+    catch (...)
+    {
+        GFXRECON_LOG_ERROR("Failed to write image file");
+    }
+}
+
+void ImageWriterQueue::Post(std::function<void()> write_function)
+{
+    if (thread_count_ == 0)
+    {
+        write_function();
+        return;
+    }
+
+    if (thread_pool_.numthreads() == 0)
+    {
+        thread_pool_.set_num_threads(thread_count_);
+    }
+
+    // Release completed writes, then wait for the oldest writes until there is room for another.
+    while (!pending_writes_.empty() &&
+           (pending_writes_.front().wait_for(std::chrono::seconds(0)) == std::future_status::ready))
+    {
+        RetireOldestWrite();
+    }
+
+    while (pending_writes_.size() >= max_pending_writes_)
+    {
+        RetireOldestWrite();
+    }
+
+    pending_writes_.emplace_back(thread_pool_.post(std::move(write_function)));
+}
+
+void ImageWriterQueue::Flush()
+{
+    // Wait for every write before rethrowing, so that no write is still running when the caller handles the error.
+    while (!pending_writes_.empty())
+    {
+        RetireOldestWrite();
+    }
+
+    if (write_error_ != nullptr)
+    {
+        std::exception_ptr error = write_error_;
+        write_error_             = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+void ImageWriterQueue::RetireOldestWrite()
+{
+    std::future<void> write = std::move(pending_writes_.front());
+    pending_writes_.pop_front();
+
+    try
+    {
+        write.get();
+    }
+    catch (...)
+    {
+        // Keep the first error for the next flush.
+        if (write_error_ == nullptr)
+        {
+            write_error_ = std::current_exception();
+        }
+    }
+}
+
+size_t ImageWriterQueue::GetDefaultThreadCount()
+{
+    size_t hardware_threads = std::thread::hardware_concurrency();
+
+    // Leave a thread for replay.
+    return std::clamp<size_t>((hardware_threads > 1) ? (hardware_threads - 1) : 1, 1, kMaxDefaultThreadCount);
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,80 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef GFXRECON_UTIL_IMAGE_WRITER_QUEUE_H
+#define GFXRECON_UTIL_IMAGE_WRITER_QUEUE_H
+
+#include "util/defines.h"
+#include "util/threadpool.h"
+
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Writes image files on worker threads, so that the format conversion, encoding, and file output of dumped images and
+// screenshots overlap with replay and with each other. The number of pending writes is limited, which bounds the
+// memory held by queued image data and blocks the queuing thread when the workers fall behind. Writes must be queued
+// from a single thread. An exception thrown by a write function on a worker thread is rethrown on the queuing thread by
+// the next Flush.
+class ImageWriterQueue
+{
+  public:
+    // Worker threads are started by the first write. With a thread_count of zero, images are written by the thread
+    // that queues them. A max_pending_writes of zero allows two pending writes per thread.
+    explicit ImageWriterQueue(size_t thread_count = GetDefaultThreadCount(), size_t max_pending_writes = 0);
+
+    // Waits for all queued writes to complete. Exceptions thrown by the writes are logged.
+    ~ImageWriterQueue();
+
+    // Queue a function that writes an image file. The function must hold its own copy or reference of the image data,
+    // as it may run after the caller's data has been released.
+    void Post(std::function<void()> write_function);
+
+    // Wait for all queued writes to complete. If any of the writes since the previous flush threw an exception, the first
+    // one is rethrown after all of the writes have completed.
+    void Flush();
+
+    size_t GetThreadCount() const { return thread_count_; }
+
+    static size_t GetDefaultThreadCount();
+
+  private:
+    void RetireOldestWrite();
+
+  private:
+    ThreadPool                    thread_pool_;
+    std::deque<std::future<void>> pending_writes_;
+    std::exception_ptr            write_error_;
+    size_t                        thread_count_;
+    size_t                        max_pending_writes_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_IMAGE_WRITER_QUEUE_H
@@ -0,0 +1,260 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_INTERVAL_TREE_H
+#define GFXRECON_UTIL_INTERVAL_TREE_H
+
+#include "util/defines.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Stores half-open [start, end) intervals, which may overlap, for visiting the intervals that intersect a query range
+// without scanning every interval. The intervals are kept in a treap ordered by start and value, with each node
+// tracking the largest end in its subtree so that subtrees that end before the query range can be skipped. Insertion,
+// removal, and queries take expected O(log n) time, plus O(m) to visit m intersecting intervals.
+template <typename Key, typename Value, typename Compare = std::less<Value>>
+class IntervalTree
+{
+  public:
+    IntervalTree() : size_(0), priority_state_(0x9e3779b97f4a7c15ull) {}
+
+    // Adds the interval [start, end) with the specified value. Empty intervals are not added. Each (start, value) pair
+    // is expected to be unique, as it identifies the interval for removal.
+    void Insert(Key start, Key end, const Value& value)
+    {
+        if (start < end)
+        {
+            NodePtr node(new Node(start, end, value, NextPriority()));
+
+            NodePtr left;
+            NodePtr right;
+            Split(std::move(root_), start, value, &left, &right);
+            root_ = Merge(Merge(std::move(left), std::move(node)), std::move(right));
+            ++size_;
+        }
+    }
+
+    // Removes the interval with the specified start and value. Returns false if there is no such interval.
+    bool Erase(Key start, const Value& value)
+    {
+        bool erased = Erase(&root_, start, value);
+        if (erased)
+        {
+            --size_;
+        }
+        return erased;
+    }
+
+    // Calls visitor(start, end, value) for each interval that intersects [start, end), in order of increasing start.
+    template <typename Visitor>
+    void VisitOverlapping(Key start, Key end, Visitor visitor) const
+    {
+        if (start < end)
+        {
+            VisitOverlapping(root_.get(), start, end, visitor);
+        }
+    }
+
+    void Clear()
+    {
+        root_.reset();
+        size_ = 0;
+    }
+
+    size_t GetSize() const { return size_; }
+
+    bool IsEmpty() const { return (size_ == 0); }
+
+  private:
+    struct Node;
+
+    typedef std::unique_ptr<Node> NodePtr;
+
+    struct Node
+    {
+        Node(Key node_start, Key node_end, const Value& node_value, uint64_t node_priority) :
+            start(node_start), end(node_end), max_end(node_end), value(node_value), priority(node_priority)
+        {}
+
+        Key      start;
+        Key      end;
+        Key      max_end;
+        Value    value;
+        uint64_t priority;
+        NodePtr  left;
+        NodePtr  right;
+    };
+
+  private:
+    // Deterministic priorities keep the tree shape, and therefore performance, reproducible between runs.
+    uint64_t NextPriority()
+    {
+        priority_state_ ^= priority_state_ << 13;
+        priority_state_ ^= priority_state_ >> 7;
+        priority_state_ ^= priority_state_ << 17;
+        return priority_state_;
+    }
+
+    static bool IsLess(Key start, const Value& value, const Node* node)
+    {
+        return (start < node->start) || (!(node->start < start) && Compare()(value, node->value));
+    }
+
+    static void Update(Node* node)
+    {
+        node->max_end = node->end;
+
+        if (node->left && (node->max_end < node->left->max_end))
+        {
+            node->max_end = node->left->max_end;
+        }
+
+        if (node->right && (node->max_end < node->right->max_end))
+        {
+            node->max_end = node->right->max_end;
+        }
+    }
+
+    // Splits the tree into the nodes that are ordered before (start, value) and the nodes that are not.
+    static void Split(NodePtr node, Key start, const Value& value, NodePtr* left, NodePtr* right)
+    {
+        if (!node)
+        {
+            left->reset();
+            right->reset();
+        }
+        else if (IsLess(start, value, node.get()))
+        {
+            NodePtr split_left;
+            Split(std::move(node->left), start, value, &split_left, &node->left);
+            Update(node.get());
+            (*left)  = std::move(split_left);
+            (*right) = std::move(node);
+        }
+        else
+        {
+            NodePtr split_right;
+            Split(std::move(node->right), start, value, &node->right, &split_right);
+            Update(node.get());
+            (*left)  = std::move(node);
+            (*right) = std::move(split_right);
+        }
+    }
+
+    // Merges two trees, where every node of the left tree is ordered before every node of the right tree.
+    static NodePtr Merge(NodePtr left, NodePtr right)
+    {
+        if (!left)
+        {
+            return right;
+        }
+
+        if (!right)
+        {
+            return left;
+        }
+
+        if (left->priority > right->priority)
+        {
+            left->right = Merge(std::move(left->right), std::move(right));
+            Update(left.get());
+            return left;
+        }
+
+        right->left = Merge(std::move(left), std::move(right->left));
+        Update(right.get());
+        return right;
+    }
+
+    static bool Erase(NodePtr* node, Key start, const Value& value)
+    {
+        if (!(*node))
+        {
+            return false;
+        }
+
+        bool erased = false;
+
+        if (IsLess(start, value, node->get()))
+        {
+            erased = Erase(&(*node)->left, start, value);
+        }
+        else if (((*node)->start < start) || Compare()((*node)->value, value))
+        {
+            erased = Erase(&(*node)->right, start, value);
+        }
+        else
+        {
+            NodePtr removed = std::move(*node);
+            (*node)         = Merge(std::move(removed->left), std::move(removed->right));
+            return true;
+        }
+
+        if (erased)
+        {
+            Update(node->get());
+        }
+
+        return erased;
+    }
+
+    template <typename Visitor>
+    static void VisitOverlapping(const Node* node, Key start, Key end, Visitor& visitor)
+    {
+        // Skip subtrees where every interval ends at or before the query start. Nodes to the right of a node that
+        // starts at or after the query end cannot intersect the query either.
+        while ((node != nullptr) && (start < node->max_end))
+        {
+            VisitOverlapping(node->left.get(), start, end, visitor);
+
+            if (!(node->start < end))
+            {
+                break;
+            }
+
+            if (start < node->end)
+            {
+                visitor(node->start, node->end, node->value);
+            }
+
+            node = node->right.get();
+        }
+    }
+
+  private:
+    NodePtr  root_;
+    size_t   size_;
+    uint64_t priority_state_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_INTERVAL_TREE_H
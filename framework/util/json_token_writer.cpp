@@ -0,0 +1,385 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/json_token_writer.h"
+#include "util/logging.h"
+
+#include <charconv>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+void JsonValue::AssignInteger(int64_t value)
+{
+    if ((writer_ != nullptr) && writer_->BeginAssign(*this))
+    {
+        char buffer[24];
+        auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        writer_->output_->append(buffer, result.ptr);
+        state_ = State::kComplete;
+    }
+}
+
+void JsonValue::AssignInteger(uint64_t value)
+{
+    if ((writer_ != nullptr) && writer_->BeginAssign(*this))
+    {
+        char buffer[24];
+        auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        writer_->output_->append(buffer, result.ptr);
+        state_ = State::kComplete;
+    }
+}
+
+JsonValue& JsonValue::operator=(std::nullptr_t)
+{
+    if ((writer_ != nullptr) && writer_->BeginAssign(*this))
+    {
+        writer_->output_->append("null");
+        state_ = State::kComplete;
+    }
+    return *this;
+}
+
+JsonValue& JsonValue::operator=(bool value)
+{
+    if ((writer_ != nullptr) && writer_->BeginAssign(*this))
+    {
+        writer_->output_->append(value ? "true" : "false");
+        state_ = State::kComplete;
+    }
+    return *this;
+}
+
+JsonValue& JsonValue::operator=(double value)
+{
+    if ((writer_ != nullptr) && writer_->BeginAssign(*this))
+    {
+        writer_->WriteNumber(value);
+        state_ = State::kComplete;
+    }
+    return *this;
+}
+
+JsonValue& JsonValue::operator=(const char* value)
+{
+    return operator=(std::string_view(value));
+}
+
+JsonValue& JsonValue::operator=(std::string_view value)
+{
+    if ((writer_ != nullptr) && writer_->BeginAssign(*this))
+    {
+        writer_->WriteString(value);
+        state_ = State::kComplete;
+    }
+    return *this;
+}
+
+void JsonValue::AssignTree(const nlohmann::ordered_json& value)
+{
+    if ((writer_ != nullptr) && writer_->BeginAssign(*this))
+    {
+        if (value.empty() && (value.is_object() || value.is_array()))
+        {
+            // Like an empty container assigned to a tree, it can have members or elements added to it afterwards.
+            writer_->Open(*this, value.is_object() ? State::kObject : State::kArray);
+        }
+        else
+        {
+            writer_->WriteTree(*this, value);
+            state_ = State::kComplete;
+        }
+    }
+}
+
+JsonValue& JsonTokenWriter::Begin(std::string* output, int indent)
+{
+    GFXRECON_ASSERT(output != nullptr);
+
+    End();
+
+    output_      = output;
+    indent_      = indent;
+    values_used_ = 0;
+    root_        = &NewValue(0);
+
+    return *root_;
+}
+
+void JsonTokenWriter::End()
+{
+    if (output_ != nullptr)
+    {
+        while (open_count_ > 0)
+        {
+            CloseLast();
+        }
+
+        if (root_->state_ == JsonValue::State::kPending)
+        {
+            output_->append("null");
+            root_->state_ = JsonValue::State::kComplete;
+        }
+
+        output_ = nullptr;
+        root_   = nullptr;
+    }
+}
+
+JsonValue& JsonTokenWriter::GetMember(JsonValue& value, std::string_view key)
+{
+    if (value.state_ == JsonValue::State::kObject)
+    {
+        Container& container = containers_[value.depth_];
+        if ((container.size > 0) && (container.last_key == key))
+        {
+            if (container.last_child->state_ != JsonValue::State::kComplete)
+            {
+                return *container.last_child;
+            }
+            return Discard("an object member was written twice");
+        }
+        CloseAbove(value.depth_);
+    }
+    else if (value.state_ == JsonValue::State::kPending)
+    {
+        Open(value, JsonValue::State::kObject);
+    }
+    else
+    {
+        return Discard("a member was added to a value that is not an open object");
+    }
+
+    Container& container = containers_[value.depth_];
+    CloseChild(container);
+    WriteSeparator(container, value.depth_);
+    WriteString(key);
+    output_->append((indent_ < 0) ? ":" : ": ");
+    container.last_key.assign(key.data(), key.size());
+
+    return AddChild(container, value.depth_ + 1);
+}
+
+JsonValue& JsonTokenWriter::GetElement(JsonValue& value, size_t index)
+{
+    if (value.state_ == JsonValue::State::kArray)
+    {
+        Container& container = containers_[value.depth_];
+        if ((container.size > 0) && (index == container.size - 1) &&
+            (container.last_child->state_ != JsonValue::State::kComplete))
+        {
+            return *container.last_child;
+        }
+        else if (index < container.size)
+        {
+            return Discard("an array element was accessed after a later element");
+        }
+        CloseAbove(value.depth_);
+    }
+    else if (value.state_ == JsonValue::State::kPending)
+    {
+        Open(value, JsonValue::State::kArray);
+    }
+    else
+    {
+        return Discard("an element was added to a value that is not an open array");
+    }
+
+    Container& container = containers_[value.depth_];
+    CloseChild(container);
+
+    // Indexing past the end of an array fills the gap with nulls.
+    while (container.size < index)
+    {
+        WriteSeparator(container, value.depth_);
+        output_->append("null");
+        ++container.size;
+    }
+
+    WriteSeparator(container, value.depth_);
+
+    return AddChild(container, value.depth_ + 1);
+}
+
+bool JsonTokenWriter::BeginAssign(const JsonValue& value)
+{
+    // A pending value is always the last child of the innermost open container, or the top-level value.
+    if (value.state_ != JsonValue::State::kPending)
+    {
+        Discard("a value was assigned to a value that was already written");
+        return false;
+    }
+    return true;
+}
+
+JsonValue& JsonTokenWriter::NewValue(uint32_t depth)
+{
+    if (values_used_ == values_.size())
+    {
+        values_.emplace_back(this);
+    }
+
+    JsonValue& value = values_[values_used_++];
+    value.depth_     = depth;
+    value.state_     = JsonValue::State::kPending;
+    return value;
+}
+
+JsonValue& JsonTokenWriter::AddChild(Container& container, uint32_t depth)
+{
+    JsonValue& child     = NewValue(depth);
+    container.last_child = &child;
+    ++container.size;
+    return child;
+}
+
+void JsonTokenWriter::Open(JsonValue& value, JsonValue::State state)
+{
+    GFXRECON_ASSERT(open_count_ == value.depth_);
+
+    if (containers_.size() <= value.depth_)
+    {
+        containers_.resize(value.depth_ + 1);
+    }
+
+    Container& container = containers_[value.depth_];
+    container.value      = &value;
+    container.last_child = nullptr;
+    container.size       = 0;
+
+    output_->push_back((state == JsonValue::State::kObject) ? '{' : '[');
+    value.state_ = state;
+    ++open_count_;
+}
+
+void JsonTokenWriter::CloseAbove(uint32_t depth)
+{
+    while (open_count_ > depth + 1)
+    {
+        CloseLast();
+    }
+}
+
+void JsonTokenWriter::CloseLast()
+{
+    const uint32_t depth     = open_count_ - 1;
+    Container&     container = containers_[depth];
+    CloseChild(container);
+
+    if ((container.size > 0) && (indent_ >= 0))
+    {
+        output_->push_back('\n');
+        output_->append(static_cast<size_t>(depth) * indent_, ' ');
+    }
+
+    output_->push_back((container.value->state_ == JsonValue::State::kObject) ? '}' : ']');
+    container.value->state_ = JsonValue::State::kComplete;
+    --open_count_;
+}
+
+void JsonTokenWriter::CloseChild(Container& container)
+{
+    if ((container.size > 0) && (container.last_child->state_ == JsonValue::State::kPending))
+    {
+        output_->append("null");
+        container.last_child->state_ = JsonValue::State::kComplete;
+    }
+}
+
+void JsonTokenWriter::WriteSeparator(const Container& container, uint32_t depth)
+{
+    if (container.size > 0)
+    {
+        output_->push_back(',');
+    }
+
+    if (indent_ >= 0)
+    {
+        output_->push_back('\n');
+        output_->append(static_cast<size_t>(depth + 1) * indent_, ' ');
+    }
+}
+
+void JsonTokenWriter::WriteString(std::string_view value)
+{
+    bool plain = true;
+    for (const char c : value)
+    {
+        if ((c < 0x20) || (c > 0x7e) || (c == '"') || (c == '\\'))
+        {
+            plain = false;
+            break;
+        }
+    }
+
+    if (plain)
+    {
+        output_->push_back('"');
+        output_->append(value.data(), value.size());
+        output_->push_back('"');
+    }
+    else
+    {
+        // Leave escaping and UTF-8 validation to the JSON library so that the text and errors match it exactly.
+        output_->append(nlohmann::ordered_json(std::string(value)).dump());
+    }
+}
+
+void JsonTokenWriter::WriteNumber(double value)
+{
+    // Floating point formatting is left to the JSON library so that the text matches it exactly.
+    output_->append(nlohmann::ordered_json(value).dump());
+}
+
+void JsonTokenWriter::WriteTree(const JsonValue& value, const nlohmann::ordered_json& tree)
+{
+    const std::string text = tree.dump(indent_);
+
+    if ((indent_ <= 0) || (value.depth_ == 0))
+    {
+        output_->append(text);
+    }
+    else
+    {
+        // The tree is dumped as if it were at the top level, so indent its lines to the depth of the value.
+        const size_t indent = static_cast<size_t>(value.depth_) * indent_;
+        for (const char c : text)
+        {
+            output_->push_back(c);
+            if (c == '\n')
+            {
+                output_->append(indent, ' ');
+            }
+        }
+    }
+}
+
+JsonValue& JsonTokenWriter::Discard(const char* error)
+{
+    GFXRECON_LOG_ERROR_ONCE("JSON output is incomplete because %s.", error);
+    return discard_;
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
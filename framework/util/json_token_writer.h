@@ -0,0 +1,204 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+/// @file Write JSON tokens straight to an output string as a value is populated, without building a document tree.
+
+#ifndef GFXRECON_UTIL_JSON_TOKEN_WRITER_H
+#define GFXRECON_UTIL_JSON_TOKEN_WRITER_H
+
+#include "util/defines.h"
+
+#include "nlohmann/json.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+class JsonTokenWriter;
+
+/// A JSON value that is written out by a JsonTokenWriter as soon as it is populated. It supports the subset of the
+/// nlohmann::ordered_json interface used by the FieldToJson functions, and produces the same text as dumping the
+/// equivalent tree, provided that values are populated in document order:
+///  - Members and elements are written in the order they are first accessed. Accessing the most recently added member
+///    or element again returns the same value, so nested values can be populated across several statements.
+///  - A member or element that is accessed but never assigned is written as null, as is every element skipped over by
+///    indexing an array past its end.
+///  - A value is complete once one of its siblings or ancestors' siblings is accessed. Writing to a complete value,
+///    assigning to a value that already holds an object or array, or indexing a value of the wrong type is an error
+///    that is logged, and the write is discarded.
+class JsonValue
+{
+  public:
+    /// Values are created by a JsonTokenWriter. A value with no writer silently discards everything written to it.
+    explicit JsonValue(JsonTokenWriter* writer = nullptr) : writer_(writer) {}
+
+    JsonValue(const JsonValue&) = delete;
+    JsonValue& operator=(const JsonValue&) = delete;
+
+    /// Get the member of this object with the given key, making this value an object if it has not been populated.
+    JsonValue& operator[](std::string_view key);
+
+    /// Get the element of this array with the given index, making this value an array if it has not been populated.
+    JsonValue& operator[](size_t index);
+
+    JsonValue& operator=(std::nullptr_t);
+    JsonValue& operator=(bool value);
+    JsonValue& operator=(float value) { return operator=(static_cast<double>(value)); }
+    JsonValue& operator=(double value);
+    JsonValue& operator=(const char* value);
+    JsonValue& operator=(std::string_view value);
+    JsonValue& operator=(const std::string& value) { return operator=(std::string_view(value)); }
+
+    template <typename T,
+              typename std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value, int> = 0>
+    JsonValue& operator=(T value)
+    {
+        if (std::is_signed<T>::value)
+        {
+            AssignInteger(static_cast<int64_t>(value));
+        }
+        else
+        {
+            AssignInteger(static_cast<uint64_t>(value));
+        }
+        return *this;
+    }
+
+    template <typename T, typename std::enable_if_t<std::is_enum<T>::value, int> = 0>
+    JsonValue& operator=(T value)
+    {
+        return operator=(static_cast<std::underlying_type_t<T>>(value));
+    }
+
+    /// Write a tree built in memory as this value. An empty object or array is left open to be populated further.
+    template <typename T, typename std::enable_if_t<std::is_same<T, nlohmann::ordered_json>::value, int> = 0>
+    JsonValue& operator=(const T& value)
+    {
+        AssignTree(value);
+        return *this;
+    }
+
+  private:
+    friend class JsonTokenWriter;
+
+    enum class State : uint8_t
+    {
+        kPending,
+        kObject,
+        kArray,
+        kComplete
+    };
+
+    void AssignInteger(int64_t value);
+    void AssignInteger(uint64_t value);
+    void AssignTree(const nlohmann::ordered_json& value);
+
+  private:
+    JsonTokenWriter* writer_;
+    uint32_t         depth_{ 0 };
+    State            state_{ State::kPending };
+};
+
+/// Writes a single top-level JsonValue at a time to an output string, formatted like nlohmann::ordered_json::dump().
+class JsonTokenWriter
+{
+  public:
+    JsonTokenWriter() = default;
+
+    JsonTokenWriter(const JsonTokenWriter&) = delete;
+    JsonTokenWriter& operator=(const JsonTokenWriter&) = delete;
+
+    /// Start writing a top-level value, appending its text to output. As with dump(), a negative indent selects the
+    /// compact form and any other indent pretty prints with that many spaces per level. Any value that is still open
+    /// is ended first.
+    /// @return The top-level value, valid until End() is called.
+    JsonValue& Begin(std::string* output, int indent);
+
+    /// Close all open objects and arrays of the top-level value, writing null for any value never assigned.
+    void End();
+
+  private:
+    friend class JsonValue;
+
+    struct Container
+    {
+        JsonValue*  value{ nullptr };
+        JsonValue*  last_child{ nullptr };
+        size_t      size{ 0 };
+        std::string last_key;
+    };
+
+    JsonValue& GetMember(JsonValue& value, std::string_view key);
+    JsonValue& GetElement(JsonValue& value, size_t index);
+
+    /// Check that a scalar or tree can be written as value, logging an error if not.
+    bool BeginAssign(const JsonValue& value);
+
+    JsonValue& NewValue(uint32_t depth);
+    JsonValue& AddChild(Container& container, uint32_t depth);
+    void       Open(JsonValue& value, JsonValue::State state);
+    void       CloseAbove(uint32_t depth);
+    void       CloseLast();
+    void       CloseChild(Container& container);
+    void       WriteSeparator(const Container& container, uint32_t depth);
+    void       WriteString(std::string_view value);
+    void       WriteNumber(double value);
+    void       WriteTree(const JsonValue& value, const nlohmann::ordered_json& tree);
+    JsonValue& Discard(const char* error);
+
+  private:
+    std::string* output_{ nullptr };
+    int          indent_{ -1 };
+    JsonValue*   root_{ nullptr };
+    /// Values handed out for the current top-level value. They are reused by later top-level values so that their
+    /// addresses, which callers hold references to, stay stable without allocating per value.
+    std::deque<JsonValue> values_;
+    size_t                values_used_{ 0 };
+    /// The objects and arrays currently open, indexed by depth. Entries beyond open_count_ are kept for reuse.
+    std::vector<Container> containers_;
+    uint32_t               open_count_{ 0 };
+    /// Returned instead of a value that cannot be written, to absorb the rest of an erroneous write.
+    JsonValue discard_;
+};
+
+inline JsonValue& JsonValue::operator[](std::string_view key)
+{
+    return (writer_ != nullptr) ? writer_->GetMember(*this, key) : *this;
+}
+
+inline JsonValue& JsonValue::operator[](size_t index)
+{
+    return (writer_ != nullptr) ? writer_->GetElement(*this, index) : *this;
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_JSON_TOKEN_WRITER_H
@@ -42,22 +42,22 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
-void FieldToJson(nlohmann::ordered_json& jdata, const float data[4], const util::JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const float data[4], const util::JsonOptions& options)
 {
     FieldToJson(jdata, data, 4, options);
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const uint32_t data[4], const util::JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const uint32_t data[4], const util::JsonOptions& options)
 {
     FieldToJson(jdata, data, 4, options);
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const uint64_t data[4], const util::JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const uint64_t data[4], const util::JsonOptions& options)
 {
     FieldToJson(jdata, data, 4, options);
 }
 
-void HandleToJson(nlohmann::ordered_json& jdata, const format::HandleId handle, const JsonOptions& options)
+void HandleToJson(JsonValue& jdata, const format::HandleId handle, const JsonOptions& options)
 {
     if (options.hex_handles)
     {
@@ -71,10 +71,7 @@ void HandleToJson(nlohmann::ordered_json& jdata, const format::HandleId handle,
     }
 }
 
-void HandleToJson(nlohmann::ordered_json& jdata,
-                  const format::HandleId* data,
-                  size_t                  num_elements,
-                  const JsonOptions&      options)
+void HandleToJson(JsonValue& jdata, const format::HandleId* data, size_t num_elements, const JsonOptions& options)
 {
     if (data)
     {
@@ -93,57 +90,57 @@ void HandleToJson(nlohmann::ordered_json& jdata,
 // library hidden in the assignments so we can give the inlining of that code a
 // natural place to stop right here.
 
-void Bool32ToJson(nlohmann::ordered_json& jdata, const uint32_t& data, const util::JsonOptions& options)
+void Bool32ToJson(JsonValue& jdata, const uint32_t& data, const util::JsonOptions& options)
 {
     jdata = static_cast<bool>(data);
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const short& data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const short& data, const JsonOptions& options)
 {
     jdata = data;
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const int& data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const int& data, const JsonOptions& options)
 {
     jdata = data;
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const long& data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const long& data, const JsonOptions& options)
 {
     jdata = data;
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const long long& data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const long long& data, const JsonOptions& options)
 {
     jdata = data;
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const unsigned short& data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const unsigned short& data, const JsonOptions& options)
 {
     jdata = data;
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const unsigned int& data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const unsigned int& data, const JsonOptions& options)
 {
     jdata = data;
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const unsigned long& data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const unsigned long& data, const JsonOptions& options)
 {
     jdata = data;
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const unsigned long long& data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const unsigned long long& data, const JsonOptions& options)
 {
     jdata = data;
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const std::nullptr_t data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const std::nullptr_t data, const JsonOptions& options)
 {
     jdata = data;
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, float data, const JsonOptions& options)
+void FieldToJson(JsonValue& jdata, float data, const JsonOptions& options)
 {
     if (std::isnan(data))
     {
@@ -167,17 +164,17 @@ void FieldToJson(nlohmann::ordered_json& jdata, float data, const JsonOptions& o
     jdata = data;
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, double data, const util::JsonOptions& options)
+void FieldToJson(JsonValue& jdata, double data, const util::JsonOptions& options)
 {
     jdata = data;
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const std::string_view data, const util::JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const std::string_view data, const util::JsonOptions& options)
 {
     jdata = data;
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const std::wstring_view data, const util::JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const std::wstring_view data, const util::JsonOptions& options)
 {
 #if defined(__clang__)
 #pragma clang diagnostic push
@@ -270,12 +267,12 @@ std::string HresultToString(const HRESULT hresult)
     return result;
 }
 
-void HresultToJson(nlohmann::ordered_json& jdata, const HRESULT hresult, const util::JsonOptions& options)
+void HresultToJson(JsonValue& jdata, const HRESULT hresult, const util::JsonOptions& options)
 {
     FieldToJson(jdata, HresultToString(hresult), options);
 }
 
-void FieldToJson(nlohmann::ordered_json&                                  jdata,
+void FieldToJson(JsonValue&                                               jdata,
                  const format::InitDx12AccelerationStructureGeometryDesc& data,
                  const util::JsonOptions&                                 options)
 {
@@ -293,7 +290,7 @@ void FieldToJson(nlohmann::ordered_json&                                  jdata,
     FieldToJson(jdata["triangles_vertex_stride"], data.triangles_vertex_stride, options);
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const format::DxgiAdapterDesc& data, const util::JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const format::DxgiAdapterDesc& data, const util::JsonOptions& options)
 {
     FieldToJson(jdata["Description"], std::wstring_view(data.Description), options);
     FieldToJson(jdata["VendorId"], data.VendorId, options);
@@ -309,13 +306,13 @@ void FieldToJson(nlohmann::ordered_json& jdata, const format::DxgiAdapterDesc& d
     FieldToJson(jdata["extra_info"], data.extra_info, options);
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const format::Dx12RuntimeInfo& data, const util::JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const format::Dx12RuntimeInfo& data, const util::JsonOptions& options)
 {
     FieldToJson(jdata["version"], data.version, util::filepath::kFileVersionSize, options);
     FieldToJson(jdata["src"], util::strings::ViewOfCharArray(data.src, util::filepath::kMaxFilePropertySize), options);
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const util::filepath::FileInfo& data, const util::JsonOptions& options)
+void FieldToJson(JsonValue& jdata, const util::filepath::FileInfo& data, const util::JsonOptions& options)
 {
     FieldToJson(jdata["ProductVersion"],
                 strings::ViewOfCharArray(data.ProductVersion, filepath::kMaxFilePropertySize),
@@ -367,7 +364,7 @@ static bool WriteBinaryFile(const std::string& filename, uint64_t data_size, con
 }
 
 bool RepresentBinaryFile(const util::JsonOptions& json_options,
-                         nlohmann::ordered_json&  jdata,
+                         JsonValue&               jdata,
                          std::string_view         filename_base,
                          const uint64_t           instance_counter,
                          const uint64_t           data_size,
@@ -29,6 +29,7 @@
 #define GFXRECON_UTIL_JSON_UTIL_H
 
 #include "util/defines.h"
+#include "util/json_token_writer.h"
 #include "util/to_string.h"
 #include "util/logging.h"
 #include "format/format.h"
@@ -47,7 +48,7 @@ static constexpr int kJsonIndentWidth = 2;
 /// This selects between outputting an array of objects (JSON) or individual
 /// top-level objects separated by newlines (JSONL). A top-level component
 /// like Convert's main() needs to look at this but the FieldToJson functions
-/// ignore it. They build a nlohmann tree in memory.
+/// ignore it. They write to a JsonValue as they go.
 enum class JsonFormat : uint8_t
 {
     JSON,
@@ -95,41 +96,35 @@ struct JsonOptions
     bool        hex_handles   = false;
 };
 
-void FieldToJson(nlohmann::ordered_json& jdata, const short& data, const JsonOptions& options = JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const int& data, const JsonOptions& options = JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const long& data, const JsonOptions& options = JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const long long& data, const JsonOptions& options = JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const unsigned short& data, const JsonOptions& options = JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const unsigned int& data, const JsonOptions& options = JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const unsigned long& data, const JsonOptions& options = JsonOptions());
-void FieldToJson(nlohmann::ordered_json&   jdata,
-                 const unsigned long long& data,
-                 const JsonOptions&        options = JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const std::nullptr_t data, const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonValue& jdata, const short& data, const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonValue& jdata, const int& data, const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonValue& jdata, const long& data, const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonValue& jdata, const long long& data, const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonValue& jdata, const unsigned short& data, const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonValue& jdata, const unsigned int& data, const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonValue& jdata, const unsigned long& data, const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonValue& jdata, const unsigned long long& data, const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonValue& jdata, const std::nullptr_t data, const JsonOptions& options = JsonOptions());
 /// Convert floats to JSON, logging information loss when floats with no JSON
 /// number type representation are adjusted. The JSON library turns these numbers
 /// into JSON nulls otherwise.
-void FieldToJson(nlohmann::ordered_json& jdata, float data, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(JsonValue& jdata, float data, const util::JsonOptions& options = util::JsonOptions());
 /// @note This is unused dead code currently (try placing a breakpoint on it).
-void FieldToJson(nlohmann::ordered_json& jdata, double data, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json&  jdata,
-                 const std::string_view   data,
-                 const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json&  jdata,
+void FieldToJson(JsonValue& jdata, double data, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(JsonValue& jdata, const std::string_view data, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(JsonValue&               jdata,
                  const std::wstring_view  data,
                  const util::JsonOptions& options = util::JsonOptions());
 
 /// @brief Convert the integer representation of a handle in capture files into
 /// either a JSON number or a JSON string with the number represented in
 /// hexadecimal.
-void HandleToJson(nlohmann::ordered_json& jdata, const format::HandleId handle, const JsonOptions& options);
+void HandleToJson(JsonValue& jdata, const format::HandleId handle, const JsonOptions& options);
 
 /// @brief  Convert a bool represented as a 32 bit unsigned number like a
 /// VkBool32 to true or false. It should be fine for the signed Windows type
 /// BOOL too.
-void Bool32ToJson(nlohmann::ordered_json&  jdata,
-                  const uint32_t&          data,
-                  const util::JsonOptions& options = util::JsonOptions());
+void Bool32ToJson(JsonValue& jdata, const uint32_t& data, const util::JsonOptions& options = util::JsonOptions());
 
 /// @brief Convert an integer type to JSON but encoded in hex as a JSON string
 /// rather than as a JSON number type. Useful for pointers and memory offsets.
@@ -141,9 +136,7 @@ void Bool32ToJson(nlohmann::ordered_json&  jdata,
 /// depending on switching on a parameter value) and should only be done if it
 /// simplifies codegen, removing special cases for the classes of types.
 template <typename T>
-void FieldToJsonAsHex(nlohmann::ordered_json&  jdata,
-                      const T                  data,
-                      const util::JsonOptions& options = util::JsonOptions())
+void FieldToJsonAsHex(JsonValue& jdata, const T data, const util::JsonOptions& options = util::JsonOptions())
 {
     jdata = to_hex_variable_width(data);
 }
@@ -151,7 +144,7 @@ void FieldToJsonAsHex(nlohmann::ordered_json&  jdata,
 /// @brief Convert an integer type to JSON but encoded in binary as a JSON string
 /// rather than as a JSON number type. Useful for bitmasks.
 template <typename T>
-void FieldToJsonAsFixedWidthBinary(nlohmann::ordered_json&  jdata,
+void FieldToJsonAsFixedWidthBinary(JsonValue&               jdata,
                                    const T                  data,
                                    const util::JsonOptions& options = util::JsonOptions())
 {
@@ -159,7 +152,7 @@ void FieldToJsonAsFixedWidthBinary(nlohmann::ordered_json&  jdata,
 }
 
 template <typename T>
-void FieldToJson(nlohmann::ordered_json&  jdata,
+void FieldToJson(JsonValue&               jdata,
                  const T*                 data,
                  size_t                   num_elements,
                  const util::JsonOptions& options = util::JsonOptions())
@@ -177,19 +170,13 @@ void FieldToJson(nlohmann::ordered_json&  jdata,
     }
 }
 
-void FieldToJson(nlohmann::ordered_json&  jdata,
-                 const float              data[4],
-                 const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(JsonValue& jdata, const float data[4], const util::JsonOptions& options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&  jdata,
-                 const uint32_t           data[4],
-                 const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(JsonValue& jdata, const uint32_t data[4], const util::JsonOptions& options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&  jdata,
-                 const uint64_t           data[4],
-                 const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(JsonValue& jdata, const uint64_t data[4], const util::JsonOptions& options = util::JsonOptions());
 
-void HandleToJson(nlohmann::ordered_json&  jdata,
+void HandleToJson(JsonValue&               jdata,
                   const format::HandleId*  data,
                   size_t                   num_elements,
                   const util::JsonOptions& options = util::JsonOptions());
@@ -200,21 +187,21 @@ void HandleToJson(nlohmann::ordered_json&  jdata,
 /// winerror.h.
 /// @param hresult A D3D12 or DXGI result code.
 std::string HresultToString(const HRESULT hresult);
-void        HresultToJson(nlohmann::ordered_json& jdata, const HRESULT hresult, const util::JsonOptions& options);
+void        HresultToJson(JsonValue& jdata, const HRESULT hresult, const util::JsonOptions& options);
 
-void FieldToJson(nlohmann::ordered_json&                                  jdata,
+void FieldToJson(JsonValue&                                               jdata,
                  const format::InitDx12AccelerationStructureGeometryDesc& data,
                  const util::JsonOptions&                                 options);
-void FieldToJson(nlohmann::ordered_json& jdata, const format::DxgiAdapterDesc& data, const util::JsonOptions& options);
-void FieldToJson(nlohmann::ordered_json& jdata, const format::Dx12RuntimeInfo& data, const util::JsonOptions& options);
-void FieldToJson(nlohmann::ordered_json& jdata, const util::filepath::FileInfo& data, const util::JsonOptions& options);
+void FieldToJson(JsonValue& jdata, const format::DxgiAdapterDesc& data, const util::JsonOptions& options);
+void FieldToJson(JsonValue& jdata, const format::Dx12RuntimeInfo& data, const util::JsonOptions& options);
+void FieldToJson(JsonValue& jdata, const util::filepath::FileInfo& data, const util::JsonOptions& options);
 #endif
 
 /// @brief Represent a binary blob in the JSON tree either as the filename of a file containing the data that is also
 /// written, or as placeholder text with the binary file not written, depending on the JsonOptions in effect.
 /// @return true if a binary file was written to storage, false if not.
 bool RepresentBinaryFile(const util::JsonOptions& json_options,
-                         nlohmann::ordered_json&  jdata,
+                         JsonValue&               jdata,
                          std::string_view         filename_base,
                          const uint64_t           instance_counter,
                          const uint64_t           data_size,
@@ -29,9 +29,15 @@
 
 #include "lz4.h"
 
+#include <algorithm>
+#include <memory>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
+// Per-thread compression state, which is heap allocated because it is too large to be placed in thread local storage.
+static thread_local std::unique_ptr<LZ4_stream_t> thread_state;
+
 size_t Lz4Compressor::Compress(const size_t          uncompressed_size,
                                const uint8_t*        uncompressed_data,
                                std::vector<uint8_t>* compressed_data,
@@ -51,12 +57,20 @@ size_t Lz4Compressor::Compress(const size_t          uncompressed_size,
         compressed_data->resize(compressed_data_offset + lz4_compressed_size);
     }
 
+    if (thread_state == nullptr)
+    {
+        thread_state = std::make_unique<LZ4_stream_t>();
+    }
+
+    // Negative levels select an acceleration factor, trading compression ratio for speed. The default acceleration
+    // factor of 1 was historically used for all captures.
     int compressed_size_generated =
-        LZ4_compress_fast(reinterpret_cast<const char*>(uncompressed_data),
-                          reinterpret_cast<char*>(compressed_data->data() + compressed_data_offset),
-                          static_cast<const int32_t>(uncompressed_size),
-                          static_cast<int32_t>(lz4_compressed_size),
-                          1);
+        LZ4_compress_fast_extState(thread_state.get(),
+                                   reinterpret_cast<const char*>(uncompressed_data),
+                                   reinterpret_cast<char*>(compressed_data->data() + compressed_data_offset),
+                                   static_cast<const int32_t>(uncompressed_size),
+                                   static_cast<int32_t>(lz4_compressed_size),
+                                   std::max(-compression_level_, 1));
 
     if (compressed_size_generated > 0)
     {
@@ -66,20 +80,20 @@ size_t Lz4Compressor::Compress(const size_t          uncompressed_size,
     return data_size;
 }
 
-size_t Lz4Compressor::Decompress(const size_t                compressed_size,
-                                 const std::vector<uint8_t>& compressed_data,
-                                 const size_t                expected_uncompressed_size,
-                                 std::vector<uint8_t>*       uncompressed_data)
+size_t Lz4Compressor::Decompress(const size_t   compressed_size,
+                                 const uint8_t* compressed_data,
+                                 const size_t   expected_uncompressed_size,
+                                 uint8_t*       uncompressed_data)
 {
     size_t data_size = 0;
 
-    if (nullptr == uncompressed_data)
+    if ((nullptr == compressed_data) || (nullptr == uncompressed_data))
     {
         return 0;
     }
 
-    int uncompressed_size_generated = LZ4_decompress_safe(reinterpret_cast<const char*>(compressed_data.data()),
-                                                          reinterpret_cast<char*>(uncompressed_data->data()),
+    int uncompressed_size_generated = LZ4_decompress_safe(reinterpret_cast<const char*>(compressed_data),
+                                                          reinterpret_cast<char*>(uncompressed_data),
                                                           static_cast<int32_t>(compressed_size),
                                                           static_cast<int32_t>(expected_uncompressed_size));
 
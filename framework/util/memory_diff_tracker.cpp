@@ -0,0 +1,256 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/memory_diff_tracker.h"
+
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <future>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define GFXRECON_MEMORY_DIFF_USE_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define GFXRECON_MEMORY_DIFF_USE_NEON
+#include <arm_neon.h>
+#endif
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Number of bytes compared per iteration of the vectorized loop.
+const size_t kVectorCompareStride = 64;
+
+static_assert((MemoryDiffTracker::kSegmentSize % MemoryDiffTracker::kCompareBlockSize) == 0,
+              "Segments must contain whole compare blocks");
+
+MemoryDiffTracker::MemoryDiffTracker(size_t num_threads) : thread_pool_(num_threads) {}
+
+void MemoryDiffTracker::AddTrackedMemory(uint64_t memory_id, const void* mapped_memory, size_t mapped_size)
+{
+    assert(mapped_memory != nullptr);
+
+    std::lock_guard<std::mutex> lock(tracked_memory_lock_);
+
+    auto& memory_info         = memory_info_[memory_id];
+    memory_info.mapped_memory = static_cast<const uint8_t*>(mapped_memory);
+    memory_info.snapshot.assign(memory_info.mapped_memory, memory_info.mapped_memory + mapped_size);
+}
+
+void MemoryDiffTracker::RemoveTrackedMemory(uint64_t memory_id)
+{
+    std::lock_guard<std::mutex> lock(tracked_memory_lock_);
+    memory_info_.erase(memory_id);
+}
+
+bool MemoryDiffTracker::ProcessMemoryEntry(uint64_t memory_id, const ModifiedMemoryFunc& handle_modified)
+{
+    bool found = false;
+
+    std::lock_guard<std::mutex> lock(tracked_memory_lock_);
+
+    auto entry = memory_info_.find(memory_id);
+    if (entry != memory_info_.end())
+    {
+        std::vector<Segment> segments;
+        AddSegments(entry->first, &entry->second, &segments);
+        ProcessSegments(segments, handle_modified);
+        found = true;
+    }
+
+    return found;
+}
+
+void MemoryDiffTracker::ProcessMemoryEntries(const ModifiedMemoryFunc& handle_modified)
+{
+    std::lock_guard<std::mutex> lock(tracked_memory_lock_);
+
+    std::vector<Segment> segments;
+    for (auto& entry : memory_info_)
+    {
+        AddSegments(entry.first, &entry.second, &segments);
+    }
+
+    ProcessSegments(segments, handle_modified);
+}
+
+bool MemoryDiffTracker::BlocksDiffer(const uint8_t* lhs, const uint8_t* rhs, size_t size)
+{
+    bool   differ = false;
+    size_t offset = 0;
+
+#if defined(GFXRECON_MEMORY_DIFF_USE_SSE2)
+    for (; !differ && ((offset + kVectorCompareStride) <= size); offset += kVectorCompareStride)
+    {
+        const __m128i* lhs_vector = reinterpret_cast<const __m128i*>(lhs + offset);
+        const __m128i* rhs_vector = reinterpret_cast<const __m128i*>(rhs + offset);
+
+        __m128i equal0 = _mm_cmpeq_epi8(_mm_loadu_si128(lhs_vector), _mm_loadu_si128(rhs_vector));
+        __m128i equal1 = _mm_cmpeq_epi8(_mm_loadu_si128(lhs_vector + 1), _mm_loadu_si128(rhs_vector + 1));
+        __m128i equal2 = _mm_cmpeq_epi8(_mm_loadu_si128(lhs_vector + 2), _mm_loadu_si128(rhs_vector + 2));
+        __m128i equal3 = _mm_cmpeq_epi8(_mm_loadu_si128(lhs_vector + 3), _mm_loadu_si128(rhs_vector + 3));
+        __m128i equal  = _mm_and_si128(_mm_and_si128(equal0, equal1), _mm_and_si128(equal2, equal3));
+
+        differ = (_mm_movemask_epi8(equal) != 0xFFFF);
+    }
+#elif defined(GFXRECON_MEMORY_DIFF_USE_NEON)
+    for (; !differ && ((offset + kVectorCompareStride) <= size); offset += kVectorCompareStride)
+    {
+        uint8x16_t equal0 = vceqq_u8(vld1q_u8(lhs + offset), vld1q_u8(rhs + offset));
+        uint8x16_t equal1 = vceqq_u8(vld1q_u8(lhs + offset + 16), vld1q_u8(rhs + offset + 16));
+        uint8x16_t equal2 = vceqq_u8(vld1q_u8(lhs + offset + 32), vld1q_u8(rhs + offset + 32));
+        uint8x16_t equal3 = vceqq_u8(vld1q_u8(lhs + offset + 48), vld1q_u8(rhs + offset + 48));
+        uint8x16_t equal  = vandq_u8(vandq_u8(equal0, equal1), vandq_u8(equal2, equal3));
+
+        differ = (vminvq_u8(equal) != 0xFF);
+    }
+#endif
+
+    if (!differ && (offset < size))
+    {
+        differ = (memcmp(lhs + offset, rhs + offset, size - offset) != 0);
+    }
+
+    return differ;
+}
+
+void MemoryDiffTracker::AddSegments(uint64_t              memory_id,
+                                    MemoryInfo*           memory_info,
+                                    std::vector<Segment>* segments) const
+{
+    assert((memory_info != nullptr) && (segments != nullptr));
+
+    size_t size = memory_info->snapshot.size();
+
+    for (size_t begin = 0; begin < size; begin += kSegmentSize)
+    {
+        segments->push_back({ memory_id, memory_info, begin, std::min(begin + kSegmentSize, size) });
+    }
+}
+
+void MemoryDiffTracker::ProcessSegments(const std::vector<Segment>& segments, const ModifiedMemoryFunc& handle_modified)
+{
+    std::vector<std::vector<MemoryRange>> segment_ranges(segments.size());
+
+    if ((segments.size() > 1) && (thread_pool_.numthreads() > 0))
+    {
+        std::vector<std::future<std::vector<MemoryRange>>> futures;
+        futures.reserve(segments.size() - 1);
+
+        for (size_t i = 1; i < segments.size(); ++i)
+        {
+            futures.emplace_back(thread_pool_.post(&MemoryDiffTracker::CompareSegment, segments[i]));
+        }
+
+        // The calling thread handles the first segment while the pool processes the rest.
+        segment_ranges[0] = CompareSegment(segments[0]);
+
+        for (size_t i = 0; i < futures.size(); ++i)
+        {
+            segment_ranges[i + 1] = futures[i].get();
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < segments.size(); ++i)
+        {
+            segment_ranges[i] = CompareSegment(segments[i]);
+        }
+    }
+
+    // Report ranges in order, merging ranges that continue across segment boundaries.  Any unmodified bytes that end up
+    // inside a merged range are reported from the snapshot, which matches the data that has already been written.
+    const Segment* pending_segment = nullptr;
+    MemoryRange    pending_range   = { 0, 0 };
+
+    for (size_t i = 0; i < segments.size(); ++i)
+    {
+        for (const auto& range : segment_ranges[i])
+        {
+            if ((pending_segment != nullptr) && (pending_segment->memory_info == segments[i].memory_info) &&
+                ((range.offset - (pending_range.offset + pending_range.size)) <= kMergeDistance))
+            {
+                pending_range.size = (range.offset + range.size) - pending_range.offset;
+            }
+            else
+            {
+                if (pending_segment != nullptr)
+                {
+                    handle_modified(pending_segment->memory_id,
+                                    pending_segment->memory_info->snapshot.data(),
+                                    pending_range.offset,
+                                    pending_range.size);
+                }
+
+                pending_segment = &segments[i];
+                pending_range   = range;
+            }
+        }
+    }
+
+    if (pending_segment != nullptr)
+    {
+        handle_modified(pending_segment->memory_id,
+                        pending_segment->memory_info->snapshot.data(),
+                        pending_range.offset,
+                        pending_range.size);
+    }
+}
+
+std::vector<MemoryDiffTracker::MemoryRange> MemoryDiffTracker::CompareSegment(const Segment& segment)
+{
+    std::vector<MemoryRange> ranges;
+    const uint8_t*           current  = segment.memory_info->mapped_memory;
+    uint8_t*                 snapshot = segment.memory_info->snapshot.data();
+
+    for (size_t offset = segment.begin; offset < segment.end; offset += kCompareBlockSize)
+    {
+        size_t block_size = std::min(kCompareBlockSize, segment.end - offset);
+
+        if (BlocksDiffer(current + offset, snapshot + offset, block_size))
+        {
+            if (!ranges.empty() && ((offset - (ranges.back().offset + ranges.back().size)) <= kMergeDistance))
+            {
+                ranges.back().size = (offset + block_size) - ranges.back().offset;
+            }
+            else
+            {
+                ranges.push_back({ offset, block_size });
+            }
+        }
+    }
+
+    // Bring the snapshot up to date, so that it can be used as the source for the reported data.
+    for (const auto& range : ranges)
+    {
+        util::platform::MemoryCopy(snapshot + range.offset, range.size, current + range.offset, range.size);
+    }
+
+    return ranges;
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,123 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef GFXRECON_UTIL_MEMORY_DIFF_TRACKER_H
+#define GFXRECON_UTIL_MEMORY_DIFF_TRACKER_H
+
+#include "util/defines.h"
+#include "util/threadpool.h"
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Detects modifications to mapped memory by comparing it with a snapshot taken when the memory was mapped, without the
+// signal handling required by PageGuardManager.  Memory is compared in fixed size blocks, and each modified range is
+// copied to the snapshot before it is reported, so reported data remains valid until the next call that processes the
+// same memory object.  Large mappings are split into segments that are compared in parallel on a thread pool.
+class MemoryDiffTracker
+{
+  public:
+    // Callback for processing modified memory, with the same parameters as PageGuardManager::ModifiedMemoryFunc: the
+    // ID of the modified memory object, a pointer to the start of the snapshot, the offset from the start of the
+    // snapshot to the modified range, and the size of the modified range.
+    typedef std::function<void(uint64_t, void*, size_t, size_t)> ModifiedMemoryFunc;
+
+    // Size of the blocks that mapped memory is compared in, which is the granularity of the reported ranges.
+    static constexpr size_t kCompareBlockSize = 256;
+
+    // Modified ranges separated by fewer unmodified bytes than this are reported as a single range, to avoid the
+    // overhead of writing many small fill memory commands.
+    static constexpr size_t kMergeDistance = 1024;
+
+    // Size of the segments that mappings are split into for parallel comparison.
+    static constexpr size_t kSegmentSize = 1024 * 1024;
+
+  public:
+    explicit MemoryDiffTracker(size_t num_threads);
+
+    ~MemoryDiffTracker() {}
+
+    // Adds mapped memory for tracking, taking a snapshot of its current content.  If the memory ID is already being
+    // tracked, the previous entry is replaced.
+    void AddTrackedMemory(uint64_t memory_id, const void* mapped_memory, size_t mapped_size);
+
+    void RemoveTrackedMemory(uint64_t memory_id);
+
+    // Reports the modified ranges of a single memory object.  Returns false if the memory is not being tracked.
+    bool ProcessMemoryEntry(uint64_t memory_id, const ModifiedMemoryFunc& handle_modified);
+
+    void ProcessMemoryEntries(const ModifiedMemoryFunc& handle_modified);
+
+    size_t GetThreadCount() const { return thread_pool_.numthreads(); }
+
+    // Returns true if the two blocks of memory differ, comparing 64 bytes at a time with SIMD instructions when they
+    // are available.
+    static bool BlocksDiffer(const uint8_t* lhs, const uint8_t* rhs, size_t size);
+
+  private:
+    struct MemoryRange
+    {
+        size_t offset;
+        size_t size;
+    };
+
+    struct MemoryInfo
+    {
+        const uint8_t*       mapped_memory{ nullptr };
+        std::vector<uint8_t> snapshot;
+    };
+
+    struct Segment
+    {
+        uint64_t    memory_id;
+        MemoryInfo* memory_info;
+        size_t      begin;
+        size_t      end;
+    };
+
+    typedef std::unordered_map<uint64_t, MemoryInfo> MemoryInfoMap;
+
+  private:
+    void AddSegments(uint64_t memory_id, MemoryInfo* memory_info, std::vector<Segment>* segments) const;
+
+    void ProcessSegments(const std::vector<Segment>& segments, const ModifiedMemoryFunc& handle_modified);
+
+    // Compares a segment with its snapshot, updating the snapshot and returning the modified ranges.
+    static std::vector<MemoryRange> CompareSegment(const Segment& segment);
+
+  private:
+    std::mutex    tracked_memory_lock_;
+    MemoryInfoMap memory_info_;
+    ThreadPool    thread_pool_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_MEMORY_DIFF_TRACKER_H
@@ -28,6 +28,7 @@
 #include "util/page_status_tracker.h"
 #include "util/platform.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cinttypes>
 
@@ -610,20 +611,23 @@ bool PageGuardManager::FindMemory(void* address, MemoryInfo** watched_memory_inf
 {
     assert((address != nullptr) && (watched_memory_info != nullptr));
 
-    bool found = false;
-    for (auto entry = memory_info_.begin(); entry != memory_info_.end(); ++entry)
+    if (memory_ranges_.Find(address, watched_memory_info))
     {
-        MemoryInfo* memory_info = &(entry->second);
+        return true;
+    }
 
+    // Entries that could not be indexed because their ranges overlap an indexed range are searched linearly. These
+    // are expected to be rare, so the list is usually empty.
+    for (MemoryInfo* memory_info : overlapping_memory_)
+    {
         if ((address >= memory_info->start_address) && (address < memory_info->end_address))
         {
-            found                  = true;
             (*watched_memory_info) = memory_info;
-            break;
+            return true;
         }
     }
 
-    return found;
+    return false;
 }
 
 bool PageGuardManager::SetMemoryProtection(void* protect_address, size_t protect_size, uint32_t protect_mask)
@@ -744,61 +748,42 @@ void PageGuardManager::ProcessEntry(uint64_t                  memory_id,
     assert(memory_info != nullptr);
     assert(memory_info->is_modified);
 
-    bool   active_range = false;
-    size_t start_index  = 0;
+    PageStatusTracker& status_tracker = memory_info->status_tracker;
 
     memory_info->is_modified = false;
 
-    for (size_t i = 0; i < memory_info->total_pages; ++i)
+    // If a read operation triggered the page guard handler for a page that was not written, the page guard needs to be
+    // reset. Note that it is only possible to reach this state when enable_shadow_memory_ is true and
+    // enable_read_write_same_page_ is false.
+    for (size_t i = status_tracker.FindNextActiveReadOnlyBlock(0); i < memory_info->total_pages;
+         i = status_tracker.FindNextActiveReadOnlyBlock(i + 1))
     {
-        // Concatenate dirty pages to handle as large a range as possible with a single modified memory handler
-        // invocation.
-        if (memory_info->status_tracker.IsActiveWriteBlock(i))
-        {
-            memory_info->status_tracker.SetActiveWriteBlock(i, false);
-            memory_info->status_tracker.SetActiveReadBlock(i, false);
+        status_tracker.SetActiveReadBlock(i, false);
 
-            if (!active_range)
-            {
-                active_range = true;
-                start_index  = i;
-            }
-        }
-        else
+        if (protection_mode_ == kMProtectMode)
         {
-            // If there was no write operation on the current page, check to see if there was a read operation.
-            // If a read operation triggered the page guard handler, it needs to be reset.
-            // Note that it is only possible to reach this state when enable_shadow_memory_ is true and
-            // enable_read_write_same_page_ is false.
-            if (memory_info->status_tracker.IsActiveReadBlock(i))
-            {
-                memory_info->status_tracker.SetActiveReadBlock(i, false);
-
-                if (protection_mode_ == kMProtectMode)
-                {
-                    assert(memory_info->shadow_memory != nullptr);
-
-                    void* page_address =
-                        static_cast<uint8_t*>(memory_info->aligned_address) + (i << system_page_pot_shift_);
-                    size_t segment_size = GetMemorySegmentSize(memory_info, i);
-
-                    SetMemoryProtection(page_address, segment_size, kGuardReadWriteProtect);
-                }
-            }
+            assert(memory_info->shadow_memory != nullptr);
 
-            // If the previous pages were modified by a write operation, process the modified range now.
-            if (active_range)
-            {
-                active_range = false;
+            void*  page_address = static_cast<uint8_t*>(memory_info->aligned_address) + (i << system_page_pot_shift_);
+            size_t segment_size = GetMemorySegmentSize(memory_info, i);
 
-                ProcessActiveRange(memory_id, memory_info, start_index, i, handle_modified);
-            }
+            SetMemoryProtection(page_address, segment_size, kGuardReadWriteProtect);
         }
     }
 
-    if (active_range)
+    // Concatenate dirty pages to handle as large a range as possible with a single modified memory handler invocation.
+    // The status tracker skips words of clean pages when searching for the start and end of each range.
+    size_t start_index = status_tracker.FindNextActiveWriteBlock(0);
+
+    while (start_index < memory_info->total_pages)
     {
-        ProcessActiveRange(memory_id, memory_info, start_index, memory_info->total_pages, handle_modified);
+        size_t end_index = status_tracker.FindNextInactiveWriteBlock(start_index);
+
+        status_tracker.ClearActiveBlocks(start_index, end_index - start_index);
+
+        ProcessActiveRange(memory_id, memory_info, start_index, end_index, handle_modified);
+
+        start_index = status_tracker.FindNextActiveWriteBlock(end_index);
     }
 }
 
@@ -1123,7 +1108,18 @@ void* PageGuardManager::AddTrackedMemory(uint64_t  memory_id,
                                                            use_write_watch,
                                                            shadow_memory_handle == kNullShadowHandle));
 
-            if (!entry.second)
+            if (entry.second)
+            {
+                MemoryInfo* memory_info = &entry.first->second;
+
+                if (!memory_ranges_.Insert(memory_info->start_address, memory_info->end_address, memory_info))
+                {
+                    // The range overlaps the range of another entry, so it is kept in a list that FindMemory searches
+                    // when the address is not found in the index.
+                    overlapping_memory_.push_back(memory_info);
+                }
+            }
+            else
             {
                 if (!use_write_watch)
                 {
@@ -1185,7 +1181,22 @@ void PageGuardManager::RemoveTrackedMemory(uint64_t memory_id)
     auto entry = memory_info_.find(memory_id);
     if (entry != memory_info_.end())
     {
-        ReleaseTrackedMemory(&entry->second);
+        MemoryInfo* memory_info  = &entry->second;
+        MemoryInfo* indexed_info = nullptr;
+
+        ReleaseTrackedMemory(memory_info);
+
+        // The range is not indexed when it overlapped the range of another entry.
+        if (memory_ranges_.Find(memory_info->start_address, &indexed_info) && (indexed_info == memory_info))
+        {
+            memory_ranges_.Remove(memory_info->start_address);
+        }
+        else
+        {
+            overlapping_memory_.erase(
+                std::remove(overlapping_memory_.begin(), overlapping_memory_.end(), memory_info),
+                overlapping_memory_.end());
+        }
 
         memory_info_.erase(entry);
     }
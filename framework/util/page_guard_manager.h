@@ -25,6 +25,7 @@
 #ifndef GFXRECON_UTIL_PAGE_GUARD_MANAGER_H
 #define GFXRECON_UTIL_PAGE_GUARD_MANAGER_H
 
+#include "util/address_range_map.h"
 #include "util/defines.h"
 #include "util/page_status_tracker.h"
 #include "util/platform.h"
@@ -227,6 +228,7 @@ class PageGuardManager
     };
 
     typedef std::unordered_map<uint64_t, MemoryInfo> MemoryInfoMap;
+    typedef AddressRangeMap<MemoryInfo*>             MemoryRangeMap;
 
   private:
     size_t GetSystemPagePotShift() const;
@@ -262,6 +264,8 @@ class PageGuardManager
   private:
     static PageGuardManager* instance_;
     MemoryInfoMap            memory_info_;
+    MemoryRangeMap           memory_ranges_;      // Protected address ranges of memory_info_ entries, for FindMemory.
+    std::vector<MemoryInfo*> overlapping_memory_; // Entries with ranges that overlap an entry in memory_ranges_.
     std::mutex               tracked_memory_lock_;
     std::mutex               signal_handler_lock_;
     void*                    exception_handler_;
@@ -28,41 +28,66 @@
 #include "util/defines.h"
 
 #include <algorithm>
+#include <cassert>
 #include <cstddef>
 #include <cstdint>
 #include <vector>
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
+// Tracks the pages of a memory range that have been written or read, with one bit per page. Pages are stored in 64-bit
+// words, so that searches for written pages skip 64 clean pages at a time.
 class PageStatusTracker
 {
   public:
-    typedef std::vector<uint8_t> PageStatus;
-
-  public:
-    PageStatusTracker(size_t page_count) : active_writes_(page_count, 0), active_reads_(page_count, 0) {}
+    PageStatusTracker(size_t page_count) :
+        page_count_(page_count), active_writes_(GetWordCount(page_count), 0), active_reads_(GetWordCount(page_count), 0)
+    {}
 
     ~PageStatusTracker() {}
 
-    bool IsActiveWriteBlock(size_t index) const { return (active_writes_[index] == 1); }
-    bool IsActiveReadBlock(size_t index) const { return (active_reads_[index] == 1); }
+    bool IsActiveWriteBlock(size_t index) const { return IsBitSet(active_writes_, index); }
+    bool IsActiveReadBlock(size_t index) const { return IsBitSet(active_reads_, index); }
 
-    void SetActiveWriteBlock(size_t index, bool value) { active_writes_[index] = value ? 1 : 0; }
-    void SetActiveReadBlock(size_t index, bool value) { active_reads_[index] = value ? 1 : 0; }
+    void SetActiveWriteBlock(size_t index, bool value) { SetBit(&active_writes_, index, value); }
+    void SetActiveReadBlock(size_t index, bool value) { SetBit(&active_reads_, index, value); }
 
-    void SetAllBlocksActiveWrite() { std::fill(active_writes_.begin(), active_writes_.end(), 1); }
+    void SetAllBlocksActiveWrite()
+    {
+        std::fill(active_writes_.begin(), active_writes_.end(), ~uint64_t{ 0 });
 
-    const PageStatus& GetActiveWrites() const { return active_writes_; }
+        // Bits past the last page remain clear, so that searches do not need to check the page count.
+        size_t last_word_pages = page_count_ & kWordMask;
+        if (last_word_pages != 0)
+        {
+            active_writes_.back() = (uint64_t{ 1 } << last_word_pages) - 1;
+        }
+    }
+
+    // Clears the write and read status of the specified pages.
+    void ClearActiveBlocks(size_t first_page, size_t page_count)
+    {
+        ClearBits(&active_writes_, first_page, page_count);
+        ClearBits(&active_reads_, first_page, page_count);
+    }
 
-    static bool HasActiveWriteBlock(const PageStatus& pages, size_t first_page, size_t page_count)
+    bool HasActiveWriteBlock(size_t first_page, size_t page_count) const
     {
-        assert(first_page < pages.size());
-        assert(first_page + page_count <= pages.size());
+        assert(first_page < page_count_);
+        assert(first_page + page_count <= page_count_);
+
+        size_t end_page   = first_page + page_count;
+        size_t first_word = first_page >> kWordShift;
+        size_t end_word   = (end_page + kWordMask) >> kWordShift;
 
-        for (size_t p = 0; p < page_count && ((p + first_page) < pages.size()); ++p)
+        for (size_t i = first_word; i < end_word; ++i)
         {
-            if (pages[first_page + p])
+            if ((active_writes_[i] & GetWordRangeMask(i, first_page, end_page)) != 0)
             {
                 return true;
             }
@@ -71,18 +96,144 @@ class PageStatusTracker
         return false;
     }
 
-    bool HasActiveWriteBlock(size_t first_page, size_t page_count) const
+    bool HasActiveWriteBlock() const
+    {
+        return std::any_of(active_writes_.begin(), active_writes_.end(), [](uint64_t word) { return word != 0; });
+    }
+
+    // Returns the index of the first written page at or after the specified page, or the page count if there is none.
+    size_t FindNextActiveWriteBlock(size_t first_page) const
+    {
+        return FindNextSetBit(first_page, [this](size_t i) { return active_writes_[i]; });
+    }
+
+    // Returns the index of the first page at or after the specified page that has not been written, or the page count
+    // if there is none.
+    size_t FindNextInactiveWriteBlock(size_t first_page) const
+    {
+        return FindNextSetBit(first_page, [this](size_t i) { return ~active_writes_[i]; });
+    }
+
+    // Returns the index of the first page at or after the specified page that has been read but not written, or the
+    // page count if there is none.
+    size_t FindNextActiveReadOnlyBlock(size_t first_page) const
+    {
+        return FindNextSetBit(first_page, [this](size_t i) { return active_reads_[i] & ~active_writes_[i]; });
+    }
+
+    size_t GetPageCount() const { return page_count_; }
+
+  private:
+    static const size_t kWordShift = 6;
+    static const size_t kWordBits  = 64;
+    static const size_t kWordMask  = kWordBits - 1;
+
+    static size_t GetWordCount(size_t page_count) { return (page_count + kWordMask) >> kWordShift; }
+
+    static bool IsBitSet(const std::vector<uint64_t>& words, size_t index)
+    {
+        return (words[index >> kWordShift] & (uint64_t{ 1 } << (index & kWordMask))) != 0;
+    }
+
+    static void SetBit(std::vector<uint64_t>* words, size_t index, bool value)
+    {
+        uint64_t bit = uint64_t{ 1 } << (index & kWordMask);
+
+        if (value)
+        {
+            (*words)[index >> kWordShift] |= bit;
+        }
+        else
+        {
+            (*words)[index >> kWordShift] &= ~bit;
+        }
+    }
+
+    // Returns the bits of the specified word that correspond to pages in the range [first_page, end_page).
+    static uint64_t GetWordRangeMask(size_t word_index, size_t first_page, size_t end_page)
     {
-        return HasActiveWriteBlock(active_writes_, first_page, page_count);
+        size_t   word_first_page = word_index << kWordShift;
+        uint64_t mask            = ~uint64_t{ 0 };
+
+        if (first_page > word_first_page)
+        {
+            mask &= ~uint64_t{ 0 } << (first_page - word_first_page);
+        }
+
+        if (end_page < (word_first_page + kWordBits))
+        {
+            mask &= (uint64_t{ 1 } << (end_page - word_first_page)) - 1;
+        }
+
+        return mask;
     }
 
-    bool HasActiveWriteBlock() const { return HasActiveWriteBlock(0, active_writes_.size()); }
+    static void ClearBits(std::vector<uint64_t>* words, size_t first_page, size_t page_count)
+    {
+        size_t end_page   = first_page + page_count;
+        size_t first_word = first_page >> kWordShift;
+        size_t end_word   = (end_page + kWordMask) >> kWordShift;
 
-    size_t GetPageCount() const { return active_writes_.size(); }
+        for (size_t i = first_word; i < end_word; ++i)
+        {
+            (*words)[i] &= ~GetWordRangeMask(i, first_page, end_page);
+        }
+    }
+
+    static size_t CountTrailingZeros(uint64_t value)
+    {
+        assert(value != 0);
+
+#if defined(_MSC_VER)
+        unsigned long index = 0;
+#if defined(_WIN64)
+        _BitScanForward64(&index, value);
+#else
+        if (_BitScanForward(&index, static_cast<unsigned long>(value)) == 0)
+        {
+            _BitScanForward(&index, static_cast<unsigned long>(value >> 32));
+            index += 32;
+        }
+#endif
+        return index;
+#else
+        return static_cast<size_t>(__builtin_ctzll(value));
+#endif
+    }
+
+    // Searches the words produced by get_word for the first set bit at or after the specified page, skipping words
+    // without set bits.
+    template <typename GetWord>
+    size_t FindNextSetBit(size_t first_page, GetWord get_word) const
+    {
+        size_t word_count = active_writes_.size();
+        size_t i          = first_page >> kWordShift;
+
+        if (i >= word_count)
+        {
+            return page_count_;
+        }
+
+        // Ignore the bits for the pages that precede the first page in its word.
+        uint64_t word = get_word(i) & (~uint64_t{ 0 } << (first_page & kWordMask));
+
+        while (word == 0)
+        {
+            if (++i == word_count)
+            {
+                return page_count_;
+            }
+
+            word = get_word(i);
+        }
+
+        return std::min((i << kWordShift) + CountTrailingZeros(word), page_count_);
+    }
 
   private:
-    PageStatus active_writes_; //< Track blocks that have been written.
-    PageStatus active_reads_;  //< Track blocks that have been read.
+    size_t                page_count_;
+    std::vector<uint64_t> active_writes_; //< Track blocks that have been written, with one bit per block.
+    std::vector<uint64_t> active_reads_;  //< Track blocks that have been read, with one bit per block.
 };
 
 GFXRECON_END_NAMESPACE(util)
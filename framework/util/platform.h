@@ -41,6 +41,7 @@
 #endif
 #include <windows.h>
 #include <direct.h>
+#include <io.h>
 #else // WIN32
 #include <dlfcn.h>
 #include <errno.h>
@@ -255,6 +256,48 @@ inline void FreeRawMemory(void* memory, size_t aligned_size)
     VirtualFree(memory, 0, MEM_RELEASE);
 }
 
+// Map an open file into memory for reading. Returns nullptr if the file cannot be mapped, such as when it is empty or
+// too large for the address space.
+inline const void* MapFileReadOnly(FILE* stream, size_t* mapped_size)
+{
+    assert(mapped_size != nullptr);
+
+    HANDLE        file = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(stream)));
+    LARGE_INTEGER file_size;
+
+    if ((file == INVALID_HANDLE_VALUE) || !GetFileSizeEx(file, &file_size) || (file_size.QuadPart <= 0) ||
+        (static_cast<uint64_t>(file_size.QuadPart) > SIZE_MAX))
+    {
+        return nullptr;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+    if (mapping == nullptr)
+    {
+        return nullptr;
+    }
+
+    // The view holds a reference to the mapping object, which is released when the view is unmapped.
+    const void* memory = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+
+    if (memory != nullptr)
+    {
+        *mapped_size = static_cast<size_t>(file_size.QuadPart);
+    }
+
+    return memory;
+}
+
+inline void UnmapFile(const void* memory, size_t mapped_size)
+{
+    assert(memory != nullptr);
+
+    GFXRECON_UNREFERENCED_PARAMETER(mapped_size);
+    UnmapViewOfFile(memory);
+}
+
 inline int GetSystemLastErrorCode()
 {
     return GetLastError();
@@ -563,6 +606,43 @@ inline void FreeRawMemory(void* memory, size_t aligned_size)
     munmap(memory, aligned_size);
 }
 
+// Map an open file into memory for reading. Returns nullptr if the file cannot be mapped, such as when it is empty, is
+// not a regular file, or is too large for the address space.
+inline const void* MapFileReadOnly(FILE* stream, size_t* mapped_size)
+{
+    assert(mapped_size != nullptr);
+
+    int         fd = fileno(stream);
+    struct stat file_stat;
+
+    if ((fd < 0) || (fstat(fd, &file_stat) != 0) || !S_ISREG(file_stat.st_mode) || (file_stat.st_size <= 0) ||
+        (static_cast<uint64_t>(file_stat.st_size) > SIZE_MAX))
+    {
+        return nullptr;
+    }
+
+    const size_t size   = static_cast<size_t>(file_stat.st_size);
+    void*        memory = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    if (memory == MAP_FAILED)
+    {
+        return nullptr;
+    }
+
+    // Files are mostly read from front to back, which benefits from aggressive read-ahead.
+    madvise(memory, size, MADV_SEQUENTIAL);
+
+    *mapped_size = size;
+    return memory;
+}
+
+inline void UnmapFile(const void* memory, size_t mapped_size)
+{
+    assert(memory != nullptr);
+
+    munmap(const_cast<void*>(memory), mapped_size);
+}
+
 inline int GetSystemLastErrorCode()
 {
     return errno;
@@ -0,0 +1,141 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef GFXRECON_UTIL_SHARDED_HASH_MAP_H
+#define GFXRECON_UTIL_SHARDED_HASH_MAP_H
+
+#include "util/defines.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Hash map that is split into a fixed number of shards, each with its own reader/writer lock, so that threads
+// accessing different keys rarely touch the same lock. Shards are cache line aligned to keep the lock state of one
+// shard from sharing a cache line with another. Keys are assigned to shards with a multiplicative hash, because keys
+// such as pointers tend to have low bits in common.
+template <typename Key, typename Value, size_t ShardCount = 16, typename Hash = std::hash<Key>>
+class ShardedHashMap
+{
+    static_assert((ShardCount != 0) && ((ShardCount & (ShardCount - 1)) == 0), "ShardCount must be a power of two");
+
+  public:
+    bool Insert(const Key& key, const Value& value)
+    {
+        Shard&                                    shard = GetShard(key);
+        const std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        return shard.map.insert(std::make_pair(key, value)).second;
+    }
+
+    bool Erase(const Key& key)
+    {
+        Shard&                                    shard = GetShard(key);
+        const std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        return (shard.map.erase(key) != 0);
+    }
+
+    // Returns true and copies the value for key to value when the key is present.
+    bool Find(const Key& key, Value& value) const
+    {
+        const Shard&                              shard = GetShard(key);
+        const std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        auto                                      entry = shard.map.find(key);
+        if (entry != shard.map.end())
+        {
+            value = entry->second;
+            return true;
+        }
+        return false;
+    }
+
+    size_t GetSize() const
+    {
+        size_t size = 0;
+        for (const Shard& shard : shards_)
+        {
+            const std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            size += shard.map.size();
+        }
+        return size;
+    }
+
+    // Visits every entry, one shard at a time. Entries added to or removed from other shards while visiting may or
+    // may not be seen.
+    void Visit(const std::function<void(const Key&, const Value&)>& visitor) const
+    {
+        for (const Shard& shard : shards_)
+        {
+            const std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            for (const auto& entry : shard.map)
+            {
+                visitor(entry.first, entry.second);
+            }
+        }
+    }
+
+    void Clear()
+    {
+        for (Shard& shard : shards_)
+        {
+            const std::unique_lock<std::shared_mutex> lock(shard.mutex);
+            shard.map.clear();
+        }
+    }
+
+  private:
+    static constexpr size_t GetShardBits(size_t count) { return (count > 1) ? (1 + GetShardBits(count >> 1)) : 0; }
+
+    static constexpr size_t kCacheLineSize = 64;
+
+    struct alignas(kCacheLineSize) Shard
+    {
+        mutable std::shared_mutex            mutex;
+        std::unordered_map<Key, Value, Hash> map;
+    };
+
+    static size_t GetShardIndex(const Key& key)
+    {
+        // Fibonacci hashing: the top bits of the product depend on all bits of the hash. Using other bits of the product
+        // correlates the shard index with the bucket index of the shard's map, which degrades to long bucket chains.
+        constexpr size_t kShardBits = GetShardBits(ShardCount);
+        const uint64_t   hash       = static_cast<uint64_t>(Hash{}(key)) * 0x9E3779B97F4A7C15ull;
+        return (kShardBits == 0) ? 0 : static_cast<size_t>(hash >> (64 - kShardBits));
+    }
+
+    Shard&       GetShard(const Key& key) { return shards_[GetShardIndex(key)]; }
+    const Shard& GetShard(const Key& key) const { return shards_[GetShardIndex(key)]; }
+
+    std::array<Shard, ShardCount> shards_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_SHARDED_HASH_MAP_H
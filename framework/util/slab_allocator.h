@@ -0,0 +1,140 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef GFXRECON_UTIL_SLAB_ALLOCATOR_H
+#define GFXRECON_UTIL_SLAB_ALLOCATOR_H
+
+#include "util/defines.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Allocates objects of a single type from slabs that each hold several objects. Deleted objects are kept on a free list
+// and their memory is reused by the next allocation, so that workloads that repeatedly create and destroy objects of
+// the same type do not go through the system heap for each object. Slab memory is only released when the allocator is
+// destroyed, which requires all of its objects to have been deleted. New and Delete may be called from any thread.
+template <typename T>
+class SlabAllocator
+{
+  public:
+    // Slabs are sized to roughly 16KB, with at least one object per slab.
+    static constexpr size_t kSlabBytes      = 16384;
+    static constexpr size_t kObjectsPerSlab = std::max<size_t>(1, kSlabBytes / sizeof(T));
+
+    SlabAllocator() = default;
+
+    ~SlabAllocator() { assert(allocated_count_ == 0); }
+
+    SlabAllocator(const SlabAllocator&) = delete;
+
+    SlabAllocator& operator=(const SlabAllocator&) = delete;
+
+    template <typename... Args>
+    T* New(Args&&... args)
+    {
+        return new (AllocateSlot()->storage) T(std::forward<Args>(args)...);
+    }
+
+    void Delete(T* object)
+    {
+        if (object != nullptr)
+        {
+            object->~T();
+            FreeSlot(reinterpret_cast<Slot*>(object));
+        }
+    }
+
+    size_t GetAllocatedCount() const
+    {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        return allocated_count_;
+    }
+
+    size_t GetSlabCount() const
+    {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        return slabs_.size();
+    }
+
+  private:
+    // A free slot stores the pointer to the next free slot in the memory of the object that it replaces.
+    union Slot
+    {
+        Slot* next;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    Slot* AllocateSlot()
+    {
+        const std::lock_guard<std::mutex> lock(mutex_);
+
+        if (free_list_ == nullptr)
+        {
+            slabs_.emplace_back(std::make_unique<Slot[]>(kObjectsPerSlab));
+
+            Slot* slab = slabs_.back().get();
+            for (size_t i = 0; i < kObjectsPerSlab; ++i)
+            {
+                slab[i].next = (i + 1 < kObjectsPerSlab) ? &slab[i + 1] : nullptr;
+            }
+
+            free_list_ = slab;
+        }
+
+        Slot* slot = free_list_;
+        free_list_ = slot->next;
+        ++allocated_count_;
+
+        return slot;
+    }
+
+    void FreeSlot(Slot* slot)
+    {
+        const std::lock_guard<std::mutex> lock(mutex_);
+
+        assert(allocated_count_ > 0);
+        slot->next = free_list_;
+        free_list_ = slot;
+        --allocated_count_;
+    }
+
+  private:
+    mutable std::mutex                   mutex_;
+    std::vector<std::unique_ptr<Slot[]>> slabs_;
+    Slot*                                free_list_{ nullptr };
+    size_t                               allocated_count_{ 0 };
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_SLAB_ALLOCATOR_H
@@ -0,0 +1,185 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/address_range_map.h"
+#include "util/logging.h"
+
+#include <catch2/catch.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(test)
+
+static const void* ToAddress(uintptr_t address)
+{
+    return reinterpret_cast<const void*>(address);
+}
+
+TEST_CASE("AddressRangeMap finds the range containing an address", "[address_range_map]")
+{
+    AddressRangeMap<uint64_t> range_map;
+
+    REQUIRE(range_map.Insert(ToAddress(0x3000), ToAddress(0x4000), 3));
+    REQUIRE(range_map.Insert(ToAddress(0x1000), ToAddress(0x1800), 1));
+    REQUIRE(range_map.Insert(ToAddress(0x2000), ToAddress(0x3000), 2));
+    REQUIRE(range_map.GetSize() == 3);
+
+    uint64_t value = 0;
+    REQUIRE(range_map.Find(ToAddress(0x1000), &value));
+    REQUIRE(value == 1);
+    REQUIRE(range_map.Find(ToAddress(0x17ff), &value));
+    REQUIRE(value == 1);
+    REQUIRE(range_map.Find(ToAddress(0x2fff), &value));
+    REQUIRE(value == 2);
+    REQUIRE(range_map.Find(ToAddress(0x3000), &value));
+    REQUIRE(value == 3);
+
+    REQUIRE_FALSE(range_map.Find(ToAddress(0x0fff), &value));
+    REQUIRE_FALSE(range_map.Find(ToAddress(0x1800), &value));
+    REQUIRE_FALSE(range_map.Find(ToAddress(0x4000), &value));
+}
+
+TEST_CASE("AddressRangeMap rejects empty and overlapping ranges", "[address_range_map]")
+{
+    AddressRangeMap<uint64_t> range_map;
+
+    REQUIRE(range_map.Insert(ToAddress(0x2000), ToAddress(0x3000), 1));
+
+    REQUIRE_FALSE(range_map.Insert(ToAddress(0x5000), ToAddress(0x5000), 2));
+    REQUIRE_FALSE(range_map.Insert(ToAddress(0x1000), ToAddress(0x2001), 2));
+    REQUIRE_FALSE(range_map.Insert(ToAddress(0x2fff), ToAddress(0x4000), 2));
+    REQUIRE_FALSE(range_map.Insert(ToAddress(0x2000), ToAddress(0x3000), 2));
+    REQUIRE_FALSE(range_map.Insert(ToAddress(0x2800), ToAddress(0x2900), 2));
+    REQUIRE(range_map.GetSize() == 1);
+
+    // Adjacent ranges do not overlap.
+    REQUIRE(range_map.Insert(ToAddress(0x1000), ToAddress(0x2000), 2));
+    REQUIRE(range_map.Insert(ToAddress(0x3000), ToAddress(0x4000), 3));
+    REQUIRE(range_map.GetSize() == 3);
+}
+
+TEST_CASE("AddressRangeMap removes ranges by start address", "[address_range_map]")
+{
+    AddressRangeMap<uint64_t> range_map;
+
+    REQUIRE(range_map.Insert(ToAddress(0x1000), ToAddress(0x2000), 1));
+    REQUIRE(range_map.Insert(ToAddress(0x2000), ToAddress(0x3000), 2));
+
+    REQUIRE_FALSE(range_map.Remove(ToAddress(0x1800)));
+    REQUIRE(range_map.Remove(ToAddress(0x1000)));
+    REQUIRE_FALSE(range_map.Remove(ToAddress(0x1000)));
+
+    uint64_t value = 0;
+    REQUIRE_FALSE(range_map.Find(ToAddress(0x1000), &value));
+    REQUIRE(range_map.Find(ToAddress(0x2000), &value));
+    REQUIRE(value == 2);
+
+    range_map.Clear();
+    REQUIRE(range_map.GetSize() == 0);
+    REQUIRE_FALSE(range_map.Find(ToAddress(0x2000), &value));
+}
+
+// Compares the lookup performed by PageGuardManager for each guard page fault, before and after the tracked memory
+// ranges were indexed. Run explicitly with: gfxrecon_util_test "[address_range_map][benchmark]"
+TEST_CASE("AddressRangeMap lookup benchmark", "[address_range_map][benchmark][.]")
+{
+    struct TrackedRange
+    {
+        const void* start_address;
+        const void* end_address;
+    };
+
+    const size_t    kRangeCount  = 4096;
+    const size_t    kLookupCount = 100000;
+    const uintptr_t kRangeSize   = 64 * 1024;
+    const uintptr_t kBaseAddress = 0x10000000;
+
+    std::unordered_map<uint64_t, TrackedRange> tracked_ranges;
+    AddressRangeMap<const TrackedRange*>       range_map;
+
+    for (size_t i = 0; i < kRangeCount; ++i)
+    {
+        // Leave a gap between ranges, as there is between separately mapped allocations.
+        uintptr_t start = kBaseAddress + (i * 2 * kRangeSize);
+        auto      entry = tracked_ranges.emplace(i, TrackedRange{ ToAddress(start), ToAddress(start + kRangeSize) });
+        REQUIRE(range_map.Insert(entry.first->second.start_address,
+                                 entry.first->second.end_address,
+                                 &entry.first->second));
+    }
+
+    std::mt19937                             generator(0);
+    std::uniform_int_distribution<uintptr_t> distribution(kBaseAddress, kBaseAddress + (kRangeCount * 2 * kRangeSize));
+    std::vector<const void*>                 addresses(kLookupCount);
+
+    for (auto& address : addresses)
+    {
+        address = ToAddress(distribution(generator));
+    }
+
+    size_t linear_found = 0;
+    auto   start_time   = std::chrono::steady_clock::now();
+
+    for (const void* address : addresses)
+    {
+        for (const auto& entry : tracked_ranges)
+        {
+            if ((address >= entry.second.start_address) && (address < entry.second.end_address))
+            {
+                ++linear_found;
+                break;
+            }
+        }
+    }
+
+    auto   linear_time = std::chrono::steady_clock::now() - start_time;
+    size_t index_found = 0;
+    start_time         = std::chrono::steady_clock::now();
+
+    for (const void* address : addresses)
+    {
+        const TrackedRange* range = nullptr;
+        if (range_map.Find(address, &range))
+        {
+            ++index_found;
+        }
+    }
+
+    auto index_time = std::chrono::steady_clock::now() - start_time;
+
+    REQUIRE(linear_found == index_found);
+
+    GFXRECON_WRITE_CONSOLE("AddressRangeMap: %zu lookups in %zu ranges, linear scan %.3f ms, sorted index %.3f ms",
+                           kLookupCount,
+                           kRangeCount,
+                           std::chrono::duration<double, std::milli>(linear_time).count(),
+                           std::chrono::duration<double, std::milli>(index_time).count());
+}
+
+GFXRECON_END_NAMESPACE(test)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,189 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/command_record_store.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(test)
+
+namespace
+{
+
+struct Record
+{
+    uint32_t             call_id;
+    std::vector<uint8_t> data;
+};
+
+std::vector<Record> GetRecords(const CommandRecordStore& store)
+{
+    std::vector<Record> records;
+    store.Visit([&records](uint32_t call_id, const uint8_t* data, size_t size) {
+        records.push_back({ call_id, std::vector<uint8_t>(data, data + size) });
+    });
+    return records;
+}
+
+std::vector<uint8_t> MakeData(size_t size, uint8_t seed)
+{
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        data[i] = static_cast<uint8_t>(seed + i);
+    }
+    return data;
+}
+
+} // namespace
+
+TEST_CASE("CommandRecordStore visits records in order", "[command_record_store]")
+{
+    CommandRecordBlockPool pool;
+    CommandRecordStore     store(&pool);
+    std::vector<Record>    expected;
+
+    // Enough records to span several blocks, including a record that is larger than a block and an empty record.
+    for (uint32_t i = 0; i < 5000; ++i)
+    {
+        size_t size = (i == 1234) ? (CommandRecordBlockPool::kBlockSize * 2) : (i % 97);
+        expected.push_back({ i, MakeData(size, static_cast<uint8_t>(i)) });
+        store.Append(i, expected.back().data.data(), expected.back().data.size());
+    }
+
+    size_t data_size = 0;
+    for (const Record& record : expected)
+    {
+        data_size += record.data.size();
+    }
+
+    REQUIRE(store.GetRecordCount() == expected.size());
+    REQUIRE(store.GetDataSize() == data_size);
+    REQUIRE(store.GetReservedSize() > data_size);
+
+    auto records = GetRecords(store);
+    REQUIRE(records.size() == expected.size());
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        REQUIRE(records[i].call_id == expected[i].call_id);
+        REQUIRE(records[i].data == expected[i].data);
+    }
+
+    REQUIRE(pool.GetMemoryUsage().in_use_size == store.GetReservedSize());
+
+    store.Release();
+    REQUIRE(store.IsEmpty());
+    REQUIRE(store.GetReservedSize() == 0);
+    REQUIRE(GetRecords(store).empty());
+    REQUIRE(pool.GetMemoryUsage().in_use_size == 0);
+}
+
+TEST_CASE("CommandRecordStore with only empty records is not empty", "[command_record_store]")
+{
+    CommandRecordBlockPool pool;
+    CommandRecordStore     store(&pool);
+
+    REQUIRE(store.IsEmpty());
+
+    store.Append(1, nullptr, 0);
+    REQUIRE(!store.IsEmpty());
+    REQUIRE(store.GetRecordCount() == 1);
+    REQUIRE(store.GetDataSize() == 0);
+    REQUIRE(GetRecords(store).size() == 1);
+
+    store.Clear();
+    REQUIRE(store.IsEmpty());
+}
+
+TEST_CASE("CommandRecordStore recycles blocks", "[command_record_store]")
+{
+    const size_t kSmallBlockSize = CommandRecordBlockPool::kSmallBlockSize;
+    const size_t kBlockSize      = CommandRecordBlockPool::kBlockSize;
+
+    CommandRecordBlockPool pool(kBlockSize * 2);
+    auto                   data = MakeData(1000, 0);
+
+    {
+        // A store that records a few commands only uses a small block.
+        CommandRecordStore small(&pool);
+        small.Append(1, data.data(), data.size());
+        REQUIRE(small.GetReservedSize() == kSmallBlockSize);
+    }
+
+    auto usage = pool.GetMemoryUsage();
+    REQUIRE(usage.in_use_size == 0);
+    REQUIRE(usage.idle_size == kSmallBlockSize);
+
+    {
+        // The small block holds 4 records and each large block holds 64 records.
+        CommandRecordStore first(&pool);
+        for (size_t i = 0; i < 300; ++i)
+        {
+            first.Append(1, data.data(), data.size());
+        }
+
+        usage = pool.GetMemoryUsage();
+        REQUIRE(usage.reuse_count == 1);
+        REQUIRE(usage.allocation_count == 6);
+        REQUIRE(usage.in_use_size == (kSmallBlockSize + (kBlockSize * 5)));
+
+        // Clearing keeps the small block and returns the large blocks to the pool, which only keeps enough of them to
+        // stay within its idle memory limit.
+        first.Clear();
+        REQUIRE(first.IsEmpty());
+        REQUIRE(first.GetReservedSize() == kSmallBlockSize);
+
+        usage = pool.GetMemoryUsage();
+        REQUIRE(usage.in_use_size == kSmallBlockSize);
+        REQUIRE(usage.peak_in_use_size == (kSmallBlockSize + (kBlockSize * 5)));
+        REQUIRE(usage.idle_size == (kBlockSize * 2));
+
+        // Recording again into the cleared store reuses its block.
+        first.Append(2, data.data(), data.size());
+        REQUIRE(pool.GetMemoryUsage().allocation_count == 6);
+        REQUIRE(GetRecords(first).size() == 1);
+    }
+
+    // The small block of the destroyed store was freed because the pool was at its idle memory limit. Another store
+    // reuses the idle large blocks and allocates a new small block.
+    CommandRecordStore second(&pool);
+    for (size_t i = 0; i < 100; ++i)
+    {
+        second.Append(3, data.data(), data.size());
+    }
+
+    usage = pool.GetMemoryUsage();
+    REQUIRE(usage.reuse_count == 3);
+    REQUIRE(usage.allocation_count == 7);
+    REQUIRE(usage.in_use_size == second.GetReservedSize());
+    REQUIRE(usage.idle_size == 0);
+}
+
+GFXRECON_END_NAMESPACE(test)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,273 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/delta_encoder.h"
+#include "util/logging.h"
+
+#include <catch2/catch.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(test)
+
+struct DecodedSpan
+{
+    uint64_t offset;
+    size_t   size;
+};
+
+static std::vector<DecodedSpan> DecodeSpans(const std::vector<uint8_t>& encoded, size_t encoded_size, uint64_t size)
+{
+    std::vector<DecodedSpan> spans;
+    bool                     success = DeltaEncoder::VisitSpans(
+        encoded.data(), encoded_size, size, [&spans](uint64_t offset, size_t span_size, const uint8_t*) {
+            spans.push_back({ offset, span_size });
+        });
+    REQUIRE(success);
+    return spans;
+}
+
+TEST_CASE("DeltaEncoder encodes only the bytes that changed", "[delta_encoder]")
+{
+    DeltaEncoder         encoder;
+    std::vector<uint8_t> data(1024);
+    std::vector<uint8_t> encoded;
+    size_t               encoded_size = 0;
+
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<uint8_t>(i);
+    }
+
+    // The first write has no baseline, so all data is changed.
+    REQUIRE(encoder.Encode(1, 0, data.size(), data.data(), 2 * data.size(), &encoded, 0, &encoded_size));
+    auto spans = DecodeSpans(encoded, encoded_size, data.size());
+    REQUIRE(spans.size() == 1);
+    REQUIRE(spans[0].offset == 0);
+    REQUIRE(spans[0].size == data.size());
+
+    // Identical data produces no spans.
+    REQUIRE(encoder.Encode(1, 0, data.size(), data.data(), data.size(), &encoded, 0, &encoded_size));
+    REQUIRE(encoded_size == 0);
+
+    // Changes separated by short unchanged runs are merged, distant changes are separate spans.
+    data[10] ^= 1;
+    data[12] ^= 1;
+    data[500] ^= 1;
+    REQUIRE(encoder.Encode(1, 0, data.size(), data.data(), data.size(), &encoded, 4, &encoded_size));
+    REQUIRE(encoded_size == 2 * sizeof(DeltaEncoder::SpanHeader) + 4);
+    encoded.erase(encoded.begin(), encoded.begin() + 4);
+    spans = DecodeSpans(encoded, encoded_size, data.size());
+    REQUIRE(spans.size() == 2);
+    REQUIRE(spans[0].offset == 10);
+    REQUIRE(spans[0].size == 3);
+    REQUIRE(spans[1].offset == 500);
+    REQUIRE(spans[1].size == 1);
+
+    // Bytes that were not previously written are always changed, even if they match the baseline storage.
+    std::vector<uint8_t> partial(data.begin() + 512, data.end());
+    REQUIRE(encoder.Encode(2, 0, 512, data.data(), data.size(), &encoded, 0, &encoded_size));
+    REQUIRE(encoder.Encode(2, 512, 512, partial.data(), data.size(), &encoded, 0, &encoded_size));
+    REQUIRE(encoder.Encode(2, 256, 512, data.data() + 256, data.size(), &encoded, 0, &encoded_size));
+    REQUIRE(encoded_size == 0);
+
+    // When the encoded data is too large, the baseline is still updated.
+    std::vector<uint8_t> inverted(data);
+    for (auto& value : inverted)
+    {
+        value = ~value;
+    }
+
+    REQUIRE(!encoder.Encode(1, 0, inverted.size(), inverted.data(), inverted.size(), &encoded, 0, &encoded_size));
+    REQUIRE(encoder.Encode(1, 0, inverted.size(), inverted.data(), inverted.size(), &encoded, 0, &encoded_size));
+    REQUIRE(encoded_size == 0);
+
+    // Removing the baseline makes all data changed again.
+    encoder.RemoveBaseline(1);
+    REQUIRE(encoder.Encode(1, 0, inverted.size(), inverted.data(), 2 * data.size(), &encoded, 0, &encoded_size));
+    REQUIRE(encoded_size == sizeof(DeltaEncoder::SpanHeader) + inverted.size());
+}
+
+TEST_CASE("DeltaEncoder only stores baseline data for written blocks", "[delta_encoder]")
+{
+    const uint64_t kLargeOffset = 1ull << 30;
+    const size_t   kBlockSize   = DeltaEncoder::kBaselineBlockSize;
+
+    DeltaEncoder         encoder;
+    std::vector<uint8_t> data(4096, 0x5a);
+    std::vector<uint8_t> encoded;
+    size_t               encoded_size = 0;
+
+    // A write near the end of a large memory object only allocates the block that contains it.
+    REQUIRE(encoder.Encode(1, kLargeOffset, data.size(), data.data(), 2 * data.size(), &encoded, 0, &encoded_size));
+    REQUIRE(encoder.GetBaselineSize() == kBlockSize);
+
+    // A write that straddles a block boundary allocates both blocks.
+    uint64_t straddle_offset = kLargeOffset + (4 * kBlockSize) - (data.size() / 2);
+    REQUIRE(
+        encoder.Encode(1, straddle_offset, data.size(), data.data(), 2 * data.size(), &encoded, 0, &encoded_size));
+    REQUIRE(encoder.GetBaselineSize() == (3 * kBlockSize));
+
+    data[0] ^= 1;
+    data[data.size() - 1] ^= 1;
+    REQUIRE(
+        encoder.Encode(1, straddle_offset, data.size(), data.data(), 2 * data.size(), &encoded, 0, &encoded_size));
+    auto spans = DecodeSpans(encoded, encoded_size, data.size());
+    REQUIRE(spans.size() == 2);
+    REQUIRE(spans[0].offset == 0);
+    REQUIRE(spans[1].offset == (data.size() - 1));
+
+    encoder.RemoveBaseline(1);
+    REQUIRE(encoder.GetBaselineSize() == 0);
+}
+
+TEST_CASE("DeltaEncoder rejects malformed span data", "[delta_encoder]")
+{
+    std::vector<uint8_t>     encoded(sizeof(DeltaEncoder::SpanHeader) + 4);
+    DeltaEncoder::SpanHeader span{ 60, 4 };
+    memcpy(encoded.data(), &span, sizeof(span));
+
+    auto visitor = [](uint64_t, size_t, const uint8_t*) {};
+
+    REQUIRE(DeltaEncoder::VisitSpans(encoded.data(), encoded.size(), 64, visitor));
+    REQUIRE(!DeltaEncoder::VisitSpans(encoded.data(), encoded.size(), 63, visitor));
+    REQUIRE(!DeltaEncoder::VisitSpans(encoded.data(), encoded.size() - 1, 64, visitor));
+    REQUIRE(!DeltaEncoder::VisitSpans(encoded.data(), sizeof(span) - 1, 64, visitor));
+}
+
+TEST_CASE("DeltaEncoder spans reproduce random writes", "[delta_encoder]")
+{
+    const size_t kMemorySize = 64 * 1024;
+
+    std::mt19937                          generator(0);
+    std::uniform_int_distribution<size_t> offset_distribution(0, kMemorySize - 1);
+    std::uniform_int_distribution<size_t> size_distribution(1, 4096);
+    std::uniform_int_distribution<int>    change_distribution(0, 15);
+    std::vector<uint8_t>                  memory(kMemorySize, 0);
+    std::vector<uint8_t>                  replay_memory(kMemorySize, 0xcd);
+    std::vector<uint8_t>                  encoded;
+    DeltaEncoder                          encoder;
+
+    for (uint32_t i = 0; i < 2000; ++i)
+    {
+        size_t offset = offset_distribution(generator);
+        size_t size   = std::min(size_distribution(generator), kMemorySize - offset);
+
+        // Modify a few bytes of the range before writing it, as an application updating a uniform buffer would.
+        for (size_t j = 0; j < size; ++j)
+        {
+            if (change_distribution(generator) == 0)
+            {
+                memory[offset + j] = static_cast<uint8_t>(generator());
+            }
+        }
+
+        if ((i % 500) == 499)
+        {
+            encoder.RemoveBaseline(0);
+        }
+
+        size_t encoded_size = 0;
+        if (encoder.Encode(0, offset, size, memory.data() + offset, size, &encoded, 0, &encoded_size))
+        {
+            bool success = DeltaEncoder::VisitSpans(
+                encoded.data(),
+                encoded_size,
+                size,
+                [&replay_memory, offset](uint64_t span_offset, size_t span_size, const uint8_t* span_data) {
+                    memcpy(replay_memory.data() + offset + span_offset, span_data, span_size);
+                });
+            REQUIRE(success);
+        }
+        else
+        {
+            memcpy(replay_memory.data() + offset, memory.data() + offset, size);
+        }
+
+        REQUIRE(memcmp(replay_memory.data() + offset, memory.data() + offset, size) == 0);
+    }
+}
+
+// Measures the fill memory data written for a uniform buffer that is rewritten every frame with a few changed values.
+// Run explicitly with: gfxrecon_util_test "[delta_encoder][benchmark]"
+TEST_CASE("DeltaEncoder uniform buffer benchmark", "[delta_encoder][benchmark][.]")
+{
+    const size_t   kBufferSize      = 256 * 1024;
+    const size_t   kChangedPerFrame = 512;
+    const uint32_t kFrameCount      = 1000;
+
+    std::mt19937                          generator(0);
+    std::uniform_int_distribution<size_t> offset_distribution(0, (kBufferSize / sizeof(float)) - 1);
+    std::vector<float>                    buffer(kBufferSize / sizeof(float), 1.0f);
+    std::vector<uint8_t>                  encoded;
+    DeltaEncoder                          encoder;
+    size_t                                delta_written = 0;
+
+    auto start_time = std::chrono::steady_clock::now();
+
+    for (uint32_t frame = 0; frame < kFrameCount; ++frame)
+    {
+        for (size_t i = 0; i < kChangedPerFrame; ++i)
+        {
+            buffer[offset_distribution(generator)] = static_cast<float>(frame);
+        }
+
+        // Fall back to the full data when the delta is not smaller, as capture does.
+        size_t encoded_size = 0;
+        if (encoder.Encode(0,
+                           0,
+                           kBufferSize,
+                           reinterpret_cast<const uint8_t*>(buffer.data()),
+                           (kBufferSize * 3) / 4,
+                           &encoded,
+                           0,
+                           &encoded_size))
+        {
+            delta_written += encoded_size;
+        }
+        else
+        {
+            delta_written += kBufferSize;
+        }
+    }
+
+    auto encode_time = std::chrono::steady_clock::now() - start_time;
+
+    GFXRECON_WRITE_CONSOLE("DeltaEncoder: %u frames of a %zu KB uniform buffer, full fills %zu MB, "
+                           "delta fills %.1f MB, encode %.3f ms",
+                           kFrameCount,
+                           kBufferSize >> 10,
+                           (kBufferSize * kFrameCount) >> 20,
+                           static_cast<double>(delta_written) / (1024.0 * 1024.0),
+                           std::chrono::duration<double, std::milli>(encode_time).count());
+}
+
+GFXRECON_END_NAMESPACE(test)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,255 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/dense_id_map.h"
+#include "util/logging.h"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(test)
+
+TEST_CASE("DenseIdMap stores values by ID", "[dense_id_map]")
+{
+    DenseIdMap<std::string> id_map;
+
+    std::string* first = id_map.Insert(7, "seven");
+    REQUIRE(first != nullptr);
+    REQUIRE(id_map.Insert(3000, "three thousand") != nullptr);
+    REQUIRE(id_map.Insert(uint64_t{ 1 } << 40, "sparse") != nullptr);
+    REQUIRE(id_map.GetSize() == 3);
+
+    // Zero and duplicate IDs are rejected without moving from the value.
+    std::string duplicate = "duplicate";
+    REQUIRE(id_map.Insert(0, std::move(duplicate)) == nullptr);
+    REQUIRE(id_map.Insert(7, std::move(duplicate)) == nullptr);
+    REQUIRE(duplicate == "duplicate");
+
+    REQUIRE(id_map.Find(7) == first);
+    REQUIRE(*id_map.Find(3000) == "three thousand");
+    REQUIRE(*id_map.Find(uint64_t{ 1 } << 40) == "sparse");
+    REQUIRE(id_map.Find(0) == nullptr);
+    REQUIRE(id_map.Find(8) == nullptr);
+    REQUIRE(id_map.Find(1000000) == nullptr);
+
+    REQUIRE(id_map.Remove(3000));
+    REQUIRE_FALSE(id_map.Remove(3000));
+    REQUIRE(id_map.Remove(uint64_t{ 1 } << 40));
+    REQUIRE(id_map.Find(3000) == nullptr);
+    REQUIRE(id_map.Find(uint64_t{ 1 } << 40) == nullptr);
+    REQUIRE(id_map.GetSize() == 1);
+
+    id_map.Clear();
+    REQUIRE(id_map.GetSize() == 0);
+    REQUIRE(id_map.Find(7) == nullptr);
+}
+
+TEST_CASE("DenseIdMap keeps values at stable addresses", "[dense_id_map]")
+{
+    DenseIdMap<uint64_t>                     id_map;
+    std::unordered_map<uint64_t, uint64_t*> addresses;
+
+    for (uint64_t id = 1; id <= 10000; ++id)
+    {
+        addresses[id] = id_map.Insert(id * 3, id * 10);
+    }
+
+    // Removed slots are reused without moving the remaining values.
+    for (uint64_t id = 1; id <= 10000; id += 2)
+    {
+        REQUIRE(id_map.Remove(id * 3));
+        addresses.erase(id);
+    }
+
+    for (uint64_t id = 10001; id <= 15000; ++id)
+    {
+        addresses[id] = id_map.Insert(id * 3, id * 10);
+    }
+
+    REQUIRE(id_map.GetSize() == addresses.size());
+
+    for (const auto& entry : addresses)
+    {
+        REQUIRE(id_map.Find(entry.first * 3) == entry.second);
+        REQUIRE(*entry.second == entry.first * 10);
+    }
+
+    size_t visited = 0;
+    for (auto& entry : id_map)
+    {
+        REQUIRE(entry.second == (entry.first / 3) * 10);
+        ++visited;
+    }
+    REQUIRE(visited == id_map.GetSize());
+}
+
+TEST_CASE("DenseIdMap frees pages when their IDs are removed", "[dense_id_map]")
+{
+    DenseIdMap<uint64_t> id_map;
+    uint64_t             next_id = 1;
+
+    // Create and destroy objects with IDs from an increasing counter, keeping a small number of objects alive.
+    for (uint32_t round = 0; round < 1000; ++round)
+    {
+        std::vector<uint64_t> ids;
+
+        for (uint32_t i = 0; i < 1000; ++i)
+        {
+            ids.push_back(next_id);
+            REQUIRE(id_map.Insert(next_id, next_id * 10) != nullptr);
+            ++next_id;
+        }
+
+        REQUIRE(id_map.GetPageCount() <= 3);
+
+        for (uint64_t id : ids)
+        {
+            REQUIRE(id_map.Remove(id));
+        }
+    }
+
+    REQUIRE(id_map.GetSize() == 0);
+    REQUIRE(id_map.GetPageCount() == 0);
+
+    // A page is kept while any of its IDs is live, and the remaining value is still found.
+    REQUIRE(id_map.Insert(next_id, 1) != nullptr);
+    REQUIRE(id_map.Insert(next_id + 1, 2) != nullptr);
+    REQUIRE(id_map.GetPageCount() >= 1);
+    REQUIRE(id_map.Remove(next_id));
+    REQUIRE(*id_map.Find(next_id + 1) == 2);
+    REQUIRE(id_map.Remove(next_id + 1));
+    REQUIRE(id_map.GetPageCount() == 0);
+    REQUIRE(id_map.Find(next_id + 1) == nullptr);
+}
+
+// Compares the handle ID to object info lookup performed by the replay consumer for each decoded handle, with object
+// info stored in an unordered_map and in a DenseIdMap. IDs are allocated from a counter shared by all object types, in
+// bursts of objects of the same type, and the decoded calls of a frame reference a subset of the objects. Run
+// explicitly with: gfxrecon_util_test "[dense_id_map][benchmark]"
+TEST_CASE("DenseIdMap decode and map benchmark", "[dense_id_map][benchmark][.]")
+{
+    struct ObjectInfo
+    {
+        uint64_t capture_id;
+        uint64_t handle;
+        uint8_t  data[112];
+    };
+
+    const uint64_t kIdCount          = 800000;
+    const uint32_t kTypeCount        = 8;
+    const uint32_t kMaxBurstSize     = 16;
+    const size_t   kFrameObjectCount = 4096;
+    const size_t   kCallCount        = 1000000;
+    const size_t   kHandleCount      = 4;
+
+    std::unordered_map<uint64_t, ObjectInfo> hash_map;
+    DenseIdMap<ObjectInfo>                   dense_map;
+    std::vector<uint64_t>                    ids;
+    std::mt19937                             generator(0);
+
+    for (uint64_t id = 1; id <= kIdCount;)
+    {
+        // Store the IDs of one object type, skipping the IDs of the other types.
+        bool     store_ids  = (generator() % kTypeCount) == 0;
+        uint32_t burst_size = 1 + (generator() % kMaxBurstSize);
+
+        for (uint32_t i = 0; i < burst_size; ++i, ++id)
+        {
+            if (store_ids)
+            {
+                ObjectInfo info{ id, id ^ 0x5a5a5a5a, {} };
+                hash_map.emplace(id, info);
+                dense_map.Insert(id, std::move(info));
+                ids.push_back(id);
+            }
+        }
+    }
+
+    std::vector<uint64_t> frame_ids(kFrameObjectCount);
+    std::sample(ids.begin(), ids.end(), frame_ids.begin(), kFrameObjectCount, generator);
+
+    // Encode the handle IDs of the decoded calls, as they are in the capture file parameter buffers.
+    std::uniform_int_distribution<size_t> distribution(0, kFrameObjectCount - 1);
+    std::vector<uint8_t>                  parameter_data(kCallCount * kHandleCount * sizeof(uint64_t));
+
+    for (size_t i = 0; i < (kCallCount * kHandleCount); ++i)
+    {
+        uint64_t id = frame_ids[distribution(generator)];
+        memcpy(&parameter_data[i * sizeof(id)], &id, sizeof(id));
+    }
+
+    uint64_t hash_result = 0;
+    auto     start_time  = std::chrono::steady_clock::now();
+
+    for (size_t offset = 0; offset < parameter_data.size(); offset += sizeof(uint64_t))
+    {
+        uint64_t id = 0;
+        memcpy(&id, &parameter_data[offset], sizeof(id));
+
+        auto entry = hash_map.find(id);
+        if (entry != hash_map.end())
+        {
+            hash_result += entry->second.handle;
+        }
+    }
+
+    auto     hash_time    = std::chrono::steady_clock::now() - start_time;
+    uint64_t dense_result = 0;
+    start_time            = std::chrono::steady_clock::now();
+
+    for (size_t offset = 0; offset < parameter_data.size(); offset += sizeof(uint64_t))
+    {
+        uint64_t id = 0;
+        memcpy(&id, &parameter_data[offset], sizeof(id));
+
+        const ObjectInfo* info = dense_map.Find(id);
+        if (info != nullptr)
+        {
+            dense_result += info->handle;
+        }
+    }
+
+    auto dense_time = std::chrono::steady_clock::now() - start_time;
+
+    REQUIRE(hash_result == dense_result);
+
+    GFXRECON_WRITE_CONSOLE("DenseIdMap: %zu handle lookups in %zu objects, unordered_map %.3f ms, DenseIdMap %.3f ms",
+                           kCallCount * kHandleCount,
+                           ids.size(),
+                           std::chrono::duration<double, std::milli>(hash_time).count(),
+                           std::chrono::duration<double, std::milli>(dense_time).count());
+}
+
+GFXRECON_END_NAMESPACE(test)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
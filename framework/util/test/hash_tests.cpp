@@ -0,0 +1,93 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/hash.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(test)
+
+TEST_CASE("GenerateContentHash produces stable MurmurHash64A values", "[hash]")
+{
+    // Asset files identify resource data by these values, so they must not change between versions.
+    const char    text[] = "gfxreconstruct";
+    const size_t  size   = sizeof(text) - 1;
+    const uint8_t word[] = { '1', '2', '3', '4', '5', '6', '7', '8' };
+
+    std::vector<uint8_t> sequence(64);
+    for (size_t i = 0; i < sequence.size(); ++i)
+    {
+        sequence[i] = static_cast<uint8_t>(i);
+    }
+
+    REQUIRE(hash::GenerateContentHash(nullptr, 0) == 0);
+    REQUIRE(hash::GenerateContentHash(text, size) == 0x87af5448eafcffe2ULL);
+    REQUIRE(hash::GenerateContentHash(text, size, 1) == 0x1f92ce3e0c0e3cb1ULL);
+    REQUIRE(hash::GenerateContentHash(word, sizeof(word)) == 0x758f67d162b2d202ULL);
+    REQUIRE(hash::GenerateContentHash(sequence.data(), sequence.size()) == 0xf22ae58d36c6dd7eULL);
+
+    // The hash only depends on the content, not the address of the data.
+    std::vector<uint8_t> copy(sequence);
+    REQUIRE(hash::GenerateContentHash(copy.data(), copy.size()) ==
+            hash::GenerateContentHash(sequence.data(), sequence.size()));
+}
+
+TEST_CASE("GenerateContentHash distinguishes different data", "[hash]")
+{
+    std::vector<uint8_t> data(4096, 0);
+    std::set<uint64_t>   hashes;
+
+    hashes.insert(hash::GenerateContentHash(data.data(), data.size()));
+
+    // Flipping any single bit of the data changes the hash.
+    for (size_t i = 0; i < data.size(); i += 61)
+    {
+        for (uint8_t bit = 0; bit < 8; ++bit)
+        {
+            data[i] ^= static_cast<uint8_t>(1 << bit);
+            REQUIRE(hashes.insert(hash::GenerateContentHash(data.data(), data.size())).second);
+            data[i] ^= static_cast<uint8_t>(1 << bit);
+        }
+    }
+
+    // Data that only differs in size, including in the trailing bytes that do not fill a word, has different hashes.
+    for (size_t size = 1; size < 64; ++size)
+    {
+        REQUIRE(hashes.insert(hash::GenerateContentHash(data.data(), size)).second);
+    }
+
+    // Different seeds produce different hashes for the same data.
+    REQUIRE(hash::GenerateContentHash(data.data(), data.size(), 1) !=
+            hash::GenerateContentHash(data.data(), data.size(), 2));
+}
+
+GFXRECON_END_NAMESPACE(test)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,198 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/image_writer_queue.h"
+#include "util/logging.h"
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(test)
+
+TEST_CASE("ImageWriterQueue writes on the queuing thread without workers", "[image_writer_queue]")
+{
+    ImageWriterQueue queue(0);
+    std::vector<int> written;
+
+    for (int i = 0; i < 8; ++i)
+    {
+        queue.Post([&written, i]() { written.push_back(i); });
+
+        // Each write completes before Post returns.
+        REQUIRE(written.size() == static_cast<size_t>(i + 1));
+    }
+
+    REQUIRE(written == std::vector<int>{ 0, 1, 2, 3, 4, 5, 6, 7 });
+}
+
+TEST_CASE("ImageWriterQueue starts writes in the order that they were queued", "[image_writer_queue]")
+{
+    const int kWriteCount = 64;
+
+    std::mutex       written_lock;
+    std::vector<int> written;
+
+    {
+        // With a single worker, writes run one at a time in queue order.
+        ImageWriterQueue queue(1, 4);
+
+        for (int i = 0; i < kWriteCount; ++i)
+        {
+            queue.Post([&written_lock, &written, i]() {
+                std::lock_guard<std::mutex> lock(written_lock);
+                written.push_back(i);
+            });
+        }
+
+        queue.Flush();
+    }
+
+    REQUIRE(written.size() == kWriteCount);
+    for (int i = 0; i < kWriteCount; ++i)
+    {
+        REQUIRE(written[i] == i);
+    }
+}
+
+TEST_CASE("ImageWriterQueue completes pending writes on flush and destruction", "[image_writer_queue]")
+{
+    const int kWriteCount = 32;
+
+    std::atomic<int> completed{ 0 };
+
+    auto slow_write = [&completed]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        ++completed;
+    };
+
+    SECTION("Flush")
+    {
+        ImageWriterQueue queue(4);
+
+        for (int i = 0; i < kWriteCount; ++i)
+        {
+            queue.Post(slow_write);
+        }
+
+        queue.Flush();
+        REQUIRE(completed == kWriteCount);
+
+        // The queue can be used again after a flush.
+        queue.Post(slow_write);
+        queue.Flush();
+        REQUIRE(completed == kWriteCount + 1);
+    }
+
+    SECTION("Destruction")
+    {
+        {
+            ImageWriterQueue queue(4);
+
+            for (int i = 0; i < kWriteCount; ++i)
+            {
+                queue.Post(slow_write);
+            }
+        }
+
+        REQUIRE(completed == kWriteCount);
+    }
+}
+
+TEST_CASE("ImageWriterQueue rethrows write errors on flush", "[image_writer_queue]")
+{
+    gfxrecon::util::Log::Init(gfxrecon::util::Log::kErrorSeverity);
+
+    std::atomic<int> completed{ 0 };
+
+    auto write        = [&completed]() { ++completed; };
+    auto failed_write = []() { throw std::runtime_error("write failed"); };
+
+    SECTION("Without workers")
+    {
+        ImageWriterQueue queue(0);
+
+        REQUIRE_THROWS_AS(queue.Post(failed_write), std::runtime_error);
+
+        queue.Post(write);
+        REQUIRE(completed == 1);
+    }
+
+    SECTION("Flush")
+    {
+        ImageWriterQueue queue(2, 64);
+
+        queue.Post(write);
+        queue.Post(failed_write);
+        queue.Post(write);
+        queue.Post(failed_write);
+        queue.Post(write);
+
+        // The error is reported once all of the writes, including those after the failed write, have completed.
+        REQUIRE_THROWS_WITH(queue.Flush(), "write failed");
+        REQUIRE(completed == 3);
+
+        // The errors were consumed by the flush.
+        REQUIRE_NOTHROW(queue.Flush());
+    }
+
+    SECTION("Post")
+    {
+        // With room for a single pending write, each Post waits for the previous write to complete. The error of a
+        // write that completed during a Post is kept for the next flush.
+        ImageWriterQueue queue(1, 1);
+
+        queue.Post(failed_write);
+        REQUIRE_NOTHROW(queue.Post(write));
+        REQUIRE_NOTHROW(queue.Post(write));
+
+        REQUIRE_THROWS_WITH(queue.Flush(), "write failed");
+        REQUIRE(completed == 2);
+    }
+
+    SECTION("Destruction")
+    {
+        {
+            ImageWriterQueue queue(2);
+
+            queue.Post(failed_write);
+            queue.Post(write);
+        }
+
+        // The error is logged by the destructor, which still waits for the remaining writes.
+        REQUIRE(completed == 1);
+    }
+
+    gfxrecon::util::Log::Release();
+}
+
+GFXRECON_END_NAMESPACE(test)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
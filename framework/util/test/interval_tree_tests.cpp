@@ -0,0 +1,226 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/interval_tree.h"
+#include "util/logging.h"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(test)
+
+typedef IntervalTree<uint64_t, uint32_t> TestTree;
+
+static std::vector<uint32_t> GetOverlapping(const TestTree& tree, uint64_t start, uint64_t end)
+{
+    std::vector<uint32_t> values;
+    tree.VisitOverlapping(start, end, [&values](uint64_t, uint64_t, uint32_t value) { values.push_back(value); });
+    return values;
+}
+
+TEST_CASE("IntervalTree visits the intervals that intersect a range", "[interval_tree]")
+{
+    TestTree tree;
+
+    tree.Insert(0x2000, 0x3000, 2);
+    tree.Insert(0x0000, 0x1000, 0);
+    tree.Insert(0x1000, 0x2000, 1);
+    tree.Insert(0x0000, 0x8000, 7); // Aliases the whole range.
+    tree.Insert(0x5000, 0x5000, 9); // Empty intervals are not added.
+    REQUIRE(tree.GetSize() == 4);
+
+    // Intervals are visited in order of increasing start, and range ends are exclusive.
+    REQUIRE(GetOverlapping(tree, 0x0800, 0x1001) == std::vector<uint32_t>{ 0, 7, 1 });
+    REQUIRE(GetOverlapping(tree, 0x1000, 0x2000) == std::vector<uint32_t>{ 7, 1 });
+    REQUIRE(GetOverlapping(tree, 0x3000, 0x4000) == std::vector<uint32_t>{ 7 });
+    REQUIRE(GetOverlapping(tree, 0x8000, 0x9000).empty());
+    REQUIRE(GetOverlapping(tree, 0x1000, 0x1000).empty());
+}
+
+TEST_CASE("IntervalTree removes intervals by start and value", "[interval_tree]")
+{
+    TestTree tree;
+
+    tree.Insert(0x1000, 0x2000, 1);
+    tree.Insert(0x1000, 0x3000, 2);
+
+    REQUIRE_FALSE(tree.Erase(0x1000, 3));
+    REQUIRE_FALSE(tree.Erase(0x2000, 1));
+    REQUIRE(tree.Erase(0x1000, 1));
+    REQUIRE_FALSE(tree.Erase(0x1000, 1));
+    REQUIRE(tree.GetSize() == 1);
+    REQUIRE(GetOverlapping(tree, 0x1000, 0x1001) == std::vector<uint32_t>{ 2 });
+
+    tree.Clear();
+    REQUIRE(tree.IsEmpty());
+    REQUIRE(GetOverlapping(tree, 0x0000, 0x4000).empty());
+}
+
+TEST_CASE("IntervalTree matches a linear scan after random updates", "[interval_tree]")
+{
+    struct Interval
+    {
+        uint64_t start;
+        uint64_t end;
+    };
+
+    std::mt19937                            generator(1);
+    std::uniform_int_distribution<uint64_t> offset_distribution(0, 1 << 20);
+    std::uniform_int_distribution<uint64_t> size_distribution(1, 1 << 14);
+    std::unordered_map<uint32_t, Interval>  intervals;
+    TestTree                                tree;
+    uint32_t                                next_value = 0;
+
+    for (uint32_t i = 0; i < 4000; ++i)
+    {
+        if (!intervals.empty() && ((generator() % 3) == 0))
+        {
+            auto entry = intervals.begin();
+            std::advance(entry, generator() % intervals.size());
+            REQUIRE(tree.Erase(entry->second.start, entry->first));
+            intervals.erase(entry);
+        }
+        else
+        {
+            uint64_t start = offset_distribution(generator);
+            uint64_t end   = start + size_distribution(generator);
+            tree.Insert(start, end, next_value);
+            intervals[next_value++] = Interval{ start, end };
+        }
+
+        uint64_t query_start = offset_distribution(generator);
+        uint64_t query_end   = query_start + size_distribution(generator);
+
+        std::vector<uint32_t> expected;
+        for (const auto& entry : intervals)
+        {
+            if ((entry.second.start < query_end) && (query_start < entry.second.end))
+            {
+                expected.push_back(entry.first);
+            }
+        }
+
+        std::vector<uint32_t> actual = GetOverlapping(tree, query_start, query_end);
+
+        std::sort(expected.begin(), expected.end());
+        std::sort(actual.begin(), actual.end());
+        REQUIRE(tree.GetSize() == intervals.size());
+        REQUIRE(actual == expected);
+    }
+}
+
+// Compares the search performed by VulkanRebindAllocator for each mapped memory write to a heap with many bound
+// resources, before and after the bound resources were indexed. One buffer aliases the whole heap, as with engines
+// that sub-allocate from a heap-sized buffer. Run explicitly with: gfxrecon_util_test "[interval_tree][benchmark]"
+TEST_CASE("IntervalTree mapped memory write benchmark", "[interval_tree][benchmark][.]")
+{
+    struct BoundResource
+    {
+        uint64_t original_offset;
+        uint64_t size;
+    };
+
+    const size_t   kResourceCount = 8192;
+    const size_t   kWriteCount    = 20000;
+    const uint64_t kResourceSize  = 64 * 1024;
+    const uint64_t kHeapSize      = kResourceCount * kResourceSize;
+    const uint64_t kMaxWriteSize  = 16 * 1024;
+
+    std::unordered_map<uint64_t, BoundResource>  bound_resources;
+    IntervalTree<uint64_t, const BoundResource*> resource_index;
+
+    for (size_t i = 0; i < kResourceCount; ++i)
+    {
+        bound_resources.emplace(i, BoundResource{ i * kResourceSize, kResourceSize });
+    }
+
+    bound_resources.emplace(kResourceCount, BoundResource{ 0, kHeapSize });
+
+    for (const auto& entry : bound_resources)
+    {
+        const BoundResource& resource = entry.second;
+        resource_index.Insert(resource.original_offset, resource.original_offset + resource.size, &resource);
+    }
+
+    std::mt19937                               generator(0);
+    std::uniform_int_distribution<uint64_t>    offset_distribution(0, kHeapSize - kMaxWriteSize);
+    std::uniform_int_distribution<uint64_t>    size_distribution(1, kMaxWriteSize);
+    std::vector<std::pair<uint64_t, uint64_t>> writes(kWriteCount);
+
+    for (auto& write : writes)
+    {
+        write.first  = offset_distribution(generator);
+        write.second = write.first + size_distribution(generator);
+    }
+
+    uint64_t linear_updated = 0;
+    auto     start_time     = std::chrono::steady_clock::now();
+
+    for (const auto& write : writes)
+    {
+        for (const auto& entry : bound_resources)
+        {
+            const BoundResource& resource = entry.second;
+            if ((resource.original_offset < write.second) &&
+                (write.first < (resource.original_offset + resource.size)))
+            {
+                linear_updated += resource.original_offset;
+            }
+        }
+    }
+
+    auto     linear_time   = std::chrono::steady_clock::now() - start_time;
+    uint64_t index_updated = 0;
+    start_time             = std::chrono::steady_clock::now();
+
+    for (const auto& write : writes)
+    {
+        resource_index.VisitOverlapping(
+            write.first, write.second, [&index_updated](uint64_t, uint64_t, const BoundResource* resource) {
+                index_updated += resource->original_offset;
+            });
+    }
+
+    auto index_time = std::chrono::steady_clock::now() - start_time;
+
+    REQUIRE(linear_updated == index_updated);
+
+    GFXRECON_WRITE_CONSOLE("IntervalTree: %zu writes to a heap with %zu resources, linear scan %.3f ms, "
+                           "interval tree %.3f ms",
+                           kWriteCount,
+                           bound_resources.size(),
+                           std::chrono::duration<double, std::milli>(linear_time).count(),
+                           std::chrono::duration<double, std::milli>(index_time).count());
+}
+
+GFXRECON_END_NAMESPACE(test)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
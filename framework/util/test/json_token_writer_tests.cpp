@@ -0,0 +1,208 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/json_token_writer.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <string>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(test)
+
+// Run the same population code on a tree and on a JsonTokenWriter and check the writer produces the text of the
+// dumped tree, in both the pretty and compact forms.
+template <typename Populate>
+static void CheckMatchesTree(Populate populate)
+{
+    nlohmann::ordered_json tree;
+    populate(tree);
+
+    JsonTokenWriter writer;
+    for (const int indent : { 2, -1 })
+    {
+        std::string output;
+        populate(writer.Begin(&output, indent));
+        writer.End();
+        REQUIRE(output == tree.dump(indent));
+    }
+}
+
+TEST_CASE("JsonTokenWriter writes scalars like the JSON library", "[json_token_writer]")
+{
+    CheckMatchesTree([](auto& root) {
+        root["zero"]    = 0;
+        root["short"]   = static_cast<short>(-300);
+        root["int_min"] = std::numeric_limits<int64_t>::min();
+        root["u64_max"] = std::numeric_limits<uint64_t>::max();
+        root["byte"]    = static_cast<uint8_t>(255);
+        root["true"]    = true;
+        root["false"]   = false;
+        root["null"]    = nullptr;
+    });
+
+    CheckMatchesTree([](auto& root) {
+        root["float"]      = 0.1f;
+        root["double"]     = 0.1;
+        root["integral"]   = 1.0;
+        root["negative"]   = -0.0;
+        root["large"]      = 1e20;
+        root["small"]      = 1.5e-7f;
+        root["max"]        = std::numeric_limits<float>::max();
+        root["denormal"]   = std::numeric_limits<float>::denorm_min();
+        root["nan"]        = std::numeric_limits<double>::quiet_NaN();
+        root["infinity"]   = std::numeric_limits<float>::infinity();
+        root["double_max"] = std::numeric_limits<double>::max();
+    });
+
+    CheckMatchesTree([](auto& root) {
+        root["empty"]    = "";
+        root["plain"]    = "VK_FORMAT_R8G8B8A8_UNORM";
+        root["quote"]    = std::string("say \"hi\"");
+        root["escapes"]  = std::string_view("back\\slash\ttab\nnewline\x01\x1f\x7f");
+        root["utf8"]     = "caf\xc3\xa9 \xe2\x82\xac";
+        root["k\"ey\n"] = "escaped key";
+    });
+
+    CheckMatchesTree([](auto& root) { root = 42; });
+    CheckMatchesTree([](auto& root) { root = "top-level string"; });
+}
+
+TEST_CASE("JsonTokenWriter writes nested values like the JSON library", "[json_token_writer]")
+{
+    CheckMatchesTree([](auto& root) {
+        root["index"] = 17;
+        auto& function     = root["function"];
+        function["name"]   = "vkCmdDraw";
+        function["thread"] = 1;
+        auto& args         = function["args"];
+        args["count"]      = 3;
+        for (size_t i = 0; i < 3; ++i)
+        {
+            auto& element = args["elements"][i];
+            element["a"]  = i;
+            element["b"]  = std::to_string(i);
+        }
+        args["matrix"][size_t{ 0 }][size_t{ 1 }] = 1.5f;
+        args["after"]                            = false;
+    });
+
+    // Unassigned members and elements, and elements skipped by indexing past the end, become nulls.
+    CheckMatchesTree([](auto& root) {
+        root["unassigned"];
+        root["array"][size_t{ 3 }] = 3;
+        root["sparse"][size_t{ 1 }];
+        root["sparse"][size_t{ 4 }]["x"] = 4;
+        root["nested"]["deeper"]["deepest"];
+        root["last"];
+    });
+
+    // The most recently added member or element can be accessed again to populate it further.
+    CheckMatchesTree([](auto& root) {
+        root["depthStencil"]["depth"]   = 1.0f;
+        root["depthStencil"]["stencil"] = 0;
+        root["list"][size_t{ 0 }]["a"]  = 1;
+        root["list"][size_t{ 0 }]["b"]  = 2;
+        root["list"][size_t{ 1 }]       = "two";
+    });
+
+    // Nothing assigned at all.
+    CheckMatchesTree([](auto&) {});
+    CheckMatchesTree([](auto& root) { root["empty"]; });
+}
+
+TEST_CASE("JsonTokenWriter writes trees like the JSON library", "[json_token_writer]")
+{
+    nlohmann::ordered_json header;
+    header["source-path"]      = "trace.gfxr";
+    header["gfxrecon-version"] = "1.0.0";
+    header["list"]             = { 1, 2, 3 };
+    header["empty_list"]       = nlohmann::ordered_json::array();
+    header["empty_object"]     = nlohmann::ordered_json::object();
+    header["nested"]["value"]  = 0.25;
+
+    CheckMatchesTree([&header](auto& root) {
+        root["header"]         = header;
+        root["inner"]["tree"]  = header;
+        root["inner"]["after"] = 1;
+    });
+
+    // Empty containers stay open so they can be populated, and are written empty if they are not.
+    CheckMatchesTree([](auto& root) {
+        root["empty_array"]   = nlohmann::ordered_json::array();
+        root["empty_object"]  = nlohmann::ordered_json::object();
+        auto& filled          = root["filled"];
+        filled                = nlohmann::ordered_json::array();
+        filled[size_t{ 0 }]   = "first";
+        root["filled_object"] = nlohmann::ordered_json::object();
+        root["filled_object"]["key"] = nlohmann::ordered_json::array();
+    });
+}
+
+TEST_CASE("JsonTokenWriter reuses its values between top-level values", "[json_token_writer]")
+{
+    JsonTokenWriter writer;
+    std::string     output;
+
+    for (uint32_t block = 0; block < 100; ++block)
+    {
+        nlohmann::ordered_json tree;
+        auto&                  root = writer.Begin(&output, -1);
+        for (uint32_t i = 0; i < block; ++i)
+        {
+            tree["values"][i]["block"] = block;
+            root["values"][i]["block"] = block;
+        }
+        writer.End();
+
+        REQUIRE(output == tree.dump());
+        output.clear();
+    }
+}
+
+TEST_CASE("JsonTokenWriter discards values written out of order", "[json_token_writer]")
+{
+    JsonTokenWriter writer;
+    std::string     output;
+
+    auto& root = writer.Begin(&output, -1);
+    auto& a    = root["a"];
+    a["x"]     = 1;
+    root["b"]  = 2;
+
+    // Both a and b are complete, so these writes are discarded.
+    a["y"]         = 3;
+    root["b"]      = 4;
+    root["b"]["z"] = 5;
+    root[size_t{ 0 }] = 6;
+    writer.End();
+
+    REQUIRE(output == R"({"a":{"x":1},"b":2})");
+}
+
+GFXRECON_END_NAMESPACE(test)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
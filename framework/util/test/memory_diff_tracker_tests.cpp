@@ -0,0 +1,232 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/memory_diff_tracker.h"
+#include "util/logging.h"
+
+#include <catch2/catch.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(test)
+
+struct ReportedRange
+{
+    uint64_t memory_id;
+    size_t   offset;
+    size_t   size;
+};
+
+static std::vector<ReportedRange> ProcessEntry(MemoryDiffTracker* tracker, uint64_t memory_id)
+{
+    std::vector<ReportedRange> ranges;
+    tracker->ProcessMemoryEntry(memory_id, [&ranges](uint64_t id, void*, size_t offset, size_t size) {
+        ranges.push_back({ id, offset, size });
+    });
+    return ranges;
+}
+
+// Applies the reported ranges to a copy of the memory, as replay would, so that it can be compared with the original.
+static size_t ApplyModifiedRanges(MemoryDiffTracker* tracker, std::vector<uint8_t>* replay_memory)
+{
+    size_t written = 0;
+    tracker->ProcessMemoryEntries([replay_memory, &written](uint64_t, void* data, size_t offset, size_t size) {
+        memcpy(replay_memory->data() + offset, static_cast<const uint8_t*>(data) + offset, size);
+        written += size;
+    });
+    return written;
+}
+
+TEST_CASE("MemoryDiffTracker compares blocks of any size", "[memory_diff_tracker]")
+{
+    std::vector<uint8_t> lhs(1000);
+    std::vector<uint8_t> rhs(1000);
+
+    for (size_t i = 0; i < lhs.size(); ++i)
+    {
+        lhs[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    rhs = lhs;
+
+    for (size_t size = 0; size <= 300; ++size)
+    {
+        REQUIRE(!MemoryDiffTracker::BlocksDiffer(lhs.data() + 3, rhs.data() + 3, size));
+
+        for (size_t position : { size_t(0), size / 2, size - 1 })
+        {
+            if (position < size)
+            {
+                rhs[3 + position] ^= 0x80;
+                REQUIRE(MemoryDiffTracker::BlocksDiffer(lhs.data() + 3, rhs.data() + 3, size));
+                rhs[3 + position] ^= 0x80;
+            }
+        }
+    }
+}
+
+TEST_CASE("MemoryDiffTracker reports only modified blocks", "[memory_diff_tracker]")
+{
+    const size_t kBlockSize = MemoryDiffTracker::kCompareBlockSize;
+
+    std::vector<uint8_t> memory(64 * 1024, 0);
+    MemoryDiffTracker    tracker(0);
+
+    tracker.AddTrackedMemory(1, memory.data(), memory.size());
+    REQUIRE(ProcessEntry(&tracker, 1).empty());
+    REQUIRE(!tracker.ProcessMemoryEntry(2, [](uint64_t, void*, size_t, size_t) {}));
+
+    // A single modified byte reports the block that contains it.
+    memory[kBlockSize * 3 + 5] = 1;
+    auto ranges                = ProcessEntry(&tracker, 1);
+    REQUIRE(ranges.size() == 1);
+    REQUIRE(ranges[0].memory_id == 1);
+    REQUIRE(ranges[0].offset == kBlockSize * 3);
+    REQUIRE(ranges[0].size == kBlockSize);
+
+    // The snapshot was updated, so the same modification is not reported twice.
+    REQUIRE(ProcessEntry(&tracker, 1).empty());
+
+    // Nearby modifications are merged, distant modifications are reported separately.
+    memory[0]                                                      = 2;
+    memory[kBlockSize + MemoryDiffTracker::kMergeDistance]         = 2;
+    memory[kBlockSize * 4 + MemoryDiffTracker::kMergeDistance * 2] = 2;
+    memory[memory.size() - 1]                                      = 2;
+    ranges                                                         = ProcessEntry(&tracker, 1);
+    REQUIRE(ranges.size() == 3);
+    REQUIRE(ranges[0].offset == 0);
+    REQUIRE(ranges[0].size == kBlockSize * 2 + MemoryDiffTracker::kMergeDistance);
+    REQUIRE(ranges[1].offset == kBlockSize * 4 + MemoryDiffTracker::kMergeDistance * 2);
+    REQUIRE(ranges[1].size == kBlockSize);
+    REQUIRE(ranges[2].offset == memory.size() - kBlockSize);
+    REQUIRE(ranges[2].size == kBlockSize);
+
+    tracker.RemoveTrackedMemory(1);
+    memory[0] = 3;
+    REQUIRE(!tracker.ProcessMemoryEntry(1, [](uint64_t, void*, size_t, size_t) {}));
+}
+
+TEST_CASE("MemoryDiffTracker reproduces modified memory with parallel comparison", "[memory_diff_tracker]")
+{
+    // Not a multiple of the block or segment sizes, so that partial blocks and segments are covered.
+    const size_t kMemorySize = MemoryDiffTracker::kSegmentSize * 5 + 1000;
+
+    std::mt19937                          generator(0);
+    std::uniform_int_distribution<size_t> offset_distribution(0, kMemorySize - 1);
+    std::uniform_int_distribution<size_t> size_distribution(1, 8192);
+    std::vector<uint8_t>                  memory(kMemorySize);
+
+    for (auto& value : memory)
+    {
+        value = static_cast<uint8_t>(generator());
+    }
+
+    for (size_t thread_count : { size_t(0), size_t(3) })
+    {
+        MemoryDiffTracker    tracker(thread_count);
+        std::vector<uint8_t> replay_memory = memory;
+
+        REQUIRE(tracker.GetThreadCount() == thread_count);
+
+        tracker.AddTrackedMemory(7, memory.data(), memory.size());
+
+        for (uint32_t iteration = 0; iteration < 8; ++iteration)
+        {
+            for (uint32_t i = 0; i < 64; ++i)
+            {
+                size_t offset = offset_distribution(generator);
+                size_t size   = std::min(size_distribution(generator), kMemorySize - offset);
+                memset(memory.data() + offset, static_cast<int>(generator()), size);
+            }
+
+            size_t written = ApplyModifiedRanges(&tracker, &replay_memory);
+            REQUIRE(written < kMemorySize);
+            REQUIRE(replay_memory == memory);
+        }
+    }
+}
+
+// Measures the data written for a large mapping with sparse modifications and the time taken to find the modifications
+// with and without the thread pool.  Run explicitly with: gfxrecon_util_test "[memory_diff_tracker][benchmark]"
+TEST_CASE("MemoryDiffTracker large mapping benchmark", "[memory_diff_tracker][benchmark][.]")
+{
+    const size_t   kMemorySize  = 256 * 1024 * 1024;
+    const size_t   kWriteCount  = 2000;
+    const size_t   kWriteSize   = 4096;
+    const uint32_t kIterations  = 4;
+    const size_t   kThreadCount = 4;
+
+    std::vector<uint8_t> memory(kMemorySize, 0);
+    std::vector<uint8_t> serial_replay(kMemorySize, 0);
+    std::vector<uint8_t> parallel_replay(kMemorySize, 0);
+    MemoryDiffTracker    serial_tracker(0);
+    MemoryDiffTracker    parallel_tracker(kThreadCount);
+
+    serial_tracker.AddTrackedMemory(1, memory.data(), memory.size());
+    parallel_tracker.AddTrackedMemory(1, memory.data(), memory.size());
+
+    std::mt19937                          generator(0);
+    std::uniform_int_distribution<size_t> offset_distribution(0, kMemorySize - kWriteSize);
+    std::chrono::steady_clock::duration   serial_time{ 0 };
+    std::chrono::steady_clock::duration   parallel_time{ 0 };
+    size_t                                diff_written = 0;
+
+    for (uint32_t iteration = 0; iteration < kIterations; ++iteration)
+    {
+        for (size_t i = 0; i < kWriteCount; ++i)
+        {
+            memset(memory.data() + offset_distribution(generator), static_cast<int>(iteration + 1), kWriteSize);
+        }
+
+        auto start_time = std::chrono::steady_clock::now();
+        diff_written += ApplyModifiedRanges(&serial_tracker, &serial_replay);
+        serial_time += std::chrono::steady_clock::now() - start_time;
+
+        start_time = std::chrono::steady_clock::now();
+        ApplyModifiedRanges(&parallel_tracker, &parallel_replay);
+        parallel_time += std::chrono::steady_clock::now() - start_time;
+    }
+
+    REQUIRE(serial_replay == memory);
+    REQUIRE(parallel_replay == memory);
+
+    GFXRECON_WRITE_CONSOLE("MemoryDiffTracker: %u submits of a %zu MB mapping, unassisted writes %zu MB, diff writes "
+                           "%.1f MB, compare %.3f ms serial, %.3f ms with %zu threads",
+                           kIterations,
+                           kMemorySize >> 20,
+                           (kMemorySize * kIterations) >> 20,
+                           static_cast<double>(diff_written) / (1024.0 * 1024.0),
+                           std::chrono::duration<double, std::milli>(serial_time).count(),
+                           std::chrono::duration<double, std::milli>(parallel_time).count(),
+                           kThreadCount);
+}
+
+GFXRECON_END_NAMESPACE(test)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,239 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/page_status_tracker.h"
+#include "util/logging.h"
+
+#include <catch2/catch.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(test)
+
+typedef std::vector<std::pair<size_t, size_t>> PageRanges;
+
+// Builds the ranges of consecutive written pages with the status tracker search functions, as done by
+// PageGuardManager::ProcessEntry.
+static PageRanges GetActiveWriteRanges(const PageStatusTracker& tracker)
+{
+    PageRanges ranges;
+    size_t     page_count  = tracker.GetPageCount();
+    size_t     start_index = tracker.FindNextActiveWriteBlock(0);
+
+    while (start_index < page_count)
+    {
+        size_t end_index = tracker.FindNextInactiveWriteBlock(start_index);
+        ranges.emplace_back(start_index, end_index);
+        start_index = tracker.FindNextActiveWriteBlock(end_index);
+    }
+
+    return ranges;
+}
+
+// Builds the ranges of consecutive written pages one page at a time.
+static PageRanges GetActiveWriteRanges(const std::vector<uint8_t>& pages)
+{
+    PageRanges ranges;
+    bool       active_range = false;
+    size_t     start_index  = 0;
+
+    for (size_t i = 0; i < pages.size(); ++i)
+    {
+        if (pages[i] != 0)
+        {
+            if (!active_range)
+            {
+                active_range = true;
+                start_index  = i;
+            }
+        }
+        else if (active_range)
+        {
+            active_range = false;
+            ranges.emplace_back(start_index, i);
+        }
+    }
+
+    if (active_range)
+    {
+        ranges.emplace_back(start_index, pages.size());
+    }
+
+    return ranges;
+}
+
+TEST_CASE("PageStatusTracker sets and clears page status", "[page_status_tracker]")
+{
+    PageStatusTracker tracker(130);
+
+    REQUIRE(tracker.GetPageCount() == 130);
+    REQUIRE_FALSE(tracker.HasActiveWriteBlock());
+    REQUIRE(tracker.FindNextActiveWriteBlock(0) == 130);
+    REQUIRE(tracker.FindNextInactiveWriteBlock(0) == 0);
+
+    tracker.SetActiveWriteBlock(63, true);
+    tracker.SetActiveWriteBlock(64, true);
+    tracker.SetActiveReadBlock(64, true);
+    tracker.SetActiveReadBlock(100, true);
+
+    REQUIRE(tracker.IsActiveWriteBlock(63));
+    REQUIRE(tracker.IsActiveWriteBlock(64));
+    REQUIRE_FALSE(tracker.IsActiveWriteBlock(65));
+    REQUIRE(tracker.IsActiveReadBlock(64));
+    REQUIRE(tracker.HasActiveWriteBlock());
+    REQUIRE(tracker.HasActiveWriteBlock(60, 4));
+    REQUIRE(tracker.HasActiveWriteBlock(64, 1));
+    REQUIRE_FALSE(tracker.HasActiveWriteBlock(0, 63));
+    REQUIRE_FALSE(tracker.HasActiveWriteBlock(65, 65));
+
+    REQUIRE(tracker.FindNextActiveWriteBlock(0) == 63);
+    REQUIRE(tracker.FindNextActiveWriteBlock(64) == 64);
+    REQUIRE(tracker.FindNextActiveWriteBlock(65) == 130);
+    REQUIRE(tracker.FindNextInactiveWriteBlock(63) == 65);
+    REQUIRE(tracker.FindNextActiveReadOnlyBlock(0) == 100);
+    REQUIRE(tracker.FindNextActiveReadOnlyBlock(101) == 130);
+
+    tracker.ClearActiveBlocks(63, 2);
+
+    REQUIRE_FALSE(tracker.HasActiveWriteBlock());
+    REQUIRE_FALSE(tracker.IsActiveReadBlock(64));
+    REQUIRE(tracker.IsActiveReadBlock(100));
+
+    tracker.SetActiveWriteBlock(100, true);
+    REQUIRE(tracker.FindNextActiveReadOnlyBlock(0) == 130);
+    tracker.SetActiveWriteBlock(100, false);
+    REQUIRE_FALSE(tracker.HasActiveWriteBlock());
+}
+
+TEST_CASE("PageStatusTracker does not report pages past the page count", "[page_status_tracker]")
+{
+    PageStatusTracker tracker(70);
+
+    tracker.SetAllBlocksActiveWrite();
+
+    REQUIRE(tracker.HasActiveWriteBlock(69, 1));
+    REQUIRE(tracker.FindNextInactiveWriteBlock(0) == 70);
+    REQUIRE(GetActiveWriteRanges(tracker) == PageRanges{ { 0, 70 } });
+
+    tracker.ClearActiveBlocks(0, 70);
+
+    REQUIRE_FALSE(tracker.HasActiveWriteBlock());
+    REQUIRE(tracker.FindNextActiveWriteBlock(0) == 70);
+
+    PageStatusTracker full_word_tracker(128);
+
+    full_word_tracker.SetAllBlocksActiveWrite();
+    REQUIRE(GetActiveWriteRanges(full_word_tracker) == PageRanges{ { 0, 128 } });
+}
+
+TEST_CASE("PageStatusTracker finds the same ranges as a page at a time scan", "[page_status_tracker]")
+{
+    std::mt19937 generator(0);
+
+    for (size_t page_count : { 1, 63, 64, 65, 1000, 4097 })
+    {
+        for (uint32_t density : { 1, 10, 50, 90 })
+        {
+            PageStatusTracker                       tracker(page_count);
+            std::vector<uint8_t>                    pages(page_count, 0);
+            std::uniform_int_distribution<uint32_t> distribution(0, 99);
+
+            for (size_t i = 0; i < page_count; ++i)
+            {
+                if (distribution(generator) < density)
+                {
+                    pages[i] = 1;
+                    tracker.SetActiveWriteBlock(i, true);
+                }
+            }
+
+            REQUIRE(GetActiveWriteRanges(tracker) == GetActiveWriteRanges(pages));
+
+            for (const auto& range : GetActiveWriteRanges(pages))
+            {
+                REQUIRE(tracker.HasActiveWriteBlock(range.first, range.second - range.first));
+                tracker.ClearActiveBlocks(range.first, range.second - range.first);
+            }
+
+            REQUIRE_FALSE(tracker.HasActiveWriteBlock());
+        }
+    }
+}
+
+// Compares the dirty range search performed by PageGuardManager for a 1 GiB mapped allocation with 4 KiB pages, using
+// one byte per page and the packed status tracker. Run explicitly with:
+// gfxrecon_util_test "[page_status_tracker][benchmark]"
+TEST_CASE("PageStatusTracker dirty range search benchmark", "[page_status_tracker][benchmark][.]")
+{
+    const size_t kPageCount     = 256 * 1024;
+    const size_t kDirtyPages    = 256;
+    const size_t kIterations    = 100;
+    size_t       byte_ranges    = 0;
+    size_t       tracker_ranges = 0;
+
+    std::mt19937                          generator(0);
+    std::uniform_int_distribution<size_t> distribution(0, kPageCount - 1);
+    std::vector<uint8_t>                  pages(kPageCount, 0);
+    PageStatusTracker                     tracker(kPageCount);
+
+    for (size_t i = 0; i < kDirtyPages; ++i)
+    {
+        size_t page = distribution(generator);
+        pages[page] = 1;
+        tracker.SetActiveWriteBlock(page, true);
+    }
+
+    auto start_time = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < kIterations; ++i)
+    {
+        byte_ranges += GetActiveWriteRanges(pages).size();
+    }
+
+    auto byte_time = std::chrono::steady_clock::now() - start_time;
+    start_time     = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < kIterations; ++i)
+    {
+        tracker_ranges += GetActiveWriteRanges(tracker).size();
+    }
+
+    auto tracker_time = std::chrono::steady_clock::now() - start_time;
+
+    REQUIRE(byte_ranges == tracker_ranges);
+
+    GFXRECON_WRITE_CONSOLE("PageStatusTracker: %zu pages, %zu dirty, byte per page %.3f ms, bitset %.3f ms per search",
+                           kPageCount,
+                           kDirtyPages,
+                           std::chrono::duration<double, std::milli>(byte_time).count() / kIterations,
+                           std::chrono::duration<double, std::milli>(tracker_time).count() / kIterations);
+}
+
+GFXRECON_END_NAMESPACE(test)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,240 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/sharded_hash_map.h"
+#include "util/logging.h"
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(test)
+
+TEST_CASE("ShardedHashMap stores values by key", "[sharded_hash_map]")
+{
+    ShardedHashMap<const void*, uint64_t> map;
+
+    std::vector<uint64_t> objects(1000);
+    for (size_t i = 0; i < objects.size(); ++i)
+    {
+        REQUIRE(map.Insert(&objects[i], i));
+    }
+
+    // Duplicate keys are rejected without replacing the stored value.
+    REQUIRE_FALSE(map.Insert(&objects[10], 0));
+    REQUIRE(map.GetSize() == objects.size());
+
+    for (size_t i = 0; i < objects.size(); ++i)
+    {
+        uint64_t value = 0;
+        REQUIRE(map.Find(&objects[i], value));
+        REQUIRE(value == i);
+    }
+
+    uint64_t value = 0;
+    REQUIRE_FALSE(map.Find(&value, value));
+
+    for (size_t i = 0; i < objects.size(); i += 2)
+    {
+        REQUIRE(map.Erase(&objects[i]));
+    }
+    REQUIRE_FALSE(map.Erase(&objects[0]));
+    REQUIRE(map.GetSize() == objects.size() / 2);
+
+    uint64_t visited = 0;
+    map.Visit([&visited](const void* const&, const uint64_t& entry_value) {
+        REQUIRE((entry_value % 2) == 1);
+        ++visited;
+    });
+    REQUIRE(visited == objects.size() / 2);
+
+    map.Clear();
+    REQUIRE(map.GetSize() == 0);
+}
+
+TEST_CASE("ShardedHashMap supports concurrent access", "[sharded_hash_map]")
+{
+    const size_t kThreadCount  = 8;
+    const size_t kObjectCount  = 2000;
+    const size_t kRepeatCount  = 4;
+    const size_t kSharedCount  = 64;
+    uint64_t     shared_handle = 1;
+
+    ShardedHashMap<uint64_t, uint64_t> map;
+    std::atomic<size_t>                errors{ 0 };
+
+    for (size_t i = 0; i < kSharedCount; ++i)
+    {
+        map.Insert(shared_handle << 40 | i, i);
+    }
+
+    std::vector<std::thread> threads;
+    for (size_t thread_index = 0; thread_index < kThreadCount; ++thread_index)
+    {
+        threads.emplace_back([&, thread_index]() {
+            for (size_t repeat = 0; repeat < kRepeatCount; ++repeat)
+            {
+                for (size_t i = 0; i < kObjectCount; ++i)
+                {
+                    uint64_t key = (thread_index << 32) | i;
+                    if (!map.Insert(key, key))
+                    {
+                        ++errors;
+                    }
+
+                    uint64_t value = 0;
+                    if (!map.Find(key, value) || (value != key) ||
+                        !map.Find(shared_handle << 40 | (i % kSharedCount), value) || (value != (i % kSharedCount)))
+                    {
+                        ++errors;
+                    }
+                }
+
+                for (size_t i = 0; i < kObjectCount; ++i)
+                {
+                    if (!map.Erase((thread_index << 32) | i))
+                    {
+                        ++errors;
+                    }
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    REQUIRE(errors == 0);
+    REQUIRE(map.GetSize() == kSharedCount);
+}
+
+// Simulates command buffer recording in capture track mode, where every recorded command looks up the wrappers of the
+// command buffer and of the handles it references. Each thread records into its own command buffer and references a
+// mix of thread local and shared resources. Compares handle lookups through a single map guarded by one shared_mutex
+// with lookups through a ShardedHashMap. Scaling depends on the number of cores, so the benchmark reports the time for
+// each thread count. Run explicitly with: gfxrecon_util_test "[sharded_hash_map][benchmark]"
+TEST_CASE("ShardedHashMap multi-threaded recording benchmark", "[sharded_hash_map][benchmark][.]")
+{
+    const size_t kMaxThreadCount    = 16;
+    const size_t kResourceCount     = 4096;
+    const size_t kCommandCount      = 200000;
+    const size_t kHandlesPerCommand = 3;
+
+    struct LockedMap
+    {
+        mutable std::shared_mutex              mutex;
+        std::unordered_map<uint64_t, uint64_t> map;
+
+        uint64_t Find(uint64_t key) const
+        {
+            const std::shared_lock<std::shared_mutex> lock(mutex);
+            auto                                      entry = map.find(key);
+            return (entry != map.end()) ? entry->second : 0;
+        }
+    };
+
+    // Handle values that look like driver pointers, 64 byte aligned.
+    auto make_handle = [](uint64_t index) { return 0x7f0000000000ull + (index * 64); };
+
+    LockedMap                          locked_map;
+    ShardedHashMap<uint64_t, uint64_t> sharded_map;
+
+    for (uint64_t i = 0; i < (kResourceCount + kMaxThreadCount); ++i)
+    {
+        locked_map.map.emplace(make_handle(i), i);
+        sharded_map.Insert(make_handle(i), i);
+    }
+
+    auto record = [&](size_t thread_count, auto find) {
+        std::vector<std::thread> threads;
+        std::vector<uint64_t>    results(thread_count, 0);
+        auto                     start_time = std::chrono::steady_clock::now();
+
+        for (size_t thread_index = 0; thread_index < thread_count; ++thread_index)
+        {
+            threads.emplace_back([&, thread_index]() {
+                uint64_t command_buffer = make_handle(kResourceCount + thread_index);
+                uint64_t state          = thread_index + 1;
+                uint64_t result         = 0;
+
+                for (size_t command = 0; command < kCommandCount; ++command)
+                {
+                    result += find(command_buffer);
+                    for (size_t i = 0; i < kHandlesPerCommand; ++i)
+                    {
+                        state = state * 6364136223846793005ull + 1442695040888963407ull;
+                        result += find(make_handle((state >> 33) % kResourceCount));
+                    }
+                }
+
+                results[thread_index] = result;
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        auto     time  = std::chrono::steady_clock::now() - start_time;
+        uint64_t total = 0;
+        for (uint64_t result : results)
+        {
+            total += result;
+        }
+        return std::make_pair(total, std::chrono::duration<double, std::milli>(time).count());
+    };
+
+    for (size_t thread_count = 1; thread_count <= kMaxThreadCount; thread_count *= 2)
+    {
+        auto locked  = record(thread_count, [&](uint64_t handle) { return locked_map.Find(handle); });
+        auto sharded = record(thread_count, [&](uint64_t handle) {
+            uint64_t value = 0;
+            sharded_map.Find(handle, value);
+            return value;
+        });
+
+        REQUIRE(locked.first == sharded.first);
+
+        GFXRECON_WRITE_CONSOLE("ShardedHashMap: %zu threads x %zu lookups, single lock %.3f ms, sharded %.3f ms",
+                               thread_count,
+                               kCommandCount * (kHandlesPerCommand + 1),
+                               locked.second,
+                               sharded.second);
+    }
+}
+
+GFXRECON_END_NAMESPACE(test)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
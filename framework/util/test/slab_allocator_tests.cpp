@@ -0,0 +1,249 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/slab_allocator.h"
+#include "util/logging.h"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(test)
+
+TEST_CASE("SlabAllocator reuses deleted objects", "[slab_allocator]")
+{
+    struct Object
+    {
+        uint64_t    id{ 0 };
+        std::string name;
+    };
+
+    SlabAllocator<Object> allocator;
+    std::vector<Object*>  objects;
+
+    const size_t kObjectCount = SlabAllocator<Object>::kObjectsPerSlab * 3;
+    for (size_t i = 0; i < kObjectCount; ++i)
+    {
+        Object* object = allocator.New();
+        REQUIRE(object != nullptr);
+        REQUIRE(object->id == 0);
+        REQUIRE(object->name.empty());
+
+        object->id   = i;
+        object->name = std::to_string(i);
+        objects.push_back(object);
+    }
+
+    REQUIRE(allocator.GetAllocatedCount() == kObjectCount);
+    REQUIRE(allocator.GetSlabCount() == 3);
+
+    // Objects are distinct and keep their values.
+    std::unordered_set<Object*> unique_objects(objects.begin(), objects.end());
+    REQUIRE(unique_objects.size() == kObjectCount);
+    for (size_t i = 0; i < kObjectCount; ++i)
+    {
+        REQUIRE(objects[i]->id == i);
+        REQUIRE(objects[i]->name == std::to_string(i));
+    }
+
+    // Deleted objects are reused without allocating more slabs.
+    for (size_t i = 0; i < kObjectCount; i += 2)
+    {
+        allocator.Delete(objects[i]);
+    }
+    REQUIRE(allocator.GetAllocatedCount() == kObjectCount / 2);
+
+    for (size_t i = 0; i < kObjectCount; i += 2)
+    {
+        objects[i] = allocator.New();
+        REQUIRE(unique_objects.count(objects[i]) == 1);
+        REQUIRE(objects[i]->name.empty());
+    }
+    REQUIRE(allocator.GetSlabCount() == 3);
+
+    for (Object* object : objects)
+    {
+        allocator.Delete(object);
+    }
+    allocator.Delete(nullptr);
+    REQUIRE(allocator.GetAllocatedCount() == 0);
+}
+
+// Simulates the handle wrapper and state table work of an application that allocates and frees descriptor sets, image
+// views and command buffers every frame. Compares wrappers allocated with new and delete and tracked in an ordered map
+// with wrappers allocated from a SlabAllocator and tracked in a hash map. Run explicitly with:
+// gfxrecon_util_test "[slab_allocator][benchmark]"
+TEST_CASE("SlabAllocator wrapper churn benchmark", "[slab_allocator][benchmark][.]")
+{
+    // Roughly the size of a descriptor set wrapper, with a member that owns heap memory.
+    struct Wrapper
+    {
+        uint64_t                          handle{ 0 };
+        uint64_t                          handle_id{ 0 };
+        std::shared_ptr<std::vector<int>> create_parameters;
+        uint8_t                           state[256]{};
+    };
+
+    const size_t kFrameCount       = 500;
+    const size_t kLongLivedCount   = 20000;
+    const size_t kObjectsPerFrame  = 3000;
+    const size_t kFramesInFlight   = 3;
+    auto         create_parameters = std::make_shared<std::vector<int>>(16);
+    uint64_t     next_id           = 1;
+    uint64_t     heap_result       = 0;
+    uint64_t     slab_result       = 0;
+    auto         heap_time         = std::chrono::steady_clock::duration::zero();
+    auto         slab_time         = std::chrono::steady_clock::duration::zero();
+
+    auto run = [&](auto create, auto destroy, auto visit) {
+        std::vector<std::vector<Wrapper*>> frames(kFramesInFlight);
+        std::vector<Wrapper*>              long_lived;
+
+        next_id = 1;
+        for (size_t i = 0; i < kLongLivedCount; ++i)
+        {
+            long_lived.push_back(create(next_id++));
+        }
+
+        auto start_time = std::chrono::steady_clock::now();
+
+        for (size_t frame = 0; frame < kFrameCount; ++frame)
+        {
+            // Objects are freed when the frame that used them is no longer in flight.
+            auto& objects = frames[frame % kFramesInFlight];
+            for (Wrapper* wrapper : objects)
+            {
+                destroy(wrapper);
+            }
+            objects.clear();
+
+            for (size_t i = 0; i < kObjectsPerFrame; ++i)
+            {
+                objects.push_back(create(next_id++));
+            }
+        }
+
+        auto time = std::chrono::steady_clock::now() - start_time;
+
+        uint64_t result = visit();
+        for (auto& objects : frames)
+        {
+            for (Wrapper* wrapper : objects)
+            {
+                destroy(wrapper);
+            }
+        }
+        for (Wrapper* wrapper : long_lived)
+        {
+            destroy(wrapper);
+        }
+
+        return std::make_pair(result, time);
+    };
+
+    {
+        std::map<uint64_t, Wrapper*> state_table;
+
+        auto result = run(
+            [&](uint64_t id) {
+                Wrapper* wrapper           = new Wrapper;
+                wrapper->handle            = id * 64;
+                wrapper->handle_id         = id;
+                wrapper->create_parameters = create_parameters;
+                state_table.insert(std::make_pair(id, wrapper));
+                return wrapper;
+            },
+            [&](Wrapper* wrapper) {
+                state_table.erase(wrapper->handle_id);
+                delete wrapper;
+            },
+            [&]() {
+                uint64_t result = 0;
+                for (const auto& entry : state_table)
+                {
+                    result = (result * 31) + entry.second->handle;
+                }
+                return result;
+            });
+
+        heap_result = result.first;
+        heap_time   = result.second;
+    }
+
+    {
+        SlabAllocator<Wrapper>                 allocator;
+        std::unordered_map<uint64_t, Wrapper*> state_table;
+
+        auto result = run(
+            [&](uint64_t id) {
+                Wrapper* wrapper           = allocator.New();
+                wrapper->handle            = id * 64;
+                wrapper->handle_id         = id;
+                wrapper->create_parameters = create_parameters;
+                state_table.insert(std::make_pair(id, wrapper));
+                return wrapper;
+            },
+            [&](Wrapper* wrapper) {
+                state_table.erase(wrapper->handle_id);
+                allocator.Delete(wrapper);
+            },
+            [&]() {
+                // State is written in ID order.
+                std::vector<std::pair<uint64_t, Wrapper*>> entries(state_table.begin(), state_table.end());
+                std::sort(entries.begin(), entries.end());
+
+                uint64_t result = 0;
+                for (const auto& entry : entries)
+                {
+                    result = (result * 31) + entry.second->handle;
+                }
+                return result;
+            });
+
+        slab_result = result.first;
+        slab_time   = result.second;
+    }
+
+    REQUIRE(heap_result == slab_result);
+
+    GFXRECON_WRITE_CONSOLE("SlabAllocator: %zu frames of %zu creates and destroys, new and std::map %.3f ms, "
+                           "SlabAllocator and std::unordered_map %.3f ms",
+                           kFrameCount,
+                           kObjectsPerFrame,
+                           std::chrono::duration<double, std::milli>(heap_time).count(),
+                           std::chrono::duration<double, std::milli>(slab_time).count());
+}
+
+GFXRECON_END_NAMESPACE(test)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
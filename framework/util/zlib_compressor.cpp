@@ -27,9 +27,47 @@
 
 #include "zlib.h"
 
+#include <algorithm>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
+// Per-thread compression and decompression streams, which are reset rather than reinitialized between blocks.
+struct ZlibThreadStreams
+{
+    z_stream compress_stream{};
+    z_stream decompress_stream{};
+    bool     compress_initialized{ false };
+    bool     decompress_initialized{ false };
+    int      compress_level{ 0 };
+
+    ~ZlibThreadStreams()
+    {
+        if (compress_initialized)
+        {
+            deflateEnd(&compress_stream);
+        }
+
+        if (decompress_initialized)
+        {
+            inflateEnd(&decompress_stream);
+        }
+    }
+};
+
+static thread_local ZlibThreadStreams thread_streams;
+
+static int GetZlibCompressionLevel(int compression_level)
+{
+    // Z_BEST_COMPRESSION was historically used for all captures, and remains the default.
+    if (compression_level == Compressor::kDefaultCompressionLevel)
+    {
+        return Z_BEST_COMPRESSION;
+    }
+
+    return std::clamp(compression_level, Z_BEST_SPEED, Z_BEST_COMPRESSION);
+}
+
 size_t ZlibCompressor::Compress(const size_t          uncompressed_size,
                                 const uint8_t*        uncompressed_data,
                                 std::vector<uint8_t>* compressed_data,
@@ -47,59 +85,95 @@ size_t ZlibCompressor::Compress(const size_t          uncompressed_size,
         compressed_data->resize(compressed_data_offset + uncompressed_size);
     }
 
-    z_stream compress_stream = {};
-    compress_stream.zalloc   = Z_NULL;
-    compress_stream.zfree    = Z_NULL;
-    compress_stream.opaque   = Z_NULL;
+    const int level = GetZlibCompressionLevel(compression_level_);
+
+    if (!thread_streams.compress_initialized || (thread_streams.compress_level != level))
+    {
+        if (thread_streams.compress_initialized)
+        {
+            deflateEnd(&thread_streams.compress_stream);
+        }
+
+        thread_streams.compress_stream        = {};
+        thread_streams.compress_stream.zalloc = Z_NULL;
+        thread_streams.compress_stream.zfree  = Z_NULL;
+        thread_streams.compress_stream.opaque = Z_NULL;
+        thread_streams.compress_initialized   = (deflateInit(&thread_streams.compress_stream, level) == Z_OK);
+        thread_streams.compress_level         = level;
+
+        if (!thread_streams.compress_initialized)
+        {
+            return 0;
+        }
+    }
+    else
+    {
+        deflateReset(&thread_streams.compress_stream);
+    }
+
+    z_stream& compress_stream = thread_streams.compress_stream;
 
     GFXRECON_CHECK_CONVERSION_DATA_LOSS(uInt, uncompressed_size);
     compress_stream.avail_in = static_cast<uInt>(uncompressed_size);
     compress_stream.next_in  = const_cast<Bytef*>(uncompressed_data);
 
-    GFXRECON_CHECK_CONVERSION_DATA_LOSS(uInt, compressed_data->size());
-    compress_stream.avail_out = static_cast<uInt>(compressed_data->size());
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(uInt, compressed_data->size() - compressed_data_offset);
+    compress_stream.avail_out = static_cast<uInt>(compressed_data->size() - compressed_data_offset);
     compress_stream.next_out  = compressed_data->data() + compressed_data_offset;
 
-    // Perform the compression (deflate the data).
-    deflateInit(&compress_stream, Z_BEST_COMPRESSION);
-    deflate(&compress_stream, Z_FINISH);
-    deflateEnd(&compress_stream);
-
-    // Determine the size of data from the stream
-    copy_size = compress_stream.total_out;
+    // Perform the compression (deflate the data). The stream does not end when the compressed data does not fit in the
+    // output buffer, in which case the data is reported as not compressed.
+    if (deflate(&compress_stream, Z_FINISH) == Z_STREAM_END)
+    {
+        // Determine the size of data from the stream
+        copy_size = compress_stream.total_out;
+    }
 
     return copy_size;
 }
 
-size_t ZlibCompressor::Decompress(const size_t                compressed_size,
-                                  const std::vector<uint8_t>& compressed_data,
-                                  const size_t                expected_uncompressed_size,
-                                  std::vector<uint8_t>*       uncompressed_data)
+size_t ZlibCompressor::Decompress(const size_t   compressed_size,
+                                  const uint8_t* compressed_data,
+                                  const size_t   expected_uncompressed_size,
+                                  uint8_t*       uncompressed_data)
 {
     size_t copy_size = 0;
 
-    if (nullptr == uncompressed_data)
+    if ((nullptr == compressed_data) || (nullptr == uncompressed_data))
     {
         return 0;
     }
 
-    z_stream decompress_stream = {};
-    decompress_stream.zalloc   = Z_NULL;
-    decompress_stream.zfree    = Z_NULL;
-    decompress_stream.opaque   = Z_NULL;
+    if (!thread_streams.decompress_initialized)
+    {
+        thread_streams.decompress_stream        = {};
+        thread_streams.decompress_stream.zalloc = Z_NULL;
+        thread_streams.decompress_stream.zfree  = Z_NULL;
+        thread_streams.decompress_stream.opaque = Z_NULL;
+        thread_streams.decompress_initialized   = (inflateInit(&thread_streams.decompress_stream) == Z_OK);
+
+        if (!thread_streams.decompress_initialized)
+        {
+            return 0;
+        }
+    }
+    else
+    {
+        inflateReset(&thread_streams.decompress_stream);
+    }
+
+    z_stream& decompress_stream = thread_streams.decompress_stream;
 
     GFXRECON_CHECK_CONVERSION_DATA_LOSS(uInt, compressed_size);
     decompress_stream.avail_in = static_cast<uInt>(compressed_size);
-    decompress_stream.next_in  = const_cast<Bytef*>(compressed_data.data());
+    decompress_stream.next_in  = const_cast<Bytef*>(compressed_data);
 
     GFXRECON_CHECK_CONVERSION_DATA_LOSS(uInt, expected_uncompressed_size);
     decompress_stream.avail_out = static_cast<uInt>(expected_uncompressed_size);
-    decompress_stream.next_out  = uncompressed_data->data();
+    decompress_stream.next_out  = uncompressed_data;
 
     // Perform the decompression (inflate the data).
-    inflateInit(&decompress_stream);
     inflate(&decompress_stream, Z_NO_FLUSH);
-    inflateEnd(&decompress_stream);
 
     // Determine the size of data from the stream
     copy_size = decompress_stream.total_out;
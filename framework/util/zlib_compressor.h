@@ -41,10 +41,12 @@ class ZlibCompressor : public Compressor
                             std::vector<uint8_t>* compressed_data,
                             size_t                compressed_data_offset) override;
 
-    virtual size_t Decompress(const size_t                compressed_size,
-                              const std::vector<uint8_t>& compressed_data,
-                              const size_t                expected_uncompressed_size,
-                              std::vector<uint8_t>*       uncompressed_data) override;
+    using Compressor::Decompress;
+
+    virtual size_t Decompress(const size_t   compressed_size,
+                              const uint8_t* compressed_data,
+                              const size_t   expected_uncompressed_size,
+                              uint8_t*       uncompressed_data) override;
 };
 
 GFXRECON_END_NAMESPACE(util)
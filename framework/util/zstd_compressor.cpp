@@ -26,13 +26,101 @@
 
 #include "util/logging.h"
 
+#include "zdict.h"
 #include "zstd.h"
 
+#include <algorithm>
 #include <cinttypes>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
+// Per-thread compression and decompression contexts.
+struct ZstdThreadContexts
+{
+    ZSTD_CCtx* compress_context{ nullptr };
+    ZSTD_DCtx* decompress_context{ nullptr };
+
+    ~ZstdThreadContexts()
+    {
+        ZSTD_freeCCtx(compress_context);
+        ZSTD_freeDCtx(decompress_context);
+    }
+};
+
+static thread_local ZstdThreadContexts thread_contexts;
+
+static int GetZstdCompressionLevel(int compression_level)
+{
+    // Level 1 was historically used for all captures, and remains the default.
+    if (compression_level == Compressor::kDefaultCompressionLevel)
+    {
+        return 1;
+    }
+
+    return std::clamp(compression_level, ZSTD_minCLevel(), ZSTD_maxCLevel());
+}
+
+ZstdCompressor::~ZstdCompressor()
+{
+    ReleaseDictionary();
+}
+
+bool ZstdCompressor::TrainDictionary(const std::vector<uint8_t>& sample_data,
+                                     const std::vector<size_t>&  sample_sizes,
+                                     size_t                      max_dictionary_size,
+                                     std::vector<uint8_t>*       dictionary)
+{
+    if ((dictionary == nullptr) || sample_sizes.empty())
+    {
+        return false;
+    }
+
+    dictionary->resize(max_dictionary_size);
+
+    size_t dictionary_size = ZDICT_trainFromBuffer(dictionary->data(),
+                                                   dictionary->size(),
+                                                   sample_data.data(),
+                                                   sample_sizes.data(),
+                                                   static_cast<unsigned>(sample_sizes.size()));
+
+    if (ZDICT_isError(dictionary_size))
+    {
+        GFXRECON_LOG_ERROR("Zstandard dictionary training failed: %s", ZDICT_getErrorName(dictionary_size));
+        dictionary->clear();
+        return false;
+    }
+
+    dictionary->resize(dictionary_size);
+    return true;
+}
+
+bool ZstdCompressor::LoadDictionary(const uint8_t* dictionary_data, size_t dictionary_size)
+{
+    ReleaseDictionary();
+
+    compress_dictionary_ =
+        ZSTD_createCDict(dictionary_data, dictionary_size, GetZstdCompressionLevel(compression_level_));
+    decompress_dictionary_ = ZSTD_createDDict(dictionary_data, dictionary_size);
+
+    if ((compress_dictionary_ == nullptr) || (decompress_dictionary_ == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Zstandard failed to load a %" PRIuPTR " byte dictionary", dictionary_size);
+        ReleaseDictionary();
+        return false;
+    }
+
+    return true;
+}
+
+void ZstdCompressor::ReleaseDictionary()
+{
+    ZSTD_freeCDict(compress_dictionary_);
+    ZSTD_freeDDict(decompress_dictionary_);
+    compress_dictionary_   = nullptr;
+    decompress_dictionary_ = nullptr;
+}
+
 size_t ZstdCompressor::Compress(const size_t          uncompressed_size,
                                 const uint8_t*        uncompressed_data,
                                 std::vector<uint8_t>* compressed_data,
@@ -52,12 +140,39 @@ size_t ZstdCompressor::Compress(const size_t          uncompressed_size,
         compressed_data->resize(compressed_data_offset + zstd_compressed_size);
     }
 
-    size_t compressed_size_generated =
-        ZSTD_compress(reinterpret_cast<char*>(compressed_data->data() + compressed_data_offset),
-                      zstd_compressed_size,
-                      reinterpret_cast<const char*>(uncompressed_data),
-                      uncompressed_size,
-                      1);
+    if (thread_contexts.compress_context == nullptr)
+    {
+        thread_contexts.compress_context = ZSTD_createCCtx();
+
+        if (thread_contexts.compress_context == nullptr)
+        {
+            GFXRECON_LOG_ERROR("Zstandard compression failed to create a compression context");
+            return 0;
+        }
+    }
+
+    size_t compressed_size_generated = 0;
+
+    if (compress_dictionary_ != nullptr)
+    {
+        compressed_size_generated =
+            ZSTD_compress_usingCDict(thread_contexts.compress_context,
+                                     reinterpret_cast<char*>(compressed_data->data() + compressed_data_offset),
+                                     zstd_compressed_size,
+                                     reinterpret_cast<const char*>(uncompressed_data),
+                                     uncompressed_size,
+                                     compress_dictionary_);
+    }
+    else
+    {
+        compressed_size_generated =
+            ZSTD_compressCCtx(thread_contexts.compress_context,
+                              reinterpret_cast<char*>(compressed_data->data() + compressed_data_offset),
+                              zstd_compressed_size,
+                              reinterpret_cast<const char*>(uncompressed_data),
+                              uncompressed_size,
+                              GetZstdCompressionLevel(compression_level_));
+    }
 
     if (!ZSTD_isError(compressed_size_generated))
     {
@@ -71,22 +186,50 @@ size_t ZstdCompressor::Compress(const size_t          uncompressed_size,
     return data_size;
 }
 
-size_t ZstdCompressor::Decompress(const size_t                compressed_size,
-                                  const std::vector<uint8_t>& compressed_data,
-                                  const size_t                expected_uncompressed_size,
-                                  std::vector<uint8_t>*       uncompressed_data)
+size_t ZstdCompressor::Decompress(const size_t   compressed_size,
+                                  const uint8_t* compressed_data,
+                                  const size_t   expected_uncompressed_size,
+                                  uint8_t*       uncompressed_data)
 {
     size_t data_size = 0;
 
-    if (nullptr == uncompressed_data)
+    if ((nullptr == compressed_data) || (nullptr == uncompressed_data))
     {
         return 0;
     }
 
-    size_t uncompressed_size_generated = ZSTD_decompress(reinterpret_cast<char*>(uncompressed_data->data()),
-                                                         expected_uncompressed_size,
-                                                         reinterpret_cast<const char*>(compressed_data.data()),
-                                                         compressed_size);
+    if (thread_contexts.decompress_context == nullptr)
+    {
+        thread_contexts.decompress_context = ZSTD_createDCtx();
+
+        if (thread_contexts.decompress_context == nullptr)
+        {
+            GFXRECON_LOG_ERROR("Zstandard decompression failed to create a decompression context");
+            return 0;
+        }
+    }
+
+    size_t uncompressed_size_generated = 0;
+
+    if (decompress_dictionary_ != nullptr)
+    {
+        uncompressed_size_generated =
+            ZSTD_decompress_usingDDict(thread_contexts.decompress_context,
+                                       reinterpret_cast<char*>(uncompressed_data),
+                                       expected_uncompressed_size,
+                                       reinterpret_cast<const char*>(compressed_data),
+                                       compressed_size,
+                                       decompress_dictionary_);
+    }
+    else
+    {
+        uncompressed_size_generated =
+            ZSTD_decompressDCtx(thread_contexts.decompress_context,
+                                reinterpret_cast<char*>(uncompressed_data),
+                                expected_uncompressed_size,
+                                reinterpret_cast<const char*>(compressed_data),
+                                compressed_size);
+    }
 
     if (!ZSTD_isError(uncompressed_size_generated))
     {
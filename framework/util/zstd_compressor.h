@@ -25,25 +25,48 @@
 
 #include "util/compressor.h"
 
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
 class ZstdCompressor : public Compressor
 {
   public:
-    ZstdCompressor() {}
+    ZstdCompressor() : compress_dictionary_(nullptr), decompress_dictionary_(nullptr) {}
+
+    virtual ~ZstdCompressor() override;
+
+    // Train a dictionary from a set of samples that are stored back to back in sample_data, with the size of each
+    // sample specified by sample_sizes. Returns false if training failed, which may occur when there are too few
+    // samples.
+    static bool TrainDictionary(const std::vector<uint8_t>& sample_data,
+                                const std::vector<size_t>&  sample_sizes,
+                                size_t                      max_dictionary_size,
+                                std::vector<uint8_t>*       dictionary);
 
-    virtual ~ZstdCompressor() override {}
+    virtual bool LoadDictionary(const uint8_t* dictionary_data, size_t dictionary_size) override;
 
     virtual size_t Compress(const size_t          uncompressed_size,
                             const uint8_t*        uncompressed_data,
                             std::vector<uint8_t>* compressed_data,
                             size_t                compressed_data_offset) override;
 
-    virtual size_t Decompress(const size_t                compressed_size,
-                              const std::vector<uint8_t>& compressed_data,
-                              const size_t                expected_uncompressed_size,
-                              std::vector<uint8_t>*       uncompressed_data) override;
+    using Compressor::Decompress;
+
+    virtual size_t Decompress(const size_t   compressed_size,
+                              const uint8_t* compressed_data,
+                              const size_t   expected_uncompressed_size,
+                              uint8_t*       uncompressed_data) override;
+
+  private:
+    void ReleaseDictionary();
+
+  private:
+    // Digested dictionaries are read-only and shared by all threads.
+    ZSTD_CDict_s* compress_dictionary_;
+    ZSTD_DDict_s* decompress_dictionary_;
 };
 
 GFXRECON_END_NAMESPACE(util)
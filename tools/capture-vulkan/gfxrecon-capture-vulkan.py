@@ -59,7 +59,7 @@ def usage_message():
         '                                 [--file-flush]',
         '                                 [--log-level {debug,info,warn,error,fatal}]',
         '                                 [--log-file <file>]',
-        '                                 [--memory-tracking-mode {page_guard,assisted,unassisted}]',
+        '                                 [--memory-tracking-mode {page_guard,assisted,unassisted,diff}]',
         '                                 [--capture-layer <capture_layer_path>',
     ]
     if sys.platform == 'win32':
@@ -113,7 +113,7 @@ def create_argument_parser():
                            'F7', 'F8', 'F9', 'F10', 'F11', 'F12', 'TAB', 'CTRL']
     COMPRESSION_CHOICES = ['LZ4', 'ZLIB', 'ZSTD', 'NONE']
     LOG_LEVEL_CHOICES = ['debug', 'info', 'warn', 'error', 'fatal']
-    MEMORY_TRACKING_MODE_CHOICES = ['page_guard', 'assisted', 'unassisted']
+    MEMORY_TRACKING_MODE_CHOICES = ['page_guard', 'assisted', 'unassisted', 'diff']
 
     parser = argparse.ArgumentParser(
         prog=os.path.basename(sys.argv[0]),
@@ -166,7 +166,9 @@ def create_argument_parser():
             '  - assisted: application will call vkFlushMappedMemoryRanges',
             '  - for memory to be written to the capture file',
             '  - unassisted: all mapped memory will be written to the',
-            '  - capture file during VkQueueSubmit and VkUnmapMemory']))
+            '  - capture file during VkQueueSubmit and VkUnmapMemory',
+            '  - diff: compare mapped memory with a copy taken on map and',
+            '  - write the modified regions during VkQueueSubmit and VkUnmapMemory']))
     parser.add_argument(
         '--capture-layer', dest='capture_layer', metavar='<capture_layer>',
         default=None,
@@ -26,24 +26,48 @@
 
 #include "format/format_util.h"
 #include "util/logging.h"
+#include "util/zstd_compressor.h"
 
 #include <cassert>
+#include <cinttypes>
 #include <numeric>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 
+// Dictionaries are trained from small parameter buffers, which benefit the most from a dictionary. Sample collection
+// stops once enough data has been gathered for a dictionary of the maximum size.
+const size_t kMaxDictionarySize       = 112 * 1024;
+const size_t kMaxDictionarySampleSize = 16 * 1024;
+const size_t kMaxDictionarySampleData = 100 * kMaxDictionarySize;
+
 CompressionConverter::CompressionConverter() :
-    decompressing_(true), target_compression_type_(format::CompressionType::kNone)
+    decompressing_(true), target_compression_type_(format::CompressionType::kNone), collecting_samples_(false)
 {}
 
 CompressionConverter::~CompressionConverter() {}
 
 bool CompressionConverter::Initialize(const std::string&      input_filename,
                                       const std::string&      output_filename,
-                                      format::CompressionType target_compression_type)
+                                      format::CompressionType target_compression_type,
+                                      int                     compression_level)
 {
     bool success = CreateCompressor(target_compression_type, &target_compressor_);
 
+    if (success)
+    {
+        if (target_compressor_ != nullptr)
+        {
+            target_compressor_->SetCompressionLevel(compression_level);
+        }
+
+        if (target_compression_type == format::CompressionType::kZstdDictionary)
+        {
+            // The dictionary must be loaded after the compression level has been set.
+            success = TrainDictionary(input_filename, &dictionary_) &&
+                      target_compressor_->LoadDictionary(dictionary_.data(), dictionary_.size());
+        }
+    }
+
     if (success)
     {
         // The target compression type needs to be set before FileTransformer::Initialize is called, because it invokes
@@ -69,7 +93,68 @@ bool CompressionConverter::WriteFileHeader(const format::FileHeader&
         }
     }
 
-    return FileTransformer::WriteFileHeader(header, output_options);
+    bool success = FileTransformer::WriteFileHeader(header, output_options);
+
+    if (success && !dictionary_.empty())
+    {
+        // The dictionary must precede all blocks compressed with it.
+        success = WriteCompressionDictionary();
+    }
+
+    return success;
+}
+
+bool CompressionConverter::TrainDictionary(const std::string& input_filename, std::vector<uint8_t>* dictionary)
+{
+    assert(dictionary != nullptr);
+
+    CompressionConverter sampler;
+    sampler.collecting_samples_ = true;
+
+    if (!sampler.FileTransformer::Initialize(input_filename, "", "compress") || !sampler.Process())
+    {
+        GFXRECON_LOG_ERROR("Failed to read dictionary training samples from %s", input_filename.c_str());
+        return false;
+    }
+
+    GFXRECON_WRITE_CONSOLE("Training compression dictionary from %" PRIuPTR " samples (%" PRIuPTR " bytes)",
+                           sampler.sample_sizes_.size(),
+                           sampler.sample_data_.size());
+
+#if defined(GFXRECON_ENABLE_ZSTD_COMPRESSION)
+    return util::ZstdCompressor::TrainDictionary(
+        sampler.sample_data_, sampler.sample_sizes_, kMaxDictionarySize, dictionary);
+#else
+    return false;
+#endif
+}
+
+void CompressionConverter::AddDictionarySample(const uint8_t* data, size_t size)
+{
+    if ((size > 0) && (size <= kMaxDictionarySampleSize) && (sample_data_.size() + size <= kMaxDictionarySampleData))
+    {
+        sample_data_.insert(sample_data_.end(), data, data + size);
+        sample_sizes_.push_back(size);
+    }
+}
+
+bool CompressionConverter::WriteCompressionDictionary()
+{
+    format::CompressionDictionaryCommandHeader dictionary_cmd;
+    dictionary_cmd.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+    dictionary_cmd.meta_header.meta_data_id      = format::MakeMetaDataId(
+        format::ApiFamilyId::ApiFamily_None, format::MetaDataType::kCompressionDictionaryCommand);
+    dictionary_cmd.dictionary_size               = dictionary_.size();
+    dictionary_cmd.meta_header.block_header.size =
+        format::GetMetaDataBlockBaseSize(dictionary_cmd) + dictionary_cmd.dictionary_size;
+
+    if (!WriteBytes(&dictionary_cmd, sizeof(dictionary_cmd)) || !WriteBytes(dictionary_.data(), dictionary_.size()))
+    {
+        HandleBlockWriteError(kErrorWritingBlockData, "Failed to write compression dictionary meta-data block");
+        return false;
+    }
+
+    return true;
 }
 
 bool CompressionConverter::ProcessFunctionCall(const format::BlockHeader& block_header, format::ApiCallId call_id)
@@ -213,10 +298,21 @@ bool CompressionConverter::ProcessMetaData(const format::BlockHeader& block_head
     // Only the meta data blocks that contain resource data support compression.  The rest of the meta data block types
     // can be copied directly to the new file.
     format::MetaDataType meta_data_type = format::GetMetaDataType(meta_data_id);
-    if (meta_data_type == format::MetaDataType::kFillMemoryCommand)
+    if (meta_data_type == format::MetaDataType::kCompressionDictionaryCommand)
+    {
+        // The input file's dictionary is only needed to decompress the input file. When the output file uses a
+        // dictionary, it was written with the file header.
+        std::vector<uint8_t> dictionary;
+        return ReadCompressionDictionary(block_header, &dictionary);
+    }
+    else if (meta_data_type == format::MetaDataType::kFillMemoryCommand)
     {
         return WriteFillMemoryMetaData(block_header, meta_data_id);
     }
+    else if (meta_data_type == format::MetaDataType::kFillMemoryDeltaCommand)
+    {
+        return WriteFillMemoryDeltaMetaData(block_header, meta_data_id);
+    }
     else if (meta_data_type == format::MetaDataType::kInitBufferCommand)
     {
         return WriteInitBufferMetaData(block_header, meta_data_id);
@@ -257,6 +353,12 @@ bool CompressionConverter::WriteFunctionCall(format::ApiCallId call_id, format::
     bool        write_uncompressed = decompressing_;
     const auto& buffer             = GetParameterBuffer();
 
+    if (collecting_samples_)
+    {
+        AddDictionarySample(buffer.data(), buffer_size);
+        return true;
+    }
+
     if (!write_uncompressed)
     {
         assert(target_compressor_ != nullptr);
@@ -339,6 +441,12 @@ bool CompressionConverter::WriteMethodCall(format::ApiCallId call_id,
     bool        write_uncompressed = decompressing_;
     const auto& buffer             = GetParameterBuffer();
 
+    if (collecting_samples_)
+    {
+        AddDictionarySample(buffer.data(), buffer_size);
+        return true;
+    }
+
     if (!write_uncompressed)
     {
         GFXRECON_ASSERT(target_compressor_ != nullptr);
@@ -487,6 +595,79 @@ bool CompressionConverter::WriteFillMemoryMetaData(const format::BlockHeader& bl
     return true;
 }
 
+bool CompressionConverter::WriteFillMemoryDeltaMetaData(const format::BlockHeader& block_header,
+                                                        format::MetaDataId         meta_data_id)
+{
+    assert(format::GetMetaDataType(meta_data_id) == format::MetaDataType::kFillMemoryDeltaCommand);
+
+    format::FillMemoryDeltaCommandHeader delta_cmd;
+
+    bool success = ReadBytes(&delta_cmd.thread_id, sizeof(delta_cmd.thread_id));
+    success      = success && ReadBytes(&delta_cmd.memory_id, sizeof(delta_cmd.memory_id));
+    success      = success && ReadBytes(&delta_cmd.memory_offset, sizeof(delta_cmd.memory_offset));
+    success      = success && ReadBytes(&delta_cmd.memory_size, sizeof(delta_cmd.memory_size));
+    success      = success && ReadBytes(&delta_cmd.data_size, sizeof(delta_cmd.data_size));
+
+    if (success)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, delta_cmd.data_size);
+
+        size_t data_size = static_cast<size_t>(delta_cmd.data_size);
+
+        if (format::IsBlockCompressed(block_header.type))
+        {
+            size_t uncompressed_size = 0;
+            size_t compressed_size =
+                static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(delta_cmd));
+
+            if (!ReadCompressedParameterBuffer(compressed_size, data_size, &uncompressed_size))
+            {
+                HandleBlockReadError(kErrorReadingCompressedBlockData,
+                                     "Failed to read fill memory delta meta-data block");
+                return false;
+            }
+
+            assert(uncompressed_size == data_size);
+        }
+        else
+        {
+            if (!ReadParameterBuffer(data_size))
+            {
+                HandleBlockReadError(kErrorReadingBlockData, "Failed to read fill memory delta meta-data block");
+                return false;
+            }
+        }
+
+        const auto&    buffer       = GetParameterBuffer();
+        const uint8_t* data_address = buffer.data();
+
+        PrepMetadataBlock(delta_cmd.meta_header, meta_data_id, data_address, data_size);
+
+        // Calculate size of packet with compressed or uncompressed data size.
+        delta_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(delta_cmd) + data_size;
+
+        if (!WriteBytes(&delta_cmd, sizeof(delta_cmd)))
+        {
+            HandleBlockWriteError(kErrorWritingBlockHeader,
+                                  "Failed to write fill memory delta meta-data block header");
+            return false;
+        }
+
+        if (!WriteBytes(data_address, data_size))
+        {
+            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write fill memory delta meta-data block");
+            return false;
+        }
+    }
+    else
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read fill memory delta meta-data block header");
+        return false;
+    }
+
+    return true;
+}
+
 bool CompressionConverter::WriteInitBufferMetaData(const format::BlockHeader& block_header,
                                                    format::MetaDataId         meta_data_id)
 {
@@ -31,6 +31,8 @@
 #include "util/defines.h"
 
 #include <memory>
+#include <string>
+#include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 
@@ -43,7 +45,8 @@ class CompressionConverter : public decode::FileTransformer
 
     bool Initialize(const std::string&      input_filename,
                     const std::string&      output_filename,
-                    format::CompressionType target_compression_type);
+                    format::CompressionType target_compression_type,
+                    int                     compression_level = util::Compressor::kDefaultCompressionLevel);
 
   protected:
     virtual bool WriteFileHeader(const format::FileHeader&                  header,
@@ -57,6 +60,14 @@ class CompressionConverter : public decode::FileTransformer
     virtual bool ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id) override;
 
   private:
+    // Collect parameter buffers from the input file as samples, without writing an output file, and train a
+    // dictionary from them.
+    bool TrainDictionary(const std::string& input_filename, std::vector<uint8_t>* dictionary);
+
+    void AddDictionarySample(const uint8_t* data, size_t size);
+
+    bool WriteCompressionDictionary();
+
     bool WriteFunctionCall(format::ApiCallId call_id, format::ThreadId thread_id, size_t buffer_size);
 
     bool WriteMethodCall(format::ApiCallId call_id,
@@ -66,6 +77,8 @@ class CompressionConverter : public decode::FileTransformer
 
     bool WriteFillMemoryMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
 
+    bool WriteFillMemoryDeltaMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
+
     bool WriteInitBufferMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
 
     bool WriteInitImageMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
@@ -86,6 +99,12 @@ class CompressionConverter : public decode::FileTransformer
     bool                              decompressing_;
     format::CompressionType           target_compression_type_;
     std::unique_ptr<util::Compressor> target_compressor_;
+    std::vector<uint8_t>              dictionary_;
+
+    // Dictionary training state, which is only used when collecting samples.
+    bool                 collecting_samples_;
+    std::vector<uint8_t> sample_data_;
+    std::vector<size_t>  sample_sizes_;
 };
 
 GFXRECON_END_NAMESPACE(gfxrecon)
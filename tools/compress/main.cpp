@@ -39,14 +39,17 @@ const char kHelpShortOption[] = "-h";
 const char kHelpLongOption[]  = "--help";
 const char kVersionOption[]   = "--version";
 const char kNoDebugPopup[]    = "--no-debug-popup";
+const char kLevelArgument[]   = "--level";
 
-const char kOptions[] = "-h|--help,--version,--no-debug-popup";
+const char kOptions[]   = "-h|--help,--version,--no-debug-popup";
+const char kArguments[] = "--level";
 
-const char kArgNone[]    = "NONE";
-const char kArgLz4[]     = "LZ4";
-const char kArgZlib[]    = "ZLIB";
-const char kArgZstd[]    = "ZSTD";
-const char kArgUnknown[] = "<Unknown>";
+const char kArgNone[]     = "NONE";
+const char kArgLz4[]      = "LZ4";
+const char kArgZlib[]     = "ZLIB";
+const char kArgZstd[]     = "ZSTD";
+const char kArgZstdDict[] = "ZSTD_DICT";
+const char kArgUnknown[]  = "<Unknown>";
 
 static void PrintUsage(const char* exe_name)
 {
@@ -58,8 +61,9 @@ static void PrintUsage(const char* exe_name)
     }
     GFXRECON_WRITE_CONSOLE("\n%s - A tool to compress/decompress GFXReconstruct capture files.\n", app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Usage:");
-    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] <input_file> <output_file> <compression_format>\n",
-                           app_name.c_str());
+    GFXRECON_WRITE_CONSOLE(
+        "  %s [-h | --help] [--version] [--level <N>] <input_file> <output_file> <compression_format>\n",
+        app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Required arguments:");
     GFXRECON_WRITE_CONSOLE("  <input_file>\t\tPath to the input file to process.");
     GFXRECON_WRITE_CONSOLE("  <output_file>\t\tPath to the output file to generate.");
@@ -73,11 +77,17 @@ static void PrintUsage(const char* exe_name)
 #endif
 #if defined(GFXRECON_ENABLE_ZSTD_COMPRESSION)
     GFXRECON_WRITE_CONSOLE("                      \t  ZSTD - Use Zstandard compression.");
+    GFXRECON_WRITE_CONSOLE("                      \t  ZSTD_DICT - Use Zstandard compression with a dictionary");
+    GFXRECON_WRITE_CONSOLE("                      \t              trained from the input file.");
 #endif
     GFXRECON_WRITE_CONSOLE("                      \t  NONE - Remove compression.");
     GFXRECON_WRITE_CONSOLE("\nOptional arguments:");
     GFXRECON_WRITE_CONSOLE("  -h\t\t\tPrint usage information and exit (same as --help).");
     GFXRECON_WRITE_CONSOLE("  --version\t\tPrint version information and exit.");
+    GFXRECON_WRITE_CONSOLE("  --level <N>\t\tCompression level to use with the output file. For LZ4,");
+    GFXRECON_WRITE_CONSOLE("        \t\tnegative values select faster compression. ZLIB accepts 1 to 9");
+    GFXRECON_WRITE_CONSOLE("        \t\tand ZSTD accepts its standard levels. Default is 0, the");
+    GFXRECON_WRITE_CONSOLE("        \t\tcompression format's default level.");
 #if defined(WIN32) && defined(_DEBUG)
     GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
     GFXRECON_WRITE_CONSOLE("        \t\tdisplayed when abort() is called (Windows debug only).");
@@ -132,6 +142,8 @@ static std::string GetCompressionTypeName(uint32_t type)
             return kArgZlib;
         case gfxrecon::format::CompressionType::kZstd:
             return kArgZstd;
+        case gfxrecon::format::CompressionType::kZstdDictionary:
+            return kArgZstdDict;
         default:
             break;
     }
@@ -143,7 +155,7 @@ int main(int argc, const char** argv)
 {
     gfxrecon::util::Log::Init();
 
-    gfxrecon::util::ArgumentParser arg_parser(argc, argv, kOptions, "");
+    gfxrecon::util::ArgumentParser arg_parser(argc, argv, kOptions, kArguments);
 
     if (CheckOptionPrintUsage(argv[0], arg_parser) || CheckOptionPrintVersion(argv[0], arg_parser))
     {
@@ -187,6 +199,10 @@ int main(int argc, const char** argv)
         {
             compression_type = gfxrecon::format::CompressionType::kZstd;
         }
+        else if (gfxrecon::util::platform::StringCompareNoCase(kArgZstdDict, dst_compression_string.c_str()) == 0)
+        {
+            compression_type = gfxrecon::format::CompressionType::kZstdDictionary;
+        }
         else
         {
             GFXRECON_LOG_ERROR("Unsupported compression format \'%s\'", dst_compression_string.c_str());
@@ -196,9 +212,27 @@ int main(int argc, const char** argv)
         }
     }
 
+    int         compression_level = gfxrecon::util::Compressor::kDefaultCompressionLevel;
+    const auto& level_argument    = arg_parser.GetArgumentValue(kLevelArgument);
+
+    if (!level_argument.empty())
+    {
+        try
+        {
+            compression_level = std::stoi(level_argument);
+        }
+        catch (...)
+        {
+            GFXRECON_LOG_ERROR("Invalid compression level \'%s\'", level_argument.c_str());
+            PrintUsage(argv[0]);
+            gfxrecon::util::Log::Release();
+            exit(-1);
+        }
+    }
+
     gfxrecon::CompressionConverter file_converter;
 
-    if (file_converter.Initialize(input_filename, output_filename, compression_type))
+    if (file_converter.Initialize(input_filename, output_filename, compression_type, compression_level))
     {
         if (file_converter.Process())
         {
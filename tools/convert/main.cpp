@@ -30,6 +30,9 @@
 #include "util/file_output_stream.h"
 #include "util/file_path.h"
 #include "util/platform.h"
+#include "util/threadpool.h"
+#include "decode/block_index.h"
+#include "decode/vulkan_json_index_counter.h"
 
 #include "generated/generated_vulkan_json_consumer.h"
 #include "decode/marker_json_consumer.h"
@@ -38,6 +41,13 @@
 #include "generated/generated_dx12_json_consumer.h"
 #endif
 
+#include <algorithm>
+#include <cstdio>
+#include <future>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
 using gfxrecon::util::JsonFormat;
 using VulkanJsonConsumer = gfxrecon::decode::MetadataJsonConsumer<
     gfxrecon::decode::MarkerJsonConsumer<gfxrecon::decode::VulkanExportJsonConsumer>>;
@@ -47,7 +57,7 @@ using Dx12JsonConsumer =
 #endif
 const char kOptions[] = "-h|--help,--version,--no-debug-popup,--file-per-frame,--include-binaries,--expand-flags";
 
-const char kArguments[] = "--output,--format";
+const char kArguments[] = "--output,--format,--threads";
 
 static void PrintUsage(const char* exe_name)
 {
@@ -82,6 +92,10 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE(
         "  --file-per-frame\tCreates a new file for every frame processed. Frame number is added as a suffix");
     GFXRECON_WRITE_CONSOLE("                  \tto the output file name.");
+    GFXRECON_WRITE_CONSOLE("  --threads <N>\t\tConvert ranges of frames on N threads. The output is the same as");
+    GFXRECON_WRITE_CONSOLE("               \t\tconverting on one thread. An index of the capture file is used to");
+    GFXRECON_WRITE_CONSOLE("               \t\tfind the frames, which is read from <file>.index when it was");
+    GFXRECON_WRITE_CONSOLE("               \t\tgenerated by gfxrecon-index, or is generated before converting.");
 
 #if defined(WIN32) && defined(_DEBUG)
     GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
@@ -130,6 +144,397 @@ std::string FormatFrameNumber(uint32_t frame_number)
     return stream.str();
 }
 
+static uint32_t GetThreadCount(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    const auto& value = arg_parser.GetArgumentValue(kThreadsArgument);
+
+    uint32_t thread_count = 1;
+
+    if (!value.empty())
+    {
+        try
+        {
+            thread_count = static_cast<uint32_t>(std::stoul(value));
+        }
+        catch (std::exception&)
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid threads option. Expected format is --threads <N>");
+        }
+    }
+
+    return std::max(thread_count, 1u);
+}
+
+static uint64_t GetFileSize(const std::string& filename)
+{
+    FILE*    fd        = nullptr;
+    uint64_t file_size = 0;
+
+    if ((gfxrecon::util::platform::FileOpen(&fd, filename.c_str(), "rb") == 0) && (fd != nullptr))
+    {
+        if (gfxrecon::util::platform::FileSeek(fd, 0, gfxrecon::util::platform::FileSeekEnd))
+        {
+            int64_t position = gfxrecon::util::platform::FileTell(fd);
+
+            if (position > 0)
+            {
+                file_size = static_cast<uint64_t>(position);
+            }
+        }
+
+        gfxrecon::util::platform::FileClose(fd);
+    }
+
+    return file_size;
+}
+
+// Settings shared by all of the threads converting a capture file with --threads.
+struct ConvertSettings
+{
+    std::string                 input_filename;
+    std::string                 output_filename;
+    std::string                 vulkan_version;
+    gfxrecon::util::JsonOptions json_options;
+    bool                        file_per_frame{ false };
+};
+
+// Consumer and writer state that accumulates over the whole capture file, and determines the output of later blocks.
+struct ConvertState
+{
+    uint32_t                                                 submit_index{ 0 };
+    std::unordered_map<gfxrecon::format::HandleId, uint32_t> command_indices;
+    uint32_t                                                 file_count{ 0 };
+};
+
+// A range of frames converted by one thread.
+struct ConvertShard
+{
+    uint64_t     first_block{ 0 }; // First block of the first frame in the shard.
+    uint64_t     end_block{ 0 };   // First block of the next shard.
+    std::string  fragment_filename;
+    ConvertState start_state; // State before the first block of the shard.
+    ConvertState end_state;   // State after the last block of the shard, when processed from a default state.
+};
+
+// Convert the frames of a shard, starting from its start state. With count_only, the output is discarded and the end
+// state is recorded. Otherwise, the blocks are written to a fragment file to be appended to the output file by the
+// main thread, or to the files for each frame of the shard.
+static bool ConvertShardFrames(const ConvertSettings&              settings,
+                               const gfxrecon::decode::BlockIndex& index,
+                               bool                                count_only,
+                               ConvertShard*                       shard)
+{
+    gfxrecon::decode::FileProcessor file_processor;
+
+    if (!file_processor.Initialize(settings.input_filename) ||
+        ((shard->first_block > 0) && !file_processor.SeekToBlock(index, shard->first_block)))
+    {
+        return false;
+    }
+
+    VulkanJsonConsumer              json_consumer;
+    gfxrecon::decode::VulkanDecoder decoder;
+    decoder.AddConsumer(&json_consumer);
+    file_processor.AddDecoder(&decoder);
+
+    gfxrecon::decode::JsonWriter json_writer{ settings.json_options,
+                                              GFXRECON_PROJECT_VERSION_STRING,
+                                              settings.input_filename };
+    file_processor.SetAnnotationProcessor(&json_writer);
+    json_consumer.Initialize(&json_writer, settings.vulkan_version);
+
+    json_consumer.SetSubmitIndex(shard->start_state.submit_index);
+    json_consumer.SetCommandBufferRecordIndices(shard->start_state.command_indices);
+    json_writer.SetNumFiles(shard->start_state.file_count);
+
+    std::string json_filename;
+    FILE*       out_file_handle = nullptr;
+
+    if (count_only)
+    {
+        json_writer.StartFragment(nullptr);
+    }
+    else
+    {
+        json_filename = settings.file_per_frame
+                            ? gfxrecon::util::filepath::InsertFilenamePostfix(
+                                  settings.output_filename, "_" + FormatFrameNumber(file_processor.GetCurrentFrameNumber()))
+                            : shard->fragment_filename;
+
+        // Fragments are copied to the output file without text mode conversion.
+        gfxrecon::util::platform::FileOpen(
+            &out_file_handle, json_filename.c_str(), settings.file_per_frame ? "w" : "wb");
+
+        if (out_file_handle == nullptr)
+        {
+            GFXRECON_LOG_ERROR("Failed to create file: '%s'.", json_filename.c_str());
+            return false;
+        }
+    }
+
+    gfxrecon::util::FileNoLockOutputStream out_stream{ out_file_handle, false };
+
+    if (!count_only)
+    {
+        if (settings.file_per_frame)
+        {
+            json_writer.StartStream(&out_stream);
+        }
+        else
+        {
+            json_writer.StartFragment(&out_stream);
+        }
+    }
+
+    bool success = true;
+
+    while (success && (file_processor.GetCurrentBlockIndex() < shard->end_block))
+    {
+        success = file_processor.ProcessNextFrame();
+
+        if (success && !count_only && settings.file_per_frame)
+        {
+            json_writer.EndStream();
+            gfxrecon::util::platform::FileClose(out_file_handle);
+            out_file_handle = nullptr;
+
+            // The file for the frame that follows the shard is written by the next shard.
+            if (file_processor.GetCurrentBlockIndex() < shard->end_block)
+            {
+                json_filename = gfxrecon::util::filepath::InsertFilenamePostfix(
+                    settings.output_filename, "_" + FormatFrameNumber(file_processor.GetCurrentFrameNumber()));
+                gfxrecon::util::platform::FileOpen(&out_file_handle, json_filename.c_str(), "w");
+                success = out_file_handle != nullptr;
+
+                if (success)
+                {
+                    out_stream.Reset(out_file_handle);
+                    json_writer.StartStream(&out_stream);
+                }
+                else
+                {
+                    GFXRECON_LOG_ERROR("Failed to create file: '%s'.", json_filename.c_str());
+                }
+            }
+        }
+    }
+
+    if (!settings.file_per_frame)
+    {
+        json_writer.EndFragment();
+    }
+
+    json_consumer.Destroy();
+
+    if (out_file_handle != nullptr)
+    {
+        gfxrecon::util::platform::FileClose(out_file_handle);
+    }
+
+    if (count_only)
+    {
+        shard->end_state.submit_index    = json_consumer.GetSubmitIndex();
+        shard->end_state.command_indices = json_consumer.GetCommandBufferRecordIndices();
+        shard->end_state.file_count      = json_writer.GetNumFiles();
+    }
+
+    return (file_processor.GetErrorState() == gfxrecon::decode::FileProcessor::kErrorNone);
+}
+
+// Find the end state of a shard by counting the submit and command indices of its blocks, without converting them.
+// Binary file names are not counted, so this is only used when binaries are not written to files.
+static bool CountShardIndices(const ConvertSettings&              settings,
+                              const gfxrecon::decode::BlockIndex& index,
+                              ConvertShard*                       shard)
+{
+    gfxrecon::decode::FileProcessor file_processor;
+
+    if (!file_processor.Initialize(settings.input_filename) ||
+        ((shard->first_block > 0) && !file_processor.SeekToBlock(index, shard->first_block)))
+    {
+        return false;
+    }
+
+    gfxrecon::decode::VulkanJsonIndexCounter counter;
+    file_processor.AddDecoder(&counter);
+
+    bool success = true;
+
+    while (success && (file_processor.GetCurrentBlockIndex() < shard->end_block))
+    {
+        success = file_processor.ProcessNextFrame();
+    }
+
+    shard->end_state.submit_index    = counter.GetSubmitIndex();
+    shard->end_state.command_indices = counter.GetCommandBufferRecordIndices();
+
+    return (file_processor.GetErrorState() == gfxrecon::decode::FileProcessor::kErrorNone);
+}
+
+// Split the frames of the capture file into shards with similar numbers of blocks.
+static std::vector<ConvertShard> GetConvertShards(const gfxrecon::decode::BlockIndex& index, size_t shard_count)
+{
+    const auto&               entries = index.GetEntries();
+    std::vector<ConvertShard> shards(1);
+    uint64_t                  block_count = entries.empty() ? 0 : entries.back().block_index;
+    uint64_t                  shard_size  = std::max<uint64_t>(block_count / shard_count, 1);
+
+    for (const auto& entry : entries)
+    {
+        if ((entry.type == gfxrecon::decode::BlockIndex::kFrameStart) &&
+            (entry.block_index >= shards.back().first_block + shard_size))
+        {
+            shards.back().end_block = entry.block_index;
+            shards.emplace_back();
+            shards.back().first_block = entry.block_index;
+        }
+    }
+
+    shards.back().end_block = std::numeric_limits<uint64_t>::max();
+
+    return shards;
+}
+
+static bool AppendFragment(const std::string& fragment_filename, gfxrecon::decode::JsonWriter* json_writer)
+{
+    FILE* fragment_file = nullptr;
+    gfxrecon::util::platform::FileOpen(&fragment_file, fragment_filename.c_str(), "rb");
+
+    if (fragment_file == nullptr)
+    {
+        GFXRECON_LOG_ERROR("Failed to open file: '%s'.", fragment_filename.c_str());
+        return false;
+    }
+
+    const size_t      kCopySize = 1024 * 1024;
+    std::vector<char> buffer(kCopySize);
+    size_t            bytes_read = 0;
+
+    while ((bytes_read = fread(buffer.data(), 1, buffer.size(), fragment_file)) > 0)
+    {
+        json_writer->AppendFragment(buffer.data(), bytes_read);
+    }
+
+    gfxrecon::util::platform::FileClose(fragment_file);
+
+    return true;
+}
+
+// Convert the capture file on multiple threads, each converting a range of frames found with the block index of the
+// capture file. Submit and command indices, and binary file names, depend on the blocks that precede a shard, so the
+// shards other than the last are first processed without output to find the state that each shard starts from. The
+// indices are counted without converting the blocks, unless binary files are written, which are only named by the
+// conversion.
+static bool ConvertFrameShards(const ConvertSettings& settings, uint32_t thread_count, FILE* out_file_handle)
+{
+    gfxrecon::decode::BlockIndex index;
+    uint64_t                     file_size      = GetFileSize(settings.input_filename);
+    std::string                  index_filename = gfxrecon::decode::BlockIndex::GetIndexFilename(settings.input_filename);
+
+    if (!index.Load(index_filename, file_size))
+    {
+        gfxrecon::decode::FileProcessor file_processor(std::numeric_limits<uint64_t>::max());
+
+        GFXRECON_LOG_INFO("Indexing %s; run gfxrecon-index to keep the index for later conversions",
+                          settings.input_filename.c_str());
+
+        index.SetCaptureFileSize(file_size);
+        file_processor.SetBlockIndexRecorder(&index);
+
+        if (!file_processor.Initialize(settings.input_filename))
+        {
+            return false;
+        }
+
+        file_processor.ProcessAllFrames();
+
+        if (file_processor.GetErrorState() != gfxrecon::decode::FileProcessor::kErrorNone)
+        {
+            return false;
+        }
+    }
+
+    // More shards than threads balance the work when frames differ in cost.
+    const size_t                   kShardsPerThread = 4;
+    std::vector<ConvertShard>      shards           = GetConvertShards(index, thread_count * kShardsPerThread);
+    gfxrecon::util::ThreadPool     thread_pool(thread_count);
+    std::vector<std::future<bool>> results;
+    bool                           success = true;
+
+    for (size_t i = 0; i < (shards.size() - 1); ++i)
+    {
+        if (settings.json_options.dump_binaries)
+        {
+            results.push_back(
+                thread_pool.post(ConvertShardFrames, std::cref(settings), std::cref(index), true, &shards[i]));
+        }
+        else
+        {
+            results.push_back(thread_pool.post(CountShardIndices, std::cref(settings), std::cref(index), &shards[i]));
+        }
+    }
+
+    for (auto& result : results)
+    {
+        success = result.get() && success;
+    }
+
+    for (size_t i = 1; i < shards.size(); ++i)
+    {
+        const ConvertState& previous_start = shards[i - 1].start_state;
+        const ConvertState& previous_end   = shards[i - 1].end_state;
+        ConvertState&       start_state    = shards[i].start_state;
+
+        start_state.submit_index    = previous_start.submit_index + previous_end.submit_index;
+        start_state.file_count      = previous_start.file_count + previous_end.file_count;
+        start_state.command_indices = previous_start.command_indices;
+
+        for (const auto& entry : previous_end.command_indices)
+        {
+            start_state.command_indices[entry.first] += entry.second;
+        }
+    }
+
+    results.clear();
+
+    for (size_t i = 0; success && (i < shards.size()); ++i)
+    {
+        // Fragments are written next to the output file, or next to the capture file when writing to stdout.
+        shards[i].fragment_filename =
+            ((out_file_handle == stdout) ? settings.input_filename : settings.output_filename) + ".part" +
+            std::to_string(i);
+        results.push_back(
+            thread_pool.post(ConvertShardFrames, std::cref(settings), std::cref(index), false, &shards[i]));
+    }
+
+    for (auto& result : results)
+    {
+        success = result.get() && success;
+    }
+
+    if (!settings.file_per_frame)
+    {
+        gfxrecon::util::FileNoLockOutputStream out_stream{ out_file_handle, false };
+        VulkanJsonConsumer                     json_consumer;
+        gfxrecon::decode::JsonWriter           json_writer{ settings.json_options,
+                                                  GFXRECON_PROJECT_VERSION_STRING,
+                                                  settings.input_filename };
+
+        json_consumer.Initialize(&json_writer, settings.vulkan_version);
+        json_writer.StartStream(&out_stream);
+
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            success = success && AppendFragment(shards[i].fragment_filename, &json_writer);
+            std::remove(shards[i].fragment_filename.c_str());
+        }
+
+        json_consumer.Destroy();
+    }
+
+    return success;
+}
+
 int main(int argc, const char** argv)
 {
     int ret_code = 0;
@@ -173,6 +578,7 @@ int main(int argc, const char** argv)
     bool        expand_flags         = arg_parser.IsOptionSet(kExpandFlagsOption);
     bool        file_per_frame       = arg_parser.IsOptionSet(kFilePerFrameOption);
     bool        output_to_stdout     = output_filename == "stdout";
+    uint32_t    thread_count         = GetThreadCount(arg_parser);
 
     bool   is_asset_file = false;
     size_t last_dot_pos  = input_filename.find_last_of(".");
@@ -209,7 +615,67 @@ int main(int argc, const char** argv)
         gfxrecon::util::filepath::MakeDirectory(data_dir);
     }
 
-    if (file_processor.Initialize(input_filename))
+#if defined(D3D12_SUPPORT)
+    if (thread_count > 1)
+    {
+        bool detected_d3d12  = false;
+        bool detected_vulkan = false;
+        gfxrecon::decode::DetectAPIs(input_filename, detected_d3d12, detected_vulkan);
+
+        if (detected_d3d12)
+        {
+            GFXRECON_LOG_WARNING("Converting D3D12 content on multiple threads is not supported; using one thread.");
+            thread_count = 1;
+        }
+    }
+#endif
+
+    if (thread_count > 1)
+    {
+        ConvertSettings settings;
+        FILE*           out_file_handle = nullptr;
+
+        settings.input_filename  = input_filename;
+        settings.output_filename = output_filename;
+        settings.file_per_frame  = file_per_frame;
+        settings.vulkan_version  = std::to_string(VK_VERSION_MAJOR(VK_HEADER_VERSION_COMPLETE)) + "." +
+                                  std::to_string(VK_VERSION_MINOR(VK_HEADER_VERSION_COMPLETE)) + "." +
+                                  std::to_string(VK_VERSION_PATCH(VK_HEADER_VERSION_COMPLETE));
+
+        settings.json_options.root_dir      = output_dir;
+        settings.json_options.data_sub_dir  = filename_stem;
+        settings.json_options.format        = output_format;
+        settings.json_options.dump_binaries = dump_binaries;
+        settings.json_options.expand_flags  = expand_flags;
+
+        if (output_to_stdout)
+        {
+            out_file_handle = stdout;
+        }
+        else if (!file_per_frame)
+        {
+            gfxrecon::util::platform::FileOpen(&out_file_handle, output_filename.c_str(), "w");
+
+            if (!out_file_handle)
+            {
+                GFXRECON_LOG_ERROR("Failed to open/create output file \"%s\"; is the path valid?",
+                                   output_filename.c_str());
+                ret_code = 1;
+            }
+        }
+
+        if ((ret_code == 0) && !ConvertFrameShards(settings, thread_count, out_file_handle))
+        {
+            GFXRECON_LOG_ERROR("Failed to process trace.");
+            ret_code = 1;
+        }
+
+        if ((out_file_handle != nullptr) && !output_to_stdout)
+        {
+            gfxrecon::util::platform::FileClose(out_file_handle);
+        }
+    }
+    else if (file_processor.Initialize(input_filename))
     {
         std::string json_filename;
         FILE*       out_file_handle = nullptr;
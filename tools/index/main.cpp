@@ -0,0 +1,301 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include PROJECT_VERSION_HEADER_FILE
+
+#include "decode/block_index.h"
+#include "decode/file_processor.h"
+#include "util/argument_parser.h"
+#include "util/logging.h"
+#include "util/options.h"
+#include "util/platform.h"
+
+#include "vulkan/vulkan_core.h"
+
+#include <cinttypes>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <vector>
+
+const char kHelpShortOption[]         = "-h";
+const char kHelpLongOption[]          = "--help";
+const char kVersionOption[]           = "--version";
+const char kNoDebugPopup[]            = "--no-debug-popup";
+const char kOutputArgument[]          = "--output";
+const char kPrintBlockInfosArgument[] = "--pbis";
+
+const char kOptions[]   = "-h|--help,--version,--no-debug-popup";
+const char kArguments[] = "--output,--pbis";
+
+// Process all blocks, as there are no decoders to determine when processing is complete.
+const uint64_t kNoBlockLimit = std::numeric_limits<uint64_t>::max();
+
+static void PrintUsage(const char* exe_name)
+{
+    std::string app_name     = exe_name;
+    size_t      dir_location = app_name.find_last_of("/\\");
+    if (dir_location >= 0)
+    {
+        app_name.replace(0, dir_location + 1, "");
+    }
+    GFXRECON_WRITE_CONSOLE("\n%s - Generate an index of frames and blocks for a GFXReconstruct capture file.\n",
+                           app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("Usage:");
+    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] [--output <index_file>] [--pbis <index1,index2>] <file>\n",
+                           app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("Required arguments:");
+    GFXRECON_WRITE_CONSOLE("  <file>\t\tThe GFXReconstruct capture file to be processed.");
+    GFXRECON_WRITE_CONSOLE("\nOptional arguments:");
+    GFXRECON_WRITE_CONSOLE("  -h\t\t\tPrint usage information and exit (same as --help).");
+    GFXRECON_WRITE_CONSOLE("  --version\t\tPrint version information and exit.");
+    GFXRECON_WRITE_CONSOLE("  --output <index_file>\tPath of the index file. Default is <file>.index.");
+    GFXRECON_WRITE_CONSOLE("  --pbis <index1,index2>\tPrint block information between block index1 and block");
+    GFXRECON_WRITE_CONSOLE("        \t\tindex2, seeking to block index1 with the index file. The index");
+    GFXRECON_WRITE_CONSOLE("        \t\tfile is generated first if it does not exist.");
+#if defined(WIN32) && defined(_DEBUG)
+    GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
+    GFXRECON_WRITE_CONSOLE("        \t\tdisplayed when abort() is called (Windows debug only).");
+#endif
+}
+
+static bool CheckOptionPrintUsage(const char* exe_name, const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    if (arg_parser.IsOptionSet(kHelpShortOption) || arg_parser.IsOptionSet(kHelpLongOption))
+    {
+        PrintUsage(exe_name);
+        return true;
+    }
+
+    return false;
+}
+
+static bool CheckOptionPrintVersion(const char* exe_name, const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    if (arg_parser.IsOptionSet(kVersionOption))
+    {
+        std::string app_name     = exe_name;
+        size_t      dir_location = app_name.find_last_of("/\\");
+
+        if (dir_location >= 0)
+        {
+            app_name.replace(0, dir_location + 1, "");
+        }
+
+        GFXRECON_WRITE_CONSOLE("%s version info:", app_name.c_str());
+        GFXRECON_WRITE_CONSOLE("  GFXReconstruct Version %s", GFXRECON_PROJECT_VERSION_STRING);
+        GFXRECON_WRITE_CONSOLE("  Vulkan Header Version %u.%u.%u",
+                               VK_VERSION_MAJOR(VK_HEADER_VERSION_COMPLETE),
+                               VK_VERSION_MINOR(VK_HEADER_VERSION_COMPLETE),
+                               VK_VERSION_PATCH(VK_HEADER_VERSION_COMPLETE));
+
+        return true;
+    }
+
+    return false;
+}
+
+static uint64_t GetFileSize(const std::string& filename)
+{
+    FILE*    fd        = nullptr;
+    uint64_t file_size = 0;
+
+    if ((gfxrecon::util::platform::FileOpen(&fd, filename.c_str(), "rb") == 0) && (fd != nullptr))
+    {
+        if (gfxrecon::util::platform::FileSeek(fd, 0, gfxrecon::util::platform::FileSeekEnd))
+        {
+            int64_t position = gfxrecon::util::platform::FileTell(fd);
+
+            if (position > 0)
+            {
+                file_size = static_cast<uint64_t>(position);
+            }
+        }
+
+        gfxrecon::util::platform::FileClose(fd);
+    }
+
+    return file_size;
+}
+
+static bool GenerateIndex(const std::string&            input_filename,
+                          const std::string&            index_filename,
+                          uint64_t                      file_size,
+                          gfxrecon::decode::BlockIndex* index)
+{
+    gfxrecon::decode::FileProcessor file_processor(kNoBlockLimit);
+
+    index->SetCaptureFileSize(file_size);
+    file_processor.SetBlockIndexRecorder(index);
+
+    if (!file_processor.Initialize(input_filename))
+    {
+        return false;
+    }
+
+    file_processor.ProcessAllFrames();
+
+    if (file_processor.GetErrorState() != gfxrecon::decode::FileProcessor::kErrorNone)
+    {
+        GFXRECON_WRITE_CONSOLE("A failure has occurred while indexing %s", input_filename.c_str());
+        return false;
+    }
+
+    if (!index->Save(index_filename))
+    {
+        return false;
+    }
+
+    uint32_t frame_count  = 0;
+    uint32_t marker_count = 0;
+
+    for (const auto& entry : index->GetEntries())
+    {
+        if (entry.type == gfxrecon::decode::BlockIndex::kFrameStart)
+        {
+            ++frame_count;
+        }
+        else if ((entry.type == gfxrecon::decode::BlockIndex::kStateBeginMarker) ||
+                 (entry.type == gfxrecon::decode::BlockIndex::kStateEndMarker))
+        {
+            ++marker_count;
+        }
+    }
+
+    GFXRECON_WRITE_CONSOLE("Indexed %u frames and %u state markers of %s to %s",
+                           frame_count,
+                           marker_count,
+                           input_filename.c_str(),
+                           index_filename.c_str());
+
+    return true;
+}
+
+static bool PrintBlockInfo(const std::string&                  input_filename,
+                           const gfxrecon::decode::BlockIndex& index,
+                           uint64_t                            block_index_from,
+                           uint64_t                            block_index_to)
+{
+    // The block limit stops processing after the last block of the range.
+    gfxrecon::decode::FileProcessor file_processor(block_index_to);
+
+    if (!file_processor.Initialize(input_filename))
+    {
+        return false;
+    }
+
+    if (!file_processor.SeekToBlock(index, block_index_from))
+    {
+        GFXRECON_WRITE_CONSOLE(
+            "Block %" PRIu64 " was not found in the index of %s", block_index_from, input_filename.c_str());
+        return false;
+    }
+
+    file_processor.SetPrintBlockInfoFlag(
+        true, static_cast<int64_t>(block_index_from), static_cast<int64_t>(block_index_to));
+
+    while (file_processor.ProcessNextFrame())
+    {
+    }
+
+    return (file_processor.GetErrorState() == gfxrecon::decode::FileProcessor::kErrorNone);
+}
+
+int main(int argc, const char** argv)
+{
+    gfxrecon::util::Log::Init();
+
+    gfxrecon::util::ArgumentParser arg_parser(argc, argv, kOptions, kArguments);
+
+    if (CheckOptionPrintUsage(argv[0], arg_parser) || CheckOptionPrintVersion(argv[0], arg_parser))
+    {
+        gfxrecon::util::Log::Release();
+        exit(0);
+    }
+    else if (arg_parser.IsInvalid() || (arg_parser.GetPositionalArgumentsCount() != 1))
+    {
+        PrintUsage(argv[0]);
+        gfxrecon::util::Log::Release();
+        exit(-1);
+    }
+    else
+    {
+#if defined(WIN32) && defined(_DEBUG)
+        if (arg_parser.IsOptionSet(kNoDebugPopup))
+        {
+            _set_abort_behavior(0, _WRITE_ABORT_MSG | _CALL_REPORTFAULT);
+        }
+#endif
+    }
+
+    const std::vector<std::string>& positional_arguments = arg_parser.GetPositionalArguments();
+    std::string                     input_filename       = positional_arguments[0];
+    std::string                     index_filename       = arg_parser.GetArgumentValue(kOutputArgument);
+
+    if (index_filename.empty())
+    {
+        index_filename = gfxrecon::decode::BlockIndex::GetIndexFilename(input_filename);
+    }
+
+    uint64_t file_size = GetFileSize(input_filename);
+
+    if (file_size == 0)
+    {
+        GFXRECON_WRITE_CONSOLE("Failed to open capture file %s", input_filename.c_str());
+        gfxrecon::util::Log::Release();
+        exit(-1);
+    }
+
+    gfxrecon::decode::BlockIndex index;
+    int                          return_code = 0;
+
+    if (arg_parser.IsArgumentSet(kPrintBlockInfosArgument))
+    {
+        std::vector<gfxrecon::util::UintRange> block_ranges = gfxrecon::util::GetUintRanges(
+            arg_parser.GetArgumentValue(kPrintBlockInfosArgument).c_str(), "Print block information");
+
+        if (block_ranges.size() != 2)
+        {
+            PrintUsage(argv[0]);
+            gfxrecon::util::Log::Release();
+            exit(-1);
+        }
+
+        // Reuse an index generated for the same capture file, which avoids reading the entire file.
+        if (!index.Load(index_filename, file_size) && !GenerateIndex(input_filename, index_filename, file_size, &index))
+        {
+            return_code = -1;
+        }
+        else if (!PrintBlockInfo(input_filename, index, block_ranges[0].first, block_ranges[1].first))
+        {
+            return_code = -1;
+        }
+    }
+    else if (!GenerateIndex(input_filename, index_filename, file_size, &index))
+    {
+        return_code = -1;
+    }
+
+    gfxrecon::util::Log::Release();
+
+    return return_code;
+}
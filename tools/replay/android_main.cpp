@@ -103,10 +103,12 @@ void android_main(struct android_app* app)
         try
         {
             std::unique_ptr<gfxrecon::decode::FileProcessor> file_processor =
-                arg_parser.IsOptionSet(kPreloadMeasurementRangeOption)
+                (arg_parser.IsOptionSet(kPreloadMeasurementRangeOption) || (GetMeasurementLoopCount(arg_parser) > 1))
                     ? std::make_unique<gfxrecon::decode::PreloadFileProcessor>()
                     : std::make_unique<gfxrecon::decode::FileProcessor>();
 
+            file_processor->SetReadAheadBufferCount(GetReadAheadBufferCount(arg_parser));
+
             if (!file_processor->Initialize(filename))
             {
                 GFXRECON_WRITE_CONSOLE("Failed to load file %s.", filename.c_str());
@@ -151,7 +153,8 @@ void android_main(struct android_app* app)
                                                      replay_options.flush_measurement_frame_range,
                                                      replay_options.flush_inside_measurement_range,
                                                      replay_options.preload_measurement_range,
-                                                     measurement_file_name);
+                                                     measurement_file_name,
+                                                     replay_options.measurement_loop_count);
 
                 replay_consumer.SetFatalErrorHandler([](const char* message) { throw std::runtime_error(message); });
                 replay_consumer.SetFpsInfo(&fps_info);
@@ -152,7 +152,7 @@ int main(int argc, const char** argv)
 
         std::unique_ptr<gfxrecon::decode::FileProcessor> file_processor;
 
-        if (arg_parser.IsOptionSet(kPreloadMeasurementRangeOption))
+        if (arg_parser.IsOptionSet(kPreloadMeasurementRangeOption) || (GetMeasurementLoopCount(arg_parser) > 1))
         {
             file_processor = std::make_unique<gfxrecon::decode::PreloadFileProcessor>();
         }
@@ -161,6 +161,8 @@ int main(int argc, const char** argv)
             file_processor = std::make_unique<gfxrecon::decode::FileProcessor>();
         }
 
+        file_processor->SetReadAheadBufferCount(GetReadAheadBufferCount(arg_parser));
+
         if (!file_processor->Initialize(filename))
         {
             return_code = -1;
@@ -191,6 +193,7 @@ int main(int argc, const char** argv)
             bool        flush_measurement_frame_range      = false;
             bool        flush_inside_measurement_range     = false;
             bool        preload_measurement_frame_range    = false;
+            uint32_t    measurement_loop_count             = 1;
             std::string measurement_file_name;
 
             if (vulkan_replay_options.enable_vulkan)
@@ -200,6 +203,7 @@ int main(int argc, const char** argv)
                 flush_measurement_frame_range      = vulkan_replay_options.flush_measurement_frame_range;
                 flush_inside_measurement_range     = vulkan_replay_options.flush_inside_measurement_range;
                 preload_measurement_frame_range    = vulkan_replay_options.preload_measurement_range;
+                measurement_loop_count             = vulkan_replay_options.measurement_loop_count;
             }
 
             if (has_mfr)
@@ -214,7 +218,8 @@ int main(int argc, const char** argv)
                                                  flush_measurement_frame_range,
                                                  flush_inside_measurement_range,
                                                  preload_measurement_frame_range,
-                                                 measurement_file_name);
+                                                 measurement_file_name,
+                                                 measurement_loop_count);
 
             gfxrecon::decode::VulkanReplayConsumer vulkan_replay_consumer(application, vulkan_replay_options);
             gfxrecon::decode::VulkanDecoder        vulkan_decoder;
@@ -44,7 +44,8 @@ const char kArguments[] =
     "force-windowed,--fwo|--force-windowed-origin,--batching-memory-usage,--measurement-file,--swapchain,--sgfs|--skip-"
     "get-fence-status,--sgfr|--"
     "skip-get-fence-ranges,--dump-resources,--dump-resources-scale,--dump-resources-image-format,--dump-resources-dir,"
-    "--dump-resources-dump-color-attachment-index,--pbis,--pcj|--pipeline-creation-jobs";
+    "--dump-resources-dump-color-attachment-index,--pbis,--pcj|--pipeline-creation-jobs,--read-ahead,"
+    "--measurement-loop-count";
 
 static void PrintUsage(const char* exe_name)
 {
@@ -77,11 +78,12 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("\t\t\t[--offscreen-swapchain-frame-boundary]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--mfr|--measurement-frame-range <start-frame>-<end-frame>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--measurement-file <file>] [--quit-after-measurement-range]");
-    GFXRECON_WRITE_CONSOLE("\t\t\t[--flush-measurement-range]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--flush-measurement-range] [--measurement-loop-count <count>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--fw <width,height> | --force-windowed <width,height>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--sgfs <status> | --skip-get-fence-status <status>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--sgfr <frame-ranges> | --skip-get-fence-ranges <frame-ranges>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--pbi-all] [--pbis <index1,index2>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--read-ahead <num_buffers>]");
 #if defined(WIN32)
     GFXRECON_WRITE_CONSOLE("\t\t\t[--dump-resources <submit-index,command-index,drawcall-index>]");
 #endif
@@ -166,6 +168,11 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("  --pbi-all\t\tPrint all block information.");
     GFXRECON_WRITE_CONSOLE(
         "  --pbis <index1,index2>\t\tPrint block information between block index1 and block index2.");
+    GFXRECON_WRITE_CONSOLE("  --read-ahead <num_buffers>");
+    GFXRECON_WRITE_CONSOLE("          \t\tRead and decompress the capture file on a background thread, which");
+    GFXRECON_WRITE_CONSOLE("          \t\tstays up to <num_buffers> buffers of blocks ahead of replay. Each");
+    GFXRECON_WRITE_CONSOLE("          \t\tbuffer holds approximately 1 MB of blocks. Default is 0 (read the");
+    GFXRECON_WRITE_CONSOLE("          \t\tfile on the replay thread).");
 #if defined(WIN32)
     GFXRECON_WRITE_CONSOLE("")
     GFXRECON_WRITE_CONSOLE("Windows only:")
@@ -266,6 +273,13 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("          \t\tIf this is specified the replayer will flush")
     GFXRECON_WRITE_CONSOLE("          \t\tand wait for all current GPU work to finish at the");
     GFXRECON_WRITE_CONSOLE("          \t\tend of each frame inside the measurement range.");
+    GFXRECON_WRITE_CONSOLE("  --measurement-loop-count <count>");
+    GFXRECON_WRITE_CONSOLE("          \t\tReplay the measurement range <count> times in a row and report");
+    GFXRECON_WRITE_CONSOLE("          \t\tframe time statistics (min/median/p99) for each loop. The range is");
+    GFXRECON_WRITE_CONSOLE("          \t\tpreloaded once and replayed again from memory, which implies");
+    GFXRECON_WRITE_CONSOLE("          \t\t--preload-measurement-range. State is not reset between loops, so");
+    GFXRECON_WRITE_CONSOLE("          \t\treplay stops after the first loop if the range creates or destroys");
+    GFXRECON_WRITE_CONSOLE("          \t\tobjects. Default is 1.");
     GFXRECON_WRITE_CONSOLE("  --gpu-group <index>\tUse the specified device group for replay, where index");
     GFXRECON_WRITE_CONSOLE("          \t\tis the zero-based index to the array of physical device group");
     GFXRECON_WRITE_CONSOLE("          \t\treturned by vkEnumeratePhysicalDeviceGroups.  Replay may fail");
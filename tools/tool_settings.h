@@ -117,6 +117,7 @@ const char kFormatArgument[]                      = "--format";
 const char kIncludeBinariesOption[]               = "--include-binaries";
 const char kExpandFlagsOption[]                   = "--expand-flags";
 const char kFilePerFrameOption[]                  = "--file-per-frame";
+const char kThreadsArgument[]                     = "--threads";
 const char kSkipGetFenceStatus[]                  = "--skip-get-fence-status";
 const char kSkipGetFenceRanges[]                  = "--skip-get-fence-ranges";
 const char kWaitBeforePresent[]                   = "--wait-before-present";
@@ -124,6 +125,8 @@ const char kPrintBlockInfoAllOption[]             = "--pbi-all";
 const char kPrintBlockInfosArgument[]             = "--pbis";
 const char kNumPipelineCreationJobs[]             = "--pipeline-creation-jobs";
 const char kPreloadMeasurementRangeOption[]       = "--preload-measurement-range";
+const char kMeasurementLoopCountArgument[]        = "--measurement-loop-count";
+const char kReadAheadArgument[]                   = "--read-ahead";
 #if defined(WIN32)
 const char kDxTwoPassReplay[]             = "--dx12-two-pass-replay";
 const char kDxOverrideObjectNames[]       = "--dx12-override-object-names";
@@ -631,6 +634,55 @@ static float GetScreenshotScale(const gfxrecon::util::ArgumentParser& arg_parser
     return scale;
 }
 
+static size_t GetReadAheadBufferCount(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    const auto& value = arg_parser.GetArgumentValue(kReadAheadArgument);
+
+    size_t buffer_count = 0;
+
+    if (!value.empty())
+    {
+        try
+        {
+            buffer_count = static_cast<size_t>(std::stoul(value));
+        }
+        catch (std::exception&)
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid read-ahead option. Expected format is --read-ahead <num_buffers>");
+        }
+    }
+
+    return buffer_count;
+}
+
+static uint32_t GetMeasurementLoopCount(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    const auto& value = arg_parser.GetArgumentValue(kMeasurementLoopCountArgument);
+
+    uint32_t loop_count = 1;
+
+    if (!value.empty())
+    {
+        try
+        {
+            loop_count = static_cast<uint32_t>(std::stoul(value));
+        }
+        catch (std::exception&)
+        {
+            GFXRECON_LOG_WARNING(
+                "Ignoring invalid measurement loop count option. Expected format is --measurement-loop-count <count>");
+        }
+
+        if (loop_count == 0)
+        {
+            GFXRECON_LOG_WARNING("Ignoring measurement loop count of 0, the measurement range will be replayed once");
+            loop_count = 1;
+        }
+    }
+
+    return loop_count;
+}
+
 static float GetDumpResourcesScale(const gfxrecon::util::ArgumentParser& arg_parser)
 {
     const auto& value = arg_parser.GetArgumentValue(kDumpResourcesScaleArgument);
@@ -1085,6 +1137,13 @@ GetVulkanReplayOptions(const gfxrecon::util::ArgumentParser&           arg_parse
         replay_options.preload_measurement_range = true;
     }
 
+    replay_options.measurement_loop_count = GetMeasurementLoopCount(arg_parser);
+    if (replay_options.measurement_loop_count > 1)
+    {
+        // Looping replays the preloaded blocks, so it implies preloading of the measurement range.
+        replay_options.preload_measurement_range = true;
+    }
+
     replay_options.dump_resources              = arg_parser.GetArgumentValue(kDumpResourcesArgument);
     replay_options.dump_resources_before       = arg_parser.IsOptionSet(kDumpResourcesBeforeDrawOption);
     replay_options.dump_resources_dump_depth   = arg_parser.IsOptionSet(kDumpResourcesDepth);